@@ -6,25 +6,30 @@ Purpose
 
 Adds or updates achievements.
 
+The achievement id "summary" is reserved, GET /achievements/summary would shadow the achievement's GET /achievements/{achievement_id}.
+
 This is a non-player facing Lambda function and used from the GameKit plugin.
 """
 
 import os
 
 import botocore
-from gamekithelpers import handler_request, handler_response, ddb, sanitizer, s3
+from gamekithelpers import handler_request, handler_response, ddb, sanitizer, s3, api_cache
 
 achievements_table = ddb.get_table(os.environ['ACHIEVEMENTS_TABLE_NAME'])
 achievements_bucket = os.environ['ACHIEVEMENTS_BUCKET_NAME']
 s3_client = s3.get_s3_client()
 
+# Achievement ids which are also the last segment of another achievements route
+RESERVED_ACHIEVEMENT_IDS = {'summary'}
+
 
 def _get_achievement_update_request(achievement):
     """
     Creates a DynamoDB request to update an achievement
     """
     now = ddb.timestamp()
-    return {
+    request = {
             'Key': {
                 'achievement_id': sanitizer.sanitize(achievement.get("achievement_id")),
             },
@@ -41,6 +46,7 @@ def _get_achievement_update_request(achievement):
                 '#is_secret': 'is_secret',
                 '#is_hidden': 'is_hidden',
                 '#order_number': 'order_number',
+                '#visible': 'visible',
                 '#created_at': 'created_at',
                 '#updated_at': 'updated_at'
             },
@@ -67,6 +73,14 @@ def _get_achievement_update_request(achievement):
                                 '#created_at = if_not_exists(created_at, :created_at), #updated_at = :updated_at '
         }
 
+    # Only the visible achievements have the key of the sparse index GetAchievements reads the catalog from
+    if achievement.get("is_hidden"):
+        request['UpdateExpression'] += 'REMOVE #visible'
+    else:
+        request['ExpressionAttributeValues'][':visible'] = 'true'
+        request['UpdateExpression'] += ', #visible = :visible'
+    return request
+
 
 def _get_achievement_icons_request(achievement):
     """
@@ -142,6 +156,12 @@ def lambda_handler(event, context):
     if achievements is None or len(achievements) == 0:
         return handler_response.invalid_request()
 
+    reserved_ids = [achievement.get('achievement_id') for achievement in achievements
+                    if achievement.get('achievement_id') in RESERVED_ACHIEVEMENT_IDS]
+    if len(reserved_ids) > 0:
+        print(f"Reserved achievement ids: {reserved_ids}")
+        return handler_response.invalid_request()
+
     response_achievements = []
     for achievement in achievements:
         try:
@@ -158,4 +178,7 @@ def lambda_handler(event, context):
             print(f"Error updating items. Error: {err}")
             raise err
 
+    # Players see the changes right away instead of after the TTL of their cached achievements
+    api_cache.flush_api_cache()
+
     return handler_response.response_envelope(200, None, {'achievements': response_achievements})
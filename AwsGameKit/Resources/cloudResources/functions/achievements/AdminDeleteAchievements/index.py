@@ -11,7 +11,7 @@ This is a non-player facing Lambda function and used from the GameKit plugin.
 
 import boto3
 import botocore
-from gamekithelpers import handler_request, handler_response, s3
+from gamekithelpers import handler_request, handler_response, s3, api_cache
 import json
 import os
 from typing import Dict, List
@@ -134,4 +134,6 @@ def lambda_handler(event, context):
     if len(achievement_icon_keys) > 0:
         _delete_achievement_icons(achievement_icon_keys)
 
+    api_cache.flush_api_cache()
+
     return handler_response.return_response(204, None)
@@ -12,26 +12,70 @@ This is a non-player facing Lambda function and used from the GameKit plugin.
 import distutils.core
 import json
 import os
+from concurrent.futures import ThreadPoolExecutor
 
 import botocore
 from gamekithelpers import handler_request, handler_response, ddb
 
 ddb_table = ddb.get_table(os.environ['ACHIEVEMENTS_TABLE_NAME'])
 
-def _get_achievements(response_limit, use_consistent_read, start_key):
-    response = ddb_table.scan(**ddb.scan_request_param(response_limit, use_consistent_read, start_key))
+# Segments scanned in parallel when all pages are requested at once, 1 scans the table sequentially
+SCAN_SEGMENTS = int(os.environ.get('SCAN_SEGMENTS', '1'))
+
+# Largest total_segments accepted from the caller
+MAX_TOTAL_SEGMENTS = 64
+
+def _get_achievements(response_limit, use_consistent_read, start_key, segment=None, total_segments=None):
+    response = ddb_table.scan(**ddb.scan_request_param(response_limit, use_consistent_read, start_key,
+                                                       segment=segment, total_segments=total_segments))
     return ddb.get_response_items(response)
 
 
+def _get_all_achievements(response_limit, use_consistent_read, start_key, segment=None, total_segments=None):
+    all_achievements = []
+    achievements, next_start_key = _get_achievements(response_limit, use_consistent_read, start_key, segment, total_segments)
+    all_achievements.extend(achievements)
+    while next_start_key:
+        achievements, next_start_key = _get_achievements(response_limit, use_consistent_read, next_start_key, segment, total_segments)
+        all_achievements.extend(achievements)
+    return all_achievements
+
+
+def _get_all_achievements_in_parallel(response_limit, use_consistent_read, total_segments):
+    """
+    Scans every segment of the table on its own thread, and merges the segments in order.
+    """
+    with ThreadPoolExecutor(max_workers=total_segments) as executor:
+        segments = executor.map(lambda segment: _get_all_achievements(response_limit, use_consistent_read, None, segment, total_segments),
+                                range(total_segments))
+        return [achievement for achievements in segments for achievement in achievements]
+
+
+def _get_segment_param(event, name):
+    value = handler_request.get_query_string_param(event, name)
+    if value is None or len(value) == 0:
+        return None
+    try:
+        return int(value)
+    except ValueError:
+        return -1
+
+
 def lambda_handler(event, context):
     """
     This is the lambda function handler.
+
+    The optional segment and total_segments query string parameters list one segment of a parallel scan, so that a client can request the
+    segments concurrently and merge them as they arrive. Each segment pages with start_key like a whole table scan.
+    Without them, a request for all pages from the start scans SCAN_SEGMENTS segments in parallel.
     """
     handler_request.log_event(event)
 
     start_key = handler_request.get_query_string_param(event, 'start_key')
     if start_key is not None and len(start_key) > 0:
         start_key = json.loads(start_key)
+    else:
+        start_key = None
     wait_for_all_pages = bool(distutils.util.strtobool(handler_request.get_query_string_param(event, 'wait_for_all_pages', 'false')))
     use_consistent_read = bool(distutils.util.strtobool(handler_request.get_query_string_param(event, 'use_consistent_read', 'false')))
     limit = handler_request.get_query_string_param(event, 'limit', '100')
@@ -40,13 +84,21 @@ def lambda_handler(event, context):
     if response_limit > 100 or response_limit <= 0:
         response_limit = 100
 
+    segment = _get_segment_param(event, 'segment')
+    total_segments = _get_segment_param(event, 'total_segments')
+    if (segment is None) != (total_segments is None):
+        return handler_response.invalid_request()
+    if total_segments is not None and not (0 < total_segments <= MAX_TOTAL_SEGMENTS and 0 <= segment < total_segments):
+        return handler_response.invalid_request()
+
     try:
-        all_achievements = []
-        achievements, next_start_key = _get_achievements(response_limit, use_consistent_read, start_key)
-        all_achievements.extend(achievements)
-        while wait_for_all_pages and next_start_key:
-            achievements, next_start_key = _get_achievements(response_limit, use_consistent_read, next_start_key)
-            all_achievements.extend(achievements)
+        next_start_key = None
+        if wait_for_all_pages and total_segments is None and start_key is None and SCAN_SEGMENTS > 1:
+            all_achievements = _get_all_achievements_in_parallel(response_limit, use_consistent_read, SCAN_SEGMENTS)
+        elif wait_for_all_pages:
+            all_achievements = _get_all_achievements(response_limit, use_consistent_read, start_key, segment, total_segments)
+        else:
+            all_achievements, next_start_key = _get_achievements(response_limit, use_consistent_read, start_key, segment, total_segments)
 
     except botocore.exceptions.ClientError as err:
         print(f"Error retrieving items. Error: {err}")
@@ -0,0 +1,108 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Purpose
+
+Adds up the sharded earned counters of the achievements, written by UpdateAchievements, into one summary of how many
+players earned each achievement, and publishes it as stats/achievement_stats.json in the achievements bucket.
+The summary is served by the achievement icons CloudFront distribution and cached for STATS_CACHE_SECONDS, so reading it
+costs the backend nothing per player.
+
+The percentages are relative to the players who earned at least one achievement, from the item count of the
+player_achievements_summary table, which DynamoDB updates about every six hours.
+Hidden achievements are left out, like GetAchievements does.
+
+This is a non-player facing Lambda function, run on a schedule.
+"""
+
+import json
+import os
+
+import boto3
+import botocore
+from gamekithelpers import ddb
+
+STATS_OBJECT_KEY = 'stats/achievement_stats.json'
+
+s3_client = boto3.client('s3')
+ddb_client = boto3.client('dynamodb')
+ddb_game_table = ddb.get_table(os.environ.get('ACHIEVEMENTS_TABLE_NAME'))
+ddb_stats_table = ddb.get_table(os.environ.get('STATS_SHARDS_TABLE_NAME'))
+player_achievements_summary_table_name = os.environ.get('PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME')
+achievements_bucket_name = os.environ.get('ACHIEVEMENTS_BUCKET_NAME')
+stats_cache_seconds = int(os.environ.get('STATS_CACHE_SECONDS', '900'))
+
+
+def _scan_all(table, filter=None):
+    items = []
+    start_key = None
+    while True:
+        response = table.scan(**ddb.scan_request_param(100, False, start_key, filter))
+        page, start_key = ddb.get_response_items(response)
+        items.extend(page)
+        if not start_key:
+            return items
+
+
+def _get_earned_counts():
+    """
+    Returns the earned count of each achievement, summed over its shards
+    """
+    earned_counts = {}
+    for shard in _scan_all(ddb_stats_table):
+        achievement_id = shard['achievement_id']
+        earned_counts[achievement_id] = earned_counts.get(achievement_id, 0) + int(shard.get('earned_count', 0))
+    return earned_counts
+
+
+def _get_visible_achievement_ids():
+    return [achievement['achievement_id'] for achievement in _scan_all(ddb_game_table)
+            if not achievement.get('is_hidden', False)]
+
+
+def _get_player_count():
+    response = ddb_client.describe_table(TableName=player_achievements_summary_table_name)
+    return int(response['Table'].get('ItemCount', 0))
+
+
+def build_stats(earned_counts, achievement_ids, player_count, updated_at):
+    """
+    Builds the published summary. The player count is at least the largest earned count, since the item count of the
+    summary table lags behind the players who just earned their first achievement.
+    """
+    stats = {achievement_id: earned_counts.get(achievement_id, 0) for achievement_id in achievement_ids}
+    player_count = max([player_count] + list(stats.values()))
+    return {
+        'updated_at': updated_at,
+        'player_count': player_count,
+        'achievements': [
+            {
+                'achievement_id': achievement_id,
+                'earned_count': earned_count,
+                'earned_percent': round(100.0 * earned_count / player_count, 2) if player_count > 0 else 0.0
+            }
+            for achievement_id, earned_count in sorted(stats.items())
+        ]
+    }
+
+
+def lambda_handler(event, context):
+    """
+    This is the lambda function handler.
+    """
+    try:
+        stats = build_stats(_get_earned_counts(), _get_visible_achievement_ids(), _get_player_count(), ddb.timestamp())
+    except botocore.exceptions.ClientError as err:
+        print(f"Error aggregating the achievement stats. Error: {err}")
+        raise err
+
+    s3_client.put_object(
+        Bucket=achievements_bucket_name,
+        Key=STATS_OBJECT_KEY,
+        Body=json.dumps(stats).encode('utf-8'),
+        ContentType='application/json',
+        CacheControl=f'public, max-age={stats_cache_seconds}')
+
+    print(f"Published the stats of {len(stats['achievements'])} achievements and {stats['player_count']} players")
+    return {'achievements': len(stats['achievements']), 'player_count': stats['player_count']}
@@ -0,0 +1,98 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Purpose
+
+Sets the "visible" key of the gidx_visible_order_number index on the visible achievements which were written before the
+index existed, so that GetAchievements lists them once AdminAddAchievements writes the first keyed achievement.
+
+This is a non-player facing Lambda function, paired with a custom CloudFormation resource which runs it on every
+deployment of the stack.
+"""
+
+import logging
+
+import boto3
+from boto3.dynamodb.conditions import Attr
+from botocore.exceptions import ClientError
+from gamekitresourcemanagement.cfn_custom_resource import RequestType, send_success_response, send_failure_response
+
+CUSTOM_RESOURCE_TYPE = 'backfill-visible-achievements'
+
+VISIBLE_ACHIEVEMENTS_KEY = 'visible'
+VISIBLE_ACHIEVEMENTS_KEY_VALUE = 'true'
+
+ddb_resource = boto3.resource('dynamodb')
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+
+def _backfill(table) -> int:
+    """
+    Sets the index key on every visible achievement without it, and returns how many were updated.
+    """
+    updated = 0
+    request = {
+        'FilterExpression': Attr(VISIBLE_ACHIEVEMENTS_KEY).not_exists() & Attr('is_hidden').ne(True),
+        'ProjectionExpression': 'achievement_id'
+    }
+    while True:
+        response = table.scan(**request)
+        for item in response.get('Items', []):
+            try:
+                table.update_item(
+                    Key={'achievement_id': item['achievement_id']},
+                    UpdateExpression='SET #visible = :visible',
+                    # Skips achievements deleted or hidden by an admin since the scan
+                    ConditionExpression='attribute_exists(achievement_id) AND (attribute_not_exists(is_hidden) OR is_hidden = :false)',
+                    ExpressionAttributeNames={'#visible': VISIBLE_ACHIEVEMENTS_KEY},
+                    ExpressionAttributeValues={':visible': VISIBLE_ACHIEVEMENTS_KEY_VALUE, ':false': False})
+                updated += 1
+            except ClientError as e:
+                if e.response['Error']['Code'] != 'ConditionalCheckFailedException':
+                    raise
+        if not response.get('LastEvaluatedKey'):
+            return updated
+        request['ExclusiveStartKey'] = response['LastEvaluatedKey']
+
+
+def lambda_handler(event, context):
+    """
+    Backfills the index key of the achievements table during CloudFormation stack creation and updates.
+
+    Achievements added before the gidx_visible_order_number index don't have its key. GetAchievements reads the catalog
+    from the index, and only scans the table while the index is empty, so these achievements would stop being listed
+    after the first admin add. Nothing happens during stack deletion. Running it again is harmless: achievements which
+    already have the key are left as they are.
+
+    Parameters:
+        event:
+            The custom resource lambda request. CloudFormation provides most parameters. See the full request here:
+            https://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/crpg-ref-requests.html#crpg-ref-request-fields.
+
+            ResourceProperties:
+                table_name: str
+                    The name of the achievements table.
+        context:
+            The lambda context.
+    """
+    logger.info(event)
+    request_type: str = event['RequestType']
+    table_name: str = event['ResourceProperties']['table_name']
+
+    if request_type == RequestType.DELETE:
+        logger.info(f'Ignoring {request_type} request for table {table_name}')
+        send_success_response(event, CUSTOM_RESOURCE_TYPE)
+        return
+
+    try:
+        updated = _backfill(ddb_resource.Table(table_name))
+    except ClientError as e:
+        reason = f'{e.response["Error"]["Code"]} - {e.response["Error"]["Message"]}'
+        logger.error(f'Failed to backfill the visible achievements of table {table_name}: {reason}')
+        send_failure_response(event, CUSTOM_RESOURCE_TYPE, reason)
+        return
+
+    logger.info(f'Backfilled the index key of {updated} visible achievements in table {table_name}')
+    send_success_response(event, CUSTOM_RESOURCE_TYPE)
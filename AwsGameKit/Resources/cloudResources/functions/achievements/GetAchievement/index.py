@@ -16,13 +16,14 @@ import os
 
 ddb_player_table = ddb.get_table(os.environ['PLAYER_ACHIEVEMENTS_TABLE_NAME'])
 ddb_game_table = ddb.get_table(os.environ['ACHIEVEMENTS_TABLE_NAME'])
+player_read_cache = ddb.get_read_cache()
+game_read_cache = ddb.get_read_cache()
 
 
 def _get_player_achievement(player_id, achievement_id, use_consistent_read):
     try:
-        response = ddb_player_table.get_item(
-            **ddb.get_item_request_param({'player_id': player_id, 'achievement_id': achievement_id},
-                                         use_consistent_read))
+        request = ddb.get_item_request_param({'player_id': player_id, 'achievement_id': achievement_id}, use_consistent_read)
+        response = player_read_cache.read(request, lambda: ddb_player_table.get_item(**request))
         player_achievement = ddb.get_response_item(response)
     except botocore.exceptions.ClientError as err:
         print(f"Error retrieving achievement_id: {achievement_id} for player_id: {player_id}. Error: {err}")
@@ -39,7 +40,8 @@ def _get_player_achievement(player_id, achievement_id, use_consistent_read):
 
 
 def _get_achievement(player_id, achievement_id, use_consistent_read):
-    response = ddb_game_table.get_item(**ddb.get_item_request_param({'achievement_id': achievement_id}, use_consistent_read))
+    request = ddb.get_item_request_param({'achievement_id': achievement_id}, use_consistent_read)
+    response = game_read_cache.read(request, lambda: ddb_game_table.get_item(**request))
     achievement = ddb.get_response_item(response)
 
     if achievement is not None and achievement['is_hidden']:
@@ -0,0 +1,175 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Purpose
+
+Retrieves how many achievements a player earned and how many points they are worth, along with the number of
+achievements and points there are in total. Lets the game show a player's completion without listing every achievement.
+
+This is a player facing Lambda function and used in-game.
+"""
+
+import botocore
+import distutils.core
+import os
+import time
+
+from boto3.dynamodb.conditions import Key
+from gamekithelpers import handler_request, handler_response, ddb
+
+ddb_game_table = ddb.get_table(os.environ['ACHIEVEMENTS_TABLE_NAME'])
+ddb_player_table = ddb.get_table(os.environ['PLAYER_ACHIEVEMENTS_TABLE_NAME'])
+ddb_summary_table = ddb.get_table(os.environ['PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME'])
+
+# Sparse index of the achievements which aren't hidden. AdminAddAchievements keeps the key up to date.
+VISIBLE_ACHIEVEMENTS_INDEX_NAME = 'gidx_visible_order_number'
+VISIBLE_ACHIEVEMENTS_KEY = 'visible'
+VISIBLE_ACHIEVEMENTS_KEY_VALUE = 'true'
+
+# Points of the visible achievements by achievement_id, kept in memory like the catalog of GetAchievements
+catalog_cache_seconds = float(os.environ.get('ACHIEVEMENTS_CATALOG_CACHE_SECONDS', '30'))
+_catalog_points = None
+_catalog_expires_at = 0.0
+
+
+def _project_achievement_points(request):
+    request['Select'] = 'SPECIFIC_ATTRIBUTES'
+    request['ProjectionExpression'] = '#achievement_id, #points'
+    request['ExpressionAttributeNames'] = {'#achievement_id': 'achievement_id', '#points': 'points'}
+    return request
+
+
+def _load_catalog_points():
+    """
+    Read the points of all the visible achievements from the sparse index.
+    Tables whose achievements were added before the index existed don't have the index key yet, so they are scanned instead.
+    """
+    achievements = []
+    start_key = None
+    while True:
+        response = ddb_game_table.query(**_project_achievement_points(
+            ddb.query_request_param(VISIBLE_ACHIEVEMENTS_KEY,
+                                    VISIBLE_ACHIEVEMENTS_KEY_VALUE,
+                                    VISIBLE_ACHIEVEMENTS_INDEX_NAME,
+                                    start_key=start_key)))
+        items, start_key = ddb.get_response_items(response)
+        achievements.extend(items)
+        if not start_key:
+            break
+
+    if len(achievements) == 0:
+        start_key = None
+        while True:
+            response = ddb_game_table.scan(**_project_achievement_points(
+                ddb.scan_request_param(100, False, start_key, Key('is_hidden').eq(False))))
+            items, start_key = ddb.get_response_items(response)
+            achievements.extend(items)
+            if not start_key:
+                break
+
+    return {achievement['achievement_id']: int(achievement.get('points') or 0) for achievement in achievements}
+
+
+def _get_catalog_points():
+    """
+    Returns the points of the visible achievements by achievement_id, from memory while they're fresh.
+    """
+    global _catalog_points, _catalog_expires_at
+    now = time.monotonic()
+    if _catalog_points is None or now >= _catalog_expires_at:
+        _catalog_points = _load_catalog_points()
+        _catalog_expires_at = now + catalog_cache_seconds
+    return _catalog_points
+
+
+def _get_earned_achievement_ids(player_id):
+    earned_achievement_ids = []
+    start_key = None
+    while True:
+        request = ddb.query_request_param('player_id', player_id, use_consistent_read=True, start_key=start_key)
+        request['Select'] = 'SPECIFIC_ATTRIBUTES'
+        request['ProjectionExpression'] = '#achievement_id, #earned'
+        request['ExpressionAttributeNames'] = {'#achievement_id': 'achievement_id', '#earned': 'earned'}
+        items, start_key = ddb.get_response_items(ddb_player_table.query(**request))
+        earned_achievement_ids.extend(item['achievement_id'] for item in items if item.get('earned'))
+        if not start_key:
+            break
+    return earned_achievement_ids
+
+
+def _backfill_summary(player_id, summary):
+    """
+    Count the achievements the player earned before UpdateAchievements kept their summary, and store the result.
+
+    The stored summary is only replaced if no achievement was earned in the meantime, otherwise it's counted again on a
+    later call. Achievements which are hidden now are counted without points.
+    """
+    catalog_points = _get_catalog_points()
+    earned_achievement_ids = _get_earned_achievement_ids(player_id)
+    now = ddb.timestamp()
+    backfilled = {
+        'player_id': player_id,
+        'earned_count': len(earned_achievement_ids),
+        'earned_points': sum(catalog_points.get(achievement_id, 0) for achievement_id in earned_achievement_ids),
+        'is_backfilled': True,
+        'created_at': summary.get('created_at', now) if summary else now,
+        'updated_at': now
+    }
+
+    request = {'Item': backfilled}
+    if summary is None:
+        request['ConditionExpression'] = 'attribute_not_exists(player_id)'
+    else:
+        request['ConditionExpression'] = 'earned_count = :earned_count and attribute_not_exists(is_backfilled)'
+        request['ExpressionAttributeValues'] = {':earned_count': summary.get('earned_count', 0)}
+
+    try:
+        ddb_summary_table.put_item(**request)
+    except botocore.exceptions.ClientError as err:
+        if err.response['Error']['Code'] != 'ConditionalCheckFailedException':
+            print(f"Error storing the achievement summary of player_id: {player_id}. Error: {err}")
+            raise err
+
+    return backfilled
+
+
+def _get_summary(player_id, use_consistent_read):
+    response = ddb_summary_table.get_item(**ddb.get_item_request_param({'player_id': player_id}, use_consistent_read))
+    summary = ddb.get_response_item(response)
+    if summary is None or not summary.get('is_backfilled'):
+        summary = _backfill_summary(player_id, summary)
+
+    catalog_points = _get_catalog_points()
+    return {
+        'earned_count': int(summary.get('earned_count', 0)),
+        'earned_points': int(summary.get('earned_points', 0)),
+        'total_count': len(catalog_points),
+        'total_points': sum(catalog_points.values())
+    }
+
+
+def lambda_handler(event, context):
+    """
+    This is the lambda function handler.
+
+    Returns earned_count and earned_points, the number of achievements the player earned and their points as of when they
+    were earned, and total_count and total_points, the number of achievements which aren't hidden and their points.
+    Secret achievements are included in the totals.
+    """
+    handler_request.log_event(event)
+
+    # Get player_id from requestContext
+    player_id = handler_request.get_player_id(event)
+    if player_id is None:
+        return handler_response.response_envelope(401)
+
+    use_consistent_read = bool(distutils.util.strtobool(handler_request.get_query_string_param(event, 'use_consistent_read', 'false')))
+
+    try:
+        summary = _get_summary(player_id, use_consistent_read)
+    except botocore.exceptions.ClientError as err:
+        print(f"Error retrieving items. Error: {err}")
+        raise err
+
+    return handler_response.response_envelope(200, None, summary)
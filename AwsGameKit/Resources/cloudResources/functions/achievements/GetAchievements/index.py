@@ -6,63 +6,244 @@ Purpose
 
 Retrieves all player achievements, earned and unearned.
 
+With the updated_since query string parameter (an ISO 8601 timestamp, such as the as_of value of the previous response),
+only the achievements whose definition or player progress changed after it are returned, all in one response. The
+response's total_count is the number of visible achievements, so that clients can tell when achievements were removed.
+
 This is a player facing Lambda function and used in-game.
 """
 
+import bisect
 import botocore
 import distutils.core
 import json
 import os
+import random
+import time
+from datetime import datetime, timezone
 
-from boto3.dynamodb.conditions import Key
+from boto3.dynamodb.conditions import Attr, Key
 from gamekithelpers import handler_request, handler_response, ddb
 from gamekithelpers.pagination import validate_pagination_token
 
-ddb_player_table = ddb.get_table(os.environ['PLAYER_ACHIEVEMENTS_TABLE_NAME'])
+# Use base Dynamo resource in order to batch read the player achievements
+ddb_resource = ddb.get_dynamodb_resource()
 ddb_game_table = ddb.get_table(os.environ['ACHIEVEMENTS_TABLE_NAME'])
+player_achievements_table_name = os.environ['PLAYER_ACHIEVEMENTS_TABLE_NAME']
 
+# BatchGetItem accepts at most 100 keys per request
+BATCH_GET_MAX_KEYS = 100
 
-def _get_player_achievement(player_id, achievement_id, use_consistent_read):
-    try:
-        response = ddb_player_table.get_item(**ddb.get_item_request_param(
-            {'player_id': player_id, 'achievement_id': achievement_id}, use_consistent_read))
-        player_achievement = ddb.get_response_item(response)
-    except botocore.exceptions.ClientError as err:
-        print(f"Error retrieving achievement_id: {achievement_id} for player_id: {player_id}. Error: {err}")
-        raise err
+# Unprocessed keys are read again with full jitter backoff, for at most MAX_READ_ATTEMPTS attempts
+MAX_READ_ATTEMPTS = 5
+RETRY_BASE_DELAY_SECONDS = 0.05
+RETRY_MAX_DELAY_SECONDS = 1.0
 
-    if player_achievement is None:
-        player_achievement = {
-            'current_value': 0,
-            'earned': False,
-            'earned_at': None
-        }
+# Sparse index of the achievements which aren't hidden, ordered by order_number. AdminAddAchievements keeps the key up to date.
+VISIBLE_ACHIEVEMENTS_INDEX_NAME = 'gidx_visible_order_number'
+VISIBLE_ACHIEVEMENTS_KEY = 'visible'
+VISIBLE_ACHIEVEMENTS_KEY_VALUE = 'true'
 
-    return player_achievement
+# The achievement definitions only change when an admin adds or deletes achievements,
+# so the visible catalog is kept in memory by each execution environment for this long
+catalog_cache_seconds = float(os.environ.get('ACHIEVEMENTS_CATALOG_CACHE_SECONDS', '30'))
+_catalog = None
+_catalog_sort_keys = None
+_catalog_expires_at = 0.0
 
 
-def _get_achievements(player_id, response_limit, use_consistent_read, start_key):
-    response = ddb_game_table.scan(**ddb.scan_request_param(response_limit,
-                                                            use_consistent_read,
-                                                            start_key,
-                                                            Key('is_hidden').eq(False)))
+def _catalog_sort_key(achievement):
+    return int(achievement.get('order_number') or 0), achievement['achievement_id']
+
+
+def _load_visible_achievements():
+    """
+    Read all the visible achievements from the sparse index, sorted by order_number.
+    Tables whose achievements were added before the index existed are scanned instead until the BackfillVisibleAchievements
+    custom resource of the stack sets the index key on them.
+    """
+    achievements = []
+    start_key = None
+    while True:
+        response = ddb_game_table.query(**ddb.query_request_param(VISIBLE_ACHIEVEMENTS_KEY,
+                                                                  VISIBLE_ACHIEVEMENTS_KEY_VALUE,
+                                                                  VISIBLE_ACHIEVEMENTS_INDEX_NAME,
+                                                                  start_key=start_key))
+        items, start_key = ddb.get_response_items(response)
+        achievements.extend(items)
+        if not start_key:
+            break
+
+    if len(achievements) == 0:
+        start_key = None
+        while True:
+            response = ddb_game_table.scan(**ddb.scan_request_param(100, False, start_key, Key('is_hidden').eq(False)))
+            items, start_key = ddb.get_response_items(response)
+            achievements.extend(items)
+            if not start_key:
+                break
 
-    achievements, next_start_key = ddb.get_response_items(response)
     for achievement in achievements:
-        # get player achievement
-        player_achievement = _get_player_achievement(player_id,
-                                                     achievement['achievement_id'],
-                                                     use_consistent_read)
+        achievement.pop(VISIBLE_ACHIEVEMENTS_KEY, None)
+    achievements.sort(key=_catalog_sort_key)
+    return achievements
+
+
+def _get_visible_achievements():
+    """
+    Returns the visible achievements sorted by order_number, from the in-memory catalog while it's fresh.
+    """
+    global _catalog, _catalog_sort_keys, _catalog_expires_at
+    now = time.monotonic()
+    if _catalog is None or now >= _catalog_expires_at:
+        _catalog = _load_visible_achievements()
+        _catalog_sort_keys = [_catalog_sort_key(achievement) for achievement in _catalog]
+        _catalog_expires_at = now + catalog_cache_seconds
+    return _catalog, _catalog_sort_keys
+
+
+def _get_catalog_page(response_limit, start_key):
+    """
+    Returns a page of the visible achievements after start_key, and the start key of the next page.
+    """
+    catalog, sort_keys = _get_visible_achievements()
+
+    first = 0
+    if start_key:
+        if start_key.get('order_number') is not None:
+            first = bisect.bisect_right(sort_keys, (int(start_key['order_number']), start_key.get('achievement_id', '')))
+        else:
+            # start key of a page served before the catalog was ordered
+            first = next((i + 1 for i, key in enumerate(sort_keys) if key[1] == start_key.get('achievement_id')), 0)
+
+    page = [dict(achievement) for achievement in catalog[first:first + response_limit]]
+    next_start_key = None
+    if first + response_limit < len(catalog):
+        order_number, achievement_id = sort_keys[first + response_limit - 1]
+        next_start_key = {'achievement_id': achievement_id, 'order_number': order_number}
+    return page, next_start_key
+
+
+def _get_player_achievements(player_id, achievement_ids, use_consistent_read):
+    """
+    Fetch the player's progress for the given achievements with BatchGetItem, in chunks of 100 keys.
+    Returns a dictionary keyed by achievement_id; achievements the player hasn't progressed on are absent.
+    """
+    player_achievements = {}
+    for chunk_start in range(0, len(achievement_ids), BATCH_GET_MAX_KEYS):
+        request_items = {
+            player_achievements_table_name: {
+                'Keys': [{'player_id': player_id, 'achievement_id': achievement_id}
+                         for achievement_id in achievement_ids[chunk_start:chunk_start + BATCH_GET_MAX_KEYS]],
+                'ConsistentRead': use_consistent_read
+            }
+        }
+        for attempt in range(MAX_READ_ATTEMPTS):
+            try:
+                response = ddb_resource.batch_get_item(RequestItems=request_items)
+            except botocore.exceptions.ClientError as err:
+                print(f"Error retrieving achievements for player_id: {player_id}. Error: {err}")
+                raise err
+
+            for player_achievement in response.get('Responses', {}).get(player_achievements_table_name, []):
+                player_achievements[player_achievement['achievement_id']] = player_achievement
+            request_items = response.get('UnprocessedKeys')
+            if not request_items:
+                break
+            if attempt + 1 == MAX_READ_ATTEMPTS:
+                raise RuntimeError(f"Player achievements of player_id: {player_id} unprocessed after {MAX_READ_ATTEMPTS} attempts")
 
-        # merge results; the timestamp attributes will be from the player's achievement
-        achievement.update(player_achievement)
+            delay = random.uniform(0, min(RETRY_MAX_DELAY_SECONDS, RETRY_BASE_DELAY_SECONDS * 2 ** attempt))
+            print(f"Player achievement keys unprocessed, retrying in {delay:.3f} seconds")
+            time.sleep(delay)
+
+    return player_achievements
+
+
+def _merge_player_achievements(achievements, player_achievements):
+    for achievement in achievements:
+        player_achievement = player_achievements.get(achievement['achievement_id'])
+        # kept apart, so that clients filtering on updated_at also see the definitions which changed
+        achievement['definition_updated_at'] = achievement.get('updated_at')
+        if player_achievement is not None:
+            # merge results; the timestamp attributes will be from the player's achievement
+            achievement.update(player_achievement)
         achievement.setdefault('current_value', 0)
         achievement.setdefault('earned', False)
         achievement.setdefault('earned_at', None)
 
+
+def _get_achievements(player_id, response_limit, use_consistent_read, start_key):
+    achievements, next_start_key = _get_catalog_page(response_limit, start_key)
+
+    # get the player achievements of the whole page at once
+    player_achievements = _get_player_achievements(player_id,
+                                                   [achievement['achievement_id'] for achievement in achievements],
+                                                   use_consistent_read)
+    _merge_player_achievements(achievements, player_achievements)
     return achievements, next_start_key
 
 
+def _parse_updated_since(updated_since):
+    """
+    Returns the updated_since parameter in the format of the updated_at attributes, or None if it isn't a valid timestamp
+    """
+    try:
+        parsed = datetime.fromisoformat(updated_since.replace('Z', '+00:00'))
+    except ValueError:
+        return None
+    if parsed.tzinfo is None:
+        parsed = parsed.replace(tzinfo=timezone.utc)
+    return parsed.astimezone(timezone.utc).isoformat()
+
+
+def _get_player_achievements_updated_since(player_id, updated_since, use_consistent_read):
+    """
+    Fetch the player's achievements updated after updated_since, with a Query of the player's partition.
+    Returns a dictionary keyed by achievement_id.
+    """
+    player_table = ddb_resource.Table(player_achievements_table_name)
+    request = {
+        'KeyConditionExpression': Key('player_id').eq(player_id),
+        'FilterExpression': Attr('updated_at').gt(updated_since),
+        'ConsistentRead': use_consistent_read
+    }
+    player_achievements = {}
+    while True:
+        try:
+            response = player_table.query(**request)
+        except botocore.exceptions.ClientError as err:
+            print(f"Error retrieving updated achievements for player_id: {player_id}. Error: {err}")
+            raise err
+
+        for player_achievement in response.get('Items', []):
+            player_achievements[player_achievement['achievement_id']] = player_achievement
+        if not response.get('LastEvaluatedKey'):
+            return player_achievements
+        request['ExclusiveStartKey'] = response['LastEvaluatedKey']
+
+
+def _get_achievements_updated_since(player_id, updated_since, use_consistent_read):
+    """
+    Returns the visible achievements whose definition or player progress changed after updated_since, in catalog order,
+    and the number of visible achievements.
+    """
+    catalog, _ = _get_visible_achievements()
+    player_achievements = _get_player_achievements_updated_since(player_id, updated_since, use_consistent_read)
+
+    achievements = [dict(achievement) for achievement in catalog
+                    if achievement['achievement_id'] in player_achievements or achievement.get('updated_at', '') > updated_since]
+
+    # achievements whose definition changed still need the player's progress
+    unchanged_progress = [achievement['achievement_id'] for achievement in achievements
+                          if achievement['achievement_id'] not in player_achievements]
+    if unchanged_progress:
+        player_achievements.update(_get_player_achievements(player_id, unchanged_progress, use_consistent_read))
+
+    _merge_player_achievements(achievements, player_achievements)
+    return achievements, len(catalog)
+
+
 def lambda_handler(event, context):
     """
     This is the lambda function handler.
@@ -90,6 +271,24 @@ def lambda_handler(event, context):
     if response_limit > 100 or response_limit <= 0:
         response_limit = 100
 
+    updated_since = handler_request.get_query_string_param(event, 'updated_since')
+    if updated_since:
+        updated_since = _parse_updated_since(updated_since)
+        if updated_since is None:
+            return handler_response.invalid_request()
+
+        # taken before reading, so that the changes made while reading are returned again by the next call
+        as_of = ddb.timestamp()
+        try:
+            achievements, total_count = _get_achievements_updated_since(player_id, updated_since, use_consistent_read)
+        except botocore.exceptions.ClientError as err:
+            print(f"Error retrieving items. Error: {err}")
+            raise err
+
+        return handler_response.response_envelope(200, None, {'achievements': achievements,
+                                                               'total_count': total_count,
+                                                               'as_of': as_of}, None, player_id, event)
+
     try:
         all_achievements = []
         achievements, next_start_key = _get_achievements(player_id,
@@ -108,4 +307,4 @@ def lambda_handler(event, context):
         print(f"Error retrieving items. Error: {err}")
         raise err
 
-    return handler_response.response_envelope(200, None, {'achievements': all_achievements}, next_start_key, player_id)
+    return handler_response.response_envelope(200, None, {'achievements': all_achievements}, next_start_key, player_id, event)
@@ -8,6 +8,14 @@ Resizes a PNG according to the defined dimensions os.environ['RESIZE_WIDTH'], os
 
 This Lambda Function is configured in AchievementsBucket to execute on s3:ObjectCreated:Put for the uploads/ prefix.
 The resized images are moved to the os.environ['DESTINATION_PREFIX'] prefix.
+
+A square variant is also written for each size in os.environ['ICON_SIZES'] (comma separated, for example "64,128,256"),
+with the size appended to the file name: icons/trophy.png -> icons/trophy_64.png. Clients showing small thumbnails can
+request a variant instead of the full icon.
+
+The icons are served by the AchievementsIconsDistribution CloudFront distribution. They are written with a Cache-Control max-age
+of os.environ['ICON_CACHE_SECONDS'] so CloudFront and the clients keep them that long. The editor uploads a changed icon under a
+new key, and AdminAddAchievements deletes the previous one, so an icon's key never points to different images.
 """
 
 import boto3
@@ -27,6 +35,37 @@ def _get_bucket_and_key_from_event(event_record):
     return bucket, key
 
 
+def _get_icon_sizes():
+    sizes = os.environ.get('ICON_SIZES', '')
+    return [int(size) for size in sizes.split(',') if size.strip()]
+
+
+def _get_variant_key(resized_key, size):
+    stem, extension = os.path.splitext(resized_key)
+    return f"{stem}_{size}{extension}"
+
+
+def _get_cache_control():
+    cache_seconds = int(os.environ.get('ICON_CACHE_SECONDS', '0'))
+    return f"public, max-age={cache_seconds}" if cache_seconds > 0 else None
+
+
+def _put_image(bucket, key, img, image_format, content_type, aws_account_id):
+    image_data = BytesIO()
+    # optimize makes the encoder search for the smallest PNG (or JPEG) encoding of the same pixels
+    img.save(image_data, image_format, optimize=True)
+    image_data.seek(0)
+    put_args = {
+        'Body': image_data,
+        'ContentType': content_type,
+        'ExpectedBucketOwner': aws_account_id
+    }
+    cache_control = _get_cache_control()
+    if cache_control is not None:
+        put_args['CacheControl'] = cache_control
+    s3_resource.Object(bucket, key).put(**put_args)
+
+
 def lambda_handler(event, context):
     """
     This is the lambda function handler.
@@ -44,19 +83,18 @@ def lambda_handler(event, context):
 
             # Resize image
             img = Image.open(BytesIO(source_data))
-            resized_img = img.resize((int(os.environ['RESIZE_WIDTH']), int(os.environ['RESIZE_HEIGHT'])))
+            image_format = img.format
+            content_type = img.get_format_mimetype()
+            resized_img = img.resize((int(os.environ['RESIZE_WIDTH']), int(os.environ['RESIZE_HEIGHT'])), Image.LANCZOS)
 
             # Save resized data to a new key
-            resized_data = BytesIO()
-            resized_img.save(resized_data, img.format)
             resized_key = f"{os.environ['DESTINATION_PREFIX']}/{key.split('/')[-1]}"
-            s3_resized_obj = s3_resource.Object(bucket, resized_key)
-            resized_data.seek(0)
-            resp = s3_resized_obj.put(
-                Body=resized_data,
-                ContentType=img.get_format_mimetype(),
-                ExpectedBucketOwner=aws_account_id
-            )
+            _put_image(bucket, resized_key, resized_img, image_format, content_type, aws_account_id)
+
+            # Save the fixed size variants
+            for size in _get_icon_sizes():
+                variant_img = img.resize((size, size), Image.LANCZOS)
+                _put_image(bucket, _get_variant_key(resized_key, size), variant_img, image_format, content_type, aws_account_id)
 
             # Delete source object
             s3_source_obj.delete(ExpectedBucketOwner=aws_account_id)
@@ -4,22 +4,63 @@
 """
 Purpose
 
-Increments the current_value field for the given player_id and achievement_id in the player_achievements table.
-If current_value == max_value defined in game_achievements, the earned column is set to true.
+Increments the current_value field for the given player_id and achievement_id in the player_achievements table, with a
+single conditional UpdateItem which returns the new item.
+If current_value == max_value defined in game_achievements, the earned column is set to true, and the achievement and its
+points are added to the player's totals in the player_achievements_summary table in the same transaction.
+The player achievement is only read when the increment was skipped because the player already had max_value.
+
+POST /achievements/unlock updates several achievements in one call, with a body of
+{"achievements": [{"achievement_id": ..., "increment_by": ...}, ...]}. The achievements are updated in parallel, each like a
+single update, and returned together; unknown and hidden achievement ids are returned in "not_found", and the ids whose
+update failed in "failed". A batch in which every update failed is an error.
+
+When STATS_SHARDS_TABLE_NAME is set, each unlock also adds one to a global earned counter of the achievement. The counter is
+split over STATS_SHARD_COUNT items picked at random, so that thousands of players earning the same achievement at once don't
+all write one DynamoDB partition; AggregateAchievementStats adds the shards up on a schedule.
+
+A call with an Idempotency-Key header is applied once: the retries of the call with the same key get the response of the
+first one, see gamekithelpers.idempotency.
 
 This is a player facing Lambda function and used in-game.
 """
 
 import os
+import random
+import time
+from concurrent.futures import ThreadPoolExecutor
 
 import boto3
 import botocore
-from gamekithelpers import handler_request, handler_response, ddb
+from boto3.dynamodb.types import TypeSerializer
+from gamekithelpers import handler_request, handler_response, ddb, idempotency, throttle
 
 ddb_client = boto3.client('dynamodb')
 
+player_achievements_table_name = os.environ.get('PLAYER_ACHIEVEMENTS_TABLE_NAME')
+player_achievements_summary_table_name = os.environ.get('PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME')
 ddb_game_table = ddb.get_table(os.environ.get('ACHIEVEMENTS_TABLE_NAME'))
-ddb_player_table = ddb.get_table(os.environ.get('PLAYER_ACHIEVEMENTS_TABLE_NAME'))
+ddb_player_table = ddb.get_table(player_achievements_table_name)
+game_read_cache = ddb.get_read_cache()
+player_rate_limiter = throttle.get_player_rate_limiter()
+idempotency_store = idempotency.get_idempotency_store()
+stats_shards_table_name = os.environ.get('STATS_SHARDS_TABLE_NAME')
+ddb_stats_table = ddb.get_table(stats_shards_table_name) if stats_shards_table_name else None
+stats_shard_count = int(os.environ.get('STATS_SHARD_COUNT', '10'))
+
+# Concurrent unlocks of the same player conflict on the player's summary item, and are attempted again after a random delay
+MAX_UNLOCK_ATTEMPTS = 3
+UNLOCK_RETRY_BASE_DELAY_SECONDS = 0.02
+UNLOCK_RETRY_MAX_DELAY_SECONDS = 0.2
+
+# Resource of the batch update, and the most achievements it updates in one call
+BATCH_RESOURCE = '/achievements/unlock'
+MAX_BATCH_SIZE = 25
+
+# Maximum number of achievements of a batch updated at the same time
+MAX_PARALLEL_UPDATES = 10
+
+_serializer = TypeSerializer()
 
 
 def _update_current_value_request(player_id, achievement_id, max_value, increment_by):
@@ -45,23 +86,21 @@ def _update_current_value_request(player_id, achievement_id, max_value, incremen
             ':increment_by': increment_by,
             ':created_at': now,
             ':updated_at': now,
-            ':zero': 0,
             ':false_value': False,
         },
         'ConditionExpression': 'attribute_not_exists(player_id) or '
                                '(attribute_exists(player_id) and current_value < :max_value)',
-        'UpdateExpression': 'SET #current_value = if_not_exists(current_value, :zero) + :increment_by, '
-                            '#earned = if_not_exists(earned, :false_value), '
+        'UpdateExpression': 'ADD #current_value :increment_by '
+                            'SET #earned = if_not_exists(earned, :false_value), '
                             '#created_at = if_not_exists(created_at, :created_at), #updated_at = :updated_at'
     }
 
 
-def _update_earned_request(player_id, achievement_id, current_value, max_value):
+def _update_earned_request(player_id, achievement_id, current_value, max_value, now):
     """
     Create the DynamoDB update_item parameter request to update earned attribute
     """
 
-    now = ddb.timestamp()
     return {
         'Key': {
             'player_id': player_id,
@@ -87,9 +126,55 @@ def _update_earned_request(player_id, achievement_id, current_value, max_value):
     }
 
 
+def _update_summary_request(player_id, points):
+    """
+    Create the DynamoDB update_item parameter request to add one earned achievement to the player's summary
+    """
+
+    now = ddb.timestamp()
+    return {
+        'Key': {
+            'player_id': player_id
+        },
+        'ExpressionAttributeNames': {
+            '#earned_count': 'earned_count',
+            '#earned_points': 'earned_points',
+            '#created_at': 'created_at',
+            '#updated_at': 'updated_at'
+        },
+        'ExpressionAttributeValues': {
+            ':one': 1,
+            ':points': points,
+            ':created_at': now,
+            ':updated_at': now
+        },
+        'UpdateExpression': 'ADD #earned_count :one, #earned_points :points '
+                            'SET #created_at = if_not_exists(#created_at, :created_at), #updated_at = :updated_at'
+    }
+
+
+def _transact_update(table_name, request):
+    """
+    Convert an update_item parameter request of a Table into an Update of a TransactWriteItems request
+    """
+
+    update = {
+        'TableName': table_name,
+        'Key': {k: _serializer.serialize(v) for k, v in request['Key'].items()},
+        'UpdateExpression': request['UpdateExpression'],
+        'ExpressionAttributeNames': request['ExpressionAttributeNames'],
+        'ExpressionAttributeValues': {k: _serializer.serialize(v) for k, v in request['ExpressionAttributeValues'].items()}
+    }
+    if 'ConditionExpression' in request:
+        update['ConditionExpression'] = request['ConditionExpression']
+    return {'Update': update}
+
+
 def _get_achievement(achievement_id):
     try:
-        response = ddb_game_table.get_item(**ddb.get_item_request_param({'achievement_id': achievement_id}))
+        # The achievement definitions rarely change, they are served from the read cache when READ_CACHE_SECONDS is set
+        request = ddb.get_item_request_param({'achievement_id': achievement_id})
+        response = game_read_cache.read(request, lambda: ddb_game_table.get_item(**request))
         achievement = ddb.get_response_item(response)
     except botocore.exceptions.ClientError as err:
         print(f"Error retrieving achievement_id: {achievement_id}. Error: {err}")
@@ -117,19 +202,57 @@ def _increment_player_achievement(player_id, achievement_id, increment_by, max_v
     return player_achievement
 
 
-def _attempt_unlock(player_id, achievement_id, current_value, max_value):
-    player_achievement = None
+def _attempt_unlock(player_id, achievement_id, current_value, max_value, points):
+    """
+    Set the player achievement as earned and add it to the player's summary, in one transaction.
+    Returns the earned_at timestamp, or None when the achievement was already earned or the player hasn't reached max_value.
+    """
+    now = ddb.timestamp()
+    request = {
+        'TransactItems': [
+            _transact_update(player_achievements_table_name,
+                             _update_earned_request(player_id, achievement_id, current_value, max_value, now)),
+            _transact_update(player_achievements_summary_table_name, _update_summary_request(player_id, points))
+        ]
+    }
+    for attempt in range(1, MAX_UNLOCK_ATTEMPTS + 1):
+        try:
+            ddb_client.transact_write_items(**request)
+            return now
+        except ddb_client.exceptions.TransactionCanceledException as err:
+            reasons = [reason.get('Code') for reason in err.response.get('CancellationReasons', [])]
+            if 'ConditionalCheckFailed' in reasons:
+                # ignore condition expression failure
+                return None
+            if 'TransactionConflict' not in reasons or attempt == MAX_UNLOCK_ATTEMPTS:
+                print(f"Error attempting to unlock player_id: {player_id}, achievement_id: {achievement_id}. Error: {err}")
+                raise err
+
+            delay = random.uniform(0, min(UNLOCK_RETRY_MAX_DELAY_SECONDS, UNLOCK_RETRY_BASE_DELAY_SECONDS * 2 ** attempt))
+            print(f"Unlock of player_id: {player_id}, achievement_id: {achievement_id} conflicted, retrying in {delay:.3f} seconds")
+            time.sleep(delay)
+        except botocore.exceptions.ClientError as err:
+            print(f"Error attempting to unlock player_id: {player_id}, achievement_id: {achievement_id}. Error: {err}")
+            raise err
+    return None
+
+
+def _record_earned(achievement_id):
+    """
+    Add one to a random shard of the achievement's global earned counter. The unlock already went through, so a failure
+    is only logged: the stats are approximate.
+    """
+    if ddb_stats_table is None:
+        return
+
     try:
-        response = ddb_player_table.update_item(**_update_earned_request(player_id, achievement_id, current_value, max_value))
-        player_achievement = ddb.get_update_response_item(response)
-        player_achievement['max_value'] = max_value
-    except ddb_client.exceptions.ConditionalCheckFailedException:
-        # ignore condition expression failure
-        pass
+        ddb_stats_table.update_item(
+            Key={'achievement_id': achievement_id, 'shard': random.randrange(stats_shard_count)},
+            UpdateExpression='ADD #earned_count :one',
+            ExpressionAttributeNames={'#earned_count': 'earned_count'},
+            ExpressionAttributeValues={':one': 1})
     except botocore.exceptions.ClientError as err:
-        print(f"Error attempting to unlock player_id: {player_id}, achievement_id: {achievement_id}. Error: {err}")
-        raise err
-    return player_achievement
+        print(f"Error recording the stats of achievement_id: {achievement_id}. Error: {err}")
 
 
 def _get_player_achievement(player_id, achievement_id, max_value):
@@ -144,6 +267,125 @@ def _get_player_achievement(player_id, achievement_id, max_value):
     return player_achievement
 
 
+def _update_achievement(player_id, achievement, increment_by):
+    """
+    Increment the player's progress on an achievement, unlock it once max_value is reached,
+    and return the achievement merged with the player achievement
+    """
+    achievement_id = achievement['achievement_id']
+    max_value = achievement['max_value']
+
+    # Increment player achievement, the new item is returned unless the player already had max_value
+    player_achievement = _increment_player_achievement(player_id, achievement_id, increment_by, max_value)
+
+    if player_achievement is None:
+        # The increment was skipped, read the player achievement; it's usually earned already, in which case there is
+        # nothing else to write. Otherwise an earlier unlock didn't go through and is attempted again below.
+        player_achievement = _get_player_achievement(player_id, achievement_id, max_value)
+
+    current_value = min(player_achievement['current_value'], max_value)
+
+    # Attempt to unlock the achievement once the player reached max_value
+    earned_at = None
+    if current_value >= max_value and not player_achievement.get('earned', False):
+        earned_at = _attempt_unlock(player_id, achievement_id, current_value, max_value, achievement.get('points', 0))
+
+    if earned_at is not None:
+        _record_earned(achievement_id)
+
+        # The unlock wrote these values, there is no need to read them back
+        player_achievement.update({
+            'current_value': current_value,
+            'earned': True,
+            'earned_at': earned_at,
+            'updated_at': earned_at,
+            'newly_earned': True
+        })
+
+    # Merge achievement with player achievement
+    achievement.update(player_achievement)
+    return achievement
+
+
+def _get_batch_increments(body):
+    """
+    Return the (achievement_id, increment_by) pairs of a batch update body in request order, with the increments of
+    repeated achievement ids added up, or None if the body is malformed
+    """
+    updates = body.get('achievements')
+    if not isinstance(updates, list) or len(updates) == 0:
+        return None
+
+    increments = {}
+    for update in updates:
+        if not isinstance(update, dict):
+            return None
+        achievement_id = update.get('achievement_id')
+        increment_by = update.get('increment_by', 0)
+        if not isinstance(achievement_id, str) or not achievement_id or not isinstance(increment_by, int) or increment_by <= 0:
+            return None
+        increments[achievement_id] = increments.get(achievement_id, 0) + increment_by
+
+    if len(increments) > MAX_BATCH_SIZE:
+        return None
+    return list(increments.items())
+
+
+def _handle_batch_update(event, player_id):
+    body = handler_request.get_body_as_json(event)
+    if body is None:
+        return handler_response.invalid_request()
+
+    increments = _get_batch_increments(body)
+    if increments is None:
+        return handler_response.invalid_request()
+
+    # The definitions are read first, mostly from the read cache which isn't shared between threads
+    updates = []
+    not_found = []
+    for achievement_id, increment_by in increments:
+        achievement = _get_achievement(achievement_id)
+        if achievement is None or achievement.get('is_hidden', True):
+            not_found.append(achievement_id)
+        else:
+            updates.append((achievement_id, achievement, increment_by))
+
+    # The achievements are independent, update them in parallel. Table.get_item and Table.update_item only call the
+    # underlying boto3 client, which is thread safe.
+    results = []
+    if updates:
+        with ThreadPoolExecutor(max_workers=min(len(updates), MAX_PARALLEL_UPDATES)) as executor:
+            results = list(executor.map(lambda update: _try_update_achievement(player_id, *update[1:]), updates))
+
+    achievements = []
+    failed = []
+    errors = []
+    for (achievement_id, _, _), (achievement, error) in zip(updates, results):
+        if error is None:
+            achievements.append(achievement)
+        else:
+            failed.append(achievement_id)
+            errors.append(error)
+
+    if errors and not achievements:
+        # Nothing was applied, the whole call can be retried
+        raise errors[0]
+
+    # Once some of the increments were applied this response is recorded like any other, so that a retry with the same
+    # Idempotency-Key doesn't apply them again; the failed ones are sent again with a new key.
+    return handler_response.response_envelope(200, None, {'achievements': achievements, 'not_found': not_found, 'failed': failed})
+
+
+def _try_update_achievement(player_id, achievement, increment_by):
+    """
+    Update an achievement of a batch and return (achievement, None), or (None, error) if the update failed
+    """
+    try:
+        return _update_achievement(player_id, achievement, increment_by), None
+    except Exception as err:
+        return None, err
+
+
 def lambda_handler(event, context):
     """
     This is the lambda function handler.
@@ -155,6 +397,18 @@ def lambda_handler(event, context):
     if player_id is None:
         return handler_response.response_envelope(401)
 
+    # A batch counts as one call
+    retry_after = player_rate_limiter.try_acquire(player_id)
+    if retry_after > 0:
+        return handler_response.too_many_requests(retry_after)
+
+    return idempotency_store.run(event, player_id, lambda: _handle_update(event, player_id))
+
+
+def _handle_update(event, player_id):
+    if event.get('resource') == BATCH_RESOURCE:
+        return _handle_batch_update(event, player_id)
+
     # Get achievement_id from path
     achievement_id = event.get('pathParameters').get('achievement_id')
     if achievement_id is None:
@@ -174,31 +428,9 @@ def lambda_handler(event, context):
     if achievement is None:
         return handler_response.response_envelope(404)
 
-    max_value = achievement['max_value']
-
     # If the achievement is hidden, return invalid request
     is_hidden = achievement.get('is_hidden', True)
     if is_hidden:
         return handler_response.response_envelope(404)
 
-    # Increment player achievement
-    player_achievement = _increment_player_achievement(player_id, achievement_id, increment_by, max_value)
-
-    current_value = increment_by
-    if player_achievement is not None:
-        current_value = player_achievement['current_value']
-
-    current_value = min(current_value, max_value)
-
-    # Attemp to unlock achievement
-    player_achievement = _attempt_unlock(player_id, achievement_id, current_value, max_value)
-
-    if player_achievement is None:
-        # conditional updates might have failed but we need to return the player achievement object
-        player_achievement = _get_player_achievement(player_id, achievement_id, max_value)
-    else:
-        player_achievement['newly_earned'] = True
-
-    # Merge achievement with player achievement
-    achievement.update(player_achievement)
-    return handler_response.response_envelope(200, None, achievement)
+    return handler_response.response_envelope(200, None, _update_achievement(player_id, achievement, increment_by))
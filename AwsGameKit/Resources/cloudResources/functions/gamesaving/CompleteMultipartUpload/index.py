@@ -0,0 +1,140 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import botocore
+import os
+import logging
+from enum import Enum
+from typing import List, Optional
+
+from gamekithelpers import s3
+from gamekithelpers.handler_request import get_player_id, get_path_param, get_body_as_json, log_event
+from gamekithelpers.handler_response import response_envelope
+from gamekithelpers.validation import is_valid_primary_identifier
+
+# Constraints:
+MAX_PART_COUNT = 10000
+
+# S3 error codes returned when the uploaded parts don't match the provided list:
+INVALID_PARTS_ERROR_CODES = {'InvalidPart', 'InvalidPartOrder', 'EntityTooSmall'}
+
+# String literals
+UTF_8 = "utf-8"
+
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+s3_client = s3.get_s3_client()
+
+
+# Response statuses:
+class ResponseStatus(str, Enum):
+    MALFORMED_SLOT_NAME = 'Malformed Slot Name'
+    MALFORMED_UPLOAD_ID = 'Malformed Upload Id'
+    MALFORMED_PARTS = 'Malformed Parts'
+    INVALID_PARTS = 'Invalid Parts'
+    UPLOAD_NOT_FOUND = 'Upload Not Found'
+
+
+def lambda_handler(event, context):
+    """
+    Complete a multipart upload of a save file, started by the GeneratePreSignedPutURL Lambda with a 'part_count'
+    greater than 1. S3 then assembles the parts, and the UpdateSlotMetadata Lambda records the save slot as for a
+    single part upload.
+
+    Parameters:
+
+    Request Context:
+        custom:gk_user_id: str
+            The player_id the save file is associated with. This value comes from the Cognito Authorizer that validates
+            the API Gateway request.
+
+    Path Parameters:
+        slot_name: str
+            The slot name of the save file.
+
+            Limited to 512 characters long, using alphanumeric characters, dashes (-), underscores (_), and periods (.).
+            This lambda will return an error if a malformed slot name is provided.
+
+    Body:
+        upload_id: str
+            The 'upload_id' returned by the GeneratePreSignedPutURL Lambda.
+
+        parts: list
+            Every part of the save file, as {"part_number": int, "etag": str}, where 'etag' is the 'ETag' response
+            header of the part's upload. The parts may be listed in any order.
+
+    Errors:
+        400 Bad Request  - Returned when a malformed 'slot_name' path parameter is provided.
+        400 Bad Request  - Returned when the 'upload_id' or 'parts' body parameters are missing or malformed.
+        400 Bad Request  - Returned when the listed parts don't match the uploaded parts, or a part other than the last
+                           one is smaller than 5 MB.
+        401 Unauthorized - Returned when the 'custom:gk_user_id' parameter is missing from the request context.
+        404 Not Found    - Returned when the 'upload_id' doesn't match a multipart upload of this save slot, for example
+                           because it was already completed.
+    """
+    log_event(event)
+
+    # Get player_id from requestContext:
+    player_id = get_player_id(event)
+    if player_id is None:
+        return response_envelope(status_code=401)
+
+    # Get path param inputs:
+    slot_name = get_path_param(event, 'slot_name')
+
+    # Get body inputs:
+    body = get_body_as_json(event) or {}
+    upload_id = body.get('upload_id')
+    parts = get_parts(body.get('parts'))
+
+    # Validate inputs:
+    if not is_valid_primary_identifier(slot_name):
+        logger.error((f'Malformed slot_name: {slot_name} provided for player_id: {player_id}').encode(UTF_8))
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_SLOT_NAME)
+
+    if not isinstance(upload_id, str) or not upload_id:
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_UPLOAD_ID)
+
+    if parts is None:
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_PARTS)
+
+    # Complete the upload:
+    try:
+        s3_client.complete_multipart_upload(
+            Bucket=os.environ.get('GAMESAVES_BUCKET_NAME'),
+            Key=f'{player_id}/{slot_name}',
+            UploadId=upload_id,
+            MultipartUpload={'Parts': parts},
+        )
+    except s3_client.exceptions.NoSuchUpload:
+        return response_envelope(status_code=404, status_message=ResponseStatus.UPLOAD_NOT_FOUND)
+    except botocore.exceptions.ClientError as err:
+        if err.response.get('Error', {}).get('Code') in INVALID_PARTS_ERROR_CODES:
+            logger.error(f'Invalid parts provided for upload_id: {upload_id}. Error: {err}')
+            return response_envelope(status_code=400, status_message=ResponseStatus.INVALID_PARTS)
+        raise err
+
+    return response_envelope(status_code=200)
+
+
+def get_parts(parts) -> Optional[List[dict]]:
+    """Convert the 'parts' body parameter into the S3 MultipartUpload parts, sorted by part number, or return None if it's malformed."""
+    if not isinstance(parts, list) or not 1 <= len(parts) <= MAX_PART_COUNT:
+        return None
+
+    s3_parts = {}
+    for part in parts:
+        if not isinstance(part, dict):
+            return None
+
+        part_number = part.get('part_number')
+        etag = part.get('etag')
+        if isinstance(part_number, bool) or not isinstance(part_number, int) or not 1 <= part_number <= MAX_PART_COUNT:
+            return None
+        if not isinstance(etag, str) or not etag or part_number in s3_parts:
+            return None
+
+        s3_parts[part_number] = {'ETag': etag, 'PartNumber': part_number}
+
+    return [s3_parts[part_number] for part_number in sorted(s3_parts)]
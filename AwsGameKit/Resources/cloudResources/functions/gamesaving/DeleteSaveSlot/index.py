@@ -73,8 +73,9 @@ def lambda_handler(event, context):
 
 
 def delete_save_slot(player_id: str, slot_name: str) -> None:
-    """Delete the save slot object from S3 and the metadata from DynamoDB."""
+    """Delete the save slot object and its delta mode chunks from S3, and the metadata from DynamoDB."""
     delete_slot_object(player_id, slot_name)
+    delete_slot_chunks(player_id, slot_name)
     delete_slot_metadata(player_id, slot_name)
 
 
@@ -88,6 +89,14 @@ def delete_slot_object(player_id: str, slot_name: str) -> None:
     )
 
 
+def delete_slot_chunks(player_id: str, slot_name: str) -> None:
+    """Delete the chunks the save slot stored in delta mode from S3, see the SyncSlotChunks Lambda."""
+    bucket_name = os.environ.get('GAMESAVES_BUCKET_NAME')
+    s3_resource.Bucket(bucket_name).objects.filter(Prefix=f"{player_id}/{slot_name}/chunks/").delete(
+        ExpectedBucketOwner=os.environ.get('AWS_ACCOUNT_ID')
+    )
+
+
 def delete_slot_metadata(player_id: str, slot_name: str) -> None:
     """Delete the slot metadata from DynamoDB."""
     gamesaves_table = ddb.get_table(table_name=os.environ.get('GAMESAVES_TABLE_NAME'))
@@ -3,14 +3,19 @@
 
 import os
 import logging
+import time
+from typing import List, Optional
 
 from gamekithelpers import s3
-from gamekithelpers.handler_request import get_player_id, get_path_param, get_query_string_param, log_event
+from gamekithelpers.handler_request import get_player_id, get_path_param, get_query_string_param, get_query_string_param_as_list, log_event
 from gamekithelpers.handler_response import response_envelope
 from gamekithelpers.validation import is_valid_primary_identifier
 
 DEFAULT_TIME_TO_LIVE_SECONDS = '120'
 
+# Constraints:
+MAX_SLOTS_PER_REQUEST = 100
+
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
@@ -21,6 +26,9 @@ def lambda_handler(event, context):
     """
     Generate a pre-signed URL for downloading the player's specified save slot data from S3.
 
+    Optionally generates the URLs of several save slots at once, so a client downloading or prefetching many slots
+    only pays for one round trip.
+
     If the save slot doesn't exist on S3, the URL will return a 404 "no such key" when it is used to download the file:
     https://boto3.amazonaws.com/v1/documentation/api/latest/reference/services/s3.html#S3.Client.get_object
 
@@ -43,8 +51,24 @@ def lambda_handler(event, context):
             The number of seconds the URL will be valid. The URL will no longer work after the time has expired.
             [Optional, defaults to 120 seconds (DEFAULT_TIME_TO_LIVE_SECONDS).]
 
+        additional_slot_names: str
+            A comma separated list of other slot names to generate URLs for, at most 99 (MAX_SLOTS_PER_REQUEST - 1).
+            [Optional, only the 'slot_name' URL is generated when missing.]
+
+            The response then also contains 'urls', the 'slot_name' and 'url' of every requested slot in request order,
+            starting with the 'slot_name' path parameter.
+
+    Response:
+        url: str
+            The URL of the 'slot_name' path parameter.
+
+        expiration_epoch_time: int
+            The number of milliseconds since epoch when the URLs expire. Clients caching the URLs should stop using
+            them a little before then to allow for clock skew and the duration of the download.
+
     Errors:
         400 Bad Request  - Returned when a malformed 'slot_name' path parameter is provided.
+        400 Bad Request  - Returned when 'additional_slot_names' has a malformed slot name or too many slot names.
         401 Unauthorized - Returned when the 'custom:gk_user_id' parameter is missing from the request context.
     """
     log_event(event)
@@ -62,20 +86,50 @@ def lambda_handler(event, context):
 
     # Get query param inputs:
     time_to_live = int(get_query_string_param(event, 'time_to_live', DEFAULT_TIME_TO_LIVE_SECONDS))
+    additional_slot_names = get_additional_slot_names(event, slot_name)
+    if additional_slot_names is None:
+        logger.error(f'Malformed additional_slot_names provided for player_id: {player_id}')
+        return response_envelope(status_code=400)
 
-    # Generate URL:
+    # Generate URLs:
     bucket_name = os.environ.get('GAMESAVES_BUCKET_NAME')
+    expiration_epoch_time = int(time.time() * 1000) + time_to_live * 1000
     url = generate_presigned_url(bucket_name, player_id, slot_name, time_to_live)
 
     # Construct response object:
+    response_obj = {
+        'url': url,
+        'expiration_epoch_time': expiration_epoch_time
+    }
+    if additional_slot_names:
+        response_obj['urls'] = [{'slot_name': slot_name, 'url': url}] + [
+            {
+                'slot_name': additional_slot_name,
+                'url': generate_presigned_url(bucket_name, player_id, additional_slot_name, time_to_live)
+            }
+            for additional_slot_name in additional_slot_names
+        ]
+
     return response_envelope(
         status_code=200,
-        response_obj={
-            'url': url
-        }
+        response_obj=response_obj
     )
 
 
+def get_additional_slot_names(event: dict, slot_name: str) -> Optional[List[str]]:
+    """Return the unique 'additional_slot_names' other than 'slot_name' in their original order, or None if it's malformed."""
+    additional_slot_names = [name for name in get_query_string_param_as_list(event, 'additional_slot_names') if name != '']
+    additional_slot_names = [name for name in dict.fromkeys(additional_slot_names) if name != slot_name]
+
+    if len(additional_slot_names) >= MAX_SLOTS_PER_REQUEST:
+        return None
+
+    if not all(is_valid_primary_identifier(name) for name in additional_slot_names):
+        return None
+
+    return additional_slot_names
+
+
 def generate_presigned_url(bucket_name: str, player_id: str, slot_name: str, time_to_live: int) -> str:
     return s3_client.generate_presigned_url(
         ClientMethod='get_object',
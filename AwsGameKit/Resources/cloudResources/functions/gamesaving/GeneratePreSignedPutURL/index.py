@@ -4,11 +4,13 @@
 import boto3
 import os
 import logging
+import time
 from distutils.util import strtobool
 from enum import Enum
+from typing import List, Optional
 
 from gamekithelpers import ddb, s3
-from gamekithelpers.handler_request import get_player_id, get_header_param, get_path_param, get_query_string_param, log_event
+from gamekithelpers.handler_request import get_player_id, get_header_param, get_path_param, get_query_string_param, get_body_as_json, log_event
 from gamekithelpers.handler_response import response_envelope
 from gamekithelpers.validation import is_valid_primary_identifier, is_valid_base_64
 
@@ -16,6 +18,7 @@ from gamekithelpers.validation import is_valid_primary_identifier, is_valid_base
 DEFAULT_TIME_TO_LIVE_SECONDS = '120'
 DEFAULT_CONSISTENT_READ = 'True'
 DEFAULT_METADATA = ''
+DEFAULT_PART_COUNT = '1'
 
 # Constraints:
 
@@ -26,6 +29,12 @@ DEFAULT_METADATA = ''
 # See: https://docs.aws.amazon.com/AmazonS3/latest/userguide/UsingMetadata.html#UserMetadata
 MAX_METADATA_BYTES = 1887
 
+# S3 allows at most 10,000 parts in a multipart upload.
+# See: https://docs.aws.amazon.com/AmazonS3/latest/userguide/qfacts.html
+MAX_PART_COUNT = 10000
+
+MAX_SLOTS_PER_REQUEST = 100
+
 # Dictionary Keys:
 S3_SLOT_METADATA_KEY = 'slot_metadata'
 S3_HASH_METADATA_KEY = 'hash'
@@ -52,6 +61,9 @@ class ResponseStatus(str, Enum):
     MALFORMED_METADATA = 'Malformed Metadata'
     MALFORMED_HASH_SIZE_MISMATCH = 'Malformed Hash Size Mismatch'
     MAX_CLOUD_SAVE_SLOTS_EXCEEDED = 'Max Cloud Save Slots Exceeded'
+    MALFORMED_PART_COUNT = 'Malformed Part Count'
+    UPLOAD_NOT_FOUND = 'Upload Not Found'
+    MALFORMED_ADDITIONAL_SLOTS = 'Malformed Additional Slots'
     GENERIC_STATUS = 'Unexpected Error'
 
 
@@ -60,6 +72,9 @@ def lambda_handler(event, context):
     Generate a pre-signed URL that allows a save file to be uploaded to S3 in the player's specified save slot. If the
     slot is new, will verify that MAX_SAVE_SLOTS_PER_PLAYER has not been reached.
 
+    Optionally generates the URLs of several save slots at once, so a client uploading many slots only pays for one
+    round trip. Send the request with the POST method and list the other slots in the 'additional_slots' body parameter.
+
     Parameters:
 
     Request Context:
@@ -119,6 +134,42 @@ def lambda_handler(event, context):
             Whether to use "Consistent Read" when querying DynamoDB.
             [Optional, defaults to True (DEFAULT_CONSISTENT_READ).]
 
+        part_count: int
+            The number of parts to upload the save file in, between 1 and 10,000 (MAX_PART_COUNT).
+            [Optional, defaults to 1 (DEFAULT_PART_COUNT).]
+
+            When greater than 1, a multipart upload is started instead of returning a single 'url'. The response then
+            contains the 'upload_id' and one pre-signed 'upload_part' URL per part in 'part_urls'. Parts may be uploaded
+            in parallel. Once every part is uploaded, call the CompleteMultipartUpload Lambda with the 'ETag' response
+            header of each part. Every part except the last one must be at least 5 MB.
+
+        upload_id: str
+            The 'upload_id' of an interrupted multipart upload of this save slot, to resume it.
+            [Optional, a new multipart upload is started when missing.]
+
+            The response then only contains URLs for the parts which weren't uploaded yet, and lists the uploaded ones
+            with their ETags in 'completed_parts'. The metadata, hash and epoch time are the ones the upload was started
+            with, so start a new upload if the save file changed. Uploads which aren't completed are aborted after 7 days.
+
+    Body:
+        additional_slots: list
+            The other save slots to generate upload URLs for, at most 99 (MAX_SLOTS_PER_REQUEST - 1). Each one is an
+            object with the 'slot_name', 'hash', 'last_modified_epoch_time' and optional 'metadata' of that slot, with
+            the same constraints as the path and header parameters above.
+            [Optional, only the 'slot_name' URL is generated when missing. Not supported when 'part_count' is over 1.]
+
+            The response then also contains 'urls', the 'slot_name' and 'url' of every requested slot in request order,
+            starting with the 'slot_name' path parameter. The slot limit is checked for all the new slots together.
+
+    Response:
+        url: str
+            The URL of the 'slot_name' path parameter, when 'part_count' is 1.
+
+        expiration_epoch_time: int
+            The number of milliseconds since epoch when the URLs expire. Clients caching the URLs should stop using
+            them a little before then to allow for clock skew and the duration of the upload. A cached upload URL is
+            only valid for the hash, epoch time and metadata it was generated with.
+
     Errors:
         400 Bad Request  - Returned when a malformed 'slot_name' path parameter is provided.
         400 Bad Request  - Returned when the 'metadata' parameter exceeds 1883 bytes (MAX_METADATA_BYTES) after being
@@ -126,7 +177,11 @@ def lambda_handler(event, context):
         400 Bad Request  - Returned when the 'hash' parameter is not exactly 44 bytes (BASE_64_ENCODED_SHA_256_BYTES)
                            in size.
         400 Bad Request  - Returned when the save slot is new and would exceed the player's MAX_SAVE_SLOTS_PER_PLAYER.
+        400 Bad Request  - Returned when the 'part_count' parameter isn't between 1 and 10,000 (MAX_PART_COUNT).
+        400 Bad Request  - Returned when 'additional_slots' is malformed, has too many slots, or is combined with a
+                           'part_count' over 1.
         401 Unauthorized - Returned when the 'custom:gk_user_id' parameter is missing from the request context.
+        404 Not Found    - Returned when the 'upload_id' parameter doesn't match a multipart upload of this save slot.
     """
     log_event(event)
 
@@ -146,39 +201,97 @@ def lambda_handler(event, context):
     # Get query param inputs:
     time_to_live = int(get_query_string_param(event, 'time_to_live', DEFAULT_TIME_TO_LIVE_SECONDS))
     consistent_read = bool(strtobool(get_query_string_param(event, 'consistent_read', DEFAULT_CONSISTENT_READ)))
+    part_count = get_query_string_param(event, 'part_count', DEFAULT_PART_COUNT)
+    upload_id = get_query_string_param(event, 'upload_id')
 
     # Validate inputs:
     if not is_valid_primary_identifier(slot_name):
         logger.error((f'Malformed slot_name: {slot_name} provided for player_id: {player_id}').encode(UTF_8))
         return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_SLOT_NAME)
 
-    if get_bytes_length(metadata) > MAX_METADATA_BYTES:
-        return response_envelope(status_code=400, status_message=ResponseStatus.MAX_METADATA_BYTES_EXCEEDED)
+    error_status = validate_metadata_and_hash(metadata, sha_hash)
+    if error_status is not None:
+        return response_envelope(status_code=400, status_message=error_status)
 
-    if not is_valid_base_64(metadata):
-        logger.error((f'Malformed metadata provided, expected a Base64 encoded string. Metadata: {metadata}').encode(UTF_8))
-        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_METADATA)
+    if not part_count.isdigit() or not 1 <= int(part_count) <= MAX_PART_COUNT:
+        logger.error(f'Malformed part_count: {part_count} provided. Must be between 1 and {MAX_PART_COUNT}.')
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_PART_COUNT)
+    part_count = int(part_count)
 
-    if len(sha_hash) != BASE_64_ENCODED_SHA_256_BYTES or not sha_hash.isascii():
-        logger.error((f'Malformed SHA-256 hash: {sha_hash} provided. Must be 44 characters and Base64 encoded.').encode(UTF_8))
-        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_HASH_SIZE_MISMATCH)
+    additional_slots = get_additional_slots(event, slot_name)
+    if additional_slots is None or (additional_slots and part_count > 1):
+        logger.error(f'Malformed additional_slots provided for player_id: {player_id}')
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_ADDITIONAL_SLOTS)
+
+    for additional_slot in additional_slots:
+        error_status = validate_metadata_and_hash(additional_slot['metadata'], additional_slot['hash'])
+        if error_status is not None:
+            return response_envelope(status_code=400, status_message=error_status)
 
     # Verify MAX_SAVE_SLOTS_PER_PLAYER won't be exceeded:
-    if is_new_save_slot(player_id, slot_name, consistent_read) and would_exceed_slot_limit(player_id, consistent_read):
+    slot_names = [slot_name] + [additional_slot['slot_name'] for additional_slot in additional_slots]
+    new_slot_count = sum(1 for name in slot_names if is_new_save_slot(player_id, name, consistent_read))
+    if new_slot_count > 0 and would_exceed_slot_limit(player_id, consistent_read, new_slot_count):
         return response_envelope(status_code=400, status_message=ResponseStatus.MAX_CLOUD_SAVE_SLOTS_EXCEEDED)
 
-    # Generate URL:
     bucket_name = os.environ.get('GAMESAVES_BUCKET_NAME')
+    expiration_epoch_time = int(time.time() * 1000) + time_to_live * 1000
+
+    # Generate part URLs:
+    if part_count > 1:
+        if upload_id is None:
+            upload_id = create_multipart_upload(bucket_name, player_id, slot_name, metadata, sha_hash, last_modified_epoch_time)
+            completed_parts = []
+        else:
+            try:
+                completed_parts = get_completed_parts(bucket_name, player_id, slot_name, upload_id)
+            except s3_client.exceptions.NoSuchUpload:
+                return response_envelope(status_code=404, status_message=ResponseStatus.UPLOAD_NOT_FOUND)
+
+        completed_part_numbers = {part['part_number'] for part in completed_parts}
+        part_urls = [
+            {
+                'part_number': part_number,
+                'url': generate_presigned_part_url(bucket_name, player_id, slot_name, upload_id, part_number, time_to_live)
+            }
+            for part_number in range(1, part_count + 1) if part_number not in completed_part_numbers
+        ]
+
+        return response_envelope(
+            status_code=200,
+            response_obj={
+                'upload_id': upload_id,
+                'part_urls': part_urls,
+                'completed_parts': completed_parts,
+                'expiration_epoch_time': expiration_epoch_time
+            }
+        )
+
+    # Generate URL:
     url = generate_presigned_url(
         bucket_name, player_id, slot_name, metadata, sha_hash, last_modified_epoch_time, time_to_live
     )
 
     # Construct response object:
+    response_obj = {
+        'url': url,
+        'expiration_epoch_time': expiration_epoch_time
+    }
+    if additional_slots:
+        response_obj['urls'] = [{'slot_name': slot_name, 'url': url}] + [
+            {
+                'slot_name': additional_slot['slot_name'],
+                'url': generate_presigned_url(
+                    bucket_name, player_id, additional_slot['slot_name'], additional_slot['metadata'],
+                    additional_slot['hash'], additional_slot['last_modified_epoch_time'], time_to_live
+                )
+            }
+            for additional_slot in additional_slots
+        ]
+
     return response_envelope(
         status_code=200,
-        response_obj={
-            'url': url
-        }
+        response_obj=response_obj
     )
 
 
@@ -187,6 +300,67 @@ def get_bytes_length(input_string: str) -> int:
     return len(input_string.encode(UTF_8))
 
 
+def validate_metadata_and_hash(metadata: str, sha_hash: str) -> Optional[ResponseStatus]:
+    """Return the error status if the metadata or the SHA-256 hash of a save slot is malformed, or None if both are valid."""
+    if get_bytes_length(metadata) > MAX_METADATA_BYTES:
+        return ResponseStatus.MAX_METADATA_BYTES_EXCEEDED
+
+    if not is_valid_base_64(metadata):
+        logger.error((f'Malformed metadata provided, expected a Base64 encoded string. Metadata: {metadata}').encode(UTF_8))
+        return ResponseStatus.MALFORMED_METADATA
+
+    if len(sha_hash) != BASE_64_ENCODED_SHA_256_BYTES or not sha_hash.isascii():
+        logger.error((f'Malformed SHA-256 hash: {sha_hash} provided. Must be 44 characters and Base64 encoded.').encode(UTF_8))
+        return ResponseStatus.MALFORMED_HASH_SIZE_MISMATCH
+
+    return None
+
+
+def get_additional_slots(event: dict, slot_name: str) -> Optional[List[dict]]:
+    """
+    Return the 'additional_slots' body parameter with the default metadata filled in, or None if it's malformed.
+
+    The metadata and hash of each slot are validated separately by validate_metadata_and_hash().
+    """
+    if not event.get('body'):
+        return []
+
+    body = get_body_as_json(event)
+    if not isinstance(body, dict):
+        return None
+
+    additional_slots = body.get('additional_slots', [])
+    if not isinstance(additional_slots, list) or len(additional_slots) >= MAX_SLOTS_PER_REQUEST:
+        return None
+
+    slots = []
+    seen_slot_names = {slot_name}
+    for additional_slot in additional_slots:
+        if not isinstance(additional_slot, dict):
+            return None
+
+        name = additional_slot.get('slot_name')
+        sha_hash = additional_slot.get(S3_HASH_METADATA_KEY)
+        metadata = additional_slot.get('metadata', DEFAULT_METADATA)
+        last_modified_epoch_time = additional_slot.get('last_modified_epoch_time')
+        if not isinstance(name, str) or not is_valid_primary_identifier(name) or name in seen_slot_names:
+            return None
+        if not isinstance(sha_hash, str) or not isinstance(metadata, str):
+            return None
+        if not isinstance(last_modified_epoch_time, int) or isinstance(last_modified_epoch_time, bool):
+            return None
+
+        seen_slot_names.add(name)
+        slots.append({
+            'slot_name': name,
+            S3_HASH_METADATA_KEY: sha_hash,
+            'metadata': metadata,
+            'last_modified_epoch_time': last_modified_epoch_time
+        })
+
+    return slots
+
+
 def is_new_save_slot(player_id: str, slot_name: str, consistent_read: bool) -> bool:
     """Return True if the player's slot_name doesn't exist in the DynamoDB table, or False if it does exist."""
     gamesaves_table = ddb.get_table(table_name=os.environ.get('GAMESAVES_TABLE_NAME'))
@@ -201,11 +375,11 @@ def is_new_save_slot(player_id: str, slot_name: str, consistent_read: bool) -> b
     return item is None
 
 
-def would_exceed_slot_limit(player_id: str, consistent_read: bool) -> bool:
-    """Return True if adding an additional save slot would cause the player to exceed the MAX_SAVE_SLOTS_PER_PLAYER."""
+def would_exceed_slot_limit(player_id: str, consistent_read: bool, new_slot_count: int = 1) -> bool:
+    """Return True if adding new_slot_count save slots would cause the player to exceed the MAX_SAVE_SLOTS_PER_PLAYER."""
     slot_limit = int(os.environ.get('MAX_SAVE_SLOTS_PER_PLAYER'))
     number_of_slots_in_use = get_number_of_slots_used(player_id, consistent_read)
-    return number_of_slots_in_use + 1 > slot_limit
+    return number_of_slots_in_use + new_slot_count > slot_limit
 
 
 def get_number_of_slots_used(player_id: str, consistent_read: bool) -> int:
@@ -251,3 +425,52 @@ def generate_presigned_url(bucket_name: str, player_id: str, slot_name: str, met
         },
         ExpiresIn=time_to_live,
     )
+
+
+def create_multipart_upload(bucket_name: str, player_id: str, slot_name: str, metadata: str, sha_hash: str,
+                            last_modified_epoch_time: int) -> str:
+    """Start a multipart upload of the save file and return its upload ID. The metadata is set on the completed object."""
+    response = s3_client.create_multipart_upload(
+        Bucket=bucket_name,
+        Key=f'{player_id}/{slot_name}',
+        Metadata={
+            S3_SLOT_METADATA_KEY: metadata,
+            S3_HASH_METADATA_KEY: sha_hash,
+            S3_EPOCH_METADATA_KEY: str(last_modified_epoch_time)
+        }
+    )
+    return response['UploadId']
+
+
+def get_completed_parts(bucket_name: str, player_id: str, slot_name: str, upload_id: str) -> List[dict]:
+    """Get the part number and ETag of every part already uploaded in the multipart upload."""
+    paginator = s3_client.get_paginator('list_parts')
+    pages = paginator.paginate(
+        Bucket=bucket_name,
+        Key=f'{player_id}/{slot_name}',
+        UploadId=upload_id,
+    )
+
+    completed_parts = []
+    for page in pages:
+        for part in page.get('Parts', []):
+            completed_parts.append({
+                'part_number': part['PartNumber'],
+                'etag': part['ETag']
+            })
+
+    return completed_parts
+
+
+def generate_presigned_part_url(bucket_name: str, player_id: str, slot_name: str, upload_id: str, part_number: int,
+                                time_to_live: int) -> str:
+    return s3_client.generate_presigned_url(
+        ClientMethod='upload_part',
+        Params={
+            'Bucket': bucket_name,
+            'Key': f'{player_id}/{slot_name}',
+            'UploadId': upload_id,
+            'PartNumber': part_number
+        },
+        ExpiresIn=time_to_live,
+    )
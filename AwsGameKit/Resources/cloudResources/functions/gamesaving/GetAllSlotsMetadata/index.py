@@ -14,6 +14,7 @@ from gamekithelpers.sanitizer import sanitize
 DEFAULT_PAGE_SIZE = '100'
 DEFAULT_START_KEY = ''
 DEFAULT_CONSISTENT_READ = 'True'
+DEFAULT_SUMMARY_ONLY = 'False'
 EMPTY_RESPONSE = {}
 
 
@@ -47,6 +48,11 @@ def lambda_handler(event, context):
             Whether to use "Consistent Read" when querying DynamoDB.
             [Optional, defaults to True (DEFAULT_CONSISTENT_READ).]
 
+        summary_only: bool
+            Whether to return only the "slot_name", "last_modified" and "size" of each save slot, leaving out the
+            player-defined "metadata". Use it to list the save slots without transferring all of their metadata.
+            [Optional, defaults to False (DEFAULT_SUMMARY_ONLY).]
+
     Errors:
         401 Unauthorized - Returned when the 'custom:gk_user_id' parameter is missing from the request context.
     """
@@ -61,6 +67,7 @@ def lambda_handler(event, context):
     page_size = int(get_query_string_param(event, 'page_size', DEFAULT_PAGE_SIZE))
     start_key = sanitize(get_query_string_param(event, 'start_key', DEFAULT_START_KEY))
     consistent_read = bool(strtobool(get_query_string_param(event, 'consistent_read', DEFAULT_CONSISTENT_READ)))
+    summary_only = bool(strtobool(get_query_string_param(event, 'summary_only', DEFAULT_SUMMARY_ONLY)))
 
     if start_key is not None and len(start_key) > 0:
         paging_token = get_query_string_param(event, 'paging_token')
@@ -69,7 +76,8 @@ def lambda_handler(event, context):
            return response_envelope(403, "Invalid paging token")
 
     # Get all metadata from DynamoDB:
-    all_metadata, next_start_key = get_all_slots_metadata(player_id, page_size, consistent_read, start_key)
+    all_metadata, next_start_key = get_all_slots_metadata(player_id, page_size, consistent_read, start_key,
+                                                          summary_only)
 
     # Construct response object:
     return response_envelope(
@@ -78,11 +86,13 @@ def lambda_handler(event, context):
             'slots_metadata': all_metadata
         },
         next_start_key=next_start_key,
-        player_id=player_id
+        player_id=player_id,
+        event=event
     )
 
 
-def get_all_slots_metadata(player_id: str, page_size: int, consistent_read: bool, start_key: Optional[str]):
+def get_all_slots_metadata(player_id: str, page_size: int, consistent_read: bool, start_key: Optional[str],
+                           summary_only: bool = False):
     """Get metadata for all save slots, or an empty list if no metadata is found."""
     gamesaves_table = ddb.get_table(table_name=os.environ.get('GAMESAVES_TABLE_NAME'))
     query_params = ddb.query_request_param(
@@ -92,6 +102,15 @@ def get_all_slots_metadata(player_id: str, page_size: int, consistent_read: bool
         use_consistent_read=consistent_read,
         start_key=create_exclusive_start_key(player_id, start_key)
     )
+    if summary_only:
+        # 'size' is a DynamoDB reserved word, so all attributes are referenced by name placeholders
+        query_params['Select'] = 'SPECIFIC_ATTRIBUTES'
+        query_params['ProjectionExpression'] = '#slot_name, #last_modified, #size'
+        query_params['ExpressionAttributeNames'] = {
+            '#slot_name': 'slot_name',
+            '#last_modified': 'last_modified',
+            '#size': 'size',
+        }
     response = gamesaves_table.query(**query_params)
 
     return response['Items'], create_next_start_key(response.get('LastEvaluatedKey'))
@@ -0,0 +1,242 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import logging
+import re
+from enum import Enum
+from typing import Dict, List, Optional, Set
+
+from gamekithelpers import s3
+from gamekithelpers.handler_request import get_player_id, get_path_param, get_query_string_param, get_body_as_json, log_event
+from gamekithelpers.handler_response import response_envelope
+from gamekithelpers.validation import is_valid_primary_identifier
+
+# Defaults:
+DEFAULT_TIME_TO_LIVE_SECONDS = '120'
+
+# Constraints:
+MAX_CHUNKS_PER_REQUEST = 10000
+
+# Largest chunk cut by FAwsGameKitGameSavingDeltaSync, 64 KB.
+MAX_CHUNK_SIZE_BYTES = 64 * 1024
+
+# S3 deletes at most 1,000 objects per DeleteObjects call.
+MAX_DELETE_OBJECTS_KEYS = 1000
+
+# Chunks are named by the lowercase hex digest of their content, from SHA-1 (40 characters) up to SHA-256 (64 characters).
+chunk_hash_regex = re.compile('^[0-9a-f]{40,64}$')
+
+# Operations:
+OPERATION_UPLOAD = 'upload'
+OPERATION_DOWNLOAD = 'download'
+OPERATION_PRUNE = 'prune'
+OPERATIONS = {OPERATION_UPLOAD, OPERATION_DOWNLOAD, OPERATION_PRUNE}
+
+# String literals
+UTF_8 = "utf-8"
+
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+s3_client = s3.get_s3_client()
+
+
+# Response statuses:
+class ResponseStatus(str, Enum):
+    MALFORMED_SLOT_NAME = 'Malformed Slot Name'
+    MALFORMED_OPERATION = 'Malformed Operation'
+    MALFORMED_CHUNKS = 'Malformed Chunks'
+
+
+def lambda_handler(event, context):
+    """
+    Manage the content-addressed chunks of a save slot uploaded in delta mode.
+
+    In delta mode the save file is split into content-defined chunks. The file uploaded through the regular
+    GeneratePreSignedPutURL Lambda is the slot's chunk manifest, so the slot's metadata, hash and sync status work as
+    for any other save file; the chunks themselves are stored next to it under '{player_id}/{slot_name}/chunks/'.
+    Only the chunks which changed since the previous save are uploaded, and a device loading the slot only downloads
+    the chunks it doesn't already have.
+
+    Parameters:
+
+    Request Context:
+        custom:gk_user_id: str
+            The player_id the save slot is associated with. This value comes from the Cognito Authorizer that validates
+            the API Gateway request.
+
+    Path Parameters:
+        slot_name: str
+            The slot name of the save file.
+
+            Limited to 512 characters long, using alphanumeric characters, dashes (-), underscores (_), and periods (.).
+            This lambda will return an error if a malformed slot name is provided.
+
+    Query String Parameters:
+        time_to_live: int
+            The number of seconds the URLs will be valid. The URLs will no longer work after the time has expired.
+            [Optional, defaults to 120 seconds (DEFAULT_TIME_TO_LIVE_SECONDS).]
+
+    Body:
+        operation: str
+            One of:
+            'upload'   - Return a pre-signed PUT URL for each of the listed chunks which isn't stored yet. Call this with
+                         every chunk of the new manifest before uploading the manifest itself.
+            'download' - Return a pre-signed GET URL for each of the listed chunks.
+            'prune'    - Delete the slot's stored chunks which aren't listed. Call this with every chunk of the manifest
+                         once it was uploaded, so that chunks of previous saves don't accumulate.
+
+        chunks: list
+            The lowercase hex content hashes of the chunks, at most 10,000 (MAX_CHUNKS_PER_REQUEST).
+
+        chunk_sizes: list
+            The size in bytes of each chunk, in the order of 'chunks', at most 64 KB (MAX_CHUNK_SIZE_BYTES) each.
+            [Required for 'upload', ignored otherwise.] Each upload URL only accepts a body of its chunk's size.
+
+    Errors:
+        400 Bad Request  - Returned when a malformed 'slot_name' path parameter is provided.
+        400 Bad Request  - Returned when the 'operation' or 'chunks' body parameters are missing or malformed.
+        401 Unauthorized - Returned when the 'custom:gk_user_id' parameter is missing from the request context.
+    """
+    log_event(event)
+
+    # Get player_id from requestContext:
+    player_id = get_player_id(event)
+    if player_id is None:
+        return response_envelope(status_code=401)
+
+    # Get path param inputs:
+    slot_name = get_path_param(event, 'slot_name')
+
+    # Get query param inputs:
+    time_to_live = int(get_query_string_param(event, 'time_to_live', DEFAULT_TIME_TO_LIVE_SECONDS))
+
+    # Get body inputs:
+    body = get_body_as_json(event) or {}
+    operation = body.get('operation')
+    chunks = get_chunks(body.get('chunks'))
+    chunk_sizes = get_chunk_sizes(body.get('chunks'), body.get('chunk_sizes')) if operation == OPERATION_UPLOAD else {}
+
+    # Validate inputs:
+    if not is_valid_primary_identifier(slot_name):
+        logger.error((f'Malformed slot_name: {slot_name} provided for player_id: {player_id}').encode(UTF_8))
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_SLOT_NAME)
+
+    if operation not in OPERATIONS:
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_OPERATION)
+
+    if chunks is None or chunk_sizes is None:
+        return response_envelope(status_code=400, status_message=ResponseStatus.MALFORMED_CHUNKS)
+
+    bucket_name = os.environ.get('GAMESAVES_BUCKET_NAME')
+    chunks_prefix = get_chunks_prefix(player_id, slot_name)
+
+    if operation == OPERATION_PRUNE:
+        stored_chunks = get_stored_chunks(bucket_name, chunks_prefix)
+        unreferenced_chunks = sorted(stored_chunks - set(chunks))
+        delete_chunks(bucket_name, chunks_prefix, unreferenced_chunks)
+        return response_envelope(
+            status_code=200,
+            response_obj={
+                'deleted_count': len(unreferenced_chunks)
+            }
+        )
+
+    if operation == OPERATION_UPLOAD:
+        # Chunks which are already stored don't need to be uploaded again
+        stored_chunks = get_stored_chunks(bucket_name, chunks_prefix)
+        chunks = [chunk for chunk in chunks if chunk not in stored_chunks]
+        client_method = 'put_object'
+    else:
+        client_method = 'get_object'
+
+    chunk_urls = [
+        {
+            'hash': chunk,
+            'url': generate_presigned_url(client_method, bucket_name, chunks_prefix + chunk, time_to_live, chunk_sizes.get(chunk))
+        }
+        for chunk in chunks
+    ]
+
+    # Construct response object:
+    return response_envelope(
+        status_code=200,
+        response_obj={
+            'chunk_urls': chunk_urls
+        }
+    )
+
+
+def get_chunks(chunks) -> Optional[List[str]]:
+    """Return the unique chunk hashes of the 'chunks' body parameter in their original order, or None if it's malformed."""
+    if not isinstance(chunks, list) or len(chunks) > MAX_CHUNKS_PER_REQUEST:
+        return None
+
+    if not all(isinstance(chunk, str) and chunk_hash_regex.fullmatch(chunk) is not None for chunk in chunks):
+        return None
+
+    return list(dict.fromkeys(chunks))
+
+
+def get_chunk_sizes(chunks, chunk_sizes) -> Optional[Dict[str, int]]:
+    """Return the size of each chunk of the 'chunks' body parameter by hash, or None if 'chunk_sizes' is malformed."""
+    if not isinstance(chunks, list) or not isinstance(chunk_sizes, list) or len(chunks) != len(chunk_sizes):
+        return None
+
+    sizes = {}
+    for chunk, size in zip(chunks, chunk_sizes):
+        # bool is an int, but not a size
+        if not isinstance(size, int) or isinstance(size, bool) or not 0 < size <= MAX_CHUNK_SIZE_BYTES:
+            return None
+        if sizes.setdefault(chunk, size) != size:
+            return None
+
+    return sizes
+
+
+def get_chunks_prefix(player_id: str, slot_name: str) -> str:
+    return f'{player_id}/{slot_name}/chunks/'
+
+
+def get_stored_chunks(bucket_name: str, chunks_prefix: str) -> Set[str]:
+    """Get the hashes of every chunk stored for the slot."""
+    paginator = s3_client.get_paginator('list_objects_v2')
+    pages = paginator.paginate(
+        Bucket=bucket_name,
+        Prefix=chunks_prefix,
+    )
+
+    stored_chunks = set()
+    for page in pages:
+        for s3_object in page.get('Contents', []):
+            stored_chunks.add(s3_object['Key'][len(chunks_prefix):])
+
+    return stored_chunks
+
+
+def delete_chunks(bucket_name: str, chunks_prefix: str, chunks: List[str]) -> None:
+    for start in range(0, len(chunks), MAX_DELETE_OBJECTS_KEYS):
+        s3_client.delete_objects(
+            Bucket=bucket_name,
+            Delete={
+                'Objects': [{'Key': chunks_prefix + chunk} for chunk in chunks[start:start + MAX_DELETE_OBJECTS_KEYS]],
+                'Quiet': True
+            }
+        )
+
+
+def generate_presigned_url(client_method: str, bucket_name: str, key: str, time_to_live: int, content_length: Optional[int]) -> str:
+    params = {
+        'Bucket': bucket_name,
+        'Key': key,
+    }
+    # The Content-Length header is signed, so S3 rejects an upload of any other size
+    if content_length is not None:
+        params['ContentLength'] = content_length
+
+    return s3_client.generate_presigned_url(
+        ClientMethod=client_method,
+        Params=params,
+        ExpiresIn=time_to_live,
+    )
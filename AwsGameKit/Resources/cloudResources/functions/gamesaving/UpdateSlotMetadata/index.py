@@ -42,8 +42,13 @@ def lambda_handler(event, context):
         object_info = record['s3']['object']
         object_key = urllib.parse.unquote_plus(object_info['key'], encoding=UTF_8)
 
-        player_id = object_key.split('/')[0]
-        slot_name = object_key.split('/')[1]
+        # Delta mode chunks are stored under '{player_id}/{slot_name}/chunks/', they aren't save slots:
+        key_parts = object_key.split('/')
+        if len(key_parts) != 2:
+            continue
+
+        player_id = key_parts[0]
+        slot_name = key_parts[1]
 
         # Get S3 object:
         s3_save_file = get_s3_save_file(object_key, player_id, slot_name)
@@ -12,8 +12,10 @@ import boto3
 import botocore
 import os
 import logging
+import hashlib
 import json
 import time
+from collections import OrderedDict
 from jose import jwk, jwt
 from jose.utils import base64url_decode
 
@@ -21,10 +23,38 @@ logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 secrets_manager_client = boto3.client('secretsmanager')
 
+# Warm invocations reuse the JWKS read from Secrets Manager, where the JwksRefresh function stores it, for this long.
+DEFAULT_JWKS_CACHE_TTL_SECONDS = 300
+# A token signed with a key missing from the cached JWKS triggers an early reload, at most this often.
+MIN_JWKS_RELOAD_INTERVAL_SECONDS = 30
+# Largest number of verified tokens remembered by a warm invocation.
+MAX_VERIFIED_TOKENS = 1024
+
+# VersionStage -> {'expires_at', 'loaded_at', 'secret_string', 'keys': kid -> JWK dict, 'public_keys': kid -> constructed key}
+_jwks_cache = {}
+# (VersionStage, sha256 of the token) -> claims, least recently used first
+_verified_tokens = OrderedDict()
+
+
+def clear_cache():
+    """
+    Forget the cached JWKS and verified tokens.
+    """
+    _jwks_cache.clear()
+    _verified_tokens.clear()
+
+
+def get_jwks_cache_ttl_seconds():
+    try:
+        return max(0, int(os.environ.get('JWKS_CACHE_TTL_SECONDS', DEFAULT_JWKS_CACHE_TTL_SECONDS)))
+    except ValueError:
+        return DEFAULT_JWKS_CACHE_TTL_SECONDS
 
-def verify(token, stage, verify_expiration=True):
-    secret_name = os.environ.get('JWKS_SECRET_NAME')
 
+def load_jwks(stage, secret_name):
+    """
+    Read the JWKS stored under the given VersionStage and cache it. Returns None if it couldn't be read.
+    """
     try:
         response = secrets_manager_client.get_secret_value(
             SecretId=secret_name,
@@ -32,48 +62,105 @@ def verify(token, stage, verify_expiration=True):
         )
     except botocore.exceptions.ClientError as err:
         logger.error(f"Error getting secret {secret_name}. Error: {err}")
-        return None, False
+        return None
+
+    now = time.time()
+    cached = _jwks_cache.get(stage)
+    if cached is not None and cached['secret_string'] == response['SecretString']:
+        # Unchanged, keep the constructed public keys
+        cached['expires_at'] = now + get_jwks_cache_ttl_seconds()
+        cached['loaded_at'] = now
+        return cached
 
     jwks = json.loads(response['SecretString'])
-    keys = jwks['keys']
+    cached = {
+        'expires_at': now + get_jwks_cache_ttl_seconds(),
+        'loaded_at': now,
+        'secret_string': response['SecretString'],
+        'keys': {key['kid']: key for key in jwks['keys']},
+        'public_keys': {}
+    }
+    _jwks_cache[stage] = cached
 
-    # get the kid from the headers prior to verification
-    headers = jwt.get_unverified_headers(token)
-    kid = headers['kid']
+    # Tokens verified with the previous keys may have been signed by a key which was since revoked
+    for token_key in [token_key for token_key in _verified_tokens if token_key[0] == stage]:
+        del _verified_tokens[token_key]
 
-    # search for the kid in the stored public keys
-    key_index = -1
-    for i in range(len(keys)):
-        if kid == keys[i]['kid']:
-            key_index = i
-            break
+    return cached
+
+
+def get_jwks(stage, secret_name, kid):
+    """
+    Get the cached JWKS of the given VersionStage, reloading it once it's expired or when it doesn't have the token's key.
+    """
+    jwks = _jwks_cache.get(stage)
+    now = time.time()
+    if jwks is None or now >= jwks['expires_at']:
+        return load_jwks(stage, secret_name)
+
+    if kid not in jwks['keys'] and now - jwks['loaded_at'] >= MIN_JWKS_RELOAD_INTERVAL_SECONDS:
+        # The identity provider may have rotated its keys since the JWKS was cached
+        return load_jwks(stage, secret_name)
+
+    return jwks
 
-    if key_index == -1:
-        logger.error(f"Public key not found in {secret_name} for {kid}")
-        return None, False
 
-    # construct the public key
-    public_key = jwk.construct(keys[key_index])
+def remember_verified_token(token_key, claims):
+    _verified_tokens[token_key] = claims
+    _verified_tokens.move_to_end(token_key)
+    while len(_verified_tokens) > MAX_VERIFIED_TOKENS:
+        _verified_tokens.popitem(last=False)
 
-    # get the last two sections of the token,
-    # message and signature (encoded in base64)
-    message, encoded_signature = str(token).rsplit('.', 1)
 
-    # decode the signature
-    decoded_signature = base64url_decode(encoded_signature.encode('utf-8'))
+def verify(token, stage, verify_expiration=True):
+    secret_name = os.environ.get('JWKS_SECRET_NAME')
+
+    # get the kid from the headers prior to verification
+    headers = jwt.get_unverified_headers(token)
+    kid = headers['kid']
 
-    # verify the signature
-    if not public_key.verify(message.encode("utf8"), decoded_signature):
-        logger.error('Signature verification failed')
+    jwks = get_jwks(stage, secret_name, kid)
+    if jwks is None:
         return None, False
 
-    # since we passed the verification, we can now safely
-    # use the unverified claims
-    claims = jwt.get_unverified_claims(token)
+    token_key = (stage, hashlib.sha256(str(token).encode('utf-8')).hexdigest())
+    claims = _verified_tokens.get(token_key)
+    if claims is None:
+        # search for the kid in the stored public keys
+        key = jwks['keys'].get(kid)
+        if key is None:
+            logger.error(f"Public key not found in {secret_name} for {kid}")
+            return None, False
+
+        # construct the public key
+        public_key = jwks['public_keys'].get(kid)
+        if public_key is None:
+            public_key = jwk.construct(key)
+            jwks['public_keys'][kid] = public_key
+
+        # get the last two sections of the token,
+        # message and signature (encoded in base64)
+        message, encoded_signature = str(token).rsplit('.', 1)
+
+        # decode the signature
+        decoded_signature = base64url_decode(encoded_signature.encode('utf-8'))
+
+        # verify the signature
+        if not public_key.verify(message.encode("utf8"), decoded_signature):
+            logger.error('Signature verification failed')
+            return None, False
+
+        # since we passed the verification, we can now safely
+        # use the unverified claims
+        claims = jwt.get_unverified_claims(token)
+        remember_verified_token(token_key, claims)
+    else:
+        _verified_tokens.move_to_end(token_key)
 
     # additionally, we can verify the token expiration
     if time.time() > claims['exp'] and verify_expiration:
         logger.error('Token is expired')
+        _verified_tokens.pop(token_key, None)
         return None, False
 
     return claims, True
@@ -11,9 +11,52 @@ import botocore
 import boto3
 from gamekithelpers import handler_request, handler_response
 import os
+import time
 
 s3_client = boto3.client('s3')
 
+# Longest time a request may be held open waiting for the completion object.
+# Kept below the function's 25 second timeout and API Gateway's 29 second integration timeout.
+MAX_WAIT_SECONDS = 20
+INITIAL_RECHECK_SECONDS = 0.25
+MAX_RECHECK_SECONDS = 2.0
+# Time left for the response when the function's remaining time is what limits the wait
+RESPONSE_MARGIN_SECONDS = 1.0
+
+
+def get_wait_seconds(body, context):
+    """
+    Get how long to wait for the completion object, from the optional 'wait_seconds' field of the request body.
+
+    Returns None if the field is malformed. Zero, the default, checks for the completion object once.
+    """
+    wait_seconds = body.get('wait_seconds', 0)
+    if isinstance(wait_seconds, bool) or not isinstance(wait_seconds, (int, float)) or wait_seconds < 0:
+        return None
+
+    wait_seconds = min(wait_seconds, MAX_WAIT_SECONDS)
+    if context is not None:
+        wait_seconds = min(wait_seconds, max(0.0, context.get_remaining_time_in_millis() / 1000 - RESPONSE_MARGIN_SECONDS))
+    return wait_seconds
+
+
+def get_completion_object(request_id, wait_seconds):
+    """
+    Get the completion object, rechecking with a growing interval while it doesn't exist yet and wait_seconds haven't passed.
+    """
+    deadline = time.monotonic() + wait_seconds
+    recheck_seconds = INITIAL_RECHECK_SECONDS
+    while True:
+        try:
+            return s3_client.get_object(Bucket=os.environ.get('BOOTSTRAP_BUCKET'), Key='cb_completions/' + request_id)
+        except botocore.exceptions.ClientError as err:
+            err_code = err.__dict__['response']['ResponseMetadata']['HTTPStatusCode']
+            remaining_seconds = deadline - time.monotonic()
+            if err_code != 404 or remaining_seconds <= 0:
+                raise
+            time.sleep(min(recheck_seconds, remaining_seconds))
+            recheck_seconds = min(recheck_seconds * 2, MAX_RECHECK_SECONDS)
+
 
 def lambda_handler(event, context):
     """
@@ -28,9 +71,13 @@ def lambda_handler(event, context):
     if request_id is None or not handler_request.is_valid_uuidv4(request_id):
         return handler_response.invalid_request()
 
+    wait_seconds = get_wait_seconds(body, context)
+    if wait_seconds is None:
+        return handler_response.invalid_request()
+
     try:
-        # Get completion object
-        response = s3_client.get_object(Bucket=os.environ.get('BOOTSTRAP_BUCKET'), Key='cb_completions/' + request_id)
+        # Get completion object, holding the request until it appears when the client asked for a long poll
+        response = get_completion_object(request_id, wait_seconds)
         encrypted_key_location = response['Body'].read().decode('utf-8')
 
         # Rewrite completion object to indicate it's been retrieved.
@@ -0,0 +1,119 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import logging
+
+import boto3
+from botocore.exceptions import ClientError
+from gamekitresourcemanagement.cfn_custom_resource import RequestType, send_success_response, send_failure_response
+
+CUSTOM_RESOURCE_TYPE = 'api-cache-settings'
+
+apigateway_client = boto3.client('apigateway')
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+
+def _method_setting_path(method_setting) -> str:
+    # In the patch paths of stage method settings, the slashes of the resource path are escaped as ~1
+    resource_path = method_setting['resource_path'].replace('/', '~1')
+    return f'/{resource_path}/{method_setting["http_method"]}'
+
+
+def _is_throttling_setting(method_setting) -> bool:
+    return 'throttling_rate_limit' in method_setting
+
+
+def _get_patch_operations(method_settings, old_method_settings):
+    """
+    Creates the UpdateStage patch operations which apply method_settings, and revert the methods of old_method_settings
+    which aren't in method_settings anymore: caching is disabled, and throttling returns to the stage's default.
+    """
+    operations = []
+    paths = set()
+    for method_setting in method_settings:
+        path = _method_setting_path(method_setting)
+        paths.add(path)
+        if _is_throttling_setting(method_setting):
+            operations.append({'op': 'replace', 'path': f'{path}/throttling/rateLimit', 'value': str(method_setting['throttling_rate_limit'])})
+            operations.append({'op': 'replace', 'path': f'{path}/throttling/burstLimit', 'value': str(method_setting['throttling_burst_limit'])})
+        else:
+            operations.append({'op': 'replace', 'path': f'{path}/caching/enabled', 'value': 'true'})
+            operations.append({'op': 'replace', 'path': f'{path}/caching/ttlInSeconds', 'value': str(method_setting['ttl_seconds'])})
+
+    for method_setting in old_method_settings:
+        path = _method_setting_path(method_setting)
+        if path in paths:
+            continue
+        if _is_throttling_setting(method_setting):
+            # Throttling settings are only created for throttled methods, removing them restores the stage's default
+            operations.append({'op': 'remove', 'path': path})
+        else:
+            operations.append({'op': 'replace', 'path': f'{path}/caching/enabled', 'value': 'false'})
+
+    return operations
+
+
+def lambda_handler(event, context):
+    """
+    Enables API Gateway caching or throttling for the given methods of a stage, and reverts it when the custom resource is
+    deleted.
+
+    The stage cache cluster is created by the main stack. Pair this function with a custom CloudFormation resource in a
+    feature stack to cache the responses of the feature's read-mostly methods, or to cap the calls of its write methods.
+    The cache keys of a method are set by the CacheKeyParameters of its integration. Throttled calls are answered with 429
+    by API Gateway, before they reach the feature's Lambda functions.
+
+    Parameters:
+        event:
+            The custom resource lambda request. CloudFormation provides most parameters. See the full request here:
+            https://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/crpg-ref-requests.html#crpg-ref-request-fields.
+
+            ResourceProperties:
+                Contains user defined properties. Passed in by the Properties object of the custom CloudFormation
+                resource which calls this lambda function.
+
+                rest_api_id: str
+                    The id of the REST API.
+                stage_name: str
+                    The name of the stage.
+                method_settings: list
+                    The methods to cache, each with resource_path (for example /achievements), http_method and
+                    ttl_seconds, or to throttle, each with resource_path, http_method, throttling_rate_limit (requests
+                    per second) and throttling_burst_limit.
+        context:
+            The lambda context. See the list of methods and properties here:
+            https://docs.aws.amazon.com/lambda/latest/dg/python-context.html
+    """
+    logger.info(event)
+    request_type: str = event['RequestType']
+    properties = event['ResourceProperties']
+    rest_api_id: str = properties['rest_api_id']
+    stage_name: str = properties['stage_name']
+
+    if request_type == RequestType.DELETE:
+        method_settings = []
+        old_method_settings = properties.get('method_settings', [])
+    else:
+        method_settings = properties.get('method_settings', [])
+        old_method_settings = event.get('OldResourceProperties', {}).get('method_settings', [])
+
+    patch_operations = _get_patch_operations(method_settings, old_method_settings)
+    if len(patch_operations) == 0:
+        send_success_response(event, CUSTOM_RESOURCE_TYPE)
+        return
+
+    try:
+        apigateway_client.update_stage(restApiId=rest_api_id, stageName=stage_name, patchOperations=patch_operations)
+        logger.info(f'Updated the method settings of stage {stage_name} of API {rest_api_id}')
+    except ClientError as e:
+        reason = f'{e.response["Error"]["Code"]} - {e.response["Error"]["Message"]}'
+        logger.error(f'Failed to update the method settings of stage {stage_name} of API {rest_api_id}: {reason}')
+        # The API or the stage may already be gone when the feature is deleted
+        if request_type == RequestType.DELETE and e.response['Error']['Code'] == 'NotFoundException':
+            send_success_response(event, CUSTOM_RESOURCE_TYPE)
+            return
+        send_failure_response(event, CUSTOM_RESOURCE_TYPE, reason)
+        return
+
+    send_success_response(event, CUSTOM_RESOURCE_TYPE)
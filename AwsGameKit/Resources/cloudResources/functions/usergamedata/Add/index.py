@@ -3,21 +3,46 @@
 
 """
 Lambda function for adding bundles and bundle items.
+
+A call with an Idempotency-Key header is applied once, see gamekithelpers.idempotency. A retry with the same key can't
+overwrite newer values of the items.
 """
 
 import boto3
 import botocore
+from concurrent.futures import ThreadPoolExecutor
 from datetime import timezone, datetime
 import os
+import random
 import sys
 import logging
+import time
 sys.path.append(os.path.join(os.path.dirname(__file__)))
-from gamekithelpers import handler_response, handler_request, user_game_play_constants, sanitizer
+from gamekithelpers import handler_response, handler_request, idempotency, user_game_play_constants, sanitizer, throttle
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_client = boto3.client('dynamodb')
+player_rate_limiter = throttle.get_player_rate_limiter()
+idempotency_store = idempotency.get_idempotency_store()
+
+# Maximum number of item chunks written at the same time
+MAX_PARALLEL_WRITES = 10
+
+# Throttled writes are retried with full jitter backoff, for at most MAX_WRITE_ATTEMPTS attempts
+# and only while more than RETRY_TIME_MARGIN_MS of the Lambda time budget is left
+MAX_WRITE_ATTEMPTS = 5
+RETRY_BASE_DELAY_SECONDS = 0.05
+RETRY_MAX_DELAY_SECONDS = 1.0
+RETRY_TIME_MARGIN_MS = 2000
+
+RETRYABLE_ERROR_CODES = {
+    'ProvisionedThroughputExceededException',
+    'ThrottlingException',
+    'RequestLimitExceeded',
+    'InternalServerError'
+}
 
 
 def _build_bundle_update_request(player_id, bundle_name):
@@ -63,6 +88,59 @@ def _build_bundleitems_update_request(player_id, bundle_name, bundle_item_key, b
     }
 
 
+def _is_retryable(err):
+    """
+    Whether a failed write may succeed if it is sent again.
+    """
+    response = getattr(err, 'response', None) or {}
+    return response.get('Error', {}).get('Code') in RETRYABLE_ERROR_CODES
+
+
+def _has_time_to_retry(context, delay):
+    """
+    Whether the Lambda time budget leaves room for another attempt after the delay.
+    """
+    if context is None:
+        return True
+    return context.get_remaining_time_in_millis() - delay * 1000 > RETRY_TIME_MARGIN_MS
+
+
+def _write_bundle_item(player_id, bundle_name, bundle_item_key, bundle_item_value, context):
+    """
+    Write one bundle item, retrying throttled writes. Returns False if the item wasn't written.
+    """
+    sanitized_bundle_item_key = sanitizer.sanitize(bundle_item_key)
+    sanitized_bundle_item_value = sanitizer.sanitize(bundle_item_value)
+
+    for attempt in range(MAX_WRITE_ATTEMPTS):
+        try:
+            ddb_client.update_item(**_build_bundleitems_update_request(player_id,
+                                                                       bundle_name,
+                                                                       sanitized_bundle_item_key,
+                                                                       sanitized_bundle_item_value))
+            return True
+
+        except botocore.exceptions.ClientError as err:
+            delay = random.uniform(0, min(RETRY_MAX_DELAY_SECONDS, RETRY_BASE_DELAY_SECONDS * 2 ** attempt))
+            if attempt + 1 == MAX_WRITE_ATTEMPTS or not _is_retryable(err) or not _has_time_to_retry(context, delay):
+                logger.error(f'Failed to update bundle item {bundle_item_key}: {err}')
+                return False
+
+            logger.warning(f'Throttled updating bundle item {bundle_item_key}, retrying in {delay:.3f} seconds: {err}')
+            time.sleep(delay)
+
+    return False
+
+
+def _write_bundle_items_chunk(player_id, bundle_name, chunk, context):
+    """
+    Write a chunk of bundle items one after the other. Returns the items which weren't written.
+    """
+    return [{'bundle_item_key': bundle_item_key, 'bundle_item_value': bundle_item_value}
+            for bundle_item_key, bundle_item_value in chunk
+            if not _write_bundle_item(player_id, bundle_name, bundle_item_key, bundle_item_value, context)]
+
+
 def lambda_handler(event, context):
     """
     Entry point for the Add Lambda function.
@@ -74,6 +152,21 @@ def lambda_handler(event, context):
     if player_id is None:
         return handler_response.return_response(401, 'Unauthorized')
 
+    retry_after = player_rate_limiter.try_acquire(player_id)
+    if retry_after > 0:
+        return handler_response.too_many_requests(retry_after)
+
+    return idempotency_store.run(event, player_id, lambda: _add_bundle(event, context, player_id), _is_retryable_response)
+
+
+def _is_retryable_response(response):
+    """
+    Whether the call failed writing the bundle, in which case none of its items were written and it may be retried.
+    """
+    return response['statusCode'] >= 500 or response['statusCode'] == 422
+
+
+def _add_bundle(event, context, player_id):
     # get payload from body (list of bundles in the form key=value)
     bundle = handler_request.get_body_as_json(event)
     if bundle is None:
@@ -114,21 +207,14 @@ def lambda_handler(event, context):
         # add bundle
         ddb_client.update_item(**_build_bundle_update_request(player_id, bundle_name))
 
-        # add items
-        for bundle_item_key, bundle_item_value in bundle_data:
-
-            sanitized_bundle_item_key = sanitizer.sanitize(bundle_item_key)
-            sanitized_bundle_item_value = sanitizer.sanitize(bundle_item_value)
+        # add items, in chunks written in parallel, the boto3 client is thread safe
+        items = list(bundle_data)
+        chunks = [items[i:i + user_game_play_constants.DYNAMO_MAX_ITEM_WRITES]
+                  for i in range(0, len(items), user_game_play_constants.DYNAMO_MAX_ITEM_WRITES)]
 
-            try:
-                ddb_client.update_item(**_build_bundleitems_update_request(player_id,
-                                                                           bundle_name,
-                                                                           sanitized_bundle_item_key,
-                                                                           sanitized_bundle_item_value))
-
-            except botocore.exceptions.ClientError as err:
-                logger.error(f'Failed to update bundle item {bundle_item_key}: {err}')
-                unprocessed_items_array.append({'bundle_item_key': bundle_item_key, 'bundle_item_value': bundle_item_value})
+        with ThreadPoolExecutor(max_workers=min(len(chunks), MAX_PARALLEL_WRITES)) as executor:
+            for chunk_unprocessed_items in executor.map(lambda chunk: _write_bundle_items_chunk(player_id, bundle_name, chunk, context), chunks):
+                unprocessed_items_array.extend(chunk_unprocessed_items)
 
     except botocore.exceptions.ClientError as err:
         logger.error(f'Failed to update bundle {bundle_name}: {err}')
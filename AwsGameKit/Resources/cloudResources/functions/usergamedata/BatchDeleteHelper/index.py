@@ -10,21 +10,53 @@ https://docs.aws.amazon.com/lambda/latest/dg/configuration-concurrency.html
 import boto3
 import botocore
 import logging
+import random
+import time
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_resource = boto3.resource('dynamodb')
 
+# Unprocessed delete requests are sent again with full jitter backoff, for at most MAX_WRITE_ATTEMPTS attempts
+# and only while more than RETRY_TIME_MARGIN_MS of the Lambda time budget is left
+MAX_WRITE_ATTEMPTS = 5
+RETRY_BASE_DELAY_SECONDS = 0.05
+RETRY_MAX_DELAY_SECONDS = 1.0
+RETRY_TIME_MARGIN_MS = 1000
+
+
+def _has_time_to_retry(context, delay):
+    """
+    Whether the Lambda time budget leaves room for another attempt after the delay.
+    """
+    if context is None:
+        return True
+    return context.get_remaining_time_in_millis() - delay * 1000 > RETRY_TIME_MARGIN_MS
+
 
 def lambda_handler(event, context):
-    params = {
-        'RequestItems': {
-            event['TableName']: event['DeleteRequest']
-        }
-    }
-    try:
-        ddb_resource.batch_write_item(**params)
-    except botocore.exceptions.ClientError as err:
-        logger.error(f"Error calling batch_write_item. Error: {err}")
-        raise err
+    table_name = event['TableName']
+    delete_requests = event['DeleteRequest']
+
+    for attempt in range(MAX_WRITE_ATTEMPTS):
+        try:
+            response = ddb_resource.batch_write_item(RequestItems={table_name: delete_requests})
+        except botocore.exceptions.ClientError as err:
+            logger.error(f"Error calling batch_write_item. Error: {err}")
+            raise err
+
+        delete_requests = response.get('UnprocessedItems', {}).get(table_name, [])
+        if not delete_requests:
+            return
+
+        delay = random.uniform(0, min(RETRY_MAX_DELAY_SECONDS, RETRY_BASE_DELAY_SECONDS * 2 ** attempt))
+        if attempt + 1 == MAX_WRITE_ATTEMPTS or not _has_time_to_retry(context, delay):
+            break
+
+        logger.warning(f"{len(delete_requests)} delete requests unprocessed, retrying in {delay:.3f} seconds")
+        time.sleep(delay)
+
+    # Failing the invocation makes Lambda retry the whole event, deleting items is idempotent
+    logger.error(f"{len(delete_requests)} delete requests unprocessed after {MAX_WRITE_ATTEMPTS} attempts")
+    raise RuntimeError(f"{len(delete_requests)} delete requests unprocessed in table {table_name}")
@@ -8,6 +8,7 @@ Lambda function for deleting all user gameplay data for the calling user.
 import boto3
 import botocore
 from boto3.dynamodb.conditions import Key
+from concurrent.futures import ThreadPoolExecutor
 import os
 import sys
 import logging
@@ -22,6 +23,9 @@ logger.setLevel(logging.INFO)
 ddb_resource = boto3.resource('dynamodb')
 lambda_client = boto3.client('lambda')
 
+# Maximum number of bundles whose items are queried and handed to the BatchDeleteHelper Lambda at the same time
+MAX_PARALLEL_BUNDLES = 10
+
 
 def _batch_delete_lambda_helper(table_name, delete_requests):
     """
@@ -65,44 +69,56 @@ def _batch_delete_bundles(bundles):
         _batch_delete_lambda_helper(os.environ['BUNDLES_TABLE_NAME'], delete_requests)
 
 
-def _batch_delete_bundle_items(bundles):
+def _batch_delete_player_bundle_items(bundle):
     """
-    Queries bundle items table and sends delete request to the BatchDeleteHelper Lambda in increments of 25 or less
+    Queries the items of one bundle page by page and sends delete requests to the BatchDeleteHelper Lambda in increments of 25 or less
     """
+    player_id_bundle = bundle['player_id'] + '_' + bundle['bundle_name']
     delete_requests = []
 
-    for bundle in bundles:
-        query_response = _get_player_bundle_items_request(bundle['player_id'] + '_' + bundle['bundle_name'])
-        bundle_items = query_response['Items']
-
-        while bundle_items:
-            for bundle_item in bundle_items:
-                delete_requests.append({
-                    'DeleteRequest': {
-                        'Key': {
-                            'player_id_bundle': bundle_item['player_id_bundle'],
-                            'bundle_item_key': bundle_item['bundle_item_key']
-                        }
+    query_response = _get_player_bundle_items_request(player_id_bundle)
+    while True:
+        for bundle_item in query_response['Items']:
+            delete_requests.append({
+                'DeleteRequest': {
+                    'Key': {
+                        'player_id_bundle': bundle_item['player_id_bundle'],
+                        'bundle_item_key': bundle_item['bundle_item_key']
                     }
-                })
+                }
+            })
 
-                if len(delete_requests) == user_game_play_constants.DYNAMO_MAX_ITEM_WRITES:
-                    _batch_delete_lambda_helper(os.environ['BUNDLE_ITEMS_TABLE_NAME'], delete_requests)
-                    delete_requests = []
+            if len(delete_requests) == user_game_play_constants.DYNAMO_MAX_ITEM_WRITES:
+                _batch_delete_lambda_helper(os.environ['BUNDLE_ITEMS_TABLE_NAME'], delete_requests)
+                delete_requests = []
 
-            if 'LastEvaluatedKey' in query_response:
-                bundle_items = _get_player_bundle_items_request(bundle['player_id'] + '_' + bundle['bundle_name'],
-                                                                query_response['LastEvaluatedKey'])
-            else:
-                bundle_items = []
+        if 'LastEvaluatedKey' not in query_response:
+            break
+        query_response = _get_player_bundle_items_request(player_id_bundle, query_response['LastEvaluatedKey'])
 
     if len(delete_requests) > 0:
         _batch_delete_lambda_helper(os.environ['BUNDLE_ITEMS_TABLE_NAME'], delete_requests)
 
 
+def _batch_delete_bundle_items(bundles):
+    """
+    Sends the delete requests of every bundle item to the BatchDeleteHelper Lambda, working on several bundles at the same time
+    The boto3 clients are thread safe
+    """
+    # A query page can be empty, and ThreadPoolExecutor needs at least one worker
+    if not bundles:
+        return
+
+    with ThreadPoolExecutor(max_workers=min(len(bundles), MAX_PARALLEL_BUNDLES)) as executor:
+        # Consuming the results raises the first error of a worker
+        list(executor.map(_batch_delete_player_bundle_items, bundles))
+
+
 def _delete_all_user_gameplay_data(bundles):
     """
     Deletes the bundles associated with the player, first from the bundle items table and then from the bundles table
+    The deletes are only enqueued, a client which wants to wait for their completion can poll ListBundles and GetBundle until they
+    return no data
     """
     _batch_delete_bundle_items(bundles)
     _batch_delete_bundles(bundles)
@@ -12,8 +12,11 @@ import boto3
 import botocore
 import logging
 from boto3.dynamodb.conditions import Key
+from concurrent.futures import ThreadPoolExecutor
 import os
+import random
 import sys
+import time
 import urllib.parse
 
 sys.path.append(os.path.join(os.path.dirname(__file__)))
@@ -24,6 +27,16 @@ logger.setLevel(logging.INFO)
 
 ddb_resource = boto3.resource('dynamodb')
 
+# Maximum number of batch_write_item chunks deleted at the same time
+MAX_PARALLEL_DELETES = 10
+
+# Unprocessed delete requests are sent again with full jitter backoff, for at most MAX_WRITE_ATTEMPTS attempts
+# and only while more than RETRY_TIME_MARGIN_MS of the Lambda time budget is left
+MAX_WRITE_ATTEMPTS = 5
+RETRY_BASE_DELAY_SECONDS = 0.05
+RETRY_MAX_DELAY_SECONDS = 1.0
+RETRY_TIME_MARGIN_MS = 2000
+
 
 def _batch_delete_bundle_write_params(bundle_items):
     """
@@ -81,11 +94,76 @@ def _get_player_bundle_items_request(player_id_bundle):
     return queryResponse['Items']
 
 
+def _get_all_player_bundle_items_request(player_id_bundle):
+    """
+    Gets every item of the bundle, following the query pages
+    """
+    table = ddb_resource.Table(os.environ['BUNDLE_ITEMS_TABLE_NAME'])
+
+    query_params = {'KeyConditionExpression': Key('player_id_bundle').eq(player_id_bundle)}
+    query_response = table.query(**query_params)
+    bundle_items = list(query_response['Items'])
+
+    while 'LastEvaluatedKey' in query_response:
+        query_response = table.query(ExclusiveStartKey=query_response['LastEvaluatedKey'], **query_params)
+        bundle_items.extend(query_response['Items'])
+
+    return bundle_items
+
+
 def prepare_for_batching(item_list):
     for i in range(0, len(item_list), user_game_play_constants.DYNAMO_MAX_ITEM_WRITES):
         yield item_list[i:i + user_game_play_constants.DYNAMO_MAX_ITEM_WRITES]
 
 
+def _has_time_to_retry(context, delay):
+    """
+    Whether the Lambda time budget leaves room for another attempt after the delay.
+    """
+    if context is None:
+        return True
+    return context.get_remaining_time_in_millis() - delay * 1000 > RETRY_TIME_MARGIN_MS
+
+
+def _batch_delete(params, context):
+    """
+    Calls batch_write_item, sending the unprocessed delete requests again
+    """
+    for attempt in range(MAX_WRITE_ATTEMPTS):
+        try:
+            response = ddb_resource.batch_write_item(**params)
+        except botocore.exceptions.ClientError as err:
+            logger.error(f"Error deleting player bundle items. Error: {err}")
+            raise err
+
+        unprocessed_items = response.get('UnprocessedItems')
+        if not unprocessed_items:
+            return
+
+        delay = random.uniform(0, min(RETRY_MAX_DELAY_SECONDS, RETRY_BASE_DELAY_SECONDS * 2 ** attempt))
+        if attempt + 1 == MAX_WRITE_ATTEMPTS or not _has_time_to_retry(context, delay):
+            break
+
+        logger.warning(f"Delete requests unprocessed, retrying in {delay:.3f} seconds")
+        time.sleep(delay)
+        params = {'RequestItems': unprocessed_items}
+
+    raise RuntimeError("Player bundle items delete requests unprocessed")
+
+
+def _batch_delete_chunks(chunks, build_params, context):
+    """
+    Deletes the chunks of bundle items in parallel, the boto3 clients are thread safe
+    """
+    chunks = list(chunks)
+    if not chunks:
+        return
+
+    with ThreadPoolExecutor(max_workers=min(len(chunks), MAX_PARALLEL_DELETES)) as executor:
+        # Consuming the results raises the first error of a worker
+        list(executor.map(lambda chunk: _batch_delete(build_params(chunk), context), chunks))
+
+
 def _invalid_request():
     return handler_response.return_response(400, 'Invalid Request')
 
@@ -120,7 +198,7 @@ def lambda_handler(event, context):
 
     if querystring_payload is None:  # If querystring 'payload' argument is None we are deleting the entire bundle
         try:
-            bundle_items = _get_player_bundle_items_request(player_id + "_" + bundle_name)
+            bundle_items = _get_all_player_bundle_items_request(player_id + "_" + bundle_name)
         except botocore.exceptions.ClientError as err:
             logger.error(f"Error retrieving bundles. Error: {err}")
             raise err
@@ -128,28 +206,16 @@ def lambda_handler(event, context):
         if not bundle_items:
             return handler_response.return_response(204, 'User does not have the requested bundle.')
 
-        bundle_item_chunks = prepare_for_batching(list(bundle_items))
-        for chunk in bundle_item_chunks:
-            try:
-                params = _batch_delete_bundle_write_params(chunk)
-                ddb_resource.batch_write_item(**params)
-            except botocore.exceptions.ClientError as err:
-                logger.error(f"Error deleting player bundle items. Error: {err}")
-                raise err
+        _batch_delete_chunks(prepare_for_batching(bundle_items), _batch_delete_bundle_write_params, context)
     else:
         bundle_item_keys = json.loads(querystring_payload).get('bundle_item_keys') if querystring_payload else None
 
         if bundle_item_keys is None or len(bundle_item_keys) == 0:
             return _invalid_request()
 
-        bundle_key_chunks = prepare_for_batching(list(bundle_item_keys))
-        for chunk in bundle_key_chunks:
-            try:
-                params = _batch_delete_bundle_items_write_params(player_id + '_' + bundle_name, chunk)
-                ddb_resource.batch_write_item(**params)
-            except botocore.exceptions.ClientError as err:
-                logger.error(f"Error deleting player bundle items. Error: {err}")
-                raise err
+        _batch_delete_chunks(prepare_for_batching(list(bundle_item_keys)),
+                             lambda chunk: _batch_delete_bundle_items_write_params(player_id + '_' + bundle_name, chunk),
+                             context)
 
     # If the entire bundle is deleted the bundle reference for the player is also deleted from the bundle table
     if (querystring_payload is None) or (not _get_player_bundle_items_request(player_id + "_" + bundle_name)):
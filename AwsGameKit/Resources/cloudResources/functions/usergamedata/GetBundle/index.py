@@ -13,13 +13,14 @@ import sys
 import logging
 
 sys.path.append(os.path.join(os.path.dirname(__file__)))
-from gamekithelpers import handler_response, handler_request
+from gamekithelpers import handler_response, handler_request, ddb
 from gamekithelpers.pagination import validate_pagination_token
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_client = boto3.client('dynamodb')
+read_cache = ddb.get_read_cache()
 
 
 def _build_bundle_get_request(player_id, bundle_name, consistent_read, limit, start_bundle_id, start_item_key):
@@ -93,9 +94,8 @@ def lambda_handler(event, context):
     # get the bundle
     try:
         deserializer = TypeDeserializer()
-        result = ddb_client.query(
-            **_build_bundle_get_request(player_id, bundle_name, consistent_read, limit, start_bundle_id,
-                                        start_item_key))
+        request = _build_bundle_get_request(player_id, bundle_name, consistent_read, limit, start_bundle_id, start_item_key)
+        result = read_cache.read(request, lambda: ddb_client.query(**request))
 
         # add the pagination key, if present
         last_evaluated_key = result.get('LastEvaluatedKey')
@@ -117,7 +117,7 @@ def lambda_handler(event, context):
     # Return operation result
     if 'next_start_key' in items_response:
         # There are more items to get
-        return handler_response.response_envelope(200, None, {'bundle_items': bundle_items}, items_response['next_start_key'], player_id)
+        return handler_response.response_envelope(200, None, {'bundle_items': bundle_items}, items_response['next_start_key'], player_id, event)
 
     # No more items to get
-    return handler_response.response_envelope(200, None, {'bundle_items': bundle_items})
+    return handler_response.response_envelope(200, None, {'bundle_items': bundle_items}, event=event)
@@ -0,0 +1,128 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Lambda function for retrieving several bundles and their bundle items in one request.
+"""
+
+import boto3
+from boto3.dynamodb.types import TypeDeserializer
+import botocore
+from concurrent.futures import ThreadPoolExecutor
+import os
+import sys
+import logging
+
+sys.path.append(os.path.join(os.path.dirname(__file__)))
+from gamekithelpers import handler_response, handler_request, user_game_play_constants
+from gamekithelpers.validation import is_valid_primary_identifier
+
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+ddb_client = boto3.client('dynamodb')
+
+# Maximum number of bundles which can be requested at once
+MAX_BUNDLES = 25
+
+# Maximum number of bundles queried at the same time
+MAX_PARALLEL_QUERIES = 10
+
+
+def _build_bundle_items_query_request(player_id, bundle_name, consistent_read, start_key):
+    """
+    Build the query request for one page of a bundle's items.
+    """
+    player_id_bundle = f'{player_id}_{bundle_name}'
+
+    request = {
+        'TableName': os.environ['BUNDLE_ITEMS_TABLE_NAME'],
+        'KeyConditionExpression': '#player_id_bundle = :player_id_bundle',
+        'ProjectionExpression': '#bundle_item_key, #bundle_item_value',
+        'ExpressionAttributeNames': {
+            '#player_id_bundle': 'player_id_bundle',
+            '#bundle_item_key': 'bundle_item_key',
+            '#bundle_item_value': 'bundle_item_value'
+        },
+        'ExpressionAttributeValues': {
+            ':player_id_bundle': {'S': player_id_bundle}
+        }
+    }
+
+    if start_key is not None:
+        request['ExclusiveStartKey'] = start_key
+
+    if consistent_read is not None:
+        request['ConsistentRead'] = bool(consistent_read)
+
+    return request
+
+
+def _get_bundle_items(player_id, bundle_name, consistent_read):
+    """
+    Query every item of a bundle, following the pagination keys.
+    """
+    deserializer = TypeDeserializer()
+    bundle_items = []
+    start_key = None
+
+    while True:
+        result = ddb_client.query(**_build_bundle_items_query_request(player_id, bundle_name, consistent_read, start_key))
+        for item in result.get('Items', []):
+            bundle_items.append({k: deserializer.deserialize(value=v) for k, v in item.items()})
+
+        start_key = result.get('LastEvaluatedKey')
+        if start_key is None:
+            return bundle_items
+
+
+def _get_bundle_names(event):
+    """
+    Get the distinct bundle names from the query string, keeping their order. Returns None if any of them is invalid.
+    """
+    bundle_names_param = handler_request.get_query_string_param(event, 'bundle_names')
+    if bundle_names_param is None or len(bundle_names_param) > user_game_play_constants.QUERYSTRING_MAX_LENGTH:
+        return None
+
+    bundle_names = list(dict.fromkeys(bundle_names_param.split(',')))
+    if len(bundle_names) > MAX_BUNDLES:
+        return None
+
+    for bundle_name in bundle_names:
+        if len(bundle_name) > user_game_play_constants.BUNDLE_NAME_MAX_LENGTH or not is_valid_primary_identifier(bundle_name):
+            return None
+
+    return bundle_names
+
+
+def lambda_handler(event, context):
+    """
+    Entry point for the Get Bundles Lambda function.
+    """
+    handler_request.log_event(event)
+
+    # Get gk_user_id from requestContext
+    player_id = handler_request.get_player_id(event)
+    if player_id is None:
+        return handler_response.return_response(401, 'Unauthorized.')
+
+    # get the comma separated bundle names from the query string
+    bundle_names = _get_bundle_names(event)
+    if bundle_names is None:
+        return handler_response.return_response(400, 'Invalid bundle names')
+
+    consistent_read = handler_request.get_query_string_param(event, 'use_consistent_read')
+
+    # query the bundles in parallel, the boto3 client is thread safe
+    try:
+        with ThreadPoolExecutor(max_workers=min(len(bundle_names), MAX_PARALLEL_QUERIES)) as executor:
+            bundle_items = list(executor.map(lambda bundle_name: _get_bundle_items(player_id, bundle_name, consistent_read), bundle_names))
+
+    except botocore.exceptions.ClientError as err:
+        logger.error(f'Error {err}')
+        raise err
+
+    bundles = [{'bundle_name': bundle_name, 'bundle_items': items} for bundle_name, items in zip(bundle_names, bundle_items)]
+
+    # Return operation result
+    return handler_response.response_envelope(200, None, {'bundles': bundles}, event=event)
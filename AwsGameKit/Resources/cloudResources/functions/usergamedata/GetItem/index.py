@@ -12,12 +12,13 @@ import os
 import sys
 import logging
 sys.path.append(os.path.join(os.path.dirname(__file__)))
-from gamekithelpers import handler_response, handler_request
+from gamekithelpers import handler_response, handler_request, ddb
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_client = boto3.client('dynamodb')
+read_cache = ddb.get_read_cache()
 
 
 def _build_bundleitems_get_request(player_id, bundle_name, bundle_item_key):
@@ -60,7 +61,8 @@ def lambda_handler(event, context):
     item = {}
     try:
         deserializer = TypeDeserializer()
-        result = ddb_client.get_item(**_build_bundleitems_get_request(player_id, bundle_name, bundle_item_key))
+        request = _build_bundleitems_get_request(player_id, bundle_name, bundle_item_key)
+        result = read_cache.read(request, lambda: ddb_client.get_item(**request))
 
         if 'Item' not in result:
             return handler_response.return_response(404, 'Could not retrieve data')
@@ -0,0 +1,188 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Lambda function for atomically incrementing an integer bundle item.
+
+A call with an Idempotency-Key header is applied once, see gamekithelpers.idempotency: unlike an update, a retried
+increment would otherwise be added twice.
+"""
+
+import boto3
+import botocore
+from datetime import timezone, datetime
+import logging
+import os
+import re
+import sys
+
+sys.path.append(os.path.join(os.path.dirname(__file__)))
+from gamekithelpers import handler_response, handler_request, idempotency, user_game_play_constants, sanitizer
+
+logger = logging.getLogger()
+logger.setLevel(logging.INFO)
+
+ddb_client = boto3.client('dynamodb')
+idempotency_store = idempotency.get_idempotency_store()
+
+# Bundle item values are strings, so the increment is a compare-and-set of the value which was read.
+# A concurrent write makes the condition fail, the increment is then applied again to the new value.
+MAX_INCREMENT_ATTEMPTS = 5
+
+# Values and deltas are 64-bit signed integers, which the game client parses
+INT64_MIN = -2 ** 63
+INT64_MAX = 2 ** 63 - 1
+INTEGER_PATTERN = re.compile(r'^-?[0-9]+$')
+
+
+def _build_bundle_item_get_request(player_id_bundle, bundle_item_key):
+    """
+    Build the Bundle Item get request, consistent so the compare-and-set uses the latest value.
+    """
+    return {
+        'Key': {
+            'player_id_bundle': {'S': player_id_bundle},
+            'bundle_item_key': {'S': bundle_item_key}
+        },
+        'TableName': os.environ['BUNDLE_ITEMS_TABLE_NAME'],
+        'ConsistentRead': True,
+        'ProjectionExpression': '#bundle_item_value',
+        'ExpressionAttributeNames': {'#bundle_item_value': 'bundle_item_value'}
+    }
+
+
+def _build_bundle_update_request(player_id, bundle_name):
+    """
+    Build the Bundle update request, which creates the bundle of a new item.
+    """
+    return {
+        'Key': {
+            'player_id': {'S': player_id},
+            'bundle_name': {'S': bundle_name}
+        },
+        'TableName': os.environ['BUNDLES_TABLE_NAME']
+    }
+
+
+def _build_bundle_item_increment_request(player_id_bundle, bundle_item_key, current_value, new_value):
+    """
+    Build the Bundle Item update request, conditional on the value still being current_value, or on the item not existing when it is None.
+    """
+    timestamp = datetime.utcnow().replace(tzinfo=timezone.utc).isoformat()
+
+    request = {
+        'Key': {
+            'player_id_bundle': {'S': player_id_bundle},
+            'bundle_item_key': {'S': bundle_item_key}
+        },
+        'TableName': os.environ['BUNDLE_ITEMS_TABLE_NAME'],
+        'ExpressionAttributeNames': {
+            '#bundle_item_value': 'bundle_item_value',
+            '#created_at': 'created_at',
+            '#updated_at': 'updated_at'
+        },
+        'ExpressionAttributeValues': {
+            ':bundle_item_value': {'S': str(new_value)},
+            ':created_at': {'S': timestamp},
+            ':updated_at': {'S': timestamp}
+        },
+        'UpdateExpression': 'SET #bundle_item_value = :bundle_item_value, '
+                            '#created_at = if_not_exists(#created_at, :created_at), #updated_at = :updated_at'
+    }
+
+    if current_value is None:
+        request['ConditionExpression'] = 'attribute_not_exists(bundle_item_key)'
+    else:
+        request['ConditionExpression'] = '#bundle_item_value = :current_value'
+        request['ExpressionAttributeValues'][':current_value'] = {'S': current_value}
+
+    return request
+
+
+def _is_integer(value):
+    return isinstance(value, str) and INTEGER_PATTERN.match(value) is not None and INT64_MIN <= int(value) <= INT64_MAX
+
+
+def lambda_handler(event, context):
+    """
+    Entry point for the Increment Item Lambda function.
+    """
+    handler_request.log_event(event)
+
+    # Get gk_user_id from requestContext
+    player_id = handler_request.get_player_id(event)
+    if player_id is None:
+        return handler_response.return_response(401, 'Unauthorized.')
+
+    return idempotency_store.run(event, player_id, lambda: _increment_item(event, player_id), _is_retryable_response)
+
+
+def _is_retryable_response(response):
+    """
+    Whether the increment wasn't applied and may be retried: a server error, or a 409 after too many concurrent writes.
+    """
+    return response['statusCode'] >= 500 or response['statusCode'] == 409
+
+
+def _increment_item(event, player_id):
+    # get bundle_name from path
+    bundle_name = handler_request.get_path_param(event, 'bundle_name')
+    if bundle_name is None:
+        return handler_response.return_response(400, 'Invalid bundle name')
+
+    if len(bundle_name) > user_game_play_constants.BUNDLE_NAME_MAX_LENGTH:
+        return handler_response.return_response(414, 'Invalid bundle name')
+
+    bundle_name = sanitizer.sanitize(bundle_name)
+
+    # get bundle_item_key from path
+    bundle_item_key = handler_request.get_path_param(event, 'bundle_item_key')
+    if bundle_item_key is None:
+        return handler_response.return_response(400, 'Invalid bundle item key')
+
+    if len(bundle_item_key) > user_game_play_constants.BUNDLE_ITEM_NAME_MAX_LENGTH:
+        return handler_response.return_response(414, 'Invalid bundle item key')
+
+    bundle_item_key = sanitizer.sanitize(bundle_item_key)
+
+    # get payload from body (the amount to add, which may be negative)
+    item_data = handler_request.get_body_as_json(event)
+    if item_data is None:
+        return handler_response.return_response(400, 'Missing payload')
+
+    delta = item_data.get('delta')
+    if isinstance(delta, bool) or not isinstance(delta, int) or not INT64_MIN <= delta <= INT64_MAX:
+        return handler_response.return_response(400, 'Invalid payload')
+
+    player_id_bundle = f'{player_id}_{bundle_name}'
+
+    try:
+        for attempt in range(MAX_INCREMENT_ATTEMPTS):
+            result = ddb_client.get_item(**_build_bundle_item_get_request(player_id_bundle, bundle_item_key))
+
+            # A missing item counts from zero
+            current_value = result['Item']['bundle_item_value']['S'] if 'Item' in result else None
+            if current_value is not None and not _is_integer(current_value):
+                return handler_response.return_response(400, 'Bundle item value is not an integer')
+
+            new_value = (int(current_value) if current_value is not None else 0) + delta
+            if not INT64_MIN <= new_value <= INT64_MAX:
+                return handler_response.return_response(400, 'Bundle item value out of range')
+
+            if current_value is None:
+                ddb_client.update_item(**_build_bundle_update_request(player_id, bundle_name))
+
+            try:
+                ddb_client.update_item(**_build_bundle_item_increment_request(player_id_bundle, bundle_item_key, current_value, new_value))
+            except ddb_client.exceptions.ConditionalCheckFailedException:
+                logger.info(f'Bundle item {bundle_item_key} changed concurrently, attempt {attempt + 1} of {MAX_INCREMENT_ATTEMPTS}')
+                continue
+
+            # Return operation result
+            return handler_response.response_envelope(200, None, {'bundle_item_value': str(new_value)})
+
+    except botocore.exceptions.ClientError as err:
+        logger.error(f'Error incrementing bundle item. Error: {err}')
+        raise err
+
+    return handler_response.return_response(409, 'Bundle item changed concurrently, please retry.')
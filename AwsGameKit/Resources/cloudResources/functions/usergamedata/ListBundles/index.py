@@ -13,25 +13,31 @@ import sys
 import logging
 
 sys.path.append(os.path.join(os.path.dirname(__file__)))
-from gamekithelpers import handler_response, handler_request
+from gamekithelpers import handler_response, handler_request, ddb
 from gamekithelpers.pagination import validate_pagination_token
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_client = boto3.client('dynamodb')
+read_cache = ddb.get_read_cache()
+
+# Bundle names are small, so a page can hold many more of them than of bundle items
+MAX_LIMIT = 1000
 
 
 def _build_bundle_get_request(player_id, consistent_read, limit, start_bundle):
     """
-    Build the Bundle query request.
+    Build the Bundle query request. Only the bundle names are read, the clients don't use the other attributes.
     """
 
     request = {
         'TableName': os.environ['BUNDLES_TABLE_NAME'],
         'KeyConditionExpression': '#player_id = :player_id',
+        'ProjectionExpression': '#bundle_name',
         'ExpressionAttributeNames': {
-            '#player_id': 'player_id'
+            '#player_id': 'player_id',
+            '#bundle_name': 'bundle_name'
         },
         'ExpressionAttributeValues': {
             ':player_id': {'S': player_id}
@@ -76,7 +82,7 @@ def lambda_handler(event, context):
     consistent_read = handler_request.get_query_string_param(event, 'use_consistent_read')
     limit = handler_request.get_query_string_param(event, 'limit', '100')
     limit = int(limit)
-    if limit > 100 or limit <= 0:
+    if limit > MAX_LIMIT or limit <= 0:
         limit = 100
 
     bundle_names = []
@@ -87,8 +93,8 @@ def lambda_handler(event, context):
 
         paginate_bundles = False
 
-        result = ddb_client.query(
-            **_build_bundle_get_request(player_id, consistent_read, limit, start_bundle_id))
+        request = _build_bundle_get_request(player_id, consistent_read, limit, start_bundle_id)
+        result = read_cache.read(request, lambda: ddb_client.query(**request))
 
         last_evaluated_bundle_key = None
         if result.get('LastEvaluatedKey') is not None:
@@ -3,6 +3,9 @@
 
 """
 Lambda function for updating bundle items.
+
+A call with an Idempotency-Key header is applied once, see gamekithelpers.idempotency. A retry with the same key can't
+overwrite a newer value of the item.
 """
 
 import boto3
@@ -13,12 +16,14 @@ import os
 import sys
 
 sys.path.append(os.path.join(os.path.dirname(__file__)))
-from gamekithelpers import handler_response, handler_request, user_game_play_constants, sanitizer
+from gamekithelpers import handler_response, handler_request, idempotency, user_game_play_constants, sanitizer, throttle
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
 ddb_client = boto3.client('dynamodb')
+player_rate_limiter = throttle.get_player_rate_limiter()
+idempotency_store = idempotency.get_idempotency_store()
 
 
 def _build_bundle_item_update_request(player_id_bundle, bundle_item_key, bundle_item_value):
@@ -59,6 +64,14 @@ def lambda_handler(event, context):
     if player_id is None:
         return handler_response.return_response(401, 'Unauthorized.')
 
+    retry_after = player_rate_limiter.try_acquire(player_id)
+    if retry_after > 0:
+        return handler_response.too_many_requests(retry_after)
+
+    return idempotency_store.run(event, player_id, lambda: _update_bundle_item(event, player_id))
+
+
+def _update_bundle_item(event, player_id):
     # get bundle_name from path
     bundle_name = handler_request.get_path_param(event, 'bundle_name')
     if bundle_name is None:
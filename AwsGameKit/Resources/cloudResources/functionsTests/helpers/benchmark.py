@@ -0,0 +1,197 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+A harness which runs a Lambda handler against mocked boto3 clients and resources, and measures what a request costs:
+the number of calls made to each AWS service, the handler's CPU time, and the time taken to import the handler's module.
+
+Example:
+>>> scenario = HandlerScenario(
+...     module='functions.usergamedata.GetBundle.index',
+...     event=http_event(path_parameters={'bundle_name': 'stats'}),
+...     environment={'BUNDLE_ITEMS_TABLE_NAME': 'items_table'},
+...     responses={'dynamodb': {'query': Query.mock_response()}})
+>>> result = run_scenario(scenario)
+>>> result.first_request_calls
+{'dynamodb.query': 1}
+"""
+import copy
+import importlib
+import sys
+import time
+from dataclasses import dataclass, field
+from typing import Any, Dict, List, Optional
+from unittest.mock import MagicMock, patch
+
+# Define types:
+CallCounts = Dict[str, int]  # Example: {'dynamodb.query': 1}
+
+# Methods of the boto3 clients and resources which create other objects rather than calling a service
+FACTORY_METHODS = {'Table', 'Object', 'Bucket', 'get_paginator', 'batch_writer', 'meta', 'exceptions'}
+
+
+@dataclass
+class HandlerScenario:
+    """
+    One request to a handler, repeated to measure the requests served by a warm execution environment.
+
+    :param module: The handler's module, for example 'functions.usergamedata.GetBundle.index'.
+    :param event: The Lambda event passed to lambda_handler.
+    :param environment: The Lambda function's environment variables, set while the module is imported and invoked.
+    :param responses: The response of each operation, by service then operation name, for example
+    {'dynamodb': {'query': {...}}}. A callable is used as the operation's side_effect. The same response is returned
+    for the operation of the client, of the service resource, and of its Table, Object and Bucket resources.
+    :param iterations: How many times the handler is invoked, the first invocation is the execution environment's first request.
+    """
+    module: str
+    event: dict
+    environment: Dict[str, str] = field(default_factory=dict)
+    responses: Dict[str, Dict[str, Any]] = field(default_factory=dict)
+    context: Any = None
+    iterations: int = 20
+
+
+@dataclass
+class HandlerBenchmark:
+    """
+    What the requests of a HandlerScenario cost.
+
+    :param import_seconds: Wall clock time taken to import the handler's module. Modules imported by earlier handlers,
+    such as the gamekithelpers layer, are already loaded and not counted.
+    :param first_request_calls: The AWS calls made by the first request, by 'service.operation'.
+    :param warm_request_calls: The most AWS calls made by any of the following requests, by 'service.operation'.
+    :param mean_cpu_seconds: The handler's mean CPU time per request, AWS calls excluded since they are mocked.
+    :param status_codes: The statusCode returned by each request.
+    """
+    module: str
+    import_seconds: float
+    first_request_calls: CallCounts
+    warm_request_calls: CallCounts
+    mean_cpu_seconds: float
+    status_codes: List[int]
+
+    @property
+    def first_request_total(self) -> int:
+        return sum(self.first_request_calls.values())
+
+    @property
+    def warm_request_total(self) -> int:
+        return sum(self.warm_request_calls.values())
+
+    def exceeded_budgets(self, budget: Dict[str, int]) -> List[str]:
+        """
+        Returns a description of each call count which is above its budget, empty if the handler is within budget.
+
+        :param budget: The most AWS calls allowed, with the keys 'first_request' and 'warm_request'.
+        """
+        exceeded = []
+        for name, calls, total in [('first_request', self.first_request_calls, self.first_request_total),
+                                   ('warm_request', self.warm_request_calls, self.warm_request_total)]:
+            if name in budget and total > budget[name]:
+                exceeded.append(f'{self.module}: {name} made {total} AWS calls, the budget is {budget[name]}: {calls}')
+        return exceeded
+
+
+class MockAws:
+    """
+    Stands in for boto3.client and boto3.resource, and counts the service calls made through the objects they return.
+    """
+
+    def __init__(self, responses: Dict[str, Dict[str, Any]]):
+        self._responses = responses
+        self._services: Dict[str, MagicMock] = {}
+
+    def client(self, service_name: str, *args, **kwargs) -> MagicMock:
+        return self._get_service(service_name)
+
+    def resource(self, service_name: str, *args, **kwargs) -> MagicMock:
+        return self._get_service(service_name)
+
+    def reset_calls(self):
+        for service in self._services.values():
+            service.reset_mock(return_value=False, side_effect=False)
+
+    def get_call_counts(self) -> CallCounts:
+        counts: CallCounts = {}
+        for service_name, service in self._services.items():
+            for mock_call in service.mock_calls:
+                operation = mock_call[0].split('.')[-1]
+                if not operation or operation.startswith('_') or operation.endswith(')') or operation in FACTORY_METHODS:
+                    continue
+                key = f'{service_name}.{operation}'
+                counts[key] = counts.get(key, 0) + 1
+        return counts
+
+    def _get_service(self, service_name: str) -> MagicMock:
+        service = self._services.get(service_name)
+        if service is None:
+            service = MagicMock(name=service_name)
+            for operation, response in self._responses.get(service_name, {}).items():
+                for target in [service, service.Table.return_value, service.Object.return_value, service.Bucket.return_value]:
+                    _set_response(getattr(target, operation), response)
+            self._services[service_name] = service
+        return service
+
+
+def run_scenario(scenario: HandlerScenario) -> HandlerBenchmark:
+    """
+    Import the scenario's handler module afresh with mocked boto3 clients and resources, then invoke it
+    scenario.iterations times.
+    """
+    mock_aws = MockAws(scenario.responses)
+    with patch.dict('os.environ', scenario.environment), \
+            patch('boto3.client', side_effect=mock_aws.client), \
+            patch('boto3.resource', side_effect=mock_aws.resource):
+        original_module = sys.modules.pop(scenario.module, None)
+        import_start = time.perf_counter()
+        handler_module = importlib.import_module(scenario.module)
+        import_seconds = time.perf_counter() - import_start
+
+        first_request_calls: Optional[CallCounts] = None
+        warm_request_calls: CallCounts = {}
+        cpu_seconds = 0.0
+        status_codes = []
+        for _ in range(scenario.iterations):
+            mock_aws.reset_calls()
+            cpu_start = time.process_time()
+            response = handler_module.lambda_handler(scenario.event, scenario.context)
+            cpu_seconds += time.process_time() - cpu_start
+            status_codes.append(response.get('statusCode') if isinstance(response, dict) else None)
+
+            calls = mock_aws.get_call_counts()
+            if first_request_calls is None:
+                first_request_calls = calls
+            elif sum(calls.values()) > sum(warm_request_calls.values()):
+                warm_request_calls = calls
+
+    # The unit tests get back the module they imported with their own mocks
+    sys.modules.pop(scenario.module, None)
+    if original_module is not None:
+        sys.modules[scenario.module] = original_module
+
+    return HandlerBenchmark(
+        module=scenario.module,
+        import_seconds=import_seconds,
+        first_request_calls=first_request_calls or {},
+        warm_request_calls=warm_request_calls,
+        mean_cpu_seconds=cpu_seconds / max(scenario.iterations, 1),
+        status_codes=status_codes)
+
+
+def format_report(benchmarks: List[HandlerBenchmark]) -> str:
+    """
+    Returns a table of the benchmarks, one handler per line.
+    """
+    lines = [f'{"handler":<50} {"import ms":>10} {"cpu ms/request":>15} {"first calls":>12} {"warm calls":>11}']
+    for benchmark in benchmarks:
+        lines.append(f'{benchmark.module:<50} {benchmark.import_seconds * 1000:>10.2f} {benchmark.mean_cpu_seconds * 1000:>15.3f} '
+                     f'{benchmark.first_request_total:>12} {benchmark.warm_request_total:>11}')
+    return '\n'.join(lines)
+
+
+def _set_response(operation: MagicMock, response: Any):
+    if callable(response):
+        operation.side_effect = response
+    else:
+        # Handlers may modify the responses, every call gets its own copy
+        operation.side_effect = lambda *args, **kwargs: copy.deepcopy(response)
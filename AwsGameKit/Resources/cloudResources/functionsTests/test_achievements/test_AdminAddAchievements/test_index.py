@@ -68,6 +68,19 @@ class TestIndex(TestCase):
         index.achievements_table.update_item.assert_not_called()
         index.s3_client.delete_objects.assert_not_called()
 
+    def test_lambda_returns_a_400_error_code_when_an_achievement_id_is_reserved(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"achievements": [{"achievement_id": "summary"}]}'
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        index.achievements_table.update_item.assert_not_called()
+        index.s3_client.delete_objects.assert_not_called()
+
     def test_lambda_returns_a_200_success_code_when_achievements_passed_in_body(self):
         # Arrange
         event = self.get_lambda_event()
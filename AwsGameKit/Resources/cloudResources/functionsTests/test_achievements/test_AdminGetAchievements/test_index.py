@@ -68,6 +68,75 @@ class TestIndex(TestCase):
         self.assertEqual(1, len(achievements))
         self.assertEqual('NEXT_ACHIEVEMENT', next_start_key['achievement_id'])
 
+    def test_lambda_scans_one_segment_when_segment_params_passed(self):
+        event = self.get_lambda_event()
+        event['queryStringParameters']['segment'] = '2'
+        event['queryStringParameters']['total_segments'] = '4'
+        index.ddb_table.scan.return_value = self.mocked_scan_result()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        scan_kwargs = index.ddb_table.scan.call_args.kwargs
+        self.assertEqual(2, scan_kwargs['Segment'])
+        self.assertEqual(4, scan_kwargs['TotalSegments'])
+        self.assertEqual(50, scan_kwargs['Limit'])
+
+    def test_lambda_returns_a_400_error_code_when_segment_params_are_invalid(self):
+        for params in [{'segment': '0'}, {'total_segments': '2'}, {'segment': '2', 'total_segments': '2'},
+                       {'segment': '0', 'total_segments': '0'}, {'segment': 'a', 'total_segments': '2'}]:
+            event = self.get_lambda_event()
+            event['queryStringParameters'].update(params)
+
+            # Act
+            result = index.lambda_handler(event, None)
+
+            # Assert
+            self.assertEqual(400, result['statusCode'], params)
+        index.ddb_table.scan.assert_not_called()
+
+    def test_lambda_scans_segments_in_parallel_when_waiting_for_all_pages(self):
+        event = self.get_lambda_event()
+        event['queryStringParameters']['wait_for_all_pages'] = 'true'
+
+        def scan(**kwargs):
+            result = self.mocked_scan_result()
+            result['Items'][0]['achievement_id'] = f"SEGMENT_{kwargs['Segment']}_{'SECOND' if 'ExclusiveStartKey' in kwargs else 'FIRST'}"
+            if 'ExclusiveStartKey' not in kwargs:
+                result['LastEvaluatedKey'] = {'achievement_id': 'NEXT_ACHIEVEMENT'}
+            return result
+        index.ddb_table.scan.side_effect = scan
+
+        # Act
+        with patch.object(index, 'SCAN_SEGMENTS', 3):
+            result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(6, index.ddb_table.scan.call_count)
+        results_body = json.loads(result['body'])
+        achievement_ids = [achievement['achievement_id'] for achievement in results_body['data']['achievements']]
+        self.assertEqual(['SEGMENT_0_FIRST', 'SEGMENT_0_SECOND', 'SEGMENT_1_FIRST', 'SEGMENT_1_SECOND', 'SEGMENT_2_FIRST', 'SEGMENT_2_SECOND'],
+                         achievement_ids)
+        self.assertIsNone(results_body.get('paging'))
+
+    def test_lambda_scans_sequentially_when_resuming_from_a_start_key(self):
+        event = self.get_lambda_event()
+        event['queryStringParameters']['wait_for_all_pages'] = 'true'
+        event['queryStringParameters']['start_key'] = json.dumps({'achievement_id': 'NEXT_ACHIEVEMENT'})
+        index.ddb_table.scan.return_value = self.mocked_scan_result()
+
+        # Act
+        with patch.object(index, 'SCAN_SEGMENTS', 3):
+            result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_table.scan.assert_called_once()
+        self.assertNotIn('TotalSegments', index.ddb_table.scan.call_args.kwargs)
+
     @staticmethod
     def get_lambda_event():
         return {
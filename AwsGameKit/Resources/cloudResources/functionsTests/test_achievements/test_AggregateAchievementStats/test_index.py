@@ -0,0 +1,83 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+with patch.dict(os.environ, {
+    'ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_game_achievements',
+    'STATS_SHARDS_TABLE_NAME': 'gamekit_dev_foogamename_achievement_stats_shards',
+    'PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements_summary',
+    'ACHIEVEMENTS_BUCKET_NAME': 'gamekit-dev-foogamename-achievements',
+    'STATS_CACHE_SECONDS': '900'
+}) as env_mock:
+    with patch("boto3.client") as boto3_client_mock:
+        with patch("gamekithelpers.ddb.get_table") as layer_boto_mock:
+            from functions.achievements.AggregateAchievementStats import index
+
+
+class TestIndex(TestCase):
+    def setUp(self):
+        index.s3_client = MagicMock()
+        index.ddb_client = MagicMock()
+        index.ddb_game_table = MagicMock()
+        index.ddb_stats_table = MagicMock()
+
+    def test_build_stats_computes_the_percentages_against_the_player_count(self):
+        # Act
+        stats = index.build_stats({'B': 1, 'A': 3}, ['A', 'B', 'C'], 4, '2022-01-01T00:00:00+00:00')
+
+        # Assert
+        self.assertEqual(4, stats['player_count'])
+        self.assertEqual([
+            {'achievement_id': 'A', 'earned_count': 3, 'earned_percent': 75.0},
+            {'achievement_id': 'B', 'earned_count': 1, 'earned_percent': 25.0},
+            {'achievement_id': 'C', 'earned_count': 0, 'earned_percent': 0.0}
+        ], stats['achievements'])
+
+    def test_build_stats_raises_the_player_count_to_the_largest_earned_count(self):
+        # Act
+        stats = index.build_stats({'A': 5}, ['A'], 2, '2022-01-01T00:00:00+00:00')
+
+        # Assert
+        self.assertEqual(5, stats['player_count'])
+        self.assertEqual(100.0, stats['achievements'][0]['earned_percent'])
+
+    def test_build_stats_leaves_out_unknown_achievements_and_handles_no_players(self):
+        # Act
+        stats = index.build_stats({'DELETED': 2}, ['A'], 0, '2022-01-01T00:00:00+00:00')
+
+        # Assert
+        self.assertEqual(0, stats['player_count'])
+        self.assertEqual([{'achievement_id': 'A', 'earned_count': 0, 'earned_percent': 0.0}], stats['achievements'])
+
+    def test_lambda_publishes_the_summed_shards_of_the_visible_achievements(self):
+        # Arrange
+        index.ddb_stats_table.scan.side_effect = [
+            {'Items': [{'achievement_id': 'A', 'shard': 0, 'earned_count': 2},
+                       {'achievement_id': 'HIDDEN', 'shard': 3, 'earned_count': 1}],
+             'LastEvaluatedKey': {'achievement_id': 'HIDDEN', 'shard': 3}},
+            {'Items': [{'achievement_id': 'A', 'shard': 7, 'earned_count': 1}]}
+        ]
+        index.ddb_game_table.scan.return_value = {'Items': [
+            {'achievement_id': 'A', 'is_hidden': False},
+            {'achievement_id': 'HIDDEN', 'is_hidden': True}
+        ]}
+        index.ddb_client.describe_table.return_value = {'Table': {'ItemCount': 6}}
+
+        # Act
+        result = index.lambda_handler({}, None)
+
+        # Assert
+        self.assertEqual({'achievements': 1, 'player_count': 6}, result)
+        self.assertEqual(2, index.ddb_stats_table.scan.call_count)
+        index.s3_client.put_object.assert_called_once()
+        put = index.s3_client.put_object.call_args.kwargs
+        self.assertEqual('gamekit-dev-foogamename-achievements', put['Bucket'])
+        self.assertEqual('stats/achievement_stats.json', put['Key'])
+        self.assertEqual('application/json', put['ContentType'])
+        self.assertEqual('public, max-age=900', put['CacheControl'])
+        body = json.loads(put['Body'])
+        self.assertEqual([{'achievement_id': 'A', 'earned_count': 3, 'earned_percent': 50.0}], body['achievements'])
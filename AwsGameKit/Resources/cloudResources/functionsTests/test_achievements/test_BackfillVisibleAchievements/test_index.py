@@ -0,0 +1,91 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+from botocore.exceptions import ClientError
+
+with patch("boto3.resource") as boto_resource_mock:
+    with patch("gamekitresourcemanagement.cfn_custom_resource.send_success_response") as mock_send_success_response:
+        with patch('gamekitresourcemanagement.cfn_custom_resource.send_failure_response') as mock_send_failure_response:
+            from functions.achievements.BackfillVisibleAchievements import index
+
+TABLE_NAME = 'gamekit_dev_foogamename_game_achievements'
+
+
+class TestIndex(TestCase):
+    def setUp(self):
+        index.ddb_resource = MagicMock()
+        index.send_success_response = MagicMock()
+        index.send_failure_response = MagicMock()
+        self.table = index.ddb_resource.Table.return_value
+
+    def test_sets_the_index_key_on_every_page_of_visible_achievements_without_it(self):
+        # Arrange
+        self.table.scan.side_effect = [
+            {'Items': [{'achievement_id': 'A'}], 'LastEvaluatedKey': {'achievement_id': 'A'}},
+            {'Items': [{'achievement_id': 'B'}]}
+        ]
+
+        # Act
+        index.lambda_handler(self.get_event('Update'), None)
+
+        # Assert
+        index.ddb_resource.Table.assert_called_once_with(TABLE_NAME)
+        self.assertEqual({'achievement_id': 'A'}, self.table.scan.call_args_list[1].kwargs['ExclusiveStartKey'])
+        self.assertEqual([{'achievement_id': 'A'}, {'achievement_id': 'B'}],
+                         [call.kwargs['Key'] for call in self.table.update_item.call_args_list])
+        update = self.table.update_item.call_args.kwargs
+        self.assertEqual('SET #visible = :visible', update['UpdateExpression'])
+        self.assertEqual('true', update['ExpressionAttributeValues'][':visible'])
+        index.send_success_response.assert_called_once()
+        index.send_failure_response.assert_not_called()
+
+    def test_skips_achievements_hidden_or_deleted_since_the_scan(self):
+        # Arrange
+        self.table.scan.return_value = {'Items': [{'achievement_id': 'A'}, {'achievement_id': 'B'}]}
+        self.table.update_item.side_effect = [
+            ClientError({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'UpdateItem'),
+            {}
+        ]
+
+        # Act
+        index.lambda_handler(self.get_event('Create'), None)
+
+        # Assert
+        self.assertEqual(2, self.table.update_item.call_count)
+        index.send_success_response.assert_called_once()
+
+    def test_reports_a_failure_to_cloudformation(self):
+        # Arrange
+        self.table.scan.side_effect = ClientError({'Error': {'Code': 'AccessDeniedException', 'Message': 'denied'}}, 'Scan')
+
+        # Act
+        index.lambda_handler(self.get_event('Update'), None)
+
+        # Assert
+        index.send_success_response.assert_not_called()
+        index.send_failure_response.assert_called_once()
+        self.assertEqual('AccessDeniedException - denied', index.send_failure_response.call_args.args[2])
+
+    def test_does_nothing_on_delete(self):
+        # Act
+        index.lambda_handler(self.get_event('Delete'), None)
+
+        # Assert
+        self.table.scan.assert_not_called()
+        index.send_success_response.assert_called_once()
+
+    @staticmethod
+    def get_event(request_type):
+        return {
+            'RequestType': request_type,
+            'ResourceProperties': {
+                'table_name': TABLE_NAME
+            },
+            'StackId': 'test_stack_id',
+            'LogicalResourceId': 'test_logical_resource_id',
+            'RequestId': 'test_request_id',
+            'ResponseURL': 'https://website.tld/some_url'
+        }
@@ -0,0 +1,136 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+import botocore
+
+from functionsTests.helpers.sample_lambda_events import http_event
+
+with patch.dict(os.environ, {
+    'ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_game_achievements',
+    'PLAYER_ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements',
+    'PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements_summary'
+    }) as env_mock:
+    with patch("gamekithelpers.ddb.get_table") as layer_boto_mock:
+        from functions.achievements.GetAchievementSummary import index
+
+
+class TestIndex(TestCase):
+    def setUp(self):
+        index.ddb_game_table = MagicMock()
+        index.ddb_player_table = MagicMock()
+        index.ddb_summary_table = MagicMock()
+        index._catalog_points = None
+        index.ddb_game_table.query.return_value = {
+            'Items': [
+                {'achievement_id': 'EAT_THOUSAND_BANANAS', 'points': 10},
+                {'achievement_id': 'CLIMB_THE_TREE', 'points': 5},
+                {'achievement_id': 'FIND_THE_SECRET_BANANA'}
+            ]
+        }
+
+    def test_lambda_returns_a_401_error_code_when_player_id_is_missing(self):
+        # Arrange
+        event = http_event()
+        event['requestContext']['authorizer']['claims'].pop('custom:gk_user_id')
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(401, result['statusCode'])
+        index.ddb_summary_table.get_item.assert_not_called()
+
+    def test_lambda_returns_the_stored_summary_and_the_catalog_totals(self):
+        # Arrange
+        index.ddb_summary_table.get_item.return_value = {
+            'Item': {'player_id': 'foo_player_id', 'earned_count': 1, 'earned_points': 10, 'is_backfilled': True}
+        }
+
+        # Act
+        result = index.lambda_handler(http_event(), None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual({'earned_count': 1, 'earned_points': 10, 'total_count': 3, 'total_points': 15},
+                         json.loads(result['body'])['data'])
+        index.ddb_player_table.query.assert_not_called()
+        index.ddb_summary_table.put_item.assert_not_called()
+        self.assertEqual('#achievement_id, #points', index.ddb_game_table.query.call_args.kwargs['ProjectionExpression'])
+
+    def test_lambda_counts_the_earned_achievements_of_a_player_without_a_summary(self):
+        # Arrange
+        index.ddb_summary_table.get_item.return_value = {}
+        index.ddb_player_table.query.return_value = {
+            'Items': [
+                {'achievement_id': 'EAT_THOUSAND_BANANAS', 'earned': True},
+                {'achievement_id': 'CLIMB_THE_TREE', 'earned': False},
+                {'achievement_id': 'A_HIDDEN_ACHIEVEMENT', 'earned': True}
+            ]
+        }
+
+        # Act
+        result = index.lambda_handler(http_event(), None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual({'earned_count': 2, 'earned_points': 10, 'total_count': 3, 'total_points': 15},
+                         json.loads(result['body'])['data'])
+        put_request = index.ddb_summary_table.put_item.call_args.kwargs
+        self.assertEqual('attribute_not_exists(player_id)', put_request['ConditionExpression'])
+        self.assertTrue(put_request['Item']['is_backfilled'])
+
+    def test_lambda_counts_the_achievements_earned_before_the_summary_was_kept(self):
+        # Arrange
+        index.ddb_summary_table.get_item.return_value = {
+            'Item': {'player_id': 'foo_player_id', 'earned_count': 1, 'earned_points': 5}
+        }
+        index.ddb_player_table.query.return_value = {
+            'Items': [
+                {'achievement_id': 'EAT_THOUSAND_BANANAS', 'earned': True},
+                {'achievement_id': 'CLIMB_THE_TREE', 'earned': True}
+            ]
+        }
+
+        # Act
+        result = index.lambda_handler(http_event(), None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(2, json.loads(result['body'])['data']['earned_count'])
+        put_request = index.ddb_summary_table.put_item.call_args.kwargs
+        self.assertEqual({':earned_count': 1}, put_request['ExpressionAttributeValues'])
+
+    def test_lambda_ignores_a_summary_updated_while_counting(self):
+        # Arrange
+        index.ddb_summary_table.get_item.return_value = {}
+        index.ddb_player_table.query.return_value = {'Items': [{'achievement_id': 'CLIMB_THE_TREE', 'earned': True}]}
+        index.ddb_summary_table.put_item.side_effect = botocore.exceptions.ClientError(
+            {'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'PutItem')
+
+        # Act
+        result = index.lambda_handler(http_event(), None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(5, json.loads(result['body'])['data']['earned_points'])
+
+    def test_lambda_scans_the_catalog_when_the_index_is_empty(self):
+        # Arrange
+        index.ddb_game_table.query.return_value = {'Items': []}
+        index.ddb_game_table.scan.return_value = {'Items': [{'achievement_id': 'CLIMB_THE_TREE', 'points': 5}]}
+        index.ddb_summary_table.get_item.return_value = {
+            'Item': {'player_id': 'foo_player_id', 'earned_count': 0, 'earned_points': 0, 'is_backfilled': True}
+        }
+
+        # Act
+        result = index.lambda_handler(http_event(), None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(5, json.loads(result['body'])['data']['total_points'])
+        index.ddb_game_table.scan.assert_called_once()
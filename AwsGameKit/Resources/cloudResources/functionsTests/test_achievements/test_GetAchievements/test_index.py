@@ -1,6 +1,7 @@
 # Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 # SPDX-License-Identifier: Apache-2.0
 
+import base64
 import json
 import os
 from unittest import TestCase
@@ -10,14 +11,21 @@ with patch.dict(os.environ, {
     'ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_game_achievements',
     'PLAYER_ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements'
     }) as env_mock:
-    with patch("gamekithelpers.ddb.get_table") as layer_boto_mock:
-        from functions.achievements.GetAchievements import index
+    with patch("boto3.resource") as boto_resource_mock:
+        with patch("gamekithelpers.ddb.get_table") as layer_boto_mock:
+            from functions.achievements.GetAchievements import index
+            from gamekithelpers import cbor
+
+PLAYER_ACHIEVEMENTS_TABLE_NAME = 'gamekit_dev_foogamename_player_achievements'
 
 class TestIndex(TestCase):
     @patch('functions.achievements.GetAchievements.index.ddb.boto3')
     def setUp(self, mock_boto3: MagicMock):
         index.ddb_game_table = mock_boto3.resource('dynamodb').Table('test_table')
-        index.ddb_player_table = mock_boto3.resource('dynamodb').Table('test_player_table')
+        index.ddb_game_table.scan.return_value = self.mocked_scan_hidden_result()
+        index._catalog = None
+        index.ddb_resource = MagicMock()
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([])
 
     def test_lambda_returns_a_401_error_code_when_player_id_is_empty(self):
         # Arrange
@@ -30,20 +38,20 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(401, result['statusCode'])
         self.assert_did_not_call_dynamodb(index.ddb_game_table)
-        self.assert_did_not_call_dynamodb(index.ddb_player_table)
+        index.ddb_resource.batch_get_item.assert_not_called()
 
     def test_lambda_returns_a_200_success_code_using_defaults_when_query_string_is_empty(self):
         # Arrange
         event = self.get_lambda_event()
         event['queryStringParameters'] = None
-        index.ddb_game_table.scan.return_value = self.mocked_scan_result()
-        index.ddb_player_table.get_item.return_value = self.mocked_get_item_result()
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([self.mocked_player_achievement()])
 
         # Act
         result = index.lambda_handler(event, None)
 
         # Assert
-        index.ddb_game_table.scan.asser_called_once()
+        index.ddb_game_table.query.assert_called_once()
         self.assertEqual(200, result['statusCode'])
 
         results_body = json.loads(result['body'])
@@ -58,17 +66,19 @@ class TestIndex(TestCase):
         self.assertIsNotNone(achievement['earned'])
         self.assertEqual(True, achievement['earned'])
         self.assertIsNotNone(achievement['earned_at'])
+        self.assertEqual('2021-07-28T03:37:37.267711+00:00', achievement['updated_at'])
+        self.assertEqual('2021-07-27T16:54:29.130692+00:00', achievement['definition_updated_at'])
 
     def test_lambda_returns_a_200_success_code_when_query_string_passed(self):
         event = self.get_lambda_event()
-        index.ddb_game_table.scan.return_value = self.mocked_scan_result()
-        index.ddb_player_table.get_item.return_value = self.mocked_get_item_result()
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([self.mocked_player_achievement()])
 
         # Act
         result = index.lambda_handler(event, None)
 
         # Assert
-        index.ddb_game_table.scan.assert_called_once()
+        index.ddb_game_table.query.assert_called_once()
         self.assertEqual(200, result['statusCode'])
 
         results_body = json.loads(result['body'])
@@ -86,14 +96,14 @@ class TestIndex(TestCase):
 
     def test_lambda_returns_a_200_success_code_achievement_scan_is_empty(self):
         event = self.get_lambda_event()
-        index.ddb_game_table.scan.return_value = self.mocked_scan_hidden_result()
-        index.ddb_player_table.get_item.return_value = self.mocked_get_item_result()
+        index.ddb_game_table.query.return_value = self.mocked_scan_hidden_result()
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([self.mocked_player_achievement()])
 
         # Act
         result = index.lambda_handler(event, None)
 
         # Assert
-        index.ddb_game_table.scan.assert_called_once()
+        index.ddb_game_table.query.assert_called_once()
         self.assertEqual(200, result['statusCode'])
 
         results_body = json.loads(result['body'])
@@ -107,15 +117,14 @@ class TestIndex(TestCase):
 
     def test_lambda_returns_a_200_success_code_when_there_are_more_pages(self):
         event = self.get_lambda_event()
-        index.ddb_game_table.scan.return_value = self.mocked_scan_result()
-        index.ddb_game_table.scan.return_value['LastEvaluatedKey'] = {'achievement_id': 'NEXT_ACHIEVEMENT'}
-        index.ddb_player_table.get_item.return_value = self.mocked_get_item_result()
+        index.ddb_game_table.query.return_value = self.mocked_scan_page_result(51)
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([self.mocked_player_achievement('ACHIEVEMENT_0')])
 
         # Act
         result = index.lambda_handler(event, None)
 
         # Assert
-        index.ddb_game_table.scan.assert_called_once()
+        index.ddb_game_table.query.assert_called_once()
         self.assertEqual(200, result['statusCode'])
 
         results_body = json.loads(result['body'])
@@ -124,26 +133,75 @@ class TestIndex(TestCase):
 
         next_start_key = results_body.get('paging').get('next_start_key')
         self.assertIsNotNone(next_start_key)
-        self.assertEqual(1, len(achievements))
-        self.assertEqual('NEXT_ACHIEVEMENT', next_start_key['achievement_id'])
+        self.assertEqual(50, len(achievements))
+        self.assertEqual('ACHIEVEMENT_49', next_start_key['achievement_id'])
 
-        self.assertEqual(1, len(achievements))
         achievement = achievements[0]
         self.assertIsNotNone(achievement['earned'])
         self.assertEqual(True, achievement['earned'])
         self.assertIsNotNone(achievement['earned_at'])
 
-    def test_lambda_returns_a_200_success_code_with_unearned_achievements_using_defaults(self):
+    @patch('functions.achievements.GetAchievements.index.validate_pagination_token')
+    def test_lambda_returns_the_page_after_the_start_key(self, mock_validate_pagination_token):
         # Arrange
         event = self.get_lambda_event()
-        event['queryStringParameters'] = None
+        event['queryStringParameters']['start_key'] = json.dumps({'achievement_id': 'ACHIEVEMENT_49', 'order_number': 49})
+        event['queryStringParameters']['paging_token'] = 'token'
+        mock_validate_pagination_token.return_value = True
+        index.ddb_game_table.query.return_value = self.mocked_scan_page_result(51)
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        results_body = json.loads(result['body'])
+        achievements = results_body.get('data').get('achievements')
+        self.assertEqual(['ACHIEVEMENT_50'], [a['achievement_id'] for a in achievements])
+        self.assertIsNone(results_body.get('paging'))
+
+    def test_lambda_reads_the_catalog_once_while_it_is_cached(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+
+        # Act
+        first_result = index.lambda_handler(event, None)
+        second_result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, first_result['statusCode'])
+        self.assertEqual(200, second_result['statusCode'])
+        index.ddb_game_table.query.assert_called_once()
+        index.ddb_game_table.scan.assert_not_called()
+        self.assertEqual(2, index.ddb_resource.batch_get_item.call_count)
+
+    def test_lambda_scans_for_visible_achievements_when_the_index_is_empty(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.query.return_value = self.mocked_scan_hidden_result()
         index.ddb_game_table.scan.return_value = self.mocked_scan_result()
 
         # Act
         result = index.lambda_handler(event, None)
 
         # Assert
+        self.assertEqual(200, result['statusCode'])
         index.ddb_game_table.scan.assert_called_once()
+        achievements = json.loads(result['body']).get('data').get('achievements')
+        self.assertEqual(['EAT_THOUSAND_BANANAS'], [a['achievement_id'] for a in achievements])
+
+    def test_lambda_returns_a_200_success_code_with_unearned_achievements_using_defaults(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = None
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        index.ddb_game_table.query.assert_called_once()
         self.assertEqual(200, result['statusCode'])
 
         results_body = json.loads(result['body'])
@@ -159,6 +217,187 @@ class TestIndex(TestCase):
         self.assertEqual(False, achievement['earned'])
         self.assertIsNone(achievement['earned_at'])
 
+    def test_lambda_reads_the_player_achievements_of_a_page_in_one_request(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'limit': '100'}
+        page_size = 100
+        index.ddb_game_table.query.return_value = self.mocked_scan_page_result(page_size)
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result(
+            [self.mocked_player_achievement(f'ACHIEVEMENT_{i}') for i in range(0, page_size, 2)])
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        request_count = index.ddb_game_table.query.call_count + index.ddb_resource.batch_get_item.call_count
+        print(f'GetAchievements: {request_count} DynamoDB requests for a page of {page_size} achievements')
+        self.assertEqual(2, request_count)
+
+        keys = index.ddb_resource.batch_get_item.call_args.kwargs['RequestItems'][PLAYER_ACHIEVEMENTS_TABLE_NAME]['Keys']
+        self.assertEqual(page_size, len(keys))
+
+        achievements = json.loads(result['body']).get('data').get('achievements')
+        self.assertEqual(page_size, len(achievements))
+        self.assertEqual(page_size // 2, len([a for a in achievements if a['earned']]))
+        self.assertEqual(5, achievements[0]['current_value'])
+        self.assertEqual(0, achievements[1]['current_value'])
+        self.assertIsNone(achievements[1]['earned_at'])
+
+    @patch('functions.achievements.GetAchievements.index.time.sleep')
+    def test_lambda_retries_unprocessed_player_achievement_keys(self, mock_sleep: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        unprocessed_keys = {
+            PLAYER_ACHIEVEMENTS_TABLE_NAME: {
+                'Keys': [{'player_id': '12345678-1234-1234-1234-123456789012', 'achievement_id': 'EAT_THOUSAND_BANANAS'}],
+                'ConsistentRead': True
+            }
+        }
+        index.ddb_resource.batch_get_item.side_effect = [
+            self.mocked_batch_get_item_result([], unprocessed_keys),
+            self.mocked_batch_get_item_result([self.mocked_player_achievement()])
+        ]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(2, index.ddb_resource.batch_get_item.call_count)
+        index.ddb_resource.batch_get_item.assert_called_with(RequestItems=unprocessed_keys)
+
+        achievements = json.loads(result['body']).get('data').get('achievements')
+        self.assertEqual(True, achievements[0]['earned'])
+        mock_sleep.assert_called_once()
+
+    @patch('functions.achievements.GetAchievements.index.time.sleep')
+    def test_lambda_stops_retrying_unprocessed_player_achievement_keys(self, mock_sleep: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        unprocessed_keys = {
+            PLAYER_ACHIEVEMENTS_TABLE_NAME: {
+                'Keys': [{'player_id': '12345678-1234-1234-1234-123456789012', 'achievement_id': 'EAT_THOUSAND_BANANAS'}],
+                'ConsistentRead': True
+            }
+        }
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([], unprocessed_keys)
+
+        # Act / Assert
+        with self.assertRaises(RuntimeError):
+            index.lambda_handler(event, None)
+        self.assertEqual(index.MAX_READ_ATTEMPTS, index.ddb_resource.batch_get_item.call_count)
+        self.assertEqual(index.MAX_READ_ATTEMPTS - 1, mock_sleep.call_count)
+        for (delay,), _ in mock_sleep.call_args_list:
+            self.assertLessEqual(delay, index.RETRY_MAX_DELAY_SECONDS)
+
+    def test_lambda_returns_only_the_achievements_updated_since_the_cursor(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters']['updated_since'] = '2021-07-28T00:00:00+00:00'
+        page_size = 10
+        index.ddb_game_table.query.return_value = self.mocked_scan_page_result(page_size)
+        index.ddb_resource.Table.return_value.query.return_value = {
+            'Items': [self.mocked_player_achievement('ACHIEVEMENT_3')]
+        }
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_resource.batch_get_item.assert_not_called()
+        player_query = index.ddb_resource.Table.return_value.query
+        player_query.assert_called_once()
+        self.assertTrue(player_query.call_args.kwargs['ConsistentRead'])
+
+        data = json.loads(result['body']).get('data')
+        self.assertEqual(['ACHIEVEMENT_3'], [a['achievement_id'] for a in data['achievements']])
+        self.assertEqual(5, data['achievements'][0]['current_value'])
+        self.assertEqual(page_size, data['total_count'])
+        self.assertIsNotNone(data['as_of'])
+
+    def test_lambda_returns_the_achievements_whose_definition_changed_since_the_cursor(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters']['updated_since'] = '2021-07-27T10:00:00Z'
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        index.ddb_resource.Table.return_value.query.return_value = {'Items': []}
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_resource.batch_get_item.assert_called_once()
+        achievements = json.loads(result['body']).get('data').get('achievements')
+        self.assertEqual(['EAT_THOUSAND_BANANAS'], [a['achievement_id'] for a in achievements])
+        self.assertEqual(0, achievements[0]['current_value'])
+        self.assertEqual(False, achievements[0]['earned'])
+        self.assertEqual('2021-07-27T16:54:29.130692+00:00', achievements[0]['definition_updated_at'])
+
+    def test_lambda_reads_every_page_of_the_player_achievements_updated_since_the_cursor(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters']['updated_since'] = '2021-07-28T00:00:00+00:00'
+        index.ddb_game_table.query.return_value = self.mocked_scan_page_result(10)
+        last_key = {'player_id': '12345678-1234-1234-1234-123456789012', 'achievement_id': 'ACHIEVEMENT_1'}
+        index.ddb_resource.Table.return_value.query.side_effect = [
+            {'Items': [self.mocked_player_achievement('ACHIEVEMENT_1')], 'LastEvaluatedKey': last_key},
+            {'Items': [self.mocked_player_achievement('ACHIEVEMENT_7')]}
+        ]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        player_query = index.ddb_resource.Table.return_value.query
+        self.assertEqual(2, player_query.call_count)
+        self.assertEqual(last_key, player_query.call_args.kwargs['ExclusiveStartKey'])
+        achievements = json.loads(result['body']).get('data').get('achievements')
+        self.assertEqual(['ACHIEVEMENT_1', 'ACHIEVEMENT_7'], [a['achievement_id'] for a in achievements])
+
+    def test_lambda_returns_a_400_error_code_when_updated_since_is_invalid(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters']['updated_since'] = 'yesterday'
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_game_table)
+        index.ddb_resource.Table.return_value.query.assert_not_called()
+
+    def test_lambda_returns_cbor_when_the_request_accepts_it(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Accept'] = 'application/cbor'
+        index.ddb_game_table.query.return_value = self.mocked_scan_result()
+        index.ddb_resource.batch_get_item.return_value = self.mocked_batch_get_item_result([self.mocked_player_achievement()])
+        json_result = index.lambda_handler(self.get_lambda_event(), None)
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual('application/cbor', result['headers']['Content-Type'])
+        self.assertTrue(result['isBase64Encoded'])
+        body = base64.b64decode(result['body'])
+        self.assertLess(len(body), len(json_result['body']))
+
+        achievements = cbor.loads(body).get('data').get('achievements')
+        json_achievements = json.loads(json_result['body']).get('data').get('achievements')
+        self.assertEqual([a['achievement_id'] for a in json_achievements], [a['achievement_id'] for a in achievements])
+        self.assertEqual(5, achievements[0]['current_value'])
+        self.assertEqual(True, achievements[0]['earned'])
+
     @staticmethod
     def get_lambda_event():
         return {
@@ -220,6 +459,7 @@ class TestIndex(TestCase):
     @staticmethod
     def assert_did_not_call_dynamodb(mock_dynamodb):
         mock_dynamodb.scan.assert_not_called()
+        mock_dynamodb.query.assert_not_called()
         mock_dynamodb.get_item.assert_not_called()
 
     @staticmethod
@@ -256,15 +496,39 @@ class TestIndex(TestCase):
         }
 
     @staticmethod
-    def mocked_get_item_result():
+    def mocked_scan_page_result(page_size):
         return {
-            'Item': {
-                'updated_at': '2021-07-28T03:37:37.267711+00:00',
-                'created_at': '2021-07-28T03:37:32.227830+00:00',
-                'earned': True,
-                'achievement_id': 'EAT_THOUSAND_BANANAS',
-                'current_value': 5,
-                'player_id': '12345678-1234-1234-1234-123456789012',
-                'earned_at': '2021-07-28T03:37:37.267711+00:00'
-            }
+            'Items': [
+                {
+                    'achievement_id': f'ACHIEVEMENT_{i}',
+                    'title': f'Achievement {i}',
+                    'max_value': 10,
+                    'points': 10,
+                    'order_number': i,
+                    'is_hidden': False
+                } for i in range(page_size)
+            ],
+            'Count': page_size,
+            'ScannedCount': page_size
+        }
+
+    @staticmethod
+    def mocked_player_achievement(achievement_id='EAT_THOUSAND_BANANAS'):
+        return {
+            'updated_at': '2021-07-28T03:37:37.267711+00:00',
+            'created_at': '2021-07-28T03:37:32.227830+00:00',
+            'earned': True,
+            'achievement_id': achievement_id,
+            'current_value': 5,
+            'player_id': '12345678-1234-1234-1234-123456789012',
+            'earned_at': '2021-07-28T03:37:37.267711+00:00'
+        }
+
+    @staticmethod
+    def mocked_batch_get_item_result(player_achievements, unprocessed_keys=None):
+        return {
+            'Responses': {
+                PLAYER_ACHIEVEMENTS_TABLE_NAME: player_achievements
+            },
+            'UnprocessedKeys': unprocessed_keys or {}
         }
@@ -0,0 +1,112 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+from unittest import TestCase
+from unittest.mock import patch, MagicMock, ANY
+
+# Pillow is provided by the ImageProcessingLambdaLayer, which is only built for the Lambda runtime
+mock_pil = MagicMock()
+with patch.dict(sys.modules, {'PIL': mock_pil, 'PIL.Image': mock_pil.Image}):
+    with patch("boto3.resource") as boto_resource_mock:
+        from functions.achievements.ResizeIcon import index
+
+
+class TestIndex(TestCase):
+    def setUp(self):
+        index.s3_resource = MagicMock()
+        index.s3_resource.Object.return_value.get.return_value.__getitem__.return_value.read.return_value = b'source png'
+        index.Image = MagicMock()
+        self.source_img = index.Image.open.return_value
+        self.source_img.format = 'PNG'
+        self.source_img.get_format_mimetype.return_value = 'image/png'
+
+    @patch.dict(os.environ, {
+        'RESIZE_WIDTH': '100',
+        'RESIZE_HEIGHT': '100',
+        'DESTINATION_PREFIX': 'icons',
+        'ICON_SIZES': '64,128,256'
+    })
+    def test_lambda_writes_the_resized_icon_and_one_variant_per_size(self):
+        # Arrange
+        event = self.get_lambda_event()
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        written_keys = [call.args[1] for call in index.s3_resource.Object.call_args_list]
+        self.assertEqual(['uploads/trophy.png', 'icons/trophy.png', 'icons/trophy_64.png', 'icons/trophy_128.png', 'icons/trophy_256.png'], written_keys)
+        resized_sizes = [call.args[0] for call in self.source_img.resize.call_args_list]
+        self.assertEqual([(100, 100), (64, 64), (128, 128), (256, 256)], resized_sizes)
+        self.source_img.resize.return_value.save.assert_called_with(ANY, 'PNG', optimize=True)
+        index.s3_resource.Object('bucket', 'uploads/trophy.png').delete.assert_called_once()
+
+    @patch.dict(os.environ, {
+        'RESIZE_WIDTH': '100',
+        'RESIZE_HEIGHT': '100',
+        'DESTINATION_PREFIX': 'icons'
+    })
+    def test_lambda_only_writes_the_resized_icon_when_no_sizes_are_configured(self):
+        # Arrange
+        event = self.get_lambda_event()
+        os.environ.pop('ICON_SIZES', None)
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        written_keys = [call.args[1] for call in index.s3_resource.Object.call_args_list]
+        self.assertEqual(['uploads/trophy.png', 'icons/trophy.png'], written_keys)
+
+    @patch.dict(os.environ, {
+        'RESIZE_WIDTH': '100',
+        'RESIZE_HEIGHT': '100',
+        'DESTINATION_PREFIX': 'icons',
+        'ICON_SIZES': '64',
+        'ICON_CACHE_SECONDS': '86400'
+    })
+    def test_lambda_writes_the_icons_with_a_cache_control_header(self):
+        # Arrange
+        event = self.get_lambda_event()
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        put_calls = index.s3_resource.Object.return_value.put.call_args_list
+        self.assertEqual(2, len(put_calls))
+        for put_call in put_calls:
+            self.assertEqual('public, max-age=86400', put_call.kwargs['CacheControl'])
+
+    @patch.dict(os.environ, {
+        'RESIZE_WIDTH': '100',
+        'RESIZE_HEIGHT': '100',
+        'DESTINATION_PREFIX': 'icons',
+        'ICON_CACHE_SECONDS': '0'
+    })
+    def test_lambda_writes_the_icons_without_a_cache_control_header_when_caching_is_disabled(self):
+        # Arrange
+        event = self.get_lambda_event()
+        os.environ.pop('ICON_SIZES', None)
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        put_call = index.s3_resource.Object.return_value.put.call_args
+        self.assertNotIn('CacheControl', put_call.kwargs)
+
+    @staticmethod
+    def get_lambda_event():
+        return {
+            'Records': [
+                {
+                    's3': {
+                        'bucket': {'name': 'bucket'},
+                        'object': {'key': 'uploads/trophy.png'}
+                    }
+                }
+            ]
+        }
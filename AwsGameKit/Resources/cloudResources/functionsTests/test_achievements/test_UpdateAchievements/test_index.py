@@ -5,21 +5,29 @@ import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock
 
+import botocore
+
 with patch.dict(os.environ, {
     'ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_game_achievements',
-    'PLAYER_ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements'
+    'PLAYER_ACHIEVEMENTS_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements',
+    'PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME': 'gamekit_dev_foogamename_player_achievements_summary'
     }) as env_mock:
     with patch("boto3.client") as boto_resource_mock:
         with patch("gamekithelpers.ddb.get_table") as layer_boto_mock:
             from functions.achievements.UpdateAchievements import index
+            from gamekithelpers import idempotency, throttle
 
 
 class TestIndex(TestCase):
     @patch('functions.achievements.UpdateAchievements.index.ddb.boto3')
     def setUp(self, mock_boto3: MagicMock):
         index.ddb_client = MagicMock()
+        index.ddb_client.exceptions.TransactionCanceledException = TransactionCanceledException
         index.ddb_game_table = mock_boto3.resource('dynamodb').Table('test_table')
         index.ddb_player_table = mock_boto3.resource('dynamodb').Table('test_player_table')
+        index.player_rate_limiter = throttle.PlayerRateLimiter(rate_limit=0, burst_limit=0)
+        index.idempotency_store = idempotency.IdempotencyStore(None, 0)
+        index.ddb_stats_table = None
 
     def test_lambda_returns_a_400_error_code_when_body_is_empty(self):
         # Arrange
@@ -105,6 +113,129 @@ class TestIndex(TestCase):
         self.assertEqual(401, result['statusCode'])
         self.assert_did_not_call_dynamodb(index.ddb_game_table)
 
+    def test_lambda_returns_a_429_error_code_when_the_player_is_over_the_rate_limit(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.player_rate_limiter = throttle.PlayerRateLimiter(rate_limit=0.5, burst_limit=1)
+        index.player_rate_limiter.try_acquire(event['requestContext']['authorizer']['claims']['custom:gk_user_id'])
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(429, result['statusCode'])
+        self.assertEqual('2', result['headers']['Retry-After'])
+        self.assert_did_not_call_dynamodb(index.ddb_game_table)
+
+    def test_lambda_does_not_limit_the_other_players(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result()
+        index.player_rate_limiter = throttle.PlayerRateLimiter(rate_limit=0.5, burst_limit=1)
+        index.player_rate_limiter.try_acquire('another_player_id')
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+
+    def test_lambda_records_the_response_of_a_new_idempotency_key(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result()
+        index.idempotency_store = self.make_idempotency_store()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_player_table.update_item.assert_called_once()
+        index.idempotency_store.table.put_item.assert_called_once()
+        recorded = index.idempotency_store.table.update_item.call_args.kwargs['ExpressionAttributeValues']
+        self.assertEqual('COMPLETED', recorded[':status'])
+        self.assertEqual(result, recorded[':response'])
+
+    def test_lambda_replays_the_response_of_a_repeated_idempotency_key(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.idempotency_store = self.make_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = ConditionalCheckFailedException()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(event),
+            'response': {'statusCode': 200, 'headers': {'Content-Type': 'application/json'}, 'body': '{"data": {}}'}
+        }}
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual('{"data": {}}', result['body'])
+        self.assertEqual('true', result['headers']['Idempotent-Replayed'])
+        self.assert_did_not_call_dynamodb(index.ddb_player_table)
+
+    def test_lambda_returns_a_409_error_code_while_the_idempotency_key_is_in_progress(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.idempotency_store = self.make_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = ConditionalCheckFailedException()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'IN_PROGRESS',
+            'fingerprint': idempotency._fingerprint(event)
+        }}
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(409, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_player_table)
+
+    def test_lambda_returns_a_422_error_code_when_the_idempotency_key_was_used_for_another_request(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.idempotency_store = self.make_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = ConditionalCheckFailedException()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': 'another request',
+            'response': {'statusCode': 200, 'headers': {}, 'body': '{}'}
+        }}
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(422, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_player_table)
+
+    def test_lambda_releases_the_idempotency_key_when_the_update_fails(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_client.exceptions.ConditionalCheckFailedException = ConditionalCheckFailedException
+        index.ddb_player_table.update_item.side_effect = botocore.exceptions.ClientError(
+            {'Error': {'Code': 'InternalServerError', 'Message': ''}}, 'UpdateItem')
+        index.idempotency_store = self.make_idempotency_store()
+
+        # Act
+        with self.assertRaises(botocore.exceptions.ClientError):
+            index.lambda_handler(event, None)
+
+        # Assert
+        index.idempotency_store.table.delete_item.assert_called_once()
+        index.idempotency_store.table.update_item.assert_not_called()
+
     def test_lambda_returns_a_200_success_code_when_incrementing(self):
         # Arrange
         event = self.get_lambda_event()
@@ -117,7 +248,148 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(200, result['statusCode'])
         index.ddb_player_table.get_item.assert_called_once()
-        self.assertEqual(index.ddb_player_table.update_item.call_count, 2)
+        index.ddb_player_table.update_item.assert_called_once()
+        index.ddb_client.transact_write_items.assert_not_called()
+
+    def test_lambda_unlocks_the_achievement_and_updates_the_summary_in_one_transaction(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"increment_by": 1001}'
+        # The game and player tables are the same mock: the achievement is read first, then the player achievement
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(),
+                                                     {'Item': self.mocked_get_player_achievement_result()}]
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result(current_value=1001,
+                                                                                                earned=False)
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"newly_earned": true', result['body'])
+        self.assertIn('"earned": true', result['body'])
+        # The unlocked player achievement isn't read back
+        index.ddb_game_table.get_item.assert_called_once()
+        index.ddb_client.transact_write_items.assert_called_once()
+        transact_items = index.ddb_client.transact_write_items.call_args.kwargs['TransactItems']
+        unlock, summary = [item['Update'] for item in transact_items]
+        self.assertEqual('gamekit_dev_foogamename_player_achievements', unlock['TableName'])
+        self.assertEqual({'S': 'EAT_THOUSAND_BANANAS'}, unlock['Key']['achievement_id'])
+        self.assertEqual('gamekit_dev_foogamename_player_achievements_summary', summary['TableName'])
+        self.assertEqual({'N': '10'}, summary['ExpressionAttributeValues'][':points'])
+        self.assertNotIn('ConditionExpression', summary)
+
+    def test_lambda_adds_the_unlock_to_a_shard_of_the_global_stats(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"increment_by": 1001}'
+        index.ddb_stats_table = MagicMock()
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(),
+                                                     {'Item': self.mocked_get_player_achievement_result()}]
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result(current_value=1001,
+                                                                                                earned=False)
+
+        # Act
+        with patch.object(index, 'stats_shard_count', 4):
+            result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_stats_table.update_item.assert_called_once()
+        update = index.ddb_stats_table.update_item.call_args.kwargs
+        self.assertEqual('EAT_THOUSAND_BANANAS', update['Key']['achievement_id'])
+        self.assertIn(update['Key']['shard'], range(4))
+        self.assertEqual('ADD #earned_count :one', update['UpdateExpression'])
+
+    def test_lambda_unlocks_the_achievement_when_the_global_stats_fail(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"increment_by": 1001}'
+        index.ddb_stats_table = MagicMock()
+        index.ddb_stats_table.update_item.side_effect = botocore.exceptions.ClientError(
+            {'Error': {'Code': 'ProvisionedThroughputExceededException'}}, 'UpdateItem')
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(),
+                                                     {'Item': self.mocked_get_player_achievement_result()}]
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result(current_value=1001,
+                                                                                                earned=False)
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"newly_earned": true', result['body'])
+
+    def test_lambda_does_not_count_an_achievement_which_is_already_earned(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(),
+                                                     {'Item': self.mocked_get_player_achievement_result()}]
+        index.ddb_client.exceptions.ConditionalCheckFailedException = ConditionalCheckFailedException
+        index.ddb_player_table.update_item.side_effect = ConditionalCheckFailedException()
+        index.ddb_client.transact_write_items.side_effect = TransactionCanceledException(['ConditionalCheckFailed', 'None'])
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertNotIn('newly_earned', result['body'])
+        index.ddb_client.transact_write_items.assert_not_called()
+
+    def test_lambda_attempts_the_unlock_again_when_the_player_has_max_value_but_has_not_earned_it(self):
+        # Arrange
+        event = self.get_lambda_event()
+        player_achievement = self.mocked_get_player_achievement_result()
+        player_achievement.update({'current_value': 1001, 'earned': False})
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(), {'Item': player_achievement}]
+        index.ddb_client.exceptions.ConditionalCheckFailedException = ConditionalCheckFailedException
+        index.ddb_player_table.update_item.side_effect = ConditionalCheckFailedException()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"newly_earned": true', result['body'])
+        index.ddb_client.transact_write_items.assert_called_once()
+        unlock = index.ddb_client.transact_write_items.call_args.kwargs['TransactItems'][0]['Update']
+        self.assertEqual({'N': '1001'}, unlock['ExpressionAttributeValues'][':current_value'])
+
+    def test_lambda_increments_with_a_single_add(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result()
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        request = index.ddb_player_table.update_item.call_args.kwargs
+        self.assertTrue(request['UpdateExpression'].startswith('ADD #current_value :increment_by'))
+        self.assertEqual('ALL_NEW', request['ReturnValues'])
+
+    @patch('functions.achievements.UpdateAchievements.index.time.sleep')
+    def test_lambda_attempts_the_unlock_again_after_a_transaction_conflict(self, mock_sleep: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"increment_by": 1001}'
+        index.ddb_game_table.get_item.side_effect = [self.mocked_get_achievement_result(),
+                                                     {'Item': self.mocked_get_player_achievement_result()}]
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result(current_value=1001,
+                                                                                                earned=False)
+        index.ddb_client.transact_write_items.side_effect = [TransactionCanceledException(['None', 'TransactionConflict']),
+                                                             {}]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"newly_earned": true', result['body'])
+        self.assertEqual(2, index.ddb_client.transact_write_items.call_count)
+        mock_sleep.assert_called_once()
 
     def test_lambda_returns_a_404_error_code_when_incrementing_hidden_achievement(self):
         # Arrange
@@ -144,6 +416,137 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(404, result['statusCode'])
 
+    def test_batch_returns_a_400_error_code_when_achievements_are_missing(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{}')
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_game_table)
+
+    def test_batch_returns_a_400_error_code_when_an_increment_is_not_positive(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}, '
+                                            '{"achievement_id": "CLIMB_TREE", "increment_by": 0}]}')
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_game_table)
+
+    def test_batch_returns_a_400_error_code_when_there_are_too_many_achievements(self):
+        # Arrange
+        updates = ', '.join(f'{{"achievement_id": "ACHIEVEMENT_{i}", "increment_by": 1}}' for i in range(index.MAX_BATCH_SIZE + 1))
+        event = self.get_batch_lambda_event(f'{{"achievements": [{updates}]}}')
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        self.assert_did_not_call_dynamodb(index.ddb_game_table)
+
+    def test_batch_returns_a_200_success_code_with_all_updated_achievements(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}, '
+                                            '{"achievement_id": "CLIMB_TREE", "increment_by": 2}]}')
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(2, index.ddb_player_table.update_item.call_count)
+        self.assertIn('"not_found": []', result['body'])
+        index.ddb_client.transact_write_items.assert_not_called()
+
+    def test_batch_adds_up_the_increments_of_a_repeated_achievement(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}, '
+                                            '{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 2}]}')
+        index.ddb_game_table.get_item.return_value = self.mocked_get_achievement_result()
+        index.ddb_player_table.update_item.return_value = self.update_player_achievement_result()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.ddb_player_table.update_item.assert_called_once()
+        self.assertEqual(3, index.ddb_player_table.update_item.call_args.kwargs['ExpressionAttributeValues'][':increment_by'])
+
+    def test_batch_returns_hidden_achievements_as_not_found(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}]}')
+        index.ddb_game_table.get_item.return_value = self.mocked_get_hidden_achievement_result()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"achievements": []', result['body'])
+        self.assertIn('"not_found": ["EAT_THOUSAND_BANANAS"]', result['body'])
+        index.ddb_player_table.update_item.assert_not_called()
+
+    def test_batch_records_the_response_when_one_update_fails(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}, '
+                                            '{"achievement_id": "CLIMB_TREE", "increment_by": 2}]}')
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.ddb_game_table.get_item.side_effect = self.mocked_get_achievement_result_for_key
+        index.ddb_client.exceptions.ConditionalCheckFailedException = ConditionalCheckFailedException
+        index.ddb_player_table.update_item.side_effect = self.fail_update_of('CLIMB_TREE')
+        index.idempotency_store = self.make_idempotency_store()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertIn('"failed": ["CLIMB_TREE"]', result['body'])
+        self.assertIn('"achievement_id": "EAT_THOUSAND_BANANAS"', result['body'])
+        index.idempotency_store.table.delete_item.assert_not_called()
+        recorded = index.idempotency_store.table.update_item.call_args.kwargs['ExpressionAttributeValues']
+        self.assertEqual('COMPLETED', recorded[':status'])
+        self.assertEqual(result, recorded[':response'])
+
+    def test_batch_releases_the_idempotency_key_when_every_update_fails(self):
+        # Arrange
+        event = self.get_batch_lambda_event('{"achievements": [{"achievement_id": "EAT_THOUSAND_BANANAS", "increment_by": 1}, '
+                                            '{"achievement_id": "CLIMB_TREE", "increment_by": 2}]}')
+        event['headers']['Idempotency-Key'] = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+        index.ddb_game_table.get_item.side_effect = self.mocked_get_achievement_result_for_key
+        index.ddb_client.exceptions.ConditionalCheckFailedException = ConditionalCheckFailedException
+        index.ddb_player_table.update_item.side_effect = botocore.exceptions.ClientError(
+            {'Error': {'Code': 'InternalServerError', 'Message': ''}}, 'UpdateItem')
+        index.idempotency_store = self.make_idempotency_store()
+
+        # Act
+        with self.assertRaises(botocore.exceptions.ClientError):
+            index.lambda_handler(event, None)
+
+        # Assert
+        index.idempotency_store.table.delete_item.assert_called_once()
+        index.idempotency_store.table.update_item.assert_not_called()
+
+    @classmethod
+    def get_batch_lambda_event(cls, body):
+        event = cls.get_lambda_event()
+        event['resource'] = '/achievements/unlock'
+        event['path'] = '/achievements/unlock'
+        event['pathParameters'] = None
+        event['requestContext']['resourcePath'] = '/achievements/unlock'
+        event['body'] = body
+        return event
+
     @staticmethod
     def get_lambda_event():
         return {
@@ -252,6 +655,22 @@ class TestIndex(TestCase):
             }
         }
 
+    @classmethod
+    def mocked_get_achievement_result_for_key(cls, **kwargs):
+        result = cls.mocked_get_achievement_result()
+        result['Item']['achievement_id'] = kwargs['Key']['achievement_id']
+        return result
+
+    @classmethod
+    def fail_update_of(cls, failed_achievement_id):
+        def update_item(**kwargs):
+            if kwargs['Key']['achievement_id'] == failed_achievement_id:
+                raise botocore.exceptions.ClientError({'Error': {'Code': 'InternalServerError', 'Message': ''}}, 'UpdateItem')
+            result = cls.update_player_achievement_result()
+            result['Attributes']['achievement_id'] = kwargs['Key']['achievement_id']
+            return result
+        return update_item
+
     @staticmethod
     def mocked_get_empty_achievement_result():
         # Note - For a real empty result there would be metadata here, but that is not needed for testing
@@ -300,14 +719,14 @@ class TestIndex(TestCase):
         }
 
     @staticmethod
-    def update_player_achievement_result():
+    def update_player_achievement_result(current_value=5, earned=True):
         return {
             'Attributes': {
                 'updated_at': '2021-07-28T03:37:37.267711+00:00',
                 'created_at': '2021-07-28T03:37:32.227830+00:00',
-                'earned': True,
+                'earned': earned,
                 'achievement_id': 'EAT_THOUSAND_BANANAS',
-                'current_value': 5,
+                'current_value': current_value,
                 'player_id': '12345678-1234-1234-1234-123456789012',
                 'earned_at': '2021-07-28T03:37:37.267711+00:00'
             }
@@ -325,7 +744,25 @@ class TestIndex(TestCase):
             'earned_at': '2021-07-28T03:37:37.267711+00:00'
         }
 
+    @staticmethod
+    def make_idempotency_store():
+        store = idempotency.IdempotencyStore(None, 3600)
+        store.table = MagicMock()
+        return store
+
     @staticmethod
     def assert_did_not_call_dynamodb(mock_dynamodb):
         mock_dynamodb.get_item.assert_not_called()
         mock_dynamodb.update_item.assert_not_called()
+
+
+class ConditionalCheckFailedException(botocore.exceptions.ClientError):
+    def __init__(self, *args):
+        super().__init__({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'UpdateItem')
+
+
+class TransactionCanceledException(botocore.exceptions.ClientError):
+    def __init__(self, reasons):
+        super().__init__({'Error': {'Code': 'TransactionCanceledException', 'Message': ''},
+                          'CancellationReasons': [{'Code': reason} for reason in reasons]},
+                         'TransactWriteItems')
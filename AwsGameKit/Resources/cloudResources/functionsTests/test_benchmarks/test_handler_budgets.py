@@ -0,0 +1,122 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Checks the number of AWS calls each benchmarked Lambda handler makes per request against its budget in budgets.json.
+
+Run this module directly to print the import time, CPU time and AWS calls of every handler:
+python -m functionsTests.test_benchmarks.test_handler_budgets
+"""
+import json
+import os
+from decimal import Decimal
+from typing import List
+from unittest import TestCase
+
+from functionsTests.helpers.benchmark import HandlerBenchmark, HandlerScenario, format_report, run_scenario
+from functionsTests.helpers.boto3.mock_responses.DynamoDB.Client import Query as ClientQuery
+from functionsTests.helpers.boto3.mock_responses.DynamoDB.Table import GetItem, Query
+from functionsTests.helpers.sample_lambda_events import http_event
+
+BUDGETS_PATH = os.path.join(os.path.dirname(__file__), 'budgets.json')
+
+ACHIEVEMENTS_TABLE_NAME = 'gamekit_dev_foogamename_game_achievements'
+PLAYER_ACHIEVEMENTS_TABLE_NAME = 'gamekit_dev_foogamename_player_achievements'
+PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME = 'gamekit_dev_foogamename_player_achievements_summary'
+
+
+def get_achievement(index: int) -> dict:
+    return {
+        'achievement_id': f'achievement_{index}',
+        'title': f'Achievement {index}',
+        'points': Decimal(10),
+        'max_value': Decimal(5),
+        'order_number': Decimal(index),
+        'is_hidden': False,
+        'is_secret': False,
+        'updated_at': '2022-01-01T00:00:00+00:00'
+    }
+
+
+def get_scenarios() -> List[HandlerScenario]:
+    achievements = [get_achievement(index) for index in range(20)]
+    return [
+        HandlerScenario(
+            module='functions.usergamedata.GetBundle.index',
+            event=http_event(path_parameters={'bundle_name': 'stats'}),
+            environment={'BUNDLES_TABLE_NAME': 'bundles_table', 'BUNDLE_ITEMS_TABLE_NAME': 'bundle_items_table'},
+            responses={'dynamodb': {'query': ClientQuery.mock_response(items=[
+                {'player_id_bundle': {'S': 'foo_player_id_stats'}, 'bundle_item_key': {'S': f'key_{index}'}, 'bundle_item_value': {'S': str(index)}}
+                for index in range(20)
+            ])}}),
+        HandlerScenario(
+            module='functions.usergamedata.Add.index',
+            event=http_event(http_method='POST', path_parameters={'bundle_name': 'stats'},
+                             body=json.dumps({f'key_{index}': str(index) for index in range(5)})),
+            environment={'BUNDLES_TABLE_NAME': 'bundles_table', 'BUNDLE_ITEMS_TABLE_NAME': 'bundle_items_table'},
+            responses={'dynamodb': {'update_item': {}}}),
+        HandlerScenario(
+            module='functions.achievements.GetAchievements.index',
+            event=http_event(),
+            environment={'ACHIEVEMENTS_TABLE_NAME': ACHIEVEMENTS_TABLE_NAME,
+                         'PLAYER_ACHIEVEMENTS_TABLE_NAME': PLAYER_ACHIEVEMENTS_TABLE_NAME},
+            responses={'dynamodb': {
+                'query': Query.mock_response(items=achievements),
+                'batch_get_item': {'Responses': {PLAYER_ACHIEVEMENTS_TABLE_NAME: [
+                    {'player_id': 'foo_player_id', 'achievement_id': 'achievement_0', 'current_value': Decimal(1), 'earned': False}
+                ]}}
+            }}),
+        HandlerScenario(
+            module='functions.achievements.UpdateAchievements.index',
+            event=http_event(http_method='POST', path_parameters={'achievement_id': 'achievement_0'},
+                             body=json.dumps({'increment_by': 1})),
+            environment={'ACHIEVEMENTS_TABLE_NAME': ACHIEVEMENTS_TABLE_NAME,
+                         'PLAYER_ACHIEVEMENTS_TABLE_NAME': PLAYER_ACHIEVEMENTS_TABLE_NAME,
+                         'PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME': PLAYER_ACHIEVEMENTS_SUMMARY_TABLE_NAME},
+            responses={'dynamodb': {
+                'get_item': GetItem.mock_response(item=achievements[0]),
+                'update_item': {'Attributes': {'player_id': 'foo_player_id', 'achievement_id': 'achievement_0',
+                                               'current_value': Decimal(1), 'earned': False}}
+            }}),
+        HandlerScenario(
+            module='functions.gamesaving.GetAllSlotsMetadata.index',
+            event=http_event(),
+            environment={'GAMESAVES_TABLE_NAME': 'gamekit_dev_foogamename_player_gamesaves'},
+            responses={'dynamodb': {'query': Query.mock_response(items=[
+                {'player_id': 'foo_player_id', 'slot_name': f'slot_{index}', 'last_modified': 1626924349000,
+                 'description': '', 'size': Decimal(1024)}
+                for index in range(10)
+            ])}}),
+    ]
+
+
+def run_benchmarks() -> List[HandlerBenchmark]:
+    return [run_scenario(scenario) for scenario in get_scenarios()]
+
+
+class TestHandlerBudgets(TestCase):
+
+    def setUp(self):
+        with open(BUDGETS_PATH) as budgets_file:
+            self.budgets = json.load(budgets_file)
+
+    def test_every_benchmarked_handler_has_a_budget(self):
+        for scenario in get_scenarios():
+            self.assertIn(scenario.module, self.budgets)
+
+    def test_handlers_stay_within_their_aws_call_budgets(self):
+        # Act
+        benchmarks = run_benchmarks()
+
+        # Assert
+        for benchmark in benchmarks:
+            self.assertTrue(all(200 <= status_code < 300 for status_code in benchmark.status_codes),
+                            f'{benchmark.module} failed: {benchmark.status_codes}')
+
+        exceeded = [message for benchmark in benchmarks
+                    for message in benchmark.exceeded_budgets(self.budgets.get(benchmark.module, {}))]
+        self.assertEqual([], exceeded)
+
+
+if __name__ == '__main__':
+    print(format_report(run_benchmarks()))
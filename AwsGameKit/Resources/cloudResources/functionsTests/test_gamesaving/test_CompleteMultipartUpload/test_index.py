@@ -0,0 +1,144 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+with patch("boto3.client") as boto_client_mock:
+    from functions.gamesaving.CompleteMultipartUpload import index
+
+from functionsTests.helpers.sample_lambda_events import http_event
+
+
+# Patch Lambda environment variables:
+@patch.dict(os.environ, {
+    'GAMESAVES_BUCKET_NAME': 'gamekit-dev-123456789012-foogamename-player-gamesaves'
+})
+class TestIndex(TestCase):
+    def setUp(self):
+        index.s3_client = MagicMock()
+        index.s3_client.exceptions.NoSuchUpload = type('NoSuchUpload', (Exception,), {})
+
+    def test_can_complete_multipart_upload(self):
+        # Arrange
+        event = self.get_lambda_event()
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        index.s3_client.complete_multipart_upload.assert_called_once_with(
+            Bucket='gamekit-dev-123456789012-foogamename-player-gamesaves',
+            Key='foo_player_id/foo_slot_name',
+            UploadId='foo_upload_id',
+            MultipartUpload={'Parts': [
+                {'ETag': '"etag1"', 'PartNumber': 1},
+                {'ETag': '"etag2"', 'PartNumber': 2},
+            ]},
+        )
+
+    def test_lambda_returns_a_400_error_code_when_the_parts_are_malformed(self):
+        sub_tests = [
+            ('missing parts', None),
+            ('no parts', []),
+            ('duplicate part numbers', [{'part_number': 1, 'etag': 'a'}, {'part_number': 1, 'etag': 'b'}]),
+            ('part number out of range', [{'part_number': 0, 'etag': 'a'}]),
+            ('missing etag', [{'part_number': 1}]),
+            ('part number is not an integer', [{'part_number': '1', 'etag': 'a'}]),
+        ]
+
+        for test_name, parts in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event(parts=parts)
+                context = None
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(400, result['statusCode'])
+                index.s3_client.complete_multipart_upload.assert_not_called()
+
+    def test_lambda_returns_a_400_error_code_when_the_upload_id_is_missing(self):
+        # Arrange
+        event = self.get_lambda_event(upload_id=None)
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+
+    def test_lambda_returns_a_400_error_code_when_s3_rejects_the_parts(self):
+        # Arrange
+        event = self.get_lambda_event()
+        context = None
+        index.s3_client.complete_multipart_upload.side_effect = index.botocore.exceptions.ClientError(
+            {'Error': {'Code': 'InvalidPart'}}, 'CompleteMultipartUpload')
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+
+    def test_lambda_returns_a_404_error_code_when_the_upload_id_is_unknown(self):
+        # Arrange
+        event = self.get_lambda_event()
+        context = None
+        index.s3_client.complete_multipart_upload.side_effect = index.s3_client.exceptions.NoSuchUpload()
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(404, result['statusCode'])
+
+    def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['requestContext']['authorizer']['claims'].pop('custom:gk_user_id')
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(401, result['statusCode'])
+
+    def test_lambda_returns_a_400_error_code_when_slot_name_is_malformed(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['pathParameters']['slot_name'] = '$om3 ma!f*rm#d slot name%^z__09'
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+
+    @staticmethod
+    def get_lambda_event(upload_id='foo_upload_id', parts='default') -> dict:
+        if parts == 'default':
+            # Out of order, the Lambda sorts them
+            parts = [{'part_number': 2, 'etag': '"etag2"'}, {'part_number': 1, 'etag': '"etag1"'}]
+
+        body = {}
+        if upload_id is not None:
+            body['upload_id'] = upload_id
+        if parts is not None:
+            body['parts'] = parts
+
+        return http_event(
+            http_method='POST',
+            path_parameters={
+                'slot_name': 'foo_slot_name'
+            },
+            body=json.dumps(body)
+        )
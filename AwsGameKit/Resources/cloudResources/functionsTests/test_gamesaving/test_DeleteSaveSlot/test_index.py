@@ -38,6 +38,21 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(204, result['statusCode'])
 
+    @patch('gamekithelpers.ddb.get_table')
+    def test_delete_save_slot_deletes_delta_mode_chunks(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        mock_bucket = index.s3_resource.Bucket('gamekit-dev-123456789012-foogamename-player-gamesaves')
+        mock_bucket.objects.filter.assert_called_once_with(Prefix='foo_player_id/foo_slot_name/chunks/')
+        mock_bucket.objects.filter().delete.assert_called_once_with(ExpectedBucketOwner='123456789012')
+
     def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
         # Arrange
         event = self.get_lambda_event()
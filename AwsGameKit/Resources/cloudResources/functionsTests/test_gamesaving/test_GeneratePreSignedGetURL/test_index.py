@@ -1,6 +1,7 @@
 # Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 # SPDX-License-Identifier: Apache-2.0
 
+import json
 import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock
@@ -46,6 +47,45 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(200, result['statusCode'])
 
+    def test_can_generate_presigned_urls_for_additional_slot_names(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {
+            'additional_slot_names': 'bar_slot_name,foo_slot_name,baz_slot_name,bar_slot_name'
+        }
+        context = None
+        self.set_presigned_url('foo_url', index.s3_client)
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        body = json.loads(result['body'])['data']
+        self.assertEqual('foo_url', body['url'])
+        self.assertIn('expiration_epoch_time', body)
+        self.assertEqual(['foo_slot_name', 'bar_slot_name', 'baz_slot_name'], [url['slot_name'] for url in body['urls']])
+        self.assertEqual(3, index.s3_client.generate_presigned_url.call_count)
+
+    def test_lambda_returns_a_400_error_code_when_additional_slot_names_are_malformed(self):
+        sub_tests = [
+            ('malformed slot name', 'bar_slot_name,$om3 ma!f*rm#d'),
+            ('too many slot names', ','.join(f'slot_{i}' for i in range(index.MAX_SLOTS_PER_REQUEST))),
+        ]
+
+        for test_name, additional_slot_names in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event()
+                event['queryStringParameters'] = {'additional_slot_names': additional_slot_names}
+                context = None
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(400, result['statusCode'])
+
     def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
         # Arrange
         event = self.get_lambda_event()
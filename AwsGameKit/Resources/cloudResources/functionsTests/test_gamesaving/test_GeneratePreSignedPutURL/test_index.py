@@ -1,6 +1,7 @@
 # Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 # SPDX-License-Identifier: Apache-2.0
 import base64
+import json
 import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock
@@ -174,6 +175,170 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(400, result['statusCode'])
 
+    @patch('gamekithelpers.ddb.get_table')
+    def test_can_start_multipart_upload(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'part_count': '3'}
+        context = None
+        self.set_is_new_save_slot(True, mock_get_table)
+        self.set_would_exceed_slot_limit(False, index.ddb_client)
+        self.set_presigned_url('foo_url', index.s3_client)
+        index.s3_client.create_multipart_upload.return_value = {'UploadId': 'foo_upload_id'}
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        body = json.loads(result['body'])['data']
+        self.assertEqual('foo_upload_id', body['upload_id'])
+        self.assertEqual([1, 2, 3], [part['part_number'] for part in body['part_urls']])
+        self.assertEqual([], body['completed_parts'])
+        index.s3_client.create_multipart_upload.assert_called_once()
+        self.assertEqual(BASE_64_ENCODED_SHA_256_HASH,
+                         index.s3_client.create_multipart_upload.call_args.kwargs['Metadata'][index.S3_HASH_METADATA_KEY])
+        self.assertEqual('upload_part', index.s3_client.generate_presigned_url.call_args.kwargs['ClientMethod'])
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_can_resume_multipart_upload(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'part_count': '3', 'upload_id': 'foo_upload_id'}
+        context = None
+        self.set_is_new_save_slot(False, mock_get_table)
+        self.set_presigned_url('foo_url', index.s3_client)
+        index.s3_client.get_paginator('list_parts').paginate.return_value = [
+            {'Parts': [{'PartNumber': 1, 'ETag': '"etag1"'}]},
+            {'Parts': [{'PartNumber': 3, 'ETag': '"etag3"'}]},
+        ]
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        body = json.loads(result['body'])['data']
+        self.assertEqual('foo_upload_id', body['upload_id'])
+        self.assertEqual([2], [part['part_number'] for part in body['part_urls']])
+        self.assertEqual([{'part_number': 1, 'etag': '"etag1"'}, {'part_number': 3, 'etag': '"etag3"'}], body['completed_parts'])
+        index.s3_client.create_multipart_upload.assert_not_called()
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_lambda_returns_a_404_error_code_when_the_upload_id_is_unknown(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'part_count': '3', 'upload_id': 'foo_upload_id'}
+        context = None
+        self.set_is_new_save_slot(False, mock_get_table)
+        index.s3_client.exceptions.NoSuchUpload = type('NoSuchUpload', (Exception,), {})
+        index.s3_client.get_paginator('list_parts').paginate.side_effect = index.s3_client.exceptions.NoSuchUpload()
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(404, result['statusCode'])
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_lambda_returns_a_400_error_code_when_the_part_count_is_malformed(self, mock_get_table: MagicMock):
+        sub_tests = [
+            ('zero parts', '0', 400),
+            ('too many parts', str(index.MAX_PART_COUNT + 1), 400),
+            ('not a number', 'foo', 400),
+            ('single part', '1', 200),
+        ]
+
+        for test_name, part_count, expected_http_status_code in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event()
+                event['queryStringParameters'] = {'part_count': part_count}
+                context = None
+                self.set_is_new_save_slot(False, mock_get_table)
+                self.set_presigned_url('foo_url', index.s3_client)
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(expected_http_status_code, result['statusCode'])
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_can_generate_presigned_urls_for_additional_slots(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = json.dumps({'additional_slots': [
+            {'slot_name': 'bar_slot_name', 'hash': BASE_64_ENCODED_SHA_256_HASH, 'last_modified_epoch_time': 456},
+            {'slot_name': 'baz_slot_name', 'hash': BASE_64_ENCODED_SHA_256_HASH, 'last_modified_epoch_time': 789,
+             'metadata': self.get_base64_string(16)},
+        ]})
+        context = None
+        self.set_is_new_save_slot(False, mock_get_table)
+        self.set_presigned_url('foo_url', index.s3_client)
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        body = json.loads(result['body'])['data']
+        self.assertEqual(['foo_slot_name', 'bar_slot_name', 'baz_slot_name'], [url['slot_name'] for url in body['urls']])
+        self.assertIn('expiration_epoch_time', body)
+        self.assertEqual(3, index.s3_client.generate_presigned_url.call_count)
+        self.assertEqual('789', index.s3_client.generate_presigned_url.call_args.kwargs['Params']['Metadata'][index.S3_EPOCH_METADATA_KEY])
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_lambda_returns_a_400_error_code_when_the_additional_slots_would_exceed_the_slot_limit(self, mock_get_table: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = json.dumps({'additional_slots': [
+            {'slot_name': f'slot_{i}', 'hash': BASE_64_ENCODED_SHA_256_HASH, 'last_modified_epoch_time': 456}
+            for i in range(MAX_SAVE_SLOTS_PER_PLAYER_FOR_TESTING)
+        ]})
+        context = None
+        self.set_is_new_save_slot(True, mock_get_table)
+        self.set_would_exceed_slot_limit(False, index.ddb_client)
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+        index.s3_client.generate_presigned_url.assert_not_called()
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_lambda_returns_a_400_error_code_when_the_additional_slots_are_malformed(self, mock_get_table: MagicMock):
+        valid_slot = {'slot_name': 'bar_slot_name', 'hash': BASE_64_ENCODED_SHA_256_HASH, 'last_modified_epoch_time': 456}
+        sub_tests = [
+            ('not JSON', 'additional_slots', None),
+            ('not a list', json.dumps({'additional_slots': 'bar_slot_name'}), None),
+            ('malformed slot name', json.dumps({'additional_slots': [{**valid_slot, 'slot_name': 'bar slot%'}]}), None),
+            ('duplicate slot name', json.dumps({'additional_slots': [{**valid_slot, 'slot_name': 'foo_slot_name'}]}), None),
+            ('missing epoch time', json.dumps({'additional_slots': [{'slot_name': 'bar_slot_name', 'hash': BASE_64_ENCODED_SHA_256_HASH}]}), None),
+            ('malformed hash', json.dumps({'additional_slots': [{**valid_slot, 'hash': 'asdfjh12314'}]}), None),
+            ('too many slots', json.dumps({'additional_slots': [
+                {**valid_slot, 'slot_name': f'slot_{i}'} for i in range(index.MAX_SLOTS_PER_REQUEST)
+            ]}), None),
+            ('multipart upload', json.dumps({'additional_slots': [valid_slot]}), {'part_count': '3'}),
+        ]
+
+        for test_name, body, query_string_parameters in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event()
+                event['body'] = body
+                event['queryStringParameters'] = query_string_parameters
+                context = None
+                self.set_is_new_save_slot(False, mock_get_table)
+                self.set_presigned_url('foo_url', index.s3_client)
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(400, result['statusCode'])
+
     def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
         # Arrange
         event = self.get_lambda_event()
@@ -193,6 +193,50 @@ class TestIndex(TestCase):
         self.assertEqual(page_size, kwargs['Limit'])
         self.assertEqual(consistent_read, kwargs['ConsistentRead'])
 
+    @patch('gamekithelpers.ddb.get_table')
+    def test_can_get_only_slot_names_timestamps_and_sizes(self, mock_get_table: MagicMock()):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {
+            'summary_only': 'true'
+        }
+        mock_items = [
+            {key: item[key] for key in ('slot_name', 'last_modified', 'size')} for item in self.get_mock_items()
+        ]
+        mock_gamesaves_table = mock_get_table()
+        mock_gamesaves_table.query.return_value = Query.mock_response(items=mock_items)
+
+        # Act
+        result = index.lambda_handler(event, context=None)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+
+        response_body = json.loads(result['body'])
+        all_slots_metadata = response_body['data']['slots_metadata']
+        self.assertEqual(len(mock_items), len(all_slots_metadata))
+
+        mock_gamesaves_table.query.assert_called_once()
+        args, kwargs = mock_gamesaves_table.query.call_args
+        self.assertEqual('SPECIFIC_ATTRIBUTES', kwargs['Select'])
+        self.assertEqual('#slot_name, #last_modified, #size', kwargs['ProjectionExpression'])
+        self.assertEqual('size', kwargs['ExpressionAttributeNames']['#size'])
+
+    @patch('gamekithelpers.ddb.get_table')
+    def test_all_attributes_are_returned_by_default(self, mock_get_table: MagicMock()):
+        # Arrange
+        event = self.get_lambda_event()
+        mock_gamesaves_table = mock_get_table()
+        mock_gamesaves_table.query.return_value = Query.mock_response(items=self.get_mock_items())
+
+        # Act
+        index.lambda_handler(event, context=None)
+
+        # Assert
+        args, kwargs = mock_gamesaves_table.query.call_args
+        self.assertEqual('ALL_ATTRIBUTES', kwargs['Select'])
+        self.assertNotIn('ProjectionExpression', kwargs)
+
     def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
         # Arrange
         event = self.get_lambda_event()
@@ -0,0 +1,192 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+with patch("boto3.client") as boto_client_mock:
+    from functions.gamesaving.SyncSlotChunks import index
+
+from functionsTests.helpers.sample_lambda_events import http_event
+
+
+TEST_BUCKET_NAME = 'gamekit-dev-123456789012-foogamename-player-gamesaves'
+CHUNKS_PREFIX = 'foo_player_id/foo_slot_name/chunks/'
+CHUNK_A = 'a' * 40
+CHUNK_B = 'b' * 40
+CHUNK_C = 'c' * 64
+
+
+# Patch Lambda environment variables:
+@patch.dict(os.environ, {
+    'GAMESAVES_BUCKET_NAME': TEST_BUCKET_NAME
+})
+class TestIndex(TestCase):
+    def setUp(self):
+        index.s3_client = MagicMock()
+        index.s3_client.generate_presigned_url.side_effect = lambda ClientMethod, Params, ExpiresIn: f'{ClientMethod}:{Params["Key"]}'
+
+    def test_upload_only_returns_urls_for_chunks_which_are_not_stored(self):
+        # Arrange
+        event = self.get_lambda_event('upload', [CHUNK_A, CHUNK_B, CHUNK_C], [100, 200, 300])
+        context = None
+        self.set_stored_chunks([CHUNK_B])
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        chunk_urls = self.get_response_data(result)['chunk_urls']
+        self.assertEqual([
+            {'hash': CHUNK_A, 'url': f'put_object:{CHUNKS_PREFIX}{CHUNK_A}'},
+            {'hash': CHUNK_C, 'url': f'put_object:{CHUNKS_PREFIX}{CHUNK_C}'},
+        ], chunk_urls)
+
+    def test_upload_urls_only_accept_the_chunk_size(self):
+        # Arrange
+        event = self.get_lambda_event('upload', [CHUNK_A, CHUNK_B], [100, index.MAX_CHUNK_SIZE_BYTES])
+        context = None
+        self.set_stored_chunks([])
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        content_lengths = [call[1]['Params']['ContentLength'] for call in index.s3_client.generate_presigned_url.call_args_list]
+        self.assertEqual([100, index.MAX_CHUNK_SIZE_BYTES], content_lengths)
+
+    def test_download_returns_urls_for_every_chunk(self):
+        # Arrange
+        event = self.get_lambda_event('download', [CHUNK_A, CHUNK_B, CHUNK_A])
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        chunk_urls = self.get_response_data(result)['chunk_urls']
+        self.assertEqual([
+            {'hash': CHUNK_A, 'url': f'get_object:{CHUNKS_PREFIX}{CHUNK_A}'},
+            {'hash': CHUNK_B, 'url': f'get_object:{CHUNKS_PREFIX}{CHUNK_B}'},
+        ], chunk_urls)
+        index.s3_client.get_paginator.assert_not_called()
+
+    def test_prune_deletes_chunks_which_are_not_listed(self):
+        # Arrange
+        event = self.get_lambda_event('prune', [CHUNK_B])
+        context = None
+        self.set_stored_chunks([CHUNK_A, CHUNK_B, CHUNK_C])
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(2, self.get_response_data(result)['deleted_count'])
+        index.s3_client.delete_objects.assert_called_once_with(
+            Bucket=TEST_BUCKET_NAME,
+            Delete={
+                'Objects': [{'Key': CHUNKS_PREFIX + CHUNK_A}, {'Key': CHUNKS_PREFIX + CHUNK_C}],
+                'Quiet': True
+            }
+        )
+
+    def test_prune_deletes_in_batches(self):
+        # Arrange
+        event = self.get_lambda_event('prune', [])
+        context = None
+        self.set_stored_chunks([f'{i:040x}' for i in range(index.MAX_DELETE_OBJECTS_KEYS + 1)])
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(2, index.s3_client.delete_objects.call_count)
+
+    def test_lambda_returns_a_400_error_code_when_the_body_is_malformed(self):
+        sub_tests = [
+            ('unknown operation', 'foo', [CHUNK_A]),
+            ('missing operation', None, [CHUNK_A]),
+            ('missing chunks', 'upload', None),
+            ('malformed hash', 'upload', ['not_a_hash']),
+            ('uppercase hash', 'upload', ['A' * 40]),
+            ('too many chunks', 'download', [CHUNK_A] * (index.MAX_CHUNKS_PER_REQUEST + 1)),
+        ]
+        upload_sub_tests = [
+            ('missing chunk sizes', [CHUNK_A], None),
+            ('fewer chunk sizes than chunks', [CHUNK_A, CHUNK_B], [100]),
+            ('empty chunk', [CHUNK_A], [0]),
+            ('chunk too large', [CHUNK_A], [index.MAX_CHUNK_SIZE_BYTES + 1]),
+            ('chunk size not a number', [CHUNK_A], ['100']),
+            ('same chunk with two sizes', [CHUNK_A, CHUNK_A], [100, 200]),
+        ]
+        sub_tests += [(test_name, 'upload', chunks, chunk_sizes) for test_name, chunks, chunk_sizes in upload_sub_tests]
+
+        for test_name, operation, chunks, *chunk_sizes in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event(operation, chunks, *chunk_sizes)
+                context = None
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(400, result['statusCode'])
+
+    def test_lambda_returns_a_401_error_code_when_player_id_is_missing_from_the_request_context(self):
+        # Arrange
+        event = self.get_lambda_event('upload', [CHUNK_A], [100])
+        event['requestContext']['authorizer']['claims'].pop('custom:gk_user_id')
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(401, result['statusCode'])
+
+    def test_lambda_returns_a_400_error_code_when_slot_name_is_malformed(self):
+        # Arrange
+        event = self.get_lambda_event('upload', [CHUNK_A], [100])
+        event['pathParameters']['slot_name'] = '$om3 ma!f*rm#d slot name%^z__09'
+        context = None
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(400, result['statusCode'])
+
+    @staticmethod
+    def get_lambda_event(operation, chunks, chunk_sizes=None) -> dict:
+        body = {}
+        if operation is not None:
+            body['operation'] = operation
+        if chunks is not None:
+            body['chunks'] = chunks
+        if chunk_sizes is not None:
+            body['chunk_sizes'] = chunk_sizes
+
+        return http_event(
+            http_method='POST',
+            path_parameters={
+                'slot_name': 'foo_slot_name'
+            },
+            body=json.dumps(body)
+        )
+
+    @staticmethod
+    def get_response_data(result) -> dict:
+        return json.loads(result['body'])['data']
+
+    @staticmethod
+    def set_stored_chunks(chunks) -> None:
+        index.s3_client.get_paginator('list_objects_v2').paginate.return_value = [
+            {'Contents': [{'Key': CHUNKS_PREFIX + chunk} for chunk in chunks]}
+        ]
@@ -97,6 +97,24 @@ class TestIndex(TestCase):
         # Assert
         self.assertEqual(3, mock_write_metadata_to_dynamodb.call_count)
 
+    @patch('functions.gamesaving.UpdateSlotMetadata.index.write_metadata_to_dynamodb')
+    def test_dynamo_item_is_not_written_for_delta_mode_chunks(self, mock_write_metadata_to_dynamodb: MagicMock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['Records'] = [
+            self.get_record('foo_player_id/foo_slot_name/chunks/' + 'a' * 40),
+            self.get_record('foo_player_id/foo_slot_name'),
+        ]
+        context = None
+        self.set_mock_s3_object_metadata(EMPTY_METADATA, TEST_LAST_MODIFIED_TIME, index.s3_resource)
+        self.set_mock_put_item_response(index.s3_resource)
+
+        # Act
+        index.lambda_handler(event, context)
+
+        # Assert
+        mock_write_metadata_to_dynamodb.assert_called_once_with('foo_player_id', 'foo_slot_name', ANY, ANY, ANY)
+
     @patch('functions.gamesaving.UpdateSlotMetadata.index.write_metadata_to_dynamodb')
     def test_dynamo_item_is_created_with_last_modified_time_matching_s3_object_metadata(self, mock_write_metadata_to_dynamodb: MagicMock):
         # Arrange
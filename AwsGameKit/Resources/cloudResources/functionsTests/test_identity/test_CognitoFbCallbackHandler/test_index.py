@@ -28,6 +28,7 @@ class TestIndex(TestCase):
         index.s3_client = MagicMock()
         index.cidp_client = MagicMock()
         index.dynamodb_client = MagicMock()
+        index.crypto.clear_data_key_cache()
 
     @patch('functions.identity.CognitoFbCallbackHandler.index._get_user_info')
     @patch('functions.identity.CognitoFbCallbackHandler.index._check_object_exists_in_s3')
@@ -15,6 +15,7 @@ with patch("boto3.client") as boto_client_mock:
 class TestIndex(TestCase):
     def setUp(self):
         token_verifier.secrets_manager_client = MagicMock()
+        token_verifier.clear_cache()
 
     @patch('functions.identity.DefaultTokenAuthorizer.token_verifier.boto3')
     def test_secret_not_found_unauthorized(self, mock_boto3):
@@ -119,6 +120,89 @@ class TestIndex(TestCase):
                          result['policyDocument']['Statement'][0]['Resource'][1])
         self.assertEqual('107932416965203234076', result['context']['custom:thirdparty_player_id'])
 
+    @patch.dict(os.environ, {'USER_IDENTIFIER_CLAIM_FIELD': 'sub',
+                             'ENDPOINTS_ALLOWED': 'achievements/*',
+                             'VERIFY_EXPIRATION': 'false'})
+    def test_warm_invocations_reuse_the_jwks_and_the_verification(self):
+        # Arrange
+        event = self.get_lambda_event()
+        token_verifier.secrets_manager_client.get_secret_value.return_value = self.get_secret_value_response(self.jwk_set())
+
+        # Act
+        with patch.object(token_verifier, 'base64url_decode', wraps=token_verifier.base64url_decode) as decode_mock:
+            first_result = index.lambda_handler(event, None)
+            second_result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(first_result, second_result)
+        self.assertEqual(1, token_verifier.secrets_manager_client.get_secret_value.call_count)
+        self.assertEqual(1, decode_mock.call_count)
+
+    @patch.dict(os.environ, {'USER_IDENTIFIER_CLAIM_FIELD': 'sub',
+                             'ENDPOINTS_ALLOWED': 'achievements/*',
+                             'VERIFY_EXPIRATION': 'false',
+                             'JWKS_CACHE_TTL_SECONDS': '60'})
+    def test_jwks_is_reloaded_after_its_ttl(self):
+        # Arrange
+        event = self.get_lambda_event()
+        token_verifier.secrets_manager_client.get_secret_value.return_value = self.get_secret_value_response(self.jwk_set())
+
+        # Act
+        for now in [1000, 1030, 1061]:
+            with patch.object(token_verifier.time, 'time', return_value=now):
+                index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(2, token_verifier.secrets_manager_client.get_secret_value.call_count)
+
+    @patch.dict(os.environ, {'USER_IDENTIFIER_CLAIM_FIELD': 'sub',
+                             'ENDPOINTS_ALLOWED': 'achievements/*',
+                             'VERIFY_EXPIRATION': 'false'})
+    def test_jwks_is_reloaded_when_the_token_key_is_missing(self):
+        # Arrange
+        event = self.get_lambda_event()
+        rotated_jwk_set = self.jwk_set()
+        signing_key = rotated_jwk_set['keys'].pop(1)
+        token_verifier.secrets_manager_client.get_secret_value.side_effect = [
+            self.get_secret_value_response(rotated_jwk_set),
+            self.get_secret_value_response(rotated_jwk_set),
+            self.get_secret_value_response(self.jwk_set())
+        ]
+        self.assertEqual('8fbbeea40332d2c0d27e37e1904af29b64594e57', signing_key['kid'])
+
+        # Act/Assert
+        with patch.object(token_verifier.time, 'time', return_value=1000):
+            with self.assertRaises(Exception):
+                index.lambda_handler(event, None)
+        with patch.object(token_verifier.time, 'time', return_value=1000 + token_verifier.MIN_JWKS_RELOAD_INTERVAL_SECONDS):
+            result = index.lambda_handler(event, None)
+
+        self.assertEqual('107932416965203234076', result['principalId'])
+        self.assertEqual(3, token_verifier.secrets_manager_client.get_secret_value.call_count)
+
+    def test_changed_jwks_forgets_the_verified_tokens(self):
+        # Arrange
+        token = self.get_lambda_event()['authorizationToken']
+        token_verifier.secrets_manager_client.get_secret_value.return_value = self.get_secret_value_response(self.jwk_set())
+        token_verifier.verify(token, 'AWSCURRENT', False)
+        rotated_jwk_set = self.jwk_set()
+        rotated_jwk_set['keys'].pop(0)
+        token_verifier.secrets_manager_client.get_secret_value.return_value = self.get_secret_value_response(rotated_jwk_set)
+
+        # Act
+        token_verifier.load_jwks('AWSCURRENT', 'gamekit_dev_testgame_ThirdPartyJwks')
+
+        # Assert
+        self.assertEqual(0, len(token_verifier._verified_tokens))
+
+    @staticmethod
+    def get_secret_value_response(jwk_set):
+        return {
+            'ARN': 'arn:aws:secretsmanager:us-west-2:123456789012:secret:gamekit_dev_testgame_ThirdPartyJwks-abcdef',
+            'Name': 'gamekit_dev_testgame_ThirdPartyJwks',
+            'VersionId': '1',
+            'SecretString': json.dumps(jwk_set)
+        }
 
     @staticmethod
     def get_lambda_event():
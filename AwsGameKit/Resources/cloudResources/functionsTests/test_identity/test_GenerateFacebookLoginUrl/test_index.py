@@ -18,6 +18,8 @@ from functionsTests.helpers.boto3.mock_responses.exceptions import new_boto_exce
     'REDIRECT_URI': 'foo_redirect_uri',
 })
 class TestIndex(TestCase):
+    def setUp(self):
+        index.crypto.clear_data_key_cache()
 
     @patch('functions.identity.GenerateFacebookLoginUrl.index.crypto.boto3')
     def test_can_get_login_url_successfully(self, mock_boto3: MagicMock):
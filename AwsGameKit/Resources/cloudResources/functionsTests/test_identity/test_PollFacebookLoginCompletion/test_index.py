@@ -84,6 +84,84 @@ class TestIndex(TestCase):
                 # Assert
                 self.assertEqual(error_code, result['statusCode'])
 
+    @patch('functions.identity.PollFacebookLoginCompletion.index.time.sleep')
+    def test_long_poll_waits_for_the_completion_object(self, sleep_mock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"request_id": "f0a7fa67-8997-4ea6-8a0e-c81799209f71", "wait_seconds": 10}'
+        context = None
+        completion_object = MagicMock()
+        completion_object['Body'].read().decode.return_value = 'foo_encrypted_key_location'
+        index.s3_client.get_object.side_effect = [
+            self.get_s3_no_such_key_exception(),
+            self.get_s3_no_such_key_exception(),
+            completion_object
+        ]
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual(3, index.s3_client.get_object.call_count)
+        self.assertEqual(2, sleep_mock.call_count)
+        self.assertLess(sleep_mock.call_args_list[0][0][0], sleep_mock.call_args_list[1][0][0])
+
+    @patch('functions.identity.PollFacebookLoginCompletion.index.time.sleep')
+    def test_long_poll_does_not_wait_on_other_s3_errors(self, sleep_mock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['body'] = '{"request_id": "f0a7fa67-8997-4ea6-8a0e-c81799209f71", "wait_seconds": 10}'
+        context = None
+        index.s3_client.get_object.side_effect = self.get_s3_access_denied_exception()
+
+        # Act
+        result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(403, result['statusCode'])
+        sleep_mock.assert_not_called()
+
+    def test_wait_seconds_is_capped_by_the_remaining_time(self):
+        sub_tests = [
+            ("default", {}, 60000, 0),
+            ("capped by the maximum", {'wait_seconds': 600}, 60000, index.MAX_WAIT_SECONDS),
+            ("capped by the remaining time", {'wait_seconds': 10}, 5000, 4),
+            ("no remaining time", {'wait_seconds': 10}, 500, 0),
+        ]
+
+        for test_name, body, remaining_millis, expected_wait_seconds in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                context = MagicMock()
+                context.get_remaining_time_in_millis.return_value = remaining_millis
+
+                # Act
+                wait_seconds = index.get_wait_seconds(body, context)
+
+                # Assert
+                self.assertEqual(expected_wait_seconds, wait_seconds)
+
+    def test_returns_400_when_wait_seconds_is_malformed(self):
+        sub_tests = [
+            ("negative", '-1'),
+            ("string", '"10"'),
+            ("boolean", 'true'),
+        ]
+
+        for test_name, wait_seconds in sub_tests:
+            with self.subTest(test_name):
+                # Arrange
+                event = self.get_lambda_event()
+                event['body'] = '{"request_id": "f0a7fa67-8997-4ea6-8a0e-c81799209f71", "wait_seconds": ' + wait_seconds + '}'
+                context = None
+
+                # Act
+                result = index.lambda_handler(event, context)
+
+                # Assert
+                self.assertEqual(400, result['statusCode'])
+
     @staticmethod
     def get_lambda_event():
         """
@@ -16,6 +16,7 @@ with patch("boto3.client") as boto_client_mock:
 class TestIndex(TestCase):
     def setUp(self):
         index.s3_client = MagicMock()
+        index.crypto.clear_data_key_cache()
 
     @patch('functions.identity.RetrieveFacebookTokens.index.crypto.boto3')
     def test_can_write_token_to_s3_successfully(self, mock_gamekithelpers_crypto_boto3):
@@ -68,6 +69,24 @@ class TestIndex(TestCase):
         self.assertEqual(403, result['statusCode'])
         index.s3_client.put_object.assert_not_called()
 
+    @patch('functions.identity.RetrieveFacebookTokens.index.crypto.boto3')
+    def test_data_key_is_decrypted_once_per_container(self, mock_gamekithelpers_crypto_boto3):
+        # Arrange
+        event = self.get_lambda_event('12.123.123.123')
+        context = None
+
+        mock_gamekithelpers_crypto_boto3.client('kms').decrypt.return_value = self.get_kms_decrypted_event_body()
+        index.s3_client.get_object()['Body'].read().decode.return_value = 'Retrieved'
+
+        # Act
+        first_result = index.lambda_handler(event, context)
+        second_result = index.lambda_handler(event, context)
+
+        # Assert
+        self.assertEqual(403, first_result['statusCode'])
+        self.assertEqual(403, second_result['statusCode'])
+        mock_gamekithelpers_crypto_boto3.client('kms').decrypt.assert_called_once()
+
     def test_lambda_returns_a_400_error_code_when_encrypted_source_ip_does_not_match_request(self):
         # Arrange
         event = self.get_lambda_event('12.123.123.124')
@@ -0,0 +1,169 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+from botocore.exceptions import ClientError
+
+with patch("boto3.client") as boto_client_mock:
+    with patch("gamekitresourcemanagement.cfn_custom_resource.send_success_response") as mock_send_success_response:
+        with patch('gamekitresourcemanagement.cfn_custom_resource.send_failure_response') as mock_send_failure_response:
+            from functions.main.ApiCacheSettings import index
+
+REST_API_ID = 'abcdefghij'
+STAGE_NAME = 'dev'
+ACHIEVEMENTS_PATH = '/~1achievements/GET'
+ACHIEVEMENT_PATH = '/~1achievements~1{achievement_id}/GET'
+UNLOCK_PATH = '/~1achievements~1unlock/POST'
+
+
+class TestIndex(TestCase):
+    def setUp(self):
+        index.apigateway_client = MagicMock()
+        mock_send_success_response.reset_mock()
+        mock_send_failure_response.reset_mock()
+
+    def test_create_enables_caching_of_the_methods(self):
+        # Arrange
+        event = self.get_event('Create')
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        index.apigateway_client.update_stage.assert_called_once_with(
+            restApiId=REST_API_ID,
+            stageName=STAGE_NAME,
+            patchOperations=[
+                {'op': 'replace', 'path': f'{ACHIEVEMENTS_PATH}/caching/enabled', 'value': 'true'},
+                {'op': 'replace', 'path': f'{ACHIEVEMENTS_PATH}/caching/ttlInSeconds', 'value': '60'},
+                {'op': 'replace', 'path': f'{ACHIEVEMENT_PATH}/caching/enabled', 'value': 'true'},
+                {'op': 'replace', 'path': f'{ACHIEVEMENT_PATH}/caching/ttlInSeconds', 'value': '60'}
+            ])
+        mock_send_success_response.assert_called_once()
+        mock_send_failure_response.assert_not_called()
+
+    def test_update_disables_caching_of_the_removed_methods(self):
+        # Arrange
+        event = self.get_event('Update')
+        event['OldResourceProperties'] = dict(event['ResourceProperties'])
+        event['ResourceProperties']['method_settings'] = event['ResourceProperties']['method_settings'][:1]
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        patch_operations = index.apigateway_client.update_stage.call_args.kwargs['patchOperations']
+        self.assertIn({'op': 'replace', 'path': f'{ACHIEVEMENTS_PATH}/caching/enabled', 'value': 'true'}, patch_operations)
+        self.assertIn({'op': 'replace', 'path': f'{ACHIEVEMENT_PATH}/caching/enabled', 'value': 'false'}, patch_operations)
+        mock_send_success_response.assert_called_once()
+
+    def test_delete_disables_caching_of_the_methods(self):
+        # Arrange
+        event = self.get_event('Delete')
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        index.apigateway_client.update_stage.assert_called_once_with(
+            restApiId=REST_API_ID,
+            stageName=STAGE_NAME,
+            patchOperations=[
+                {'op': 'replace', 'path': f'{ACHIEVEMENTS_PATH}/caching/enabled', 'value': 'false'},
+                {'op': 'replace', 'path': f'{ACHIEVEMENT_PATH}/caching/enabled', 'value': 'false'}
+            ])
+        mock_send_success_response.assert_called_once()
+
+    def test_create_throttles_the_methods(self):
+        # Arrange
+        event = self.get_event('Create')
+        event['ResourceProperties']['method_settings'] = [
+            {'resource_path': '/achievements/unlock', 'http_method': 'POST', 'throttling_rate_limit': '100',
+             'throttling_burst_limit': '50'}
+        ]
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        index.apigateway_client.update_stage.assert_called_once_with(
+            restApiId=REST_API_ID,
+            stageName=STAGE_NAME,
+            patchOperations=[
+                {'op': 'replace', 'path': f'{UNLOCK_PATH}/throttling/rateLimit', 'value': '100'},
+                {'op': 'replace', 'path': f'{UNLOCK_PATH}/throttling/burstLimit', 'value': '50'}
+            ])
+        mock_send_success_response.assert_called_once()
+
+    def test_delete_removes_the_throttling_of_the_methods(self):
+        # Arrange
+        event = self.get_event('Delete')
+        event['ResourceProperties']['method_settings'] = [
+            {'resource_path': '/achievements/unlock', 'http_method': 'POST', 'throttling_rate_limit': '100',
+             'throttling_burst_limit': '50'}
+        ]
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        index.apigateway_client.update_stage.assert_called_once_with(
+            restApiId=REST_API_ID,
+            stageName=STAGE_NAME,
+            patchOperations=[{'op': 'remove', 'path': UNLOCK_PATH}])
+        mock_send_success_response.assert_called_once()
+
+    def test_delete_succeeds_when_the_stage_is_gone(self):
+        # Arrange
+        event = self.get_event('Delete')
+        index.apigateway_client.update_stage.side_effect = ClientError({
+            'Error': {
+                'Code': 'NotFoundException',
+                'Message': 'Invalid stage identifier specified'
+            }
+        }, 'UpdateStage')
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        mock_send_success_response.assert_called_once()
+        mock_send_failure_response.assert_not_called()
+
+    def test_create_fails_when_the_stage_cannot_be_updated(self):
+        # Arrange
+        event = self.get_event('Create')
+        index.apigateway_client.update_stage.side_effect = ClientError({
+            'Error': {
+                'Code': 'BadRequestException',
+                'Message': 'Invalid method setting path'
+            }
+        }, 'UpdateStage')
+
+        # Act
+        index.lambda_handler(event, None)
+
+        # Assert
+        mock_send_success_response.assert_not_called()
+        mock_send_failure_response.assert_called_once()
+
+    @staticmethod
+    def get_event(request_type):
+        return {
+            'RequestType': request_type,
+            'ResourceProperties': {
+                'rest_api_id': REST_API_ID,
+                'stage_name': STAGE_NAME,
+                'method_settings': [
+                    {'resource_path': '/achievements', 'http_method': 'GET', 'ttl_seconds': '60'},
+                    {'resource_path': '/achievements/{achievement_id}', 'http_method': 'GET', 'ttl_seconds': '60'}
+                ]
+            },
+            'PhysicalResourceId': 'api-cache-settings-some-hash-here',
+            'StackId': 'test_stack_id',
+            'LogicalResourceId': 'test_logical_resource_id',
+            'RequestId': 'test_request_id',
+            'ResponseURL': 'https://website.tld/some_url'
+        }
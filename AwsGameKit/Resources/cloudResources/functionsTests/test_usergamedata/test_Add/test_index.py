@@ -7,11 +7,18 @@ import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock, call
 
+import botocore
+
 with patch("boto3.client") as boto_client_mock:
     from functions.usergamedata.Add import index
+    from gamekithelpers import idempotency
 
 BUNDLES_TABLE_NAME = 'test_bundles_table'
 ITEMS_TABLE_NAME = 'test_bundleitems_table'
+IDEMPOTENCY_KEY = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+
+# Some tests replace botocore's ClientError, which the idempotency store also catches
+CLIENT_ERROR = botocore.exceptions.ClientError
 
 
 def _build_add_event(user, bundle_name, bundle_key, bundle_value):
@@ -51,6 +58,17 @@ class MockClientErrorException(BaseException):
         pass
 
 
+class MockThrottledException(MockClientErrorException):
+    def __init__(self):
+        self.response = {'Error': {'Code': 'ProvisionedThroughputExceededException'}}
+
+
+def _build_add_many_event(user, bundle_name, count):
+    event = _build_add_event(user, bundle_name, 'unused', 'unused')
+    event['body'] = json.dumps({f'item{i}': str(i) for i in range(count)})
+    return event
+
+
 # Patch Lambda environment variables:
 @patch.dict(os.environ, {
     'BUNDLES_TABLE_NAME': BUNDLES_TABLE_NAME,
@@ -59,6 +77,10 @@ class MockClientErrorException(BaseException):
 class TestAdd(TestCase):
     def setUp(self):
         index.ddb_client = MagicMock()
+        index.idempotency_store = idempotency.IdempotencyStore(None, 0)
+
+    def tearDown(self):
+        index.botocore.exceptions.ClientError = CLIENT_ERROR
 
     @patch('functions.usergamedata.Add.index.datetime')
     def test_add_bundle_one_failure_returns_unprocessed_item(self, mock_datetime: MagicMock):
@@ -195,3 +217,132 @@ class TestAdd(TestCase):
 
         self.assertEqual(result['statusCode'], 400)
         self.assertFalse(index.ddb_client.called)
+
+    @patch('functions.usergamedata.Add.index.time')
+    def test_add_bundle_retries_throttled_item(self, mock_time: MagicMock):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+
+        index.botocore.exceptions.ClientError = MockClientErrorException
+        index.ddb_client.update_item.side_effect = [
+            None,
+            MockThrottledException(),
+            MockThrottledException(),
+            None
+        ]
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 201)
+        self.assertEqual(result_body_obj['data']['unprocessed_items'], [])
+        self.assertEqual(index.ddb_client.update_item.call_count, 4)
+        self.assertEqual(mock_time.sleep.call_count, 2)
+
+    @patch('functions.usergamedata.Add.index.time')
+    def test_add_bundle_gives_up_on_throttled_item_after_max_attempts(self, mock_time: MagicMock):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+
+        index.botocore.exceptions.ClientError = MockClientErrorException
+        index.ddb_client.update_item.side_effect = [None] + [MockThrottledException()] * index.MAX_WRITE_ATTEMPTS
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 201)
+        self.assertEqual(result_body_obj['data']['unprocessed_items'], [{'bundle_item_key': 'xp', 'bundle_item_value': '99'}])
+        self.assertEqual(index.ddb_client.update_item.call_count, 1 + index.MAX_WRITE_ATTEMPTS)
+
+    @patch('functions.usergamedata.Add.index.time')
+    def test_add_bundle_does_not_retry_past_time_budget(self, mock_time: MagicMock):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+        test_context = MagicMock()
+        test_context.get_remaining_time_in_millis.return_value = index.RETRY_TIME_MARGIN_MS
+
+        index.botocore.exceptions.ClientError = MockClientErrorException
+        index.ddb_client.update_item.side_effect = [None, MockThrottledException()]
+
+        result = index.lambda_handler(test_event, test_context)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 201)
+        self.assertEqual(result_body_obj['data']['unprocessed_items'], [{'bundle_item_key': 'xp', 'bundle_item_value': '99'}])
+        self.assertEqual(index.ddb_client.update_item.call_count, 2)
+        self.assertFalse(mock_time.sleep.called)
+
+    def test_add_bundle_does_not_retry_other_errors(self):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+
+        index.botocore.exceptions.ClientError = MockClientErrorException
+        index.ddb_client.update_item.side_effect = [None, MockClientErrorException()]
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result_body_obj['data']['unprocessed_items'], [{'bundle_item_key': 'xp', 'bundle_item_value': '99'}])
+        self.assertEqual(index.ddb_client.update_item.call_count, 2)
+
+    def test_add_large_bundle_writes_every_item_in_chunks(self):
+        test_item_count = index.user_game_play_constants.DYNAMO_MAX_ITEM_WRITES * 2 + 3
+        test_event = _build_add_many_event('u123', 'inventory', test_item_count)
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 201)
+        self.assertEqual(result_body_obj['data']['unprocessed_items'], [])
+        self.assertEqual(index.ddb_client.update_item.call_count, 1 + test_item_count)
+        written_keys = {c[1]['Key']['bundle_item_key']['S'] for c in index.ddb_client.update_item.call_args_list[1:]}
+        self.assertEqual(written_keys, {f'item{i}' for i in range(test_item_count)})
+
+    def test_add_bundle_records_the_response_of_a_new_idempotency_key(self):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.idempotency_store = _build_idempotency_store()
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 201)
+        index.idempotency_store.table.put_item.assert_called_once()
+        recorded = index.idempotency_store.table.update_item.call_args[1]['ExpressionAttributeValues']
+        self.assertEqual(recorded[':status'], 'COMPLETED')
+        self.assertEqual(recorded[':response'], result)
+
+    def test_add_bundle_replays_a_repeated_idempotency_key_without_writing(self):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.idempotency_store = _build_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = _build_conditional_check_failed()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(test_event),
+            'response': {'statusCode': 201, 'headers': {}, 'body': '{"data": {"unprocessed_items": []}}'}
+        }}
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 201)
+        self.assertEqual(result['headers'][idempotency.IDEMPOTENT_REPLAYED_HEADER], 'true')
+        index.ddb_client.update_item.assert_not_called()
+
+    def test_add_bundle_releases_the_idempotency_key_when_the_bundle_is_not_written(self):
+        test_event = _build_add_event('u123', 'stats', 'xp', '99')
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.idempotency_store = _build_idempotency_store()
+        index.botocore.exceptions.ClientError = MockClientErrorException
+        index.ddb_client.update_item.side_effect = [index.botocore.exceptions.ClientError()]
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 422)
+        index.idempotency_store.table.delete_item.assert_called_once()
+        index.idempotency_store.table.update_item.assert_not_called()
+
+
+def _build_idempotency_store():
+    store = idempotency.IdempotencyStore(None, 3600)
+    store.table = MagicMock()
+    return store
+
+
+def _build_conditional_check_failed():
+    return CLIENT_ERROR({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'PutItem')
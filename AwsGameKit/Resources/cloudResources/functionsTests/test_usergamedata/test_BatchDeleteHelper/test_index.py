@@ -23,6 +23,7 @@ def _build_batch_delete_helper_event():
 class TestGetItem(TestCase):
     def setUp(self):
         index.ddb_resource = MagicMock()
+        index.ddb_resource.batch_write_item.return_value = {'UnprocessedItems': {}}
 
     def test_batch_delete_helper_event_calls_batch_write_item(self):
         test_event = _build_batch_delete_helper_event()
@@ -37,3 +38,43 @@ class TestGetItem(TestCase):
                 {'DeleteRequest':
                      {'Key': {'player_id_bundle': '12345678-1234-1234-1234-123456789012_BANANA_BUNDLE',
                               'bundle_item_key': 'SCORE2'}}}]})
+
+    @patch('time.sleep')
+    def test_batch_delete_helper_retries_unprocessed_items(self, sleep_mock):
+        test_event = _build_batch_delete_helper_event()
+        unprocessed_request = test_event['DeleteRequest'][1:]
+        index.ddb_resource.batch_write_item.side_effect = [
+            {'UnprocessedItems': {'test_bundleitems_table': unprocessed_request}},
+            {'UnprocessedItems': {}}]
+
+        index.lambda_handler(test_event, None)
+
+        self.assertEqual(index.ddb_resource.batch_write_item.call_count, 2)
+        self.assertEqual(index.ddb_resource.batch_write_item.call_args_list[1],
+                         call(RequestItems={'test_bundleitems_table': unprocessed_request}))
+        sleep_mock.assert_called_once()
+
+    @patch('time.sleep')
+    def test_batch_delete_helper_raises_after_max_attempts(self, sleep_mock):
+        test_event = _build_batch_delete_helper_event()
+        index.ddb_resource.batch_write_item.return_value = {
+            'UnprocessedItems': {'test_bundleitems_table': test_event['DeleteRequest']}}
+
+        with self.assertRaises(RuntimeError):
+            index.lambda_handler(test_event, None)
+
+        self.assertEqual(index.ddb_resource.batch_write_item.call_count, index.MAX_WRITE_ATTEMPTS)
+
+    @patch('time.sleep')
+    def test_batch_delete_helper_stops_retrying_when_out_of_time(self, sleep_mock):
+        test_event = _build_batch_delete_helper_event()
+        index.ddb_resource.batch_write_item.return_value = {
+            'UnprocessedItems': {'test_bundleitems_table': test_event['DeleteRequest']}}
+        test_context = MagicMock()
+        test_context.get_remaining_time_in_millis.return_value = index.RETRY_TIME_MARGIN_MS
+
+        with self.assertRaises(RuntimeError):
+            index.lambda_handler(test_event, test_context)
+
+        index.ddb_resource.batch_write_item.assert_called_once()
+        sleep_mock.assert_not_called()
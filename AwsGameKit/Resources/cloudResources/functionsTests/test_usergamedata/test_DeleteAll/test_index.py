@@ -1,6 +1,7 @@
 # Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 # SPDX-License-Identifier: Apache-2.0
 
+import json
 import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock, call
@@ -70,6 +71,70 @@ class TestDeleteAll(TestCase):
 
         index.lambda_client.invoke.assert_has_calls(calls, any_order=False)
 
+    def test_delete_all_follows_bundle_items_pagination_keys(self):
+        # Arrange
+        event = self.get_lambda_event()
+        items = [{'player_id_bundle': '12345_TestBundle', 'bundle_item_key': f'Key{i}'} for i in range(30)]
+        index.ddb_resource.Table().query.side_effect = [
+            {'Items': [{'player_id': '12345', 'bundle_name': 'TestBundle'}]},
+            {'Items': items[:20], 'LastEvaluatedKey': {'player_id_bundle': '12345_TestBundle', 'bundle_item_key': 'Key19'}},
+            {'Items': items[20:]}]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        self.assertEqual(index.ddb_resource.Table().query.call_args_list[2][1]['ExclusiveStartKey'],
+                         {'player_id_bundle': '12345_TestBundle', 'bundle_item_key': 'Key19'})
+        payloads = [json.loads(invoke_call[1]['Payload']) for invoke_call in index.lambda_client.invoke.call_args_list]
+        self.assertEqual([len(payload['DeleteRequest']) for payload in payloads], [25, 5, 1])
+        self.assertEqual(payloads[2]['TableName'], BUNDLES_TABLE_NAME)
+
+    def test_delete_all_skips_an_empty_bundles_page(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.ddb_resource.Table().query.side_effect = [
+            {'Items': [{'player_id': '12345', 'bundle_name': 'TestBundle'}], 'LastEvaluatedKey': {'player_id': '12345', 'bundle_name': 'TestBundle'}},
+            {'Items': [{'player_id_bundle': '12345_TestBundle', 'bundle_item_key': 'Key'}]},
+            {'Items': []}]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        payloads = [json.loads(invoke_call[1]['Payload']) for invoke_call in index.lambda_client.invoke.call_args_list]
+        self.assertEqual([payload['TableName'] for payload in payloads], [ITEMS_TABLE_NAME, BUNDLES_TABLE_NAME])
+
+    @patch.object(index, 'Key')
+    def test_delete_all_deletes_the_items_of_every_bundle(self, key_mock):
+        # Arrange
+        event = self.get_lambda_event()
+        bundles = [{'player_id': '12345', 'bundle_name': f'TestBundle{i}'} for i in range(15)]
+        key_mock.side_effect = lambda name: MagicMock(eq=lambda value: (name, value))
+
+        def query(**kwargs):
+            name, value = kwargs['KeyConditionExpression']
+            if name == 'player_id':
+                return {'Items': bundles}
+            return {'Items': [{'player_id_bundle': value, 'bundle_item_key': 'Key'}]}
+
+        index.ddb_resource.Table().query.side_effect = query
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        payloads = [json.loads(invoke_call[1]['Payload']) for invoke_call in index.lambda_client.invoke.call_args_list]
+        deleted_items = sorted(request['DeleteRequest']['Key']['player_id_bundle']
+                               for payload in payloads if payload['TableName'] == ITEMS_TABLE_NAME
+                               for request in payload['DeleteRequest'])
+        self.assertEqual(deleted_items, sorted(f"12345_{bundle['bundle_name']}" for bundle in bundles))
+        self.assertEqual(payloads[-1]['TableName'], BUNDLES_TABLE_NAME)
+        self.assertEqual(len(payloads[-1]['DeleteRequest']), len(bundles))
+
     @staticmethod
     def get_lambda_event():
         return {
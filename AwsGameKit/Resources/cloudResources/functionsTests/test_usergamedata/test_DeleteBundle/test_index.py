@@ -21,6 +21,7 @@ ITEMS_TABLE_NAME = 'test_bundleitems_table'
 class TestDeleteBundle(TestCase):
     def setUp(self):
         index.ddb_resource = MagicMock()
+        index.ddb_resource.batch_write_item.return_value = {'UnprocessedItems': {}}
 
     def test_delete_bundle_item_key_missing_returns_400_error(self):
         # Arrange
@@ -127,6 +128,60 @@ class TestDeleteBundle(TestCase):
                 {'DeleteRequest': {'Key': {'player_id_bundle': '12345_TestBushel', 'bundle_item_key': 'TestBanana'}}}]})
         index.ddb_resource.Table().delete_item.assert_called()
 
+    def test_delete_bundle_no_params_passed_follows_pagination_keys(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = None
+        items = [{'player_id_bundle': '12345_TestBushel', 'bundle_item_key': f'TestBanana{i}'} for i in range(30)]
+        index.ddb_resource.Table().query.side_effect = [
+            {'Items': items[:20], 'LastEvaluatedKey': {'player_id_bundle': '12345_TestBushel', 'bundle_item_key': 'TestBanana19'}},
+            {'Items': items[20:]}]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        self.assertEqual(index.ddb_resource.Table().query.call_args_list[1][1]['ExclusiveStartKey'],
+                         {'player_id_bundle': '12345_TestBushel', 'bundle_item_key': 'TestBanana19'})
+        self.assertEqual(index.ddb_resource.batch_write_item.call_count, 2)
+        deleted_keys = sorted(request['DeleteRequest']['Key']['bundle_item_key']
+                              for write_call in index.ddb_resource.batch_write_item.call_args_list
+                              for request in write_call[1]['RequestItems'][ITEMS_TABLE_NAME])
+        self.assertEqual(deleted_keys, sorted(item['bundle_item_key'] for item in items))
+        index.ddb_resource.Table().delete_item.assert_called()
+
+    @patch('time.sleep')
+    def test_delete_bundle_retries_unprocessed_items(self, sleep_mock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'payload': urllib.parse.quote('{"bundle_item_keys": ["SCORE1","SCORE2"]}')}
+        unprocessed_items = {ITEMS_TABLE_NAME: [
+            {'DeleteRequest': {'Key': {'player_id_bundle': '12345678-1234-1234-1234-123456789012_BANANA_BUNDLE', 'bundle_item_key': 'SCORE2'}}}]}
+        index.ddb_resource.batch_write_item.side_effect = [{'UnprocessedItems': unprocessed_items}, {'UnprocessedItems': {}}]
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        self.assertEqual(index.ddb_resource.batch_write_item.call_count, 2)
+        self.assertEqual(index.ddb_resource.batch_write_item.call_args_list[1][1], {'RequestItems': unprocessed_items})
+
+    @patch('time.sleep')
+    def test_delete_bundle_unprocessed_items_after_max_attempts_raises(self, sleep_mock):
+        # Arrange
+        event = self.get_lambda_event()
+        event['queryStringParameters'] = {'payload': urllib.parse.quote('{"bundle_item_keys": ["SCORE1"]}')}
+        index.ddb_resource.batch_write_item.return_value = {'UnprocessedItems': {ITEMS_TABLE_NAME: [
+            {'DeleteRequest': {'Key': {'player_id_bundle': '12345678-1234-1234-1234-123456789012_BANANA_BUNDLE', 'bundle_item_key': 'SCORE1'}}}]}}
+
+        # Act / Assert
+        with self.assertRaises(RuntimeError):
+            index.lambda_handler(event, None)
+        self.assertEqual(index.ddb_resource.batch_write_item.call_count, index.MAX_WRITE_ATTEMPTS)
+        index.ddb_resource.Table().delete_item.assert_not_called()
+
     @staticmethod
     def get_lambda_event():
         return {
@@ -0,0 +1,153 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+with patch("boto3.client") as boto_client_mock:
+    from functions.usergamedata.GetBundles import index
+
+BUNDLES_TABLE_NAME = 'test_bundles_table'
+ITEMS_TABLE_NAME = 'test_bundleitems_table'
+
+
+def _build_get_bundles_event(user, bundle_names):
+    return {
+        'requestContext': {
+            'authorizer': {
+                'claims': {
+                    'custom:gk_user_id': user
+                }
+            }
+        },
+        'queryStringParameters': {
+            'bundle_names': bundle_names
+        }
+    }
+
+
+def _build_query_response(user, bundle_name, items, last_key=None):
+    response = {
+        'Items': [{
+            'bundle_item_key': {'S': key},
+            'bundle_item_value': {'S': value}} for key, value in items]
+    }
+
+    if last_key is not None:
+        response['LastEvaluatedKey'] = {
+            'player_id_bundle': {'S': f'{user}_{bundle_name}'},
+            'bundle_item_key': {'S': last_key}}
+
+    return response
+
+
+# Patch Lambda environment variables:
+@patch.dict(os.environ, {
+    'BUNDLES_TABLE_NAME': BUNDLES_TABLE_NAME,
+    'BUNDLE_ITEMS_TABLE_NAME': ITEMS_TABLE_NAME},
+            clear=True)
+class TestGetBundles(TestCase):
+    def setUp(self):
+        index.ddb_client = MagicMock()
+
+    def test_get_bundles_returns_every_bundle_in_request_order(self):
+        test_user = 'u123'
+        test_event = _build_get_bundles_event(test_user, 'stats,inventory')
+
+        def query(**kwargs):
+            bundle_name = kwargs['ExpressionAttributeValues'][':player_id_bundle']['S'].split('_', 1)[1]
+            if bundle_name == 'stats':
+                return _build_query_response(test_user, bundle_name, [('xp', '99')])
+            return _build_query_response(test_user, bundle_name, [('sword', '1'), ('shield', '2')])
+
+        index.ddb_client.query.side_effect = query
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(result_body_obj['data']['bundles'], [
+            {'bundle_name': 'stats', 'bundle_items': [{'bundle_item_key': 'xp', 'bundle_item_value': '99'}]},
+            {'bundle_name': 'inventory', 'bundle_items': [
+                {'bundle_item_key': 'sword', 'bundle_item_value': '1'},
+                {'bundle_item_key': 'shield', 'bundle_item_value': '2'}]}])
+        self.assertEqual(index.ddb_client.query.call_count, 2)
+
+    def test_get_bundles_follows_pagination_keys(self):
+        test_user = 'u123'
+        test_bundle = 'stats'
+        test_event = _build_get_bundles_event(test_user, test_bundle)
+
+        index.ddb_client.query.side_effect = [
+            _build_query_response(test_user, test_bundle, [('hp', '10')], 'hp'),
+            _build_query_response(test_user, test_bundle, [('xp', '99')])
+        ]
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(result_body_obj['data']['bundles'][0]['bundle_items'], [
+            {'bundle_item_key': 'hp', 'bundle_item_value': '10'},
+            {'bundle_item_key': 'xp', 'bundle_item_value': '99'}])
+        self.assertFalse('paging' in result_body_obj)
+        self.assertEqual(index.ddb_client.query.call_count, 2)
+        self.assertEqual(index.ddb_client.query.call_args_list[1][1]['ExclusiveStartKey'],
+                         {'player_id_bundle': {'S': f'{test_user}_{test_bundle}'}, 'bundle_item_key': {'S': 'hp'}})
+
+    def test_get_bundles_queries_duplicate_bundles_once(self):
+        test_user = 'u123'
+        test_event = _build_get_bundles_event(test_user, 'stats,stats')
+
+        index.ddb_client.query.return_value = _build_query_response(test_user, 'stats', [('xp', '99')])
+
+        result = index.lambda_handler(test_event, None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(len(result_body_obj['data']['bundles']), 1)
+        index.ddb_client.query.assert_called_once_with(
+            ExpressionAttributeNames={
+                '#player_id_bundle': 'player_id_bundle',
+                '#bundle_item_key': 'bundle_item_key',
+                '#bundle_item_value': 'bundle_item_value'},
+            ExpressionAttributeValues={':player_id_bundle': {'S': f'{test_user}_stats'}},
+            KeyConditionExpression='#player_id_bundle = :player_id_bundle',
+            ProjectionExpression='#bundle_item_key, #bundle_item_value',
+            TableName=ITEMS_TABLE_NAME)
+
+    def test_get_bundles_invalid_player_returns_401_error(self):
+        test_event = _build_get_bundles_event('u123', 'stats')
+        test_event['requestContext'] = None
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 401)
+        self.assertFalse(index.ddb_client.query.called)
+
+    def test_get_bundles_missing_bundle_names_returns_400_error(self):
+        test_event = _build_get_bundles_event('u123', 'stats')
+        test_event['queryStringParameters'] = None
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 400)
+        self.assertFalse(index.ddb_client.query.called)
+
+    def test_get_bundles_invalid_bundle_name_returns_400_error(self):
+        test_event = _build_get_bundles_event('u123', 'stats,,inventory')
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 400)
+        self.assertFalse(index.ddb_client.query.called)
+
+    def test_get_bundles_too_many_bundles_returns_400_error(self):
+        test_event = _build_get_bundles_event('u123', ','.join(f'bundle{i}' for i in range(index.MAX_BUNDLES + 1)))
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 400)
+        self.assertFalse(index.ddb_client.query.called)
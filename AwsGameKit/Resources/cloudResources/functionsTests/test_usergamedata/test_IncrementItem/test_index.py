@@ -0,0 +1,198 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+import json
+import os
+from unittest import TestCase
+from unittest.mock import patch, MagicMock
+
+import botocore
+
+with patch("boto3.client") as boto_client_mock:
+    from functions.usergamedata.IncrementItem import index
+    from gamekithelpers import idempotency
+
+BUNDLES_TABLE_NAME = 'test_bundles_table'
+ITEMS_TABLE_NAME = 'test_bundleitems_table'
+IDEMPOTENCY_KEY = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+
+
+class MockConditionalCheckFailedException(BaseException):
+    def __init__(self):
+        pass
+
+
+class IdempotencyConditionalCheckFailedException(botocore.exceptions.ClientError):
+    def __init__(self):
+        super().__init__({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'PutItem')
+
+
+def _build_idempotency_store():
+    store = idempotency.IdempotencyStore(None, 3600)
+    store.table = MagicMock()
+    return store
+
+
+def _build_increment_item_event(delta, bundle_name='BANANA_BUNDLE', bundle_item_key='MAX_BANANAS'):
+    return {
+        'requestContext': {
+            'authorizer': {
+                'claims': {
+                    'custom:gk_user_id': 'test_gamekit_player_id'
+                }
+            }
+        },
+        'pathParameters': {
+            'bundle_name': bundle_name,
+            'bundle_item_key': bundle_item_key
+        },
+        'body': json.dumps({'delta': delta})
+    }
+
+
+def _build_get_item_response(value):
+    return {'Item': {'bundle_item_value': {'S': value}}}
+
+
+# Patch Lambda environment variables:
+@patch.dict(os.environ, {
+    'BUNDLES_TABLE_NAME': BUNDLES_TABLE_NAME,
+    'BUNDLE_ITEMS_TABLE_NAME': ITEMS_TABLE_NAME
+})
+class TestIncrementItem(TestCase):
+    def setUp(self):
+        index.ddb_client = MagicMock()
+        index.ddb_client.exceptions.ConditionalCheckFailedException = MockConditionalCheckFailedException
+        index.idempotency_store = idempotency.IdempotencyStore(None, 0)
+
+    def test_increment_item_returns_new_value(self):
+        index.ddb_client.get_item.return_value = _build_get_item_response('10')
+
+        result = index.lambda_handler(_build_increment_item_event(5), None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(result_body_obj['data'], {'bundle_item_value': '15'})
+        index.ddb_client.update_item.assert_called_once()
+        update_request = index.ddb_client.update_item.call_args[1]
+        self.assertEqual(update_request['TableName'], ITEMS_TABLE_NAME)
+        self.assertEqual(update_request['ConditionExpression'], '#bundle_item_value = :current_value')
+        self.assertEqual(update_request['ExpressionAttributeValues'][':current_value'], {'S': '10'})
+        self.assertEqual(update_request['ExpressionAttributeValues'][':bundle_item_value'], {'S': '15'})
+
+    def test_increment_item_missing_item_counts_from_zero_and_creates_bundle(self):
+        index.ddb_client.get_item.return_value = {}
+
+        result = index.lambda_handler(_build_increment_item_event(-3), None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(result_body_obj['data'], {'bundle_item_value': '-3'})
+        self.assertEqual(index.ddb_client.update_item.call_count, 2)
+        self.assertEqual(index.ddb_client.update_item.call_args_list[0][1]['TableName'], BUNDLES_TABLE_NAME)
+        self.assertEqual(index.ddb_client.update_item.call_args_list[1][1]['ConditionExpression'], 'attribute_not_exists(bundle_item_key)')
+
+    def test_increment_item_concurrent_write_is_retried_on_new_value(self):
+        index.ddb_client.get_item.side_effect = [_build_get_item_response('10'), _build_get_item_response('12')]
+        index.ddb_client.update_item.side_effect = [MockConditionalCheckFailedException(), {}]
+
+        result = index.lambda_handler(_build_increment_item_event(1), None)
+        result_body_obj = json.loads(result['body'])
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(result_body_obj['data'], {'bundle_item_value': '13'})
+        self.assertEqual(index.ddb_client.get_item.call_count, 2)
+        self.assertTrue(index.ddb_client.get_item.call_args[1]['ConsistentRead'])
+
+    def test_increment_item_too_many_concurrent_writes_returns_409_error(self):
+        index.ddb_client.get_item.return_value = _build_get_item_response('10')
+        index.ddb_client.update_item.side_effect = MockConditionalCheckFailedException()
+
+        result = index.lambda_handler(_build_increment_item_event(1), None)
+
+        self.assertEqual(result['statusCode'], 409)
+        self.assertEqual(index.ddb_client.update_item.call_count, index.MAX_INCREMENT_ATTEMPTS)
+
+    def test_increment_item_value_not_integer_returns_400_error(self):
+        index.ddb_client.get_item.return_value = _build_get_item_response('Banana')
+
+        result = index.lambda_handler(_build_increment_item_event(1), None)
+
+        self.assertEqual(result['statusCode'], 400)
+        index.ddb_client.update_item.assert_not_called()
+
+    def test_increment_item_overflow_returns_400_error(self):
+        index.ddb_client.get_item.return_value = _build_get_item_response(str(index.INT64_MAX))
+
+        result = index.lambda_handler(_build_increment_item_event(1), None)
+
+        self.assertEqual(result['statusCode'], 400)
+        index.ddb_client.update_item.assert_not_called()
+
+    def test_increment_item_invalid_delta_returns_400_error(self):
+        for delta in ['5', 1.5, True, None, 2 ** 63]:
+            result = index.lambda_handler(_build_increment_item_event(delta), None)
+
+            self.assertEqual(result['statusCode'], 400)
+        index.ddb_client.get_item.assert_not_called()
+
+    def test_increment_item_bundle_item_key_invalid_returns_414_error(self):
+        result = index.lambda_handler(_build_increment_item_event(1, bundle_item_key='x' * 256), None)
+
+        self.assertEqual(result['statusCode'], 414)
+        index.ddb_client.get_item.assert_not_called()
+
+    def test_increment_item_invalid_player_returns_401_error(self):
+        test_event = _build_increment_item_event(1)
+        test_event['requestContext'] = None
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 401)
+        index.ddb_client.get_item.assert_not_called()
+
+    def test_increment_item_records_the_response_of_a_new_idempotency_key(self):
+        test_event = _build_increment_item_event(5)
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.ddb_client.get_item.return_value = _build_get_item_response('10')
+        index.idempotency_store = _build_idempotency_store()
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 200)
+        index.idempotency_store.table.put_item.assert_called_once()
+        recorded = index.idempotency_store.table.update_item.call_args[1]['ExpressionAttributeValues']
+        self.assertEqual(recorded[':status'], 'COMPLETED')
+        self.assertEqual(recorded[':response'], result)
+
+    def test_increment_item_replays_a_repeated_idempotency_key_without_incrementing_again(self):
+        test_event = _build_increment_item_event(5)
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.idempotency_store = _build_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = IdempotencyConditionalCheckFailedException()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(test_event),
+            'response': {'statusCode': 200, 'headers': {}, 'body': '{"data": {"bundle_item_value": "15"}}'}
+        }}
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 200)
+        self.assertEqual(json.loads(result['body'])['data'], {'bundle_item_value': '15'})
+        self.assertEqual(result['headers'][idempotency.IDEMPOTENT_REPLAYED_HEADER], 'true')
+        index.ddb_client.get_item.assert_not_called()
+        index.ddb_client.update_item.assert_not_called()
+
+    def test_increment_item_releases_the_idempotency_key_after_too_many_concurrent_writes(self):
+        test_event = _build_increment_item_event(1)
+        test_event['headers'] = {'Idempotency-Key': IDEMPOTENCY_KEY}
+        index.ddb_client.get_item.return_value = _build_get_item_response('10')
+        index.ddb_client.update_item.side_effect = MockConditionalCheckFailedException()
+        index.idempotency_store = _build_idempotency_store()
+
+        result = index.lambda_handler(test_event, None)
+
+        self.assertEqual(result['statusCode'], 409)
+        index.idempotency_store.table.delete_item.assert_called_once()
+        index.idempotency_store.table.update_item.assert_not_called()
@@ -66,9 +66,10 @@ class TestListBundles(TestCase):
         self.assertFalse('next_start_key' in result)
 
         bundle_query_call = call(
-            ExpressionAttributeNames={'#player_id': 'player_id'},
+            ExpressionAttributeNames={'#player_id': 'player_id', '#bundle_name': 'bundle_name'},
             ExpressionAttributeValues={':player_id': {'S': test_user}},
             KeyConditionExpression='#player_id = :player_id',
+            ProjectionExpression='#bundle_name',
             Limit=100,
             TableName=BUNDLES_TABLE_NAME)
 
@@ -100,9 +101,10 @@ class TestListBundles(TestCase):
 
         bundle_query_call = call(
             ExclusiveStartKey={'player_id': {'S': test_user}, 'bundle_name': {'S': test_start_key}},
-            ExpressionAttributeNames={'#player_id': 'player_id'},
+            ExpressionAttributeNames={'#player_id': 'player_id', '#bundle_name': 'bundle_name'},
             ExpressionAttributeValues={':player_id': {'S': test_user}},
             KeyConditionExpression='#player_id = :player_id',
+            ProjectionExpression='#bundle_name',
             Limit=test_limit,
             TableName=BUNDLES_TABLE_NAME)
 
@@ -6,10 +6,15 @@ import os
 from unittest import TestCase
 from unittest.mock import patch, MagicMock, call
 
+import botocore
+
+from gamekithelpers import idempotency, throttle
+
 with patch("boto3.client") as boto_client_mock:
     from functions.usergamedata.UpdateItem import index
 
 ITEMS_TABLE_NAME = 'test_bundleitems_table'
+IDEMPOTENCY_KEY = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
 
 
 class MockConditionalCheckFailedException(BaseException):
@@ -24,6 +29,8 @@ class MockConditionalCheckFailedException(BaseException):
 class TestUpdateItem(TestCase):
     def setUp(self):
         index.ddb_client = MagicMock()
+        index.player_rate_limiter = throttle.PlayerRateLimiter(rate_limit=0, burst_limit=0)
+        index.idempotency_store = idempotency.IdempotencyStore(None, 0)
 
     def test_update_item_invalid_player_returns_401_error(self):
         # Arrange
@@ -157,6 +164,85 @@ class TestUpdateItem(TestCase):
         self.assertEqual(result['statusCode'], 204)
         index.ddb_client.update_item.assert_has_calls(calls, any_order=False)
 
+    def test_update_item_player_over_rate_limit_returns_429_error(self):
+        # Arrange
+        event = self.get_lambda_event()
+        index.player_rate_limiter = throttle.PlayerRateLimiter(rate_limit=1, burst_limit=2)
+
+        # Act
+        results = [index.lambda_handler(event, None) for _ in range(3)]
+
+        # Assert
+        self.assertEqual([204, 204, 429], [result['statusCode'] for result in results])
+        self.assertEqual('1', results[2]['headers']['Retry-After'])
+        self.assertEqual(2, index.ddb_client.update_item.call_count)
+
+    def test_update_item_records_the_response_of_a_new_idempotency_key(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = IDEMPOTENCY_KEY
+        index.idempotency_store = self.make_idempotency_store()
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        index.idempotency_store.table.put_item.assert_called_once()
+        recorded = index.idempotency_store.table.update_item.call_args.kwargs['ExpressionAttributeValues']
+        self.assertEqual('COMPLETED', recorded[':status'])
+        self.assertEqual(result, recorded[':response'])
+
+    def test_update_item_replays_a_repeated_idempotency_key_without_writing(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = IDEMPOTENCY_KEY
+        index.idempotency_store = self.make_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = self.make_conditional_check_failed()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(event),
+            'response': {'statusCode': 204, 'headers': {}, 'body': ''}
+        }}
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(204, result['statusCode'])
+        self.assertEqual('true', result['headers'][idempotency.IDEMPOTENT_REPLAYED_HEADER])
+        index.ddb_client.update_item.assert_not_called()
+
+    def test_update_item_returns_a_422_error_when_the_idempotency_key_was_used_for_another_value(self):
+        # Arrange
+        event = self.get_lambda_event()
+        event['headers']['Idempotency-Key'] = IDEMPOTENCY_KEY
+        index.idempotency_store = self.make_idempotency_store()
+        index.idempotency_store.table.put_item.side_effect = self.make_conditional_check_failed()
+        index.idempotency_store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(event),
+            'response': {'statusCode': 204, 'headers': {}, 'body': ''}
+        }}
+        event['body'] = '{"bundle_item_value": "Apple"}'
+
+        # Act
+        result = index.lambda_handler(event, None)
+
+        # Assert
+        self.assertEqual(422, result['statusCode'])
+        index.ddb_client.update_item.assert_not_called()
+
+    @staticmethod
+    def make_idempotency_store():
+        store = idempotency.IdempotencyStore(None, 3600)
+        store.table = MagicMock()
+        return store
+
+    @staticmethod
+    def make_conditional_check_failed():
+        return botocore.exceptions.ClientError({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'PutItem')
+
     @staticmethod
     def get_lambda_event():
         return {
@@ -0,0 +1,32 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Helper functions for the API Gateway cache of the main stage
+"""
+
+import os
+
+import boto3
+import botocore
+
+_apigateway_client = None
+
+
+def flush_api_cache():
+    """
+    Flushes the API Gateway cache of the main stage if the feature caches responses (API_CACHE_ENABLED).
+    This drops the cached responses of every feature, so only call it after rare writes such as admin changes.
+    """
+    if os.environ.get('API_CACHE_ENABLED', 'false') != 'true':
+        return
+
+    global _apigateway_client
+    if _apigateway_client is None:
+        _apigateway_client = boto3.client('apigateway')
+
+    try:
+        _apigateway_client.flush_stage_cache(restApiId=os.environ['MAIN_REST_API_ID'], stageName=os.environ['API_STAGE_NAME'])
+    except botocore.exceptions.ClientError as err:
+        # The write itself succeeded, the cached responses still expire after their TTL
+        print(f"Error flushing the API cache. Error: {err}")
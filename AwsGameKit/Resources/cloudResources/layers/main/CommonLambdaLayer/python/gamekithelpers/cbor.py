@@ -0,0 +1,154 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Minimal CBOR (RFC 8949) encoder and decoder for the response envelopes.
+
+Only the types of a JSON document are supported: None, bool, int, float, Decimal, str, bytes, list, tuple and dict.
+Decimal values, as returned by DynamoDB, are encoded as integers when they are integral, and as doubles otherwise.
+"""
+
+import struct
+from decimal import Decimal
+
+CONTENT_TYPE = 'application/cbor'
+
+_MAJOR_UNSIGNED = 0
+_MAJOR_NEGATIVE = 1
+_MAJOR_BYTES = 2
+_MAJOR_TEXT = 3
+_MAJOR_ARRAY = 4
+_MAJOR_MAP = 5
+_MAJOR_SIMPLE = 7
+
+_FALSE = 0xf4
+_TRUE = 0xf5
+_NULL = 0xf6
+_DOUBLE = 0xfb
+
+
+def _write_head(out: bytearray, major: int, value: int) -> None:
+    if value < 24:
+        out.append(major << 5 | value)
+    elif value < 0x100:
+        out.append(major << 5 | 24)
+        out.append(value)
+    elif value < 0x10000:
+        out.append(major << 5 | 25)
+        out += struct.pack('>H', value)
+    elif value < 0x100000000:
+        out.append(major << 5 | 26)
+        out += struct.pack('>I', value)
+    else:
+        out.append(major << 5 | 27)
+        out += struct.pack('>Q', value)
+
+
+def _write(out: bytearray, obj) -> None:
+    if obj is None:
+        out.append(_NULL)
+    elif obj is True:
+        out.append(_TRUE)
+    elif obj is False:
+        out.append(_FALSE)
+    elif isinstance(obj, Decimal):
+        _write(out, int(obj) if obj == obj.to_integral_value() else float(obj))
+    elif isinstance(obj, int):
+        if obj >= 0:
+            _write_head(out, _MAJOR_UNSIGNED, obj)
+        else:
+            _write_head(out, _MAJOR_NEGATIVE, -1 - obj)
+    elif isinstance(obj, float):
+        out.append(_DOUBLE)
+        out += struct.pack('>d', obj)
+    elif isinstance(obj, str):
+        encoded = obj.encode('utf-8')
+        _write_head(out, _MAJOR_TEXT, len(encoded))
+        out += encoded
+    elif isinstance(obj, (bytes, bytearray)):
+        _write_head(out, _MAJOR_BYTES, len(obj))
+        out += obj
+    elif isinstance(obj, (list, tuple)):
+        _write_head(out, _MAJOR_ARRAY, len(obj))
+        for item in obj:
+            _write(out, item)
+    elif isinstance(obj, dict):
+        _write_head(out, _MAJOR_MAP, len(obj))
+        for key, value in obj.items():
+            _write(out, key)
+            _write(out, value)
+    else:
+        raise TypeError(f'Object of type {type(obj).__name__} is not CBOR serializable')
+
+
+def dumps(obj) -> bytes:
+    """
+    Encode obj as CBOR.
+    """
+    out = bytearray()
+    _write(out, obj)
+    return bytes(out)
+
+
+def _read_argument(data: bytes, offset: int, info: int):
+    if info < 24:
+        return info, offset
+    if info == 24:
+        return data[offset], offset + 1
+    if info == 25:
+        return struct.unpack_from('>H', data, offset)[0], offset + 2
+    if info == 26:
+        return struct.unpack_from('>I', data, offset)[0], offset + 4
+    if info == 27:
+        return struct.unpack_from('>Q', data, offset)[0], offset + 8
+    raise ValueError(f'Unsupported CBOR argument {info} at offset {offset - 1}')
+
+
+def _read(data: bytes, offset: int):
+    initial = data[offset]
+    major, info = initial >> 5, initial & 0x1f
+    offset += 1
+
+    if major == _MAJOR_SIMPLE:
+        if initial == _NULL:
+            return None, offset
+        if initial == _TRUE:
+            return True, offset
+        if initial == _FALSE:
+            return False, offset
+        if initial == _DOUBLE:
+            return struct.unpack_from('>d', data, offset)[0], offset + 8
+        raise ValueError(f'Unsupported CBOR simple value {initial:#x} at offset {offset - 1}')
+
+    value, offset = _read_argument(data, offset, info)
+    if major == _MAJOR_UNSIGNED:
+        return value, offset
+    if major == _MAJOR_NEGATIVE:
+        return -1 - value, offset
+    if major == _MAJOR_BYTES:
+        return bytes(data[offset:offset + value]), offset + value
+    if major == _MAJOR_TEXT:
+        return bytes(data[offset:offset + value]).decode('utf-8'), offset + value
+    if major == _MAJOR_ARRAY:
+        items = []
+        for _ in range(value):
+            item, offset = _read(data, offset)
+            items.append(item)
+        return items, offset
+    if major == _MAJOR_MAP:
+        items = {}
+        for _ in range(value):
+            key, offset = _read(data, offset)
+            items[key], offset = _read(data, offset)
+        return items, offset
+    raise ValueError(f'Unsupported CBOR major type {major} at offset {offset - 1}')
+
+
+def loads(data: bytes):
+    """
+    Decode a CBOR document produced by dumps().
+    """
+    obj, offset = _read(data, 0)
+    if offset != len(data):
+        raise ValueError(f'Unexpected data after the CBOR document at offset {offset}')
+    return obj
@@ -3,27 +3,72 @@
 
 """
 Helper functions for KMS cryptography
+
+Data keys are cached in the container (envelope encryption with cached data keys): a generated data key encrypts
+up to GAMEKIT_KMS_DATA_KEY_MAX_USES texts during GAMEKIT_KMS_DATA_KEY_MAX_AGE_SECONDS, and a decrypted data key is
+reused for that long. Every blob still carries its own encrypted data key, so blobs are decrypted the same way
+whether or not their data key is cached.
 """
 
-from cryptography.fernet import Fernet
 from base64 import b64decode, b64encode
+from collections import OrderedDict
 import botocore
 import boto3
 import os
+import time
 
 NUM_BYTES_FOR_LEN = 4
 
+DEFAULT_DATA_KEY_MAX_AGE_SECONDS = 300
+DEFAULT_DATA_KEY_MAX_USES = 1000
+
+# Decrypted data keys kept per container, the oldest is dropped first
+MAX_DECRYPTED_DATA_KEYS = 64
+
+_kms_client = None
+
+# cmk_id -> [encrypted data key, plaintext data key, creation time, number of uses]
+_encryption_keys = {}
+
+# encrypted data key -> (plaintext data key, creation time)
+_decryption_keys = OrderedDict()
+
 
 def get_gamekit_key():
     return os.environ.get('GAMEKIT_KMS_KEY_ID'), os.environ.get('GAMEKIT_KMS_KEY_ARN')
 
 
+def clear_data_key_cache():
+    """
+    Drop the cached data keys and the KMS client, the next calls go to KMS
+    """
+    global _kms_client
+    _kms_client = None
+    _encryption_keys.clear()
+    _decryption_keys.clear()
+
+
+def _get_kms_client():
+    global _kms_client
+    if _kms_client is None:
+        _kms_client = boto3.client('kms')
+    return _kms_client
+
+
+def _get_data_key_max_age():
+    return int(os.environ.get('GAMEKIT_KMS_DATA_KEY_MAX_AGE_SECONDS', DEFAULT_DATA_KEY_MAX_AGE_SECONDS))
+
+
+def _get_data_key_max_uses():
+    return int(os.environ.get('GAMEKIT_KMS_DATA_KEY_MAX_USES', DEFAULT_DATA_KEY_MAX_USES))
+
+
 def create_data_key(cmk_id):
     """Generate a data key to use when encrypting and decrypting data
     """
 
     # Create data key
-    kms = boto3.client('kms')
+    kms = _get_kms_client()
     try:
         response = kms.generate_data_key(KeyId=cmk_id, KeySpec='AES_256')
     except botocore.exceptions.ClientError as e:
@@ -34,16 +79,37 @@ def create_data_key(cmk_id):
     return response['CiphertextBlob'], b64encode(response['Plaintext'])
 
 
+def _get_encryption_data_key(cmk_id):
+    """
+    Return the cached data key of cmk_id, or a new one once it's too old or used too often
+    """
+    now = time.monotonic()
+    cached = _encryption_keys.get(cmk_id)
+    if cached is not None and now - cached[2] < _get_data_key_max_age() and cached[3] < _get_data_key_max_uses():
+        cached[3] += 1
+        return cached[0], cached[1]
+
+    data_key_encrypted, data_key_plaintext = create_data_key(cmk_id)
+    if data_key_encrypted is None:
+        _encryption_keys.pop(cmk_id, None)
+        return None, None
+
+    _encryption_keys[cmk_id] = [data_key_encrypted, data_key_plaintext, now, 1]
+    return data_key_encrypted, data_key_plaintext
+
+
 def encrypt_text(cmk_id, text):
     """Encrypt text using an AWS KMS CMK
     """
 
-    # Create data key
-    data_key_encrypted, data_key_plaintext = create_data_key(cmk_id)
+    # Get a data key
+    data_key_encrypted, data_key_plaintext = _get_encryption_data_key(cmk_id)
     if data_key_encrypted is None:
         return False, None
 
     # Encrypt text
+    # cryptography is imported on first use, so that importing this module doesn't load it
+    from cryptography.fernet import Fernet
     f = Fernet(data_key_plaintext)
     encrypted_text = f.encrypt(text.encode('utf-8'))
 
@@ -57,19 +123,29 @@ def encrypt_text(cmk_id, text):
 
 def decrypt_data_key(data_key_encrypted):
     """
-    Decrypt an encrypted data key
+    Decrypt an encrypted data key, or return it from the cache
     """
+    now = time.monotonic()
+    cached = _decryption_keys.get(data_key_encrypted)
+    if cached is not None and now - cached[1] < _get_data_key_max_age():
+        return cached[0]
 
     # Decrypt the data key
-    kms_client = boto3.client('kms')
+    kms_client = _get_kms_client()
     try:
         response = kms_client.decrypt(CiphertextBlob=data_key_encrypted)
-    except botocore.exceptionsClientError as e:
+    except botocore.exceptions.ClientError as e:
         print(e)
         return None
 
-    # Return plaintext base64-encoded binary data key
-    return b64encode((response['Plaintext']))
+    # Cache the plaintext base64-encoded binary data key
+    data_key_plaintext = b64encode((response['Plaintext']))
+    _decryption_keys[data_key_encrypted] = (data_key_plaintext, now)
+    _decryption_keys.move_to_end(data_key_encrypted)
+    while len(_decryption_keys) > MAX_DECRYPTED_DATA_KEYS:
+        _decryption_keys.popitem(last=False)
+
+    return data_key_plaintext
 
 
 def decrypt_blob(cmk_id, encrypted_blob):
@@ -84,6 +160,7 @@ def decrypt_blob(cmk_id, encrypted_blob):
     if data_key_plaintext is None:
         return False, None
 
+    from cryptography.fernet import Fernet
     f = Fernet(data_key_plaintext)
     decrypted_data = f.decrypt(encrypted_data[data_key_encrypted_len:])
     return True, decrypted_data
@@ -6,10 +6,34 @@ Helper functions for DynamoDB
 """
 
 import boto3
+import copy
+import json
+import os
+import time
 from boto3.dynamodb.types import TypeDeserializer, TypeSerializer
 from boto3.dynamodb.conditions import Key
+from collections import OrderedDict
 from datetime import timezone, datetime
-from typing import Dict, Any
+from typing import Callable, Dict, Any
+
+
+# (boto3.resource, resource) of the shared DynamoDB service resource
+_dynamodb_resource = (None, None)
+
+
+def get_dynamodb_resource():
+    """
+    Returns the DynamoDB service resource, created on first use and then shared by every table of the execution environment.
+    Creating a service resource loads its resource model, which is a large part of a function's cold start.
+    :return: DynamoDB service resource
+    """
+    global _dynamodb_resource
+    factory, resource = _dynamodb_resource
+    # Created again if boto3 has been replaced since, for example patched by a test
+    if resource is None or factory is not boto3.resource:
+        resource = boto3.resource('dynamodb')
+        _dynamodb_resource = (boto3.resource, resource)
+    return resource
 
 
 def get_table(table_name):
@@ -18,7 +42,7 @@ def get_table(table_name):
     :param table_name: Name of table
     :return: DynamoDB Table
     """
-    return boto3.resource('dynamodb').Table(table_name)
+    return get_dynamodb_resource().Table(table_name)
 
 
 def deserialize_response_item(response_item) -> Dict[str, Any]:
@@ -65,13 +89,17 @@ def query_request_param(key_id, key_value,
 def scan_request_param(response_limit,
                        use_consistent_read,
                        start_key=None,
-                       filter: boto3.dynamodb.conditions.Key = None) -> Dict[str, Any]:
+                       filter: boto3.dynamodb.conditions.Key = None,
+                       segment: int = None,
+                       total_segments: int = None) -> Dict[str, Any]:
     """
     Creates a Scan request used as an argument to Table.scan()
     :param response_limit: Number of items to return
     :param use_consistent_read: Indicates whether to use consistent read. Default is eventually consistent read.
     :param start_key: If the results are paginated, this is the next start key to use.
     :param filter: The filter to use in the scan.
+    :param segment: For a parallel scan, the segment to scan, from 0 to total_segments - 1.
+    :param total_segments: For a parallel scan, the number of segments the table is divided into.
     :return: Scan request
     """
     param = {
@@ -86,6 +114,10 @@ def scan_request_param(response_limit,
     if filter is not None:
         param['FilterExpression'] = filter
 
+    if total_segments is not None:
+        param['Segment'] = segment
+        param['TotalSegments'] = total_segments
+
     return param
 
 
@@ -155,3 +187,52 @@ def timestamp() -> str:
     Returns a UTC timestamp in ISO format
     """
     return datetime.utcnow().replace(tzinfo=timezone.utc).isoformat()
+
+
+class ReadThroughCache:
+    """
+    Keeps the responses of eventually consistent GetItem and Query requests in the memory of the execution environment.
+    A cached response doesn't show the writes made since it was read, by this or any other function, for up to ttl_seconds.
+    Consistent reads always go to the table. Use one cache per table, unless the requests name their table.
+    """
+
+    def __init__(self, ttl_seconds: float, max_entries: int = 10000):
+        """
+        :param ttl_seconds: How long a response is served from memory. 0 or less disables the cache.
+        :param max_entries: Number of responses kept, the least recently used are dropped first.
+        """
+        self.ttl_seconds = ttl_seconds
+        self.max_entries = max_entries
+        self._entries = OrderedDict()
+
+    def read(self, request: Dict[str, Any], read: Callable[[], Any]) -> Any:
+        """
+        Returns the cached response of request if it's fresh, else the response of read(), which is cached if the request
+        is eventually consistent.
+        :param request: The request, used as the cache key
+        :param read: Sends the request to DynamoDB
+        :return: A copy of the response, which the caller may modify
+        """
+        if self.ttl_seconds <= 0 or request.get('ConsistentRead'):
+            return read()
+
+        key = json.dumps(request, sort_keys=True, default=str)
+        now = time.monotonic()
+        entry = self._entries.get(key)
+        if entry is not None and entry[0] > now:
+            self._entries.move_to_end(key)
+            return copy.deepcopy(entry[1])
+
+        response = read()
+        self._entries[key] = (now + self.ttl_seconds, response)
+        self._entries.move_to_end(key)
+        while len(self._entries) > self.max_entries:
+            self._entries.popitem(last=False)
+        return copy.deepcopy(response)
+
+
+def get_read_cache() -> ReadThroughCache:
+    """
+    Returns a read-through cache configured by the READ_CACHE_SECONDS environment variable, disabled if unset.
+    """
+    return ReadThroughCache(float(os.environ.get('READ_CACHE_SECONDS', '0')))
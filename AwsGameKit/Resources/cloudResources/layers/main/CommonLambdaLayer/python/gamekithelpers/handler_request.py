@@ -13,17 +13,50 @@ import os
 from typing import Optional, List, Dict
 import re
 
-from gamekithelpers import ddb
+from gamekithelpers import ddb, metrics
 from gamekithelpers.types import JsonObject
 
 logger = logging.getLogger()
 logger.setLevel(logging.INFO)
 
+# Time the AWS calls of the clients the handlers create at import
+metrics.instrument_boto3()
+
+# Sent by the Unreal plugin with the request ID of the client call, see FAwsGameKitTrace::GetRequestId()
+CLIENT_REQUEST_ID_HEADER = 'x-gamekit-request-id'
+
+
+def get_header(event: dict, name: str) -> Optional[str]:
+    """
+    Get a request header by its case-insensitive name, or None.
+    """
+    headers = event.get('headers') or {}
+    name = name.lower()
+    for key, value in headers.items():
+        if key.lower() == name:
+            return value
+    return None
+
+
+def get_trace_id() -> Optional[str]:
+    """
+    Get the X-Ray trace ID (Root=...) of the current invocation, or None when it isn't traced.
+    """
+    trace_header = os.environ.get('_X_AMZN_TRACE_ID')
+    if not trace_header:
+        return None
+    for part in trace_header.split(';'):
+        if part.startswith('Root='):
+            return part[len('Root='):]
+    return None
+
 
 def log_event(event: dict) -> None:
     """
-    Log details from the event for security and debugging purposes.
+    Log details from the event for security and debugging purposes. Also starts measuring the invocation, see gamekithelpers.metrics.
     """
+    metrics.start_invocation(event)
+
     # Do not log if DETAILED_LOGGING_DISABLED setting is turned ON
     if bool(strtobool(os.environ.get('DETAILED_LOGGING_DISABLED', 'false'))):
         return
@@ -35,7 +68,10 @@ def log_event(event: dict) -> None:
         'did_try_cognito_auth': False,
         'cognito_auth_success': False,
         'gk_user_id': None,
-        'iam_caller': None
+        'iam_caller': None,
+        'client_request_id': get_header(event, CLIENT_REQUEST_ID_HEADER),
+        'api_request_id': (event.get('requestContext') or {}).get('requestId'),
+        'trace_id': get_trace_id()
     }
 
     if event.get('headers') and event.get('headers').get('X-Forwarded-For'):
@@ -58,7 +94,8 @@ def log_event(event: dict) -> None:
         f"Resource:: {log_items['resource']} ; "
         f"Source IP:: {log_items['source_ip']} ; "
         f"IAM Auth Identifiers:: IAM auth used: {log_items['has_amzn_security_token']} ; IAM Caller: {log_items['iam_caller']} ; "
-        f"Cognito Auth Identifiers:: Cognito Auth Attempted: {log_items['did_try_cognito_auth']} ; Cognito Auth Success: {log_items['cognito_auth_success']} ; Opaque Gamekit User ID: {log_items['gk_user_id']}"
+        f"Cognito Auth Identifiers:: Cognito Auth Attempted: {log_items['did_try_cognito_auth']} ; Cognito Auth Success: {log_items['cognito_auth_success']} ; Opaque Gamekit User ID: {log_items['gk_user_id']} ; "
+        f"Correlation:: Client Request ID: {log_items['client_request_id']} ; API Request ID: {log_items['api_request_id']} ; X-Ray Trace ID: {log_items['trace_id']}"
     )
     logger.info(log_message)
 
@@ -5,10 +5,12 @@
 Helper functions for creating Response objects.
 """
 
+import base64
 import json
 from decimal import Decimal
 from http.client import responses
 
+from gamekithelpers import cbor, metrics, throttle
 from gamekithelpers.pagination import generate_pagination_token
 from gamekithelpers.types import JsonObject
 
@@ -45,20 +47,44 @@ def forbidden_request() -> dict:
     return return_response(403, responses[403])
 
 
+def too_many_requests(retry_after: float) -> dict:
+    """
+    Returns a generic too many requests response back, with a Retry-After header.
+    Used when the player exceeded the rate limit of the function, see gamekithelpers.throttle.
+    """
+    response = return_response(429, responses[429])
+    response['headers']['Retry-After'] = throttle.retry_after_header(retry_after)
+    return response
+
+
+def accepts_cbor(event: dict) -> bool:
+    """
+    Whether the request's Accept header asks for a CBOR encoded response.
+    """
+    headers = (event or {}).get('headers') or {}
+    accept = next((value for name, value in headers.items() if name.lower() == 'accept'), None)
+    return accept is not None and cbor.CONTENT_TYPE in accept.lower()
+
+
 def response_envelope(status_code: int,
                       status_message: str = None,
                       response_obj: JsonObject = None,
                       next_start_key: dict = None,
-                      player_id: str = None) -> dict:
+                      player_id: str = None,
+                      event: dict = None) -> dict:
     """
     Build an HTTP response following the schema expected by GameKit CPP SDK.
 
+    The envelope is encoded as JSON, or as CBOR when the event is passed and its Accept header asks for application/cbor.
+    CBOR is more compact and cheaper to encode and decode for large payloads, such as bundles or achievement pages.
+
     Status codes should match to the following situations:
     200: Success with body for GET requests and optionally for PUT, POST, and DELETE requests.
     204: No Content, Use return_response(204)
     400: See/Use invalid_request()
     401: Unauthorized, there is no player id for the player facing method.
     403: See/Use forbidden_request()
+    429: See/Use too_many_requests()
     404: Not found, when a resource for a GET request doesn't exist, or using POST to update a resource that doesn't exist.
     """
 
@@ -83,6 +109,9 @@ def response_envelope(status_code: int,
           envelope[ENVELOPE_KEY_PAGING][ENVELOPE_KEY_PAGING_TOKEN] = paging_token
           envelope[ENVELOPE_KEY_PAGING][ENVELOPE_KEY_PAGING_VERSION_KEY] = ENVELOPE_KEY_PAGING_VERSION
 
+    if accepts_cbor(event):
+        return return_binary_response(status_code, cbor.dumps(envelope), cbor.CONTENT_TYPE)
+
     return return_response(status_code, json.dumps(envelope, cls=DecimalEncoder))
 
 
@@ -94,6 +123,7 @@ def return_response(status_code: int, body: str = None, content_type: str = 'app
 
     Body can be None, e.g. 204 no content response. Use when deleting items even if they don't exist.
     """
+    metrics.end_invocation(status_code, len(body.encode('utf-8')) if isinstance(body, str) else len(body or ''))
     return {
         'statusCode': status_code,
         'headers': {
@@ -101,3 +131,20 @@ def return_response(status_code: int, body: str = None, content_type: str = 'app
         },
         'body': body
     }
+
+
+def return_binary_response(status_code: int, body: bytes, content_type: str) -> dict:
+    """
+    Build a response object with a binary body.
+
+    API Gateway decodes the body, which is base64 encoded, when content_type is one of the API's binary media types.
+    """
+    metrics.end_invocation(status_code, len(body))
+    return {
+        'statusCode': status_code,
+        'headers': {
+            'Content-Type': content_type,
+        },
+        'body': base64.b64encode(body).decode('ascii'),
+        'isBase64Encoded': True
+    }
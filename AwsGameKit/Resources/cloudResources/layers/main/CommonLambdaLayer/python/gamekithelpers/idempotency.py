@@ -0,0 +1,165 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Idempotency keys of the player facing write functions
+"""
+
+import copy
+import hashlib
+import logging
+import os
+import re
+import time
+from typing import Callable, Optional
+
+import botocore
+
+from gamekithelpers import ddb, handler_request, handler_response, metrics
+
+logger = logging.getLogger()
+
+# Sent by the client with a key it generates once per write, and sends again when it retries that write
+IDEMPOTENCY_KEY_HEADER = 'idempotency-key'
+
+# Set on the responses replayed from an earlier call with the same key
+IDEMPOTENT_REPLAYED_HEADER = 'Idempotent-Replayed'
+
+# Keys are UUIDs, or any other printable token of up to 128 characters
+_KEY_PATTERN = re.compile(r'^[\x21-\x7e]{1,128}$')
+
+_STATUS_IN_PROGRESS = 'IN_PROGRESS'
+_STATUS_COMPLETED = 'COMPLETED'
+
+
+class IdempotencyStore:
+    """
+    Records the idempotency keys of a player's writes in a DynamoDB table, with the response of each write.
+    The table has a player_id partition key, an idempotency_key sort key, and TTL enabled on its ttl attribute.
+
+    A write claims its key with a conditional put before it runs. A later call with the same key doesn't run the write again:
+    it gets the recorded response if the write completed, or a 409 while the write is still running. A write which raised,
+    or failed in a way a retry may fix (by default a server error), releases its key so that it can be retried.
+    Keys are scoped to the player, and a key reused for a different request is rejected with a 422.
+    """
+
+    def __init__(self, table_name: Optional[str], ttl_seconds: int):
+        """
+        :param table_name: The idempotency keys table. None disables idempotency keys, the writes always run.
+        :param ttl_seconds: How long a key is remembered, which should cover the longest time a client retries a write.
+        """
+        self.table = ddb.get_table(table_name) if table_name else None
+        self.ttl_seconds = ttl_seconds
+
+    def run(self, event: dict, player_id: str, write: Callable[[], dict],
+            is_retryable: Callable[[dict], bool] = None) -> dict:
+        """
+        Runs write() once per idempotency key of the player, and returns its response.
+        Requests without an Idempotency-Key header always run write().
+        :param event: The Lambda event, read for the Idempotency-Key header and the request
+        :param player_id: The player making the call
+        :param write: Runs the write and returns the response
+        :param is_retryable: Whether a response failed in a way that a retry may fix, so it isn't recorded. Defaults to server errors.
+        :return: The response of write(), or the recorded response of an earlier call with the same key
+        """
+        key = handler_request.get_header(event, IDEMPOTENCY_KEY_HEADER)
+        if self.table is None or key is None:
+            return write()
+
+        if not _KEY_PATTERN.match(key):
+            return handler_response.invalid_request()
+
+        fingerprint = _fingerprint(event)
+        if not self._claim(player_id, key, fingerprint):
+            return self._replay(player_id, key, fingerprint)
+
+        try:
+            response = write()
+        except Exception:
+            self._release(player_id, key)
+            raise
+
+        if (is_retryable or _is_server_error)(response):
+            self._release(player_id, key)
+        else:
+            self._complete(player_id, key, response)
+        return response
+
+    def _claim(self, player_id: str, key: str, fingerprint: str) -> bool:
+        now = int(time.time())
+        try:
+            self.table.put_item(
+                Item={
+                    'player_id': player_id,
+                    'idempotency_key': key,
+                    'status': _STATUS_IN_PROGRESS,
+                    'fingerprint': fingerprint,
+                    'ttl': now + self.ttl_seconds
+                },
+                # TTL deletes expired items within a few days, they no longer hold their key
+                ConditionExpression='attribute_not_exists(player_id) or #ttl < :now',
+                ExpressionAttributeNames={'#ttl': 'ttl'},
+                ExpressionAttributeValues={':now': now})
+            return True
+        except botocore.exceptions.ClientError as err:
+            if err.response['Error']['Code'] == 'ConditionalCheckFailedException':
+                return False
+            raise
+
+    def _replay(self, player_id: str, key: str, fingerprint: str) -> dict:
+        item = ddb.get_response_item(self.table.get_item(
+            **ddb.get_item_request_param({'player_id': player_id, 'idempotency_key': key}, True)))
+
+        if item is None or item.get('status') != _STATUS_COMPLETED:
+            # The first call is still running, or released the key since: the client retries later
+            response = handler_response.response_envelope(409)
+            response['headers']['Retry-After'] = '1'
+            return response
+
+        if item.get('fingerprint') != fingerprint:
+            return handler_response.response_envelope(422, 'Idempotency-Key reused for a different request')
+
+        logger.info(f"Replaying the response of idempotency key {key}")
+        response = copy.deepcopy(item['response'])
+        response['statusCode'] = int(response['statusCode'])
+        response.setdefault('headers', {})[IDEMPOTENT_REPLAYED_HEADER] = 'true'
+        metrics.end_invocation(response['statusCode'], len(response.get('body') or ''))
+        return response
+
+    def _complete(self, player_id: str, key: str, response: dict) -> None:
+        try:
+            self.table.update_item(
+                Key={'player_id': player_id, 'idempotency_key': key},
+                UpdateExpression='SET #status = :status, #response = :response',
+                ExpressionAttributeNames={'#status': 'status', '#response': 'response'},
+                ExpressionAttributeValues={':status': _STATUS_COMPLETED, ':response': response})
+        except botocore.exceptions.ClientError as err:
+            # The write went through, its retries get a 409 until the key expires
+            logger.error(f"Error recording the response of idempotency key {key}. Error: {err}")
+
+    def _release(self, player_id: str, key: str) -> None:
+        try:
+            self.table.delete_item(Key={'player_id': player_id, 'idempotency_key': key})
+        except botocore.exceptions.ClientError as err:
+            logger.error(f"Error releasing idempotency key {key}. Error: {err}")
+
+
+def _is_server_error(response: dict) -> bool:
+    return response.get('statusCode', 500) >= 500
+
+
+def _fingerprint(event: dict) -> str:
+    """
+    Hashes what identifies a write: its method, path and body.
+    """
+    request = '\n'.join([event.get('httpMethod') or '', event.get('path') or '', event.get('body') or ''])
+    return hashlib.sha256(request.encode('utf-8')).hexdigest()
+
+
+def get_idempotency_store() -> IdempotencyStore:
+    """
+    Returns an idempotency store configured by the IDEMPOTENCY_TABLE_NAME and IDEMPOTENCY_KEY_TTL_SECONDS environment
+    variables, disabled if IDEMPOTENCY_TABLE_NAME is unset.
+    """
+    return IdempotencyStore(os.environ.get('IDEMPOTENCY_TABLE_NAME'),
+                            int(os.environ.get('IDEMPOTENCY_KEY_TTL_SECONDS', '86400')))
@@ -0,0 +1,153 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Helper functions for the handlers' CloudWatch metrics, written as Embedded Metric Format (EMF) log records.
+
+handler_request.log_event() starts measuring an invocation and the handler_response builders end it. The AWS calls made in between,
+through any boto3 client or resource created after this module is imported, are timed per service. At the end of the invocation,
+one record is printed for the handler and one per service called, and CloudWatch turns them into metrics of the GameKit namespace:
+- HandlerLatency (Milliseconds) and ResponseBytes (Bytes), with the FunctionName dimension.
+- DependencyLatency (Milliseconds), DependencyCalls (Count) and DependencyResponseBytes (Bytes), with the FunctionName and
+  Dependency (DynamoDB, S3, KMS...) dimensions. The operations called are kept in the log record, for CloudWatch Logs Insights.
+
+The feature dashboards chart their percentiles. Records are only printed when running in Lambda, and not at all when the
+GAMEKIT_METRICS_DISABLED environment variable is "true".
+"""
+
+import json
+import os
+import time
+from typing import Optional
+
+import boto3
+
+NAMESPACE = 'GameKit'
+
+# Set between start_invocation() and end_invocation()
+_invocation = None
+_boto3_instrumented = False
+
+
+def is_enabled() -> bool:
+    return bool(os.environ.get('AWS_LAMBDA_FUNCTION_NAME')) and os.environ.get('GAMEKIT_METRICS_DISABLED', 'false').lower() != 'true'
+
+
+def start_invocation(event: dict) -> None:
+    """
+    Start measuring an invocation. Called by handler_request.log_event().
+    """
+    global _invocation
+    if not is_enabled():
+        _invocation = None
+        return
+
+    _invocation = {
+        'route': f"{(event or {}).get('httpMethod')} {(event or {}).get('resource')}",
+        'start': time.perf_counter(),
+        'dependencies': {}
+    }
+
+
+def record_dependency(dependency: str, operation: str, duration_ms: float, response_bytes: int = 0) -> None:
+    """
+    Add one call of an AWS service, or of any other dependency, to the current invocation.
+    """
+    if _invocation is None:
+        return
+
+    entry = _invocation['dependencies'].setdefault(dependency, {'latencies': [], 'bytes': 0, 'operations': {}})
+    entry['latencies'].append(round(duration_ms, 3))
+    entry['bytes'] += response_bytes
+    entry['operations'][operation] = entry['operations'].get(operation, 0) + 1
+
+
+def end_invocation(status_code: int, response_bytes: int) -> None:
+    """
+    Print the metric records of the current invocation. Called by the handler_response builders, only the first call counts.
+    """
+    global _invocation
+    invocation = _invocation
+    _invocation = None
+    if invocation is None:
+        return
+
+    function_name = os.environ.get('AWS_LAMBDA_FUNCTION_NAME')
+    duration_ms = (time.perf_counter() - invocation['start']) * 1000.0
+    _print_record(['FunctionName'], [('HandlerLatency', 'Milliseconds'), ('ResponseBytes', 'Bytes')], {
+        'FunctionName': function_name,
+        'Route': invocation['route'],
+        'StatusCode': status_code,
+        'HandlerLatency': round(duration_ms, 3),
+        'ResponseBytes': response_bytes
+    })
+
+    for dependency, entry in invocation['dependencies'].items():
+        _print_record(['FunctionName', 'Dependency'], [('DependencyLatency', 'Milliseconds'), ('DependencyCalls', 'Count'), ('DependencyResponseBytes', 'Bytes')], {
+            'FunctionName': function_name,
+            'Dependency': dependency,
+            'Route': invocation['route'],
+            'Operations': entry['operations'],
+            'DependencyLatency': entry['latencies'],
+            'DependencyCalls': len(entry['latencies']),
+            'DependencyResponseBytes': entry['bytes']
+        })
+
+
+def instrument_boto3() -> None:
+    """
+    Time the calls of the boto3 clients and resources created from now on. Called when handler_request is imported.
+    """
+    global _boto3_instrumented
+    if _boto3_instrumented:
+        return
+
+    try:
+        if boto3.DEFAULT_SESSION is None:
+            boto3.setup_default_session()
+        events = boto3.DEFAULT_SESSION.events
+    except AttributeError:
+        # boto3 is mocked
+        return
+
+    events.register('before-call', _before_aws_call)
+    events.register('after-call', _after_aws_call)
+    _boto3_instrumented = True
+
+
+def _before_aws_call(context: Optional[dict] = None, **kwargs) -> None:
+    if _invocation is not None and context is not None:
+        context['gamekit_metrics_start'] = time.perf_counter()
+
+
+def _after_aws_call(model=None, http_response=None, context: Optional[dict] = None, **kwargs) -> None:
+    start = context.get('gamekit_metrics_start') if context is not None else None
+    if start is None or model is None:
+        return
+
+    # Content-Length only, reading the body would consume the stream of S3 GetObject
+    response_bytes = 0
+    if http_response is not None:
+        try:
+            response_bytes = int(http_response.headers.get('content-length', 0))
+        except (TypeError, ValueError):
+            pass
+
+    record_dependency(model.service_model.service_id, model.name, (time.perf_counter() - start) * 1000.0, response_bytes)
+
+
+def _print_record(dimensions: list, metrics: list, values: dict) -> None:
+    record = {
+        '_aws': {
+            'Timestamp': int(time.time() * 1000),
+            'CloudWatchMetrics': [{
+                'Namespace': NAMESPACE,
+                'Dimensions': [dimensions],
+                'Metrics': [{'Name': name, 'Unit': unit} for name, unit in metrics]
+            }]
+        }
+    }
+    record.update(values)
+
+    # EMF records must be written to stdout as standalone JSON lines, without the logging module's prefix
+    print(json.dumps(record, separators=(',', ':')), flush=True)
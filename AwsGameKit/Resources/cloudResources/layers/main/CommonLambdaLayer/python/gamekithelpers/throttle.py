@@ -0,0 +1,71 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Per-player rate limits of the player facing functions
+"""
+
+import math
+import os
+import time
+from collections import OrderedDict
+
+
+class PlayerRateLimiter:
+    """
+    Token bucket per player, kept in the memory of the execution environment.
+    Each player may make burst_limit calls at once, then rate_limit calls per second. The limit applies to each execution
+    environment, so a player whose calls are spread over several environments is allowed a multiple of it: pair it with the
+    API Gateway throttling of the method, which caps the calls of all the players together.
+    """
+
+    def __init__(self, rate_limit: float, burst_limit: float, max_players: int = 10000):
+        """
+        :param rate_limit: Calls per second a player is allowed in the long run. 0 or less disables the limit.
+        :param burst_limit: Calls a player may make at once, at least 1.
+        :param max_players: Number of players tracked, the least recently seen are dropped first.
+        """
+        self.rate_limit = rate_limit
+        self.burst_limit = max(1.0, burst_limit)
+        self.max_players = max_players
+        self._buckets = OrderedDict()
+
+    def try_acquire(self, player_id: str) -> float:
+        """
+        Takes a token from the player's bucket.
+        :param player_id: The player making the call
+        :return: 0 if the call may proceed, else the number of seconds until the player's next token
+        """
+        if self.rate_limit <= 0:
+            return 0
+
+        now = time.monotonic()
+        tokens, updated_at = self._buckets.get(player_id, (self.burst_limit, now))
+        tokens = min(self.burst_limit, tokens + (now - updated_at) * self.rate_limit)
+
+        retry_after = 0
+        if tokens >= 1:
+            tokens -= 1
+        else:
+            retry_after = (1 - tokens) / self.rate_limit
+
+        self._buckets[player_id] = (tokens, now)
+        self._buckets.move_to_end(player_id)
+        while len(self._buckets) > self.max_players:
+            self._buckets.popitem(last=False)
+        return retry_after
+
+
+def get_player_rate_limiter() -> PlayerRateLimiter:
+    """
+    Returns a rate limiter configured by the PLAYER_RATE_LIMIT and PLAYER_BURST_LIMIT environment variables, disabled if unset.
+    """
+    rate_limit = float(os.environ.get('PLAYER_RATE_LIMIT', '0'))
+    return PlayerRateLimiter(rate_limit, float(os.environ.get('PLAYER_BURST_LIMIT', '0')) or rate_limit)
+
+
+def retry_after_header(retry_after: float) -> str:
+    """
+    Formats a delay as the whole number of seconds of a Retry-After header.
+    """
+    return str(max(1, math.ceil(retry_after)))
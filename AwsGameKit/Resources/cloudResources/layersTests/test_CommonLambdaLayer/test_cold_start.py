@@ -0,0 +1,85 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Cold start benchmark for the CommonLambdaLayer helpers.
+
+Each measurement runs in a new interpreter, like a new Lambda execution environment, and times the init code of a
+function which uses a few DynamoDB tables and the crypto helpers. The "before" script does what the helpers did before
+they shared the DynamoDB resource and imported cryptography lazily, the "after" script uses the helpers as they are.
+
+The durations are only reported, timings are too noisy on shared machines to fail a build on. Set
+GAMEKIT_ASSERT_COLD_START=1 to also check that "after" is faster than "before".
+"""
+
+import importlib.util
+import os
+import statistics
+import subprocess
+import sys
+import textwrap
+from unittest import TestCase, skipUnless
+
+LAYER_PATH = os.path.abspath(os.path.join(
+    os.path.dirname(__file__), '..', '..', 'layers', 'main', 'CommonLambdaLayer', 'python'))
+
+RUNS = 5
+TABLE_COUNT = 3
+ASSERT_COLD_START = os.environ.get('GAMEKIT_ASSERT_COLD_START') == '1'
+
+INIT_BEFORE = f'''
+import boto3
+from cryptography.fernet import Fernet
+from gamekithelpers import crypto, ddb
+tables = [boto3.resource('dynamodb').Table(f'table{{i}}') for i in range({TABLE_COUNT})]
+'''
+
+INIT_AFTER = f'''
+from gamekithelpers import crypto, ddb
+tables = [ddb.get_table(f'table{{i}}') for i in range({TABLE_COUNT})]
+'''
+
+
+def _has_module(name):
+    try:
+        return importlib.util.find_spec(name) is not None
+    except ModuleNotFoundError:
+        return False
+
+
+def _run_in_new_interpreter(code):
+    env = dict(os.environ)
+    env['PYTHONPATH'] = os.pathsep.join([LAYER_PATH] + sys.path)
+    env.setdefault('AWS_DEFAULT_REGION', 'us-west-2')
+    result = subprocess.run([sys.executable, '-c', code], env=env, capture_output=True, text=True, check=True)
+    return result.stdout.strip()
+
+
+def _measure_init_duration(init_code):
+    """
+    Returns the init duration of the code in a new interpreter, in milliseconds
+    """
+    code = 'import time\nstart = time.perf_counter()\n' + init_code + \
+        '\nprint((time.perf_counter() - start) * 1000)\n'
+    return float(_run_in_new_interpreter(code))
+
+
+class TestColdStart(TestCase):
+    def test_importing_crypto_does_not_load_cryptography(self):
+        loaded = _run_in_new_interpreter(textwrap.dedent('''
+            import sys
+            from gamekithelpers import crypto
+            print(any(name == 'cryptography' or name.startswith('cryptography.') for name in sys.modules))
+        '''))
+
+        self.assertEqual('False', loaded)
+
+    @skipUnless(_has_module('boto3.session') and _has_module('cryptography'),
+                'the benchmark needs boto3 and cryptography')
+    def test_init_duration(self):
+        before = statistics.median(_measure_init_duration(INIT_BEFORE) for _ in range(RUNS))
+        after = statistics.median(_measure_init_duration(INIT_AFTER) for _ in range(RUNS))
+
+        print(f'\nInit duration, median of {RUNS} runs: before {before:.1f} ms, after {after:.1f} ms')
+        if ASSERT_COLD_START:
+            self.assertLess(after, before)
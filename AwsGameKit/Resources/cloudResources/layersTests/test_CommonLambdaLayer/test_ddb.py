@@ -0,0 +1,68 @@
+from unittest import TestCase
+from unittest.mock import MagicMock, patch
+
+from layers.main.CommonLambdaLayer.python.gamekithelpers import ddb
+
+
+class TestReadThroughCache(TestCase):
+
+    def setUp(self):
+        self.request = {'TableName': 'bundle_items', 'Key': {'player_id_bundle': {'S': 'player_bundle'}}}
+        self.read = MagicMock(return_value={'Item': {'value': {'S': 'foo'}}})
+
+    def test_disabled_cache_always_reads(self):
+        cache = ddb.ReadThroughCache(0)
+
+        cache.read(self.request, self.read)
+        cache.read(self.request, self.read)
+
+        self.assertEqual(2, self.read.call_count)
+
+    def test_eventually_consistent_reads_are_served_from_memory(self):
+        cache = ddb.ReadThroughCache(30)
+
+        first = cache.read(self.request, self.read)
+        second = cache.read(dict(self.request), self.read)
+
+        self.read.assert_called_once()
+        self.assertEqual(first, second)
+
+    def test_consistent_reads_always_read(self):
+        cache = ddb.ReadThroughCache(30)
+        self.request['ConsistentRead'] = True
+
+        cache.read(self.request, self.read)
+        cache.read(self.request, self.read)
+
+        self.assertEqual(2, self.read.call_count)
+
+    def test_expired_responses_are_read_again(self):
+        cache = ddb.ReadThroughCache(30)
+
+        with patch('layers.main.CommonLambdaLayer.python.gamekithelpers.ddb.time.monotonic') as mock_monotonic:
+            mock_monotonic.return_value = 100.0
+            cache.read(self.request, self.read)
+            mock_monotonic.return_value = 131.0
+            cache.read(self.request, self.read)
+
+        self.assertEqual(2, self.read.call_count)
+
+    def test_callers_get_copies_of_the_cached_response(self):
+        cache = ddb.ReadThroughCache(30)
+
+        cache.read(self.request, self.read)['Item']['value'] = {'S': 'bar'}
+
+        self.assertEqual({'S': 'foo'}, cache.read(self.request, self.read)['Item']['value'])
+
+    def test_least_recently_used_responses_are_dropped_first(self):
+        cache = ddb.ReadThroughCache(30, max_entries=2)
+        other_requests = [{'TableName': 'bundle_items', 'Key': {'player_id_bundle': {'S': f'other_{i}'}}} for i in range(2)]
+
+        cache.read(self.request, self.read)
+        cache.read(other_requests[0], self.read)
+        cache.read(self.request, self.read)
+        cache.read(other_requests[1], self.read)
+        cache.read(self.request, self.read)
+        cache.read(other_requests[0], self.read)
+
+        self.assertEqual(4, self.read.call_count)
@@ -0,0 +1,146 @@
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+
+from unittest import TestCase
+from unittest.mock import MagicMock
+
+import botocore
+
+from layers.main.CommonLambdaLayer.python.gamekithelpers import idempotency
+
+PLAYER_ID = 'test_gamekit_player_id'
+IDEMPOTENCY_KEY = 'f0e4c2f7-6f5e-4d4b-9b6a-0c1d2e3f4a5b'
+
+
+class ConditionalCheckFailedException(botocore.exceptions.ClientError):
+    def __init__(self):
+        super().__init__({'Error': {'Code': 'ConditionalCheckFailedException', 'Message': ''}}, 'PutItem')
+
+
+class TestIdempotencyStore(TestCase):
+
+    def setUp(self):
+        self.store = idempotency.IdempotencyStore(None, 3600)
+        self.store.table = MagicMock()
+        self.event = {
+            'httpMethod': 'POST',
+            'path': '/bundles/BANANA_BUNDLE',
+            'headers': {'Idempotency-Key': IDEMPOTENCY_KEY},
+            'body': '{"delta": 1}'
+        }
+        self.response = {'statusCode': 200, 'headers': {}, 'body': '{"data": {}}'}
+        self.write = MagicMock(return_value=self.response)
+
+    def test_runs_the_write_without_a_table(self):
+        store = idempotency.IdempotencyStore(None, 3600)
+
+        result = store.run(self.event, PLAYER_ID, self.write)
+
+        self.assertEqual(self.response, result)
+        self.write.assert_called_once()
+
+    def test_runs_the_write_without_a_key(self):
+        self.event['headers'] = {}
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.assertEqual(self.response, result)
+        self.store.table.put_item.assert_not_called()
+
+    def test_rejects_a_malformed_key(self):
+        self.event['headers']['Idempotency-Key'] = 'not a key'
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.assertEqual(400, result['statusCode'])
+        self.write.assert_not_called()
+
+    def test_claims_the_key_and_records_the_response(self):
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.assertEqual(self.response, result)
+        claim = self.store.table.put_item.call_args.kwargs
+        self.assertEqual({'player_id': PLAYER_ID, 'idempotency_key': IDEMPOTENCY_KEY},
+                         {key: claim['Item'][key] for key in ('player_id', 'idempotency_key')})
+        self.assertEqual('IN_PROGRESS', claim['Item']['status'])
+        self.assertIn('ConditionExpression', claim)
+        recorded = self.store.table.update_item.call_args.kwargs['ExpressionAttributeValues']
+        self.assertEqual('COMPLETED', recorded[':status'])
+        self.assertEqual(self.response, recorded[':response'])
+
+    def test_replays_the_recorded_response_of_a_claimed_key(self):
+        self.store.table.put_item.side_effect = ConditionalCheckFailedException()
+        self.store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(self.event),
+            'response': {'statusCode': '200', 'headers': {}, 'body': '{"data": {}}'}
+        }}
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.write.assert_not_called()
+        self.assertEqual(200, result['statusCode'])
+        self.assertEqual('{"data": {}}', result['body'])
+        self.assertEqual('true', result['headers'][idempotency.IDEMPOTENT_REPLAYED_HEADER])
+
+    def test_returns_a_409_while_the_key_is_in_progress(self):
+        self.store.table.put_item.side_effect = ConditionalCheckFailedException()
+        self.store.table.get_item.return_value = {'Item': {
+            'status': 'IN_PROGRESS',
+            'fingerprint': idempotency._fingerprint(self.event)
+        }}
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.write.assert_not_called()
+        self.assertEqual(409, result['statusCode'])
+        self.assertEqual('1', result['headers']['Retry-After'])
+
+    def test_returns_a_422_when_the_key_was_used_for_another_request(self):
+        self.store.table.put_item.side_effect = ConditionalCheckFailedException()
+        self.store.table.get_item.return_value = {'Item': {
+            'status': 'COMPLETED',
+            'fingerprint': idempotency._fingerprint(self.event),
+            'response': self.response
+        }}
+        self.event['body'] = '{"delta": 2}'
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.write.assert_not_called()
+        self.assertEqual(422, result['statusCode'])
+
+    def test_releases_the_key_after_a_server_error(self):
+        self.write.return_value = {'statusCode': 500, 'headers': {}, 'body': ''}
+
+        result = self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.assertEqual(500, result['statusCode'])
+        self.store.table.delete_item.assert_called_once_with(Key={'player_id': PLAYER_ID, 'idempotency_key': IDEMPOTENCY_KEY})
+        self.store.table.update_item.assert_not_called()
+
+    def test_releases_the_key_after_an_exception(self):
+        self.write.side_effect = RuntimeError('write failed')
+
+        with self.assertRaises(RuntimeError):
+            self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.store.table.delete_item.assert_called_once_with(Key={'player_id': PLAYER_ID, 'idempotency_key': IDEMPOTENCY_KEY})
+        self.store.table.update_item.assert_not_called()
+
+    def test_releases_the_key_of_a_response_the_caller_marks_retryable(self):
+        self.write.return_value = {'statusCode': 409, 'headers': {}, 'body': ''}
+
+        self.store.run(self.event, PLAYER_ID, self.write, lambda response: response['statusCode'] == 409)
+
+        self.store.table.delete_item.assert_called_once()
+        self.store.table.update_item.assert_not_called()
+
+    def test_raises_other_claim_errors(self):
+        self.store.table.put_item.side_effect = botocore.exceptions.ClientError(
+            {'Error': {'Code': 'ProvisionedThroughputExceededException', 'Message': ''}}, 'PutItem')
+
+        with self.assertRaises(botocore.exceptions.ClientError):
+            self.store.run(self.event, PLAYER_ID, self.write)
+
+        self.write.assert_not_called()
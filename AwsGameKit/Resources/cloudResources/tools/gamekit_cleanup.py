@@ -4,7 +4,9 @@
 # To successfully run, attach the policy in this directory to the IAM user whose credentials are being used.
 
 import argparse
+import threading
 import time
+from concurrent.futures import ThreadPoolExecutor
 
 import boto3
 import botocore
@@ -13,6 +15,21 @@ from numpy import base_repr
 
 POLICY_TIP = "\nIf permission error make sure to attach the policy in this directory to the IAM user whose credentials are being used.\n"
 
+# Largest number of keys accepted by one S3 DeleteObjects request
+S3_DELETE_BATCH_SIZE = 1000
+
+# Largest number of names accepted by one SSM DeleteParameters request
+SSM_DELETE_BATCH_SIZE = 10
+
+STACK_POLL_SECONDS = 5
+
+# Feature stacks import from the identity stack, which imports from the main stack, so the stacks are deleted in these waves
+FEATURE_STACK_WAVES = [
+    ['achievements', 'gamesaving', 'usergamedata'],
+    ['identity'],
+    ['main']
+]
+
 def cf_stack_delete_success_states():
     return ['DELETE_COMPLETE']
 
@@ -66,113 +83,229 @@ class bcolors:
     UNDERLINE = '\033[4m'
 
 
+# Deletions run on several threads, so each message is printed as one line
+print_lock = threading.Lock()
+
+def log(message):
+    with print_lock:
+        print(message, flush=True)
+
+
 class GameKitCleaner:
     def __init__(self, gamename, environment, region, keyid, secret):
         self.gamename = gamename
         self.environment = environment
         self.region = region
-        self.keyid = keyid
-        self.secret = secret
+
+        # Clients are thread safe once created, but creating them isn't, so they are all created here
+        session = boto3.session.Session(aws_access_key_id=keyid, aws_secret_access_key=secret, region_name=region)
+        self.cfclient = session.client('cloudformation')
+        self.ssmclient = session.client('ssm')
+        self.secretsclient = session.client('secretsmanager')
+        self.logsclient = session.client('logs')
+        self.stsclient = session.client('sts')
+        self.s3client = session.client('s3')
+
+    def stack_name(self, feature):
+        return f"gamekit-{self.environment}-{self.gamename}-{feature}"
 
     def main_stack_name(self):
-        return f"gamekit-{self.environment}-{self.gamename}-main"
+        return self.stack_name('main')
 
-    def delete_stack(self):
-        cfclient = boto3.client('cloudformation', aws_access_key_id=self.keyid, aws_secret_access_key=self.secret)
-        print(f"Deleting Stack {self.main_stack_name()}...")
+    def bootstrap_bucket_name(self):
+        identity = self.stsclient.get_caller_identity()
+        return f"do-not-delete-gamekit-{self.environment}-{region_code_mapping()[self.region]}-{base_repr(int(identity['Account']), 36).lower()}-{self.gamename}"
+
+    def stack_exists(self, stack_name):
         try:
-            cfclient.describe_stacks(StackName=self.main_stack_name())
+            self.cfclient.describe_stacks(StackName=stack_name)
+            return True
         except botocore.exceptions.ClientError:
-            print(POLICY_TIP)
-            print(f"\n{bcolors.FAIL}Stack '{self.main_stack_name()}' does not exist.{bcolors.ENDC}")
-            return
+            return False
+
+    def delete_stack(self, feature):
+        stack_name = self.stack_name(feature)
+        if not self.stack_exists(stack_name):
+            log(f"Stack {stack_name} does not exist, skipping.")
+            return True
 
-        cfclient.delete_stack(StackName=self.main_stack_name())
+        log(f"Deleting Stack {stack_name}...")
+        self.cfclient.delete_stack(StackName=stack_name)
 
-        last_stack_event = ""
-        while last_stack_event not in cf_stack_delete_states():
-            events = cfclient.describe_stack_events(StackName=self.main_stack_name())
-            last_stack_event = events['StackEvents'][0]['ResourceStatus']
-            status_reason = events['StackEvents'][0].get('ResourceStatusReason', '-')
-            print(f"   {last_stack_event} : {status_reason}                                                                         ", end="\r")
-            time.sleep(3)
+        last_status = ""
+        while last_status not in cf_stack_delete_states():
+            time.sleep(STACK_POLL_SECONDS)
+            try:
+                stack = self.cfclient.describe_stacks(StackName=stack_name)['Stacks'][0]
+            except botocore.exceptions.ClientError:
+                # A deleted stack is no longer described by name
+                last_status = 'DELETE_COMPLETE'
+                break
+
+            if stack['StackStatus'] != last_status:
+                last_status = stack['StackStatus']
+                log(f"   {stack_name}: {last_status} : {stack.get('StackStatusReason', '-')}")
+
+        if last_status in cf_stack_delete_failed_states():
+            log(f"{bcolors.FAIL}Unable to delete Stack '{stack_name}', last status {last_status}.{bcolors.ENDC}")
+            return False
 
-        print(f"   Done. Last Status={last_stack_event}                                                                             ", end="\r")
-        print()
-        return last_stack_event
+        log(f"Deleted Stack {stack_name}.")
+        return True
+
+    def list_parameters(self):
+        names = []
+        paginator = self.ssmclient.get_paginator('describe_parameters')
+        for page in paginator.paginate(ParameterFilters=[{'Key': 'Name', 'Option': 'Contains', 'Values': [f"{self.gamename}_{self.environment}"]}]):
+            names += [param['Name'] for param in page['Parameters']]
+        return names
 
     def delete_parameters(self):
-        ssmclient = boto3.client('ssm', aws_access_key_id=self.keyid, aws_secret_access_key=self.secret)
-        parameters = ssmclient.describe_parameters(ParameterFilters=[{'Key': 'Name', 'Option': 'Contains', 'Values': [f"{self.gamename}_{self.environment}"]}], MaxResults=50)
-        for param in parameters['Parameters']:
-            print(f"Deleting Parameter {param['Name']}... ", end="")
-            try:
-                ssmclient.delete_parameter(Name=param['Name'])
-                print("Done.")
-            except botocore.exceptions.ClientError as err:
-                print(POLICY_TIP)
-                print(err)
-
-    def delete_secrets(self):
-        secretsclient = boto3.client('secretsmanager', aws_access_key_id=self.keyid, aws_secret_access_key=self.secret)
-        secrets = secretsclient.list_secrets(Filters=[{'Key': 'name', 'Values': [f"gamekit_{self.environment}_{self.gamename}_"]}])
-        for secret in secrets['SecretList']:
-            print(f"Deleting Secret {secret['Name']}... ", end="")
+        names = self.list_parameters()
+        succeeded = True
+        for start in range(0, len(names), SSM_DELETE_BATCH_SIZE):
+            batch = names[start:start + SSM_DELETE_BATCH_SIZE]
             try:
-                secretsclient.delete_secret(SecretId=secret['ARN'], ForceDeleteWithoutRecovery=True)
-                print("Done.")
+                response = self.ssmclient.delete_parameters(Names=batch)
+                for name in response.get('DeletedParameters', []):
+                    log(f"Deleted Parameter {name}.")
+                for name in response.get('InvalidParameters', []):
+                    log(f"Parameter {name} was already deleted.")
             except botocore.exceptions.ClientError as err:
-                print(POLICY_TIP)
-                print(err)
+                log(POLICY_TIP)
+                log(str(err))
+                succeeded = False
+        return succeeded
 
-    def delete_log_groups(self):
-        logsclient = boto3.client('logs')
+    def list_secrets(self):
+        secrets = []
+        paginator = self.secretsclient.get_paginator('list_secrets')
+        for page in paginator.paginate(Filters=[{'Key': 'name', 'Values': [f"gamekit_{self.environment}_{self.gamename}_"]}]):
+            secrets += page['SecretList']
+        return secrets
 
+    def delete_secret(self, secret):
+        try:
+            self.secretsclient.delete_secret(SecretId=secret['ARN'], ForceDeleteWithoutRecovery=True)
+            log(f"Deleted Secret {secret['Name']}.")
+            return True
+        except botocore.exceptions.ClientError as err:
+            log(POLICY_TIP)
+            log(str(err))
+            return False
+
+    def delete_secrets(self, executor):
+        # Secrets Manager deletes one secret per request, so the requests are all submitted before waiting on any of them
+        try:
+            deletions = [executor.submit(self.delete_secret, secret) for secret in self.list_secrets()]
+        except botocore.exceptions.ClientError as err:
+            log(POLICY_TIP)
+            log(str(err))
+            return False
+
+        return all([deletion.result() for deletion in deletions])
+
+    def log_group_name(self):
         # Only left over log group for the main stack
-        log_group_name = f"/aws/lambda/gamekit_{self.environment}_{self.gamename}_main_RemoveLambdaLayersOnDelete"
-        print(f"Deleting Log Group {log_group_name}... ", end="")
+        return f"/aws/lambda/gamekit_{self.environment}_{self.gamename}_main_RemoveLambdaLayersOnDelete"
+
+    def delete_log_groups(self):
+        log_group_name = self.log_group_name()
         try:
-            response = logsclient.delete_log_group(logGroupName=log_group_name)
-            print("Done.")
+            self.logsclient.delete_log_group(logGroupName=log_group_name)
+            log(f"Deleted Log Group {log_group_name}.")
+            return True
+        except self.logsclient.exceptions.ResourceNotFoundException:
+            log(f"Log Group {log_group_name} does not exist, skipping.")
+            return True
         except botocore.exceptions.ClientError as err:
-            print(POLICY_TIP)
-            print(err)
-
-    def delete_bootstrap_bucket(self):
-        stsclient = boto3.client('sts')
-        identity = stsclient.get_caller_identity()
-
-        s3client = boto3.client('s3')
-        bootstrap_bucket_name = f"do-not-delete-gamekit-{self.environment}-{region_code_mapping()[self.region]}-{base_repr(int(identity['Account']), 36).lower()}-{self.gamename}"
-        print(f"Deleting objects in S3 Bucket {bootstrap_bucket_name}... ")
-        objects = s3client.list_objects_v2(Bucket=bootstrap_bucket_name)
-        for obj in objects['Contents']:
-            print(f"Deleting Object {obj['Key']}... ", end="")
-            try:
-                s3client.delete_object(Bucket=bootstrap_bucket_name, Key=obj['Key'])
-                print("Done.")
-            except botocore.exceptions.ClientError as err:
-                print(POLICY_TIP)
-                print(err)
+            log(POLICY_TIP)
+            log(str(err))
+            return False
 
-        print(f"Deleting S3 Bucket {bootstrap_bucket_name}... ", end="")
+    def delete_object_batch(self, bucket_name, keys):
         try:
-            s3client.delete_bucket(Bucket=bootstrap_bucket_name)
-            print("Done.")
+            response = self.s3client.delete_objects(Bucket=bucket_name, Delete={'Objects': [{'Key': key} for key in keys], 'Quiet': True})
         except botocore.exceptions.ClientError as err:
-            print(POLICY_TIP)
-            print(err)
-
-def main(*args):
-    gamekit_cleaner = GameKitCleaner(*args)
-    event = gamekit_cleaner.delete_stack()
-    if event in cf_stack_delete_failed_states():
-       print(f"\n{bcolors.FAIL}Unable to delete Stack '{gamekit_cleaner.main_stack_name()}'. Aborting.{bcolors.ENDC}")
-       exit(1)
-    gamekit_cleaner.delete_parameters()
-    gamekit_cleaner.delete_secrets()
-    gamekit_cleaner.delete_log_groups()
-    gamekit_cleaner.delete_bootstrap_bucket()
+            log(POLICY_TIP)
+            log(str(err))
+            return False
+
+        errors = response.get('Errors', [])
+        for error in errors:
+            log(f"{bcolors.FAIL}Unable to delete Object {error['Key']}: {error['Message']}{bcolors.ENDC}")
+        log(f"Deleted {len(keys) - len(errors)} objects from S3 Bucket {bucket_name}.")
+        return len(errors) == 0
+
+    def delete_bootstrap_bucket(self, executor):
+        bootstrap_bucket_name = self.bootstrap_bucket_name()
+        log(f"Deleting objects in S3 Bucket {bootstrap_bucket_name}... ")
+
+        # Each page holds at most 1000 keys, which is also the DeleteObjects limit, so the pages are deleted in parallel as they are listed
+        batches = []
+        try:
+            paginator = self.s3client.get_paginator('list_objects_v2')
+            for page in paginator.paginate(Bucket=bootstrap_bucket_name, PaginationConfig={'PageSize': S3_DELETE_BATCH_SIZE}):
+                keys = [obj['Key'] for obj in page.get('Contents', [])]
+                if keys:
+                    batches.append(executor.submit(self.delete_object_batch, bootstrap_bucket_name, keys))
+        except botocore.exceptions.ClientError as err:
+            log(POLICY_TIP)
+            log(str(err))
+            return False
+
+        if not all(batch.result() for batch in batches):
+            return False
+
+        try:
+            self.s3client.delete_bucket(Bucket=bootstrap_bucket_name)
+            log(f"Deleted S3 Bucket {bootstrap_bucket_name}.")
+            return True
+        except botocore.exceptions.ClientError as err:
+            log(POLICY_TIP)
+            log(str(err))
+            return False
+
+    def plan(self):
+        """
+        Returns the deletion waves, each a list of (description, task) pairs. The tasks of a wave run in parallel, and a wave starts once the previous
+        one has completed. Parameters and secrets aren't created by the stacks, so they go with the first wave. The log group is created while the
+        main stack is deleted, and the bootstrap bucket holds the artifacts the stacks were deployed from, so they go last.
+        """
+        waves = [[(f"Delete Stack {self.stack_name(feature)}", lambda executor, feature=feature: self.delete_stack(feature)) for feature in features]
+                 for features in FEATURE_STACK_WAVES]
+
+        waves[0].append((f"Delete Parameters containing {self.gamename}_{self.environment}", lambda executor: self.delete_parameters()))
+        waves[0].append((f"Delete Secrets starting with gamekit_{self.environment}_{self.gamename}_", self.delete_secrets))
+        waves.append([
+            (f"Delete Log Group {self.log_group_name()}", lambda executor: self.delete_log_groups()),
+            (f"Delete S3 Bucket do-not-delete-gamekit-{self.environment}-{region_code_mapping()[self.region]}-<account>-{self.gamename} "
+             f"and its objects, {S3_DELETE_BATCH_SIZE} per request", self.delete_bootstrap_bucket)
+        ])
+        return waves
+
+def print_plan(waves):
+    for index, wave in enumerate(waves):
+        print(f"{bcolors.BOLD}Wave {index + 1}{bcolors.ENDC} ({len(wave)} in parallel):")
+        for description, _ in wave:
+            print(f"   {description}")
+
+def main(gamename, environment, region, keyid, secret, dry_run=False, max_workers=8):
+    gamekit_cleaner = GameKitCleaner(gamename, environment, region, keyid, secret)
+    waves = gamekit_cleaner.plan()
+    if dry_run:
+        print_plan(waves)
+        return
+
+    # Submitted tasks may submit more work, such as S3 batches, so the wave tasks get their own pool and can't starve it
+    with ThreadPoolExecutor(max_workers=max_workers) as wave_executor, ThreadPoolExecutor(max_workers=max_workers) as executor:
+        for index, wave in enumerate(waves):
+            log(f"\n{bcolors.BOLD}Wave {index + 1}/{len(waves)}{bcolors.ENDC}")
+            futures = [(description, wave_executor.submit(task, executor)) for description, task in wave]
+            failed = [description for description, future in futures if not future.result()]
+            if failed:
+                log(f"\n{bcolors.FAIL}Failed: {', '.join(failed)}. Aborting.{bcolors.ENDC}")
+                exit(1)
 
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(description="Cleans up resources from an Aws GameKit deployment which aren't removed in CloudFormation stack deletion.")
@@ -181,6 +314,8 @@ if __name__ == '__main__':
     parser.add_argument("--region", help="Aws region the stack is deployed in")
     parser.add_argument("--access_key", help="Aws access key with permissions to delete all resources.")
     parser.add_argument("--secret_key", help="Aws secret key with permissions to delete all resources.")
+    parser.add_argument("--dry_run", action="store_true", help="Print the deletion waves without deleting anything.")
+    parser.add_argument("--max_workers", type=int, default=8, help="Largest number of deletions run at the same time.")
     args = parser.parse_args()
 
     project_alias = args.project_alias if args.project_alias else input('Game Alias: ')
@@ -189,5 +324,5 @@ if __name__ == '__main__':
     access_key = args.access_key if args.access_key else input('AWS Access Key ID: ')
     secret_key = args.secret_key if args.secret_key else getpass(prompt='AWS Secret Access Key: ')
 
-    main(project_alias, env, region, access_key, secret_key)
+    main(project_alias, env, region, access_key, secret_key, args.dry_run, max(1, args.max_workers))
     print("\n---\nGameKit Cleanup done.")
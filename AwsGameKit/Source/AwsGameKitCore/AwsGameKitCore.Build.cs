@@ -4,6 +4,7 @@
 using System;
 using System.Collections.Generic;
 using System.IO;
+using EpicGames.Core;
 using UnrealBuildTool;
 
 public class AwsGameKitCore : ModuleRules
@@ -12,6 +13,56 @@ public class AwsGameKitCore : ModuleRules
     {
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
+        // Game builds can leave out the GameKit libraries of the features they don't use: the libraries aren't linked or staged, and the runtime
+        // module doesn't try to load them. Turn a feature off in the project's DefaultEngine.ini:
+        //   [/Script/AwsGameKit]
+        //   bWithAchievements=False
+        //   bWithGameSaving=False
+        //   bWithUserGameplayData=False
+        // Identity and Authentication are always included, the other features need a logged in player. The editor always includes every feature.
+        bool bWithAchievements = true;
+        bool bWithGameSaving = true;
+        bool bWithUserGameplayData = true;
+        if (!Target.bBuildEditor)
+        {
+            ConfigHierarchy featureConfig = ConfigCache.ReadHierarchy(ConfigHierarchyType.Engine, DirectoryReference.FromFile(Target.ProjectFile), Target.Platform);
+            bool bConfigValue;
+            if (featureConfig.GetBool("/Script/AwsGameKit", "bWithAchievements", out bConfigValue))
+            {
+                bWithAchievements = bConfigValue;
+            }
+            if (featureConfig.GetBool("/Script/AwsGameKit", "bWithGameSaving", out bConfigValue))
+            {
+                bWithGameSaving = bConfigValue;
+            }
+            if (featureConfig.GetBool("/Script/AwsGameKit", "bWithUserGameplayData", out bConfigValue))
+            {
+                bWithUserGameplayData = bConfigValue;
+            }
+        }
+        PublicDefinitions.Add("WITH_AWSGAMEKIT_ACHIEVEMENTS=" + (bWithAchievements ? "1" : "0"));
+        PublicDefinitions.Add("WITH_AWSGAMEKIT_GAME_SAVING=" + (bWithGameSaving ? "1" : "0"));
+        PublicDefinitions.Add("WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA=" + (bWithUserGameplayData ? "1" : "0"));
+
+        IList<string> gameKitLibs = new List<string>
+        {
+            "aws-gamekit-authentication",
+            "aws-gamekit-core",
+            "aws-gamekit-identity"
+        };
+        if (bWithAchievements)
+        {
+            gameKitLibs.Add("aws-gamekit-achievements");
+        }
+        if (bWithGameSaving)
+        {
+            gameKitLibs.Add("aws-gamekit-game-saving");
+        }
+        if (bWithUserGameplayData)
+        {
+            gameKitLibs.Add("aws-gamekit-user-gameplay-data");
+        }
+
         PublicIncludePaths.AddRange(
             new string[] {
                 Path.Combine(ModuleDirectory, "Public"),
@@ -62,12 +113,10 @@ public class AwsGameKitCore : ModuleRules
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-crt-cpp.a"));
 
                 // GameKit
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-achievements.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-authentication.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-core.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-game-saving.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-identity.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/libaws-gamekit-user-gameplay-data.a"));
+                foreach (var lib in gameKitLibs)
+                {
+                    PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug", "lib" + lib + ".a"));
+                }
 
                 // yaml-cpp
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Debug/yaml-cpp/libyaml-cppd.a"));
@@ -100,12 +149,10 @@ public class AwsGameKitCore : ModuleRules
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-cpp-sdk-ssm.a"));
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-cpp-sdk-sts.a"));
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-crt-cpp.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-achievements.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-authentication.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-core.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-game-saving.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-identity.a"));
-                PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/libaws-gamekit-user-gameplay-data.a"));
+                foreach (var lib in gameKitLibs)
+                {
+                    PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release", "lib" + lib + ".a"));
+                }
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/yaml-cpp/libyaml-cppd.a"));
                 PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries/IOS/Release/boost/libboost_filesystem.a"));
             }
@@ -161,17 +208,15 @@ public class AwsGameKitCore : ModuleRules
                 "libcurl.a",
 
                 // Yaml
-                "libyaml-cpp.a",
-
-                // GameKit
-                "libaws-gamekit-achievements.a",
-                "libaws-gamekit-authentication.a",
-                "libaws-gamekit-core.a",
-                "libaws-gamekit-game-saving.a",
-                "libaws-gamekit-identity.a",
-                "libaws-gamekit-user-gameplay-data.a"
+                "libyaml-cpp.a"
             };
 
+            // GameKit
+            foreach (var lib in gameKitLibs)
+            {
+                libs.Add("lib" + lib + ".a");
+            }
+
             string buildFlavor = string.Empty;
             IList<string> boostLibs = new List<string>();
             IDictionary<string, string> boostMapping = new Dictionary<string, string>()
@@ -214,6 +259,7 @@ public class AwsGameKitCore : ModuleRules
                 "Core",
                 "CoreUObject",
                 "Engine",
+                "TraceLog",
             }
         );
 
@@ -229,27 +275,66 @@ public class AwsGameKitCore : ModuleRules
             }
         );
 
+        // Desktop game builds can link the GameKit libraries through their import libraries (.lib on Windows, .dylib on Mac)
+        // instead of loading them with GetDllHandle() and calling through function pointers. Turn it on in the project's
+        // DefaultEngine.ini:
+        //   [/Script/AwsGameKit]
+        //   bLinkGameKitLibrariesDirectly=True
+        // The editor always loads the libraries at runtime.
+        bool bLinkGameKitLibrariesDirectly = false;
+        if (!Target.bBuildEditor && (Target.Platform == UnrealTargetPlatform.Win64 || Target.Platform == UnrealTargetPlatform.Mac))
+        {
+            ConfigHierarchy engineConfig = ConfigCache.ReadHierarchy(ConfigHierarchyType.Engine, DirectoryReference.FromFile(Target.ProjectFile), Target.Platform);
+            engineConfig.GetBool("/Script/AwsGameKit", "bLinkGameKitLibrariesDirectly", out bLinkGameKitLibrariesDirectly);
+        }
+        PublicDefinitions.Add("WITH_AWSGAMEKIT_DIRECT_LINK=" + (bLinkGameKitLibrariesDirectly ? "1" : "0"));
+
+        if (bLinkGameKitLibrariesDirectly)
+        {
+            string buildFlavor = (Target.Configuration == UnrealTargetConfiguration.Debug || Target.Configuration == UnrealTargetConfiguration.DebugGame || Target.Configuration == UnrealTargetConfiguration.Development) ? "Debug" : "Release";
+
+            foreach (var lib in gameKitLibs)
+            {
+                if (Target.Platform == UnrealTargetPlatform.Win64)
+                {
+                    PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries", "Win64", buildFlavor, lib + ".lib"));
+                }
+                else
+                {
+                    PublicAdditionalLibraries.Add(Path.Combine(PluginDirectory, "Libraries", "Mac", buildFlavor, "lib" + lib + ".dylib"));
+                }
+            }
+        }
+
+        // The AWS SDK libraries (aws-c-*, aws-checksums, aws-cpp-sdk-*, aws-crt-cpp), then the GameKit libraries of the included features
         if (Target.Platform == UnrealTargetPlatform.Win64)
         {
             if (Target.Configuration == UnrealTargetConfiguration.Debug || Target.Configuration == UnrealTargetConfiguration.DebugGame || Target.Configuration == UnrealTargetConfiguration.Development)
             {
-                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-*.dll", Path.Combine(PluginDirectory, "Libraries/Win64/Debug/aws-*.dll"));
-                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-*.pdb", Path.Combine(PluginDirectory, "Libraries/Win64/Debug/aws-*.pdb"));
+                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-c*.dll", Path.Combine(PluginDirectory, "Libraries/Win64/Debug/aws-c*.dll"));
+                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-c*.pdb", Path.Combine(PluginDirectory, "Libraries/Win64/Debug/aws-c*.pdb"));
+                foreach (var lib in gameKitLibs)
+                {
+                    RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/" + lib + ".dll", Path.Combine(PluginDirectory, "Libraries/Win64/Debug", lib + ".dll"));
+                    RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/" + lib + ".pdb", Path.Combine(PluginDirectory, "Libraries/Win64/Debug", lib + ".pdb"));
+                }
             }
             else
             {
-                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-*.dll", Path.Combine(PluginDirectory, "Libraries/Win64/Release/aws-*.dll"));
+                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/aws-c*.dll", Path.Combine(PluginDirectory, "Libraries/Win64/Release/aws-c*.dll"));
+                foreach (var lib in gameKitLibs)
+                {
+                    RuntimeDependencies.Add("$(ProjectDir)/Binaries/Win64/" + lib + ".dll", Path.Combine(PluginDirectory, "Libraries/Win64/Release", lib + ".dll"));
+                }
             }
         }
         else if (Target.Platform == UnrealTargetPlatform.Mac)
         {
-            if (Target.Configuration == UnrealTargetConfiguration.Debug || Target.Configuration == UnrealTargetConfiguration.DebugGame || Target.Configuration == UnrealTargetConfiguration.Development)
-            {
-                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Mac/libaws-*.dylib", Path.Combine(PluginDirectory, "Libraries/Mac/Debug/libaws-*.dylib"));
-            }
-            else
+            string buildFlavor = (Target.Configuration == UnrealTargetConfiguration.Debug || Target.Configuration == UnrealTargetConfiguration.DebugGame || Target.Configuration == UnrealTargetConfiguration.Development) ? "Debug" : "Release";
+            RuntimeDependencies.Add("$(ProjectDir)/Binaries/Mac/libaws-c*.dylib", Path.Combine(PluginDirectory, "Libraries/Mac", buildFlavor, "libaws-c*.dylib"));
+            foreach (var lib in gameKitLibs)
             {
-                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Mac/libaws-*.dylib", Path.Combine(PluginDirectory, "Libraries/Mac/Release/libaws-*.dylib"));
+                RuntimeDependencies.Add("$(ProjectDir)/Binaries/Mac/lib" + lib + ".dylib", Path.Combine(PluginDirectory, "Libraries/Mac", buildFlavor, "lib" + lib + ".dylib"));
             }
         }
         else if (Target.Platform == UnrealTargetPlatform.IOS || Target.Platform == UnrealTargetPlatform.Android)
@@ -7,6 +7,7 @@
 #include "Core/Logging.h"
 
 // GameKit
+#include "Core/AwsGameKitMemory.h"
 #if PLATFORM_IOS
 #include <aws/gamekit/core/exports.h>
 #endif
@@ -14,10 +15,13 @@
 #define LOCTEXT_NAMESPACE "FAwsGameKitCoreModule"
 
 DEFINE_LOG_CATEGORY(LogAwsGameKit);
+DEFINE_LOG_CATEGORY(LogAwsGameKitHotPath);
 
 void FAwsGameKitCoreModule::StartupModule()
 {
+  AWSGAMEKIT_LLM_SCOPE(Core);
   UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitCoreModule::StartupModule()"));
+  FGameKitLogging::StartChildLogSink();
 #if PLATFORM_IOS
   ::GameKitInitializeAwsSdk(FGameKitLogging::LogCallBack);
 #endif
@@ -29,6 +33,7 @@ void FAwsGameKitCoreModule::ShutdownModule()
 #if PLATFORM_IOS
   ::GameKitShutdownAwsSdk(FGameKitLogging::LogCallBack);
 #endif
+  FGameKitLogging::StopChildLogSink();
 }
 
 #undef LOCTEXT_NAMESPACE
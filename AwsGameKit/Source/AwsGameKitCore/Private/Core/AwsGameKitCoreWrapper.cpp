@@ -111,6 +111,7 @@ void AwsGameKitCoreWrapper::importFunctions(void* loadedDllHandle)
 unsigned int AwsGameKitCoreWrapper::GameKitInitializeAwsSdk(FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitInitializeAwsSdk, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitInitializeAwsSdk, logCb);
 }
@@ -120,6 +121,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitInitializeAwsSdk(FuncLogCallback logC
 unsigned int AwsGameKitCoreWrapper::GameKitGetAwsAccountId(DISPATCH_RECEIVER_HANDLE caller, CharPtrCallback resultcallback, const char* accessKey, const char* secretKey, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitGetAwsAccountId, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitGetAwsAccountId, caller, resultcallback, accessKey, secretKey, logCb);
 }
@@ -127,6 +129,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitGetAwsAccountId(DISPATCH_RECEIVER_HAN
 GAMEKIT_ACCOUNT_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitAccountInstanceCreate(AccountInfo accountInfo, AccountCredentials credentials, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountInstanceCreate, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountInstanceCreate, accountInfo, credentials, logCb);
 }
@@ -134,6 +137,7 @@ GAMEKIT_ACCOUNT_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitAccountInstanceCre
 GAMEKIT_ACCOUNT_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitAccountInstanceCreateWithRootPaths(AccountInfo accountInfo, AccountCredentials credentials, const char* rootPath, const char* pluginRootPath, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountInstanceCreateWithRootPaths, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountInstanceCreateWithRootPaths, accountInfo, credentials, rootPath, pluginRootPath, logCb);
 }
@@ -141,6 +145,7 @@ GAMEKIT_ACCOUNT_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitAccountInstanceCre
 void AwsGameKitCoreWrapper::GameKitAccountInstanceRelease(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitAccountInstanceRelease, accountInstance);
 }
@@ -148,6 +153,7 @@ void AwsGameKitCoreWrapper::GameKitAccountInstanceRelease(GAMEKIT_ACCOUNT_INSTAN
 const char* AwsGameKitCoreWrapper::GameKitAccountGetRootPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetRootPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetRootPath, accountInstance);
 }
@@ -155,6 +161,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetRootPath(GAMEKIT_ACCOUNT_INS
 const char* AwsGameKitCoreWrapper::GameKitAccountGetPluginRootPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetPluginRootPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetPluginRootPath, accountInstance);
 }
@@ -162,6 +169,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetPluginRootPath(GAMEKIT_ACCOU
 const char* AwsGameKitCoreWrapper::GameKitAccountGetBaseCloudFormationPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetBaseCloudFormationPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetBaseCloudFormationPath, accountInstance);
 }
@@ -169,6 +177,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetBaseCloudFormationPath(GAMEK
 const char* AwsGameKitCoreWrapper::GameKitAccountGetBaseFunctionsPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetBaseFunctionsPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetBaseFunctionsPath, accountInstance);
 }
@@ -176,6 +185,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetBaseFunctionsPath(GAMEKIT_AC
 const char* AwsGameKitCoreWrapper::GameKitAccountGetInstanceCloudFormationPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetInstanceCloudFormationPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetInstanceCloudFormationPath, accountInstance);
 }
@@ -183,6 +193,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetInstanceCloudFormationPath(G
 const char* AwsGameKitCoreWrapper::GameKitAccountGetInstanceFunctionsPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountGetInstanceFunctionsPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountGetInstanceFunctionsPath, accountInstance);
 }
@@ -190,6 +201,7 @@ const char* AwsGameKitCoreWrapper::GameKitAccountGetInstanceFunctionsPath(GAMEKI
 void AwsGameKitCoreWrapper::GameKitAccountSetRootPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance, const char* rootPath)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountSetRootPath);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitAccountSetRootPath, accountInstance, rootPath);
 }
@@ -197,6 +209,7 @@ void AwsGameKitCoreWrapper::GameKitAccountSetRootPath(GAMEKIT_ACCOUNT_INSTANCE_H
 void AwsGameKitCoreWrapper::GameKitAccountSetPluginRootPath(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance, const char* pluginRootPath)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountSetPluginRootPath);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitAccountSetPluginRootPath, accountInstance, pluginRootPath);
 }
@@ -204,6 +217,7 @@ void AwsGameKitCoreWrapper::GameKitAccountSetPluginRootPath(GAMEKIT_ACCOUNT_INST
 bool AwsGameKitCoreWrapper::GameKitAccountHasValidCredentials(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountHasValidCredentials, false);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountHasValidCredentials, accountInstance);
 }
@@ -211,6 +225,7 @@ bool AwsGameKitCoreWrapper::GameKitAccountHasValidCredentials(GAMEKIT_ACCOUNT_IN
 unsigned int AwsGameKitCoreWrapper::GameKitAccountInstanceBootstrap(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountInstanceBootstrap, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountInstanceBootstrap, accountInstance);
 }
@@ -218,6 +233,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountInstanceBootstrap(GAMEKIT_ACCO
 unsigned int AwsGameKitCoreWrapper::GameKitAccountSaveSecret(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance, const char* secretName, const char* secretValue)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountSaveSecret, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountSaveSecret, accountInstance, secretName, secretValue);
 }
@@ -225,6 +241,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountSaveSecret(GAMEKIT_ACCOUNT_INS
 unsigned int AwsGameKitCoreWrapper::GameKitAccountCheckSecretExists(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance, const char* secretName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountCheckSecretExists, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountCheckSecretExists, accountInstance, secretName);
 }
@@ -232,6 +249,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountCheckSecretExists(GAMEKIT_ACCO
 unsigned int AwsGameKitCoreWrapper::GameKitAccountSaveFeatureInstanceTemplates(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountSaveFeatureInstanceTemplates, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountSaveFeatureInstanceTemplates, accountInstance);
 }
@@ -239,6 +257,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountSaveFeatureInstanceTemplates(G
 unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadAllDashboards(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountUploadAllDashboards, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountUploadAllDashboards, accountInstance);
 }
@@ -246,6 +265,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadAllDashboards(GAMEKIT_AC
 unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadLayers(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountUploadLayers, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountUploadLayers, accountInstance);
 }
@@ -253,6 +273,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadLayers(GAMEKIT_ACCOUNT_I
 unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadFunctions(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountUploadFunctions, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountUploadFunctions, accountInstance);
 }
@@ -260,6 +281,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountUploadFunctions(GAMEKIT_ACCOUN
 unsigned int AwsGameKitCoreWrapper::GameKitAccountCreateOrUpdateMainStack(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountCreateOrUpdateMainStack, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountCreateOrUpdateMainStack, accountInstance);
 }
@@ -267,6 +289,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountCreateOrUpdateMainStack(GAMEKI
 unsigned int AwsGameKitCoreWrapper::GameKitAccountCreateOrUpdateStacks(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountCreateOrUpdateStacks, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountCreateOrUpdateStacks, accountInstance);
 }
@@ -274,6 +297,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountCreateOrUpdateStacks(GAMEKIT_A
 unsigned int AwsGameKitCoreWrapper::GameKitAccountDeployApiGatewayStage(GAMEKIT_ACCOUNT_INSTANCE_HANDLE accountInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitAccountDeployApiGatewayStage, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitAccountDeployApiGatewayStage, accountInstance);
 }
@@ -283,6 +307,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitAccountDeployApiGatewayStage(GAMEKIT_
 GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitResourcesInstanceCreate(AccountInfo accountInfo, AccountCredentials credentials, FeatureType featureType, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesInstanceCreate, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesInstanceCreate, accountInfo, credentials, featureType, logCb);
 }
@@ -290,6 +315,7 @@ GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitResources
 GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitResourcesInstanceCreateWithRootPaths(AccountInfo accountInfo, AccountCredentials credentials, FeatureType featureType, const char* rootPath, const char* pluginRootPath, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesInstanceCreateWithRootPaths, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesInstanceCreateWithRootPaths, accountInfo, credentials, featureType, rootPath, pluginRootPath, logCb);
 }
@@ -297,6 +323,7 @@ GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitResources
 void AwsGameKitCoreWrapper::GameKitResourcesInstanceRelease(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitResourcesInstanceRelease, resourceInstance);
 }
@@ -304,6 +331,7 @@ void AwsGameKitCoreWrapper::GameKitResourcesInstanceRelease(GAMEKIT_FEATURERESOU
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetRootPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetRootPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetRootPath, resourceInstance);
 }
@@ -311,6 +339,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetRootPath(GAMEKIT_FEATURERE
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetPluginRootPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetPluginRootPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetPluginRootPath, resourceInstance);
 }
@@ -318,6 +347,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetPluginRootPath(GAMEKIT_FEA
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetBaseCloudFormationPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetBaseCloudFormationPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetBaseCloudFormationPath, resourceInstance);
 }
@@ -325,6 +355,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetBaseCloudFormationPath(GAM
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetBaseFunctionsPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetBaseFunctionsPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetBaseFunctionsPath, resourceInstance);
 }
@@ -332,6 +363,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetBaseFunctionsPath(GAMEKIT_
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetInstanceCloudFormationPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetInstanceCloudFormationPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetInstanceCloudFormationPath, resourceInstance);
 }
@@ -339,6 +371,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetInstanceCloudFormationPath
 const char* AwsGameKitCoreWrapper::GameKitResourcesGetInstanceFunctionsPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetInstanceFunctionsPath, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetInstanceFunctionsPath, resourceInstance);
 }
@@ -346,6 +379,7 @@ const char* AwsGameKitCoreWrapper::GameKitResourcesGetInstanceFunctionsPath(GAME
 void AwsGameKitCoreWrapper::GameKitResourcesSetRootPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance, const char* rootPath)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSetRootPath);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitResourcesSetRootPath, resourceInstance, rootPath);
 }
@@ -353,6 +387,7 @@ void AwsGameKitCoreWrapper::GameKitResourcesSetRootPath(GAMEKIT_FEATURERESOURCES
 void AwsGameKitCoreWrapper::GameKitResourcesSetPluginRootPath(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance, const char* pluginRootPath)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSetPluginRootPath)
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
         INVOKE_FUNC(GameKitResourcesSetPluginRootPath, resourceInstance, pluginRootPath);
 }
@@ -360,6 +395,7 @@ void AwsGameKitCoreWrapper::GameKitResourcesSetPluginRootPath(GAMEKIT_FEATURERES
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesCreateEmptyConfigFile(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesCreateEmptyConfigFile, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesCreateEmptyConfigFile, resourceInstance);
 }
@@ -367,6 +403,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesCreateEmptyConfigFile(GAMEKI
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesInstanceCreateOrUpdateStack(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesInstanceCreateOrUpdateStack, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesInstanceCreateOrUpdateStack, resourceInstance);
 }
@@ -374,6 +411,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesInstanceCreateOrUpdateStack(
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesInstanceDeleteStack(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesInstanceDeleteStack, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesInstanceDeleteStack, resourceInstance);
 }
@@ -381,6 +419,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesInstanceDeleteStack(GAMEKIT_
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesGetCurrentStackStatus(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance, DISPATCH_RECEIVER_HANDLE receiver, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesGetCurrentStackStatus, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesGetCurrentStackStatus, resourceInstance, receiver, resultsCb);
 }
@@ -388,6 +427,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesGetCurrentStackStatus(GAMEKI
 bool AwsGameKitCoreWrapper::GameKitResourcesIsCloudFormationInstanceTemplatePresent(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesIsCloudFormationInstanceTemplatePresent, false);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesIsCloudFormationInstanceTemplatePresent, resourceInstance);
 }
@@ -395,6 +435,7 @@ bool AwsGameKitCoreWrapper::GameKitResourcesIsCloudFormationInstanceTemplatePres
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveDeployedCloudFormationTemplate(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSaveDeployedCloudFormationTemplate, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesSaveDeployedCloudFormationTemplate, resourceInstance);
 }
@@ -402,6 +443,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveDeployedCloudFormationTe
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveCloudFormationInstance(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSaveCloudFormationInstance, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesSaveCloudFormationInstance, resourceInstance);
 }
@@ -409,6 +451,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveCloudFormationInstance(G
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesUpdateCloudFormationParameters(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesUpdateCloudFormationParameters, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesUpdateCloudFormationParameters, resourceInstance);
 }
@@ -416,6 +459,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesUpdateCloudFormationParamete
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveLayerInstances(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSaveLayerInstances, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesSaveLayerInstances, resourceInstance);
 }
@@ -423,6 +467,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveLayerInstances(GAMEKIT_F
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveFunctionInstances(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesSaveFunctionInstances, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesSaveFunctionInstances, resourceInstance);
 }
@@ -430,6 +475,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesSaveFunctionInstances(GAMEKI
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesUploadFeatureLayers(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesUploadFeatureLayers, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesUploadFeatureLayers, resourceInstance);
 }
@@ -437,6 +483,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesUploadFeatureLayers(GAMEKIT_
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesUploadFeatureFunctions(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesUploadFeatureFunctions, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesUploadFeatureFunctions, resourceInstance);
 }
@@ -444,6 +491,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesUploadFeatureFunctions(GAMEK
 unsigned int AwsGameKitCoreWrapper::GameKitResourcesDescribeStackResources(GAMEKIT_FEATURERESOURCES_INSTANCE_HANDLE resourceInstance, FuncResourceInfoCallback resourceInfoCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitResourcesDescribeStackResources, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitResourcesDescribeStackResources, resourceInstance, resourceInfoCb);
 }
@@ -453,6 +501,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitResourcesDescribeStackResources(GAMEK
 GAMEKIT_SETTINGS_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitSettingsInstanceCreate(const char* rootPath, const char* pluginVersion, const char* shortGameName, const char* currentEnvironment, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsInstanceCreate, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitSettingsInstanceCreate, rootPath, pluginVersion, shortGameName, currentEnvironment, logCb);
 }
@@ -460,6 +509,7 @@ GAMEKIT_SETTINGS_INSTANCE_HANDLE AwsGameKitCoreWrapper::GameKitSettingsInstanceC
 void AwsGameKitCoreWrapper::GameKitSettingsInstanceRelease(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsInstanceRelease, settingsInstance);
 }
@@ -467,6 +517,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsInstanceRelease(GAMEKIT_SETTINGS_INST
 void AwsGameKitCoreWrapper::GameKitSettingsSetGameName(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, const char* gameName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsSetGameName);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsSetGameName, settingsInstance, gameName);
 }
@@ -474,6 +525,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsSetGameName(GAMEKIT_SETTINGS_INSTANCE
 void AwsGameKitCoreWrapper::GameKitSettingsSetLastUsedRegion(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, const char* region)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsSetLastUsedRegion);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsSetLastUsedRegion, settingsInstance, region);
 }
@@ -481,6 +533,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsSetLastUsedRegion(GAMEKIT_SETTINGS_IN
 void AwsGameKitCoreWrapper::GameKitSettingsSetLastUsedEnvironment(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, const char* envCode)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsSetLastUsedEnvironment);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsSetLastUsedEnvironment, settingsInstance, envCode);
 }
@@ -488,6 +541,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsSetLastUsedEnvironment(GAMEKIT_SETTIN
 void AwsGameKitCoreWrapper::GameKitSettingsAddCustomEnvironment(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, const char* envCode, const char* envDescription)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsAddCustomEnvironment);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsAddCustomEnvironment, settingsInstance, envCode, envDescription);
 }
@@ -495,6 +549,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsAddCustomEnvironment(GAMEKIT_SETTINGS
 void AwsGameKitCoreWrapper::GameKitSettingsDeleteCustomEnvironment(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, const char* envCode)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsDeleteCustomEnvironment);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsDeleteCustomEnvironment, settingsInstance, envCode);
 }
@@ -502,6 +557,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsDeleteCustomEnvironment(GAMEKIT_SETTI
 void AwsGameKitCoreWrapper::GameKitSettingsActivateFeature(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, FeatureType featureType)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsActivateFeature);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsActivateFeature, settingsInstance, featureType);
 }
@@ -509,6 +565,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsActivateFeature(GAMEKIT_SETTINGS_INST
 void AwsGameKitCoreWrapper::GameKitSettingsDeactivateFeature(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, FeatureType featureType)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsDeactivateFeature);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsDeactivateFeature, settingsInstance, featureType);
 }
@@ -516,6 +573,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsDeactivateFeature(GAMEKIT_SETTINGS_IN
 void AwsGameKitCoreWrapper::GameKitSettingsSetFeatureVariables(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, FeatureType featureType, const char* const* varKeys, const char* const* varValues, size_t numKeys)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsSetFeatureVariables);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsSetFeatureVariables, settingsInstance, featureType, varKeys, varValues, numKeys);
 }
@@ -523,6 +581,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsSetFeatureVariables(GAMEKIT_SETTINGS_
 void AwsGameKitCoreWrapper::GameKitSettingsDeleteFeatureVariable(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, FeatureType featureType, const char* varName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsDeleteFeatureVariable);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsDeleteFeatureVariable, settingsInstance, featureType, varName);
 }
@@ -530,6 +589,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsDeleteFeatureVariable(GAMEKIT_SETTING
 unsigned int AwsGameKitCoreWrapper::GameKitSettingsSave(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsSave, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitSettingsSave, settingsInstance);
 }
@@ -537,6 +597,7 @@ unsigned int AwsGameKitCoreWrapper::GameKitSettingsSave(GAMEKIT_SETTINGS_INSTANC
 void AwsGameKitCoreWrapper::GameKitSettingsGetGameName(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetGameName);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetGameName, settingsInstance, receiver, resultsCb);
 }
@@ -544,6 +605,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetGameName(GAMEKIT_SETTINGS_INSTANCE
 void AwsGameKitCoreWrapper::GameKitSettingsGetLastUsedRegion(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetLastUsedRegion);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetLastUsedRegion, settingsInstance, receiver, resultsCb);
 }
@@ -551,6 +613,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetLastUsedRegion(GAMEKIT_SETTINGS_IN
 void AwsGameKitCoreWrapper::GameKitSettingsGetLastUsedEnvironment(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetLastUsedEnvironment);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetLastUsedEnvironment, settingsInstance, receiver, resultsCb);
 }
@@ -558,6 +621,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetLastUsedEnvironment(GAMEKIT_SETTIN
 void AwsGameKitCoreWrapper::GameKitSettingsGetCustomEnvironments(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, KeyValueCharPtrCallbackDispatcher resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetCustomEnvironments);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetCustomEnvironments, settingsInstance, receiver, resultsCb);
 }
@@ -565,6 +629,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetCustomEnvironments(GAMEKIT_SETTING
 void AwsGameKitCoreWrapper::GameKitSettingsGetCustomEnvironmentDescription(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, const char* envCode, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetCustomEnvironmentDescription);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetCustomEnvironmentDescription, settingsInstance, receiver, envCode, resultsCb);
 }
@@ -572,6 +637,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetCustomEnvironmentDescription(GAMEK
 bool AwsGameKitCoreWrapper::GameKitSettingsIsFeatureActive(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, FeatureType featureType)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsIsFeatureActive, false);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     return INVOKE_FUNC(GameKitSettingsIsFeatureActive, settingsInstance, featureType);
 }
@@ -579,6 +645,7 @@ bool AwsGameKitCoreWrapper::GameKitSettingsIsFeatureActive(GAMEKIT_SETTINGS_INST
 void AwsGameKitCoreWrapper::GameKitSettingsGetFeatureVariables(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, FeatureType featureType, KeyValueCharPtrCallbackDispatcher resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetFeatureVariables);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetFeatureVariables, settingsInstance, receiver, featureType, resultsCb);
 }
@@ -586,6 +653,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetFeatureVariables(GAMEKIT_SETTINGS_
 void AwsGameKitCoreWrapper::GameKitSettingsGetFeatureVariable(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, FeatureType featureType, const char* varName, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetFeatureVariable);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetFeatureVariable, settingsInstance, receiver, featureType, varName, resultsCb);
 }
@@ -593,6 +661,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetFeatureVariable(GAMEKIT_SETTINGS_I
 void AwsGameKitCoreWrapper::GameKitSettingsGetSettingsFilePath(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance, DISPATCH_RECEIVER_HANDLE receiver, CharPtrCallback resultsCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsGetSettingsFilePath);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsGetSettingsFilePath, settingsInstance, receiver, resultsCb);
 }
@@ -600,6 +669,7 @@ void AwsGameKitCoreWrapper::GameKitSettingsGetSettingsFilePath(GAMEKIT_SETTINGS_
 void AwsGameKitCoreWrapper::GameKitSettingsReload(GAMEKIT_SETTINGS_INSTANCE_HANDLE settingsInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Core, GameKitSettingsReload);
+    AWSGAMEKIT_LLM_SCOPE(Core);
 
     INVOKE_FUNC(GameKitSettingsReload, settingsInstance);
 }
@@ -7,6 +7,7 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Core/AwsGameKitLibraryUtils.h"
 
 #define LOCTEXT_NAMESPACE "AwsGameKitLibraryWrapper"
 
@@ -27,7 +28,7 @@ void AwsGameKitLibraryWrapper::Shutdown()
 
 bool AwsGameKitLibraryWrapper::loadDll()
 {
-#if PLATFORM_WINDOWS || PLATFORM_MAC
+#if AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME
     libraryPath = getPlatformDependentFilename().c_str();
     dllHandle = !libraryPath.IsEmpty() ? FPlatformProcess::GetDllHandle(*libraryPath) : nullptr;
 
@@ -42,8 +43,8 @@ bool AwsGameKitLibraryWrapper::loadDll()
         UE_LOG(LogAwsGameKit, Error, TEXT("Failed to load AWS GameKit library: %s"), *libraryPath);
         return false;
     }
-#else // Libraries are statically compiled
-    // Always return true if the the GameKit libraries are statically compiled
+#else // Libraries are statically compiled or linked through their import libraries
+    // Always return true if the the GameKit libraries are linked in
     return true;
 #endif
 }
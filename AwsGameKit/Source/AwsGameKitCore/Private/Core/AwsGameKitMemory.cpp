@@ -0,0 +1,12 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/AwsGameKitMemory.h"
+
+// Underscores in the names become the tag hierarchy, e.g. AwsGameKit/Achievements
+LLM_DEFINE_TAG(AwsGameKit);
+LLM_DEFINE_TAG(AwsGameKit_Core);
+LLM_DEFINE_TAG(AwsGameKit_Achievements);
+LLM_DEFINE_TAG(AwsGameKit_GameSaving);
+LLM_DEFINE_TAG(AwsGameKit_Identity);
+LLM_DEFINE_TAG(AwsGameKit_UserGameplayData);
@@ -0,0 +1,204 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/AwsGameKitTrace.h"
+
+// Standard library
+#include <atomic>
+
+// Unreal
+#include "HAL/PlatformTLS.h"
+#include "Misc/Guid.h"
+
+#if AWSGAMEKIT_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(AwsGameKitChannel)
+
+UE_TRACE_EVENT_BEGIN(AwsGameKit, CallBegin)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, CallId)
+    UE_TRACE_EVENT_FIELD(uint32, ParentCallId)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(int64, BytesIn)
+    UE_TRACE_EVENT_FIELD(UE::Trace::AnsiString, Feature)
+    UE_TRACE_EVENT_FIELD(UE::Trace::AnsiString, Operation)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(AwsGameKit, CallEnd)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32, CallId)
+    UE_TRACE_EVENT_FIELD(uint32, StatusCode)
+    UE_TRACE_EVENT_FIELD(int64, BytesIn)
+    UE_TRACE_EVENT_FIELD(int64, BytesOut)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(AwsGameKit, CallPhase)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(uint32, CallId)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(uint8, Phase)
+    UE_TRACE_EVENT_FIELD(UE::Trace::AnsiString, Name)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+    std::atomic<uint32> NextCallId{ 1 };
+    thread_local FAwsGameKitTraceContext CurrentContext;
+
+    // Keeps the request IDs of two runs of the game apart in the backend's logs
+    const FString& GetRequestIdPrefix()
+    {
+        static const FString Prefix = FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(12).ToLower();
+        return Prefix;
+    }
+}
+
+bool FAwsGameKitTrace::IsEnabled()
+{
+    return UE_TRACE_CHANNELEXPR_IS_ENABLED(AwsGameKitChannel);
+}
+
+uint32 FAwsGameKitTrace::BeginCall(const ANSICHAR* Feature, const ANSICHAR* Operation, const FString& Name, int64 BytesIn)
+{
+    if (!IsEnabled())
+    {
+        return 0;
+    }
+
+    uint32 callId = NextCallId.fetch_add(1, std::memory_order_relaxed);
+    if (callId == 0)
+    {
+        callId = NextCallId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const FString requestId = GetRequestId(callId);
+    UE_TRACE_LOG(AwsGameKit, CallBegin, AwsGameKitChannel)
+        << CallBegin.Cycle(FPlatformTime::Cycles64())
+        << CallBegin.CallId(callId)
+        << CallBegin.ParentCallId(CurrentContext.CallId)
+        << CallBegin.ThreadId(FPlatformTLS::GetCurrentThreadId())
+        << CallBegin.BytesIn(BytesIn)
+        << CallBegin.Feature(Feature)
+        << CallBegin.Operation(Operation)
+        << CallBegin.Name(*Name, Name.Len())
+        << CallBegin.RequestId(*requestId, requestId.Len());
+
+    return callId;
+}
+
+FString FAwsGameKitTrace::GetRequestId(uint32 CallId)
+{
+    if (CallId == 0)
+    {
+        return FString();
+    }
+
+    return FString::Printf(TEXT("%s-%08x"), *GetRequestIdPrefix(), CallId);
+}
+
+void FAwsGameKitTrace::EndCall()
+{
+    if (CurrentContext.CallId == 0)
+    {
+        return;
+    }
+
+    UE_TRACE_LOG(AwsGameKit, CallEnd, AwsGameKitChannel)
+        << CallEnd.Cycle(FPlatformTime::Cycles64())
+        << CallEnd.CallId(CurrentContext.CallId)
+        << CallEnd.StatusCode(CurrentContext.StatusCode)
+        << CallEnd.BytesIn(CurrentContext.BytesIn)
+        << CallEnd.BytesOut(CurrentContext.BytesOut);
+}
+
+void FAwsGameKitTrace::Phase(EAwsGameKitTracePhase Phase, uint64 StartCycle, const ANSICHAR* Name)
+{
+    if (CurrentContext.CallId == 0)
+    {
+        return;
+    }
+
+    UE_TRACE_LOG(AwsGameKit, CallPhase, AwsGameKitChannel)
+        << CallPhase.StartCycle(StartCycle)
+        << CallPhase.EndCycle(FPlatformTime::Cycles64())
+        << CallPhase.CallId(CurrentContext.CallId)
+        << CallPhase.ThreadId(FPlatformTLS::GetCurrentThreadId())
+        << CallPhase.Phase(static_cast<uint8>(Phase))
+        << CallPhase.Name(Name != nullptr ? Name : "");
+}
+
+FAwsGameKitTraceContext& FAwsGameKitTrace::GetContext()
+{
+    return CurrentContext;
+}
+
+void FAwsGameKitTrace::SetStatus(uint32 StatusCode)
+{
+    CurrentContext.StatusCode = StatusCode;
+}
+
+void FAwsGameKitTrace::AddBytes(int64 BytesIn, int64 BytesOut)
+{
+    CurrentContext.BytesIn += BytesIn;
+    CurrentContext.BytesOut += BytesOut;
+}
+
+bool FAwsGameKitTrace::ClaimEnd()
+{
+    if (CurrentContext.bEndClaimed)
+    {
+        return false;
+    }
+
+    CurrentContext.bEndClaimed = true;
+    return true;
+}
+
+#else
+
+bool FAwsGameKitTrace::IsEnabled()
+{
+    return false;
+}
+
+uint32 FAwsGameKitTrace::BeginCall(const ANSICHAR* Feature, const ANSICHAR* Operation, const FString& Name, int64 BytesIn)
+{
+    return 0;
+}
+
+void FAwsGameKitTrace::EndCall()
+{
+}
+
+FString FAwsGameKitTrace::GetRequestId(uint32 CallId)
+{
+    return FString();
+}
+
+void FAwsGameKitTrace::Phase(EAwsGameKitTracePhase Phase, uint64 StartCycle, const ANSICHAR* Name)
+{
+}
+
+FAwsGameKitTraceContext& FAwsGameKitTrace::GetContext()
+{
+    static thread_local FAwsGameKitTraceContext EmptyContext;
+    return EmptyContext;
+}
+
+void FAwsGameKitTrace::SetStatus(uint32 StatusCode)
+{
+}
+
+void FAwsGameKitTrace::AddBytes(int64 BytesIn, int64 BytesOut)
+{
+}
+
+bool FAwsGameKitTrace::ClaimEnd()
+{
+    return false;
+}
+
+#endif
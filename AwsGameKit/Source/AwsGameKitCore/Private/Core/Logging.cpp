@@ -9,25 +9,243 @@
 #include "AwsGameKitCore.h"
 
 // Unreal
+#include "HAL/Event.h"
 #include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
 #include "Misc/ScopeLock.h"
+#include "Templates/UniquePtr.h"
 
 int32 FGameKitLogging::toggleVerbose = false;
 TArray<IChildLogger*> FGameKitLogging::childLoggers;
 FCriticalSection FGameKitLogging::childLoggerMutex;
+std::atomic<int32> FGameKitLogging::numChildLoggers(0);
+std::atomic<FGameKitChildLogSink*> FGameKitLogging::childLogSink(nullptr);
+
+static TAutoConsoleVariable<int32> CVarGameKitChildLogBufferSize(
+    TEXT("GameKit.Logging.ChildLogBufferSize"),
+    1024,
+    TEXT("Number of messages buffered for the GameKit child loggers, rounded up to a power of two. Read once at startup.\n"),
+    ECVF_ReadOnly);
 
 TAutoConsoleVariable<int32> CVarGameKitToggleVerboseLevel(
     TEXT("GameKit.ToggleVerboseLevel"),
     0,
     TEXT("Activates or deactivates logging messages with Verbose level to the Log window.\n")
     TEXT("  0: deactivates\n")
-    TEXT(" >0: activates\n"));
+    TEXT(" >0: activates\n"),
+    FConsoleVariableDelegate::CreateStatic(&FGameKitLogging::OnToggleVerboseLevelChanged));
+
+void FGameKitLogging::OnToggleVerboseLevelChanged(IConsoleVariable* variable)
+{
+    // Cached so that the log callback doesn't need to read the console variable for every native message
+    toggleVerbose = variable->GetInt();
+}
+
+/**
+ * Bounded multi-producer, single-consumer ring buffer of messages drained by a low priority thread.
+ *
+ * Each slot carries a sequence number which tells producers whether the slot is free for the position they claimed, and the consumer
+ * whether the slot has been written, so pushing a message is a single compare-and-swap and never blocks.
+ */
+class FGameKitChildLogSink : public FRunnable
+{
+public:
+    explicit FGameKitChildLogSink(uint32 capacity)
+        : mask(capacity - 1), slots(MakeUnique<FSlot[]>(capacity))
+    {
+        for (uint32 i = 0; i < capacity; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        wakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    }
+
+    virtual ~FGameKitChildLogSink() override
+    {
+        FPlatformProcess::ReturnSynchEventToPool(wakeEvent);
+    }
+
+    bool Start()
+    {
+        thread = FRunnableThread::Create(this, TEXT("AwsGameKitLogSink"), 0, TPri_Lowest);
+        return thread != nullptr;
+    }
+
+    // Asks the thread to forward the pending messages and exit. Called by FRunnableThread::Kill(), which the thread's destructor also calls.
+    void Stop() override
+    {
+        stopRequested.store(true, std::memory_order_release);
+        wakeEvent->Trigger();
+    }
+
+    // Forwards the pending messages and waits for the thread to exit. The sink owns the thread, the caller owns the sink.
+    void Shutdown()
+    {
+        if (thread != nullptr)
+        {
+            thread->Kill(true);
+            delete thread;
+            thread = nullptr;
+        }
+    }
+
+    // Safe to call from any thread. Returns false, and counts the message as dropped, when the buffer is full.
+    bool Push(unsigned int level, FString&& message)
+    {
+        uint64 position = enqueuePosition.load(std::memory_order_relaxed);
+        FSlot* slot;
+        for (;;)
+        {
+            slot = &slots[position & mask];
+            const int64 difference = static_cast<int64>(slot->sequence.load(std::memory_order_acquire)) - static_cast<int64>(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                droppedMessages.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->message = MoveTemp(message);
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        // Only wake the thread when it may have gone idle
+        if (pendingMessages.fetch_add(1, std::memory_order_acq_rel) == 0)
+        {
+            wakeEvent->Trigger();
+        }
+
+        return true;
+    }
+
+    uint64 GetDroppedMessageCount() const
+    {
+        return droppedMessages.load(std::memory_order_relaxed);
+    }
+
+    virtual uint32 Run() override
+    {
+        while (!stopRequested.load(std::memory_order_acquire))
+        {
+            wakeEvent->Wait(50);
+            Drain();
+        }
+
+        Drain();
+        return 0;
+    }
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint64> sequence;
+        unsigned int level = 0;
+        FString message;
+    };
+
+    void Drain()
+    {
+        FSlot* slot = &slots[dequeuePosition & mask];
+        while (slot->sequence.load(std::memory_order_acquire) == dequeuePosition + 1)
+        {
+            const unsigned int level = slot->level;
+            const FString message = MoveTemp(slot->message);
+            slot->sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+            ++dequeuePosition;
+            pendingMessages.fetch_sub(1, std::memory_order_acq_rel);
+
+            FGameKitLogging::DispatchToChildLoggers(level, message);
+            slot = &slots[dequeuePosition & mask];
+        }
+
+        const uint64 dropped = droppedMessages.load(std::memory_order_relaxed);
+        if (dropped != reportedDroppedMessages)
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FGameKitLogging: %llu messages were not forwarded to the child loggers because the buffer was full (GameKit.Logging.ChildLogBufferSize)"), dropped - reportedDroppedMessages);
+            reportedDroppedMessages = dropped;
+        }
+    }
+
+    const uint64 mask;
+    TUniquePtr<FSlot[]> slots;
+    std::atomic<uint64> enqueuePosition{ 0 };
+    std::atomic<int32> pendingMessages{ 0 };
+    std::atomic<uint64> droppedMessages{ 0 };
+    std::atomic<bool> stopRequested{ false };
+
+    // Only used by the sink thread
+    uint64 dequeuePosition = 0;
+    uint64 reportedDroppedMessages = 0;
+
+    FEvent* wakeEvent = nullptr;
+    FRunnableThread* thread = nullptr;
+};
+
+void FGameKitLogging::StartChildLogSink()
+{
+    if (childLogSink.load(std::memory_order_acquire) != nullptr || !FPlatformProcess::SupportsMultithreading())
+    {
+        return;
+    }
+
+    const uint32 capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(2, CVarGameKitChildLogBufferSize.GetValueOnAnyThread())));
+    FGameKitChildLogSink* sink = new FGameKitChildLogSink(capacity);
+    if (!sink->Start())
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FGameKitLogging::StartChildLogSink(): Failed to create the thread, child loggers are called on the logging thread"));
+        delete sink;
+        return;
+    }
+
+    childLogSink.store(sink, std::memory_order_release);
+}
+
+void FGameKitLogging::StopChildLogSink()
+{
+    // Called after the runtime and editor modules, which own the native libraries, have shut down, so no native thread is still logging.
+    FGameKitChildLogSink* sink = childLogSink.exchange(nullptr, std::memory_order_acq_rel);
+    if (sink != nullptr)
+    {
+        sink->Shutdown();
+        delete sink;
+    }
+}
+
+uint64 FGameKitLogging::GetDroppedChildLogMessageCount()
+{
+    const FGameKitChildLogSink* sink = childLogSink.load(std::memory_order_acquire);
+    return sink != nullptr ? sink->GetDroppedMessageCount() : 0;
+}
+
+void FGameKitLogging::DispatchToChildLoggers(unsigned int level, const FString& message)
+{
+    FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
+    for (auto logger : childLoggers)
+    {
+        logger->Log(level, message);
+    }
+}
 
 void FGameKitLogging::AttachLogger(IChildLogger* logger)
 {
     FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
     UE_LOG(LogAwsGameKit, Log, TEXT("FGameKitLogging::AttachLogger()"))
     childLoggers.Add(logger);
+    numChildLoggers.store(childLoggers.Num(), std::memory_order_relaxed);
 }
 
 void FGameKitLogging::DetachLogger(IChildLogger* logger)
@@ -35,39 +253,69 @@ void FGameKitLogging::DetachLogger(IChildLogger* logger)
     FScopeLock scopeLock(&(FGameKitLogging::childLoggerMutex));
     UE_LOG(LogAwsGameKit, Log, TEXT("FGameKitLogging::DetachLogger()"))
     childLoggers.Remove(logger);
+    numChildLoggers.store(childLoggers.Num(), std::memory_order_relaxed);
 }
 
 void FGameKitLogging::LogCallBack(unsigned int level, const char* message, int size)
 {
+    ELogVerbosity::Type verbosity;
     switch (level)
     {
     case 1:
-        toggleVerbose = CVarGameKitToggleVerboseLevel.GetValueOnAnyThread();
-        if (toggleVerbose)
-        {
-            UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
-        }
-        else
-        {
-            UE_LOG(LogAwsGameKit, Verbose, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
-        }
-        break;
-    case 2:
-        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        verbosity = toggleVerbose ? ELogVerbosity::Display : ELogVerbosity::Verbose;
         break;
     case 3:
-        UE_LOG(LogAwsGameKit, Warning, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        verbosity = ELogVerbosity::Warning;
         break;
     case 4:
-        UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        verbosity = ELogVerbosity::Error;
         break;
     default:
-        UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *FString(ANSI_TO_TCHAR(message)));
+        verbosity = ELogVerbosity::Display;
         break;
     }
 
-    for (auto logger : childLoggers)
+    // Check the level before converting the message, most verbose messages are discarded.
+    const bool shouldLog = !LogAwsGameKit.IsSuppressed(verbosity);
+    const bool hasChildLoggers = numChildLoggers.load(std::memory_order_relaxed) > 0;
+    if (!shouldLog && !hasChildLoggers)
+    {
+        return;
+    }
+
+    FString convertedMessage(ANSI_TO_TCHAR(message));
+    if (shouldLog)
+    {
+        switch (verbosity)
+        {
+        case ELogVerbosity::Verbose:
+            UE_LOG(LogAwsGameKit, Verbose, TEXT("%s"), *convertedMessage);
+            break;
+        case ELogVerbosity::Warning:
+            UE_LOG(LogAwsGameKit, Warning, TEXT("%s"), *convertedMessage);
+            break;
+        case ELogVerbosity::Error:
+            UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *convertedMessage);
+            break;
+        default:
+            UE_LOG(LogAwsGameKit, Display, TEXT("%s"), *convertedMessage);
+            break;
+        }
+    }
+
+    if (!hasChildLoggers)
+    {
+        return;
+    }
+
+    // Child loggers run on the sink thread so that native threads never wait on childLoggerMutex
+    FGameKitChildLogSink* sink = childLogSink.load(std::memory_order_acquire);
+    if (sink != nullptr)
+    {
+        sink->Push(level, MoveTemp(convertedMessage));
+    }
+    else
     {
-        logger->Log(level, FString(message));
+        DispatchToChildLoggers(level, convertedMessage);
     }
 }
@@ -10,6 +10,17 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAwsGameKit, Log, All);
 
+// Per-call trace messages of the runtime APIs (entry points and dispatcher callbacks).
+// Shipping builds compile out everything below Warning; override by defining AWSGAMEKIT_HOT_PATH_LOG_COMPILE_VERBOSITY.
+#ifndef AWSGAMEKIT_HOT_PATH_LOG_COMPILE_VERBOSITY
+#if UE_BUILD_SHIPPING
+#define AWSGAMEKIT_HOT_PATH_LOG_COMPILE_VERBOSITY Warning
+#else
+#define AWSGAMEKIT_HOT_PATH_LOG_COMPILE_VERBOSITY All
+#endif
+#endif
+DECLARE_LOG_CATEGORY_EXTERN(LogAwsGameKitHotPath, Log, AWSGAMEKIT_HOT_PATH_LOG_COMPILE_VERBOSITY);
+
 class FAwsGameKitCoreModule : public IModuleInterface
 {
 public:
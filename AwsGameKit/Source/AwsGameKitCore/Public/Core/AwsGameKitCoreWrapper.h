@@ -11,7 +11,7 @@
 #include "Logging.h"
 
 // GameKit
-#if PLATFORM_IOS || PLATFORM_ANDROID
+#if PLATFORM_IOS || PLATFORM_ANDROID || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/core/exports.h>
 #endif
 
@@ -21,7 +21,7 @@
 // Unreal
 #include "Containers/UnrealString.h"
 
-#if PLATFORM_WINDOWS || PLATFORM_MAC
+#if AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME
 /**
 * Handle to an instance of GameKitAccount created inside the GameKit Identity DLL.
 *
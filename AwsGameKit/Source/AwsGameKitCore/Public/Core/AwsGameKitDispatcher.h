@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "AwsGameKitTrace.h"
+
 /**
  * @brief A pointer to an instance of a class that can receive a callback.
  *
@@ -90,16 +92,20 @@ template <typename Lambda, typename RetType, typename ... Args>
  *
  * Then the LambdaFunctionDispatcher can be used when calling the low level API:
  *      GameKitLowLevelSomeFunction(handle, (void*)lambdaFunction, &LambdaFunctionDispatcher::Dispatch);
+ *
+ * Each dispatch is written to the current traced call, see FAwsGameKitTraceDispatchScope.
  */
 struct LambdaDispatcher
 {
     static RetType Dispatch(void* func, Args... args)
     {
+        AWSGAMEKIT_TRACE_DISPATCH(args...);
         return (*static_cast<Lambda*>(func)) (std::forward<Args>(args)...);
     }
 
     static RetType Dispatch(void* func, Args&&... args)
     {
+        AWSGAMEKIT_TRACE_DISPATCH(args...);
         return (*static_cast<Lambda*>(func)) (std::forward<Args>(args)...);
     }
 };
@@ -34,6 +34,13 @@ namespace GameKit
      * @details GameKit status codes are defined in errors.h
      */
     FString AWSGAMEKITCORE_API StatusCodeToHexFStr(const unsigned int statusCode);
+
+    // Status codes returned by the plugin itself rather than the GameKit library, in a range errors.h doesn't use.
+
+    /**
+     * @brief AwsGameKitAchievements::UpdateAchievementForPlayer() didn't send the update: the cached player progress shows the achievement is already earned.
+     */
+    static const unsigned int GAMEKIT_WARNING_ACHIEVEMENTS_ALREADY_EARNED = 0x1F401;
 }
 
 /**
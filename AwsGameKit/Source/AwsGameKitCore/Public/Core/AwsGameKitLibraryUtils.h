@@ -4,8 +4,31 @@
 #pragma once
 
 // GameKit
+#include "AwsGameKitMemory.h"
+#include "AwsGameKitTrace.h"
 #include "Logging.h"
 
+// Set by AwsGameKitCore.Build.cs when the desktop GameKit libraries are linked through their import libraries
+// instead of being loaded with GetDllHandle(). See bLinkGameKitLibrariesDirectly in AwsGameKitCore.Build.cs.
+#ifndef WITH_AWSGAMEKIT_DIRECT_LINK
+#define WITH_AWSGAMEKIT_DIRECT_LINK 0
+#endif
+
+// Set by AwsGameKitCore.Build.cs to 0 for the features a game build leaves out. See bWithAchievements in AwsGameKitCore.Build.cs.
+#ifndef WITH_AWSGAMEKIT_ACHIEVEMENTS
+#define WITH_AWSGAMEKIT_ACHIEVEMENTS 1
+#endif
+#ifndef WITH_AWSGAMEKIT_GAME_SAVING
+#define WITH_AWSGAMEKIT_GAME_SAVING 1
+#endif
+#ifndef WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA
+#define WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA 1
+#endif
+
+// True when the GameKit functions are resolved at runtime from the loaded DLL/dylib and called through function pointers.
+// Elsewhere the functions are linked in and called directly.
+#define AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME ((PLATFORM_WINDOWS || PLATFORM_MAC) && !WITH_AWSGAMEKIT_DIRECT_LINK)
+
 // Helper macro to define a Func handle type and instantiate it (set to nullptr).
 #define DEFINE_FUNC_HANDLE(RetType, Func, ...) \
 typedef RetType (*__##Func) __VA_ARGS__ ; \
@@ -13,7 +36,7 @@ __##Func func##Func = nullptr;
 
 // Helper macro to check that the function pointer is valid. If function is invalid,
 // logs a message and returns an error code. (Assumes the FuncPtr was declared with DEFINE_FUNC_HANDLE)
-#if PLATFORM_WINDOWS || PLATFORM_MAC
+#if AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME
 #define CHECK_PLUGIN_FUNC_IS_LOADED(Plugin, FuncPtr, ...) \
 { \
     if (func##FuncPtr == nullptr) \
@@ -26,16 +49,36 @@ __##Func func##Func = nullptr;
 #define CHECK_PLUGIN_FUNC_IS_LOADED(Plugin, FuncPtr, ...) {}
 #endif
 
+// Helper macro to call Func directly or through its function pointer
+#if AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME
+#define INVOKE_FUNC_UNTRACED(Func, ...) (func##Func)(__VA_ARGS__)
+#else
+#define INVOKE_FUNC_UNTRACED(Func, ...) (::Func)(__VA_ARGS__)
+#endif
+
 // Helper macro to invoke a Func that was declared with DEFINE_FUNC_HANDLE
-#if PLATFORM_WINDOWS || PLATFORM_MAC
-#define INVOKE_FUNC(Func, ...) (func##Func)(__VA_ARGS__)
+// When tracing is compiled in, the call is a NativeCall phase on the AwsGameKit trace channel, see FAwsGameKitTrace.
+#if AWSGAMEKIT_TRACE_ENABLED
+#define INVOKE_FUNC(Func, ...) ([&]() { AWSGAMEKIT_TRACE_NATIVE_CALL(#Func); return INVOKE_FUNC_UNTRACED(Func, ##__VA_ARGS__); }())
 #else
-#define INVOKE_FUNC(Func, ...) (::Func)(__VA_ARGS__)
+#define INVOKE_FUNC(Func, ...) INVOKE_FUNC_UNTRACED(Func, ##__VA_ARGS__)
 #endif
 
 // Helper macro to assign an exported Func (Func must be declared with DEFINE_FUNC_HANDLE)
-#if PLATFORM_WINDOWS || PLATFORM_MAC
+#if AWSGAMEKIT_LOAD_LIBRARIES_AT_RUNTIME
 #define LOAD_PLUGIN_FUNC(ProcName, DllHandle) func##ProcName = (__##ProcName)FPlatformProcess::GetDllExport(DllHandle, UTF8_TO_TCHAR(#ProcName))
 #else
 #define LOAD_PLUGIN_FUNC(ProcName, DllHandle) {}
 #endif
+
+// Replacements for the three macros above in the wrapper of a feature left out of the build, whose library isn't linked or staged.
+// Nothing is imported and every call fails as if the library hadn't loaded, without referencing the library's functions. A wrapper .cpp switches to them with
+//   #pragma push_macro("CHECK_PLUGIN_FUNC_IS_LOADED") ... #define CHECK_PLUGIN_FUNC_IS_LOADED AWSGAMEKIT_CHECK_FEATURE_NOT_BUILT
+// for each of them, and restores them with pop_macro at the end of the file so that unity builds aren't affected.
+#define AWSGAMEKIT_CHECK_FEATURE_NOT_BUILT(Plugin, FuncPtr, ...) \
+{ \
+    UE_LOG(LogAwsGameKit, Verbose, TEXT("AWS GameKit " #Plugin " isn't included in this build, " #FuncPtr " isn't called")); \
+    return __VA_ARGS__ ; \
+}
+#define AWSGAMEKIT_INVOKE_FEATURE_NOT_BUILT(Func, ...) (func##Func)(__VA_ARGS__)
+#define AWSGAMEKIT_LOAD_FEATURE_NOT_BUILT(ProcName, DllHandle) {}
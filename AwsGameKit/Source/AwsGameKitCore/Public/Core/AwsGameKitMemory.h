@@ -0,0 +1,33 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Low Level Memory tracker tags for the GameKit allocations.
+ */
+
+#pragma once
+
+// Unreal
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * The GameKit allocations are tagged per feature under AwsGameKit in LLM reports (run with -llm, then "stat LLMFULL" or -llmcsv):
+ * - AwsGameKit/Core: library loading, settings, account and feature deployment in the editor, and the shared plumbing.
+ * - AwsGameKit/Achievements: achievement lists, the achievements cache and icon textures.
+ * - AwsGameKit/GameSaving: save slot buffers, the slot index and transfer queues.
+ * - AwsGameKit/Identity: player profiles, tokens and the session manager.
+ * - AwsGameKit/UserGameplayData: bundles, the bundle cache and the offline retry queue.
+ *
+ * Use AWSGAMEKIT_LLM_SCOPE(Feature) at the allocation sites. The feature wrappers open one in every function which calls the GameKit C API,
+ * so the marshalling and what the native libraries allocate through Unreal's allocator are tagged as well.
+ * LLM scopes are per thread: work handed to the worker pool or the game thread needs its own scope.
+ */
+LLM_DECLARE_TAG_API(AwsGameKit, AWSGAMEKITCORE_API);
+LLM_DECLARE_TAG_API(AwsGameKit_Core, AWSGAMEKITCORE_API);
+LLM_DECLARE_TAG_API(AwsGameKit_Achievements, AWSGAMEKITCORE_API);
+LLM_DECLARE_TAG_API(AwsGameKit_GameSaving, AWSGAMEKITCORE_API);
+LLM_DECLARE_TAG_API(AwsGameKit_Identity, AWSGAMEKITCORE_API);
+LLM_DECLARE_TAG_API(AwsGameKit_UserGameplayData, AWSGAMEKITCORE_API);
+
+// Tag the allocations of the enclosing scope with AwsGameKit/Feature
+#define AWSGAMEKIT_LLM_SCOPE(Feature) LLM_SCOPE_BYTAG(AwsGameKit_##Feature)
@@ -0,0 +1,296 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Unreal Insights trace channel for the GameKit API calls.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/UnrealString.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+#define AWSGAMEKIT_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if AWSGAMEKIT_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(AwsGameKitChannel, AWSGAMEKITCORE_API);
+#endif
+
+/**
+ * @brief The parts a GameKit call is split into on the trace.
+ */
+enum class EAwsGameKitTracePhase : uint8
+{
+    // From the call being queued on the worker pool until a worker thread picks it up
+    QueueWait,
+
+    // Converting Unreal types to and from the GameKit C API models
+    Marshalling,
+
+    // Inside a GameKit C API function
+    NativeCall,
+
+    // Running the result delegate or latent action output on the game thread
+    GameThreadDelivery
+};
+
+/**
+ * @brief The call a thread is working on. Status and byte counts are collected here until the call ends.
+ */
+struct FAwsGameKitTraceContext
+{
+    uint32 CallId = 0;
+    uint32 StatusCode = 0;
+    int64 BytesIn = 0;
+    int64 BytesOut = 0;
+
+    // Set once something has taken over ending the call, see FAwsGameKitTrace::ClaimEnd()
+    bool bEndClaimed = true;
+
+    // Set while a response callback of the call is running, see FAwsGameKitTraceDispatchScope
+    bool bInDispatch = false;
+};
+
+/**
+ * @brief Writes the GameKit API calls to the AwsGameKit trace channel.
+ *
+ * @details Enable the channel with -trace=cpu,AwsGameKit (or "Trace.Enable AwsGameKit" at runtime) and open the trace in Unreal Insights.
+ *
+ * Every runtime API and Blueprint latent action begins a call with AWSGAMEKIT_TRACE_CALL(). The call gets an id which follows the work
+ * onto the worker pool and back to the game thread, and each part of it is written as a phase event (see EAwsGameKitTracePhase) carrying that id.
+ * The call ends when its work on the worker pool finishes, with the status code and the bytes sent and received. Each call also has a request
+ * ID, see GetRequestId(), which links it to the backend's logs and X-Ray traces.
+ *
+ * The phases, and the work on the worker pool, are also CPU profiler scopes on the AwsGameKit channel, so they show up in the Timing view next to the frame.
+ * Native calls are named after the GameKit C API function, for example GameKitSaveSlot. The response callbacks of the C API functions are
+ * Marshalling phases, and the strings they receive are counted as bytes received.
+ *
+ * Tracing is compiled out of shipping builds, and costs a branch per call when the channel is off.
+ */
+class AWSGAMEKITCORE_API FAwsGameKitTrace
+{
+public:
+    /**
+     * @brief True when the AwsGameKit channel is being traced.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Write the beginning of a new call.
+     *
+     * @return The call id, or 0 when tracing is off.
+     */
+    static uint32 BeginCall(const ANSICHAR* Feature, const ANSICHAR* Operation, const FString& Name, int64 BytesIn);
+
+    /**
+     * @brief Write the end of the current call, with the status and the byte counts collected in its context.
+     */
+    static void EndCall();
+
+    /**
+     * @brief Write a phase of the current call which started at StartCycle (FPlatformTime::Cycles64()) and ends now.
+     */
+    static void Phase(EAwsGameKitTracePhase Phase, uint64 StartCycle, const ANSICHAR* Name = nullptr);
+
+    /**
+     * @brief The request ID of a call: a random per-process prefix and the call id, such as "3f2a9c01d4e7-0000002a". Empty for call id 0.
+     *
+     * @details It's written with the call's CallBegin event, sent as the X-GameKit-Request-Id header of the HTTP requests the plugin creates during
+     * the call (see FAwsGameKitTransport::CreateRequest()), and logged by the backend next to the API Gateway request ID and the X-Ray trace ID.
+     */
+    static FString GetRequestId(uint32 CallId);
+
+    /**
+     * @brief The context of the call running on this thread.
+     */
+    static FAwsGameKitTraceContext& GetContext();
+
+    /**
+     * @brief Record the status code of the current call.
+     */
+    static void SetStatus(uint32 StatusCode);
+
+    /**
+     * @brief Add to the bytes sent and received by the current call.
+     */
+    static void AddBytes(int64 BytesIn, int64 BytesOut);
+
+    /**
+     * @brief Take over ending the current call. Returns true for the first caller only.
+     *
+     * @details The first work dispatched to the worker pool by an API ends the call when it finishes. If the API dispatches nothing, the call ends with its API entry.
+     */
+    static bool ClaimEnd();
+};
+
+/**
+ * @brief Makes a call current on this thread for the enclosing scope, for work which runs on behalf of a call started on another thread.
+ */
+class FAwsGameKitTraceCurrentCallScope
+{
+public:
+    explicit FAwsGameKitTraceCurrentCallScope(uint32 CallId)
+        : PreviousContext(FAwsGameKitTrace::GetContext())
+    {
+        FAwsGameKitTraceContext& context = FAwsGameKitTrace::GetContext();
+        context = FAwsGameKitTraceContext();
+        context.CallId = CallId;
+    }
+
+    ~FAwsGameKitTraceCurrentCallScope()
+    {
+        FAwsGameKitTrace::GetContext() = PreviousContext;
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitTraceCurrentCallScope);
+
+private:
+    FAwsGameKitTraceContext PreviousContext;
+};
+
+/**
+ * @brief Begins a call for the enclosing API function. See AWSGAMEKIT_TRACE_CALL().
+ *
+ * @details When no work was dispatched to the worker pool by the time the scope exits (a cache hit, an invalid request...), the call ends here.
+ */
+class FAwsGameKitTraceCallScope
+{
+public:
+    FAwsGameKitTraceCallScope(const ANSICHAR* Feature, const ANSICHAR* Operation, const FString& Name = FString(), int64 BytesIn = 0)
+        : PreviousContext(FAwsGameKitTrace::GetContext())
+    {
+        FAwsGameKitTraceContext& context = FAwsGameKitTrace::GetContext();
+        context = FAwsGameKitTraceContext();
+        context.CallId = FAwsGameKitTrace::BeginCall(Feature, Operation, Name, BytesIn);
+        context.bEndClaimed = context.CallId == 0;
+    }
+
+    ~FAwsGameKitTraceCallScope()
+    {
+        if (FAwsGameKitTrace::ClaimEnd())
+        {
+            FAwsGameKitTrace::EndCall();
+        }
+        FAwsGameKitTrace::GetContext() = PreviousContext;
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitTraceCallScope);
+
+private:
+    FAwsGameKitTraceContext PreviousContext;
+};
+
+/**
+ * @brief Writes a phase of the current call covering the enclosing scope.
+ */
+class FAwsGameKitTracePhaseScope
+{
+public:
+    FAwsGameKitTracePhaseScope(EAwsGameKitTracePhase InPhase, const ANSICHAR* InName = nullptr)
+        : Phase(InPhase), Name(InName), StartCycle(FAwsGameKitTrace::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+    {
+    }
+
+    ~FAwsGameKitTracePhaseScope()
+    {
+        if (StartCycle != 0)
+        {
+            FAwsGameKitTrace::Phase(Phase, StartCycle, Name);
+        }
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitTracePhaseScope);
+
+private:
+    EAwsGameKitTracePhase Phase;
+    const ANSICHAR* Name;
+    uint64 StartCycle;
+};
+
+/**
+ * @brief Writes a response callback from a GameKit C API function as a Marshalling phase of the current call, and adds the strings it receives to the bytes received.
+ *
+ * @details Every LambdaDispatcher opens one, so the responses of all the wrapper calls are covered. A callback which forwards to another one is only counted once.
+ */
+class FAwsGameKitTraceDispatchScope
+{
+public:
+    template <typename ... Args>
+    explicit FAwsGameKitTraceDispatchScope(const Args& ... args)
+        : bOutermost(FAwsGameKitTrace::IsEnabled() && !FAwsGameKitTrace::GetContext().bInDispatch), StartCycle(bOutermost ? FPlatformTime::Cycles64() : 0)
+    {
+        if (bOutermost)
+        {
+            FAwsGameKitTrace::GetContext().bInDispatch = true;
+            FAwsGameKitTrace::AddBytes(0, (int64(0) + ... + GetResponseBytes(args)));
+        }
+    }
+
+    ~FAwsGameKitTraceDispatchScope()
+    {
+        if (bOutermost)
+        {
+            FAwsGameKitTrace::GetContext().bInDispatch = false;
+            FAwsGameKitTrace::Phase(EAwsGameKitTracePhase::Marshalling, StartCycle);
+        }
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitTraceDispatchScope);
+
+private:
+    static int64 GetResponseBytes(const char* Response)
+    {
+        return Response != nullptr ? FCStringAnsi::Strlen(Response) : 0;
+    }
+
+    // Sizes, statuses and models aren't counted, callbacks which receive binary data count it themselves
+    template <typename T>
+    static int64 GetResponseBytes(const T&)
+    {
+        return 0;
+    }
+
+    bool bOutermost;
+    uint64 StartCycle;
+};
+
+#if AWSGAMEKIT_TRACE_ENABLED
+
+/**
+ * Begin a traced call for the enclosing runtime API function, for example AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveSlot", Request.SlotName, Request.Data.Num()).
+ * The slot or bundle name and the bytes sent are optional.
+ */
+#define AWSGAMEKIT_TRACE_CALL(Feature, Operation, ...) \
+    FAwsGameKitTraceCallScope PREPROCESSOR_JOIN(AwsGameKitTraceCall, __LINE__)(Feature, Operation, ##__VA_ARGS__)
+
+/**
+ * Trace the enclosing scope as a phase of the current call. Phase is an EAwsGameKitTracePhase value name, for example AWSGAMEKIT_TRACE_PHASE(Marshalling).
+ */
+#define AWSGAMEKIT_TRACE_PHASE(Phase) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(AwsGameKit_##Phase, AwsGameKitChannel); \
+    FAwsGameKitTracePhaseScope PREPROCESSOR_JOIN(AwsGameKitTracePhase, __LINE__)(EAwsGameKitTracePhase::Phase)
+
+/**
+ * Trace the enclosing scope as a NativeCall phase of the current call, named after the GameKit C API function.
+ */
+#define AWSGAMEKIT_TRACE_NATIVE_CALL(FuncName) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(FuncName, AwsGameKitChannel); \
+    FAwsGameKitTracePhaseScope PREPROCESSOR_JOIN(AwsGameKitTracePhase, __LINE__)(EAwsGameKitTracePhase::NativeCall, FuncName)
+
+/**
+ * Trace the enclosing response callback, see FAwsGameKitTraceDispatchScope.
+ */
+#define AWSGAMEKIT_TRACE_DISPATCH(...) \
+    FAwsGameKitTraceDispatchScope PREPROCESSOR_JOIN(AwsGameKitTraceDispatch, __LINE__)(__VA_ARGS__)
+
+#else
+
+#define AWSGAMEKIT_TRACE_CALL(Feature, Operation, ...)
+#define AWSGAMEKIT_TRACE_PHASE(Phase)
+#define AWSGAMEKIT_TRACE_NATIVE_CALL(FuncName)
+#define AWSGAMEKIT_TRACE_DISPATCH(...)
+
+#endif
@@ -3,10 +3,15 @@
 
 #pragma once
 
+// Standard library
+#include <atomic>
+
 // Unreal
 #include "Containers/UnrealString.h"
 #include "HAL/CriticalSection.h"
 
+class IConsoleVariable;
+
 /**
  * Signature for a callback function the AWS GameKit library can use to log a message.
  */
@@ -23,18 +28,48 @@ public:
     virtual void Log(unsigned int level, const FString& message) {};
 };
 
+class FGameKitChildLogSink;
+
 /**
  * Default implementation for ::FuncFuncLogCallback.
+ *
+ * Messages are forwarded to the child loggers from a low priority thread: the native threads only push them into a fixed-size ring buffer
+ * and never wait on childLoggerMutex. When the buffer is full the message is dropped for the child loggers (it is still written to the log)
+ * and counted, see GetDroppedChildLogMessageCount(). The buffer size is set by the GameKit.Logging.ChildLogBufferSize console variable.
  */
 class AWSGAMEKITCORE_API FGameKitLogging
 {
 private:
+    friend class FGameKitChildLogSink;
+
     static int32 toggleVerbose;
     static TArray<IChildLogger*> childLoggers;
     static FCriticalSection childLoggerMutex;
+    static std::atomic<int32> numChildLoggers;
+    static std::atomic<FGameKitChildLogSink*> childLogSink;
+
+    static void DispatchToChildLoggers(unsigned int level, const FString& message);
 
 public:
     static void AttachLogger(IChildLogger* logger);
     static void DetachLogger(IChildLogger* logger);
     static void LogCallBack(unsigned int level, const char* message, int size);
+
+    // Invoked when GameKit.ToggleVerboseLevel changes.
+    static void OnToggleVerboseLevelChanged(IConsoleVariable* variable);
+
+    /**
+     * @brief Start the thread which forwards messages to the child loggers. Called by FAwsGameKitCoreModule::StartupModule().
+     */
+    static void StartChildLogSink();
+
+    /**
+     * @brief Forward the pending messages and stop the child logger thread. Called by FAwsGameKitCoreModule::ShutdownModule().
+     */
+    static void StopChildLogSink();
+
+    /**
+     * @brief Number of messages which could not be forwarded to the child loggers because the ring buffer was full.
+     */
+    static uint64 GetDroppedChildLogMessageCount();
 };
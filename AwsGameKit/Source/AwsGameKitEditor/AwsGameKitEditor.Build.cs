@@ -139,7 +139,8 @@ public class AwsGameKitEditor : ModuleRules
                 "AwsGameKitRuntime",
                 "Http",
                 "ImageWrapper",
-                "PropertyEditor"
+                "PropertyEditor",
+                "DirectoryWatcher"
             }
         );
 
@@ -47,21 +47,21 @@ AwsGameKitAchievementUI::AwsGameKitAchievementUI(AwsGameKitAchievementsLayoutDet
     Initialize(layout, adminAchievement.points, adminAchievement.requiredAmount, adminAchievement.sortOrder);
 
     idString = adminAchievement.achievementId;
-    this->id->SetText(FText::FromString(adminAchievement.achievementId));
-    this->title->SetText(FText::FromString(adminAchievement.title));
-    this->unlockedIcon->SetText(FText::FromString(adminAchievement.unlockedIcon));
-    this->lockedIcon->SetText(FText::FromString(adminAchievement.lockedIcon));
-    this->unlockedDescription->SetText(FText::FromString(adminAchievement.unlockedDescription));
-    this->lockedDescription->SetText(FText::FromString(adminAchievement.lockedDescription));
-    this->secret->SetIsChecked(adminAchievement.isSecret ? ECheckBoxState::Checked : ECheckBoxState::Unchecked);
-    this->hidden->SetIsChecked(adminAchievement.isHidden ? ECheckBoxState::Checked : ECheckBoxState::Unchecked);
+    this->AchievementId = adminAchievement.achievementId;
+    this->Title = adminAchievement.title;
+    this->UnlockedIcon = adminAchievement.unlockedIcon;
+    this->LockedIcon = adminAchievement.lockedIcon;
+    this->UnlockedDescription = adminAchievement.unlockedDescription;
+    this->LockedDescription = adminAchievement.lockedDescription;
+    this->IsSecret = adminAchievement.isSecret;
+    this->IsHidden = adminAchievement.isHidden;
     this->localLockedIcon = adminAchievement.localLockedIcon;
     this->localUnlockedIcon = adminAchievement.localUnlockedIcon;
 }
 
 AwsGameKitAchievementUI::~AwsGameKitAchievementUI()
 {
-    parent->invalidIds.Remove(idString);
+    parent->invalidIds.RemoveSingle(AchievementId);
 }
 
 void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* layout, int32 points, int32 max, int32 sortOrder)
@@ -74,7 +74,24 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
     this->Points = points;
     this->MaxValue = max;
     this->SortOrder = sortOrder;
+    this->IsSecret = false;
+    this->IsHidden = false;
+    this->IsIdEditable = true;
+    this->expanded = false;
+    this->newAchievementNumber = layout->newAchievementCounter;
+}
+
+void AwsGameKitAchievementUI::ReleaseRepresentation()
+{
+    this->representation.Reset();
+    this->trashIconButton.Reset();
+    this->expandableArea.Reset();
+    this->lockedIconImg.Reset();
+    this->unlockedIconImg.Reset();
+}
 
+void AwsGameKitAchievementUI::BuildRepresentation()
+{
     const FSlateBrush* deleteIcon = AwsGameKitStyleSet::Style->GetBrush("DeleteIcon");
 
     static const int ROW_PADDING = 3;
@@ -88,12 +105,12 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
     static const int ACHIEVEMENT_ICON_SIZE = 50;
     static const int TRASH_ICON_SIZE = 32;
 
-    auto warningBox = [this](TSharedPtr<SBorder>& boxBorder, const FString& message)
+    auto warningBox = [this](const TAttribute<EVisibility>& visibility, const FString& message)
     {
-        SAssignNew(boxBorder, SBorder)
+        return SNew(SBorder)
         .BorderBackgroundColor(AwsGameKitStyleSet::Style->GetColor("ErrorRed"))
         .BorderImage(AwsGameKitStyleSet::Style->GetBrush("ErrorRedBrush"))
-        .Visibility(EVisibility::Collapsed) // warnings are hidden by default
+        .Visibility(visibility)
         [
             SNew(SHorizontalBox)
             + SHorizontalBox::Slot()
@@ -120,8 +137,6 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                 .Text(FText::FromString(message))
             ]
         ];
-
-        return boxBorder.ToSharedRef();
     };
 
     this->representation =
@@ -129,7 +144,8 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
         + SScrollBox::Slot()
         [
             SAssignNew(this->expandableArea, SExpandableArea)
-            .InitiallyCollapsed(true)
+            .InitiallyCollapsed(!this->expanded)
+            .OnAreaExpansionChanged_Lambda([this](bool isExpanded) { this->expanded = isExpanded; })
             .HeaderContent()
             [
                 SNew(SHorizontalBox)
@@ -169,8 +185,11 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                 .VAlign(VAlign_Center)
                 .Padding(ROW_PADDING)
                 [
-                    SAssignNew(titleText, STextBlock)
-                    .Text(FText::FromString("New Achievement(" + FString::FromInt(this->parent->newAchievementCounter) + ")"))
+                    SNew(STextBlock)
+                    .Text_Lambda([this]
+                    {
+                        return this->Title.IsEmpty() ? FText::FromString("New Achievement(" + FString::FromInt(this->newAchievementNumber) + ")") : FText::FromString(this->Title);
+                    })
                 ]
                 + SHorizontalBox::Slot()
                 .VAlign(VAlign_Center)
@@ -221,15 +240,23 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             + SHorizontalBox::Slot()
                             .FillWidth(RIGHT_COL_WIDTH)
                             [
-                                SAssignNew(this->id, SEditableTextBox)
+                                SNew(SEditableTextBox)
+                                .Text_Lambda([this] { return FText::FromString(this->AchievementId); })
+                                .IsEnabled_Lambda([this] { return this->IsIdEditable; })
                                 .HintText(LOCTEXT("ValidAchievementIdRequirements", "Valid ID characters: a-z, A-Z, 0-9, _"))
                                 .OnTextChanged(FOnTextChanged::CreateRaw(this, &AwsGameKitAchievementUI::OnIdChanged))
+                                .OnTextCommitted(FOnTextCommitted::CreateRaw(this, &AwsGameKitAchievementUI::OnIdCommitted))
                             ]
                         ]
                         + SVerticalBox::Slot()
                         .AutoHeight()
                         [
-                            warningBox(this->idValidationWarning, "Please enter a valid Achievement ID. Valid ID characters: a-z, A-Z, 0-9, _ \n Can't begin or end with an underscore, and must be at least 2 characters.")
+                            warningBox(TAttribute<EVisibility>::Create([this]
+                            {
+                                // warnings are hidden while the ID is empty or valid
+                                const bool valid = this->AchievementId.IsEmpty() || AwsGameKitAchievementsAdmin::IsAchievementIdValid(FText::FromString(this->AchievementId));
+                                return valid ? EVisibility::Collapsed : EVisibility::Visible;
+                            }), "Please enter a valid Achievement ID. Valid ID characters: a-z, A-Z, 0-9, _ \n Can't begin or end with an underscore, and must be at least 2 characters.")
                         ]
                     ]
 
@@ -247,10 +274,11 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                         + SHorizontalBox::Slot()
                         .FillWidth(RIGHT_COL_WIDTH)
                         [
-                            SAssignNew(this->title, SEditableTextBox)
+                            SNew(SEditableTextBox)
+                            .Text_Lambda([this] { return FText::FromString(this->Title); })
                             .HintText(FText::FromString("Eat 10 Bananas"))
                             .OnTextChanged_Lambda([this](const FText& newText)
-                                {this->titleText->SetText(newText);})
+                                {this->Title = newText.ToString();})
                             UPDATE_LOCAL_STATE()
                         ]
                     ]
@@ -272,7 +300,7 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             SNew(SSpinBox<int32>)
                             .MinValue(0)
                             .MaxValue(TNumericLimits<int32>::Max())
-                            .Value(points)
+                            .Value_Lambda([this] { return this->Points; })
                             .OnValueCommitted(FOnInt32ValueCommitted::CreateLambda([this](int32 newValue, ETextCommit::Type type)
                             {
                                 Points = newValue;
@@ -301,8 +329,11 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                         + SHorizontalBox::Slot()
                         .FillWidth(RIGHT_COL_WIDTH)
                         [
-                            SAssignNew(this->lockedDescription, SEditableTextBox)
+                            SNew(SEditableTextBox)
+                            .Text_Lambda([this] { return FText::FromString(this->LockedDescription); })
                             .HintText(FText::FromString("Description players see when unearned."))
+                            .OnTextChanged_Lambda([this](const FText& newText)
+                                {this->LockedDescription = newText.ToString();})
                             UPDATE_LOCAL_STATE()
                         ]
                     ]
@@ -321,8 +352,11 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                         + SHorizontalBox::Slot()
                         .FillWidth(RIGHT_COL_WIDTH)
                         [
-                            SAssignNew(this->unlockedDescription, SEditableTextBox)
+                            SNew(SEditableTextBox)
+                            .Text_Lambda([this] { return FText::FromString(this->UnlockedDescription); })
                             .HintText(FText::FromString("Description players see after earned."))
+                            .OnTextChanged_Lambda([this](const FText& newText)
+                                {this->UnlockedDescription = newText.ToString();})
                             UPDATE_LOCAL_STATE()
                         ]
                     ]
@@ -356,7 +390,7 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                                         const FString iconPath = UAwsGameKitFileUtils::PickFile(FString("Pick locked icon file."), FString("PNG file (*.png)|*.png"));
                                         if (!iconPath.Equals(""))
                                         {
-                                            this->lockedIcon->SetText(FText::FromString(iconPath));
+                                            this->LockedIcon = iconPath;
                                             this->localLockedIcon = true;
                                             this->parent->Repopulate();
                                         }
@@ -371,7 +405,8 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                                 + SVerticalBox::Slot()
                                 .AutoHeight()
                                 [
-                                    SAssignNew(this->lockedIcon, SEditableTextBox)
+                                    SNew(SEditableTextBox)
+                                    .Text_Lambda([this] { return FText::FromString(this->LockedIcon); })
                                     .HintText(FText::FromString("C:/images/locked_path.png"))
                                     .IsEnabled(false)
                                     UPDATE_LOCAL_STATE()
@@ -427,7 +462,7 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                                         const FString iconPath = UAwsGameKitFileUtils::PickFile(FString("Pick unlocked icon file."), FString("PNG file (*.png)|*.png"));
                                         if (!iconPath.Equals(""))
                                         {
-                                            this->unlockedIcon->SetText(FText::FromString(iconPath));
+                                            this->UnlockedIcon = iconPath;
                                             this->localUnlockedIcon = true;
                                             this->parent->Repopulate();
                                         }
@@ -442,7 +477,8 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                                 + SVerticalBox::Slot()
                                 .AutoHeight()
                                 [
-                                    SAssignNew(this->unlockedIcon, SEditableTextBox)
+                                    SNew(SEditableTextBox)
+                                    .Text_Lambda([this] { return FText::FromString(this->UnlockedIcon); })
                                     .HintText(FText::FromString("C:/images/path.png"))
                                     .IsEnabled(false)
                                     UPDATE_LOCAL_STATE()
@@ -486,7 +522,7 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             SNew(SSpinBox<int32>)
                             .MinValue(0)
                             .MaxValue(TNumericLimits<int32>::Max())
-                            .Value(max)
+                            .Value_Lambda([this] { return this->MaxValue; })
                             .OnValueCommitted(FOnInt32ValueCommitted::CreateLambda([this](int32 newValue, ETextCommit::Type type)
                             {
                                 MaxValue = newValue;
@@ -522,8 +558,9 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             .AutoWidth()
                             .HAlign(HAlign_Left)
                             [
-                                SAssignNew(secret, SCheckBox)
-                                .OnCheckStateChanged_Lambda([this](ECheckBoxState InCheckBoxState){this->parent->Repopulate();})
+                                SNew(SCheckBox)
+                                .IsChecked_Lambda([this] { return this->IsSecret ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                                .OnCheckStateChanged_Lambda([this](ECheckBoxState InCheckBoxState){this->IsSecret = InCheckBoxState == ECheckBoxState::Checked; this->parent->Repopulate();})
                             ]
                             + SHorizontalBox::Slot()
                             .AutoWidth()
@@ -538,8 +575,9 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             .HAlign(HAlign_Left)
                             .Padding(25,0,0,0)
                             [
-                                SAssignNew(hidden, SCheckBox)
-                                .OnCheckStateChanged_Lambda([this](ECheckBoxState InCheckBoxState){this->parent->Repopulate();})
+                                SNew(SCheckBox)
+                                .IsChecked_Lambda([this] { return this->IsHidden ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                                .OnCheckStateChanged_Lambda([this](ECheckBoxState InCheckBoxState){this->IsHidden = InCheckBoxState == ECheckBoxState::Checked; this->parent->Repopulate();})
                             ]
                             + SHorizontalBox::Slot()
                             .AutoWidth()
@@ -568,7 +606,7 @@ void AwsGameKitAchievementUI::Initialize(AwsGameKitAchievementsLayoutDetails* la
                             SNew(SSpinBox<int32>)
                             .MinValue(0)
                             .MaxValue(TNumericLimits<int32>::Max())
-                            .Value(sortOrder)
+                            .Value_Lambda([this] { return this->SortOrder; })
                             .OnValueCommitted(FOnInt32ValueCommitted::CreateLambda([this](int32 newValue, ETextCommit::Type type)
                             {
                                 SortOrder = newValue;
@@ -602,53 +640,51 @@ FReply AwsGameKitAchievementUI::DeleteAchievement()
         // this achievement isn't in the cloud as far as we know, delete locally.
         this->parent->achievements.Remove(this->idString);
     }
-    this->parent->invalidIds.Remove(idString);
-    this->GetRepresentation()->SetVisibility(EVisibility::Collapsed);
+    this->parent->invalidIds.RemoveSingle(AchievementId);
     this->parent->Repopulate();
     return FReply::Handled();
 }
 
 void AwsGameKitAchievementUI::OnIdChanged(const FText& newId)
 {
-    if (newId.IsEmpty())
-    {
-        this->parent->invalidIds.Remove(this->idString);
-        return;
-    }
+    // Only this row and the invalid IDs change while typing, the list is re-keyed and sorted when the ID is committed
+    this->parent->invalidIds.RemoveSingle(this->AchievementId);
+    this->AchievementId = newId.ToString();
 
     // Valid ID is any combination of alphanumeric characters and underscore that doesn't begin or end with an underscore, length >= 2
-    bool valid = AwsGameKitAchievementsAdmin::IsAchievementIdValid(newId);
-    if (!valid && this->idValidationWarning.IsValid())
+    if (!newId.IsEmpty() && !AwsGameKitAchievementsAdmin::IsAchievementIdValid(newId))
     {
-        this->idValidationWarning->SetVisibility(EVisibility::Visible);
-        this->parent->invalidIds.Remove(this->idString);
-        this->parent->invalidIds.Add(newId.ToString());
-    }
-    else if (this->idValidationWarning.IsValid())
-    {
-        this->idValidationWarning->SetVisibility(EVisibility::Collapsed);
-        this->parent->invalidIds.Remove(this->idString);
+        this->parent->invalidIds.Add(this->AchievementId);
     }
 
-    if (this->parent->achievements.Contains(this->idString))
+    this->parent->UpdateSyncStatus(*this);
+}
+
+void AwsGameKitAchievementUI::OnIdCommitted(const FText& newId, ETextCommit::Type commitType)
+{
+    if (!this->AchievementId.IsEmpty() && this->AchievementId != this->idString && !this->parent->achievements.Contains(this->AchievementId))
     {
-        TSharedPtr<AwsGameKitAchievementUI> ptr = *this->parent->achievements.Find(this->idString);
-        this->parent->achievements.Remove(this->idString);
-        this->parent->achievements.Add(newId.ToString(), ptr);
-        this->idString = newId.ToString();
-        this->parent->Repopulate();
+        TSharedPtr<AwsGameKitAchievementUI> ptr;
+        if (this->parent->achievements.RemoveAndCopyValue(this->idString, ptr))
+        {
+            this->parent->achievements.Add(this->AchievementId, ptr);
+            this->idString = this->AchievementId;
+        }
     }
+
+    this->parent->SortAchievements();
+    this->parent->Repopulate();
 }
 
 void AwsGameKitAchievementUI::ToAchievement(AdminAchievement& result)
 {
     // Strings
-    result.achievementId = id->GetText().ToString();
-    result.title = title->GetText().ToString();
-    result.lockedDescription = lockedDescription->GetText().ToString();
-    result.unlockedDescription = unlockedDescription->GetText().ToString();
-    result.lockedIcon = lockedIcon->GetText().ToString();
-    result.unlockedIcon = unlockedIcon->GetText().ToString();
+    result.achievementId = AchievementId;
+    result.title = Title;
+    result.lockedDescription = LockedDescription;
+    result.unlockedDescription = UnlockedDescription;
+    result.lockedIcon = LockedIcon;
+    result.unlockedIcon = UnlockedIcon;
 
     // Numbers
     result.points = Points;
@@ -657,28 +693,28 @@ void AwsGameKitAchievementUI::ToAchievement(AdminAchievement& result)
 
     // Bools
     result.isStateful = result.requiredAmount > 1;
-    result.isHidden = hidden->IsChecked();
-    result.isSecret = secret->IsChecked();
+    result.isHidden = IsHidden;
+    result.isSecret = IsSecret;
     result.localLockedIcon = localLockedIcon;
     result.localUnlockedIcon = localUnlockedIcon;
 }
 
 void AwsGameKitAchievementUI::ToJsonObject(TSharedPtr<FJsonObject>& result)
 {
-    result->SetStringField("achievement_id", id->GetText().ToString());
-    result->SetStringField("title", title->GetText().ToString());
-    result->SetStringField("locked_description", lockedDescription->GetText().ToString());
-    result->SetStringField("unlocked_description", unlockedDescription->GetText().ToString());
-    result->SetStringField("locked_icon_url", lockedIcon->GetText().ToString());
-    result->SetStringField("unlocked_icon_url", unlockedIcon->GetText().ToString());
+    result->SetStringField("achievement_id", AchievementId);
+    result->SetStringField("title", Title);
+    result->SetStringField("locked_description", LockedDescription);
+    result->SetStringField("unlocked_description", UnlockedDescription);
+    result->SetStringField("locked_icon_url", LockedIcon);
+    result->SetStringField("unlocked_icon_url", UnlockedIcon);
 
     result->SetNumberField("max_value", MaxValue);
     result->SetNumberField("points", Points);
     result->SetNumberField("order_number", SortOrder);
 
     result->SetBoolField("is_stateful", MaxValue > 1);
-    result->SetBoolField("is_secret", secret->IsChecked());
-    result->SetBoolField("is_hidden", hidden->IsChecked());
+    result->SetBoolField("is_secret", IsSecret);
+    result->SetBoolField("is_hidden", IsHidden);
     result->SetBoolField("local_locked_icon", localLockedIcon);
     result->SetBoolField("local_unlocked_icon", localUnlockedIcon);
 }
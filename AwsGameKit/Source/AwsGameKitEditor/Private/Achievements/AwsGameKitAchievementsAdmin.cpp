@@ -11,15 +11,119 @@
 #include "Achievements/AwsGameKitAchievements.h"
 #include "AwsGameKitRuntime/Private/AwsGameKitRuntimeInternalHelpers.h"
 #include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
 #include "Core/Logging.h"
 
 // Standard library
+#include <atomic>
 #include <vector>
 
 // Unreal
 #include "Interfaces/IPluginManager.h"
 #include "Misc/FileHelper.h"
 
+namespace
+{
+    struct FAchievementsBatch
+    {
+        int32 First;
+        int32 Count;
+    };
+
+    // Splits Items into consecutive batches bounded by BATCH_MAX_ACHIEVEMENTS items and, unless a single item is larger, BATCH_MAX_BYTES bytes.
+    template <typename ItemType, typename SizeFunctionType>
+    TArray<FAchievementsBatch> SplitIntoBatches(const TArray<ItemType>& Items, SizeFunctionType GetSize)
+    {
+        TArray<FAchievementsBatch> Batches;
+        int32 BatchBytes = 0;
+        for (int32 i = 0; i < Items.Num(); ++i)
+        {
+            const int32 ItemBytes = GetSize(Items[i]);
+            if (Batches.Num() == 0 ||
+                Batches.Last().Count >= AwsGameKitAchievementsAdmin::BATCH_MAX_ACHIEVEMENTS ||
+                BatchBytes + ItemBytes > AwsGameKitAchievementsAdmin::BATCH_MAX_BYTES)
+            {
+                Batches.Add({ i, 0 });
+                BatchBytes = 0;
+            }
+            Batches.Last().Count++;
+            BatchBytes += ItemBytes;
+        }
+        return Batches;
+    }
+
+    // Sends the batches on up to BATCH_MAX_PARALLEL_REQUESTS worker threads, reporting each one, then the overall result, on the game thread.
+    void SendBatches(TArray<FAchievementsBatch>&& Batches, int32 TotalAchievements,
+        TFunction<IntResult(const FAchievementsBatch&)>&& SendBatch,
+        TAwsGameKitDelegateParam<const AchievementsBatchProgress&> BatchCompleteDelegate,
+        TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+    {
+        struct FState
+        {
+            TArray<FAchievementsBatch> Batches;
+            TFunction<IntResult(const FAchievementsBatch&)> SendBatch;
+            TAwsGameKitDelegate<const AchievementsBatchProgress&> BatchCompleteDelegate;
+            TAwsGameKitDelegate<const IntResult&> ResultDelegate;
+            int32 TotalAchievements = 0;
+            std::atomic<int32> NextBatch{ 0 };
+            std::atomic<int32> CompletedBatches{ 0 };
+            std::atomic<int32> CompletedAchievements{ 0 };
+            std::atomic<int32> RunningWorkers{ 0 };
+            std::atomic<unsigned int> FirstError{ GameKit::GAMEKIT_SUCCESS };
+        };
+
+        const TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+        State->Batches = MoveTemp(Batches);
+        State->SendBatch = MoveTemp(SendBatch);
+        State->BatchCompleteDelegate = BatchCompleteDelegate;
+        State->ResultDelegate = ResultDelegate;
+        State->TotalAchievements = TotalAchievements;
+
+        const int32 NumWorkers = FMath::Min(State->Batches.Num(), AwsGameKitAchievementsAdmin::BATCH_MAX_PARALLEL_REQUESTS);
+        if (NumWorkers == 0)
+        {
+            FGraphEventRef OrderedWorkChain;
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, State->ResultDelegate, IntResult(GameKit::GAMEKIT_SUCCESS));
+            return;
+        }
+
+        State->RunningWorkers = NumWorkers;
+        for (int32 Worker = 0; Worker < NumWorkers; ++Worker)
+        {
+            InternalAwsGameKitRunLambdaOnWorkThread([State]()
+            {
+                FGraphEventRef OrderedWorkChain;
+                int32 BatchIndex;
+                while (State->FirstError.load() == GameKit::GAMEKIT_SUCCESS && (BatchIndex = State->NextBatch++) < State->Batches.Num())
+                {
+                    const FAchievementsBatch& Batch = State->Batches[BatchIndex];
+                    const IntResult Result = State->SendBatch(Batch);
+                    if (Result.Result != GameKit::GAMEKIT_SUCCESS)
+                    {
+                        unsigned int Expected = GameKit::GAMEKIT_SUCCESS;
+                        State->FirstError.compare_exchange_strong(Expected, Result.Result);
+                        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitAchievementsAdmin: Batch %d of %d failed with %s"), BatchIndex + 1, State->Batches.Num(), *GameKit::StatusCodeToHexFStr(Result.Result));
+                        break;
+                    }
+
+                    AchievementsBatchProgress Progress;
+                    Progress.completedBatches = ++State->CompletedBatches;
+                    Progress.totalBatches = State->Batches.Num();
+                    Progress.completedAchievements = State->CompletedAchievements += Batch.Count;
+                    Progress.totalAchievements = State->TotalAchievements;
+                    InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, State->BatchCompleteDelegate, MoveTemp(Progress));
+                }
+
+                // The last worker reports the overall result, after every batch progress it and the other workers queued
+                if (--State->RunningWorkers == 0)
+                {
+                    InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, State->ResultDelegate, IntResult(State->FirstError.load()));
+                }
+            });
+        }
+    }
+}
+
 AchievementsAdminLibrary AwsGameKitAchievementsAdmin::achievementsAdminLibrary;
 TSharedPtr<EditorState> AwsGameKitAchievementsAdmin::editorState;
 
@@ -165,110 +269,163 @@ void AwsGameKitAchievementsAdmin::AddAchievementsForGame(const AddAchievementsRe
     }
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
         FGraphEventRef OrderedWorkChain;
 
-        unsigned int numAchievements = AddAchievementsRequest.achievements.Num();
+        IntResult result = AddAchievementsBlocking(AddAchievementsRequest.achievements);
 
-        std::vector<GameKit::Achievement> achs;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
+    });
+}
 
-        TArray<std::string> idBuffers;
-        idBuffers.SetNum(numAchievements);
+void AwsGameKitAchievementsAdmin::AddAchievementsForGameInBatches(const AddAchievementsRequest& AddAchievementsRequest,
+    TAwsGameKitDelegateParam<const AchievementsBatchProgress&> BatchCompleteDelegate,
+    TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+{
+    if (!CredentialsValid())
+    {
+        return;
+    }
 
-        TArray<std::string> titleBuffers;
-        titleBuffers.SetNum(numAchievements);
+    // Approximate size of the request body: the strings plus the field names and numbers
+    TArray<FAchievementsBatch> batches = SplitIntoBatches(AddAchievementsRequest.achievements, [](const AdminAchievement& achievement)
+    {
+        return 256 + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.achievementId)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.title)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.lockedDescription)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.unlockedDescription)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.lockedIcon)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(achievement.unlockedIcon);
+    });
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievementsAdmin::AddAchievementsForGameInBatches(): Sending %d achievements in %d batches"), AddAchievementsRequest.achievements.Num(), batches.Num());
 
-        TArray<std::string> lockedDescBuffers;
-        lockedDescBuffers.SetNum(numAchievements);
+    const TArray<AdminAchievement> achievements = AddAchievementsRequest.achievements;
+    SendBatches(MoveTemp(batches), achievements.Num(), [achievements](const FAchievementsBatch& batch)
+    {
+        return AddAchievementsBlocking(TArrayView<const AdminAchievement>(achievements).Slice(batch.First, batch.Count));
+    }, BatchCompleteDelegate, ResultDelegate);
+}
 
-        TArray<std::string> unlockedDescBuffers;
-        unlockedDescBuffers.SetNum(numAchievements);
+IntResult AwsGameKitAchievementsAdmin::AddAchievementsBlocking(TArrayView<const AdminAchievement> achievements)
+{
+    AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
 
-        TArray<std::string> lockedIconBuffers;
-        lockedIconBuffers.SetNum(numAchievements);
+    unsigned int numAchievements = achievements.Num();
 
-        TArray<std::string> unlockedIconBuffers;
-        unlockedIconBuffers.SetNum(numAchievements);
+    std::vector<GameKit::Achievement> achs;
 
-        for (unsigned int i = 0; i < numAchievements; i++)
+    // Size the arena from the inputs first so that every string is converted into one allocation.
+    int32 convertedSize = 0;
+    for (const AdminAchievement& targetAchievement : achievements)
+    {
+        convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.achievementId)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.title)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.lockedDescription)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.unlockedDescription)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.lockedIcon)
+            + FAwsGameKitInternalTempStrings::GetConvertedSize(targetAchievement.unlockedIcon);
+    }
+    FAwsGameKitInternalTempStrings ConvertString;
+    ConvertString.Reserve(convertedSize);
+    achs.reserve(numAchievements);
+
+    for (unsigned int i = 0; i < numAchievements; i++)
+    {
+        const AdminAchievement& targetAchievement = achievements[i];
+
+        int32 requiredAmount = targetAchievement.requiredAmount;
+        requiredAmount = requiredAmount <= 0 ? 1 : requiredAmount;
+
+        GameKit::Achievement a
         {
-            AdminAchievement targetAchievement = AddAchievementsRequest.achievements[i];
+            ConvertString(targetAchievement.achievementId),
+            ConvertString(targetAchievement.title),
+            ConvertString(targetAchievement.lockedDescription),
+            ConvertString(targetAchievement.unlockedDescription),
+            ConvertString(targetAchievement.lockedIcon),
+            ConvertString(targetAchievement.unlockedIcon),
+            (unsigned int)requiredAmount,
+            (unsigned int)targetAchievement.points,
+            (unsigned int)targetAchievement.sortOrder,
+            targetAchievement.isStateful,
+            targetAchievement.isSecret,
+            targetAchievement.isHidden
+        };
+        achs.push_back(a);
+    }
 
-            idBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.achievementId);
-            titleBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.title);
-            lockedDescBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.lockedDescription);
-            unlockedDescBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.unlockedDescription);
-            lockedIconBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.lockedIcon);
-            unlockedIconBuffers[i] = TCHAR_TO_UTF8(*targetAchievement.unlockedIcon);
+    return IntResult(achievementsLibrary.AchievementsAdminWrapper->GameKitAdminAddAchievements(
+        achievementsLibrary.AchievementsInstanceHandle,
+        achs.data(),
+        achs.size()
+        ));
+}
 
-            int32 requiredAmount = targetAchievement.requiredAmount;
-            requiredAmount = requiredAmount <= 0 ? 1 : requiredAmount;
+void AwsGameKitAchievementsAdmin::DeleteAchievementsForGame(const DeleteAchievementsRequest& DeleteAchievementsRequest, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+{
+    if (!CredentialsValid())
+    {
+        return;
+    }
 
-            GameKit::Achievement a
-            {
-                idBuffers[i].c_str(),
-                titleBuffers[i].c_str(),
-                lockedDescBuffers[i].c_str(),
-                unlockedDescBuffers[i].c_str(),
-                lockedIconBuffers[i].c_str(),
-                unlockedIconBuffers[i].c_str(),
-                (unsigned int)requiredAmount,
-                (unsigned int)targetAchievement.points,
-                (unsigned int)targetAchievement.sortOrder,
-                targetAchievement.isStateful,
-                targetAchievement.isSecret,
-                targetAchievement.isHidden
-            };
-            achs.push_back(a);
-        }
+    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+        FGraphEventRef OrderedWorkChain;
 
-        IntResult result(achievementsLibrary.AchievementsAdminWrapper->GameKitAdminAddAchievements(
-            achievementsLibrary.AchievementsInstanceHandle,
-            achs.data(),
-            achs.size()
-            ));
+        IntResult result = DeleteAchievementsBlocking(DeleteAchievementsRequest.achievementIdentifiers);
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
     });
 }
 
-void AwsGameKitAchievementsAdmin::DeleteAchievementsForGame(const DeleteAchievementsRequest& DeleteAchievementsRequest, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
+void AwsGameKitAchievementsAdmin::DeleteAchievementsForGameInBatches(const DeleteAchievementsRequest& DeleteAchievementsRequest,
+    TAwsGameKitDelegateParam<const AchievementsBatchProgress&> BatchCompleteDelegate,
+    TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
     if (!CredentialsValid())
     {
         return;
     }
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
-        FGraphEventRef OrderedWorkChain;
+    TArray<FAchievementsBatch> batches = SplitIntoBatches(DeleteAchievementsRequest.achievementIdentifiers, [](const FString& achievementId)
+    {
+        return 8 + FAwsGameKitInternalTempStrings::GetConvertedSize(achievementId);
+    });
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievementsAdmin::DeleteAchievementsForGameInBatches(): Deleting %d achievements in %d batches"), DeleteAchievementsRequest.achievementIdentifiers.Num(), batches.Num());
 
-        const unsigned int numAchievements = DeleteAchievementsRequest.achievementIdentifiers.Num();
+    const TArray<FString> achievementIdentifiers = DeleteAchievementsRequest.achievementIdentifiers;
+    SendBatches(MoveTemp(batches), achievementIdentifiers.Num(), [achievementIdentifiers](const FAchievementsBatch& batch)
+    {
+        return DeleteAchievementsBlocking(TArrayView<const FString>(achievementIdentifiers).Slice(batch.First, batch.Count));
+    }, BatchCompleteDelegate, ResultDelegate);
+}
 
-        TArray<std::string> buffers;
-        buffers.SetNum(numAchievements);
-        TArray<const char*> bufferChrPtrs;
-        bufferChrPtrs.SetNum(numAchievements);
+IntResult AwsGameKitAchievementsAdmin::DeleteAchievementsBlocking(TArrayView<const FString> achievementIdentifiers)
+{
+    AchievementsAdminLibrary achievementsLibrary = GetAchievementsAdminLibrary();
 
-        for (unsigned int i = 0; i < numAchievements; i++)
-        {
-            FString target = DeleteAchievementsRequest.achievementIdentifiers[i];
-            buffers[i] = TCHAR_TO_UTF8(*target);
-            bufferChrPtrs[i] = buffers[i].c_str();
-        }
+    const unsigned int numAchievements = achievementIdentifiers.Num();
 
-        IntResult result(achievementsLibrary.AchievementsAdminWrapper->GameKitAdminDeleteAchievements(
-            achievementsLibrary.AchievementsInstanceHandle,
-            bufferChrPtrs.GetData(),
-            numAchievements
-            ));
+    TArray<std::string> buffers;
+    buffers.SetNum(numAchievements);
+    TArray<const char*> bufferChrPtrs;
+    bufferChrPtrs.SetNum(numAchievements);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
-    });
+    for (unsigned int i = 0; i < numAchievements; i++)
+    {
+        const FString& target = achievementIdentifiers[i];
+        buffers[i] = TCHAR_TO_UTF8(*target);
+        bufferChrPtrs[i] = buffers[i].c_str();
+    }
+
+    return IntResult(achievementsLibrary.AchievementsAdminWrapper->GameKitAdminDeleteAchievements(
+        achievementsLibrary.AchievementsInstanceHandle,
+        bufferChrPtrs.GetData(),
+        numAchievements
+        ));
 }
 
 void AwsGameKitAchievementsAdmin::AddSampleData(TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     const FString pluginBaseDir = IPluginManager::Get().FindPlugin("AwsGameKit")->GetBaseDir();
     const FString templatePath = FPaths::Combine(*pluginBaseDir, TEXT("Resources"), TEXT("cloudResources"), TEXT("misc"), TEXT("achievements"), TEXT("achievements_template.json"));
     FString message;
@@ -299,6 +456,7 @@ void AwsGameKitAchievementsAdmin::AddSampleData(TAwsGameKitDelegateParam<const I
 
 void AwsGameKitAchievementsAdmin::DeleteSampleData(TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     FString pluginBaseDir = IPluginManager::Get().FindPlugin("AwsGameKit")->GetBaseDir();
     FString templatePath = FPaths::Combine(*pluginBaseDir, TEXT("Resources"), TEXT("cloudResources"), TEXT("misc"), TEXT("achievements"), TEXT("achievements_template.json"));
     FString message;
@@ -27,47 +27,55 @@ void AwsGameKitAchievementsAdminWrapper::importFunctions(void* loadedDllHandle)
 GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE AwsGameKitAchievementsAdminWrapper::GameKitAdminAchievementsInstanceCreateWithSessionManager(void* sessionManager, const char* cloudResourcesPath, const AccountCredentials accountCredentials, const AccountInfo accountInfo, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminAchievementsInstanceCreateWithSessionManager, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAdminAchievementsInstanceCreateWithSessionManager, sessionManager, cloudResourcesPath, accountCredentials, accountInfo, logCb);
 }
 
 void AwsGameKitAchievementsAdminWrapper::GameKitAdminAchievementsInstanceRelease(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminAchievementsInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     INVOKE_FUNC(GameKitAdminAchievementsInstanceRelease, achievementsInstance);
 }
 
 unsigned int AwsGameKitAchievementsAdminWrapper::GameKitAdminCredentialsChanged(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const AccountCredentials accountCredentials, const AccountInfo accountInfo)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminCredentialsChanged, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAdminCredentialsChanged, achievementsInstance, accountCredentials, accountInfo);
 }
 
 unsigned int AwsGameKitAchievementsAdminWrapper::GameKitAdminListAchievements(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, unsigned int pageSize, bool waitForAllPages, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminListAchievements, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAdminListAchievements, achievementsInstance, pageSize, waitForAllPages, receiver, responseCallback);
 }
 
 unsigned int AwsGameKitAchievementsAdminWrapper::GameKitAdminAddAchievements(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, GameKit::Achievement* achievement, unsigned int batchSize)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminAddAchievements, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAdminAddAchievements, achievementsInstance, achievement, batchSize);
 }
 
 unsigned int AwsGameKitAchievementsAdminWrapper::GameKitAdminDeleteAchievements(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char** achievementIdentifiers, unsigned int batchSize)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAdminDeleteAchievements, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAdminDeleteAchievements, achievementsInstance, achievementIdentifiers, batchSize);
 }
 
 unsigned int AwsGameKitAchievementsAdminWrapper::GameKitGetAchievementIconsBaseUrl(GAMEKIT_ADMIN_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitGetAchievementIconsBaseUrl, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitGetAchievementIconsBaseUrl, achievementsInstance, dispatchReceiver, responseCallback);
 }
 
 bool AwsGameKitAchievementsAdminWrapper::GameKitIsAchievementIdValid(const char* achievementId)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitIsAchievementIdValid, false);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitIsAchievementIdValid, achievementId);
 }
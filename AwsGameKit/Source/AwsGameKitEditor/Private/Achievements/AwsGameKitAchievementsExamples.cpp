@@ -22,6 +22,7 @@
 void AAwsGameKitAchievementsExamples::BeginDestroy()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AAwsGameKitAchievementsExamples::BeginDestroy()"));
+    stressTest.Reset();
     Super::BeginDestroy();
 }
 
@@ -336,6 +337,66 @@ void AAwsGameKitAchievementsExamples::OnUpdateAchievementComplete(const IntResul
     FSlateApplication::Get().AddWindow(earnedPopup);
 }
 
+/**
+ * Call the GetAchievementForPlayer API as set in the Stress Test settings, or UpdateAchievementForPlayer when an increment is set.
+ *
+ * Concurrent GetAchievementForPlayer calls share one request unless GameKit.Runtime.DeduplicateReads is 0.
+ */
+void AAwsGameKitAchievementsExamples::CallStartStressTest()
+{
+    if (!InitializeAchievementsLibrary())
+    {
+        return;
+    }
+
+    if (stressTest.IsValid() && stressTest->IsRunning())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() a stress test is already running"));
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() called with parameters: achievementId=%s, incrementBy=%d"), *StressAchievementId, StressAchievementIncrement);
+
+    const FString achievementId = StressAchievementId;
+    const int32 increment = StressAchievementIncrement;
+    stressTest = AwsGameKitEditorStressTest::Start(increment > 0 ? "UpdateAchievementForPlayer" : "GetAchievementForPlayer", StressSettings,
+        [achievementId, increment](int32 callIndex, TFunction<void(const IntResult&)> onComplete)
+        {
+            const auto Delegate = TAwsGameKitDelegate<const IntResult&, const FAchievement&>::CreateLambda([onComplete](const IntResult& result, const FAchievement& achievement)
+            {
+                onComplete(result);
+            });
+
+            if (increment > 0)
+            {
+                const FUpdateAchievementRequest update{
+                    achievementId,
+                    increment,
+                };
+                AwsGameKitAchievements::UpdateAchievementForPlayer(update, Delegate);
+            }
+            else
+            {
+                const FGetAchievementRequest id{
+                    achievementId,
+                };
+                AwsGameKitAchievements::GetAchievementForPlayer(id, Delegate);
+            }
+        },
+        [this](const FAwsGameKitStressTestResults& results)
+        {
+            StressResults = results;
+        });
+}
+
+void AAwsGameKitAchievementsExamples::CallStopStressTest()
+{
+    if (stressTest.IsValid())
+    {
+        stressTest->Stop();
+    }
+}
+
 FString AAwsGameKitAchievementsExamples::GetResultMessage(unsigned int errorCode)
 {
     return errorCode == GameKit::GAMEKIT_SUCCESS ? "GAMEKIT_SUCCESS" : FString("Error code: ") + GameKit::StatusCodeToHexFStr(errorCode) + " Check output log.";
@@ -13,6 +13,7 @@
 #include "FeatureResourceManager.h"
 #include "Achievements/AwsGameKitAchievements.h"
 #include "Achievements/AwsGameKitAchievementUI.h"
+#include "Core/AwsGameKitMemory.h"
 #include "Utils/AwsGameKitProjectSettingsUtils.h"
 #include "Utils/Blueprints/UAwsGameKitFileUtils.h"
 
@@ -25,25 +26,193 @@
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "MessageEndpointBuilder.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "PropertyCustomizationHelpers.h"
 #include "Algo/Sort.h"
 #include "Async/Async.h"
+#include "Containers/Ticker.h"
 #include "Developer/DesktopPlatform/Public/DesktopPlatformModule.h"
 #include "Developer/DesktopPlatform/Public/IDesktopPlatform.h"
+#include "HAL/FileManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
 #include "Styling/SlateStyle.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SHyperlink.h"
+#include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
 
 #define LOCTEXT_NAMESPACE "AwsGameKitAchievementLayoutDetails"
 
 const FText AwsGameKitAchievementsLayoutDetails::SAVE_BUTTON_TEXT = LOCTEXT("SaveButton", "Save Data to Cloud");
 
-AwsGameKitAchievementsLayoutDetails::AwsGameKitAchievementsLayoutDetails(const FAwsGameKitEditorModule* editorModule) : AwsGameKitFeatureLayoutDetails(FeatureType::Achievements, editorModule)
+struct AwsGameKitAchievementsLayoutDetails::FJsonFileState
+{
+    // Cleared by the destructor, the game thread callbacks of the workers check it
+    bool isOwnerAlive = true;
+
+    // Writes are committed in the order they were requested, a write which finishes after a newer one is dropped
+    FCriticalSection writeMutex;
+    uint32 lastRequestedWrite = 0;
+    uint32 lastCommittedWrite = 0;
+};
+
+namespace
+{
+    // Progress is shown for catalogs of at least this many achievements, every this many achievements
+    const int32 JSON_PROGRESS_INTERVAL = 250;
+
+    // Cloud achievements merged into the list per tick
+    const int32 CLOUD_MERGE_SLICE = 500;
+
+    // Reads the achievements of a local state or template file token by token, without building a json object tree
+    bool ReadAchievementsJson(const FString& contents, TArray<AdminAchievement>& output, const TFunction<void(int32)>& onProgress)
+    {
+        const TSharedRef<TJsonReader<TCHAR>> reader = TJsonReaderFactory<TCHAR>::Create(contents);
+        EJsonNotation notation;
+        int32 depth = 0;
+        bool inAchievements = false;
+        AdminAchievement current{};
+        while (reader->ReadNext(notation))
+        {
+            switch (notation)
+            {
+            case EJsonNotation::ObjectStart:
+                depth++;
+                if (inAchievements && depth == 3)
+                {
+                    current = AdminAchievement{};
+                }
+                break;
+            case EJsonNotation::ObjectEnd:
+                if (inAchievements && depth == 3)
+                {
+                    current.isStateful = current.requiredAmount > 0;
+                    output.Add(MoveTemp(current));
+                    if (output.Num() % JSON_PROGRESS_INTERVAL == 0)
+                    {
+                        onProgress(output.Num());
+                    }
+                }
+                depth--;
+                break;
+            case EJsonNotation::ArrayStart:
+                depth++;
+                if (depth == 2 && reader->GetIdentifier() == TEXT("achievements"))
+                {
+                    inAchievements = true;
+                }
+                break;
+            case EJsonNotation::ArrayEnd:
+                if (depth == 2)
+                {
+                    inAchievements = false;
+                }
+                depth--;
+                break;
+            case EJsonNotation::String:
+                if (inAchievements && depth == 3)
+                {
+                    const FString& identifier = reader->GetIdentifier();
+                    FString* field = identifier == TEXT("achievement_id") ? &current.achievementId
+                        : identifier == TEXT("title") ? &current.title
+                        : identifier == TEXT("locked_description") ? &current.lockedDescription
+                        : identifier == TEXT("unlocked_description") ? &current.unlockedDescription
+                        : identifier == TEXT("locked_icon_url") ? &current.lockedIcon
+                        : identifier == TEXT("unlocked_icon_url") ? &current.unlockedIcon
+                        : nullptr;
+                    if (field != nullptr)
+                    {
+                        *field = reader->GetValueAsString();
+                    }
+                }
+                break;
+            case EJsonNotation::Number:
+                if (inAchievements && depth == 3)
+                {
+                    const FString& identifier = reader->GetIdentifier();
+                    int32* field = identifier == TEXT("max_value") ? &current.requiredAmount
+                        : identifier == TEXT("points") ? &current.points
+                        : identifier == TEXT("order_number") ? &current.sortOrder
+                        : nullptr;
+                    if (field != nullptr)
+                    {
+                        *field = static_cast<int32>(reader->GetValueAsNumber());
+                    }
+                }
+                break;
+            case EJsonNotation::Boolean:
+                if (inAchievements && depth == 3)
+                {
+                    const FString& identifier = reader->GetIdentifier();
+                    bool* field = identifier == TEXT("is_secret") ? &current.isSecret
+                        : identifier == TEXT("is_hidden") ? &current.isHidden
+                        : identifier == TEXT("local_locked_icon") ? &current.localLockedIcon
+                        : identifier == TEXT("local_unlocked_icon") ? &current.localUnlockedIcon
+                        : nullptr;
+                    if (field != nullptr)
+                    {
+                        *field = reader->GetValueAsBoolean();
+                    }
+                }
+                break;
+            case EJsonNotation::Error:
+                return false;
+            default:
+                break;
+            }
+        }
+
+        return notation != EJsonNotation::Error;
+    }
+
+    // Writes the achievements in the format of AwsGameKitAchievementUI::ToJsonObject(), without building a json object tree
+    void WriteAchievementsJson(const TArray<AdminAchievement>& achievements, FString& output, const TFunction<void(int32)>& onProgress)
+    {
+        const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> writer = TJsonWriterFactory<>::Create(&output);
+        writer->WriteObjectStart();
+        writer->WriteArrayStart(TEXT("achievements"));
+        for (int32 i = 0; i < achievements.Num(); ++i)
+        {
+            const AdminAchievement& achievement = achievements[i];
+            writer->WriteObjectStart();
+            writer->WriteValue(TEXT("achievement_id"), achievement.achievementId);
+            writer->WriteValue(TEXT("title"), achievement.title);
+            writer->WriteValue(TEXT("locked_description"), achievement.lockedDescription);
+            writer->WriteValue(TEXT("unlocked_description"), achievement.unlockedDescription);
+            writer->WriteValue(TEXT("locked_icon_url"), achievement.lockedIcon);
+            writer->WriteValue(TEXT("unlocked_icon_url"), achievement.unlockedIcon);
+            writer->WriteValue(TEXT("max_value"), achievement.requiredAmount);
+            writer->WriteValue(TEXT("points"), achievement.points);
+            writer->WriteValue(TEXT("order_number"), achievement.sortOrder);
+            writer->WriteValue(TEXT("is_stateful"), achievement.requiredAmount > 1);
+            writer->WriteValue(TEXT("is_secret"), achievement.isSecret);
+            writer->WriteValue(TEXT("is_hidden"), achievement.isHidden);
+            writer->WriteValue(TEXT("local_locked_icon"), achievement.localLockedIcon);
+            writer->WriteValue(TEXT("local_unlocked_icon"), achievement.localUnlockedIcon);
+            writer->WriteObjectEnd();
+
+            if ((i + 1) % JSON_PROGRESS_INTERVAL == 0)
+            {
+                onProgress(i + 1);
+            }
+        }
+        writer->WriteArrayEnd();
+        writer->WriteObjectEnd();
+        writer->Close();
+    }
+}
+
+AwsGameKitAchievementsLayoutDetails::AwsGameKitAchievementsLayoutDetails(const FAwsGameKitEditorModule* editorModule) : AwsGameKitFeatureLayoutDetails(FeatureType::Achievements, editorModule),
+    jsonFileState(MakeShared<FJsonFileState, ESPMode::ThreadSafe>())
 {
     this->imageDownloader = ImageDownloader::MakeInstance();
 
@@ -57,6 +226,13 @@ AwsGameKitAchievementsLayoutDetails::~AwsGameKitAchievementsLayoutDetails()
     {
         achievementsConfig->RequestDestroyWindow();
     }
+
+    // The local state must be on disk before the editor exits
+    jsonFileState->isOwnerAlive = false;
+    for (TFuture<void>& pendingWrite : pendingJsonWrites)
+    {
+        pendingWrite.Wait();
+    }
 }
 
 TSharedRef<IDetailCustomization> AwsGameKitAchievementsLayoutDetails::MakeInstance(const FAwsGameKitEditorModule* editorModule)
@@ -190,8 +366,25 @@ FReply AwsGameKitAchievementsLayoutDetails::ConfigAchievements()
 
                 + SVerticalBox::Slot()
                 .Padding(padding)
+                .AutoHeight()
                 [
-                    SAssignNew(achievementsSection, SScrollBox)
+                    SNew(SSearchBox)
+                    .HintText(LOCTEXT("FilterAchievementsHint", "Filter by ID or title"))
+                    .OnTextChanged_Lambda([this](const FText& newText)
+                    {
+                        this->achievementsFilter = newText.ToString();
+                        RefreshAchievementsList();
+                    })
+                ]
+
+                + SVerticalBox::Slot()
+                .Padding(padding)
+                [
+                    SAssignNew(achievementsSection, SListView<TSharedPtr<AwsGameKitAchievementUI>>)
+                    .ListItemsSource(&this->filteredAchievements)
+                    .SelectionMode(ESelectionMode::None)
+                    .OnGenerateRow(this, &AwsGameKitAchievementsLayoutDetails::OnGenerateAchievementRow)
+                    .OnRowReleased(this, &AwsGameKitAchievementsLayoutDetails::OnAchievementRowReleased)
                 ]
 
                 + SVerticalBox::Slot()
@@ -340,8 +533,11 @@ FReply AwsGameKitAchievementsLayoutDetails::ConfigAchievements()
     {
         this->configWindowOpen = false;
         SaveStateToJsonFile();
+        ++jsonLoadRequestId;
         achievements.Empty();
         cloudSyncedAchievements.Empty();
+        filteredAchievements.Empty();
+        generatedRows.Empty();
         FSlateApplicationBase::Get().RequestDestroyWindow(this->achievementsConfig.ToSharedRef());
     }));
     SetCloudActionButtonState();
@@ -448,12 +644,17 @@ void AwsGameKitAchievementsLayoutDetails::RefreshAchievementIconBaseUrl()
 FReply AwsGameKitAchievementsLayoutDetails::AddAchievement()
 {
     TSharedPtr<AwsGameKitAchievementUI> achievement = MakeShareable(new AwsGameKitAchievementUI(this));
-    const auto achievementField = achievement->GetRepresentation();
     const FString key = FString::FromInt(newAchievementCounter);
     this->achievements.Add(key, achievement);
     achievement->idString = key;
 
-    achievementsSection->AddSlot().Padding(0,1,0,1)[achievementField];
+    // New achievements are always shown, at the end of the list like before
+    this->filteredAchievements.Add(achievement);
+    if (achievementsSection.IsValid())
+    {
+        achievementsSection->RequestListRefresh();
+        achievementsSection->RequestScrollIntoView(achievement);
+    }
     this->newAchievementCounter += 1;
     return FReply::Handled();
 }
@@ -470,12 +671,19 @@ void AwsGameKitAchievementsLayoutDetails::ListAchievements()
 
     RefreshAchievementIconBaseUrl();
 
-    const auto Delegate = TAwsGameKitDelegate<const IntResult&, const TArray<AdminAchievement>&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnListAchievementsComplete);
+    // Only the latest listing is merged. All pages are listed in one call, which the backend serves with a parallel scan of the table.
+    const uint32 requestId = ++listRequestId;
+    const auto Delegate = TAwsGameKitDelegate<const IntResult&, const TArray<AdminAchievement>&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnListAchievementsComplete, requestId);
     AwsGameKitAchievementsAdmin::ListAchievementsForGame(Delegate);
 }
 
-void AwsGameKitAchievementsLayoutDetails::OnListAchievementsComplete(const IntResult& result, const TArray<AdminAchievement>& listedAchievements)
+void AwsGameKitAchievementsLayoutDetails::OnListAchievementsComplete(const IntResult& result, const TArray<AdminAchievement>& listedAchievements, uint32 requestId)
 {
+    if (requestId != listRequestId)
+    {
+        return;
+    }
+
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
         UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitAchievementsLayoutDetails::ListAchievements() didn't successfully get achievements."))
@@ -492,16 +700,72 @@ void AwsGameKitAchievementsLayoutDetails::OnListAchievementsComplete(const IntRe
     }
 
     syncError->SetVisibility(EVisibility::Hidden);
-    ProcessAchievements(listedAchievements, true);
+    MergeCloudAchievements(requestId, TArray<AdminAchievement>(listedAchievements));
+}
+
+void AwsGameKitAchievementsLayoutDetails::MergeCloudAchievements(uint32 requestId, TArray<AdminAchievement>&& listedAchievements)
+{
+    if (listedAchievements.Num() <= CLOUD_MERGE_SLICE)
+    {
+        ProcessAchievements(listedAchievements, true);
+        return;
+    }
+
+    // The first slice is merged right away, the others on the following ticks unless the window is closed or the achievements listed again
+    TSharedRef<TArray<AdminAchievement>> remaining = MakeShared<TArray<AdminAchievement>>(MoveTemp(listedAchievements));
+    TSharedRef<FJsonFileState, ESPMode::ThreadSafe> state = jsonFileState;
+    TSharedRef<int32> merged = MakeShared<int32>(0);
+    auto mergeSlice = [this, state, requestId, remaining, merged](float deltaTime) -> bool
+    {
+        if (!state->isOwnerAlive || requestId != listRequestId)
+        {
+            return false;
+        }
+
+        const int32 count = FMath::Min(CLOUD_MERGE_SLICE, remaining->Num() - *merged);
+        TArray<TSharedPtr<AwsGameKitAchievementUI>> addedAchievements;
+        MergeAchievements(TArray<AdminAchievement>(remaining->GetData() + *merged, count), true, &addedAchievements);
+        *merged += count;
+        if (*merged == remaining->Num())
+        {
+            FinishProcessingAchievements(true);
+            return false;
+        }
+
+        // Until the last slice the new rows are appended to the list unsorted, and the local achievements keep their status
+        for (const TSharedPtr<AwsGameKitAchievementUI>& achievement : addedAchievements)
+        {
+            if (PassesFilter(achievement))
+            {
+                filteredAchievements.Add(achievement);
+            }
+        }
+        if (achievementsSection.IsValid())
+        {
+            achievementsSection->RequestListRefresh();
+        }
+        return true;
+    };
+
+    if (mergeSlice(0.0f))
+    {
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(MoveTemp(mergeSlice)));
+    }
 }
 
 void AwsGameKitAchievementsLayoutDetails::ProcessAchievements(const TArray<AdminAchievement>& incomingAchievements, bool fromCloud)
+{
+    MergeAchievements(incomingAchievements, fromCloud);
+    FinishProcessingAchievements(fromCloud);
+}
+
+void AwsGameKitAchievementsLayoutDetails::MergeAchievements(const TArray<AdminAchievement>& incomingAchievements, bool fromCloud, TArray<TSharedPtr<AwsGameKitAchievementUI>>* addedAchievements)
 {
     for (const AdminAchievement adminAchievement : incomingAchievements)
     {
         TSharedPtr<AwsGameKitAchievementUI> achievement = MakeShareable(new AwsGameKitAchievementUI(this, adminAchievement));
 
-        const FString targetId = achievement->id->GetText().ToString();
+        const FString targetId = achievement->AchievementId;
         if (fromCloud)
         {
            TSharedPtr<AwsGameKitAchievementUI> cloudAch = MakeShareable(new AwsGameKitAchievementUI(this, adminAchievement));
@@ -511,8 +775,12 @@ void AwsGameKitAchievementsLayoutDetails::ProcessAchievements(const TArray<Admin
             {
                 TSharedPtr<AwsGameKitAchievementUI> local = *achievements.Find(targetId);
                 local->status = achievement->IsSynchronized(local) ? Synced::Synchronized : Synced::Unsynchronized;
-                local->lockedIconImg->SetEnabled(false);
-                local->unlockedIconImg->SetEnabled(false);
+                // Reload the icons from the cloud if the row is visible, otherwise they are loaded when it is generated
+                if (local->HasRepresentation())
+                {
+                    local->lockedIconImg->SetEnabled(false);
+                    local->unlockedIconImg->SetEnabled(false);
+                }
             }
             else
             {
@@ -520,6 +788,10 @@ void AwsGameKitAchievementsLayoutDetails::ProcessAchievements(const TArray<Admin
                 achievement->localLockedIcon = false;
                 achievement->localUnlockedIcon = false;
                 achievements.Add(targetId, achievement);
+                if (addedAchievements != nullptr)
+                {
+                    addedAchievements->Add(achievement);
+                }
             }
         }
         else
@@ -527,7 +799,10 @@ void AwsGameKitAchievementsLayoutDetails::ProcessAchievements(const TArray<Admin
             this->achievements.Add(targetId, achievement);
         }
     }
+}
 
+void AwsGameKitAchievementsLayoutDetails::FinishProcessingAchievements(bool fromCloud)
+{
     if (fromCloud)
     {
         for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>> achievement : achievements)
@@ -538,7 +813,7 @@ void AwsGameKitAchievementsLayoutDetails::ProcessAchievements(const TArray<Admin
             }
             else if (achievement.Value->status == Synced::Synchronized)
             {
-                achievement.Value->id->SetEnabled(false);
+                achievement.Value->IsIdEditable = false;
             }
         }
     }
@@ -551,45 +826,105 @@ void AwsGameKitAchievementsLayoutDetails::Repopulate()
 {
     if(achievementsSection.IsValid())
     {
-        achievementsSection->ClearChildren();
-
-        TArray<TSharedPtr<AwsGameKitAchievementUI>> achievementsArray;
-        achievements.GenerateValueArray(achievementsArray);
-
-        for (const TSharedPtr<AwsGameKitAchievementUI> achievement : achievementsArray)
+        for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>>& achievement : achievements)
         {
-            const FString id = achievement->id->GetText().ToString();
-
-            const FString lockedUrl = achievement->lockedIcon.Get()->GetText().ToString();
-            if (!lockedUrl.IsEmpty() && !achievement->lockedIconImg->IsEnabled() && !achievement->localLockedIcon)
-            {
-                this->imageDownloader->SetImageFromUrl(*achievementIconsBaseUrl + lockedUrl, achievement->lockedIconImg, 1);
-            }
-            const FString  unlockedUrl = achievement->unlockedIcon.Get()->GetText().ToString();
-            if (!unlockedUrl.IsEmpty() && !achievement->unlockedIconImg->IsEnabled() && !achievement->localUnlockedIcon)
+            if (achievement.Value->HasRepresentation())
             {
-                this->imageDownloader->SetImageFromUrl(*achievementIconsBaseUrl + unlockedUrl, achievement->unlockedIconImg, 1);
+                LoadAchievementIcons(achievement.Value);
             }
 
-            if (this->achievementsDeployed)
-            {
-                if (cloudSyncedAchievements.Contains(id))
-                {
-                    achievement->status = achievement->IsSynchronized(*cloudSyncedAchievements.Find(id)) ? Synced::Synchronized : Synced::Unsynchronized;
-                }
-                else
-                {
-                    achievement->status = Synced::Unsynchronized;
-                }
-            }
-
-            achievementsSection->AddSlot().Padding(0, 1, 0, 1)[achievement->GetRepresentation()];
+            UpdateSyncStatus(*achievement.Value);
         }
+
+        RefreshAchievementsList();
     }
 
     SaveStateToJsonFile();
 }
 
+void AwsGameKitAchievementsLayoutDetails::UpdateSyncStatus(AwsGameKitAchievementUI& achievement) const
+{
+    if (!this->achievementsDeployed)
+    {
+        return;
+    }
+
+    const TSharedPtr<AwsGameKitAchievementUI>* cloudAchievement = cloudSyncedAchievements.Find(achievement.AchievementId);
+    achievement.status = cloudAchievement != nullptr && achievement.IsSynchronized(*cloudAchievement) ? Synced::Synchronized : Synced::Unsynchronized;
+}
+
+void AwsGameKitAchievementsLayoutDetails::RefreshAchievementsList()
+{
+    filteredAchievements.Reset(achievements.Num());
+    for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>>& achievement : achievements)
+    {
+        if (PassesFilter(achievement.Value))
+        {
+            filteredAchievements.Add(achievement.Value);
+        }
+    }
+
+    if (achievementsSection.IsValid())
+    {
+        achievementsSection->RequestListRefresh();
+    }
+}
+
+bool AwsGameKitAchievementsLayoutDetails::PassesFilter(const TSharedPtr<AwsGameKitAchievementUI>& achievement) const
+{
+    if (achievement->markedForDeletion)
+    {
+        return false;
+    }
+
+    return achievementsFilter.IsEmpty() ||
+        achievement->AchievementId.Contains(achievementsFilter) ||
+        achievement->Title.Contains(achievementsFilter);
+}
+
+void AwsGameKitAchievementsLayoutDetails::LoadAchievementIcons(const TSharedPtr<AwsGameKitAchievementUI>& achievement)
+{
+    const FString& lockedUrl = achievement->LockedIcon;
+    if (!lockedUrl.IsEmpty() && !achievement->lockedIconImg->IsEnabled() && !achievement->localLockedIcon)
+    {
+        this->imageDownloader->SetImageFromUrl(*achievementIconsBaseUrl + lockedUrl, achievement->lockedIconImg, 1);
+    }
+    const FString& unlockedUrl = achievement->UnlockedIcon;
+    if (!unlockedUrl.IsEmpty() && !achievement->unlockedIconImg->IsEnabled() && !achievement->localUnlockedIcon)
+    {
+        this->imageDownloader->SetImageFromUrl(*achievementIconsBaseUrl + unlockedUrl, achievement->unlockedIconImg, 1);
+    }
+}
+
+TSharedRef<ITableRow> AwsGameKitAchievementsLayoutDetails::OnGenerateAchievementRow(TSharedPtr<AwsGameKitAchievementUI> achievement, const TSharedRef<STableViewBase>& ownerTable)
+{
+    // Widgets and icons are only created for rows which scroll into view
+    const TSharedRef<SScrollBox> representation = achievement->GetRepresentation();
+    LoadAchievementIcons(achievement);
+
+    TSharedRef<STableRow<TSharedPtr<AwsGameKitAchievementUI>>> row = SNew(STableRow<TSharedPtr<AwsGameKitAchievementUI>>, ownerTable)
+        .Padding(FMargin(0, 1, 0, 1))
+        .ShowSelection(false)
+        [
+            representation
+        ];
+
+    generatedRows.Add(&row.Get(), achievement);
+    return row;
+}
+
+void AwsGameKitAchievementsLayoutDetails::OnAchievementRowReleased(const TSharedRef<ITableRow>& row)
+{
+    TWeakPtr<AwsGameKitAchievementUI> released;
+    if (generatedRows.RemoveAndCopyValue(&row.Get(), released))
+    {
+        if (TSharedPtr<AwsGameKitAchievementUI> achievement = released.Pin())
+        {
+            achievement->ReleaseRepresentation();
+        }
+    }
+}
+
 void AwsGameKitAchievementsLayoutDetails::SortAchievements()
 {
     const auto sortAlg = [](const TSharedPtr<AwsGameKitAchievementUI>& first, const TSharedPtr<AwsGameKitAchievementUI>& second) -> bool
@@ -598,7 +933,7 @@ void AwsGameKitAchievementsLayoutDetails::SortAchievements()
         const int32 secondNum = second->SortOrder;
         if (firstNum == secondNum)
         {
-            return first->id->GetText().CompareTo(second->id->GetText()) < 1;
+            return first->AchievementId.Compare(second->AchievementId) < 0;
         }
         return firstNum < secondNum;
     };
@@ -612,15 +947,16 @@ FReply AwsGameKitAchievementsLayoutDetails::UploadAchievements()
     DeleteAchievementsRequest deleteStruct;
     for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>> achievement : achievements)
     {
-        if (!achievement.Value->id->GetText().IsEmpty())
+        if (!achievement.Value->AchievementId.IsEmpty())
         {
             if (achievement.Value->markedForDeletion)
             {
-                FString text = achievement.Value->id->GetText().ToString();
-                deleteStruct.achievementIdentifiers.Add(text);
+                deleteStruct.achievementIdentifiers.Add(achievement.Value->AchievementId);
             }
-            else if (achievement.Value->status != Synced::Synchronized)
+            else if (!cloudSyncedAchievements.Contains(achievement.Value->AchievementId) ||
+                SerializeForSync(achievement.Value) != SerializeForSync(cloudSyncedAchievements[achievement.Value->AchievementId]))
             {
+                // Only send what changed since the last time the achievements were listed from the cloud
                 AdminAchievement ach;
                 achievement.Value->ToAchievement(ach);
                 updateStruct.achievements.Add(ach);
@@ -638,8 +974,9 @@ FReply AwsGameKitAchievementsLayoutDetails::UploadAchievements()
         }
         else
         {
+            const auto BatchDelegate = TAwsGameKitDelegate<const AchievementsBatchProgress&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnUploadBatchComplete);
             const auto DeleteDelegate = TAwsGameKitDelegate<const IntResult&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnDeleteAchievementsComplete);
-            AwsGameKitAchievementsAdmin::DeleteAchievementsForGame(deleteStruct, DeleteDelegate);
+            AwsGameKitAchievementsAdmin::DeleteAchievementsForGameInBatches(deleteStruct, BatchDelegate, DeleteDelegate);
         }
 
         if (updateStruct.achievements.Num() == 0)
@@ -648,8 +985,9 @@ FReply AwsGameKitAchievementsLayoutDetails::UploadAchievements()
         }
         else
         {
+            const auto BatchDelegate = TAwsGameKitDelegate<const AchievementsBatchProgress&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnUploadBatchComplete);
             const auto AddDelegate = TAwsGameKitDelegate<const IntResult&>::CreateRaw(this, &AwsGameKitAchievementsLayoutDetails::OnAddAchievementsComplete);
-            AwsGameKitAchievementsAdmin::AddAchievementsForGame(updateStruct, AddDelegate);
+            AwsGameKitAchievementsAdmin::AddAchievementsForGameInBatches(updateStruct, BatchDelegate, AddDelegate);
         }
     }
     else
@@ -697,6 +1035,28 @@ void AwsGameKitAchievementsLayoutDetails::OnDeleteAchievementsComplete(const Int
     this->saveButtonText->SetText(SAVE_BUTTON_TEXT);
 }
 
+void AwsGameKitAchievementsLayoutDetails::OnUploadBatchComplete(const AchievementsBatchProgress& progress)
+{
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievementsLayoutDetails::OnUploadBatchComplete() %d/%d batches, %d/%d achievements."),
+        progress.completedBatches, progress.totalBatches, progress.completedAchievements, progress.totalAchievements);
+    this->saveButtonText->SetText(FText::Format(LOCTEXT("AchievementsSavingBatchProgress", "Saving {0}/{1} ..."), progress.completedAchievements, progress.totalAchievements));
+}
+
+FString AwsGameKitAchievementsLayoutDetails::SerializeForSync(const TSharedPtr<AwsGameKitAchievementUI>& achievement)
+{
+    TSharedPtr<FJsonObject> achObject = MakeShareable(new FJsonObject);
+    achievement->ToJsonObject(achObject);
+
+    // Whether the icons are local files is editor state, a local icon path already differs from its cloud url
+    achObject->RemoveField("local_locked_icon");
+    achObject->RemoveField("local_unlocked_icon");
+
+    FString output;
+    const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&output);
+    FJsonSerializer::Serialize(achObject.ToSharedRef(), writer);
+    return output;
+}
+
 FReply AwsGameKitAchievementsLayoutDetails::GetJsonTemplate()
 {
     const FString pluginBaseDir = IPluginManager::Get().FindPlugin("AwsGameKit")->GetBaseDir();
@@ -741,13 +1101,75 @@ void AwsGameKitAchievementsLayoutDetails::LoadAchievementsFromJsonFile(const FSt
         return;
     }
 
-    FString fileContents;
-    FFileHelper::LoadFileToString(fileContents, *fileName);
+    // Only the latest load is applied
+    const uint32 requestId = ++jsonLoadRequestId;
+    TSharedRef<FJsonFileState, ESPMode::ThreadSafe> state = jsonFileState;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, state, requestId, fileName]()
+    {
+        AWSGAMEKIT_LLM_SCOPE(Achievements);
+        FString fileContents;
+        FFileHelper::LoadFileToString(fileContents, *fileName);
+
+        TArray<AdminAchievement> output;
+        const bool parsed = ReadAchievementsJson(fileContents, output, [this, state](int32 read)
+        {
+            AsyncTask(ENamedThreads::GameThread, [this, state, read]()
+            {
+                if (state->isOwnerAlive)
+                {
+                    ReportJsonProgress(FText::Format(LOCTEXT("AchievementsImportProgress", "Importing {0} ..."), read));
+                }
+            });
+        });
+        if (!parsed)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitAchievementsLayoutDetails::LoadAchievementsFromJsonFile(): Could not parse %s, %d achievements read."), *fileName, output.Num());
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [this, state, requestId, output = MoveTemp(output)]() mutable
+        {
+            if (state->isOwnerAlive)
+            {
+                OnJsonFileLoaded(requestId, MoveTemp(output));
+            }
+        });
+    });
+}
+
+void AwsGameKitAchievementsLayoutDetails::OnJsonFileLoaded(uint32 requestId, TArray<AdminAchievement>&& loadedAchievements)
+{
+    if (loadedAchievements.Num() >= JSON_PROGRESS_INTERVAL)
+    {
+        ReportJsonProgress(SAVE_BUTTON_TEXT);
+    }
+
+    if (requestId != jsonLoadRequestId)
+    {
+        return;
+    }
 
     achievements.Empty();
-    TArray<AdminAchievement> output;
-    AwsGameKitAchievementsAdmin::GetListOfAdminAchievementsFromResponse(output, fileContents, false);
-    ProcessAchievements(output);
+    ProcessAchievements(loadedAchievements);
+
+    // The cloud achievements may have been listed while the file was read, merge them again
+    if (cloudSyncedAchievements.Num() > 0)
+    {
+        TArray<AdminAchievement> listedAchievements;
+        listedAchievements.Reserve(cloudSyncedAchievements.Num());
+        for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>>& cloudAchievement : cloudSyncedAchievements)
+        {
+            cloudAchievement.Value->ToAchievement(listedAchievements.AddDefaulted_GetRef());
+        }
+        ProcessAchievements(listedAchievements, true);
+    }
+}
+
+void AwsGameKitAchievementsLayoutDetails::ReportJsonProgress(const FText& progress)
+{
+    if (configWindowOpen && saveButtonText.IsValid())
+    {
+        saveButtonText->SetText(progress);
+    }
 }
 
 FReply AwsGameKitAchievementsLayoutDetails::ExportJson()
@@ -764,29 +1186,75 @@ FReply AwsGameKitAchievementsLayoutDetails::ExportJson()
 
 void AwsGameKitAchievementsLayoutDetails::SaveStateToJsonFile(const FString& fileName)
 {
-    const TSharedPtr<FJsonObject> jsonObject = MakeShareable(new FJsonObject);
-    TArray<TSharedPtr<FJsonValue>> achievementObjects;
-
-    for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>> achievement : achievements)
+    // Plain copies of the achievements, serialized on a worker
+    TArray<AdminAchievement> savedAchievements;
+    savedAchievements.Reserve(achievements.Num());
+    for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>>& achievement : achievements)
     {
-        if (achievement.Value->markedForDeletion)
+        if (!achievement.Value->markedForDeletion)
         {
-            continue;
+            achievement.Value->ToAchievement(savedAchievements.AddDefaulted_GetRef());
         }
+    }
 
-        TSharedPtr<FJsonObject> achObject = MakeShareable(new FJsonObject);
-        achievement.Value->ToJsonObject(achObject);
+    pendingJsonWrites.RemoveAll([](const TFuture<void>& pendingWrite) { return pendingWrite.IsReady(); });
 
-        TSharedRef<FJsonValueObject> jsonValue = MakeShareable(new FJsonValueObject(achObject));
-        achievementObjects.Add(jsonValue);
+    TSharedRef<FJsonFileState, ESPMode::ThreadSafe> state = jsonFileState;
+    uint32 writeId;
+    {
+        FScopeLock lock(&state->writeMutex);
+        writeId = ++state->lastRequestedWrite;
     }
-    jsonObject->SetArrayField("achievements", achievementObjects);
 
-    FString output;
-    const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> writer = TJsonWriterFactory<>::Create(&output);
-    FJsonSerializer::Serialize(jsonObject.ToSharedRef(), writer);
+    pendingJsonWrites.Add(Async(EAsyncExecution::ThreadPool, [this, state, writeId, fileName, savedAchievements = MoveTemp(savedAchievements)]()
+    {
+        AWSGAMEKIT_LLM_SCOPE(Achievements);
+        const bool showProgress = savedAchievements.Num() >= JSON_PROGRESS_INTERVAL;
+        FString output;
+        WriteAchievementsJson(savedAchievements, output, [this, state, showProgress, total = savedAchievements.Num()](int32 written)
+        {
+            if (!showProgress)
+            {
+                return;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [this, state, written, total]()
+            {
+                if (state->isOwnerAlive)
+                {
+                    ReportJsonProgress(FText::Format(LOCTEXT("AchievementsExportProgress", "Exporting {0}/{1} ..."), written, total));
+                }
+            });
+        });
+
+        {
+            // Written next to the file and moved over it, so that a reader never sees a partial file
+            FScopeLock lock(&state->writeMutex);
+            if (writeId > state->lastCommittedWrite)
+            {
+                const FString tempFileName = fileName + TEXT(".tmp");
+                if (FFileHelper::SaveStringToFile(output, *tempFileName) && IFileManager::Get().Move(*fileName, *tempFileName, true))
+                {
+                    state->lastCommittedWrite = writeId;
+                }
+                else
+                {
+                    UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitAchievementsLayoutDetails::SaveStateToJsonFile(): Could not write %s"), *fileName);
+                }
+            }
+        }
 
-    FFileHelper::SaveStringToFile(output, *fileName);
+        if (showProgress)
+        {
+            AsyncTask(ENamedThreads::GameThread, [this, state]()
+            {
+                if (state->isOwnerAlive)
+                {
+                    ReportJsonProgress(SAVE_BUTTON_TEXT);
+                }
+            });
+        }
+    }));
 }
 
 void  AwsGameKitAchievementsLayoutDetails::SetCloudActionButtonState()
@@ -815,7 +1283,7 @@ bool AwsGameKitAchievementsLayoutDetails::IsSaveDataToCloudEnabled() const
 
     for (const TPair<FString, TSharedPtr<AwsGameKitAchievementUI>> achievement : achievements)
     {
-        if (achievement.Value->id->GetText().IsEmpty() && !achievement.Value->markedForDeletion)
+        if (achievement.Value->AchievementId.IsEmpty() && !achievement.Value->markedForDeletion)
         {
             return false;
         }
@@ -20,7 +20,9 @@
 #include "DesktopPlatform/Public/DesktopPlatformModule.h"
 #include "DetailCategoryBuilder.h"
 #include "DetailLayoutBuilder.h"
+#include "DirectoryWatcherModule.h"
 #include "Framework/Docking/TabManager.h"
+#include "IDirectoryWatcher.h"
 #include "IDetailGroup.h"
 #include "Interfaces/IPluginManager.h"
 #include "ISettingsModule.h"
@@ -106,7 +108,12 @@ AwsGameKitCredentialsLayoutDetails::~AwsGameKitCredentialsLayoutDetails()
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitCredentialsLayoutDetails::~AwsGameKitCredentialsLayoutDetails()"));
 
     // Unregister timer callback
-    projectNameTextBox->UnRegisterActiveTimer(projectNameTimerHandle.ToSharedRef());
+    if (projectNameTimerHandle.IsValid() && projectNameTextBox.IsValid())
+    {
+        projectNameTextBox->UnRegisterActiveTimer(projectNameTimerHandle.ToSharedRef());
+    }
+
+    UnwatchInstanceDirectory();
 }
 
 TSharedRef<IDetailCustomization> AwsGameKitCredentialsLayoutDetails::MakeInstance(FAwsGameKitEditorModule* editorModule)
@@ -841,8 +848,8 @@ void AwsGameKitCredentialsLayoutDetails::CustomizeDetails(IDetailLayoutBuilder&
         ]
     ];
 
-    // Bind project name state transition callback
-    projectNameTimerHandle = projectNameTextBox->RegisterActiveTimer(configFileCheckDelay, FWidgetActiveTimerDelegate::CreateRaw(this, &AwsGameKitCredentialsLayoutDetails::ProjectNameStateTransitionCallback));
+    // The project name is checked when it's edited or when the instance files change, see ScheduleProjectNameCheck()
+    WatchInstanceDirectory();
 
     SetInitialState();
 }
@@ -1185,12 +1192,20 @@ void AwsGameKitCredentialsLayoutDetails::RetrieveAccountId(const FString& access
 {
     TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
 
+    // Show the account id these credentials had in a previous session while they are validated again
+    const FString cachedAccountId = featureResourceManager->GetCachedAccountId(accessKey, secretKey);
+    if (!cachedAccountId.IsEmpty())
+    {
+        accountIdText = FText::FromString(cachedAccountId);
+    }
+
     accountLoadingAnimationBox->SetVisibility(EVisibility::Visible);
     AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [&, accessKey, secretKey, featureResourceManager]()
     {
-        const FString accountId = featureResourceManager->GetAccountId(TCHAR_TO_UTF8(*accessKey), TCHAR_TO_UTF8(*secretKey));
+        FeatureResourceManager::EAccountIdFailure failure;
+        const FString accountId = featureResourceManager->GetAccountId(TCHAR_TO_UTF8(*accessKey), TCHAR_TO_UTF8(*secretKey), &failure);
 
-        AsyncTask(ENamedThreads::GameThread, [&, accountId]()
+        AsyncTask(ENamedThreads::GameThread, [&, accountId, failure]()
             {
                 if (!accountId.IsEmpty())
                 {
@@ -1199,6 +1214,15 @@ void AwsGameKitCredentialsLayoutDetails::RetrieveAccountId(const FString& access
                     accessKeyValidation->SetVisibility(EVisibility::Collapsed);
                     secretKeyValidation->SetVisibility(EVisibility::Collapsed);
                 }
+                else if (failure == FeatureResourceManager::EAccountIdFailure::Unreachable)
+                {
+                    // The keys may well be valid, don't flag them
+                    accountIdText = FText::FromString(AWS_ACCOUNT_ID_EMPTY);
+                    submitValidationText = LOCTEXT("AWSCredentialsNotReachable", "AWS could not be reached to validate the credentials. Check the network connection and try again.");
+                    submitValidation->SetVisibility(EVisibility::Visible);
+                    accessKeyValidation->SetVisibility(EVisibility::Collapsed);
+                    secretKeyValidation->SetVisibility(EVisibility::Collapsed);
+                }
                 else
                 {
                     accountIdText = FText::FromString(AWS_ACCOUNT_ID_EMPTY);
@@ -1362,8 +1386,7 @@ void AwsGameKitCredentialsLayoutDetails::OnProjectNameTextChanged(const FText& f
     if (IsGameNameValid(projectName))
     {
         // Delay the config file check to allow game name changes without excessive logging
-        configFileFieldChangedValid = true;
-        nextConfigFileCheckTimestamp = FPlatformTime::Seconds() + configFileCheckDelay;
+        ScheduleProjectNameCheck();
     }
     else
     {
@@ -1375,11 +1398,82 @@ void AwsGameKitCredentialsLayoutDetails::OnProjectNameTextChanged(const FText& f
     projectNameValidation->SetVisibility(fieldValidationVisibility);
 }
 
+void AwsGameKitCredentialsLayoutDetails::ScheduleProjectNameCheck()
+{
+    configFileFieldChangedValid = true;
+    nextConfigFileCheckTimestamp = FPlatformTime::Seconds() + configFileCheckDelay;
+
+    // Only one timer at a time, it stops itself once the check ran
+    if (!projectNameTimerHandle.IsValid() && projectNameTextBox.IsValid())
+    {
+        projectNameTimerHandle = projectNameTextBox->RegisterActiveTimer(configFileCheckDelay, FWidgetActiveTimerDelegate::CreateRaw(this, &AwsGameKitCredentialsLayoutDetails::ProjectNameStateTransitionCallback));
+    }
+}
+
+void AwsGameKitCredentialsLayoutDetails::WatchInstanceDirectory()
+{
+    UnwatchInstanceDirectory();
+
+    const FString& gamekitRoot = editorModule->GetFeatureResourceManager()->GetRootPath();
+    if (gamekitRoot.IsEmpty() || !IFileManager::Get().DirectoryExists(*gamekitRoot))
+    {
+        return;
+    }
+
+    IDirectoryWatcher* directoryWatcher = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")).Get();
+    if (directoryWatcher != nullptr && directoryWatcher->RegisterDirectoryChangedCallback_Handle(gamekitRoot,
+        IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &AwsGameKitCredentialsLayoutDetails::OnInstanceDirectoryChanged),
+        instanceDirectoryWatcherHandle, IDirectoryWatcher::WatchOptions::IncludeDirectoryChanges))
+    {
+        watchedInstanceDirectory = gamekitRoot;
+    }
+}
+
+void AwsGameKitCredentialsLayoutDetails::UnwatchInstanceDirectory()
+{
+    if (!instanceDirectoryWatcherHandle.IsValid())
+    {
+        return;
+    }
+
+    // The module may already be unloaded when the editor shuts down
+    if (FDirectoryWatcherModule* directoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+    {
+        if (IDirectoryWatcher* directoryWatcher = directoryWatcherModule->Get())
+        {
+            directoryWatcher->UnregisterDirectoryChangedCallback_Handle(watchedInstanceDirectory, instanceDirectoryWatcherHandle);
+        }
+    }
+    instanceDirectoryWatcherHandle.Reset();
+    watchedInstanceDirectory.Empty();
+}
+
+void AwsGameKitCredentialsLayoutDetails::OnInstanceDirectoryChanged(const TArray<FFileChangeData>& fileChanges)
+{
+    // Nothing to refresh once the project name is submitted and hidden
+    if (!projectNameTextBox.IsValid() || projectNameBox->GetVisibility() == EVisibility::Collapsed || !IsGameNameValid(projectNameTextBox->GetText().ToString()))
+    {
+        return;
+    }
+
+    for (const FFileChangeData& fileChange : fileChanges)
+    {
+        // A new or removed game directory, or one of the saveInfo.yml files listing the environments
+        if (fileChange.Filename.EndsWith(TEXT("saveInfo.yml")) || FPaths::GetPath(fileChange.Filename).Equals(watchedInstanceDirectory))
+        {
+            UE_LOG(LogAwsGameKit, Verbose, TEXT("AwsGameKitCredentialsLayoutDetails::OnInstanceDirectoryChanged(): %s changed"), *fileChange.Filename);
+            ScheduleProjectNameCheck();
+            return;
+        }
+    }
+}
+
 EActiveTimerReturnType AwsGameKitCredentialsLayoutDetails::ProjectNameStateTransitionCallback(double inCurrentTime, float inDeltaTime)
 {
     if (!configFileFieldChangedValid)
     {
-        return EActiveTimerReturnType::Continue;
+        projectNameTimerHandle.Reset();
+        return EActiveTimerReturnType::Stop;
     }
 
     if (nextConfigFileCheckTimestamp <= inCurrentTime)
@@ -1397,12 +1491,12 @@ EActiveTimerReturnType AwsGameKitCredentialsLayoutDetails::ProjectNameStateTrans
         {
             SetInitialState();
         }
-    }
-    else
-    {
-        UE_LOG(LogAwsGameKit, Verbose, TEXT("%f Skipping project name check, not enough time has passed"), inCurrentTime);
+
+        projectNameTimerHandle.Reset();
+        return EActiveTimerReturnType::Stop;
     }
 
+    UE_LOG(LogAwsGameKit, Verbose, TEXT("%f Skipping project name check, not enough time has passed"), inCurrentTime);
     return EActiveTimerReturnType::Continue;
 }
 
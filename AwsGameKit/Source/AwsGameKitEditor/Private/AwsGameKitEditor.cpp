@@ -12,6 +12,7 @@
 #include "AwsGameKitSettings.h"
 #include "AwsGameKitSettingsLayoutDetails.h"
 #include "AwsGameKitStyleSet.h"
+#include "Core/AwsGameKitMemory.h"
 #include "EditorState.h"
 #include "FeatureResourceManager.h"
 #include "GameSaving/EditorGameSavingFeatureExample.h"
@@ -80,6 +81,7 @@ TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> FAwsGameKitEditorModule::GetMe
 
 void FAwsGameKitEditorModule::StartupModule()
 {
+    AWSGAMEKIT_LLM_SCOPE(Core);
     UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitEditorModule::StartupModule()"));
     FPropertyEditorModule& propertyModule = FModuleManager::GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
 
@@ -121,72 +123,120 @@ void FAwsGameKitEditorModule::StartupModule()
 void FAwsGameKitEditorModule::BootstrapExistingState()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitEditorModule::BootstrapExistingState()"));
-    const FString& projectRoot = this->featureResourceManager->GetRootPath();
-    TArray<FString> saveInfoFiles;
-    IFileManager::Get().FindFilesRecursive(saveInfoFiles, *projectRoot, TEXT("saveInfo.yml"), true, false, true);
+    const FString saveInfoFile = this->featureResourceManager->FindSaveInfoFile();
 
-    if (saveInfoFiles.Num() > 0)
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, saveInfoFile]()
     {
-        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, saveInfoFiles]()
+        if (!saveInfoFile.IsEmpty())
         {
-            // Wrap this in a try because there are many things that could go wrong:
-            // * saveInfo.yml corrupted (manual editing?)
-            // * GetAccountId() failed with no network connection
-            // * accessKey/secretKey removed from ~/.aws/credentials
-            try
-            {
-                // Extract the game name from the saveInfo.yml file path; it should be the directory name directly above it.
-                FString gameName = FPaths::GetPathLeaf(FPaths::GetPath(saveInfoFiles[0]));
-
-                // Set the game name, sparking the feature resource manager to reload settings.
-                // Dev environment and auxilliary settings will be loaded; do not read feature specific settings until the correct environment is specified later.
-                this->featureResourceManager->SetGameName(gameName);
-
-                AccountDetails accountDetails;
-                accountDetails.gameName = gameName;
-                accountDetails.environment = this->featureResourceManager->GetLastUsedEnvironment();
-                accountDetails.region = this->featureResourceManager->GetLastUsedRegion();
-
-                // Initialize our credentials manager
-                this->credentialsManager->SetGameName(accountDetails.gameName);
-                this->credentialsManager->SetEnv(accountDetails.environment);
-
-                // Credentials are loaded from {userDocumentsDir}/../.aws/credentials
-                accountDetails.accessKey = this->credentialsManager->GetAccessKey();
-                accountDetails.accessSecret = this->credentialsManager->GetSecretKey();
-                accountDetails.accountId = this->featureResourceManager->GetAccountId(accountDetails.accessKey, accountDetails.accessSecret);
-
-                // Ensure we have the information necessary before initializing FeatureResourceManager
-                if (accountDetails.accessKey.IsEmpty() || accountDetails.accessSecret.IsEmpty() || accountDetails.accountId.IsEmpty() || accountDetails.region.IsEmpty())
-                {
-                    throw std::runtime_error("Existing state lacking complete AWS credentials.");
-                }
-
-                // Triggers a settings reload, ensuring all features are initialized with the proper settings for the last used environment
-                this->featureResourceManager->SetAccountDetails(accountDetails);
-
-                // Store credentials and mark as submitted
-                this->editorState->SetCredentials(accountDetails);
-                this->editorState->SetCredentialState(true);
-
-                // Ensure account has been bootstrapped
-                this->featureResourceManager->BootstrapAccount();
-
-                // Tell runtime module to reload the config file for the last used environment
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                runtimeModule->ReloadConfigFile(this->featureResourceManager->GetClientConfigSubdirectory());
-
-                // "Prime the pump" with our feature statuses
-                this->featureControlCenter->RefreshFeatureStatuses();
-            }
-            catch (const std::exception& e)
-            {
-                UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitEditorModule::BootstrapExistingState() failed: %s"), *FString(ANSI_TO_TCHAR(e.what())));
-            }
-        });
+            this->BootstrapFromSaveInfoFile(saveInfoFile);
+            return;
+        }
+
+        // Neither the last used game nor the usual layout has settings; fall back to scanning the whole project, off the game thread
+        TArray<FString> saveInfoFiles;
+        IFileManager::Get().FindFilesRecursive(saveInfoFiles, *this->featureResourceManager->GetRootPath(), TEXT("saveInfo.yml"), true, false, true);
+        if (saveInfoFiles.Num() > 0)
+        {
+            this->BootstrapFromSaveInfoFile(saveInfoFiles[0]);
+        }
+    });
+}
+
+void FAwsGameKitEditorModule::BootstrapFromSaveInfoFile(const FString& saveInfoFile)
+{
+    // Wrap this in a try because there are many things that could go wrong:
+    // * saveInfo.yml corrupted (manual editing?)
+    // * GetAccountId() failed with no network connection
+    // * accessKey/secretKey removed from ~/.aws/credentials
+    try
+    {
+        // Extract the game name from the saveInfo.yml file path; it should be the directory name directly above it.
+        FString gameName = FPaths::GetPathLeaf(FPaths::GetPath(saveInfoFile));
+
+        // Set the game name, sparking the feature resource manager to reload settings.
+        // Dev environment and auxilliary settings will be loaded; do not read feature specific settings until the correct environment is specified later.
+        this->featureResourceManager->SetGameName(gameName);
+
+        AccountDetails accountDetails;
+        accountDetails.gameName = gameName;
+        accountDetails.environment = this->featureResourceManager->GetLastUsedEnvironment();
+        accountDetails.region = this->featureResourceManager->GetLastUsedRegion();
+
+        // Initialize our credentials manager
+        this->credentialsManager->SetGameName(accountDetails.gameName);
+        this->credentialsManager->SetEnv(accountDetails.environment);
+
+        // Credentials are loaded from {userDocumentsDir}/../.aws/credentials
+        accountDetails.accessKey = this->credentialsManager->GetAccessKey();
+        accountDetails.accessSecret = this->credentialsManager->GetSecretKey();
+
+        // Restore the state with the account id validated in a previous session if there is one, so a slow or missing network doesn't hold it up
+        accountDetails.accountId = this->featureResourceManager->GetCachedAccountId(accountDetails.accessKey, accountDetails.accessSecret);
+        const bool isAccountIdCached = !accountDetails.accountId.IsEmpty();
+        if (!isAccountIdCached)
+        {
+            accountDetails.accountId = this->featureResourceManager->GetAccountId(accountDetails.accessKey, accountDetails.accessSecret);
+        }
+
+        // Ensure we have the information necessary before initializing FeatureResourceManager
+        if (accountDetails.accessKey.IsEmpty() || accountDetails.accessSecret.IsEmpty() || accountDetails.accountId.IsEmpty() || accountDetails.region.IsEmpty())
+        {
+            throw std::runtime_error("Existing state lacking complete AWS credentials.");
+        }
+
+        // Triggers a settings reload, ensuring all features are initialized with the proper settings for the last used environment
+        this->featureResourceManager->SetAccountDetails(accountDetails);
+
+        // Store credentials and mark as submitted
+        this->editorState->SetCredentials(accountDetails);
+        this->editorState->SetCredentialState(true);
+
+        // Ensure account has been bootstrapped
+        this->featureResourceManager->BootstrapAccount();
+
+        // Tell runtime module to reload the config file for the last used environment
+        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+        runtimeModule->ReloadConfigFile(this->featureResourceManager->GetClientConfigSubdirectory());
+
+        // "Prime the pump" with our feature statuses
+        this->featureControlCenter->RefreshFeatureStatuses();
+
+        if (isAccountIdCached)
+        {
+            this->RevalidateAccountId(accountDetails);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitEditorModule::BootstrapExistingState() failed: %s"), *FString(ANSI_TO_TCHAR(e.what())));
     }
 }
 
+void FAwsGameKitEditorModule::RevalidateAccountId(const AccountDetails& accountDetails)
+{
+    FeatureResourceManager::EAccountIdFailure failure;
+    const FString accountId = this->featureResourceManager->GetAccountId(accountDetails.accessKey, accountDetails.accessSecret, &failure);
+    if (accountId == accountDetails.accountId)
+    {
+        return;
+    }
+
+    if (failure == FeatureResourceManager::EAccountIdFailure::Unreachable)
+    {
+        // Keep the credentials submitted, they are validated again the next time the editor starts
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitEditorModule::RevalidateAccountId(): Could not reach AWS to validate the saved credentials for account %s."), *accountDetails.accountId);
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitEditorModule::RevalidateAccountId(): The saved AWS credentials are no longer valid for account %s, they must be submitted again."), *accountDetails.accountId);
+    AsyncTask(ENamedThreads::GameThread, [this]()
+    {
+        this->editorState->SetCredentialState(false);
+        this->messageEndpoint->Publish<FMsgCredentialsState>(new FMsgCredentialsState{ false });
+    });
+}
+
 void FAwsGameKitEditorModule::ShutdownModule()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitEditorModule::ShutdownModule()"));
@@ -20,7 +20,11 @@
 #include "DetailLayoutBuilder.h"
 #include "MessageEndpointBuilder.h"
 #include "PropertyCustomizationHelpers.h"
+#include "Async/ParallelFor.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/ScopeLock.h"
 #include "Runtime/Core/Public/Async/Async.h"
 #include "Styling/SlateStyle.h"
 #include "Styling/SlateStyleRegistry.h"
@@ -31,8 +35,11 @@
 #include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSplitter.h"
+#include "Widgets/SOverlay.h"
 #include "Widgets/Text/SRichTextBlock.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
 
 #define LOCTEXT_NAMESPACE "AwsGameKitFeatureControlCenter"
 
@@ -110,6 +117,16 @@ TMap<FString, FString> DefaultValuesForFeature(FeatureType feature)
 {
     TMap<FString, FString> valuesMap;
     valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED, "true");
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_RUNTIME, AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_RUNTIME);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_ARCHITECTURE, AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_ARCHITECTURE);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_MEMORY_SIZE, AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_MEMORY_SIZE);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY, AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_PROVISIONED_CONCURRENCY);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_MIN_CAPACITY, AwsGameKitFeatureLayoutDetails::DefaultDynamoDbMinCapacity(feature));
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_MAX_CAPACITY, AwsGameKitFeatureLayoutDetails::DefaultDynamoDbMaxCapacity(feature));
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_TARGET_UTILIZATION, AwsGameKitFeatureLayoutDetails::DEFAULT_DYNAMODB_TARGET_UTILIZATION);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_MIN_CAPACITY, AwsGameKitFeatureLayoutDetails::DEFAULT_DYNAMODB_SCHEDULED_MIN_CAPACITY);
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_SCALING_START, "");
+    valuesMap.Add(AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_SCALING_END, "");
     switch (feature)
     {
     case FeatureType::Identity:
@@ -131,10 +148,7 @@ FReply AwsGameKitFeatureControlCenter::CreateOrUpdateResources(FeatureType featu
 
     // Ensure if we are deploying before configuring this feature,
     //  we have the default values set in featureResourceManager
-    for (TPair<FString, FString> defaultValues : DefaultValuesForFeature(feature))
-    {
-        featureResourceManager->SetFeatureVariableIfUnset(feature, defaultValues.Key, defaultValues.Value);
-    }
+    featureResourceManager->SetFeatureVariablesIfUnset(feature, DefaultValuesForFeature(feature));
 
     AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
         [feature, featureResourceManager, this]()
@@ -153,15 +167,18 @@ FReply AwsGameKitFeatureControlCenter::CreateOrUpdateResources(FeatureType featu
     return FReply::Handled();
 }
 
-void AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature)
+bool AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature)
 {
-    ConditionallyCreateOrUpdateFeatureResources(featureResourceManager, feature, feature);
+    return ConditionallyCreateOrUpdateFeatureResources(featureResourceManager, feature, feature);
 }
 
-void AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature, FeatureType featureTypeStatusOverride)
+bool AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature, FeatureType featureTypeStatusOverride)
 {
     IntResult result;
 
+    // Preparing the deployment only uses local files and S3 uploads, it overlaps with the stack updates of the other features being deployed
+    FScopeLock preparationLock(&featureDeployPreparationMutex);
+
     // Check if the feature's been deployed. If not, copy the base templates to the instance
     const std::string stackStatus = featureResourceManager->GetResourcesStackStatus(feature);
 
@@ -169,21 +186,21 @@ void AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources
     if (stackStatus == FeatureResourceManager::WORKING_STATUS_TEXT)
     {
         AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString("The AWS resources for this game feature are currently being updated by another user."));
-        featureStatusMessage.FindOrAdd(featureTypeStatusOverride) = FString(stackStatus.c_str());
-        return;
+        SetFeatureStatusMessage(featureTypeStatusOverride, stackStatus);
+        return false;
     }
 
-    featureStatusMessage.FindOrAdd(featureTypeStatusOverride) = FString(FeatureResourceManager::GENERATING_TEMPLATES_STATUS_TEXT.c_str());
+    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::GENERATING_TEMPLATES_STATUS_TEXT);
     if (stackStatus == FeatureResourceManager::UNDEPLOYED_STATUS_TEXT)
     {
-        featureStatusMessage.FindOrAdd(featureTypeStatusOverride) = FString(FeatureResourceManager::GENERATING_TEMPLATES_STATUS_TEXT.c_str());
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::GENERATING_TEMPLATES_STATUS_TEXT);
         // Only missing instance files will be created; existing instance files will be reused
         result = featureResourceManager->GenerateFeatureInstanceFiles(feature);
         if (result.Result != GameKit::GAMEKIT_SUCCESS)
         {
-            featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+            SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
             AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-            return;
+            return false;
         }
     }
     else
@@ -192,9 +209,9 @@ void AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources
         result = featureResourceManager->ValidateFeatureParameters(feature);
         if (result.Result != GameKit::GAMEKIT_SUCCESS)
         {
-            featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+            SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
             AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-            return;
+            return false;
         }
     }
 
@@ -205,55 +222,181 @@ void AwsGameKitFeatureControlCenter::ConditionallyCreateOrUpdateFeatureResources
         if (writeResult.Result != GameKit::GAMEKIT_SUCCESS)
         {
             UE_LOG(LogAwsGameKit, Error, TEXT("Unable to retrieve deployed CloudFormation template for %s."), *AwsGameKitEnumConverter::FeatureToUIString(feature));
-            featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+            SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
             AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-            return;
+            return false;
         }
     }
 
-    featureStatusMessage.FindOrAdd(featureTypeStatusOverride) = FeatureResourceManager::UPLOADING_DASHBOARDS_STATUS_TEXT.c_str();
+    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::UPLOADING_DASHBOARDS_STATUS_TEXT);
     result = featureResourceManager->UploadDashboards(feature);
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
-        featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
         AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-        return;
+        return false;
     }
 
-    featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::UPLOADING_LAYERS_STATUS_TEXT.c_str();
+    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::UPLOADING_LAYERS_STATUS_TEXT);
     result = featureResourceManager->UploadLayers(feature);
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
-        featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
         AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-        return;
+        return false;
     }
 
-    featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::UPLOADING_FUNCTIONS_STATUS_TEXT.c_str();
+    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::UPLOADING_FUNCTIONS_STATUS_TEXT);
     result = featureResourceManager->UploadFunctions(feature);
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
-        featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
         AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-        return;
+        return false;
     }
 
-    featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::DEPLOYING_STATUS_TEXT.c_str();
+    preparationLock.Unlock();
+
+    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::DEPLOYING_STATUS_TEXT);
+
+    // The stack update blocks until CloudFormation is done, its resources are described alongside to show how far along it is
+    FEvent* deploymentDone = FPlatformProcess::GetSynchEventFromPool(true);
+    TFuture<void> progressWatcher = Async(EAsyncExecution::Thread, [this, featureResourceManager, feature, featureTypeStatusOverride, deploymentDone]()
+        {
+            featureResourceManager->WatchStackProgress(feature, deploymentDone, [this, feature, featureTypeStatusOverride](const FeatureResourceManager::FStackProgress& progress)
+                {
+                    for (const FString& resource : progress.changedResources)
+                    {
+                        UE_LOG(LogAwsGameKit, Display, TEXT("%s: %s"), *AwsGameKitEnumConverter::FeatureToUIString(feature), *resource);
+                    }
+                    SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::DEPLOYING_STATUS_TEXT
+                        + " (" + std::to_string(progress.completedResources) + "/" + std::to_string(progress.totalResources) + ")");
+                });
+        });
+
     result = featureResourceManager->CreateOrUpdateFeatureResources(feature);
+    deploymentDone->Trigger();
+    progressWatcher.Wait();
+    FPlatformProcess::ReturnSynchEventToPool(deploymentDone);
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
-        featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::ERROR_STATUS_TEXT);
         AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
-        return;
+        return false;
     }
 
     if (feature != FeatureType::Main)
     {
-        featureStatusMessage[featureTypeStatusOverride] = FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str();
+        SetFeatureStatusMessage(featureTypeStatusOverride, FeatureResourceManager::DEPLOYED_STATUS_TEXT);
     }
+
+    return true;
+}
+
+void AwsGameKitFeatureControlCenter::SetFeatureStatusMessage(FeatureType feature, const std::string& status)
+{
+    FScopeLock lock(&this->featureStatusMessageMutex);
+    featureStatusMessage.FindOrAdd(feature) = FString(status.c_str());
+}
+
+TArray<FeatureType> AwsGameKitFeatureControlCenter::GetFeatureDependencies(FeatureType feature)
+{
+    switch (feature)
+    {
+    case FeatureType::Achievements:
+    case FeatureType::GameStateCloudSaving:
+    case FeatureType::UserGameplayData:
+        return { FeatureType::Identity };
+    default:
+        return {};
+    }
+}
+
+FReply AwsGameKitFeatureControlCenter::CreateOrUpdateAllResources()
+{
+    TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
+
+    TArray<FeatureType> features;
+    for (const FeatureType& feature : availableFeatures)
+    {
+        if (feature == FeatureType::Main)
+        {
+            continue;
+        }
+
+        featureResourceManager->SetFeatureVariablesIfUnset(feature, DefaultValuesForFeature(feature));
+
+        // Entries are added here so that the concurrent deployments only ever update existing ones
+        featureResourceManager->featureRunningStates.FindOrAdd(feature, FeatureResourceManager::FeatureRunningState::NotRunning);
+        SetFeatureStatusMessage(feature, FeatureResourceManager::WORKING_STATUS_TEXT);
+    }
+    featureResourceManager->featureRunningStates.FindOrAdd(FeatureType::Main, FeatureResourceManager::FeatureRunningState::NotRunning);
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+        [features, featureResourceManager, this]()
+        {
+            // Every feature stack depends on the main stack
+            if (ConditionallyCreateOrUpdateFeatureResources(featureResourceManager, FeatureType::Main))
+            {
+                // Deploy the features whose dependencies are deployed all at once, until none is left or the remaining ones depend on a failed deployment
+                TSet<FeatureType> deployed;
+                TArray<FeatureType> remaining = features;
+                while (remaining.Num() > 0)
+                {
+                    TArray<FeatureType> ready = remaining.FilterByPredicate([&deployed](FeatureType feature)
+                        {
+                            return GetFeatureDependencies(feature).FilterByPredicate([&deployed](FeatureType dependency) { return !deployed.Contains(dependency); }).Num() == 0;
+                        });
+                    if (ready.Num() == 0)
+                    {
+                        break;
+                    }
+
+                    TArray<bool> succeeded;
+                    succeeded.SetNumZeroed(ready.Num());
+                    ParallelFor(ready.Num(), [this, featureResourceManager, &ready, &succeeded](int32 index)
+                        {
+                            succeeded[index] = ConditionallyCreateOrUpdateFeatureResources(featureResourceManager, ready[index]);
+                        }, EParallelForFlags::BackgroundPriority);
+
+                    for (int32 i = 0; i < ready.Num(); ++i)
+                    {
+                        remaining.Remove(ready[i]);
+                        if (succeeded[i])
+                        {
+                            deployed.Add(ready[i]);
+                        }
+                    }
+                }
+            }
+
+            // Features which weren't deployed get their actual status back
+            RefreshFeatureStatuses();
+        }
+    );
+
+    return FReply::Handled();
+}
+
+bool AwsGameKitFeatureControlCenter::IsCreateOrUpdateAllEnabled()
+{
+    if (!credentialsSubmitted || IsAnyFeatureUpdating())
+    {
+        return false;
+    }
+
+    for (const FeatureType& feature : availableFeatures)
+    {
+        if (feature != FeatureType::Main && !FeatureAvailable(feature))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 FReply AwsGameKitFeatureControlCenter::DeleteResources(FeatureType feature)
@@ -261,7 +404,7 @@ FReply AwsGameKitFeatureControlCenter::DeleteResources(FeatureType feature)
     TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
 
     executeDeleteButton->SetEnabled(false);
-    featureStatusMessage.FindOrAdd(feature) = FeatureResourceManager::DELETING_RESOURCES_STATUS_TEXT.c_str();
+    SetFeatureStatusMessage(feature, FeatureResourceManager::DELETING_RESOURCES_STATUS_TEXT);
 
     AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [&, feature, featureResourceManager]()
         {
@@ -269,7 +412,7 @@ FReply AwsGameKitFeatureControlCenter::DeleteResources(FeatureType feature)
 
             if (result.Result != GameKit::GAMEKIT_SUCCESS)
             {
-                featureStatusMessage[feature] = FeatureResourceManager::ERROR_STATUS_TEXT.c_str();
+                SetFeatureStatusMessage(feature, FeatureResourceManager::ERROR_STATUS_TEXT);
                 AwsGameKitEditorUtils::ShowMessageDialogAsync(EAppMsgType::Ok, FText::FromString(result.ErrorMessage));
             }
 
@@ -290,8 +433,6 @@ void AwsGameKitFeatureControlCenter::OpenDeleteDialog()
 
     FString featureStr = AwsGameKitEnumConverter::FeatureToUIString(this->featureToDelete);
     FeatureType feature = this->featureToDelete;
-    TSharedPtr<STextBlock> textBlock;
-
     const FSlateFontInfo robotoRegular10 = AwsGameKitStyleSet::Style->GetFontStyle(("RobotoRegular10"));
     const FSlateFontInfo robotoRegular12 = AwsGameKitStyleSet::Style->GetFontStyle(("RobotoRegular12"));
     const FSlateFontInfo robotoBold12 = AwsGameKitStyleSet::Style->GetFontStyle(("RobotBold12"));
@@ -362,16 +503,34 @@ void AwsGameKitFeatureControlCenter::OpenDeleteDialog()
                                 .BorderBackgroundColor(AwsGameKitStyleSet::Style->GetColor("DarkGrey"))
                                 .Padding(FMargin(3, 3, 3, 3))
                                 [
-                                    SNew(SScrollBox)
-                                    + SScrollBox::Slot()
+                                    SNew(SOverlay)
+                                    + SOverlay::Slot()
+                                    .Padding(5, 5, 5, 5)
+                                    [
+                                        // Only the visible resources get a row, large stacks are listed as fast as small ones
+                                        SAssignNew(deleteResourcesList, SListView<TSharedPtr<FString>>)
+                                        .ListItemsSource(&deleteResourcesListItems)
+                                        .SelectionMode(ESelectionMode::None)
+                                        .OnGenerateRow_Lambda([robotoRegular10](TSharedPtr<FString> resource, const TSharedRef<STableViewBase>& ownerTable)
+                                        {
+                                            return SNew(STableRow<TSharedPtr<FString>>, ownerTable)
+                                            [
+                                                SNew(STextBlock)
+                                                .AutoWrapText(true)
+                                                .Font(robotoRegular10)
+                                                .ColorAndOpacity(AwsGameKitStyleSet::Style->GetColor("LightGrey"))
+                                                .Text(FText::FromString(*resource))
+                                            ];
+                                        })
+                                    ]
+                                    + SOverlay::Slot()
                                     .Padding(5, 5, 5, 5)
                                     [
-                                        SAssignNew(textBlock, STextBlock)
-                                        .AutoWrapText(true)
+                                        SNew(STextBlock)
                                         .Font(robotoRegular10)
-                                        .Text(FText::FromString("Loading...")).ColorAndOpacity(FLinearColor::Gray)
-                                        .ColorAndOpacity(AwsGameKitStyleSet::Style->GetColor("LightGrey"))
-                                        .Text_Lambda([feature, this]()->FText { return *featureDeleteDetailsContent.FindOrAdd(feature); })
+                                        .ColorAndOpacity(FLinearColor::Gray)
+                                        .Text(FText::FromString("Loading..."))
+                                        .Visibility_Lambda([this]() -> EVisibility { return deleteResourcesLoading && deleteResourcesListItems.Num() == 0 ? EVisibility::Visible : EVisibility::Collapsed; })
                                     ]
                                 ]
                             ]
@@ -479,29 +638,60 @@ void AwsGameKitFeatureControlCenter::OpenDeleteDialog()
             ]
         ];
 
-    TSharedPtr<FText> empty(new FText());
-    featureDeleteDetailsContent.FindOrAdd(feature) = empty;
+    deleteResourcesListItems.Reset();
+    deleteResourcesLoading = true;
+    const uint32 requestId = ++deleteResourcesRequestId;
 
-    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [&, feature, featureResourceManager]()
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, feature, featureResourceManager, requestId]()
         {
-            TArray<FString> resourcesInfo;
-            IntResult result = featureResourceManager->DescribeFeatureResources(feature, resourcesInfo);
+            // Resources are added to the list in batches as they are described, the dialog doesn't wait for the whole stack
+            auto addResources = [this, requestId](TArray<FString>&& resources, TOptional<bool> canBeDeleted)
+            {
+                AsyncTask(ENamedThreads::GameThread, [this, requestId, resources = MoveTemp(resources), canBeDeleted]()
+                    {
+                        if (requestId != deleteResourcesRequestId)
+                        {
+                            return;
+                        }
+
+                        for (const FString& resource : resources)
+                        {
+                            deleteResourcesListItems.Add(MakeShared<FString>(resource));
+                        }
+                        if (canBeDeleted.IsSet())
+                        {
+                            stackCanBeDeleted = canBeDeleted.GetValue();
+                            deleteResourcesLoading = false;
+                        }
+                        if (deleteResourcesList.IsValid())
+                        {
+                            deleteResourcesList->RequestListRefresh();
+                        }
+                    });
+            };
+
+            static constexpr int32 RESOURCES_BATCH_SIZE = 25;
+            TArray<FString> resourcesBatch;
+            IntResult result = featureResourceManager->DescribeFeatureResources(feature, [&resourcesBatch, &addResources](const FString& resource)
+                {
+                    resourcesBatch.Add(resource);
+                    if (resourcesBatch.Num() == RESOURCES_BATCH_SIZE)
+                    {
+                        addResources(MoveTemp(resourcesBatch), TOptional<bool>());
+                        resourcesBatch.Reset();
+                    }
+                });
 
             if (result.Result != GameKit::GAMEKIT_SUCCESS)
             {
-                resourcesInfo.Reset();
-                resourcesInfo.Add(FString("Could not retrieve feature resources."));
-                resourcesInfo.Add(result.ErrorMessage+"\n Logs:");
-                resourcesInfo.Add(featureResourceManager->GetLog());
-                stackCanBeDeleted = false;
-            }
-            else
-            {
-                stackCanBeDeleted = true;
+                resourcesBatch.Reset();
+                resourcesBatch.Add(FString("Could not retrieve feature resources."));
+                resourcesBatch.Add(result.ErrorMessage + "\n Logs:");
+                uint64 logCursor = 0;
+                featureResourceManager->ReadLog(logCursor, resourcesBatch);
             }
 
-            FText resourceText = FText::FromString(FString::Join(resourcesInfo, TEXT("\n")));
-            *featureDeleteDetailsContent.FindOrAdd(feature) = resourceText;
+            addResources(MoveTemp(resourcesBatch), result.Result == GameKit::GAMEKIT_SUCCESS);
         });
 
     GEditor->EditorAddModalWindow(deleteResourcesWindow.ToSharedRef());
@@ -528,10 +718,7 @@ FReply AwsGameKitFeatureControlCenter::OnCancelDeleteChanged()
 
 void AwsGameKitFeatureControlCenter::RefreshFeatureStatuses()
 {
-    for (const FeatureType& feature : availableFeatures)
-    {
-        GetFeatureStatusAsync(feature);
-    }
+    GetFeatureStatusesAsync(availableFeatures.Array());
 }
 
 FReply AwsGameKitFeatureControlCenter::PrepareDeleteResources(FeatureType feature)
@@ -599,22 +786,18 @@ bool AwsGameKitFeatureControlCenter::CheckDependentFeatureStatus(FeatureType fea
 
 bool AwsGameKitFeatureControlCenter::CanCreateOrUpdateDependentFeature(FeatureType feature)
 {
-    TArray<FString> dependentFeatures;
-    switch (feature)
+    const TArray<FeatureType> dependencies = GetFeatureDependencies(feature);
+    if (dependencies.Num() == 0)
     {
-    case FeatureType::Achievements:
-        CheckDependentFeatureStatus(FeatureType::Identity, FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str(), dependentFeatures);
-        break;
-    case FeatureType::GameStateCloudSaving:
-        CheckDependentFeatureStatus(FeatureType::Identity, FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str(), dependentFeatures);
-        break;
-    case FeatureType::UserGameplayData:
-        CheckDependentFeatureStatus(FeatureType::Identity, FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str(), dependentFeatures);
-        break;
-    default:
         return true;
     }
 
+    TArray<FString> dependentFeatures;
+    for (const FeatureType dependency : dependencies)
+    {
+        CheckDependentFeatureStatus(dependency, FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str(), dependentFeatures);
+    }
+
     createOrUpdateOverrideTooltips.Add(feature, FString::Join(dependentFeatures, TEXT("\n")));
     return createOrUpdateOverrideTooltips[feature].IsEmpty() ? true : false;
 }
@@ -708,14 +891,48 @@ bool AwsGameKitFeatureControlCenter::IsFeatureInteractable(FeatureType feature,
 
 void AwsGameKitFeatureControlCenter::GetFeatureStatusAsync(FeatureType feature)
 {
+    GetFeatureStatusesAsync({ feature });
+}
+
+void AwsGameKitFeatureControlCenter::GetFeatureStatusesAsync(const TArray<FeatureType>& features)
+{
+    TMap<FeatureType, uint32> requestIds;
+    {
+        FScopeLock lock(&this->featureStatusMessageMutex);
+        for (const FeatureType feature : features)
+        {
+            requestIds.Add(feature, ++featureStatusRequestIds.FindOrAdd(feature));
+        }
+    }
+
+    // The CloudFormation calls and the resources instances they need would freeze the editor on the game thread, only the results are published there
     TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
-    AsyncTask(ENamedThreads::GameThread, [&, feature, featureResourceManager]()
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, features, featureResourceManager, requestIds]()
         {
+            TMap<FeatureType, std::string> stackStatuses;
+            {
+                FScopeLock queryLock(&this->featureStatusQueryMutex);
+                stackStatuses = featureResourceManager->GetResourcesStackStatuses(features);
+            }
+
+            TMap<FeatureType, FString> statusMessages;
+            for (const TPair<FeatureType, std::string>& stackStatus : stackStatuses)
             {
-                FScopeLock lock(&this->featureStatusMessageMutex);
-                const std::string stackStatus = featureResourceManager->GetResourcesStackStatus(feature);
-                featureStatusMessage.FindOrAdd(feature) = FString(stackStatus.c_str());
+                statusMessages.Add(stackStatus.Key, FString(stackStatus.Value.c_str()));
             }
+
+            // All the features are updated together, so the panel never shows statuses from different refreshes side by side
+            AsyncTask(ENamedThreads::GameThread, [this, requestIds, statusMessages]()
+                {
+                    FScopeLock lock(&this->featureStatusMessageMutex);
+                    for (const TPair<FeatureType, FString>& statusMessage : statusMessages)
+                    {
+                        if (featureStatusRequestIds.FindRef(statusMessage.Key) == requestIds.FindRef(statusMessage.Key))
+                        {
+                            featureStatusMessage.FindOrAdd(statusMessage.Key) = statusMessage.Value;
+                        }
+                    }
+                });
         });
 }
 
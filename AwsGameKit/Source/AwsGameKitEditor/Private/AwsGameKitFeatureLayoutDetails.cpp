@@ -17,7 +17,10 @@
 #include "PropertyCustomizationHelpers.h"
 #include "Styling/SlateStyle.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SHyperlink.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Text/SRichTextBlock.h"
 #include "Widgets/Text/STextBlock.h"
@@ -25,6 +28,22 @@
 #define LOCTEXT_NAMESPACE "AwsGameKitFeatureLayoutDetails"
 
 const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED = "cloudwatch_dashboard_enabled";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_RUNTIME = "lambda_runtime";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_ARCHITECTURE = "lambda_architecture";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_MEMORY_SIZE = "lambda_memory_size";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY = "lambda_provisioned_concurrency";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_RUNTIME = "python3.7";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_ARCHITECTURE = "x86_64";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_MEMORY_SIZE = "128";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_LAMBDA_PROVISIONED_CONCURRENCY = "0";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_MIN_CAPACITY = "dynamodb_min_capacity";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_MAX_CAPACITY = "dynamodb_max_capacity";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_TARGET_UTILIZATION = "dynamodb_target_utilization";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_MIN_CAPACITY = "dynamodb_scheduled_min_capacity";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_SCALING_START = "dynamodb_scheduled_scaling_start";
+const FString AwsGameKitFeatureLayoutDetails::GAMEKIT_DYNAMODB_SCHEDULED_SCALING_END = "dynamodb_scheduled_scaling_end";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_DYNAMODB_TARGET_UTILIZATION = "70";
+const FString AwsGameKitFeatureLayoutDetails::DEFAULT_DYNAMODB_SCHEDULED_MIN_CAPACITY = "0";
 
 AwsGameKitFeatureLayoutDetails::AwsGameKitFeatureLayoutDetails(const FeatureType featureType, const FAwsGameKitEditorModule* editorModule) : editorModule(editorModule), featureType(featureType)
 {
@@ -87,6 +106,18 @@ TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDeployControls(const
         .Visibility(addSeparator ? EVisibility::Visible : EVisibility::Hidden)
     ]
 
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        GetLambdaSettings()
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        GetDynamoDbSettings()
+    ]
+
     + SVerticalBox::Slot()
     .AutoHeight()
     [
@@ -122,8 +153,9 @@ TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDeployControls(const
                             return LOCTEXT("DashboardStatusInvalidEnviornment", "Enter valid environment and credentials to see dashboard status.");
                         }
 
-                        TMap<FString, FString> featureVariables = featureResourceManager->GetFeatureVariables(this->featureType);
-                        if (featureVariables.Contains(GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED) && featureVariables[GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED].Equals("false"))
+                        const auto settings = featureResourceManager->GetSettingsSnapshot();
+                        const FString* dashboardEnabled = settings->FindFeatureVariable(this->featureType, GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED);
+                        if (dashboardEnabled != nullptr && dashboardEnabled->Equals("false"))
                         {
                             return LOCTEXT("DashboardStatusUndeployedInactive", "Dashboard will not be active upon deployment");
                         }
@@ -246,8 +278,9 @@ TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDeployControls(const
                     {
                         if (editorState->GetCredentialState())
                         {
-                            TMap<FString, FString> featureVariables = featureResourceManager->GetFeatureVariables(this->featureType);
-                            if (featureVariables.Contains(GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED) && featureVariables[GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED].Equals("false"))
+                            const auto settings = featureResourceManager->GetSettingsSnapshot();
+                            const FString* dashboardEnabled = settings->FindFeatureVariable(this->featureType, GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED);
+                            if (dashboardEnabled != nullptr && dashboardEnabled->Equals("false"))
                             {
                                 return EVisibility::Visible;
                             }
@@ -288,8 +321,9 @@ TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDeployControls(const
                     {
                         if (editorState->GetCredentialState())
                         {
-                            TMap<FString, FString> featureVariables = featureResourceManager->GetFeatureVariables(this->featureType);
-                            if (featureVariables.Contains(GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED) && featureVariables[GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED].Equals("false"))
+                            const auto settings = featureResourceManager->GetSettingsSnapshot();
+                            const FString* dashboardEnabled = settings->FindFeatureVariable(this->featureType, GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED);
+                            if (dashboardEnabled != nullptr && dashboardEnabled->Equals("false"))
                             {
                                 return EVisibility::Collapsed;
                             }
@@ -557,16 +591,305 @@ TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDeployControls(const
                 })
                 .IsEnabled(false)
             ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(2)
+            [
+                SNew(SButton)
+                .VAlign(VAlign_Center)
+                .HAlign(HAlign_Center)
+                .ButtonColorAndOpacity(AwsGameKitStyleSet::Style->GetColor("ButtonGrey"))
+                .ContentPadding(FMargin(10, 2))
+                .Text(LOCTEXT("DeployAll", "Deploy all"))
+                .ToolTipText(LOCTEXT("DeployAllTooltip", "Create or update the resources of every feature. Features which don't depend on each other are deployed at the same time."))
+                .OnClicked_Lambda([featureControlCenter] { return featureControlCenter->CreateOrUpdateAllResources(); })
+                .IsEnabled_Lambda([featureControlCenter] { return featureControlCenter->IsCreateOrUpdateAllEnabled(); })
+            ]
         )
     ];
 }
 
+TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetLambdaSettings()
+{
+    const TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
+
+    return SNew(SVerticalBox)
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - Lambda runtime label
+            SNew(STextBlock)
+            .Text(LOCTEXT("LambdaRuntime", "Lambda runtime")),
+
+            // Right - Lambda runtime
+            SNew(SEditableTextBox)
+            .Text_Lambda([this]
+            {
+                return FText::FromString(GetFeatureVariable(GAMEKIT_LAMBDA_RUNTIME, DEFAULT_LAMBDA_RUNTIME));
+            })
+            .ToolTipText(LOCTEXT("LambdaRuntimeTooltip", "Runtime of the feature's Lambda functions, for example python3.9. Functions using layers with native code need layers built for it."))
+            .OnTextCommitted_Lambda([this, featureResourceManager](const FText& text, ETextCommit::Type commitType)
+            {
+                const FString runtime = text.ToString().TrimStartAndEnd();
+                if (!runtime.IsEmpty())
+                {
+                    featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_RUNTIME, runtime);
+                }
+            })
+            .IsEnabled_Lambda([this] { return CanEditConfiguration(); })
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - Lambda architecture label
+            SNew(STextBlock)
+            .Text(LOCTEXT("LambdaArchitecture", "Lambda on arm64")),
+
+            // Right - Lambda architecture
+            SNew(SCheckBox)
+            .IsChecked_Lambda([this]
+            {
+                return GetFeatureVariable(GAMEKIT_LAMBDA_ARCHITECTURE, DEFAULT_LAMBDA_ARCHITECTURE).Equals("arm64") ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .ToolTipText(LOCTEXT("LambdaArchitectureTooltip", "Run the feature's Lambda functions on arm64 (AWS Graviton) instead of x86_64. Functions using layers with native code need layers built for arm64."))
+            .OnCheckStateChanged_Lambda([this, featureResourceManager](ECheckBoxState state)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_ARCHITECTURE, state == ECheckBoxState::Checked ? FString("arm64") : DEFAULT_LAMBDA_ARCHITECTURE);
+            })
+            .IsEnabled_Lambda([this] { return CanEditConfiguration(); })
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - Lambda memory label
+            SNew(STextBlock)
+            .Text(LOCTEXT("LambdaMemorySize", "Lambda memory (MB)")),
+
+            // Right - Lambda memory
+            SNew(SSpinBox<int>)
+            .MinValue(128)
+            .MaxValue(10240)
+            .MinSliderValue(128)
+            .MaxSliderValue(3008)
+            .Delta(64)
+            .Value_Lambda([this]
+            {
+                return FCString::Atoi(*GetFeatureVariable(GAMEKIT_LAMBDA_MEMORY_SIZE, DEFAULT_LAMBDA_MEMORY_SIZE));
+            })
+            .ToolTipText(LOCTEXT("LambdaMemorySizeTooltip", "Memory of the feature's Lambda functions. Lambda allocates CPU in proportion to memory, so more memory also shortens cold starts."))
+            .OnValueCommitted_Lambda([this, featureResourceManager](int value, ETextCommit::Type commitType)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_MEMORY_SIZE, FString::FromInt(value));
+            })
+            .OnEndSliderMovement_Lambda([this, featureResourceManager](int value)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_MEMORY_SIZE, FString::FromInt(value));
+            })
+            .IsEnabled_Lambda([this] { return CanEditConfiguration(); })
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - Provisioned concurrency label
+            SNew(STextBlock)
+            .Text(LOCTEXT("LambdaProvisionedConcurrency", "Provisioned concurrency")),
+
+            // Right - Provisioned concurrency
+            SNew(SSpinBox<int>)
+            .MinValue(0)
+            .MaxValue(1000)
+            .MinSliderValue(0)
+            .MaxSliderValue(50)
+            .Value_Lambda([this]
+            {
+                return FCString::Atoi(*GetFeatureVariable(GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY, DEFAULT_LAMBDA_PROVISIONED_CONCURRENCY));
+            })
+            .ToolTipText(LOCTEXT("LambdaProvisionedConcurrencyTooltip", "Instances kept initialized for each of the feature's latency sensitive Lambda functions, so their first calls don't wait for a cold start. Provisioned instances are billed while idle. 0 to disable."))
+            .OnValueCommitted_Lambda([this, featureResourceManager](int value, ETextCommit::Type commitType)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY, FString::FromInt(value));
+            })
+            .OnEndSliderMovement_Lambda([this, featureResourceManager](int value)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY, FString::FromInt(value));
+            })
+            .IsEnabled_Lambda([this] { return CanEditConfiguration(); })
+        )
+    ];
+}
+
+TSharedRef<SVerticalBox> AwsGameKitFeatureLayoutDetails::GetDynamoDbSettings()
+{
+    const TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
+
+    // Both ends of the scheduled scaling take an at() or cron() expression of Application Auto Scaling, empty clears them
+    auto scheduleTextBox = [this, featureResourceManager](const FString& varName, const FText& toolTip) -> TSharedRef<SWidget>
+    {
+        return SNew(SEditableTextBox)
+            .Text_Lambda([this, varName]
+            {
+                return FText::FromString(GetFeatureVariable(varName, FString()));
+            })
+            .HintText(LOCTEXT("DynamoDbScheduleHint", "at(2026-11-01T16:00:00)"))
+            .ToolTipText(toolTip)
+            .OnTextCommitted_Lambda([this, featureResourceManager, varName](const FText& text, ETextCommit::Type commitType)
+            {
+                featureResourceManager->SetFeatureVariable(this->featureType, varName, text.ToString().TrimStartAndEnd());
+            })
+            .IsEnabled_Lambda([this] { return CanEditConfiguration(); });
+    };
+
+    return SNew(SVerticalBox)
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB minimum capacity label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbMinCapacity", "DynamoDB minimum capacity")),
+
+            // Right - DynamoDB minimum capacity
+            GetFeatureVariableSpinBox(GAMEKIT_DYNAMODB_MIN_CAPACITY, DefaultDynamoDbMinCapacity(this->featureType), 1, 40000,
+                LOCTEXT("DynamoDbMinCapacityTooltip", "Read and write capacity units each of the feature's DynamoDB tables and indexes is provisioned with, and never scales below."))
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB maximum capacity label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbMaxCapacity", "DynamoDB maximum capacity")),
+
+            // Right - DynamoDB maximum capacity
+            GetFeatureVariableSpinBox(GAMEKIT_DYNAMODB_MAX_CAPACITY, DefaultDynamoDbMaxCapacity(this->featureType), 1, 40000,
+                LOCTEXT("DynamoDbMaxCapacityTooltip", "Read and write capacity units Application Auto Scaling may raise each table and index to. Equal to the minimum to disable auto scaling."))
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB target utilization label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbTargetUtilization", "DynamoDB target utilization (%)")),
+
+            // Right - DynamoDB target utilization
+            GetFeatureVariableSpinBox(GAMEKIT_DYNAMODB_TARGET_UTILIZATION, DEFAULT_DYNAMODB_TARGET_UTILIZATION, 20, 90,
+                LOCTEXT("DynamoDbTargetUtilizationTooltip", "Share of the provisioned capacity auto scaling aims to consume. Lower values absorb sudden spikes better and cost more."))
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB scheduled minimum capacity label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbScheduledMinCapacity", "DynamoDB scheduled minimum")),
+
+            // Right - DynamoDB scheduled minimum capacity
+            GetFeatureVariableSpinBox(GAMEKIT_DYNAMODB_SCHEDULED_MIN_CAPACITY, DEFAULT_DYNAMODB_SCHEDULED_MIN_CAPACITY, 0, 40000,
+                LOCTEXT("DynamoDbScheduledMinCapacityTooltip", "Minimum capacity held between the scheduled start and end, for known events such as a season launch. Must not exceed the maximum. 0 to disable."))
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB scheduled scaling start label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbScheduledScalingStart", "DynamoDB scheduled start")),
+
+            // Right - DynamoDB scheduled scaling start
+            scheduleTextBox(GAMEKIT_DYNAMODB_SCHEDULED_SCALING_START,
+                LOCTEXT("DynamoDbScheduledScalingStartTooltip", "When the scheduled minimum starts, as at(yyyy-mm-ddThh:mm:ss) or cron(...) in UTC."))
+        )
+    ]
+
+    + SVerticalBox::Slot()
+    .AutoHeight()
+    [
+        PROJECT_SETTINGS_ROW(
+            // Left - DynamoDB scheduled scaling end label
+            SNew(STextBlock)
+            .Text(LOCTEXT("DynamoDbScheduledScalingEnd", "DynamoDB scheduled end")),
+
+            // Right - DynamoDB scheduled scaling end
+            scheduleTextBox(GAMEKIT_DYNAMODB_SCHEDULED_SCALING_END,
+                LOCTEXT("DynamoDbScheduledScalingEndTooltip", "When the minimum capacity returns to its usual value, as at(yyyy-mm-ddThh:mm:ss) or cron(...) in UTC."))
+        )
+    ];
+}
+
+TSharedRef<SWidget> AwsGameKitFeatureLayoutDetails::GetFeatureVariableSpinBox(const FString& varName, const FString& defaultValue, int minValue, int maxValue, const FText& toolTip)
+{
+    const TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
+
+    return SNew(SSpinBox<int>)
+        .MinValue(minValue)
+        .MaxValue(maxValue)
+        .MinSliderValue(minValue)
+        .MaxSliderValue(FMath::Min(maxValue, 1000))
+        .Value_Lambda([this, varName, defaultValue]
+        {
+            return FCString::Atoi(*GetFeatureVariable(varName, defaultValue));
+        })
+        .ToolTipText(toolTip)
+        .OnValueCommitted_Lambda([this, featureResourceManager, varName](int value, ETextCommit::Type commitType)
+        {
+            featureResourceManager->SetFeatureVariable(this->featureType, varName, FString::FromInt(value));
+        })
+        .OnEndSliderMovement_Lambda([this, featureResourceManager, varName](int value)
+        {
+            featureResourceManager->SetFeatureVariable(this->featureType, varName, FString::FromInt(value));
+        })
+        .IsEnabled_Lambda([this] { return CanEditConfiguration(); });
+}
+
+FString AwsGameKitFeatureLayoutDetails::DefaultDynamoDbMinCapacity(FeatureType feature)
+{
+    return feature == FeatureType::UserGameplayData ? FString("20") : FString("5");
+}
+
+FString AwsGameKitFeatureLayoutDetails::DefaultDynamoDbMaxCapacity(FeatureType feature)
+{
+    return feature == FeatureType::UserGameplayData ? FString("200") : FString("5");
+}
+
+FString AwsGameKitFeatureLayoutDetails::GetFeatureVariable(const FString& varName, const FString& defaultValue) const
+{
+    if (!editorModule->GetEditorState()->GetCredentialState())
+    {
+        return defaultValue;
+    }
+
+    // Held while the value is read, the settings may be replaced meanwhile
+    const auto settings = editorModule->GetFeatureResourceManager()->GetSettingsSnapshot();
+    const FString* value = settings->FindFeatureVariable(this->featureType, varName);
+    return value != nullptr && !value->IsEmpty() ? *value : defaultValue;
+}
+
 bool AwsGameKitFeatureLayoutDetails::ShowDashboardLink(const TSharedPtr<AwsGameKitFeatureControlCenter> featureControlCenter, const TSharedPtr<FeatureResourceManager> featureResourceManager)
 {
-    TMap<FString, FString> featureVariables = featureResourceManager->GetFeatureVariables(this->featureType);
+    const auto settings = featureResourceManager->GetSettingsSnapshot();
+    const FString* dashboardEnabled = settings->FindFeatureVariable(this->featureType, GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED);
 
     if (!featureControlCenter->GetStatus(this->featureType).ToString().Equals(FeatureResourceManager::UNDEPLOYED_STATUS_TEXT.c_str()) &&
-        featureVariables.Contains(GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED) && featureVariables[GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED].Equals("true"))
+        dashboardEnabled != nullptr && dashboardEnabled->Equals("true"))
     {
         return true;
     }
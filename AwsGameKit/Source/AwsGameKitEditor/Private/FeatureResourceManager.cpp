@@ -13,24 +13,51 @@
 #include "Core/AwsGameKitDispatcher.h"
 #include "GameSaving/AwsGameKitGameSavingLayoutDetails.h"
 #include "Identity/AwsGameKitIdentityLayoutDetails.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
 
 // Unreal
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformTime.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+#include "Misc/Timespan.h"
 
-TArray<FString> resourceInfoCache;
+// The resource info callback has no receiver, so one stack is described at a time and its resources go to this sink
+FCriticalSection resourceInfoMutex;
+const TFunction<void(const char* logicalResourceId, const char* resourceType, const char* resourceStatus)>* resourceInfoSink = nullptr;
 
 #define LOG_FEATURE_MESSAGE(message) \
 { \
     UE_LOG(LogAwsGameKit, Log, TEXT("%s"), *message); \
-    featuresLog = message + "\n" + featuresLog; \
+    AppendLog(message); \
 };
 
 void ResourceInfoCallback(const char* logicalResourceId, const char* resourceType, const char* resourceStatus)
 {
-    // TODO: Make this thread safe.
-    FString f = FString::Printf(TEXT("'%s' resource with id '%s' in %s status."), ANSI_TO_TCHAR(resourceType), ANSI_TO_TCHAR(logicalResourceId), ANSI_TO_TCHAR(resourceStatus));
-    resourceInfoCache.Add(f);
+    (*resourceInfoSink)(logicalResourceId, resourceType, resourceStatus);
+}
+
+// The log callback has no receiver either, GetAccountId() collects what its own call logs on this thread to tell why STS failed
+thread_local FString* accountIdLogSink = nullptr;
+
+void AccountIdLogCallback(unsigned int level, const char* message, int size)
+{
+    FGameKitLogging::LogCallBack(level, message, size);
+    if (accountIdLogSink != nullptr && message != nullptr)
+    {
+        accountIdLogSink->Append(UTF8_TO_TCHAR(message));
+        accountIdLogSink->AppendChar(TEXT('\n'));
+    }
+}
+
+FString FormatResourceInfo(const FString& logicalResourceId, const FString& resourceType, const FString& resourceStatus)
+{
+    return FString::Printf(TEXT("'%s' resource with id '%s' in %s status."), *resourceType, *logicalResourceId, *resourceStatus);
 }
 
 const std::string FeatureResourceManager::DEPLOYED_STATUS_TEXT = "Deployed";
@@ -46,6 +73,14 @@ const std::string FeatureResourceManager::DEPLOYING_STATUS_TEXT = "Deploying res
 const std::string FeatureResourceManager::DELETING_RESOURCES_STATUS_TEXT = "Deleting resources";
 const std::string FeatureResourceManager::RETRIEVING_STATUS_TEXT = "Retrieving status";
 
+const double FeatureResourceManager::SETTINGS_SAVE_DELAY_SECONDS = 3.0;
+
+// DescribeStackResources is throttled per account, and deployments of several features watch their stacks at once
+const double FeatureResourceManager::STACK_PROGRESS_INTERVAL_SECONDS = 5.0;
+
+// A full deployment of every feature logs a few hundred messages
+const int32 FeatureResourceManager::LOG_CAPACITY = 2000;
+
 FeatureResourceManager::~FeatureResourceManager()
 {
     this->Shutdown();
@@ -64,9 +99,9 @@ void FeatureResourceManager::Initialize()
 
     FGameKitLogging::AttachLogger(this);
 
-    if (this->ftsc == nullptr)
+    if (!settingsSaveTickerHandle.IsValid())
     {
-        this->ftsc = MakeShareable(new FThreadSafeCounter(0));
+        settingsSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FeatureResourceManager::TickSettingsSave), 0.5f);
     }
 }
 
@@ -78,8 +113,11 @@ CoreLibrary FeatureResourceManager::GetCoreLibraryFromModule() const
 
 void FeatureResourceManager::InitializeSettings(bool reinitialize)
 {
+    // Changes not saved yet belong to the instance about to be released
+    FScopeLock lock(&settingsSaveMutex);
     if (this->settingInstanceHandle != nullptr && reinitialize)
     {
+        FlushSettingsSave();
         GetCoreLibraryFromModule().CoreWrapper->GameKitSettingsInstanceRelease(this->settingInstanceHandle);
         this->settingInstanceHandle = nullptr;
     }
@@ -88,18 +126,60 @@ void FeatureResourceManager::InitializeSettings(bool reinitialize)
     {
         this->settingInstanceHandle = GetCoreLibraryFromModule().CoreWrapper->GameKitSettingsInstanceCreate(
             TCHAR_TO_UTF8(*this->GetRootPath()), TCHAR_TO_UTF8(*this->GetPluginVersion()), this->accountInfoCopy.gameName.c_str(), this->accountInfoCopy.environment.GetEnvironmentString().c_str(), FGameKitLogging::LogCallBack);
+        InvalidateSettingsSnapshot();
     }
 }
 
 void FeatureResourceManager::Log(unsigned int level, const FString& message)
 {
-    this->featuresLog += message + "\n";
+    AppendLog(message);
+}
+
+void FeatureResourceManager::AppendLog(const FString& message)
+{
+    FScopeLock lock(&featuresLogMutex);
+    if (featuresLog.Num() < LOG_CAPACITY)
+    {
+        featuresLog.Add(message);
+    }
+    else
+    {
+        featuresLog[featuresLogHead] = message;
+        featuresLogHead = (featuresLogHead + 1) % LOG_CAPACITY;
+    }
+    ++featuresLogNextSequence;
+}
+
+FString FeatureResourceManager::GetLog() const
+{
+    uint64 cursor = 0;
+    TArray<FString> messages;
+    ReadLog(cursor, messages);
+    return messages.Num() > 0 ? FString::Join(messages, TEXT("\n")) + TEXT("\n") : FString();
+}
+
+void FeatureResourceManager::ReadLog(uint64& cursor, TArray<FString>& outMessages) const
+{
+    FScopeLock lock(&featuresLogMutex);
+    const int32 count = featuresLog.Num();
+    const uint64 oldestSequence = featuresLogNextSequence - count;
+    cursor = FMath::Max(cursor, oldestSequence);
+
+    outMessages.Reserve(outMessages.Num() + static_cast<int32>(featuresLogNextSequence - cursor));
+    for (; cursor < featuresLogNextSequence; ++cursor)
+    {
+        outMessages.Add(featuresLog[(featuresLogHead + static_cast<int32>(cursor - oldestSequence)) % count]);
+    }
 }
 
 void FeatureResourceManager::SetAccountDetails(const AccountDetails& accountDetails)
 {
-    this->accountInfoCopy = accountDetails.CreateAccountInfoCopy();
-    this->credentialsCopy = accountDetails.CreateAccountCredentialsCopy();
+    {
+        FScopeLock lock(&stackStatusInstancesMutex);
+        this->accountInfoCopy = accountDetails.CreateAccountInfoCopy();
+        this->credentialsCopy = accountDetails.CreateAccountCredentialsCopy();
+        ReleaseStackStatusInstances();
+    }
 
     InitializeSettings(true);
 }
@@ -129,7 +209,11 @@ void FeatureResourceManager::SetAccountDetails(const TMap<FString, FString>& cre
 
 void FeatureResourceManager::SetGameName(const FString& gameName)
 {
-    this->accountInfoCopy.gameName = TCHAR_TO_UTF8(*gameName);
+    {
+        FScopeLock lock(&stackStatusInstancesMutex);
+        this->accountInfoCopy.gameName = TCHAR_TO_UTF8(*gameName);
+        ReleaseStackStatusInstances();
+    }
     InitializeSettings(true);
 }
 
@@ -153,17 +237,42 @@ void FeatureResourceManager::Shutdown()
 {
     LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::Shutdown()"));
 
-    if (this->ftsc != nullptr)
+    ReleaseStackStatusInstances();
+
+    if (settingsSaveTickerHandle.IsValid())
     {
-        this->ftsc.Reset();
-        this->ftsc = nullptr;
+        FTSTicker::GetCoreTicker().RemoveTicker(settingsSaveTickerHandle);
+        settingsSaveTickerHandle.Reset();
     }
+    FlushSettingsSave();
+
     FGameKitLogging::DetachLogger(this);
 }
 
 IntResult FeatureResourceManager::CreateOrUpdateFeatureResources(FeatureType featureType)
 {
     featureRunningStates.FindOrAdd(featureType) = FeatureRunningState::Running;
+
+    // When nothing the stack is built from changed since its last deployment, only check that it's still deployed
+    const FString stackHashName = GetDeployHashName(featureType, TEXT("stack"));
+    void* featureResourcesInstance = this->SetupResourcesInstance(
+        GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
+        GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
+        featureType);
+    const bool stackInputsUnchanged = this->ComputeStackInputsHash(featureResourcesInstance, featureType) == this->LoadDeployHash(stackHashName);
+    if (stackInputsUnchanged)
+    {
+        std::string stackStatus;
+        const unsigned int statusResult = this->DescribeStackStatus(featureType, stackStatus);
+        if (SimplifyStackStatus(stackStatus, statusResult) == DEPLOYED_STATUS_TEXT)
+        {
+            LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::CreateOrUpdateFeatureResources() " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " unchanged since its last deployment, skipped"));
+            GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesInstanceRelease(featureResourcesInstance);
+            featureRunningStates[featureType] = FeatureRunningState::NotRunning;
+            return IntResult(GameKit::GAMEKIT_SUCCESS);
+        }
+    }
+
     void* gamekitResourcesInstance = this->SetupResourcesInstance(
         GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
@@ -180,6 +289,7 @@ IntResult FeatureResourceManager::CreateOrUpdateFeatureResources(FeatureType fea
         FString const message = result.ErrorMessage + " : " + error + ". Please find more details in " + AwsGameKitDocumentationManager::GetDocumentString("dev_guide_url", "known_issues_reference");
         LOG_FEATURE_MESSAGE(message);
         GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
+        GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesInstanceRelease(featureResourcesInstance);
         featureRunningStates[featureType] = FeatureRunningState::NotRunning;
         return result;
     }
@@ -192,7 +302,11 @@ IntResult FeatureResourceManager::CreateOrUpdateFeatureResources(FeatureType fea
         TCHAR_TO_ANSI(*pluginRootPath),
         FGameKitLogging::LogCallBack
     );
-    result = coreLibrary.CoreWrapper->GameKitAccountDeployApiGatewayStage(accountInstance);
+    {
+        // The features share the main stack's API Gateway, whose deployments are throttled per account
+        FScopeLock stageLock(&apiGatewayStageMutex);
+        result = coreLibrary.CoreWrapper->GameKitAccountDeployApiGatewayStage(accountInstance);
+    }
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
         result.ErrorMessage = FString("Error: FeatureResourceManager::CreateOrUpdateResources() for " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " feature: Could not Deploy to ApiGateway stage.");
@@ -200,9 +314,15 @@ IntResult FeatureResourceManager::CreateOrUpdateFeatureResources(FeatureType fea
         FString const message = result.ErrorMessage + " : " + error;
         LOG_FEATURE_MESSAGE(message);
     }
+    else
+    {
+        // Hashed after the deployment, which writes the instance parameters
+        this->SaveDeployHash(stackHashName, this->ComputeStackInputsHash(featureResourcesInstance, featureType));
+    }
 
     featureRunningStates[featureType] = FeatureRunningState::NotRunning;
     coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
+    coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(featureResourcesInstance);
     coreLibrary.CoreWrapper->GameKitAccountInstanceRelease(accountInstance);
 
     return result;
@@ -221,6 +341,8 @@ IntResult FeatureResourceManager::CreateEmptyClientConfigFile()
 
 IntResult FeatureResourceManager::CreateOrUpdateResources(FeatureType featureType)
 {
+    InvalidateDescribedResources(featureType);
+
     if (featureRunningStates[featureType] != FeatureRunningState::Running)
     {
         LOG_FEATURE_MESSAGE(FString("Task status was not in Running state. Resource creation might fail"));
@@ -247,6 +369,7 @@ IntResult FeatureResourceManager::CreateOrUpdateResources(FeatureType featureTyp
     else
     {
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::CreateOrUpdateResources() SUCCESS."));
+        UpdateRegionalClientConfig(featureType, true);
     }
 
     // Reload game configuration in session manager
@@ -277,6 +400,7 @@ IntResult FeatureResourceManager::DeleteFeatureResources(FeatureType featureType
         GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
         featureType);
+    InvalidateDescribedResources(featureType);
     IntResult result(coreLibrary.CoreWrapper->GameKitResourcesInstanceDeleteStack(gamekitResourcesInstance));
     coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
 
@@ -290,6 +414,9 @@ IntResult FeatureResourceManager::DeleteFeatureResources(FeatureType featureType
     else
     {
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::DeleteFeatureResources() SUCCESS"));
+
+        this->DeleteDeployHashes(featureType);
+        this->UpdateRegionalClientConfig(featureType, false);
     }
 
     featureRunningStates[featureType] = FeatureRunningState::NotRunning;
@@ -298,6 +425,25 @@ IntResult FeatureResourceManager::DeleteFeatureResources(FeatureType featureType
 
 IntResult FeatureResourceManager::DescribeFeatureResources(FeatureType featureType, TArray<FString>& outResources)
 {
+    outResources.Reset();
+    return DescribeFeatureResources(featureType, [&outResources](const FString& resource) { outResources.Add(resource); });
+}
+
+IntResult FeatureResourceManager::DescribeFeatureResources(FeatureType featureType, const TFunction<void(const FString&)>& onResourceDescribed)
+{
+    {
+        FScopeLock lock(&describedResourcesMutex);
+        if (const TArray<FString>* cachedResources = describedResourcesCache.Find(featureType))
+        {
+            LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::DescribeFeatureResources() Using the resources described since the last deployment."));
+            for (const FString& resource : *cachedResources)
+            {
+                onResourceDescribed(resource);
+            }
+            return IntResult(GameKit::GAMEKIT_SUCCESS);
+        }
+    }
+
     CoreLibrary coreLibrary = GetCoreLibraryFromModule();
 
     LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::DescribeFeatureResources()"));
@@ -306,9 +452,21 @@ IntResult FeatureResourceManager::DescribeFeatureResources(FeatureType featureTy
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
         featureType);
 
-    resourceInfoCache.Reset();
-    IntResult result(coreLibrary.CoreWrapper->GameKitResourcesDescribeStackResources(gamekitResourcesInstance, ResourceInfoCallback));
-    outResources = resourceInfoCache;
+    // Each resource is passed on as soon as its page of the stack's resources arrives
+    TArray<FString> describedResources;
+    const TFunction<void(const char*, const char*, const char*)> sink = [&describedResources, &onResourceDescribed](const char* logicalResourceId, const char* resourceType, const char* resourceStatus)
+    {
+        describedResources.Add(FormatResourceInfo(ANSI_TO_TCHAR(logicalResourceId), ANSI_TO_TCHAR(resourceType), ANSI_TO_TCHAR(resourceStatus)));
+        onResourceDescribed(describedResources.Last());
+    };
+
+    IntResult result;
+    {
+        FScopeLock lock(&resourceInfoMutex);
+        resourceInfoSink = &sink;
+        result = IntResult(coreLibrary.CoreWrapper->GameKitResourcesDescribeStackResources(gamekitResourcesInstance, ResourceInfoCallback));
+        resourceInfoSink = nullptr;
+    }
     coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
@@ -321,12 +479,103 @@ IntResult FeatureResourceManager::DescribeFeatureResources(FeatureType featureTy
     else
     {
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::DescribeFeatureResources() SUCCESS"));
+
+        FScopeLock lock(&describedResourcesMutex);
+        describedResourcesCache.Add(featureType, MoveTemp(describedResources));
     }
 
     return result;
 }
 
-FString FeatureResourceManager::GetAccountId(const FString& accessKey, const FString& secretKey)
+void FeatureResourceManager::WatchStackProgress(FeatureType featureType, FEvent* stopEvent, const TFunction<void(const FStackProgress&)>& onProgress)
+{
+    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
+    void* gamekitResourcesInstance = this->SetupResourcesInstance(
+        GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
+        GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
+        featureType);
+
+    // Status of each resource as of the previous pass, so that only the changes are reported
+    TMap<FString, FString> resourceStatuses;
+
+    // Status of each resource as of the first pass. On a stack update, the resources the previous deployment left complete only count once they change,
+    // so the progress doesn't start at N/N. The stack of a first deployment doesn't exist yet on the first pass, every resource counts then.
+    TMap<FString, FString> baselineStatuses;
+    TSet<FString> changedSinceBaseline;
+    bool hasBaseline = false;
+    do
+    {
+        FStackProgress progress;
+        TMap<FString, FString> currentStatuses;
+        const TFunction<void(const char*, const char*, const char*)> sink = [&](const char* logicalResourceId, const char* resourceType, const char* resourceStatus)
+        {
+            const FString id = ANSI_TO_TCHAR(logicalResourceId);
+            const FString status = ANSI_TO_TCHAR(resourceStatus);
+            const FString* previousStatus = resourceStatuses.Find(id);
+            if (previousStatus == nullptr || *previousStatus != status)
+            {
+                progress.changedResources.Add(FormatResourceInfo(id, ANSI_TO_TCHAR(resourceType), status));
+            }
+            currentStatuses.Add(id, status);
+
+            if (!hasBaseline)
+            {
+                baselineStatuses.Add(id, status);
+                return;
+            }
+
+            // Once changed, a resource keeps counting, so the counts don't go down
+            const FString* baselineStatus = baselineStatuses.Find(id);
+            if (baselineStatus != nullptr && *baselineStatus == status && !changedSinceBaseline.Contains(id))
+            {
+                return;
+            }
+            changedSinceBaseline.Add(id);
+
+            if (status.EndsWith(TEXT("_COMPLETE")))
+            {
+                ++progress.completedResources;
+            }
+            else if (status.EndsWith(TEXT("_FAILED")))
+            {
+                ++progress.failedResources;
+            }
+        };
+
+        IntResult result;
+        {
+            FScopeLock lock(&resourceInfoMutex);
+            resourceInfoSink = &sink;
+            result = IntResult(coreLibrary.CoreWrapper->GameKitResourcesDescribeStackResources(gamekitResourcesInstance, ResourceInfoCallback));
+            resourceInfoSink = nullptr;
+        }
+        hasBaseline = true;
+
+        // The stack may not exist yet on its first deployment
+        if (result.Result == GameKit::GAMEKIT_SUCCESS && progress.changedResources.Num() > 0)
+        {
+            progress.totalResources = currentStatuses.Num();
+            resourceStatuses = MoveTemp(currentStatuses);
+            onProgress(progress);
+        }
+    } while (!stopEvent->Wait(FTimespan::FromSeconds(STACK_PROGRESS_INTERVAL_SECONDS)));
+
+    coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
+}
+
+void FeatureResourceManager::InvalidateDescribedResources(FeatureType featureType)
+{
+    FScopeLock lock(&describedResourcesMutex);
+    describedResourcesCache.Remove(featureType);
+}
+
+void FeatureResourceManager::InvalidateAllDescribedResources()
+{
+    FScopeLock lock(&describedResourcesMutex);
+    describedResourcesCache.Empty();
+}
+
+FString FeatureResourceManager::GetAccountId(const FString& accessKey, const FString& secretKey, EAccountIdFailure* outFailure)
 {
     FString accountId;
     auto accountSetter = [&accountId](const char* acctId)
@@ -335,21 +584,66 @@ FString FeatureResourceManager::GetAccountId(const FString& accessKey, const FSt
     };
     typedef LambdaDispatcher<decltype(accountSetter), void, const char*> AccountSetter;
 
+    FString stsLog;
+    accountIdLogSink = &stsLog;
     CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-    IntResult result = coreLibrary.CoreWrapper->GameKitGetAwsAccountId((void*)&accountSetter, AccountSetter::Dispatch, TCHAR_TO_UTF8(*accessKey), TCHAR_TO_UTF8(*secretKey), FGameKitLogging::LogCallBack);
+    IntResult result = coreLibrary.CoreWrapper->GameKitGetAwsAccountId((void*)&accountSetter, AccountSetter::Dispatch, TCHAR_TO_UTF8(*accessKey), TCHAR_TO_UTF8(*secretKey), AccountIdLogCallback);
+    accountIdLogSink = nullptr;
 
-    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    EAccountIdFailure failure = EAccountIdFailure::None;
+    if (result.Result != GameKit::GAMEKIT_SUCCESS || accountId.IsEmpty())
     {
-        result.ErrorMessage = FString("Error: FeatureResourceManager::GetAccountId() Failed to retrieve account.");
+        // The status code is the same for every STS error, only the logged error code says whether the keys were rejected
+        const bool credentialsRejected = stsLog.Contains(TEXT("InvalidClientTokenId")) || stsLog.Contains(TEXT("SignatureDoesNotMatch"));
+        failure = credentialsRejected ? EAccountIdFailure::InvalidCredentials : EAccountIdFailure::Unreachable;
+
+        result.ErrorMessage = credentialsRejected
+            ? FString("Error: FeatureResourceManager::GetAccountId() Failed to retrieve account, the credentials are not valid.")
+            : FString("Error: FeatureResourceManager::GetAccountId() Failed to retrieve account, AWS could not be reached or throttled the request.");
         FString const error = GameKit::StatusCodeToHexFStr(result.Result);
         FString const message = result.ErrorMessage + " : " + error;
         LOG_FEATURE_MESSAGE(message);
         accountId = "";
     }
 
+    // Only forget the account id when the keys were rejected, a network error says nothing about them
+    const FString cachePath = GetAccountIdCachePath(accessKey, secretKey);
+    if (failure == EAccountIdFailure::InvalidCredentials)
+    {
+        IFileManager::Get().Delete(*cachePath, false, false, true);
+    }
+    else if (failure == EAccountIdFailure::None)
+    {
+        FFileHelper::SaveStringToFile(accountId, *cachePath);
+    }
+
+    if (outFailure != nullptr)
+    {
+        *outFailure = failure;
+    }
+    return accountId;
+}
+
+FString FeatureResourceManager::GetCachedAccountId(const FString& accessKey, const FString& secretKey) const
+{
+    FString accountId;
+    if (!accessKey.IsEmpty() && !secretKey.IsEmpty() && FFileHelper::LoadFileToString(accountId, *GetAccountIdCachePath(accessKey, secretKey)))
+    {
+        accountId.TrimStartAndEndInline();
+    }
+
     return accountId;
 }
 
+FString FeatureResourceManager::GetAccountIdCachePath(const FString& accessKey, const FString& secretKey)
+{
+    // Keyed by a hash, so neither key is written to disk. A rotated secret key misses the cache.
+    FMD5 md5;
+    HashString(md5, accessKey);
+    HashString(md5, secretKey);
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("AccountIds"), FinalizeHash(md5) + TEXT(".txt"));
+}
+
 bool FeatureResourceManager::IsAccountInfoValid(const AccountDetails& accountDetails)
 {
     CoreLibrary coreLibrary = GetCoreLibraryFromModule();
@@ -383,66 +677,132 @@ void* FeatureResourceManager::SetupResourcesInstance(const AccountInfo accountIn
     return gamekitResourcesInstance;
 }
 
-std::string FeatureResourceManager::GetResourcesStackStatus(FeatureType featureType)
+FeatureResourceManager::FStackStatusInstance::~FStackStatusInstance()
 {
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-
-    if (featureRunningStates.Find(featureType) == nullptr)
+    if (coreWrapper.IsValid() && handle != nullptr)
     {
-        // state is only set when creating or deleting resources, so it is safe to
-        // assume not tasks are running before calling AWS
-        featureRunningStates.FindOrAdd(featureType) = FeatureRunningState::NotRunning;
+        coreWrapper->GameKitResourcesInstanceRelease(handle);
     }
+}
+
+TSharedPtr<FeatureResourceManager::FStackStatusInstance, ESPMode::ThreadSafe> FeatureResourceManager::GetStackStatusInstance(FeatureType featureType)
+{
+    FScopeLock lock(&stackStatusInstancesMutex);
 
-    if (featureRunningStates[featureType] == FeatureRunningState::Running)
+    TSharedPtr<FStackStatusInstance, ESPMode::ThreadSafe>& instance = stackStatusInstances.FindOrAdd(featureType);
+    if (!instance.IsValid())
     {
-        return WORKING_STATUS_TEXT;
+        instance = MakeShared<FStackStatusInstance, ESPMode::ThreadSafe>();
+        instance->coreWrapper = GetCoreLibraryFromModule().CoreWrapper;
+        instance->handle = this->SetupResourcesInstance(
+            GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
+            GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
+            featureType);
     }
 
-    LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::GetResourcesStackStatus()"));
-    void* gamekitResourcesInstance = this->SetupResourcesInstance(
-        GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
-        GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
-        featureType);
-
-    std::string status;
-    auto stackStatusSetter = [&status](const char* stackStatus)
-    {
-        status = stackStatus;
-    };
-    typedef LambdaDispatcher<decltype(stackStatusSetter), void, const char*> StackStatusSetter;
+    return instance;
+}
 
-    IntResult result = coreLibrary.CoreWrapper->GameKitResourcesGetCurrentStackStatus(gamekitResourcesInstance, &stackStatusSetter, StackStatusSetter::Dispatch);
-    coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gamekitResourcesInstance);
+void FeatureResourceManager::ReleaseStackStatusInstances()
+{
+    // Status checks still running keep their instance until they are done
+    FScopeLock lock(&stackStatusInstancesMutex);
+    stackStatusInstances.Empty();
 
-    FString const message = FString("FeatureResourceManager::GetResourcesStackStatus() : ") + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " : " + status.c_str();
-    LOG_FEATURE_MESSAGE(message);
+    // The resources described belong to the stacks of the previous account details
+    InvalidateAllDescribedResources();
+}
 
-    // simplify status text
-    if (status == "ROLLBACK_COMPLETE" ||
-        status == "UPDATE_ROLLBACK_COMPLETE" ||
-        status == "IMPORT_ROLLBACK_COMPLETE")
+std::string FeatureResourceManager::SimplifyStackStatus(const std::string& stackStatus, unsigned int result)
+{
+    if (stackStatus == "ROLLBACK_COMPLETE" ||
+        stackStatus == "UPDATE_ROLLBACK_COMPLETE" ||
+        stackStatus == "IMPORT_ROLLBACK_COMPLETE")
+    {
+        return ROLLBACK_COMPLETE_STATUS_TEXT;
+    }
+    else if (stackStatus == "DELETE_COMPLETE" || result == GameKit::GAMEKIT_ERROR_CLOUDFORMATION_NO_CURRENT_STACK_STATUS)
     {
-        status = ROLLBACK_COMPLETE_STATUS_TEXT;
+        return UNDEPLOYED_STATUS_TEXT;
     }
-    else if (status == "DELETE_COMPLETE" || result.Result == GameKit::GAMEKIT_ERROR_CLOUDFORMATION_NO_CURRENT_STACK_STATUS)
+    else if (stackStatus.find("IN_PROGRESS") != std::string::npos)
     {
-        status = UNDEPLOYED_STATUS_TEXT;
+        return WORKING_STATUS_TEXT;
     }
-    else if (status.find("IN_PROGRESS") != std::string::npos)
+    else if (stackStatus.find("COMPLETE") != std::string::npos)
     {
-        status = WORKING_STATUS_TEXT;
+        return DEPLOYED_STATUS_TEXT;
     }
-    else if (status.find("COMPLETE") != std::string::npos)
+    else if (stackStatus.find("FAILED") != std::string::npos)
+    {
+        return ERROR_STATUS_TEXT;
+    }
+
+    return stackStatus;
+}
+
+unsigned int FeatureResourceManager::DescribeStackStatus(FeatureType featureType, std::string& outStackStatus)
+{
+    TSharedPtr<FStackStatusInstance, ESPMode::ThreadSafe> instance = GetStackStatusInstance(featureType);
+
+    auto stackStatusSetter = [&outStackStatus](const char* stackStatus)
+    {
+        outStackStatus = stackStatus;
+    };
+    typedef LambdaDispatcher<decltype(stackStatusSetter), void, const char*> StackStatusSetter;
+
+    return instance->coreWrapper->GameKitResourcesGetCurrentStackStatus(instance->handle, &stackStatusSetter, StackStatusSetter::Dispatch);
+}
+
+std::string FeatureResourceManager::GetResourcesStackStatus(FeatureType featureType)
+{
+    return GetResourcesStackStatuses({ featureType }).FindRef(featureType);
+}
+
+TMap<FeatureType, std::string> FeatureResourceManager::GetResourcesStackStatuses(const TArray<FeatureType>& featureTypes)
+{
+    TMap<FeatureType, std::string> statuses;
+    TArray<FeatureType> stacksToCheck;
+    for (const FeatureType featureType : featureTypes)
     {
-        status = DEPLOYED_STATUS_TEXT;
+        if (featureRunningStates.Find(featureType) == nullptr)
+        {
+            // state is only set when creating or deleting resources, so it is safe to
+            // assume not tasks are running before calling AWS
+            featureRunningStates.FindOrAdd(featureType) = FeatureRunningState::NotRunning;
+        }
+
+        if (featureRunningStates[featureType] == FeatureRunningState::Running)
+        {
+            statuses.Add(featureType, WORKING_STATUS_TEXT);
+        }
+        else
+        {
+            stacksToCheck.Add(featureType);
+        }
     }
-    else if (status.find("FAILED") != std::string::npos)
+
+    LOG_FEATURE_MESSAGE(FString::Printf(TEXT("FeatureResourceManager::GetResourcesStackStatuses() : %d stacks"), stacksToCheck.Num()));
+
+    // GameKit describes one stack per resources instance, the stacks are described together from the instances kept since the last check
+    TArray<std::string> stackStatuses;
+    TArray<unsigned int> results;
+    stackStatuses.SetNum(stacksToCheck.Num());
+    results.SetNumZeroed(stacksToCheck.Num());
+    ParallelFor(stacksToCheck.Num(), [this, &stacksToCheck, &stackStatuses, &results](int32 index)
+        {
+            results[index] = DescribeStackStatus(stacksToCheck[index], stackStatuses[index]);
+        });
+
+    for (int32 i = 0; i < stacksToCheck.Num(); ++i)
     {
-        status = ERROR_STATUS_TEXT;
+        FString const message = FString("FeatureResourceManager::GetResourcesStackStatuses() : ") + AwsGameKitEnumConverter::FeatureToUIString(stacksToCheck[i]) + " : " + stackStatuses[i].c_str();
+        LOG_FEATURE_MESSAGE(message);
+
+        statuses.Add(stacksToCheck[i], SimplifyStackStatus(stackStatuses[i], results[i]));
     }
 
-    return status;
+    return statuses;
 }
 
 bool FeatureResourceManager::IsTaskInProgress(FeatureType featureType) const
@@ -594,9 +954,7 @@ IntResult FeatureResourceManager::GenerateFeatureInstanceFiles(FeatureType featu
         }
     }
     
-    // No helper currently exists to retrieve the layers path; manually construct the proper directory path based on the CloudFormation path
-    FString layerInstancesPath = FPaths::Combine(cloudFormationInstancePath, FString("../../layers"), FString(GetFeatureTypeString(featureType).c_str()));
-    FPaths::CollapseRelativeDirectories(layerInstancesPath);
+    const FString layerInstancesPath = GetInstanceLayersPath(resourceInstance, featureType);
     if (FPaths::DirectoryExists(layerInstancesPath))
     {
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::GenerateFeatureInstanceFiles() Using existing Lambda Layer instance files."));
@@ -697,6 +1055,18 @@ IntResult FeatureResourceManager::UploadDashboards(FeatureType featureType)
     featureRunningStates.FindOrAdd(featureType) = FeatureRunningState::Running;
     LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadDashboards()"));
 
+    void* resourcesInstance = this->SetupResourcesInstance(
+        GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
+        GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
+        featureType);
+    const FString dashboardsHash = this->ComputeDashboardsHash(resourcesInstance);
+    coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(resourcesInstance);
+    if (dashboardsHash == this->LoadDeployHash(TEXT("dashboards")))
+    {
+        LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadDashboards() unchanged since the last upload, skipped"));
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
     void* accountInstance = coreLibrary.CoreWrapper->GameKitAccountInstanceCreateWithRootPaths(
         GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
@@ -717,6 +1087,7 @@ IntResult FeatureResourceManager::UploadDashboards(FeatureType featureType)
     }
     else
     {
+        this->SaveDeployHash(TEXT("dashboards"), dashboardsHash);
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadDashboards() SUCCESS"));
     }
 
@@ -741,6 +1112,16 @@ IntResult FeatureResourceManager::UploadLayersByFeature(FeatureType featureType)
         GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
         featureType);
+
+    const FString hashName = GetDeployHashName(featureType, TEXT("layers"));
+    const FString sourceHash = this->ComputeArtifactsHash(gameKitResourcesInstance, featureType, TEXT("layers"));
+    if (sourceHash == this->LoadDeployHash(hashName))
+    {
+        coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gameKitResourcesInstance);
+        LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadLayers() " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " unchanged since the last upload, skipped"));
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
     IntResult result(coreLibrary.CoreWrapper->GameKitResourcesUploadFeatureLayers(gameKitResourcesInstance));
     coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gameKitResourcesInstance);
 
@@ -754,6 +1135,7 @@ IntResult FeatureResourceManager::UploadLayersByFeature(FeatureType featureType)
     }
     else
     {
+        this->SaveDeployHash(hashName, sourceHash);
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadLayers() " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " SUCCESS"));
     }
 
@@ -778,6 +1160,16 @@ IntResult FeatureResourceManager::UploadFunctionsByFeature(FeatureType featureTy
         GAMEKIT_ACCOUNTINFO_CHAR_PTR_VIEW(this->accountInfoCopy),
         GAMEKIT_ACCOUNTCREDENTIALS_CHAR_PTR_VIEW(this->credentialsCopy),
         featureType);
+
+    const FString hashName = GetDeployHashName(featureType, TEXT("functions"));
+    const FString sourceHash = this->ComputeArtifactsHash(gameKitResourcesInstance, featureType, TEXT("functions"));
+    if (sourceHash == this->LoadDeployHash(hashName))
+    {
+        coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gameKitResourcesInstance);
+        LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadFunctions() " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " unchanged since the last upload, skipped"));
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
     IntResult result(coreLibrary.CoreWrapper->GameKitResourcesUploadFeatureFunctions(gameKitResourcesInstance));
     coreLibrary.CoreWrapper->GameKitResourcesInstanceRelease(gameKitResourcesInstance);
 
@@ -791,12 +1183,255 @@ IntResult FeatureResourceManager::UploadFunctionsByFeature(FeatureType featureTy
     }
     else
     {
+        this->SaveDeployHash(hashName, sourceHash);
         LOG_FEATURE_MESSAGE(FString("FeatureResourceManager::UploadFunctions() " + AwsGameKitEnumConverter::FeatureToUIString(featureType) + " SUCCESS"));
     }
 
     return result;
 }
 
+FString FeatureResourceManager::GetInstanceLayersPath(void* resourcesInstance, FeatureType featureType) const
+{
+    // No helper currently exists to retrieve the layers path; manually construct the proper directory path based on the CloudFormation path
+    const FString cloudFormationInstancePath = GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesGetInstanceCloudFormationPath(resourcesInstance);
+    FString layerInstancesPath = FPaths::Combine(cloudFormationInstancePath, FString("../../layers"), FString(GetFeatureTypeString(featureType).c_str()));
+    FPaths::CollapseRelativeDirectories(layerInstancesPath);
+    return layerInstancesPath;
+}
+
+FString FeatureResourceManager::GetDeployHashName(FeatureType featureType, const TCHAR* input)
+{
+    return AwsGameKitEnumConverter::FeatureToApiString(featureType) + TEXT("_") + input;
+}
+
+FString FeatureResourceManager::GetDeployHashFilePath(const FString& hashName) const
+{
+    return FPaths::Combine(this->GetRootPath(), FString(this->accountInfoCopy.gameName.c_str()), FString(this->accountInfoCopy.environment.GetEnvironmentString().c_str()),
+        FString(this->credentialsCopy.region.c_str()), TEXT("deployHashes"), hashName + TEXT(".md5"));
+}
+
+FString FeatureResourceManager::LoadDeployHash(const FString& hashName) const
+{
+    FString hash;
+    FFileHelper::LoadFileToString(hash, *GetDeployHashFilePath(hashName));
+    return hash.TrimStartAndEnd();
+}
+
+void FeatureResourceManager::SaveDeployHash(const FString& hashName, const FString& hash) const
+{
+    if (!FFileHelper::SaveStringToFile(hash, *GetDeployHashFilePath(hashName)))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FeatureResourceManager::SaveDeployHash() Could not save the %s hash, it will be deployed again next time"), *hashName);
+    }
+}
+
+void FeatureResourceManager::DeleteDeployHashes(FeatureType featureType) const
+{
+    // Deleting the main stack also removes the layers and empties the bucket holding the functions and dashboards
+    if (featureType == FeatureType::Main)
+    {
+        IFileManager::Get().DeleteDirectory(*FPaths::GetPath(GetDeployHashFilePath(TEXT(""))), false, true);
+        return;
+    }
+
+    for (const TCHAR* input : { TEXT("layers"), TEXT("functions"), TEXT("stack") })
+    {
+        IFileManager::Get().Delete(*GetDeployHashFilePath(GetDeployHashName(featureType, input)), false, false, true);
+    }
+}
+
+FString FeatureResourceManager::GetRegionalClientConfigPath(const FString& region) const
+{
+    return FPaths::Combine(this->GetRootPath(), FString(this->accountInfoCopy.gameName.c_str()), FString(this->accountInfoCopy.environment.GetEnvironmentString().c_str()),
+        region, TEXT("regionalClientConfig.yml"));
+}
+
+void FeatureResourceManager::UpdateRegionalClientConfig(FeatureType featureType, bool isDeployed) const
+{
+    // The keys a feature's deployment writes to awsGameKitClientConfig.yml, the main stack has none
+    FString outputsContents;
+    const FString outputsPath = FPaths::Combine(pluginRootPath, TEXT("configOutputs"), AwsGameKitEnumConverter::FeatureToApiString(featureType), TEXT("clientConfig.yml"));
+    if (featureType == FeatureType::Main || !FFileHelper::LoadFileToString(outputsContents, *outputsPath))
+    {
+        return;
+    }
+
+    TMap<FString, FString> outputKeys;
+    TMap<FString, TMap<FString, FString>> unused;
+    FAwsGameKitRegionSelector::ParseClientConfig(outputsContents, outputKeys, unused);
+
+    const FString clientConfigPath = FPaths::Combine(this->GetRootPath(), this->GetClientConfigSubdirectory(), TEXT("awsGameKitClientConfig.yml"));
+    FString clientConfigContents;
+    if (!FFileHelper::LoadFileToString(clientConfigContents, *clientConfigPath))
+    {
+        return;
+    }
+
+    TMap<FString, FString> settings;
+    FAwsGameKitRegionSelector::ParseClientConfig(clientConfigContents, settings, unused);
+
+    // Record the feature's settings under the region it was just deployed to or deleted from
+    const FString region = FString(this->credentialsCopy.region.c_str());
+    const FString regionalClientConfigPath = GetRegionalClientConfigPath(region);
+    FString regionalContents;
+    FFileHelper::LoadFileToString(regionalContents, *regionalClientConfigPath);
+    TMap<FString, FString> regionSettings;
+    FAwsGameKitRegionSelector::ParseClientConfig(regionalContents, regionSettings, unused);
+    for (const TPair<FString, FString>& outputKey : outputKeys)
+    {
+        const FString* value = settings.Find(outputKey.Key);
+        if (isDeployed && value != nullptr)
+        {
+            regionSettings.Add(outputKey.Key, *value);
+        }
+        else
+        {
+            regionSettings.Remove(outputKey.Key);
+        }
+    }
+
+    if (regionSettings.Num() == 0)
+    {
+        IFileManager::Get().Delete(*regionalClientConfigPath, false, false, true);
+    }
+    else
+    {
+        regionSettings.KeySort(TLess<FString>());
+        FString regionFile;
+        for (const TPair<FString, FString>& setting : regionSettings)
+        {
+            regionFile.Append(setting.Key).Append(TEXT(": ")).Append(setting.Value).Append(TEXT("\n"));
+        }
+        FFileHelper::SaveStringToFile(regionFile, *regionalClientConfigPath);
+    }
+
+    // List every region of the environment, as long as there is more than one
+    TMap<FString, TMap<FString, FString>> regionalSettings;
+    for (const FString& mappedRegion : GetMappedRegions())
+    {
+        FString contents;
+        if (FFileHelper::LoadFileToString(contents, *GetRegionalClientConfigPath(mappedRegion)))
+        {
+            FAwsGameKitRegionSelector::ParseClientConfig(contents, regionalSettings.Add(mappedRegion), unused);
+        }
+    }
+    if (regionalSettings.Num() < 2)
+    {
+        regionalSettings.Reset();
+    }
+
+    const FString updatedContents = FAwsGameKitRegionSelector::SetRegionalSettings(clientConfigContents, regionalSettings);
+    if (updatedContents != clientConfigContents)
+    {
+        LOG_FEATURE_MESSAGE(FString::Printf(TEXT("FeatureResourceManager::UpdateRegionalClientConfig() Listing %d regions in %s"), regionalSettings.Num(), *clientConfigPath));
+        FFileHelper::SaveStringToFile(updatedContents, *clientConfigPath);
+    }
+}
+
+TArray<FString> FeatureResourceManager::GetMappedRegions() const
+{
+    // The regions GameKit can deploy to, listed with their short codes in the region mappings
+    TArray<FString> regions;
+    TArray<FString> lines;
+    FFileHelper::LoadFileToStringArray(lines, *FPaths::Combine(pluginRootPath, TEXT("misc"), TEXT("awsGameKitAwsRegionMappings.yml")));
+    for (const FString& line : lines)
+    {
+        FString region;
+        FString code;
+        if (!line.StartsWith(TEXT("#")) && line.Split(TEXT(":"), &region, &code) && region.TrimStartAndEnd().Contains(TEXT("-")))
+        {
+            regions.Add(region.TrimStartAndEnd());
+        }
+    }
+    return regions;
+}
+
+void FeatureResourceManager::HashString(FMD5& md5, const FString& text)
+{
+    const FTCHARToUTF8 utf8(*text);
+    md5.Update(reinterpret_cast<const uint8*>(utf8.Get()), utf8.Length() + 1);
+}
+
+void FeatureResourceManager::HashDirectory(FMD5& md5, const FString& directory)
+{
+    TArray<FString> files;
+    IFileManager::Get().FindFilesRecursive(files, *directory, TEXT("*"), true, false);
+    files.Sort();
+
+    for (const FString& file : files)
+    {
+        FString relativePath = file;
+        FPaths::MakePathRelativeTo(relativePath, *(directory / TEXT("")));
+        HashString(md5, relativePath);
+        HashString(md5, LexToString(FMD5Hash::HashFile(*file)));
+    }
+}
+
+FString FeatureResourceManager::FinalizeHash(FMD5& md5)
+{
+    uint8 digest[16];
+    md5.Final(digest);
+    return BytesToHex(digest, UE_ARRAY_COUNT(digest));
+}
+
+FString FeatureResourceManager::ComputeArtifactsHash(void* resourcesInstance, FeatureType featureType, const TCHAR* artifactKind) const
+{
+    // The layers and functions are zipped from the instance files. The account is hashed, the game, environment and region are part of the hash file's path.
+    const FString artifactsPath = FCString::Strcmp(artifactKind, TEXT("layers")) == 0
+        ? GetInstanceLayersPath(resourcesInstance, featureType)
+        : FString(GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesGetInstanceFunctionsPath(resourcesInstance));
+
+    FMD5 md5;
+    HashString(md5, FString(this->accountInfoCopy.accountId.c_str()));
+    HashDirectory(md5, artifactsPath);
+    return FinalizeHash(md5);
+}
+
+FString FeatureResourceManager::ComputeStackInputsHash(void* resourcesInstance, FeatureType featureType)
+{
+    // A stack is built from its instance template and parameters, the feature variables and the layers and functions it points to
+    FMD5 md5;
+    HashString(md5, FString(this->accountInfoCopy.accountId.c_str()));
+    HashDirectory(md5, GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesGetInstanceCloudFormationPath(resourcesInstance));
+
+    TMap<FString, FString> featureVars = this->GetFeatureVariables(featureType);
+    featureVars.KeySort(TLess<FString>());
+    for (const TPair<FString, FString>& featureVar : featureVars)
+    {
+        HashString(md5, featureVar.Key);
+        HashString(md5, featureVar.Value);
+    }
+
+    HashString(md5, LoadDeployHash(GetDeployHashName(featureType, TEXT("layers"))));
+    HashString(md5, LoadDeployHash(GetDeployHashName(featureType, TEXT("functions"))));
+    return FinalizeHash(md5);
+}
+
+FString FeatureResourceManager::ComputeDashboardsHash(void* resourcesInstance)
+{
+    // The dashboards of all the features are uploaded together, from the instance templates of every feature and their variables
+    FString cloudFormationInstancesPath = FPaths::Combine(FString(GetCoreLibraryFromModule().CoreWrapper->GameKitResourcesGetInstanceCloudFormationPath(resourcesInstance)), TEXT(".."));
+    FPaths::CollapseRelativeDirectories(cloudFormationInstancesPath);
+
+    FMD5 md5;
+    HashString(md5, FString(this->accountInfoCopy.accountId.c_str()));
+    HashDirectory(md5, cloudFormationInstancesPath);
+
+    for (const FeatureType featureType : { FeatureType::Main, FeatureType::Identity, FeatureType::Achievements, FeatureType::GameStateCloudSaving, FeatureType::UserGameplayData })
+    {
+        TMap<FString, FString> featureVars = this->GetFeatureVariables(featureType);
+        featureVars.KeySort(TLess<FString>());
+        HashString(md5, AwsGameKitEnumConverter::FeatureToApiString(featureType));
+        for (const TPair<FString, FString>& featureVar : featureVars)
+        {
+            HashString(md5, featureVar.Key);
+            HashString(md5, featureVar.Value);
+        }
+    }
+
+    return FinalizeHash(md5);
+}
+
 IntResult FeatureResourceManager::SaveSecret(const FString& secretName, const FString& secretValue)
 {
     CoreLibrary coreLibrary = GetCoreLibraryFromModule();
@@ -865,6 +1500,7 @@ void FeatureResourceManager::SaveCustomEnvironment(const FString& environmentKey
     coreLibrary.CoreWrapper->GameKitSettingsAddCustomEnvironment(this->settingInstanceHandle, TCHAR_TO_UTF8(*environmentKey), TCHAR_TO_UTF8(*environmentValue));
 
     IntResult result = coreLibrary.CoreWrapper->GameKitSettingsSave(this->settingInstanceHandle);
+    InvalidateSettingsSnapshot();
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
         result.ErrorMessage = FString("Error: FeatureResourceManager::SaveCustomEnvironment() Failed to save.");
@@ -874,79 +1510,79 @@ void FeatureResourceManager::SaveCustomEnvironment(const FString& environmentKey
     }
 }
 
-TMap<FString, FString> FeatureResourceManager::GetFeatureVariables(FeatureType featureType)
+const FString* FeatureResourceManager::FSettingsSnapshot::FindFeatureVariable(FeatureType featureType, const FString& varName) const
 {
-    TMap<FString, FString> vars;
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
+    const TMap<FString, FString>* vars = featureVariables.Find(featureType);
+    return vars != nullptr ? vars->Find(varName) : nullptr;
+}
 
-    auto varsSetter = [&vars](const char* key, const char* value)
+TSharedRef<const FeatureResourceManager::FSettingsSnapshot, ESPMode::ThreadSafe> FeatureResourceManager::GetSettingsSnapshot() const
+{
+    FScopeLock lock(&settingsSnapshotMutex);
+    if (!settingsSnapshot.IsValid())
     {
-        vars.Add(key, value);
-    };
-    typedef LambdaDispatcher<decltype(varsSetter), void, const char*, const char*> VarsSetter;
-
-    coreLibrary.CoreWrapper->GameKitSettingsGetFeatureVariables(
-        this->settingInstanceHandle,
-        (void*)&varsSetter,
-        featureType,
-        VarsSetter::Dispatch);
+        settingsSnapshot = ReadSettingsSnapshot(settingsVersion);
+    }
 
-    return vars;
+    return settingsSnapshot.ToSharedRef();
 }
 
-TMap<FString, FString> FeatureResourceManager::GetSettingsEnvironments() const
+TSharedRef<const FeatureResourceManager::FSettingsSnapshot, ESPMode::ThreadSafe> FeatureResourceManager::ReadSettingsSnapshot(uint32 version) const
 {
-    TMap<FString, FString> environments;
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-
-    FString settingsFile = this->GetRootPath() / FString(this->accountInfoCopy.gameName.c_str()) / "saveInfo.yml";
-    if (!FPaths::FileExists(settingsFile))
+    TSharedRef<FSettingsSnapshot, ESPMode::ThreadSafe> snapshot = MakeShared<FSettingsSnapshot, ESPMode::ThreadSafe>();
+    snapshot->version = version;
+    if (this->settingInstanceHandle == nullptr)
     {
-        return environments;
+        return snapshot;
     }
 
-    auto envSetter = [&environments](const char* key, const char* value)
-    {
-        environments.Add(key, value);
-    };
-    typedef LambdaDispatcher<decltype(envSetter), void, const char*, const char*> EnvSetter;
+    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
 
-    coreLibrary.CoreWrapper->GameKitSettingsGetCustomEnvironments(
-        this->settingInstanceHandle,
-        (void*)&envSetter,
-        EnvSetter::Dispatch);
+    for (const FeatureType featureType : { FeatureType::Main, FeatureType::Identity, FeatureType::Authentication, FeatureType::Achievements, FeatureType::GameStateCloudSaving, FeatureType::UserGameplayData })
+    {
+        TMap<FString, FString>& vars = snapshot->featureVariables.Add(featureType);
+        auto varsSetter = [&vars](const char* key, const char* value)
+        {
+            vars.Add(key, value);
+        };
+        typedef LambdaDispatcher<decltype(varsSetter), void, const char*, const char*> VarsSetter;
 
-    return environments;
-}
+        coreLibrary.CoreWrapper->GameKitSettingsGetFeatureVariables(
+            this->settingInstanceHandle,
+            (void*)&varsSetter,
+            featureType,
+            VarsSetter::Dispatch);
+    }
 
-FString FeatureResourceManager::GetGameName() const
-{
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-    if (this->accountInfoCopy.gameName.length() == 0)
+    FString settingsFile = this->GetRootPath() / FString(this->accountInfoCopy.gameName.c_str()) / "saveInfo.yml";
+    if (FPaths::FileExists(settingsFile))
     {
-        FString gameName;
-        auto gameNameSetter = [&gameName](const char* name)
+        TMap<FString, FString>& environments = snapshot->environments;
+        auto envSetter = [&environments](const char* key, const char* value)
         {
-            gameName = name;
+            environments.Add(key, value);
         };
-        typedef LambdaDispatcher<decltype(gameNameSetter), void, const char*> GameNameSetter;
+        typedef LambdaDispatcher<decltype(envSetter), void, const char*, const char*> EnvSetter;
 
-        coreLibrary.CoreWrapper->GameKitSettingsGetGameName(
+        coreLibrary.CoreWrapper->GameKitSettingsGetCustomEnvironments(
             this->settingInstanceHandle,
-            (void*)&gameNameSetter,
-            GameNameSetter::Dispatch);
-
-        return gameName;
+            (void*)&envSetter,
+            EnvSetter::Dispatch);
     }
 
-    return FString(this->accountInfoCopy.gameName.c_str());
-}
+    FString& gameName = snapshot->gameName;
+    auto gameNameSetter = [&gameName](const char* name)
+    {
+        gameName = name;
+    };
+    typedef LambdaDispatcher<decltype(gameNameSetter), void, const char*> GameNameSetter;
 
-FString FeatureResourceManager::GetLastUsedRegion() const
-{
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-    FString lastUsedRegion;
+    coreLibrary.CoreWrapper->GameKitSettingsGetGameName(
+        this->settingInstanceHandle,
+        (void*)&gameNameSetter,
+        GameNameSetter::Dispatch);
 
+    FString& lastUsedRegion = snapshot->lastUsedRegion;
     auto lastUsedRegionSetter = [&lastUsedRegion](const char* region)
     {
         lastUsedRegion = region;
@@ -958,14 +1594,7 @@ FString FeatureResourceManager::GetLastUsedRegion() const
         (void*)&lastUsedRegionSetter,
         LastUsedRegionSetter::Dispatch);
 
-    return lastUsedRegion;
-}
-
-FString FeatureResourceManager::GetLastUsedEnvironment() const
-{
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-    FString lastUsedEnv;
-
+    FString& lastUsedEnv = snapshot->lastUsedEnvironment;
     auto lastUsedEnvSetter = [&lastUsedEnv](const char* env)
     {
         lastUsedEnv = env;
@@ -977,40 +1606,133 @@ FString FeatureResourceManager::GetLastUsedEnvironment() const
         (void*)&lastUsedEnvSetter,
         LastUsedEnvSetter::Dispatch);
 
-    return lastUsedEnv;
+    return snapshot;
 }
 
-void FeatureResourceManager::SetFeatureVariableIfUnset(FeatureType featureType, const FString& varName, const FString& varValue)
+void FeatureResourceManager::InvalidateSettingsSnapshot()
 {
-    const TMap<FString, FString> featureVars = this->GetFeatureVariables(featureType);
-    if (!featureVars.Contains(varName))
+    FScopeLock lock(&settingsSnapshotMutex);
+    settingsSnapshot.Reset();
+    settingsVersion++;
+}
+
+TMap<FString, FString> FeatureResourceManager::GetFeatureVariables(FeatureType featureType)
+{
+    const TMap<FString, FString>* vars = GetSettingsSnapshot()->featureVariables.Find(featureType);
+    return vars != nullptr ? *vars : TMap<FString, FString>();
+}
+
+TMap<FString, FString> FeatureResourceManager::GetSettingsEnvironments() const
+{
+    return GetSettingsSnapshot()->environments;
+}
+
+FString FeatureResourceManager::GetGameName() const
+{
+    if (this->accountInfoCopy.gameName.length() == 0)
     {
-        this->SetFeatureVariable(featureType, varName, varValue);
+        return GetSettingsSnapshot()->gameName;
     }
+
+    return FString(this->accountInfoCopy.gameName.c_str());
+}
+
+FString FeatureResourceManager::GetLastUsedRegion() const
+{
+    return GetSettingsSnapshot()->lastUsedRegion;
+}
+
+FString FeatureResourceManager::GetLastUsedEnvironment() const
+{
+    return GetSettingsSnapshot()->lastUsedEnvironment;
+}
+
+void FeatureResourceManager::SetFeatureVariableIfUnset(FeatureType featureType, const FString& varName, const FString& varValue)
+{
+    this->SetFeatureVariablesIfUnset(featureType, { { varName, varValue } });
 }
 
 void FeatureResourceManager::SetFeatureVariable(FeatureType featureType, const FString& varName, const FString& varValue)
 {
-    CoreLibrary coreLibrary = GetCoreLibraryFromModule();
-    coreLibrary.CoreWrapper->GameKitSettingsSetFeatureVariables(
-        this->settingInstanceHandle,
-        featureType,
-        std::vector<const char*>({TCHAR_TO_UTF8(*varName)}).data(),
-        std::vector<const char*>({TCHAR_TO_ANSI(*varValue)}).data(),
-        1);
+    this->SetFeatureVariables(featureType, { { varName, varValue } });
+}
+
+void FeatureResourceManager::SetFeatureVariables(FeatureType featureType, const TMap<FString, FString>& vars)
+{
+    if (vars.Num() == 0)
+    {
+        return;
+    }
+
+    // The converted strings must outlive the call
+    std::vector<std::string> convertedStrings;
+    convertedStrings.reserve(vars.Num() * 2);
+    for (const TPair<FString, FString>& var : vars)
+    {
+        convertedStrings.push_back(TCHAR_TO_UTF8(*var.Key));
+        convertedStrings.push_back(TCHAR_TO_UTF8(*var.Value));
+    }
+
+    std::vector<const char*> varKeys;
+    std::vector<const char*> varValues;
+    for (size_t i = 0; i < convertedStrings.size(); i += 2)
+    {
+        varKeys.push_back(convertedStrings[i].c_str());
+        varValues.push_back(convertedStrings[i + 1].c_str());
+    }
 
-    // Debounce our writes so we don't thresh on IO
-    int currentValue = this->ftsc->Increment();
-    Async(EAsyncExecution::Thread, [this, coreLibrary, currentValue]()
     {
-        FPlatformProcess::Sleep(3);
+        FScopeLock lock(&settingsSaveMutex);
+        GetCoreLibraryFromModule().CoreWrapper->GameKitSettingsSetFeatureVariables(this->settingInstanceHandle, featureType, varKeys.data(), varValues.data(), varKeys.size());
+    }
+    InvalidateSettingsSnapshot();
+
+    // Debounce our writes so we don't thresh on IO
+    MarkSettingsDirty();
+}
 
-        if (currentValue == this->ftsc->GetValue())
+void FeatureResourceManager::SetFeatureVariablesIfUnset(FeatureType featureType, const TMap<FString, FString>& vars)
+{
+    const TMap<FString, FString> featureVars = this->GetFeatureVariables(featureType);
+    TMap<FString, FString> unsetVars;
+    for (const TPair<FString, FString>& var : vars)
+    {
+        if (!featureVars.Contains(var.Key))
         {
-            coreLibrary.CoreWrapper->GameKitSettingsSave(this->settingInstanceHandle);
-            this->ftsc->Reset();
+            unsetVars.Add(var.Key, var.Value);
         }
-    });
+    }
+
+    this->SetFeatureVariables(featureType, unsetVars);
+}
+
+void FeatureResourceManager::MarkSettingsDirty()
+{
+    FScopeLock lock(&settingsSaveMutex);
+    areSettingsDirty = true;
+    settingsSaveTime = FPlatformTime::Seconds() + SETTINGS_SAVE_DELAY_SECONDS;
+}
+
+bool FeatureResourceManager::TickSettingsSave(float deltaTime)
+{
+    FScopeLock lock(&settingsSaveMutex);
+    if (areSettingsDirty && FPlatformTime::Seconds() >= settingsSaveTime)
+    {
+        FlushSettingsSave();
+    }
+
+    return true;
+}
+
+void FeatureResourceManager::FlushSettingsSave()
+{
+    FScopeLock lock(&settingsSaveMutex);
+    // On shutdown the runtime module may already be gone, along with the settings instance
+    if (areSettingsDirty && this->settingInstanceHandle != nullptr && FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime") != nullptr)
+    {
+        GetCoreLibraryFromModule().CoreWrapper->GameKitSettingsSave(this->settingInstanceHandle);
+    }
+    areSettingsDirty = false;
 }
 
 void FeatureResourceManager::SaveSettings()
@@ -1043,14 +1765,59 @@ void FeatureResourceManager::SaveSettings()
     coreLibrary.CoreWrapper->GameKitSettingsSetLastUsedEnvironment(this->settingInstanceHandle, this->accountInfoCopy.environment.GetEnvironmentString().c_str());
     coreLibrary.CoreWrapper->GameKitSettingsSetLastUsedRegion(this->settingInstanceHandle, this->credentialsCopy.region.c_str());
 
-    IntResult result = coreLibrary.CoreWrapper->GameKitSettingsSave(this->settingInstanceHandle);
+    IntResult result;
+    {
+        // Any pending debounced save is covered by this one
+        FScopeLock lock(&settingsSaveMutex);
+        result = coreLibrary.CoreWrapper->GameKitSettingsSave(this->settingInstanceHandle);
+        areSettingsDirty = false;
+    }
+    InvalidateSettingsSnapshot();
+
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
         result.ErrorMessage = FString("Error: FeatureResourceManager::SaveSettings() Failed to save.");
         FString const error = GameKit::StatusCodeToHexFStr(result.Result);
         FString const message = result.ErrorMessage + " : " + error;
         LOG_FEATURE_MESSAGE(message);
+        return;
+    }
+
+    // Remember the game, so the next editor session finds its saveInfo.yml without scanning the project
+    FFileHelper::SaveStringToFile(FString(this->accountInfoCopy.gameName.c_str()), *GetLastUsedGameIndexPath());
+}
+
+FString FeatureResourceManager::FindSaveInfoFile() const
+{
+    FString lastUsedGame;
+    if (FFileHelper::LoadFileToString(lastUsedGame, *GetLastUsedGameIndexPath()))
+    {
+        lastUsedGame.TrimStartAndEndInline();
+        const FString saveInfoFile = this->GetRootPath() / lastUsedGame / "saveInfo.yml";
+        if (!lastUsedGame.IsEmpty() && FPaths::FileExists(saveInfoFile))
+        {
+            return saveInfoFile;
+        }
     }
+
+    // The settings are saved in <root>/<game>/saveInfo.yml, so only the root's subdirectories need to be checked
+    FString saveInfoFile;
+    IFileManager::Get().IterateDirectory(*this->GetRootPath(), [&saveInfoFile](const TCHAR* path, bool isDirectory)
+    {
+        if (isDirectory && FPaths::FileExists(FString(path) / "saveInfo.yml"))
+        {
+            saveInfoFile = FString(path) / "saveInfo.yml";
+            return false;
+        }
+        return true;
+    });
+
+    return saveInfoFile;
+}
+
+FString FeatureResourceManager::GetLastUsedGameIndexPath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("LastUsedGame.txt"));
 }
 
 FString FeatureResourceManager::GetPluginVersion() const
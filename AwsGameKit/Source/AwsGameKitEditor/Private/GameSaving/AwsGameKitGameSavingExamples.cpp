@@ -73,6 +73,8 @@ void AAwsGameKitGameSavingExamples::Destroyed()
         LoadSlotWindow.Get()->RequestDestroyWindow();
     }
 
+    stressTest.Reset();
+
     Super::Destroyed();
 }
 
@@ -994,6 +996,74 @@ void AAwsGameKitGameSavingExamples::OnDeleteGameSaveComplete(const IntResult& re
     }
 }
 
+/**
+ * Call the SaveSlot API as set in the Stress Test settings.
+ *
+ * The calls go round the saves "<prefix>-0" to "<prefix>-<count - 1>", each one uploading the same generated bytes and overriding the cloud save.
+ * Their SaveInfo.json files are written like the ones of "3. Save Game", delete the saves afterwards with "5. Delete Game Save" if needed.
+ */
+void AAwsGameKitGameSavingExamples::CallStartStressTest()
+{
+    if (!IsGameSavingDeployed())
+    {
+        return;
+    }
+
+    if (gameSavingInitializationStatus != InitializationStatus::SUCCESSFUL)
+    {
+        InitializeGameSavingLibrary(&AAwsGameKitGameSavingExamples::CallStartStressTest, &StressResults.Status);
+        return;
+    }
+
+    if (stressTest.IsValid() && stressTest->IsRunning())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() a stress test is already running"));
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() called with parameters: SaveNamePrefix=%s, NumberOfSaves=%d, SaveSizeKb=%d"),
+        *StressSlotNamePrefix, StressSlotCount, StressSlotSizeKb);
+
+    // Generate the save data once, all calls upload a copy of it:
+    TArray<uint8> data;
+    data.SetNumUninitialized(FMath::Max(StressSlotSizeKb, 1) * 1024);
+    for (int32 i = 0; i < data.Num(); ++i)
+    {
+        data[i] = static_cast<uint8>(i);
+    }
+
+    const FString slotNamePrefix = StressSlotNamePrefix;
+    const int32 slotCount = FMath::Max(StressSlotCount, 1);
+    stressTest = AwsGameKitEditorStressTest::Start("SaveSlot", StressSettings,
+        [slotNamePrefix, slotCount, data](int32 callIndex, TFunction<void(const IntResult&)> onComplete)
+        {
+            FGameSavingSaveSlotRequest request;
+            request.SlotName = FString::Printf(TEXT("%s-%d"), *slotNamePrefix, callIndex % slotCount);
+            request.SaveInfoFilePath = GetSaveInfoFilePath(request.SlotName);
+            request.Data = data;
+            request.EpochTime = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+            request.OverrideSync = true;
+
+            AwsGameKitGameSaving::SaveSlot(MoveTemp(request), TAwsGameKitDelegate<const IntResult&, const FGameSavingSlotActionResults&>::CreateLambda(
+                [onComplete](const IntResult& result, const FGameSavingSlotActionResults& slotActionResults)
+                {
+                    onComplete(result);
+                }));
+        },
+        [this](const FAwsGameKitStressTestResults& results)
+        {
+            StressResults = results;
+        });
+}
+
+void AAwsGameKitGameSavingExamples::CallStopStressTest()
+{
+    if (stressTest.IsValid())
+    {
+        stressTest->Stop();
+    }
+}
+
 /**
  * Determine the absolute path for where to store the SaveInfo.json file corresponding to the provided save slot.
  *
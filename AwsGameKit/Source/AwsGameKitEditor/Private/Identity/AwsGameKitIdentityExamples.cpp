@@ -12,6 +12,7 @@
 void AAwsGameKitIdentityExamples::BeginDestroy()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AAwsGameKitIdentityExamples::BeginDestroy()"));
+    stressTest.Reset();
     Super::BeginDestroy();
 }
 
@@ -313,6 +314,46 @@ void AAwsGameKitIdentityExamples::OnCompleteIdentityGetIdToken(const IntResult&
     }
 }
 
+/**
+ * Call the GetUser API as set in the Stress Test settings. Login first.
+ */
+void AAwsGameKitIdentityExamples::CallStartStressTest()
+{
+    if (!InitializeIdentityLibrary())
+    {
+        return;
+    }
+
+    if (stressTest.IsValid() && stressTest->IsRunning())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() a stress test is already running"));
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest()"));
+
+    stressTest = AwsGameKitEditorStressTest::Start("GetUser", StressSettings,
+        [](int32 callIndex, TFunction<void(const IntResult&)> onComplete)
+        {
+            AwsGameKitIdentity::GetUser(TAwsGameKitDelegate<const IntResult&, const FGetUserResponse&>::CreateLambda([onComplete](const IntResult& result, const FGetUserResponse& userInfo)
+            {
+                onComplete(result);
+            }));
+        },
+        [this](const FAwsGameKitStressTestResults& results)
+        {
+            StressResults = results;
+        });
+}
+
+void AAwsGameKitIdentityExamples::CallStopStressTest()
+{
+    if (stressTest.IsValid())
+    {
+        stressTest->Stop();
+    }
+}
+
 /**
  * Convert the error code into a readable string.
  */
@@ -229,9 +229,10 @@ void AwsGameKitIdentityLayoutDetails::SaveSettings()
     TSharedPtr<FeatureResourceManager> featureResourceManager = editorModule->GetFeatureResourceManager();
 
     // Save Settings
-    featureResourceManager->SetFeatureVariable(FeatureType::Identity, GAMEKIT_IDENTITY_EMAIL_ENABLED, this->emailCheckbox->IsChecked() ? "true" : "false");
-    featureResourceManager->SetFeatureVariable(FeatureType::Identity, GAMEKIT_IDENTITY_FACEBOOK_ENABLED, this->facebookCheckbox->IsChecked() ? "true" : "false");
-    featureResourceManager->SetFeatureVariable(FeatureType::Identity, GAMEKIT_IDENTITY_FACEBOOK_APP_ID, this->facebookAppId->GetText().ToString());
+    featureResourceManager->SetFeatureVariables(FeatureType::Identity, {
+        { GAMEKIT_IDENTITY_EMAIL_ENABLED, this->emailCheckbox->IsChecked() ? "true" : "false" },
+        { GAMEKIT_IDENTITY_FACEBOOK_ENABLED, this->facebookCheckbox->IsChecked() ? "true" : "false" },
+        { GAMEKIT_IDENTITY_FACEBOOK_APP_ID, this->facebookAppId->GetText().ToString() } });
 
     // Save Secret
     if (!this->facebookAppSecret->GetText().IsEmpty())
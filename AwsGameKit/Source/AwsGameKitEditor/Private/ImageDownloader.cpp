@@ -4,15 +4,47 @@
 #include "ImageDownloader.h"
 
 // GameKit
+#include "Achievements/AwsGameKitIconDiskCache.h"
 #include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
 
 // Unreal
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 
+namespace
+{
+    void SetIconBrush(const TSharedPtr<GameKitImage>& iconImg, const TSharedPtr<GameKitIconBrush>& iconBrush)
+    {
+        iconImg->SetEnabled(true);
+        iconImg->SetImage(iconBrush.Get());
+
+        // Drops the widget's previous brush, which is released if no other widget shows it
+        iconImg->brush = iconBrush;
+    }
+}
+
+GameKitIconBrush::~GameKitIconBrush()
+{
+    // The renderer is gone when the last widgets are destroyed at shutdown
+    if (FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer() != nullptr)
+    {
+        FSlateApplication::Get().GetRenderer()->ReleaseDynamicResource(*this);
+    }
+}
+
+ImageDownloader::~ImageDownloader()
+{
+    if (this->retryTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(this->retryTickerHandle);
+    }
+}
+
 IImageDownloaderPtr ImageDownloader::MakeInstance()
 {
     return MakeShareable(new ImageDownloader());
@@ -26,18 +58,91 @@ void ImageDownloader::SetImageFromUrl(const FString& iconUrl, const TSharedPtr<G
         return;
     }
 
-    // Request to download image and add it to the processed queue
-    TSharedRef<class IHttpRequest, ESPMode::ThreadSafe> httpRequest = FHttpModule::Get().CreateRequest();
-    httpRequest->SetURL(iconUrl);
-    httpRequest->SetVerb(TEXT("GET"));
-    httpRequest->OnProcessRequestComplete().BindThreadSafeSP(this, &ImageDownloader::HandleImageDownload);
+    // Another widget shows this icon, share its brush
+    if (const TSharedPtr<GameKitIconBrush> cachedBrush = FindCachedBrush(iconUrl))
+    {
+        SetIconBrush(iconImg, cachedBrush);
+        return;
+    }
+
+    bool validated;
+    {
+        FScopeLock lock(&this->downloadMutex);
+        if (ImageResource* pending = this->imageDownloads.Find(iconUrl))
+        {
+            // Already downloading, the widget is set when that download completes
+            pending->iconImgs.AddUnique(iconImg);
+            return;
+        }
+
+        ImageResource& resource = this->imageDownloads.Add(iconUrl);
+        resource.iconImgs.Add(iconImg);
+        resource.attempts = retryCount;
+        validated = this->validatedUrls.Contains(iconUrl);
+    }
+
+    TArray<uint8> cachedImgData;
+    FString cachedETag;
+    if (FAwsGameKitIconDiskCache::Load(iconUrl, cachedImgData, cachedETag))
+    {
+        if (validated)
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("ImageDownloader::SetImageFromUrl: %s served from the icon cache"), *iconUrl);
+            CompleteDownload(iconUrl, MoveTemp(cachedImgData));
+            return;
+        }
+
+        FScopeLock lock(&this->downloadMutex);
+        this->imageDownloads.FindChecked(iconUrl).cachedETag = cachedETag;
+    }
+
+    QueueDownload(iconUrl);
+}
+
+void ImageDownloader::QueueDownload(const FString& url)
+{
+    {
+        FScopeLock lock(&this->downloadMutex);
+        this->queuedUrls.Add(url);
+    }
+
+    StartQueuedDownloads();
+}
+
+void ImageDownloader::StartQueuedDownloads()
+{
+    TArray<TPair<FString, FString>> toStart;
     {
         FScopeLock lock(&this->downloadMutex);
-        const ImageResource resource{ iconImg, retryCount };
-        this->imageDownloads.Add(iconUrl, resource);
+        while (this->inFlightDownloads < MAX_CONCURRENT_DOWNLOADS && this->queuedUrls.Num() > 0)
+        {
+            const FString url = this->queuedUrls[0];
+            this->queuedUrls.RemoveAt(0, 1, false);
+
+            const ImageResource* resource = this->imageDownloads.Find(url);
+            if (resource == nullptr)
+            {
+                continue;
+            }
+
+            this->inFlightDownloads++;
+            toStart.Emplace(url, resource->cachedETag);
+        }
     }
 
-    httpRequest->ProcessRequest();
+    for (const TPair<FString, FString>& download : toStart)
+    {
+        // Request to download image, or to confirm that the cached one is still current
+        TSharedRef<class IHttpRequest, ESPMode::ThreadSafe> httpRequest = FHttpModule::Get().CreateRequest();
+        httpRequest->SetURL(download.Key);
+        httpRequest->SetVerb(TEXT("GET"));
+        if (!download.Value.IsEmpty())
+        {
+            httpRequest->SetHeader(TEXT("If-None-Match"), download.Value);
+        }
+        httpRequest->OnProcessRequestComplete().BindThreadSafeSP(this, &ImageDownloader::HandleImageDownload);
+        httpRequest->ProcessRequest();
+    }
 }
 
 void ImageDownloader::HandleImageDownload(FHttpRequestPtr request, FHttpResponsePtr response, bool succeeded)
@@ -46,90 +151,170 @@ void ImageDownloader::HandleImageDownload(FHttpRequestPtr request, FHttpResponse
     const FString url = request->GetURL();
     UE_LOG(LogAwsGameKit, Display, TEXT("ImageDownloader::HandleImageDownload: %s"), *url);
 
-    // Get the SImage widget that needs to be set from the processed queue
+    FString cachedETag;
     bool found;
-    ImageResource resource;
     {
         FScopeLock lock(&this->downloadMutex);
-        found = this->imageDownloads.RemoveAndCopyValue(url, resource);
-    }
+        this->inFlightDownloads--;
 
-    if (!succeeded)
-    {
-        UE_LOG(LogAwsGameKit, Error, TEXT("Failed to download %s; %d: %s"), *url, response->GetResponseCode(), *response->GetContentAsString());
-        // enable so it doesn't keep retrying bad url every ui update (most likely local path).
-        if (resource.iconImg != nullptr)
+        const ImageResource* resource = this->imageDownloads.Find(url);
+        found = resource != nullptr;
+        if (found)
         {
-            resource.iconImg->SetEnabled(true);
+            cachedETag = resource->cachedETag;
         }
-        return;
     }
 
-    if (!found || resource.iconImg == nullptr)
+    // Let the next queued download use the freed slot
+    StartQueuedDownloads();
+
+    if (!found)
     {
         UE_LOG(LogAwsGameKit, Warning, TEXT("Cannot set SImage Widget for %s"), *url);
         return;
     }
 
-    // Get response body of completed request
-    IImageWrapperModule& imageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-    TSharedPtr<IImageWrapper> imgWrapper = imageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-    TArray<uint8> imgData = response->GetContent();
-
-    // Set image wrapper's compressed data
-    bool valid = imgWrapper.IsValid();
-    bool compressed = imgWrapper->SetCompressed(imgData.GetData(), imgData.Num());
-    if (!EHttpResponseCodes::IsOk(response->GetResponseCode()) || !valid || !compressed)
+    if (!succeeded || !response.IsValid())
     {
-        // Retry
-        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [&, url, resource]()
+        UE_LOG(LogAwsGameKit, Error, TEXT("Failed to download %s; %d: %s"), *url,
+            response.IsValid() ? response->GetResponseCode() : 0, response.IsValid() ? *response->GetContentAsString() : TEXT(""));
+
+        // enable so it doesn't keep retrying bad url every ui update (most likely local path).
+        TArray<TSharedPtr<GameKitImage>> iconImgs;
         {
-            if (resource.attempts < DOWNLOAD_MAX_ATTEMPTS)
+            FScopeLock lock(&this->downloadMutex);
+            ImageResource resource;
+            if (this->imageDownloads.RemoveAndCopyValue(url, resource))
             {
-                UE_LOG(LogAwsGameKit, Warning, TEXT("Retrying to download image %s..."), *url);
-                FPlatformProcess::Sleep(DOWNLOAD_RETRY_DELAY_IN_SECONDS);
-                SetImageFromUrl(url, resource.iconImg, resource.attempts + 1);
+                iconImgs = MoveTemp(resource.iconImgs);
             }
-            else
+        }
+        for (const TSharedPtr<GameKitImage>& iconImg : iconImgs)
+        {
+            iconImg->SetEnabled(true);
+        }
+        return;
+    }
+
+    const int32 responseCode = response->GetResponseCode();
+    if (responseCode == EHttpResponseCodes::NotModified && !cachedETag.IsEmpty())
+    {
+        TArray<uint8> cachedImgData;
+        FString eTag;
+        if (FAwsGameKitIconDiskCache::Load(url, cachedImgData, eTag))
+        {
             {
-                UE_LOG(LogAwsGameKit, Error, TEXT("The image %s is not valid."), *url);
-                AsyncTask(ENamedThreads::GameThread, [resource]()
-                {
-                    resource.iconImg->SetEnabled(true);
-                });
+                FScopeLock lock(&this->downloadMutex);
+                this->validatedUrls.Add(url);
             }
-        });
+            CompleteDownload(url, MoveTemp(cachedImgData));
+            return;
+        }
+    }
 
+    if (!EHttpResponseCodes::IsOk(responseCode))
+    {
+        FailDownload(url);
         return;
     }
 
-    // Get the raw data and decode
-    uint32 bytesPerPixel = 4;
-    uint32 bitDepth = 8;
-
-    TArray<uint8> decodedImage;
-    UE_LOG(LogAwsGameKit, Display, TEXT("Downloaded %s"), *url);
-    if (imgWrapper->GetRaw(ERGBFormat::BGRA, bitDepth, decodedImage))
+    const TArray<uint8>& imgData = response->GetContent();
+    const FString eTag = response->GetHeader(TEXT("ETag"));
+    FAwsGameKitIconDiskCache::Save(url, eTag, imgData);
     {
-        decodedImage.AddUninitialized(imgWrapper->GetWidth() * imgWrapper->GetHeight() * bytesPerPixel);
+        FScopeLock lock(&this->downloadMutex);
+        this->validatedUrls.Add(url);
     }
 
-    // Clear any previous dynamic brush
-    if (resource.iconImg->brush != nullptr)
+    CompleteDownload(url, TArray<uint8>(imgData));
+}
+
+void ImageDownloader::CompleteDownload(const FString& url, TArray<uint8> imgData)
+{
+    // The module must be loaded on the game thread, creating wrappers from it is thread safe
+    IImageWrapperModule* imageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+    TWeakPtr<ImageDownloader, ESPMode::ThreadSafe> weakThis = AsShared();
+
+    // Decode on a worker, the widgets waiting for this url stay attached to the pending download until the brush is ready
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [weakThis, imageWrapperModule, url, imgData = MoveTemp(imgData)]()
+    {
+        AWSGAMEKIT_LLM_SCOPE(Achievements);
+        TSharedPtr<ImageDownloader, ESPMode::ThreadSafe> self = weakThis.Pin();
+        if (!self.IsValid())
+        {
+            return;
+        }
+
+        // Set image wrapper's compressed data
+        TSharedPtr<IImageWrapper> imgWrapper = imageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+        TArray64<uint8> rawImage;
+        const uint32 bitDepth = 8;
+        if (!imgWrapper.IsValid() || !imgWrapper->SetCompressed(imgData.GetData(), imgData.Num()) || !imgWrapper->GetRaw(ERGBFormat::BGRA, bitDepth, rawImage))
+        {
+            AsyncTask(ENamedThreads::GameThread, [weakThis, url]()
+            {
+                if (TSharedPtr<ImageDownloader, ESPMode::ThreadSafe> self = weakThis.Pin())
+                {
+                    // Don't revalidate a corrupted cached icon, download it again
+                    {
+                        FScopeLock lock(&self->downloadMutex);
+                        self->validatedUrls.Remove(url);
+                        if (ImageResource* resource = self->imageDownloads.Find(url))
+                        {
+                            resource->cachedETag.Reset();
+                        }
+                    }
+                    self->FailDownload(url);
+                }
+            });
+            return;
+        }
+
+        // The renderer wants a 32-bit sized array, the decoder's buffer is moved into one without copying the pixels
+        const int32 width = imgWrapper->GetWidth();
+        const int32 height = imgWrapper->GetHeight();
+        TArray<uint8> decodedImage(MoveTemp(rawImage));
+        UE_LOG(LogAwsGameKit, Display, TEXT("Downloaded %s"), *url);
+
+        // Only the texture creation runs on the game thread
+        AsyncTask(ENamedThreads::GameThread, [weakThis, url, width, height, decodedImage = MoveTemp(decodedImage)]() mutable
+        {
+            if (TSharedPtr<ImageDownloader, ESPMode::ThreadSafe> self = weakThis.Pin())
+            {
+                self->ApplyDecodedImage(url, width, height, MoveTemp(decodedImage));
+            }
+        });
+    });
+}
+
+void ImageDownloader::ApplyDecodedImage(const FString& url, int32 width, int32 height, TArray<uint8>&& decodedImage)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    // Get the SImage widgets that need to be set
+    ImageResource resource;
     {
-        FSlateApplication::Get().GetRenderer()->ReleaseDynamicResource(*resource.iconImg->brush);
+        FScopeLock lock(&this->downloadMutex);
+        if (!this->imageDownloads.RemoveAndCopyValue(url, resource))
+        {
+            return;
+        }
     }
 
-    // Render decoded data into a brush
+    // Render decoded data into a brush, shared by every widget waiting for this url and the ones requesting it later
+    TSharedPtr<GameKitIconBrush> iconBrush = FindCachedBrush(url);
     const FName resName = FName(*url);
-    if(FSlateApplication::Get().GetRenderer()->GenerateDynamicImageResource(resName, imgWrapper->GetWidth(), imgWrapper->GetHeight(), decodedImage))
+    if (!iconBrush.IsValid() && FSlateApplication::Get().GetRenderer()->GenerateDynamicImageResource(resName, width, height, decodedImage))
     {
-        const FSlateBrush* iconBrush = new FSlateDynamicImageBrush(resName, FVector2D(imgWrapper->GetWidth(), imgWrapper->GetHeight()));
+        iconBrush = MakeShared<GameKitIconBrush>(resName, FVector2D(width, height));
+        this->brushCache.Add(url, iconBrush);
+    }
 
-        // Set the SImage widget's image
-        resource.iconImg->SetEnabled(true);
-        resource.iconImg->SetImage(iconBrush);
-        resource.iconImg->brush = iconBrush;
+    if (iconBrush.IsValid())
+    {
+        for (const TSharedPtr<GameKitImage>& iconImg : resource.iconImgs)
+        {
+            SetIconBrush(iconImg, iconBrush);
+        }
         UE_LOG(LogAwsGameKit, Display, TEXT("SImage Widget set for %s"), *url);
     }
     else
@@ -137,3 +322,94 @@ void ImageDownloader::HandleImageDownload(FHttpRequestPtr request, FHttpResponse
         UE_LOG(LogAwsGameKit, Display, TEXT("Was unable to generate dynamic image brush for %s"), *url);
     }
 }
+
+TSharedPtr<GameKitIconBrush> ImageDownloader::FindCachedBrush(const FString& url)
+{
+    check(IsInGameThread());
+
+    // Forget the brushes no widget shows anymore, they're already released
+    for (auto it = this->brushCache.CreateIterator(); it; ++it)
+    {
+        if (!it.Value().IsValid())
+        {
+            it.RemoveCurrent();
+        }
+    }
+
+    const TWeakPtr<GameKitIconBrush>* cachedBrush = this->brushCache.Find(url);
+    return cachedBrush != nullptr ? cachedBrush->Pin() : nullptr;
+}
+
+void ImageDownloader::FailDownload(const FString& url)
+{
+    ImageResource failed;
+    {
+        FScopeLock lock(&this->downloadMutex);
+        ImageResource* resource = this->imageDownloads.Find(url);
+        if (resource == nullptr)
+        {
+            return;
+        }
+
+        if (resource->attempts < DOWNLOAD_MAX_ATTEMPTS)
+        {
+            // Exponential backoff with equal jitter, so that icons which failed together don't retry together
+            const double backoff = FMath::Min<double>(DOWNLOAD_RETRY_MAX_DELAY_IN_SECONDS, DOWNLOAD_RETRY_DELAY_IN_SECONDS * FMath::Pow(2.0, resource->attempts - 1));
+            const double delay = backoff * 0.5 + FMath::FRandRange(0.0, backoff * 0.5);
+            resource->attempts++;
+
+            UE_LOG(LogAwsGameKit, Warning, TEXT("Retrying to download image %s in %.2f seconds..."), *url, delay);
+            this->scheduledRetries.HeapPush({ FPlatformTime::Seconds() + delay, url });
+            if (!this->retryTickerHandle.IsValid())
+            {
+                this->retryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateThreadSafeSP(this, &ImageDownloader::TickRetries));
+            }
+            return;
+        }
+
+        this->imageDownloads.RemoveAndCopyValue(url, failed);
+    }
+
+    UE_LOG(LogAwsGameKit, Error, TEXT("The image %s is not valid."), *url);
+    AsyncTask(ENamedThreads::GameThread, [failed]()
+    {
+        for (const TSharedPtr<GameKitImage>& iconImg : failed.iconImgs)
+        {
+            iconImg->SetEnabled(true);
+        }
+    });
+}
+
+bool ImageDownloader::TickRetries(float deltaTime)
+{
+    TArray<FString> dueUrls;
+    bool keepTicking = true;
+    {
+        FScopeLock lock(&this->downloadMutex);
+        const double now = FPlatformTime::Seconds();
+        while (this->scheduledRetries.Num() > 0 && this->scheduledRetries.HeapTop().retryAt <= now)
+        {
+            ScheduledRetry due;
+            this->scheduledRetries.HeapPop(due, false);
+            dueUrls.Add(MoveTemp(due.url));
+        }
+
+        if (this->scheduledRetries.Num() == 0)
+        {
+            // Unregistered until the next failure
+            this->retryTickerHandle.Reset();
+            keepTicking = false;
+        }
+    }
+
+    if (dueUrls.Num() > 0)
+    {
+        {
+            FScopeLock lock(&this->downloadMutex);
+            this->queuedUrls.Append(dueUrls);
+        }
+        StartQueuedDownloads();
+    }
+
+    return keepTicking;
+}
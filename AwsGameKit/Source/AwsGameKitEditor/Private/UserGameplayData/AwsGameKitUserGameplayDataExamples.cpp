@@ -15,6 +15,8 @@ void AAwsGameKitUserGameplayDataExamples::BeginDestroy()
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AAwsGameKitUserGameplayDataExamples::BeginDestroy()"));
 
+    stressTest.Reset();
+
     Super::BeginDestroy();
 }
 
@@ -354,6 +356,54 @@ void AAwsGameKitUserGameplayDataExamples::OnDeleteBundleItemsComplete(const IntR
     DeleteBundleItemReturnValue = GetResultMessage(result);
 }
 
+/**
+ * Call the UpdateItem API as set in the Stress Test settings, each call writing its own value to the same item.
+ *
+ * When GameKit.UserGameplayData.WriteBehind.Enabled is 1, the calls are coalesced before they reach the backend.
+ */
+void AAwsGameKitUserGameplayDataExamples::CallStartStressTest()
+{
+    if (!InitializeUserGameplayDataLibrary())
+    {
+        return;
+    }
+
+    if (stressTest.IsValid() && stressTest->IsRunning())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() a stress test is already running"));
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("CallStartStressTest() called with parameters: BundleName=%s, BundleItemKey=%s"), *StressBundleName, *StressBundleItemKey);
+
+    const FString bundleName = StressBundleName;
+    const FString bundleItemKey = StressBundleItemKey;
+    stressTest = AwsGameKitEditorStressTest::Start("UpdateItem", StressSettings,
+        [bundleName, bundleItemKey](int32 callIndex, TFunction<void(const IntResult&)> onComplete)
+        {
+            const FUserGameplayDataBundleItemValue request
+            {
+                bundleName,
+                bundleItemKey,
+                FString::FromInt(callIndex)
+            };
+
+            AwsGameKitUserGameplayData::UpdateItem(request, FAwsGameKitStatusDelegate::CreateLambda(MoveTemp(onComplete)));
+        },
+        [this](const FAwsGameKitStressTestResults& results)
+        {
+            StressResults = results;
+        });
+}
+
+void AAwsGameKitUserGameplayDataExamples::CallStopStressTest()
+{
+    if (stressTest.IsValid())
+    {
+        stressTest->Stop();
+    }
+}
+
 /**
  * Convert the error code into a readable string.
  */
@@ -0,0 +1,160 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Utils/AwsGameKitEditorStressTest.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    const double REPORT_INTERVAL_SECONDS = 0.25;
+
+    float Percentile(const TArray<double>& sortedValues, double percentile)
+    {
+        if (sortedValues.Num() == 0)
+        {
+            return 0.0f;
+        }
+
+        const int32 index = FMath::Clamp(FMath::CeilToInt(percentile * sortedValues.Num()) - 1, 0, sortedValues.Num() - 1);
+        return static_cast<float>(sortedValues[index]);
+    }
+}
+
+TSharedRef<AwsGameKitEditorStressTest> AwsGameKitEditorStressTest::Start(const FString& name, const FAwsGameKitStressTestSettings& settings, StartCallFunction startCall, ResultsFunction onResults)
+{
+    check(IsInGameThread());
+
+    TSharedRef<AwsGameKitEditorStressTest> stressTest = MakeShareable(new AwsGameKitEditorStressTest(name, settings, MoveTemp(startCall), MoveTemp(onResults)));
+    stressTest->tickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(stressTest, &AwsGameKitEditorStressTest::Tick));
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitEditorStressTest: Starting %d %s calls, %.1f per second, %d in flight"),
+        stressTest->settings.CallCount, *name, stressTest->settings.CallsPerSecond, stressTest->settings.Concurrency);
+    return stressTest;
+}
+
+AwsGameKitEditorStressTest::AwsGameKitEditorStressTest(const FString& name, const FAwsGameKitStressTestSettings& settings, StartCallFunction startCall, ResultsFunction onResults)
+    : name(name), settings(settings), startCall(MoveTemp(startCall)), onResults(MoveTemp(onResults))
+{
+    this->settings.CallCount = FMath::Max(this->settings.CallCount, 1);
+    this->settings.Concurrency = FMath::Max(this->settings.Concurrency, 1);
+    latenciesMs.Reserve(this->settings.CallCount);
+    startTime = FPlatformTime::Seconds();
+    results.Status = "Running ...";
+}
+
+AwsGameKitEditorStressTest::~AwsGameKitEditorStressTest()
+{
+    if (tickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(tickerHandle);
+    }
+}
+
+void AwsGameKitEditorStressTest::Stop()
+{
+    if (IsRunning() && !stopRequested)
+    {
+        stopRequested = true;
+        results.Status = FString::Printf(TEXT("Stopping, waiting for %d calls ..."), inFlight);
+        ReportResults();
+    }
+}
+
+bool AwsGameKitEditorStressTest::IsRunning() const
+{
+    return tickerHandle.IsValid();
+}
+
+bool AwsGameKitEditorStressTest::Tick(float deltaTime)
+{
+    const double now = FPlatformTime::Seconds();
+
+    // Calls allowed so far by the rate, the first one right away
+    int32 allowed = settings.CallCount;
+    if (settings.CallsPerSecond > 0.0f)
+    {
+        allowed = FMath::Min(allowed, 1 + FMath::FloorToInt((now - startTime) * settings.CallsPerSecond));
+    }
+
+    while (!stopRequested && results.Started < allowed && inFlight < settings.Concurrency)
+    {
+        const int32 callIndex = results.Started++;
+        inFlight++;
+
+        // Completions of a destroyed test are dropped
+        const TWeakPtr<AwsGameKitEditorStressTest> weakThis = AsShared();
+        const double callStartTime = FPlatformTime::Seconds();
+        startCall(callIndex, [weakThis, callStartTime](const IntResult& result)
+        {
+            if (const TSharedPtr<AwsGameKitEditorStressTest> stressTest = weakThis.Pin())
+            {
+                stressTest->OnCallComplete(callStartTime, result);
+            }
+        });
+    }
+
+    if (inFlight == 0 && (stopRequested || results.Started == settings.CallCount))
+    {
+        endTime = FPlatformTime::Seconds();
+        tickerHandle.Reset();
+        results.Status = FString::Printf(TEXT("%s after %.2f s"), stopRequested ? TEXT("Stopped") : TEXT("Done"), endTime - startTime);
+        ReportResults();
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitEditorStressTest: %s %s, %d succeeded, %d failed, %.1f calls/s, latency p50 %.0f ms, p90 %.0f ms, p99 %.0f ms, max %.0f ms"),
+            *name, *results.Status, results.Succeeded, results.Failed, results.Throughput, results.LatencyP50, results.LatencyP90, results.LatencyP99, results.LatencyMax);
+
+        // Removes the ticker
+        return false;
+    }
+
+    if (now - lastReportTime >= REPORT_INTERVAL_SECONDS)
+    {
+        ReportResults();
+    }
+
+    // Keep ticking
+    return true;
+}
+
+void AwsGameKitEditorStressTest::OnCallComplete(double callStartTime, const IntResult& result)
+{
+    check(IsInGameThread());
+
+    inFlight--;
+    latenciesMs.Add((FPlatformTime::Seconds() - callStartTime) * 1000.0);
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        results.Succeeded++;
+    }
+    else
+    {
+        results.Failed++;
+        results.LastError = GameKit::StatusCodeToHexFStr(result.Result);
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("AwsGameKitEditorStressTest: %s call failed with %s: %s"), *name, *results.LastError, *result.ErrorMessage);
+    }
+}
+
+void AwsGameKitEditorStressTest::ReportResults()
+{
+    lastReportTime = FPlatformTime::Seconds();
+
+    const double elapsed = (endTime > 0.0 ? endTime : lastReportTime) - startTime;
+    results.Throughput = elapsed > 0.0 ? static_cast<float>((results.Succeeded + results.Failed) / elapsed) : 0.0f;
+
+    TArray<double> sortedLatenciesMs = latenciesMs;
+    sortedLatenciesMs.Sort();
+    results.LatencyP50 = Percentile(sortedLatenciesMs, 0.50);
+    results.LatencyP90 = Percentile(sortedLatenciesMs, 0.90);
+    results.LatencyP99 = Percentile(sortedLatenciesMs, 0.99);
+    results.LatencyMax = Percentile(sortedLatenciesMs, 1.0);
+
+    if (onResults)
+    {
+        onResults(results);
+    }
+}
@@ -11,6 +11,7 @@
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Templates/SharedPointer.h"
+#include "Types/SlateEnums.h"
 
 // Unreal forward declarations
 class SScrollBox;
@@ -27,17 +28,26 @@ enum class Synced : uint8
     Unsynchronized 
 };
 
+/**
+ * One achievement being edited in the achievements configuration window.
+ *
+ * The achievement's fields are stored on this object. Its widgets are only built while its row is visible in the
+ * AwsGameKitAchievementsLayoutDetails list view, and are released when the row scrolls out of view.
+ */
 class AwsGameKitAchievementUI
 {
 private:
     AwsGameKitAchievementsLayoutDetails* parent;
     TSharedPtr<SScrollBox> representation;
-    TSharedPtr<STextBlock> titleText;
     TSharedPtr<SButton> trashIconButton;
+    int newAchievementNumber;
+    bool expanded;
 
     void Initialize(AwsGameKitAchievementsLayoutDetails* layout, int32 points, int32 max, int32 sortOrder);
+    void BuildRepresentation();
     FReply DeleteAchievement();
     void OnIdChanged(const FText& newText);
+    void OnIdCommitted(const FText& newText, ETextCommit::Type commitType);
 
 public:
     AwsGameKitAchievementUI(AwsGameKitAchievementsLayoutDetails* layout, int32 points = 0, int32 max = 1, int32 sortOrder = 0);
@@ -47,51 +57,63 @@ public:
 
     bool markedForDeletion;
     Synced status;
+
+    // Key of this achievement in the parent's achievements map. Follows AchievementId once an edit is committed, unless another achievement has that key.
     FString idString;
 
     bool localLockedIcon;
     bool localUnlockedIcon;
 
-    TSharedPtr<SExpandableArea> expandableArea;
-
-    TSharedPtr<SEditableTextBox> id;
-    TSharedPtr<SEditableTextBox> title;
-    TSharedPtr<SEditableTextBox> lockedDescription;
-    TSharedPtr<SEditableTextBox> unlockedDescription;
-    TSharedPtr<SEditableTextBox> lockedIcon;
-    TSharedPtr<GameKitImage> lockedIconImg;
-    TSharedPtr<SEditableTextBox> unlockedIcon;
-    TSharedPtr<GameKitImage> unlockedIconImg;
-
-    TSharedPtr<SCheckBox> secret;
-    TSharedPtr<SCheckBox> hidden;
-
-    TSharedPtr<SBorder> idValidationWarning;
+    FString AchievementId;
+    FString Title;
+    FString LockedDescription;
+    FString UnlockedDescription;
+    FString LockedIcon;
+    FString UnlockedIcon;
+    bool IsSecret;
+    bool IsHidden;
+    bool IsIdEditable;
 
     int32 Points;
     int32 MaxValue;
     int32 SortOrder;
 
+    // Only valid while the row is visible
+    TSharedPtr<SExpandableArea> expandableArea;
+    TSharedPtr<GameKitImage> lockedIconImg;
+    TSharedPtr<GameKitImage> unlockedIconImg;
+
     void ToAchievement(AdminAchievement& result);
     void ToJsonObject(TSharedPtr<FJsonObject>& result);
 
     TSharedRef<SScrollBox> GetRepresentation()
     {
+        if (!this->representation.IsValid())
+        {
+            BuildRepresentation();
+        }
         return this->representation.ToSharedRef();
     }
 
+    bool HasRepresentation() const
+    {
+        return this->representation.IsValid();
+    }
+
+    void ReleaseRepresentation();
+
     bool IsSynchronized(TSharedPtr<AwsGameKitAchievementUI> other) const
     {
-        return id->GetText().CompareTo(other->id->GetText()) == 0 &&
-            title->GetText().CompareTo(other->title->GetText()) == 0 &&
+        return AchievementId.Equals(other->AchievementId) &&
+            Title.Equals(other->Title) &&
             Points == other->Points &&
-            lockedDescription->GetText().CompareTo(other->lockedDescription->GetText()) == 0 &&
-            unlockedDescription->GetText().CompareTo(other->unlockedDescription->GetText()) == 0 &&
+            LockedDescription.Equals(other->LockedDescription) &&
+            UnlockedDescription.Equals(other->UnlockedDescription) &&
             MaxValue == other->MaxValue &&
             SortOrder == other->SortOrder &&
-            secret->IsChecked() == other->secret->IsChecked() &&
-            hidden->IsChecked() == other->hidden->IsChecked() &&
-            lockedIcon->GetText().CompareTo(other->lockedIcon->GetText()) == 0 &&
-            unlockedIcon->GetText().CompareTo(other->unlockedIcon->GetText()) == 0;
+            IsSecret == other->IsSecret &&
+            IsHidden == other->IsHidden &&
+            LockedIcon.Equals(other->LockedIcon) &&
+            UnlockedIcon.Equals(other->UnlockedIcon);
     }
 };
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include "Models/AwsGameKitAchievementModels.h"
 
 // Unreal
+#include "Containers/ArrayView.h"
 #include "Containers/UnrealString.h"
 #include "UObject/NoExportTypes.h"
 
@@ -44,6 +45,14 @@ struct DeleteAchievementsRequest
     TArray<FString> achievementIdentifiers;
 };
 
+struct AchievementsBatchProgress
+{
+    int32 completedBatches;
+    int32 totalBatches;
+    int32 completedAchievements;
+    int32 totalAchievements;
+};
+
 struct AchievementsAdminLibrary
 {
     TSharedPtr<AwsGameKitAchievementsAdminWrapper> AchievementsAdminWrapper;
@@ -61,7 +70,14 @@ private:
 
     static TSharedPtr<EditorState> editorState;
     static TSharedPtr<EditorState> GetEditorState();
+
+    static IntResult AddAchievementsBlocking(TArrayView<const AdminAchievement> achievements);
+    static IntResult DeleteAchievementsBlocking(TArrayView<const FString> achievementIdentifiers);
 public:
+    // Upper bounds of one batch sent by AddAchievementsForGameInBatches() and DeleteAchievementsForGameInBatches()
+    static const int32 BATCH_MAX_BYTES = 256 * 1024;
+    static const int32 BATCH_MAX_ACHIEVEMENTS = 50;
+    static const int32 BATCH_MAX_PARALLEL_REQUESTS = 2;
 
     /**
      * @brief Lists all game achievements, and will call PartialResultDelegate after every page.
@@ -77,6 +93,8 @@ public:
     /**
      * @brief Lists non-hidden achievements, and will only call the delegate after all pages are returned.
      *
+     * @details All pages are requested in one call, which AdminGetAchievements serves by scanning AdminGetAchievementsScanSegments segments of the table in parallel.
+     *
      * @param CombinedResultDelegate Delegate to process both the status code, and the returned array of achievements.
      * The **IntResult parameter** is a GameKit status code and indicates the result of the API call.
      * Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -109,6 +127,20 @@ public:
     */
     static void AddAchievementsForGame(const AddAchievementsRequest& AddAchievementsRequest, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
 
+    /**
+     * @brief Same as AddAchievementsForGame(), but splits the achievements into batches of at most BATCH_MAX_ACHIEVEMENTS achievements and about BATCH_MAX_BYTES bytes,
+     * and sends up to BATCH_MAX_PARALLEL_REQUESTS batches at a time.
+     *
+     * @details Remaining batches aren't sent once a batch fails.
+     *
+     * @param AddAchievementsRequest Struct containing a list of structs that hold an achievements metadata.
+     * @param BatchCompleteDelegate Delegate called on the game thread after each batch has been sent.
+     * @param ResultDelegate Delegate called after the last batch, with GAMEKIT_SUCCESS or the status code of the first batch which failed. See AddAchievementsForGame().
+    */
+    static void AddAchievementsForGameInBatches(const AddAchievementsRequest& AddAchievementsRequest,
+        TAwsGameKitDelegateParam<const AchievementsBatchProgress&> BatchCompleteDelegate,
+        TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
+
     /**
      * @brief Deletes the set of achievements metadata from the game's dynamodb.
      *
@@ -124,6 +156,17 @@ public:
     */
     static void DeleteAchievementsForGame(const DeleteAchievementsRequest& DeleteAchievementsRequest, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
 
+    /**
+     * @brief Same as DeleteAchievementsForGame(), but deletes the achievements in batches the way AddAchievementsForGameInBatches() adds them.
+     *
+     * @param DeleteAchievementsRequest Struct containing a list of achievement ID's.
+     * @param BatchCompleteDelegate Delegate called on the game thread after each batch has been deleted.
+     * @param ResultDelegate Delegate called after the last batch, with GAMEKIT_SUCCESS or the status code of the first batch which failed. See DeleteAchievementsForGame().
+    */
+    static void DeleteAchievementsForGameInBatches(const DeleteAchievementsRequest& DeleteAchievementsRequest,
+        TAwsGameKitDelegateParam<const AchievementsBatchProgress&> BatchCompleteDelegate,
+        TAwsGameKitDelegateParam<const IntResult&> ResultDelegate);
+
     /**
      * @brief Changes the credentials used to sign requests and retrieve session tokens for admin requests.
      *
@@ -10,7 +10,7 @@
 #include <AwsGameKitCore/Public/Core/AwsGameKitMarshalling.h>
 
 // GameKit
-#if PLATFORM_IOS
+#if PLATFORM_IOS || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/achievements/exports.h>
 #endif
 #include <aws/gamekit/achievements/gamekit_achievements_models.h>
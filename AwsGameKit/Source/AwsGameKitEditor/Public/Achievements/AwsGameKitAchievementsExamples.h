@@ -7,6 +7,7 @@
 // GameKit
 #include "AwsGameKitEditor/Public/ImageDownloader.h"
 #include "AwsGameKitRuntime/Public/Models/AwsGameKitAchievementModels.h"
+#include "Utils/AwsGameKitEditorStressTest.h"
 
 // Unreal
 #include "UObject/NoExportTypes.h"
@@ -118,6 +119,27 @@ private:
     UPROPERTY(Transient, VisibleInstanceOnly, Category = "5. Update Achievement", DisplayName = "Response:")
     FAchievement UpdateAchievementResponse;
 
+    // Stress Test: GetAchievementForPlayer or UpdateAchievementForPlayer
+    UFUNCTION(CallInEditor, Category = "6. Stress Test")
+    void CallStartStressTest();
+
+    UFUNCTION(CallInEditor, Category = "6. Stress Test")
+    void CallStopStressTest();
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Achievement ID:")
+    FString StressAchievementId;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Increment Amount (0 to get the achievement):")
+    int32 StressAchievementIncrement = 0;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Settings:")
+    FAwsGameKitStressTestSettings StressSettings;
+
+    UPROPERTY(Transient, VisibleInstanceOnly, Category = "6. Stress Test", DisplayName = "Results:")
+    FAwsGameKitStressTestResults StressResults;
+
+    TSharedPtr<AwsGameKitEditorStressTest> stressTest;
+
     /*
      * ADVANCED USAGE: Only use this if you're using your own identity provider and you've set UseThirdPartyIdentityProvider to true in the feature's parameters.yml
      * Uncomment the UFUNCTION() and UPROPERTY() macros to have this example show up in the Details panel of this example actor.
@@ -13,6 +13,7 @@ class AwsGameKitAchievementUI;
 class UAwsGameKitAchievementsAdminCallableWrapper;
 
 // Unreal
+#include "Async/Future.h"
 #include "Containers/UnrealString.h"
 #include "DetailCategoryBuilder.h"
 #include "IDetailCustomization.h"
@@ -21,8 +22,10 @@ class UAwsGameKitAchievementsAdminCallableWrapper;
 
 // Unreal forward declarations
 class FMessageEndpoint;
+class ITableRow;
 class SButton;
-class SScrollBox;
+template <typename ItemType> class SListView;
+class STableViewBase;
 class STextBlock;
 class SVerticalBox;
 class SWindow;
@@ -41,7 +44,7 @@ private:
     // Achievements Data
     TSharedPtr<SButton> addAchievementButton;
     TSharedPtr<SButton> getLatestButton;
-    TSharedPtr<SScrollBox> achievementsSection;
+    TSharedPtr<SListView<TSharedPtr<AwsGameKitAchievementUI>>> achievementsSection;
     TSharedPtr<STextBlock> saveButtonText;
     TSharedPtr<SButton> saveButton;
     static const FText SAVE_BUTTON_TEXT;
@@ -67,17 +70,44 @@ private:
     bool IsSaveDataToCloudEnabled() const;
     virtual void CredentialsStateMessageHandler(const struct FMsgCredentialsState& message, const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& context) override;
 
-    void OnListAchievementsComplete(const IntResult& result, const TArray<AdminAchievement>& achievements);
+    void OnListAchievementsComplete(const IntResult& result, const TArray<AdminAchievement>& achievements, uint32 requestId);
     void OnAddAchievementsComplete(const IntResult& result);
     void OnDeleteAchievementsComplete(const IntResult& result);
+    void OnUploadBatchComplete(const AchievementsBatchProgress& progress);
+    static FString SerializeForSync(const TSharedPtr<AwsGameKitAchievementUI>& achievement);
+
+    /**
+    * @brief Rebuilds the flat, filtered list shown by the list view from the achievements map. Only the visible rows build widgets.
+    */
+    void RefreshAchievementsList();
+    bool PassesFilter(const TSharedPtr<AwsGameKitAchievementUI>& achievement) const;
+    void LoadAchievementIcons(const TSharedPtr<AwsGameKitAchievementUI>& achievement);
+    TSharedRef<ITableRow> OnGenerateAchievementRow(TSharedPtr<AwsGameKitAchievementUI> achievement, const TSharedRef<STableViewBase>& ownerTable);
+    void OnAchievementRowReleased(const TSharedRef<ITableRow>& row);
 
     void ProcessAchievements(const TArray<AdminAchievement>& incomingAchievements, const bool fromCloud = false);
+
+    // ProcessAchievements() in two parts, so that a large cloud listing is merged a slice at a time and finished once, after its last slice
+    void MergeAchievements(const TArray<AdminAchievement>& incomingAchievements, const bool fromCloud, TArray<TSharedPtr<AwsGameKitAchievementUI>>* addedAchievements = nullptr);
+    void FinishProcessingAchievements(const bool fromCloud);
     void SaveStateToJsonFile(const FString& fileName);
     void SaveStateToJsonFile()
     {
         SaveStateToJsonFile(this->localStatePath);
     }
 
+    // The JSON files are read, parsed, serialized and written on a worker. Only the swap of the achievements map runs on the game thread.
+    struct FJsonFileState;
+    TSharedRef<FJsonFileState, ESPMode::ThreadSafe> jsonFileState;
+    TArray<TFuture<void>> pendingJsonWrites;
+    uint32 jsonLoadRequestId = 0;
+
+    // The listed cloud achievements are merged into the list a slice per tick, so rows show up while a large catalog is merged
+    uint32 listRequestId = 0;
+    void MergeCloudAchievements(uint32 requestId, TArray<AdminAchievement>&& listedAchievements);
+    void OnJsonFileLoaded(uint32 requestId, TArray<AdminAchievement>&& loadedAchievements);
+    void ReportJsonProgress(const FText& progress);
+
 public:
     AwsGameKitAchievementsLayoutDetails(const FAwsGameKitEditorModule* editorModule);
     ~AwsGameKitAchievementsLayoutDetails();
@@ -93,6 +123,9 @@ public:
 
     TMap<FString, TSharedPtr<AwsGameKitAchievementUI>> achievements;
     TMap<FString, TSharedPtr<AwsGameKitAchievementUI>> cloudSyncedAchievements;
+    TArray<TSharedPtr<AwsGameKitAchievementUI>> filteredAchievements;
+    TMap<const ITableRow*, TWeakPtr<AwsGameKitAchievementUI>> generatedRows;
+    FString achievementsFilter;
     IImageDownloaderPtr imageDownloader;
     TArray<FString> invalidIds;
 
@@ -100,5 +133,10 @@ public:
 
     void Repopulate();
     void SortAchievements();
+
+    /**
+    * @brief Compares one achievement with its cloud version, without refreshing the list. Does nothing until the feature is deployed.
+    */
+    void UpdateSyncStatus(AwsGameKitAchievementUI& achievement) const;
 };
 
@@ -70,13 +70,21 @@ private:
     TSharedPtr<SVerticalBox> rightPaneAwsText;
     TSharedPtr<SVerticalBox> rightPaneCredentialsSubmitted;
 
-    // Project name settings debounce
+    // Project name settings debounce. The timer only runs between a change and its check, so the editor can go idle.
     double nextConfigFileCheckTimestamp = 0; // seconds
     bool configFileFieldChangedValid = false;
     const double configFileCheckDelay = 0.5; // seconds
+    void ScheduleProjectNameCheck();
     EActiveTimerReturnType ProjectNameStateTransitionCallback(double inCurrentTime, float inDeltaTime);
     TSharedPtr<FActiveTimerHandle> projectNameTimerHandle;
 
+    // Instance files watch: a saveInfo.yml written outside this panel, for example by another editor or a source control sync, schedules the check
+    FString watchedInstanceDirectory;
+    FDelegateHandle instanceDirectoryWatcherHandle;
+    void WatchInstanceDirectory();
+    void UnwatchInstanceDirectory();
+    void OnInstanceDirectoryChanged(const TArray<struct FFileChangeData>& fileChanges);
+
     // Dynamic text
     FText submitValidationText;
     FText environmentNameErrorText;
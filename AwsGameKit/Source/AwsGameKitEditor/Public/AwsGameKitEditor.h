@@ -9,6 +9,7 @@ class AwsGameKitFeatureControlCenter;
 class AwsCredentialsManager;
 class EditorState;
 class FeatureResourceManager;
+struct AccountDetails;
 
 // Unreal
 #include "Modules/ModuleInterface.h"
@@ -39,6 +40,8 @@ private:
 
     void RegisterProjectSettings() const;
     void UnregisterProjectSettings() const;
+    void BootstrapFromSaveInfoFile(const FString& saveInfoFile);
+    void RevalidateAccountId(const AccountDetails& accountDetails);
 
 public:
     /** IModuleInterface implementation */
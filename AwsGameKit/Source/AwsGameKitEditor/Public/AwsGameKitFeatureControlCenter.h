@@ -20,6 +20,7 @@ class FSlateStyleSet;
 class SButton;
 class SDockTab;
 class SEditableTextBox;
+template <typename ItemType> class SListView;
 class SWindow;
 
 class AwsGameKitFeatureControlCenter
@@ -38,8 +39,12 @@ private:
     };
 
     // Helpers
-    void ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature);
-    void ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature, FeatureType featureTypeStatusOverride);
+    bool ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature);
+    bool ConditionallyCreateOrUpdateFeatureResources(TSharedPtr<FeatureResourceManager> featureResourceManager, FeatureType feature, FeatureType featureTypeStatusOverride);
+    void SetFeatureStatusMessage(FeatureType feature, const std::string& status);
+
+    // Features whose stacks must be deployed before the stack of this feature, besides the main stack
+    static TArray<FeatureType> GetFeatureDependencies(FeatureType feature);
 
     // UI Elements
     TSharedPtr<SEditableTextBox> deleteConfirmText;
@@ -56,7 +61,12 @@ private:
 
     // UI button state and message handling
     TMap<FeatureType, FString> featureStatusMessage;
-    TMap<FeatureType, TSharedPtr<FText>> featureDeleteDetailsContent; // text in delete dialog
+
+    // Resources listed in the delete dialog, filled as the stack is described
+    TArray<TSharedPtr<FString>> deleteResourcesListItems;
+    TSharedPtr<SListView<TSharedPtr<FString>>> deleteResourcesList;
+    bool deleteResourcesLoading = false;
+    uint32 deleteResourcesRequestId = 0;
 
     TSet<FString> createEnabledStatuses = { FString(FeatureResourceManager::UNDEPLOYED_STATUS_TEXT.c_str()), FString(FeatureResourceManager::ERROR_STATUS_TEXT.c_str()) };
     TSet<FString> redeployEnabledStatuses = { FString(FeatureResourceManager::DEPLOYED_STATUS_TEXT.c_str()), FString(FeatureResourceManager::ROLLBACK_COMPLETE_STATUS_TEXT.c_str()), FString(FeatureResourceManager::ERROR_STATUS_TEXT.c_str()) };
@@ -67,6 +77,15 @@ private:
 
     FCriticalSection featureButtonsMutex;
     FCriticalSection featureStatusMessageMutex;
+
+    // Deployments running at the same time prepare their templates and uploads one at a time, only their stack updates overlap
+    FCriticalSection featureDeployPreparationMutex;
+
+    // The FeatureResourceManager isn't thread safe, so the stack status refreshes run on background threads one at a time
+    FCriticalSection featureStatusQueryMutex;
+
+    // Latest status check requested for each feature, so that an older check finishing last doesn't overwrite its result. Guarded by featureStatusMessageMutex.
+    TMap<FeatureType, uint32> featureStatusRequestIds;
     
     // Helper to check the status of a dependent feature. if the status does not match append the feature name to the dependentFeatures FString 
     bool CheckDependentFeatureStatus(FeatureType feature, const char* status, TArray<FString>& dependentFeatures);
@@ -105,8 +124,13 @@ public:
     bool IsRedeployEnabled(FeatureType feature);
     bool IsDeleteEnabled(FeatureType feature);
     FReply CreateOrUpdateResources(FeatureType feature);
+
+    // Deploy the main stack, then every feature stack as soon as the stacks it depends on are deployed
+    FReply CreateOrUpdateAllResources();
+    bool IsCreateOrUpdateAllEnabled();
     FReply PrepareDeleteResources(FeatureType feature);
     FName GetIconStyle(FeatureType feature);
     void GetFeatureStatusAsync(FeatureType feature);
+    void GetFeatureStatusesAsync(const TArray<FeatureType>& features);
     bool IsValidProviderCredentialsInput(TSharedPtr<SCheckBox> providerCheckbox, TSharedPtr<SEditableTextBox> providerAppId, TSharedPtr<SEditableTextBox> providerAppSecret, FString secretId) const;
 };
@@ -29,6 +29,10 @@ protected:
     // Feature management
     const FeatureType featureType;
     TSharedRef<SVerticalBox> GetDeployControls(const bool addSeparator = true);
+    TSharedRef<SVerticalBox> GetLambdaSettings();
+    TSharedRef<SVerticalBox> GetDynamoDbSettings();
+    TSharedRef<SWidget> GetFeatureVariableSpinBox(const FString& varName, const FString& defaultValue, int minValue, int maxValue, const FText& toolTip);
+    FString GetFeatureVariable(const FString& varName, const FString& defaultValue) const;
     TSharedRef<SVerticalBox> GetFeatureFooter(const FText& featureDescription);
     bool CanEditConfiguration() const;
     virtual FReply DeployFeature();
@@ -45,5 +49,29 @@ protected:
 public:
      static const FString GAMEKIT_CLOUDWATCH_DASHBOARD_ENABLED;
 
+     // Settings of the feature's Lambda functions, see the feature's parameters.yml
+     static const FString GAMEKIT_LAMBDA_RUNTIME;
+     static const FString GAMEKIT_LAMBDA_ARCHITECTURE;
+     static const FString GAMEKIT_LAMBDA_MEMORY_SIZE;
+     static const FString GAMEKIT_LAMBDA_PROVISIONED_CONCURRENCY;
+     static const FString DEFAULT_LAMBDA_RUNTIME;
+     static const FString DEFAULT_LAMBDA_ARCHITECTURE;
+     static const FString DEFAULT_LAMBDA_MEMORY_SIZE;
+     static const FString DEFAULT_LAMBDA_PROVISIONED_CONCURRENCY;
+
+     // Capacity and auto scaling of the feature's DynamoDB tables, see the feature's parameters.yml
+     static const FString GAMEKIT_DYNAMODB_MIN_CAPACITY;
+     static const FString GAMEKIT_DYNAMODB_MAX_CAPACITY;
+     static const FString GAMEKIT_DYNAMODB_TARGET_UTILIZATION;
+     static const FString GAMEKIT_DYNAMODB_SCHEDULED_MIN_CAPACITY;
+     static const FString GAMEKIT_DYNAMODB_SCHEDULED_SCALING_START;
+     static const FString GAMEKIT_DYNAMODB_SCHEDULED_SCALING_END;
+     static const FString DEFAULT_DYNAMODB_TARGET_UTILIZATION;
+     static const FString DEFAULT_DYNAMODB_SCHEDULED_MIN_CAPACITY;
+
+     // User Gameplay Data keeps the capacity and auto scaling its production tables always had, the other features start without auto scaling
+     static FString DefaultDynamoDbMinCapacity(FeatureType feature);
+     static FString DefaultDynamoDbMaxCapacity(FeatureType feature);
+
     AwsGameKitFeatureLayoutDetails(const FeatureType featureType, const FAwsGameKitEditorModule* editorModule);
 };
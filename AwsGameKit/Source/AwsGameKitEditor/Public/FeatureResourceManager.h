@@ -14,18 +14,61 @@
 #include <string>
 
 // Unreal
+#include "Containers/Ticker.h"
 #include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
 #include "Templates/SharedPointer.h"
 
+// Unreal forward declarations
+class FEvent;
+class FMD5;
+
 class FeatureResourceManager : IChildLogger
 {
 private:
     void* SetupResourcesInstance(const AccountInfo accountInfo, const AccountCredentials credentials, FeatureType featureType);
 
+    // Resources instance kept across the stack status checks of a feature, released once the account details change and no check uses it anymore
+    struct FStackStatusInstance
+    {
+        TSharedPtr<AwsGameKitCoreWrapper> coreWrapper;
+        void* handle = nullptr;
+        ~FStackStatusInstance();
+    };
+    TSharedPtr<FStackStatusInstance, ESPMode::ThreadSafe> GetStackStatusInstance(FeatureType featureType);
+    void ReleaseStackStatusInstances();
+    unsigned int DescribeStackStatus(FeatureType featureType, std::string& outStackStatus);
+    static std::string SimplifyStackStatus(const std::string& stackStatus, unsigned int result);
+
     IntResult CreateOrUpdateResources(FeatureType featureType);
     IntResult UploadLayersByFeature(FeatureType feature);
     IntResult UploadFunctionsByFeature(FeatureType feature);
     IntResult ValidateFeatureVariables(FeatureType featureType);
+
+    FString GetInstanceLayersPath(void* resourcesInstance, FeatureType featureType) const;
+
+    // Hashes of the inputs of the last deployment of each feature's layers, functions and stack, and of the dashboards, kept with the instance files.
+    // Anything whose inputs didn't change since is not deployed again.
+    static FString GetAccountIdCachePath(const FString& accessKey, const FString& secretKey);
+
+    static FString GetDeployHashName(FeatureType featureType, const TCHAR* input);
+    FString GetDeployHashFilePath(const FString& hashName) const;
+    FString LoadDeployHash(const FString& hashName) const;
+    void SaveDeployHash(const FString& hashName, const FString& hash) const;
+    void DeleteDeployHashes(FeatureType featureType) const;
+    static void HashString(FMD5& md5, const FString& text);
+    static void HashDirectory(FMD5& md5, const FString& directory);
+    static FString FinalizeHash(FMD5& md5);
+    FString ComputeArtifactsHash(void* resourcesInstance, FeatureType featureType, const TCHAR* artifactKind) const;
+    FString ComputeStackInputsHash(void* resourcesInstance, FeatureType featureType);
+    FString ComputeDashboardsHash(void* resourcesInstance);
+    // The client settings of each region a feature is deployed to, kept with the deploy hashes. Once the game is deployed to several regions,
+    // they are listed in awsGameKitClientConfig.yml so that FAwsGameKitRegionSelector can pick the closest region.
+    FString GetRegionalClientConfigPath(const FString& region) const;
+    void UpdateRegionalClientConfig(FeatureType featureType, bool isDeployed) const;
+    TArray<FString> GetMappedRegions() const;
+
     static const FString& GetVariableOrDefault(const TMap<FString, FString>& vars, const FString& key, const FString& defaultString);
 
     FString pluginBaseDir;
@@ -33,14 +76,40 @@ private:
     FString rootPath;
 
     std::string retrievedAccountId;
-    FString featuresLog;
+    // The last LOG_CAPACITY messages of the deployments, in a ring starting at featuresLogHead once it's full.
+    // featuresLogNextSequence numbers the messages, so readers can ask for those logged since their last read.
+    static const int32 LOG_CAPACITY;
+    TArray<FString> featuresLog;
+    int32 featuresLogHead = 0;
+    uint64 featuresLogNextSequence = 0;
+    mutable FCriticalSection featuresLogMutex;
+    void AppendLog(const FString& message);
+
+    // Deployments of several features at once deploy the API Gateway stage one at a time
+    FCriticalSection apiGatewayStageMutex;
 
     AccountInfoCopy accountInfoCopy;
     AccountCredentialsCopy credentialsCopy;
 
+    // Guards stackStatusInstances and the account details the instances are created from
+    FCriticalSection stackStatusInstancesMutex;
+    TMap<FeatureType, TSharedPtr<FStackStatusInstance, ESPMode::ThreadSafe>> stackStatusInstances;
+
+    // Resources of each stack, described once per deployment for the delete dialog
+    FCriticalSection describedResourcesMutex;
+    TMap<FeatureType, TArray<FString>> describedResourcesCache;
+
+    // Debounced save of the settings: changes mark them dirty, and they are written once no change was made for SETTINGS_SAVE_DELAY_SECONDS
+    static const double SETTINGS_SAVE_DELAY_SECONDS;
+    FCriticalSection settingsSaveMutex;
+    bool areSettingsDirty = false;
+    double settingsSaveTime = 0.0;
+    FTSTicker::FDelegateHandle settingsSaveTickerHandle;
+    void MarkSettingsDirty();
+    bool TickSettingsSave(float deltaTime);
+    void FlushSettingsSave();
 
 protected:
-    TSharedPtr<FThreadSafeCounter, ESPMode::ThreadSafe> ftsc;
     GAMEKIT_SETTINGS_INSTANCE_HANDLE settingInstanceHandle;
 
 public:
@@ -57,7 +126,12 @@ public:
 
     void Log(unsigned int level, const FString& message) override;
 
-    inline const FString& GetLog() const { return featuresLog; };
+    // All the messages still held, oldest first, one per line
+    FString GetLog() const;
+
+    // Copy the messages logged since cursor, oldest first, and move the cursor past them. Start with a cursor of 0.
+    // Messages dropped from the log since the last read are skipped.
+    void ReadLog(uint64& cursor, TArray<FString>& outMessages) const;
 
     // Feature task running status tracking
     enum class FeatureRunningState : uint8
@@ -83,13 +157,48 @@ public:
 
     // Account
     bool IsAccountInfoValid(const AccountDetails& accountDetails);
-    FString GetAccountId(const FString& accessKey, const FString& secretKey);
+
+    // Why GetAccountId() returned an empty account id
+    enum class EAccountIdFailure : uint8
+    {
+        None,
+        // STS rejected the keys (InvalidClientTokenId or SignatureDoesNotMatch)
+        InvalidCredentials,
+        // A network error, throttling or any other failure which says nothing about the keys
+        Unreachable
+    };
+    FString GetAccountId(const FString& accessKey, const FString& secretKey, EAccountIdFailure* outFailure = nullptr);
+
+    // The account id last retrieved for these credentials, kept across editor sessions so the saved state can be restored without a network call.
+    // Revalidate with GetAccountId(), which updates the cache. Empty if the credentials were never validated.
+    FString GetCachedAccountId(const FString& accessKey, const FString& secretKey) const;
     IntResult BootstrapAccount();
     IntResult CreateEmptyClientConfigFile();
     IntResult CreateOrUpdateFeatureResources(FeatureType featureType);
     IntResult DeleteFeatureResources(FeatureType featureType);
     IntResult DescribeFeatureResources(FeatureType featureType, TArray<FString>& outResources);
+    IntResult DescribeFeatureResources(FeatureType featureType, const TFunction<void(const FString&)>& onResourceDescribed);
+    void InvalidateDescribedResources(FeatureType featureType);
+
+    // Resource-level progress of a stack update, see WatchStackProgress(). Only the resources whose status changed since the watch started count as
+    // completed or failed, the total is every resource of the stack.
+    struct FStackProgress
+    {
+        int32 completedResources = 0;
+        int32 failedResources = 0;
+        int32 totalResources = 0;
+
+        // The resources whose status changed since the previous report, formatted as by DescribeFeatureResources()
+        TArray<FString> changedResources;
+    };
+
+    // Describe the resources of a feature's stack every STACK_PROGRESS_INTERVAL_SECONDS while it's deployed, and report the passes where a resource's
+    // status changed. Returns as soon as stopEvent is triggered, which the deployment does when the stack update returns. Blocks, run it on its own thread.
+    void WatchStackProgress(FeatureType featureType, FEvent* stopEvent, const TFunction<void(const FStackProgress&)>& onProgress);
+    static const double STACK_PROGRESS_INTERVAL_SECONDS;
+    void InvalidateAllDescribedResources();
     std::string GetResourcesStackStatus(FeatureType featureType);
+    TMap<FeatureType, std::string> GetResourcesStackStatuses(const TArray<FeatureType>& featureTypes);
     bool IsTaskInProgress(FeatureType featureType) const;
     bool IsMainStackInProgress() const;
     bool IsFeatureCloudFormationInstanceTemplatePresent(FeatureType featureType);
@@ -103,17 +212,47 @@ public:
     IntResult CheckSecretExists(const FString& secretName);
 
     // GameKit Settings
+    // Reads are served from an immutable snapshot of the settings, read again only after SetFeatureVariables(), SaveCustomEnvironment(), SaveSettings()
+    // or a settings reload. Widgets drawn every frame should hold GetSettingsSnapshot() rather than copy the maps.
+    struct FSettingsSnapshot
+    {
+        // Incremented every time the settings change
+        uint32 version = 0;
+        TMap<FeatureType, TMap<FString, FString>> featureVariables;
+        TMap<FString, FString> environments;
+        FString gameName;
+        FString lastUsedRegion;
+        FString lastUsedEnvironment;
+
+        const FString* FindFeatureVariable(FeatureType featureType, const FString& varName) const;
+    };
+    TSharedRef<const FSettingsSnapshot, ESPMode::ThreadSafe> GetSettingsSnapshot() const;
     void SaveCustomEnvironment(const FString& environmentKey, const FString& environmentValue);
     TMap<FString, FString> GetFeatureVariables(FeatureType featureType);
     void SetFeatureVariableIfUnset(FeatureType featureType, const FString& varName, const FString& varValue);
     void SetFeatureVariable(FeatureType featureType, const FString& varName, const FString& varValue);
+    void SetFeatureVariables(FeatureType featureType, const TMap<FString, FString>& vars);
+    void SetFeatureVariablesIfUnset(FeatureType featureType, const TMap<FString, FString>& vars);
     TMap<FString, FString> GetSettingsEnvironments() const;
     FString GetGameName() const;
     FString GetLastUsedRegion() const;
     FString GetLastUsedEnvironment() const;
     void SaveSettings();
 
+    // The saveInfo.yml of the last used game, read from a small index kept under the project's Saved directory, else found directly under the root path.
+    // Doesn't scan the project recursively, so it's cheap enough for the game thread. Empty if none was found.
+    FString FindSaveInfoFile() const;
+    static FString GetLastUsedGameIndexPath();
+
     FString GetPluginVersion() const;
     const FString& GetRootPath() const;
     const FString GetClientConfigSubdirectory() const;
+
+private:
+    // The settings snapshot, replaced whenever the settings change through this class so that UI reads don't call the settings library
+    mutable FCriticalSection settingsSnapshotMutex;
+    mutable TSharedPtr<const FSettingsSnapshot, ESPMode::ThreadSafe> settingsSnapshot;
+    uint32 settingsVersion = 0;
+    TSharedRef<const FSettingsSnapshot, ESPMode::ThreadSafe> ReadSettingsSnapshot(uint32 version) const;
+    void InvalidateSettingsSnapshot();
 };
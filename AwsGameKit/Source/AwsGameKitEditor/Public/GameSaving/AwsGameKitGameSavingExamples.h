@@ -9,6 +9,7 @@
 // GameKit
 #include "GameSaving/AwsGameKitGameSaving.h"
 #include "Models/AwsGameKitGameSavingModels.h"
+#include "Utils/AwsGameKitEditorStressTest.h"
 
 // Unreal
 #include "Containers/UnrealString.h"
@@ -196,4 +197,31 @@ private:
 
     UPROPERTY(Transient, VisibleInstanceOnly, Category = "5. Delete Game Save", DisplayName = "Response (Cached Saves):")
     TArray<FGameSavingSlot> DeleteSlotResponseCachedSlots;
+
+
+    // Stress Test: SaveSlot
+    UFUNCTION(CallInEditor, Category = "6. Stress Test")
+    void CallStartStressTest();
+
+    UFUNCTION(CallInEditor, Category = "6. Stress Test")
+    void CallStopStressTest();
+
+    // Inputs
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Save Name Prefix:")
+    FString StressSlotNamePrefix = "stress";
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Number of Saves:", meta = (ClampMin = "1"))
+    int32 StressSlotCount = 10;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Save Size (KB):", meta = (ClampMin = "1"))
+    int32 StressSlotSizeKb = 64;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "6. Stress Test", DisplayName = "Settings:")
+    FAwsGameKitStressTestSettings StressSettings;
+
+    // Outputs
+    UPROPERTY(Transient, VisibleInstanceOnly, Category = "6. Stress Test", DisplayName = "Results:")
+    FAwsGameKitStressTestResults StressResults;
+
+    TSharedPtr<AwsGameKitEditorStressTest> stressTest;
 };
@@ -6,6 +6,7 @@
 // GameKit forward declarations
 class UAwsGameKitIdentityCallableWrapper;
 #include "Identity/AwsGameKitIdentity.h"
+#include "Utils/AwsGameKitEditorStressTest.h"
 
 // Unreal
 #include "Containers/UnrealString.h"
@@ -155,6 +156,21 @@ private:
     UPROPERTY(Transient, VisibleInstanceOnly, Category = "9. Logout", DisplayName = "Return Value:")
     FString LogoutReturnValue;
 
+    // Stress Test: GetUser
+    UFUNCTION(CallInEditor, Category = "10. Stress Test")
+    void CallStartStressTest();
+
+    UFUNCTION(CallInEditor, Category = "10. Stress Test")
+    void CallStopStressTest();
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "10. Stress Test", DisplayName = "Settings:")
+    FAwsGameKitStressTestSettings StressSettings;
+
+    UPROPERTY(Transient, VisibleInstanceOnly, Category = "10. Stress Test", DisplayName = "Results:")
+    FAwsGameKitStressTestResults StressResults;
+
+    TSharedPtr<AwsGameKitEditorStressTest> stressTest;
+
 public:
     virtual void BeginDestroy() override;
     virtual bool IsEditorOnly() const override;
@@ -4,18 +4,33 @@
 #pragma once
 
 // Unreal
+#include "Brushes/SlateDynamicImageBrush.h"
 #include "Containers/UnrealString.h"
 #include "Templates/SharedPointer.h"
 #include "HttpModule.h"
+#include "Containers/Ticker.h"
 
 // Unreal forward declarations
 class SImage;
 
+/**
+ * Brush of a downloaded icon, shared by every GameKitImage showing that icon.
+ * Its renderer resource is released when the last widget using it is destroyed or shows another icon.
+ */
+class GameKitIconBrush :
+    public FSlateDynamicImageBrush
+{
+public:
+    GameKitIconBrush(const FName resourceName, const FVector2D& imageSize) : FSlateDynamicImageBrush(resourceName, imageSize) {}
+    virtual ~GameKitIconBrush();
+};
+
 class GameKitImage :
     public SImage
 {
 public:
-    const FSlateBrush* brush;
+    // Keeps the brush the widget shows alive
+    TSharedPtr<GameKitIconBrush> brush;
 };
 
 class IImageDownloader
@@ -31,10 +46,23 @@ typedef TSharedPtr<IImageDownloader, ESPMode::ThreadSafe> IImageDownloaderPtr;
 
 struct ImageResource
 {
-    TSharedPtr<GameKitImage> iconImg;
+    // Every widget waiting for this url; concurrent requests for the same url share one download.
+    TArray<TSharedPtr<GameKitImage>> iconImgs;
     int attempts;
+    FString cachedETag;
 };
 
+/**
+ * Downloads achievement icons and sets them on GameKitImage widgets.
+ *
+ * Downloaded icons are kept on disk in FAwsGameKitIconDiskCache, which the runtime icon atlas reads too. A cached icon is revalidated
+ * with If-None-Match the first time it is requested in an editor session and served from disk afterwards.
+ * Requests for a url which is already being downloaded are attached to that download, and at most MAX_CONCURRENT_DOWNLOADS requests are in flight.
+ * Icons are decoded on a background worker, only the brush is created on the game thread.
+ * Widgets showing the same url share one reference-counted brush: while any widget shows an icon, SetImageFromUrl() reuses its brush without
+ * downloading or decoding it again, and the renderer resource is released once no widget shows it anymore.
+ * Failed downloads are retried from the core ticker with exponential backoff and jitter, up to DOWNLOAD_MAX_ATTEMPTS times.
+ */
 class AWSGAMEKITEDITOR_API ImageDownloader :
     public TSharedFromThis<ImageDownloader, ESPMode::ThreadSafe>,
     public IImageDownloader
@@ -42,10 +70,41 @@ class AWSGAMEKITEDITOR_API ImageDownloader :
 private:
     FCriticalSection downloadMutex;
     TMap<FString, ImageResource> imageDownloads;
+    TArray<FString> queuedUrls;
+    TSet<FString> validatedUrls;
+    int inFlightDownloads = 0;
+
+    struct ScheduledRetry
+    {
+        double retryAt;
+        FString url;
+
+        bool operator<(const ScheduledRetry& other) const { return retryAt < other.retryAt; }
+    };
+
+    // Min-heap of failed downloads waiting for their backoff, drained by the core ticker on the game thread
+    TArray<ScheduledRetry> scheduledRetries;
+    FTSTicker::FDelegateHandle retryTickerHandle;
+
+    // Brushes of the icons some widget still shows, by url. Only used on the game thread.
+    TMap<FString, TWeakPtr<GameKitIconBrush>> brushCache;
+
+    TSharedPtr<GameKitIconBrush> FindCachedBrush(const FString& url);
+
+    void QueueDownload(const FString& url);
+    void StartQueuedDownloads();
+    void CompleteDownload(const FString& url, TArray<uint8> imgData);
+    void ApplyDecodedImage(const FString& url, int32 width, int32 height, TArray<uint8>&& decodedImage);
+    void FailDownload(const FString& url);
+    bool TickRetries(float deltaTime);
 
 public:
     static const int DOWNLOAD_MAX_ATTEMPTS = 5;
     static const int DOWNLOAD_RETRY_DELAY_IN_SECONDS = 1;
+    static const int DOWNLOAD_RETRY_MAX_DELAY_IN_SECONDS = 30;
+    static const int MAX_CONCURRENT_DOWNLOADS = 8;
+
+    virtual ~ImageDownloader();
 
     static IImageDownloaderPtr MakeInstance();
     virtual void SetImageFromUrl(const FString& iconUrl, const TSharedPtr<GameKitImage>& iconImg, int retryCount) override;
@@ -6,6 +6,7 @@
 // GameKit
 #include "Identity/AwsGameKitIdentity.h"
 #include "UserGameplayData/AwsGameKitUserGameplayData.h"
+#include "Utils/AwsGameKitEditorStressTest.h"
 
 // Unreal
 #include "GameFramework/Actor.h"
@@ -180,6 +181,27 @@ private:
     UPROPERTY(Transient, VisibleInstanceOnly, Category = "9. Delete Bundle Items", DisplayName = "Return Value:")
     FString DeleteBundleItemReturnValue;
 
+    // Stress Test: UpdateItem
+    UFUNCTION(CallInEditor, Category = "10. Stress Test")
+    void CallStartStressTest();
+
+    UFUNCTION(CallInEditor, Category = "10. Stress Test")
+    void CallStopStressTest();
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "10. Stress Test", DisplayName = "Bundle Name:")
+    FString StressBundleName;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "10. Stress Test", DisplayName = "Bundle Item Key:")
+    FString StressBundleItemKey;
+
+    UPROPERTY(Transient, EditInstanceOnly, Category = "10. Stress Test", DisplayName = "Settings:")
+    FAwsGameKitStressTestSettings StressSettings;
+
+    UPROPERTY(Transient, VisibleInstanceOnly, Category = "10. Stress Test", DisplayName = "Results:")
+    FAwsGameKitStressTestResults StressResults;
+
+    TSharedPtr<AwsGameKitEditorStressTest> stressTest;
+
 public:
     virtual void BeginDestroy() override;
     virtual bool IsEditorOnly() const override;
@@ -0,0 +1,128 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/Ticker.h"
+#include "Containers/UnrealString.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+#include "AwsGameKitEditorStressTest.generated.h" // Last include (Unreal requirement)
+
+/**
+ * Inputs of the "Stress Test" section of the example actors.
+ */
+USTRUCT()
+struct FAwsGameKitStressTestSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = "Stress Test", DisplayName = "Number of Calls:", meta = (ClampMin = "1", ClampMax = "100000"))
+    int32 CallCount = 100;
+
+    UPROPERTY(EditAnywhere, Category = "Stress Test", DisplayName = "Calls per Second (0 for no limit):", meta = (ClampMin = "0"))
+    float CallsPerSecond = 10.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Stress Test", DisplayName = "Calls in Flight:", meta = (ClampMin = "1", ClampMax = "256"))
+    int32 Concurrency = 4;
+};
+
+/**
+ * Outputs of the "Stress Test" section of the example actors, refreshed while the test runs.
+ */
+USTRUCT()
+struct FAwsGameKitStressTestResults
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Status:")
+    FString Status;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Calls Started:")
+    int32 Started = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Calls Succeeded:")
+    int32 Succeeded = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Calls Failed:")
+    int32 Failed = 0;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Last Error:")
+    FString LastError;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Throughput (calls/s):")
+    float Throughput = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Latency p50 (ms):")
+    float LatencyP50 = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Latency p90 (ms):")
+    float LatencyP90 = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Latency p99 (ms):")
+    float LatencyP99 = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, Category = "Stress Test", DisplayName = "Latency max (ms):")
+    float LatencyMax = 0.0f;
+};
+
+/**
+ * Fires a number of calls against the deployed backend at a set rate and concurrency, and measures their throughput, errors and latency.
+ *
+ * Used by the "Stress Test" section of the example actors, so that scaling can be checked against a sandbox before the calls go into a game.
+ * Calls are started from the core ticker on the game thread. Latency is measured from the call until its delegate runs on the game thread,
+ * so it includes the frame the result waited for.
+ */
+class AWSGAMEKITEDITOR_API AwsGameKitEditorStressTest : public TSharedFromThis<AwsGameKitEditorStressTest>
+{
+public:
+    /**
+     * Starts one call. onComplete must be called on the game thread with the call's result, exactly once.
+     */
+    typedef TFunction<void(int32 callIndex, TFunction<void(const IntResult&)> onComplete)> StartCallFunction;
+
+    /**
+     * Receives the results a few times per second, and once more when the test is over.
+     */
+    typedef TFunction<void(const FAwsGameKitStressTestResults&)> ResultsFunction;
+
+    /**
+     * Start a stress test. Keep the returned instance alive for as long as the test should run.
+     */
+    static TSharedRef<AwsGameKitEditorStressTest> Start(const FString& name, const FAwsGameKitStressTestSettings& settings, StartCallFunction startCall, ResultsFunction onResults);
+
+    ~AwsGameKitEditorStressTest();
+
+    /**
+     * Stop starting calls. The results are reported once the calls in flight completed.
+     */
+    void Stop();
+
+    bool IsRunning() const;
+
+private:
+    AwsGameKitEditorStressTest(const FString& name, const FAwsGameKitStressTestSettings& settings, StartCallFunction startCall, ResultsFunction onResults);
+
+    bool Tick(float deltaTime);
+    void OnCallComplete(double startTime, const IntResult& result);
+    void ReportResults();
+
+    FString name;
+    FAwsGameKitStressTestSettings settings;
+    StartCallFunction startCall;
+    ResultsFunction onResults;
+
+    FAwsGameKitStressTestResults results;
+    TArray<double> latenciesMs;
+    int32 inFlight = 0;
+    double startTime = 0.0;
+    double endTime = 0.0;
+    double lastReportTime = 0.0;
+    bool stopRequested = false;
+    FTSTicker::FDelegateHandle tickerHandle;
+};
@@ -65,6 +65,11 @@ public class AwsGameKitRuntime : ModuleRules
             new string[]
             {
                 "CoreUObject",
+                "HTTP",
+                "ImageWrapper",
+                "PlatformCrypto",
+                "PlatformCryptoTypes",
+                "RHI",
                 "Slate"
             }
         );
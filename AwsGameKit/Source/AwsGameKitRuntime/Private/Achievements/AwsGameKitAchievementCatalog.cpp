@@ -0,0 +1,228 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Achievements/AwsGameKitAchievementCatalog.h"
+
+// GameKit
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Containers/Map.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+    // Achievement ids, paths and text are case sensitive, unlike the default hashing of FString keys
+    struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    bool IdLess(FStringView A, FStringView B)
+    {
+        return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+    }
+}
+
+FAwsGameKitAchievementProgress FAwsGameKitAchievementProgress::FromAchievement(const FAchievement& Achievement)
+{
+    FAwsGameKitAchievementProgress Progress;
+    Progress.CurrentValue = Achievement.CurrentValue;
+    Progress.bIsEarned = Achievement.IsEarned;
+    Progress.EarnedAt = Achievement.EarnedAt;
+    Progress.UpdatedAt = Achievement.UpdatedAt;
+    return Progress;
+}
+
+bool FAwsGameKitAchievementProgress::ParseTimestamp(const FString& Timestamp, FDateTime& OutDateTime)
+{
+    if (Timestamp.IsEmpty())
+    {
+        return false;
+    }
+
+    // The backend writes microseconds, keep the first three fraction digits
+    int32 FractionStart;
+    if (Timestamp.FindChar(TEXT('.'), FractionStart))
+    {
+        int32 FractionEnd = FractionStart + 1;
+        while (FractionEnd < Timestamp.Len() && FChar::IsDigit(Timestamp[FractionEnd]))
+        {
+            ++FractionEnd;
+        }
+        if (FractionEnd - FractionStart - 1 > 3)
+        {
+            const FString Truncated = Timestamp.Left(FractionStart + 4) + Timestamp.Mid(FractionEnd);
+            return FDateTime::ParseIso8601(*Truncated, OutDateTime);
+        }
+    }
+    return FDateTime::ParseIso8601(*Timestamp, OutDateTime);
+}
+
+FAwsGameKitAchievementCatalogRef FAwsGameKitAchievementCatalog::Build(const TArray<FAchievement>& Achievements, TArray<FAwsGameKitAchievementProgress>* OutProgress)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    TSharedRef<FAwsGameKitAchievementCatalog, ESPMode::ThreadSafe> Catalog = MakeShared<FAwsGameKitAchievementCatalog, ESPMode::ThreadSafe>();
+
+    // Only needed while building: the catalog keeps the offsets
+    TMap<FString, FStringOffset, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Interned;
+    TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> IndexById;
+    Interned.Reserve(Achievements.Num() * 4);
+    IndexById.Reserve(Achievements.Num());
+
+    auto Intern = [&Catalog, &Interned](const FString& String) -> FStringOffset
+    {
+        if (const FStringOffset* Found = Interned.Find(String))
+        {
+            return *Found;
+        }
+
+        const FStringOffset Offset = Catalog->Strings.Num();
+        Catalog->Strings.Append(*String, String.Len());
+        Catalog->Strings.Add(TEXT('\0'));
+        Interned.Add(String, Offset);
+        return Offset;
+    };
+
+    Catalog->Definitions.Reserve(Achievements.Num());
+    if (OutProgress != nullptr)
+    {
+        OutProgress->Reset(Achievements.Num());
+    }
+
+    for (const FAchievement& Achievement : Achievements)
+    {
+        FDefinition Definition;
+        Definition.AchievementId = Intern(Achievement.AchievementId);
+        Definition.Title = Intern(Achievement.Title);
+        Definition.LockedDescription = Intern(Achievement.LockedDescription);
+        Definition.UnlockedDescription = Intern(Achievement.UnlockedDescription);
+        Definition.LockedIcon = Intern(Achievement.LockedIcon);
+        Definition.UnlockedIcon = Intern(Achievement.UnlockedIcon);
+        Definition.RequiredAmount = Achievement.RequiredAmount;
+        Definition.Points = Achievement.Points;
+        Definition.OrderNumber = Achievement.OrderNumber;
+        Definition.bIsSecret = Achievement.IsSecret;
+        Definition.bIsHidden = Achievement.IsHidden;
+
+        const FAwsGameKitAchievementProgress Progress = FAwsGameKitAchievementProgress::FromAchievement(Achievement);
+        if (const int32* Existing = IndexById.Find(Achievement.AchievementId))
+        {
+            Catalog->Definitions[*Existing] = Definition;
+            if (OutProgress != nullptr)
+            {
+                (*OutProgress)[*Existing] = Progress;
+            }
+            continue;
+        }
+
+        IndexById.Add(Achievement.AchievementId, Catalog->Definitions.Add(Definition));
+        if (OutProgress != nullptr)
+        {
+            OutProgress->Add(Progress);
+        }
+    }
+
+    Catalog->Definitions.Shrink();
+    Catalog->Strings.Shrink();
+
+    FAwsGameKitAchievementCatalog& Built = Catalog.Get();
+    Built.SortedById.Reserve(Built.Definitions.Num());
+    for (int32 i = 0; i < Built.Definitions.Num(); ++i)
+    {
+        Built.SortedById.Add(i);
+    }
+    Algo::Sort(Built.SortedById, [&Built](int32 A, int32 B)
+    {
+        return IdLess(Built.GetAchievementId(A), Built.GetAchievementId(B));
+    });
+
+    return Catalog;
+}
+
+FAwsGameKitAchievementCatalogRef FAwsGameKitAchievementCatalog::WithUpdatedDefinitions(const TArray<FAchievement>& UpdatedAchievements) const
+{
+    // Updates are rare and small, going through FAchievement keeps a single way of building catalogs
+    TArray<FAchievement> Achievements;
+    MakeAchievements(TArrayView<const FAwsGameKitAchievementProgress>(), Achievements);
+    Achievements.Append(UpdatedAchievements);
+    return Build(Achievements);
+}
+
+int32 FAwsGameKitAchievementCatalog::Find(FStringView AchievementId) const
+{
+    const int32 Position = Algo::LowerBoundBy(SortedById, AchievementId, [this](int32 Index) { return GetAchievementId(Index); }, &IdLess);
+    if (Position < SortedById.Num() && GetAchievementId(SortedById[Position]).Equals(AchievementId, ESearchCase::CaseSensitive))
+    {
+        return SortedById[Position];
+    }
+    return INDEX_NONE;
+}
+
+FAchievement FAwsGameKitAchievementCatalog::MakeAchievement(int32 Index, const FAwsGameKitAchievementProgress& Progress) const
+{
+    const FDefinition& Definition = Definitions[Index];
+
+    FAchievement Achievement;
+    Achievement.AchievementId = FString(GetString(Definition.AchievementId));
+    Achievement.Title = FString(GetString(Definition.Title));
+    Achievement.LockedDescription = FString(GetString(Definition.LockedDescription));
+    Achievement.UnlockedDescription = FString(GetString(Definition.UnlockedDescription));
+    Achievement.LockedIcon = FString(GetString(Definition.LockedIcon));
+    Achievement.UnlockedIcon = FString(GetString(Definition.UnlockedIcon));
+    Achievement.RequiredAmount = Definition.RequiredAmount;
+    Achievement.Points = Definition.Points;
+    Achievement.OrderNumber = Definition.OrderNumber;
+    Achievement.IsStateful = Definition.RequiredAmount > 1;
+    Achievement.IsSecret = Definition.bIsSecret;
+    Achievement.IsHidden = Definition.bIsHidden;
+    Achievement.IsNewlyEarned = false;
+
+    Achievement.CurrentValue = Progress.CurrentValue;
+    Achievement.IsEarned = Progress.bIsEarned;
+    Achievement.EarnedAt = Progress.EarnedAt;
+    Achievement.UpdatedAt = Progress.UpdatedAt;
+    return Achievement;
+}
+
+void FAwsGameKitAchievementCatalog::MakeAchievements(TArrayView<const FAwsGameKitAchievementProgress> Progress, TArray<FAchievement>& OutAchievements) const
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    const FAwsGameKitAchievementProgress NoProgress;
+    OutAchievements.Reset(Definitions.Num());
+    for (int32 i = 0; i < Definitions.Num(); ++i)
+    {
+        OutAchievements.Add(MakeAchievement(i, Progress.IsValidIndex(i) ? Progress[i] : NoProgress));
+    }
+}
+
+FAchievementSummary FAwsGameKitAchievementCatalog::Summarize(TArrayView<const FAwsGameKitAchievementProgress> Progress) const
+{
+    FAchievementSummary Summary;
+    Summary.TotalCount = Definitions.Num();
+    for (int32 i = 0; i < Definitions.Num(); ++i)
+    {
+        Summary.TotalPoints += Definitions[i].Points;
+        if (Progress.IsValidIndex(i) && Progress[i].bIsEarned)
+        {
+            Summary.EarnedCount++;
+            Summary.EarnedPoints += Definitions[i].Points;
+        }
+    }
+    return Summary;
+}
+
+SIZE_T FAwsGameKitAchievementCatalog::GetAllocatedSize() const
+{
+    return sizeof(FAwsGameKitAchievementCatalog) + Definitions.GetAllocatedSize() + Strings.GetAllocatedSize() + SortedById.GetAllocatedSize();
+}
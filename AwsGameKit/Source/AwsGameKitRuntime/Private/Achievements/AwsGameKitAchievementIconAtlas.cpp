@@ -0,0 +1,398 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Achievements/AwsGameKitAchievementIconAtlas.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "Achievements/AwsGameKitIconDiskCache.h"
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitCacheBudget.h"
+#include "Common/AwsGameKitNetworkPolicy.h"
+#include "Core/AwsGameKitMemory.h"
+#include "SessionManager/AwsGameKitTransport.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "HAL/IConsoleManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Modules/ModuleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsIconAtlasPageSize(
+    TEXT("GameKit.Achievements.IconAtlas.PageSize"),
+    1024,
+    TEXT("Width and height in texels of each achievement icon atlas page. Applies to the pages created after the next FAwsGameKitAchievementIconAtlas::Reset().\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsIconAtlasCellSize(
+    TEXT("GameKit.Achievements.IconAtlas.CellSize"),
+    128,
+    TEXT("Width and height in texels of the atlas cell each achievement icon is scaled into. Applies to the pages created after the next FAwsGameKitAchievementIconAtlas::Reset().\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Empty texels around each icon so that bilinear filtering doesn't bleed the neighboring icons in
+    const int32 CELL_PADDING = 1;
+}
+
+FAwsGameKitAchievementIconAtlas& FAwsGameKitAchievementIconAtlas::Get()
+{
+    static FAwsGameKitAchievementIconAtlas Instance;
+    return Instance;
+}
+
+void FAwsGameKitAchievementIconAtlas::Shutdown()
+{
+    check(IsInGameThread());
+    Reset();
+    IconReadyDelegate.Clear();
+}
+
+void FAwsGameKitAchievementIconAtlas::RequestIcon(const FString& IconUrl)
+{
+    check(IsInGameThread());
+    if (IconUrl.IsEmpty() || Icons.Contains(IconUrl))
+    {
+        return;
+    }
+
+    if (ImageWrapperModule == nullptr)
+    {
+        // The module must be loaded on the game thread, creating wrappers from it is thread safe
+        ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+    }
+
+    if (CellSize == 0)
+    {
+        PageSize = FMath::Max(16, CVarGameKitAchievementsIconAtlasPageSize.GetValueOnGameThread());
+        CellSize = FMath::Clamp(CVarGameKitAchievementsIconAtlasCellSize.GetValueOnGameThread(), CELL_PADDING * 2 + 1, PageSize);
+    }
+
+    Icons.Add(IconUrl);
+    // Don't spend a metered link on revalidating the cached icons
+    const bool bValidated = ValidatedUrls.Contains(IconUrl) || FAwsGameKitNetworkPolicy::Get().IsMetered();
+    const uint32 RequestGeneration = Generation;
+    const int32 InnerSize = CellSize - CELL_PADDING * 2;
+
+    // Read the disk cache off the game thread
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, IconUrl, bValidated, RequestGeneration, InnerSize]()
+    {
+        TArray<uint8> CachedImgData;
+        FString CachedETag;
+        const bool bCached = FAwsGameKitIconDiskCache::Load(IconUrl, CachedImgData, CachedETag);
+        if (bCached && bValidated)
+        {
+            DecodeOnWorker(IconUrl, MoveTemp(CachedImgData), RequestGeneration, InnerSize);
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [this, IconUrl, CachedETag = bCached ? CachedETag : FString(), RequestGeneration]()
+        {
+            if (RequestGeneration == Generation)
+            {
+                SendRequest(IconUrl, CachedETag);
+            }
+        });
+    });
+}
+
+void FAwsGameKitAchievementIconAtlas::RequestAchievementIcons(const FString& IconBaseUrl, const FAchievement& Achievement)
+{
+    if (!Achievement.LockedIcon.IsEmpty())
+    {
+        RequestIcon(AwsGameKitAchievements::GetAchievementIconUrl(IconBaseUrl, Achievement.LockedIcon));
+    }
+    if (!Achievement.UnlockedIcon.IsEmpty())
+    {
+        RequestIcon(AwsGameKitAchievements::GetAchievementIconUrl(IconBaseUrl, Achievement.UnlockedIcon));
+    }
+}
+
+bool FAwsGameKitAchievementIconAtlas::FindIcon(const FString& IconUrl, FAwsGameKitAtlasIcon& OutIcon) const
+{
+    check(IsInGameThread());
+    const FIconEntry* Entry = Icons.Find(IconUrl);
+    if (Entry == nullptr || Entry->State != EIconState::Packed)
+    {
+        return false;
+    }
+
+    OutIcon = Entry->Icon;
+    return true;
+}
+
+bool FAwsGameKitAchievementIconAtlas::FindAchievementIcon(const FString& IconBaseUrl, const FAchievement& Achievement, bool bLocked, FAwsGameKitAtlasIcon& OutIcon) const
+{
+    const FString& IconPath = bLocked ? Achievement.LockedIcon : Achievement.UnlockedIcon;
+    if (IconPath.IsEmpty())
+    {
+        return false;
+    }
+
+    return FindIcon(AwsGameKitAchievements::GetAchievementIconUrl(IconBaseUrl, IconPath), OutIcon);
+}
+
+void FAwsGameKitAchievementIconAtlas::Reset()
+{
+    check(IsInGameThread());
+    Generation++;
+    CancelRequests();
+    Icons.Reset();
+    ReleasePages();
+    PageSize = 0;
+    CellSize = 0;
+    NextCell = 0;
+}
+
+void FAwsGameKitAchievementIconAtlas::CancelPendingIcons()
+{
+    check(IsInGameThread());
+
+    // Drop the results of the reads and decodes in flight too
+    Generation++;
+    CancelRequests();
+    for (auto It = Icons.CreateIterator(); It; ++It)
+    {
+        if (It.Value().State == EIconState::Pending)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FAwsGameKitAchievementIconAtlas::CancelRequests()
+{
+    // CancelRequest() may call HandleResponse() right away, which removes the request
+    TMap<FString, FHttpRequestPtr> Requests = MoveTemp(InFlightRequests);
+    InFlightRequests.Reset();
+    for (const TPair<FString, FHttpRequestPtr>& Request : Requests)
+    {
+        Request.Value->CancelRequest();
+    }
+}
+
+void FAwsGameKitAchievementIconAtlas::SendRequest(const FString& IconUrl, const FString& CachedETag)
+{
+    // Request to download the icon, or to confirm that the cached one is still current
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FAwsGameKitTransport::Get().CreateRequest();
+    HttpRequest->SetURL(IconUrl);
+    HttpRequest->SetVerb(TEXT("GET"));
+    if (!CachedETag.IsEmpty())
+    {
+        HttpRequest->SetHeader(TEXT("If-None-Match"), CachedETag);
+    }
+    HttpRequest->OnProcessRequestComplete().BindRaw(this, &FAwsGameKitAchievementIconAtlas::HandleResponse, Generation);
+    InFlightRequests.Add(IconUrl, HttpRequest);
+    HttpRequest->ProcessRequest();
+}
+
+void FAwsGameKitAchievementIconAtlas::HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded, uint32 RequestGeneration)
+{
+    if (RequestGeneration != Generation)
+    {
+        return;
+    }
+
+    const FString IconUrl = Request->GetURL();
+    InFlightRequests.Remove(IconUrl);
+    if (!bSucceeded || !Response.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementIconAtlas: Failed to download %s"), *IconUrl);
+        FailIcon(IconUrl);
+        return;
+    }
+
+    const int32 InnerSize = CellSize - CELL_PADDING * 2;
+    const int32 ResponseCode = Response->GetResponseCode();
+    if (ResponseCode == EHttpResponseCodes::NotModified)
+    {
+        ValidatedUrls.Add(IconUrl);
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, IconUrl, RequestGeneration, InnerSize]()
+        {
+            TArray<uint8> CachedImgData;
+            FString CachedETag;
+            if (FAwsGameKitIconDiskCache::Load(IconUrl, CachedImgData, CachedETag))
+            {
+                DecodeOnWorker(IconUrl, MoveTemp(CachedImgData), RequestGeneration, InnerSize);
+                return;
+            }
+
+            // Evicted since the request was sent, download it again
+            AsyncTask(ENamedThreads::GameThread, [this, IconUrl, RequestGeneration]()
+            {
+                if (RequestGeneration == Generation)
+                {
+                    ValidatedUrls.Remove(IconUrl);
+                    SendRequest(IconUrl, FString());
+                }
+            });
+        });
+        return;
+    }
+
+    if (!EHttpResponseCodes::IsOk(ResponseCode))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementIconAtlas: Failed to download %s; %d"), *IconUrl, ResponseCode);
+        FailIcon(IconUrl);
+        return;
+    }
+
+    ValidatedUrls.Add(IconUrl);
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, IconUrl, ETag = Response->GetHeader(TEXT("ETag")), ImgData = Response->GetContent(), RequestGeneration, InnerSize]() mutable
+    {
+        FAwsGameKitIconDiskCache::Save(IconUrl, ETag, ImgData);
+        DecodeOnWorker(IconUrl, MoveTemp(ImgData), RequestGeneration, InnerSize);
+    });
+}
+
+void FAwsGameKitAchievementIconAtlas::DecodeOnWorker(const FString& IconUrl, TArray<uint8>&& ImgData, uint32 RequestGeneration, int32 InnerSize)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    check(!IsInGameThread());
+
+    TSharedPtr<IImageWrapper> ImgWrapper = ImageWrapperModule->CreateImageWrapper(ImageWrapperModule->DetectImageFormat(ImgData.GetData(), ImgData.Num()));
+    TArray64<uint8> RawImage;
+    const int32 BitDepth = 8;
+    if (!ImgWrapper.IsValid() || !ImgWrapper->SetCompressed(ImgData.GetData(), ImgData.Num()) || !ImgWrapper->GetRaw(ERGBFormat::BGRA, BitDepth, RawImage))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementIconAtlas: Failed to decode %s"), *IconUrl);
+        AsyncTask(ENamedThreads::GameThread, [this, IconUrl, RequestGeneration]()
+        {
+            if (RequestGeneration == Generation)
+            {
+                FailIcon(IconUrl);
+            }
+        });
+        return;
+    }
+
+    // Scale to fit the cell, FColor is laid out as BGRA
+    const int32 SrcWidth = ImgWrapper->GetWidth();
+    const int32 SrcHeight = ImgWrapper->GetHeight();
+    const float Scale = FMath::Min(static_cast<float>(InnerSize) / SrcWidth, static_cast<float>(InnerSize) / SrcHeight);
+    const int32 Width = FMath::Clamp(FMath::RoundToInt(SrcWidth * Scale), 1, InnerSize);
+    const int32 Height = FMath::Clamp(FMath::RoundToInt(SrcHeight * Scale), 1, InnerSize);
+
+    TArray<FColor> SrcPixels;
+    SrcPixels.SetNumUninitialized(SrcWidth * SrcHeight);
+    FMemory::Memcpy(SrcPixels.GetData(), RawImage.GetData(), RawImage.Num());
+
+    TArray<FColor> Pixels;
+    if (Width == SrcWidth && Height == SrcHeight)
+    {
+        Pixels = MoveTemp(SrcPixels);
+    }
+    else
+    {
+        const bool bLinearSpace = false;
+        const bool bForceOpaqueOutput = false;
+        FImageUtils::ImageResize(SrcWidth, SrcHeight, SrcPixels, Width, Height, Pixels, bLinearSpace, bForceOpaqueOutput);
+    }
+
+    // Only the copy into the atlas page runs on the game thread
+    AsyncTask(ENamedThreads::GameThread, [this, IconUrl, Width, Height, Pixels = MoveTemp(Pixels), RequestGeneration]() mutable
+    {
+        if (RequestGeneration == Generation)
+        {
+            PackIcon(IconUrl, Width, Height, MoveTemp(Pixels));
+        }
+    });
+}
+
+void FAwsGameKitAchievementIconAtlas::PackIcon(const FString& IconUrl, int32 Width, int32 Height, TArray<FColor>&& Pixels)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FIconEntry* Entry = Icons.Find(IconUrl);
+    if (Entry == nullptr)
+    {
+        return;
+    }
+
+    const int32 CellsPerRow = PageSize / CellSize;
+    const int32 CellsPerPage = CellsPerRow * CellsPerRow;
+    const int32 PageIndex = NextCell / CellsPerPage;
+    const int32 CellIndex = NextCell % CellsPerPage;
+    if (PageIndex == Pages.Num())
+    {
+        Pages.Add(CreatePage());
+        PageBytes.fetch_add(static_cast<int64>(PageSize) * PageSize * sizeof(FColor), std::memory_order_relaxed);
+    }
+    NextCell++;
+
+    UTexture2D* Page = Pages[PageIndex];
+    const int32 DestX = (CellIndex % CellsPerRow) * CellSize + CELL_PADDING;
+    const int32 DestY = (CellIndex / CellsPerRow) * CellSize + CELL_PADDING;
+
+    // Both are owned by the render command and released once the texture has been updated
+    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(DestX, DestY, 0, 0, Width, Height);
+    TArray<FColor>* RegionPixels = new TArray<FColor>(MoveTemp(Pixels));
+    Page->UpdateTextureRegions(0, 1, Region, Width * sizeof(FColor), sizeof(FColor), reinterpret_cast<uint8*>(RegionPixels->GetData()),
+        [RegionPixels](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+        {
+            delete RegionPixels;
+            delete Regions;
+        });
+
+    Entry->State = EIconState::Packed;
+    Entry->Icon.Texture = Page;
+    Entry->Icon.UV = FBox2D(
+        FVector2D(static_cast<float>(DestX) / PageSize, static_cast<float>(DestY) / PageSize),
+        FVector2D(static_cast<float>(DestX + Width) / PageSize, static_cast<float>(DestY + Height) / PageSize));
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitAchievementIconAtlas: Packed %s into page %d"), *IconUrl, PageIndex);
+    IconReadyDelegate.Broadcast(IconUrl);
+}
+
+void FAwsGameKitAchievementIconAtlas::FailIcon(const FString& IconUrl)
+{
+    // Kept so that a bad url isn't downloaded again every frame, Reset() to retry it
+    if (FIconEntry* Entry = Icons.Find(IconUrl))
+    {
+        Entry->State = EIconState::Failed;
+    }
+}
+
+UTexture2D* FAwsGameKitAchievementIconAtlas::CreatePage() const
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    UTexture2D* Page = UTexture2D::CreateTransient(PageSize, PageSize, PF_B8G8R8A8, FName(*FString::Printf(TEXT("GameKitAchievementIconAtlas_%d"), Pages.Num())));
+    Page->SRGB = true;
+    Page->AddToRoot();
+
+    // Transient mips aren't initialized, clear the cells which no icon has been packed into yet
+    FTexture2DMipMap& Mip = Page->GetPlatformData()->Mips[0];
+    FMemory::Memzero(Mip.BulkData.Lock(LOCK_READ_WRITE), Mip.BulkData.GetBulkDataSize());
+    Mip.BulkData.Unlock();
+
+    Page->UpdateResource();
+    return Page;
+}
+
+void FAwsGameKitAchievementIconAtlas::ReleasePages()
+{
+    for (UTexture2D* Page : Pages)
+    {
+        if (IsValid(Page))
+        {
+            Page->RemoveFromRoot();
+        }
+    }
+    Pages.Reset();
+    PageBytes.store(0, std::memory_order_relaxed);
+}
+
+void FAwsGameKitAchievementIconAtlas::RegisterWithCacheBudget()
+{
+    FAwsGameKitBudgetedCache Budgeted;
+    Budgeted.GetBytes = [this]()
+    {
+        return PageBytes.load(std::memory_order_relaxed);
+    };
+    FAwsGameKitCacheBudget::Get().RegisterCache(TEXT("AchievementIconAtlas"), EAwsGameKitCachePriority::High, MoveTemp(Budgeted));
+}
@@ -4,15 +4,94 @@
 #include "Achievements/AwsGameKitAchievements.h"
 
 // GameKit
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+#include "Common/AwsGameKitPagePipeline.h"
+#include "Common/AwsGameKitSingleFlight.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "SessionManager/AwsGameKitTransport.h"
+
+// Unreal
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsBatchParallelism(
+    TEXT("GameKit.Achievements.BatchParallelism"),
+    4,
+    TEXT("Largest number of updates of an UpdateAchievementsForPlayer batch sent at the same time. The batches share the GameKit worker pool, see GameKit.WorkerPool.NumThreads.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Adds up the increments of repeated achievement IDs, like the batch UpdateAchievements endpoint
+    TArray<FUpdateAchievementRequest> MergeUpdateAchievementRequests(const TArray<FUpdateAchievementRequest>& Requests)
+    {
+        TArray<FUpdateAchievementRequest> merged;
+        TMap<FString, int32> indexById;
+        for (const FUpdateAchievementRequest& request : Requests)
+        {
+            if (const int32* index = indexById.Find(request.AchievementId))
+            {
+                merged[*index].IncrementBy += request.IncrementBy;
+            }
+            else
+            {
+                indexById.Add(request.AchievementId, merged.Add(request));
+            }
+        }
+        return merged;
+    }
+
+    // Written by the AggregateAchievementStats Lambda, next to the icons
+    const TCHAR* ACHIEVEMENT_STATS_PATH = TEXT("stats/achievement_stats.json");
+
+    // Used when the stats are served without a max-age
+    const double DEFAULT_STATS_MAX_AGE_SECONDS = 60.0;
+
+    struct FAchievementStatsCache
+    {
+        FCriticalSection Mutex;
+        FAchievementStats Stats;
+        FString ETag;
+        double ExpiresAt = 0.0;
+        bool bIsSet = false;
+    };
+
+    FAchievementStatsCache& GetAchievementStatsCache()
+    {
+        static FAchievementStatsCache Cache;
+        return Cache;
+    }
+
+    double GetMaxAgeSeconds(const FString& CacheControl)
+    {
+        if (CacheControl.Contains(TEXT("no-cache")) || CacheControl.Contains(TEXT("no-store")))
+        {
+            return 0.0;
+        }
+
+        const int32 start = CacheControl.Find(TEXT("max-age="));
+        if (start == INDEX_NONE)
+        {
+            return DEFAULT_STATS_MAX_AGE_SECONDS;
+        }
+        return FMath::Max(0, FCString::Atoi(*CacheControl.Mid(start + 8)));
+    }
+}
 
 AchievementsLibrary AwsGameKitAchievements::GetAchievementsLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievements::GetAchievementsLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetAchievementsLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 }
 
 void AwsGameKitAchievements::ListAchievementsForPlayer(
@@ -20,82 +99,531 @@ void AwsGameKitAchievements::ListAchievementsForPlayer(
     TAwsGameKitDelegateParam<const TArray<FAchievement>&> OnResultReceivedDelegate,
     FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Achievements", "ListAchievementsForPlayer");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
 
+        const bool cacheEnabled = FAwsGameKitAchievementsCache::IsEnabled();
+        TArray<FAchievement> allAchievements;
+
+        // The backend returns only the changed achievements when it receives updated_since. The client library
+        // doesn't forward it yet, so the full pages are filtered here, which saves the game the work of merging unchanged achievements.
+        FDateTime updatedSince;
+        const bool incremental = FAwsGameKitAchievementProgress::ParseTimestamp(ListAchievementsRequest.UpdatedSince, updatedSince);
+        if (!incremental && !ListAchievementsRequest.UpdatedSince.IsEmpty())
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("AwsGameKitAchievements::ListAchievementsForPlayer(): Ignoring UpdatedSince %s, which isn't an ISO 8601 timestamp"), *ListAchievementsRequest.UpdatedSince);
+        }
+
+        // The client library requests the next page when the dispatcher returns, so pages are decoded while the next one is in flight
+        FAwsGameKitPagePipeline pagePipeline;
+
+        // A page which didn't decode leaves the list incomplete, so it isn't cached
+        bool allPagesDecoded = true;
+
         auto listAchievementsDispatcher = [&](const char* response)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievements::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
-            const FString data = UTF8_TO_TCHAR(response);
-            TArray<FAchievement> output;
-            AwsGamekitAchievementsResponseProcessor::GetListOfAchievementsFromResponse(output, data);
-            if (output.Num() > 0)
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitAchievements::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
+            if (FAwsGameKitCancellationScope::IsCurrentCallAbandoned())
             {
-                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnResultReceivedDelegate, MoveTemp(output));
+                // The client library keeps listing the remaining pages, don't decode them
+                return;
             }
+
+            // The response is only valid during the dispatch
+            TArray<ANSICHAR> page;
+            page.Append(response, FCStringAnsi::Strlen(response) + 1);
+
+            pagePipeline.Submit([&, page = MoveTemp(page)]
+            {
+                if (FAwsGameKitCancellationScope::IsCurrentCallAbandoned())
+                {
+                    return;
+                }
+
+                TArray<FAchievement> output;
+                output.Reserve(FMath::Max(0, ListAchievementsRequest.PageSize));
+                allPagesDecoded &= AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(output, page.GetData());
+                if (incremental)
+                {
+                    output.RemoveAll([&updatedSince](const FAchievement& achievement)
+                    {
+                        // UpdatedAt is the player's progress, so the definition's own timestamp is checked too.
+                        // Compared at millisecond precision, the achievements updated in the same millisecond as UpdatedSince are kept.
+                        FDateTime updatedAt;
+                        FDateTime definitionUpdatedAt;
+                        const bool hasUpdatedAt = FAwsGameKitAchievementProgress::ParseTimestamp(achievement.UpdatedAt, updatedAt);
+                        const bool hasDefinitionUpdatedAt = FAwsGameKitAchievementProgress::ParseTimestamp(achievement.DefinitionUpdatedAt, definitionUpdatedAt);
+                        return (hasUpdatedAt || hasDefinitionUpdatedAt)
+                            && (!hasUpdatedAt || updatedAt < updatedSince)
+                            && (!hasDefinitionUpdatedAt || definitionUpdatedAt < updatedSince);
+                    });
+                }
+                if (output.Num() > 0)
+                {
+                    if (cacheEnabled)
+                    {
+                        allAchievements.Append(output);
+                    }
+                    InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnResultReceivedDelegate, MoveTemp(output));
+                }
+            });
         };
         typedef LambdaDispatcher<decltype(listAchievementsDispatcher), void, const char*> ListAchievementsDispatcher;
 
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitListAchievements(achievementsLibrary.AchievementsInstanceHandle, ListAchievementsRequest.PageSize, ListAchievementsRequest.WaitForAllPages, &listAchievementsDispatcher, ListAchievementsDispatcher::Dispatch));
+        pagePipeline.Wait();
+
+        if (cacheEnabled && result.Result == GameKit::GAMEKIT_SUCCESS && allPagesDecoded && !FAwsGameKitCancellationScope::IsCurrentCallAbandoned())
+        {
+            if (incremental)
+            {
+                FAwsGameKitAchievementsCache::Get().MergeAchievements(allAchievements);
+            }
+            else
+            {
+                FAwsGameKitAchievementsCache::Get().StoreAchievements(allAchievements);
+            }
+        }
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
     });
 }
 
+void AwsGameKitAchievements::ListAchievementsForPlayerRefreshIfStale(
+    TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("Achievements", "ListAchievementsForPlayerRefreshIfStale");
+
+    if (!FAwsGameKitAchievementsCache::IsEnabled())
+    {
+        ListAchievementsForPlayer(ResultDelegate);
+        return;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+        FGraphEventRef OrderedWorkChain;
+
+        TArray<FAchievement> cached;
+        bool isStale = true;
+        if (FAwsGameKitAchievementsCache::Get().GetAchievements(cached, isStale))
+        {
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_SUCCESS), MoveTemp(cached));
+        }
+
+        if (isStale)
+        {
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitAchievements::ListAchievementsForPlayerRefreshIfStale(): Refreshing the cached achievements"));
+
+            // ListAchievementsForPlayer() stores the refreshed list in the cache
+            ListAchievementsForPlayer(ResultDelegate);
+        }
+    });
+}
+
 void AwsGameKitAchievements::GetAchievementForPlayer(
     const FGetAchievementRequest& GetAchievementRequest,
     TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementForPlayer");
+
+    // Several places asking for the same achievement at once share one request
+    static TAwsGameKitSingleFlight<FAchievement> getAchievementFlights;
+    bool tracked;
+    if (!getAchievementFlights.Join(GetAchievementRequest.AchievementId, ResultDelegate, tracked))
+    {
+        return;
+    }
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
-        FGraphEventRef OrderedWorkChain;
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
 
         FAchievement ach;
         auto getAchievementDispatcher = [&](const char* response)
         {
-            FString achievementStr = UTF8_TO_TCHAR(response);
-            ach = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementStr));
+            AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(ach, response);
         };
         typedef LambdaDispatcher<decltype(getAchievementDispatcher), void, const char*> GetAchievementDispatcher;
 
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitGetAchievement(achievementsLibrary.AchievementsInstanceHandle,
             TCHAR_TO_UTF8(*GetAchievementRequest.AchievementId), &getAchievementDispatcher, GetAchievementDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, ach);
+        if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitAchievementsCache::IsEnabled())
+        {
+            FAwsGameKitAchievementsCache::Get().MergeProgress(ach);
+        }
+
+        getAchievementFlights.Complete(GetAchievementRequest.AchievementId, tracked, ResultDelegate, result, MoveTemp(ach));
     });
 }
 
+IntResult AwsGameKitAchievements::UpdateAchievementForPlayerBlocking(const FUpdateAchievementRequest& UpdateAchievementRequest, FAchievement& OutAchievement)
+{
+    const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
+
+    auto updateAchievementDispatcher = [&](const char* response)
+    {
+        AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(OutAchievement, response);
+    };
+    typedef LambdaDispatcher<decltype(updateAchievementDispatcher), void, const char*> UpdateAchievementDispatcher;
+
+    IntResult result(achievementsLibrary.AchievementsWrapper->GameKitUpdateAchievement(achievementsLibrary.AchievementsInstanceHandle,
+        TCHAR_TO_UTF8(*UpdateAchievementRequest.AchievementId), UpdateAchievementRequest.IncrementBy,
+        &updateAchievementDispatcher, UpdateAchievementDispatcher::Dispatch));
+
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        if (FAwsGameKitAchievementsCache::IsEnabled())
+        {
+            FAwsGameKitAchievementsCache::Get().MergeProgress(OutAchievement);
+        }
+        if (FAwsGameKitAchievementsUpdateCoalescer::IsEnabled())
+        {
+            FAwsGameKitAchievementsUpdateCoalescer::Get().RecordProgress(OutAchievement);
+        }
+    }
+
+    return result;
+}
+
+void AwsGameKitAchievements::EnqueueUpdateIfOffline(const FUpdateAchievementRequest& UpdateAchievementRequest, IntResult& InOutResult)
+{
+    if (UpdateAchievementRequest.IncrementBy <= 0 || !FAwsGameKitOfflineWriteQueue::IsOfflineResult(InOutResult))
+    {
+        return;
+    }
+
+    if (FAwsGameKitOfflineWriteQueue::Get().Enqueue(TEXT("Achievements"), UpdateAchievementRequest.AchievementId, LexToString(UpdateAchievementRequest.IncrementBy)))
+    {
+        InOutResult = IntResult(GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED);
+    }
+}
+
+bool AwsGameKitAchievements::FindEarnedAchievementToSkipUpdate(const FUpdateAchievementRequest& UpdateAchievementRequest, FAchievement& OutAchievement)
+{
+    bool isStale = false;
+    if (!FAwsGameKitAchievementsCache::ShouldSkipEarnedUpdates() ||
+        !FAwsGameKitAchievementsCache::Get().FindEarnedAchievement(UpdateAchievementRequest.AchievementId, OutAchievement, isStale))
+    {
+        return false;
+    }
+
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitAchievements::UpdateAchievementForPlayer(): %s is already earned, skipping the update"), *UpdateAchievementRequest.AchievementId);
+    if (isStale)
+    {
+        // GetAchievementForPlayer() merges the fetched progress into the cache
+        GetAchievementForPlayer(FGetAchievementRequest{ UpdateAchievementRequest.AchievementId }, TAwsGameKitDelegate<const IntResult&, const FAchievement&>());
+    }
+    return true;
+}
+
 void AwsGameKitAchievements::UpdateAchievementForPlayer(
     const FUpdateAchievementRequest& UpdateAchievementRequest,
     TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Achievements", "UpdateAchievementForPlayer");
+
+    FAchievement earned;
+    if (FindEarnedAchievementToSkipUpdate(UpdateAchievementRequest, earned))
+    {
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_WARNING_ACHIEVEMENTS_ALREADY_EARNED), MoveTemp(earned));
+        return;
+    }
+
+    if (FAwsGameKitAchievementsUpdateCoalescer::Get().Add(UpdateAchievementRequest, ResultDelegate))
+    {
+        return;
+    }
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         FAchievement ach;
-        auto updateAchievementDispatcher = [&](const char* response)
+        IntResult result = UpdateAchievementForPlayerBlocking(UpdateAchievementRequest, ach);
+        EnqueueUpdateIfOffline(UpdateAchievementRequest, result);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(ach));
+    });
+}
+
+IntResult AwsGameKitAchievements::UpdateAchievementsForPlayerBlocking(const TArray<FUpdateAchievementRequest>& UpdateAchievementRequests, TArray<FAchievement>& OutAchievements)
+{
+    const TArray<FUpdateAchievementRequest> requests = MergeUpdateAchievementRequests(UpdateAchievementRequests);
+    TArray<IntResult> results;
+    TArray<FAchievement> achievements;
+    results.SetNum(requests.Num());
+    achievements.SetNum(requests.Num());
+
+    FAwsGameKitWorkerPool::Get().ParallelFor(requests.Num(), CVarGameKitAchievementsBatchParallelism.GetValueOnAnyThread(), [&](int32 index)
+    {
+        if (FindEarnedAchievementToSkipUpdate(requests[index], achievements[index]))
         {
-            FString achievementStr = UTF8_TO_TCHAR(response);
-            ach = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementStr));
+            results[index] = IntResult(GameKit::GAMEKIT_SUCCESS);
+            return;
+        }
+
+        results[index] = UpdateAchievementForPlayerBlocking(requests[index], achievements[index]);
+        EnqueueUpdateIfOffline(requests[index], results[index]);
+    });
+
+    IntResult result(GameKit::GAMEKIT_SUCCESS);
+    OutAchievements.Reset(requests.Num());
+    for (int32 i = 0; i < requests.Num(); ++i)
+    {
+        if (results[i].Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            OutAchievements.Add(MoveTemp(achievements[i]));
+        }
+        else if (result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            result = results[i];
+        }
+    }
+
+    return result;
+}
+
+void AwsGameKitAchievements::UpdateAchievementsForPlayer(
+    const TArray<FUpdateAchievementRequest>& UpdateAchievementRequests,
+    TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("Achievements", "UpdateAchievementsForPlayer");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+        FGraphEventRef OrderedWorkChain;
+
+        TArray<FAchievement> achievements;
+        IntResult result = UpdateAchievementsForPlayerBlocking(UpdateAchievementRequests, achievements);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(achievements));
+    });
+}
+
+IntResult AwsGameKitAchievements::GetAchievementSummaryBlocking(FAchievementSummary& OutSummary)
+{
+    // Summarized straight from the cached catalog, without creating an FAchievement per achievement
+    FAwsGameKitAchievementCatalogPtr catalog;
+    TArray<FAwsGameKitAchievementProgress> progress;
+    bool isStale = true;
+    if (FAwsGameKitAchievementsCache::IsEnabled() && FAwsGameKitAchievementsCache::Get().GetCatalog(catalog, progress, isStale) && !isStale)
+    {
+        OutSummary = catalog->Summarize(progress);
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
+    TArray<FAchievement> achievements;
+
+    const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
+    const FListAchievementsRequest request = { 100, true };
+
+    achievements.Reset();
+    bool allPagesDecoded = true;
+    auto listAchievementsDispatcher = [&](const char* response)
+    {
+        allPagesDecoded &= AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(achievements, response);
+    };
+    typedef LambdaDispatcher<decltype(listAchievementsDispatcher), void, const char*> ListAchievementsDispatcher;
+
+    IntResult result(achievementsLibrary.AchievementsWrapper->GameKitListAchievements(achievementsLibrary.AchievementsInstanceHandle, request.PageSize, request.WaitForAllPages, &listAchievementsDispatcher, ListAchievementsDispatcher::Dispatch));
+
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        // Only a complete list replaces the cache, which is then fresh
+        if (FAwsGameKitAchievementsCache::IsEnabled() && allPagesDecoded)
+        {
+            FAwsGameKitAchievementsCache::Get().StoreAchievements(achievements);
+        }
+        OutSummary = SummarizeAchievements(achievements);
+    }
+
+    return result;
+}
+
+void AwsGameKitAchievements::GetAchievementSummary(
+    TAwsGameKitDelegateParam<const IntResult&, const FAchievementSummary&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementSummary");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+        FGraphEventRef OrderedWorkChain;
+
+        FAchievementSummary summary;
+        IntResult result = GetAchievementSummaryBlocking(summary);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(summary));
+    });
+}
+
+FAchievementSummary AwsGameKitAchievements::SummarizeAchievements(const TArray<FAchievement>& Achievements)
+{
+    FAchievementSummary summary;
+    summary.TotalCount = Achievements.Num();
+    for (const FAchievement& achievement : Achievements)
+    {
+        summary.TotalPoints += achievement.Points;
+        if (achievement.IsEarned)
+        {
+            summary.EarnedCount++;
+            summary.EarnedPoints += achievement.Points;
+        }
+    }
+    return summary;
+}
+
+FString AwsGameKitAchievements::GetAchievementIconUrl(const FString& IconBaseUrl, const FString& IconPath, int32 Size)
+{
+    if (Size <= 0 || IconPath.IsEmpty())
+    {
+        return IconBaseUrl + IconPath;
+    }
+
+    // Same naming as the ResizeIcon Lambda: icons/trophy.png -> icons/trophy_64.png
+    const FString Suffix = FString::Printf(TEXT("_%d"), Size);
+    int32 ExtensionStart;
+    int32 FileNameStart;
+    IconPath.FindLastChar(TEXT('/'), FileNameStart);
+    if (IconPath.FindLastChar(TEXT('.'), ExtensionStart) && ExtensionStart > FileNameStart)
+    {
+        return IconBaseUrl + IconPath.Left(ExtensionStart) + Suffix + IconPath.Mid(ExtensionStart);
+    }
+    return IconBaseUrl + IconPath + Suffix;
+}
+
+bool AwsGameKitAchievements::ParseAchievementStats(const FString& Json, FAchievementStats& OutStats)
+{
+    TSharedPtr<FJsonObject> root;
+    const TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(Json);
+    const TArray<TSharedPtr<FJsonValue>>* achievements;
+    if (!FJsonSerializer::Deserialize(reader, root) || !root.IsValid() || !root->TryGetArrayField(TEXT("achievements"), achievements))
+    {
+        return false;
+    }
+
+    OutStats = FAchievementStats();
+    root->TryGetStringField(TEXT("updated_at"), OutStats.UpdatedAt);
+    root->TryGetNumberField(TEXT("player_count"), OutStats.PlayerCount);
+    OutStats.Achievements.Reserve(achievements->Num());
+    for (const TSharedPtr<FJsonValue>& value : *achievements)
+    {
+        const TSharedPtr<FJsonObject>* achievement;
+        if (!value.IsValid() || !value->TryGetObject(achievement))
+        {
+            return false;
+        }
+
+        FAchievementStat& stat = OutStats.Achievements.AddDefaulted_GetRef();
+        double earnedPercent = 0.0;
+        (*achievement)->TryGetStringField(TEXT("achievement_id"), stat.AchievementId);
+        (*achievement)->TryGetNumberField(TEXT("earned_count"), stat.EarnedCount);
+        (*achievement)->TryGetNumberField(TEXT("earned_percent"), earnedPercent);
+        stat.EarnedPercent = static_cast<float>(earnedPercent);
+    }
+    return true;
+}
+
+void AwsGameKitAchievements::GetAchievementStats(
+    TAwsGameKitDelegateParam<const IntResult&, const FAchievementStats&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementStats");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]() {
+        FGraphEventRef OrderedWorkChain;
+        FAchievementStatsCache& cache = GetAchievementStatsCache();
+
+        FString cachedETag;
+        {
+            FScopeLock lock(&cache.Mutex);
+            if (cache.bIsSet && FPlatformTime::Seconds() < cache.ExpiresAt)
+            {
+                FAchievementStats stats = cache.Stats;
+                lock.Unlock();
+                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_SUCCESS), MoveTemp(stats));
+                return;
+            }
+            if (cache.bIsSet)
+            {
+                cachedETag = cache.ETag;
+            }
+        }
+
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
+        FString baseUrl;
+        auto getBaseUrlDispatcher = [&](const char* response)
+        {
+            baseUrl = UTF8_TO_TCHAR(response);
         };
-        typedef LambdaDispatcher<decltype(updateAchievementDispatcher), void, const char*> UpdateAchievementDispatcher;
+        typedef LambdaDispatcher<decltype(getBaseUrlDispatcher), void, const char*> GetBaseUrlDispatcher;
+
+        IntResult result(achievementsLibrary.AchievementsWrapper->GameKitGetAchievementIconsBaseUrl(achievementsLibrary.AchievementsInstanceHandle, &getBaseUrlDispatcher, GetBaseUrlDispatcher::Dispatch));
+        if (result.Result != GameKit::GAMEKIT_SUCCESS)
+        {
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, FAchievementStats());
+            return;
+        }
 
-        IntResult result(achievementsLibrary.AchievementsWrapper->GameKitUpdateAchievement(achievementsLibrary.AchievementsInstanceHandle,
-            TCHAR_TO_UTF8(*UpdateAchievementRequest.AchievementId), UpdateAchievementRequest.IncrementBy,
-            &updateAchievementDispatcher, UpdateAchievementDispatcher::Dispatch));
+        // Plain CloudFront GET: the native library has no call for the published stats
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> httpRequest = FAwsGameKitTransport::Get().CreateRequest();
+        httpRequest->SetURL(baseUrl + ACHIEVEMENT_STATS_PATH);
+        httpRequest->SetVerb(TEXT("GET"));
+        if (!cachedETag.IsEmpty())
+        {
+            httpRequest->SetHeader(TEXT("If-None-Match"), cachedETag);
+        }
+        httpRequest->OnProcessRequestComplete().BindLambda(
+            [ResultDelegate, Token = FAwsGameKitCancellationScope::GetCurrent()](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+        {
+            FAwsGameKitCancellationScope CancellationScope(Token);
+            FGraphEventRef OrderedWorkChain;
+            FAchievementStatsCache& cache = GetAchievementStatsCache();
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, ach);
+            const int32 responseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+            if (!bSucceeded || !Response.IsValid() || (!EHttpResponseCodes::IsOk(responseCode) && responseCode != EHttpResponseCodes::NotModified))
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("AwsGameKitAchievements::GetAchievementStats(): Failed to download %s; %d"), *Request->GetURL(), responseCode);
+                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED), FAchievementStats());
+                return;
+            }
+
+            const double expiresAt = FPlatformTime::Seconds() + GetMaxAgeSeconds(Response->GetHeader(TEXT("Cache-Control")));
+            FAchievementStats stats;
+            if (responseCode == EHttpResponseCodes::NotModified)
+            {
+                FScopeLock lock(&cache.Mutex);
+                cache.ExpiresAt = expiresAt;
+                stats = cache.Stats;
+            }
+            else if (ParseAchievementStats(Response->GetContentAsString(), stats))
+            {
+                FScopeLock lock(&cache.Mutex);
+                cache.Stats = stats;
+                cache.ETag = Response->GetHeader(TEXT("ETag"));
+                cache.ExpiresAt = expiresAt;
+                cache.bIsSet = true;
+            }
+            else
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("AwsGameKitAchievements::GetAchievementStats(): Malformed stats at %s"), *Request->GetURL());
+                InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_ERROR_PARSE_JSON_FAILED), FAchievementStats());
+                return;
+            }
+
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_SUCCESS), MoveTemp(stats));
+        });
+        httpRequest->ProcessRequest();
     });
 }
 
 void AwsGameKitAchievements::GetAchievementIconBaseUrl(
     TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementIconBaseUrl");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]() {
-        AchievementsLibrary achievementsLibrary = GetAchievementsLibraryFromModule();
+        const AchievementsLibrary& achievementsLibrary = GetAchievementsLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         FString url;
@@ -107,6 +635,6 @@ void AwsGameKitAchievements::GetAchievementIconBaseUrl(
 
         IntResult result(achievementsLibrary.AchievementsWrapper->GameKitGetAchievementIconsBaseUrl(achievementsLibrary.AchievementsInstanceHandle, &getBaseUrlDispatcher, GetBaseUrlDispatcher::Dispatch));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, url);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(url));
     });
 }
@@ -0,0 +1,411 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Achievements/AwsGameKitAchievementsCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitCacheBudget.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Utils/Blueprints/UAwsGameKitFileUtils.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCacheEnabled(
+    TEXT("GameKit.Achievements.Cache.Enabled"),
+    0,
+    TEXT("Caches the achievements list on the client, see AwsGameKitAchievements::ListAchievementsForPlayerRefreshIfStale().\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCacheTtlSeconds(
+    TEXT("GameKit.Achievements.Cache.TtlSeconds"),
+    3600,
+    TEXT("Number of seconds after which the cached achievement definitions are refreshed.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCacheSkipEarnedUpdates(
+    TEXT("GameKit.Achievements.Cache.SkipEarnedUpdates"),
+    0,
+    TEXT("Doesn't send achievement updates which the cached player progress shows would change nothing, see AwsGameKitAchievements::UpdateAchievementForPlayer().\n")
+    TEXT("Needs GameKit.Achievements.Cache.Enabled.\n")
+    TEXT("  0: always send updates\n")
+    TEXT("  1: skip updates of earned achievements\n"),
+    ECVF_Default);
+
+FAwsGameKitAchievementsCache& FAwsGameKitAchievementsCache::Get()
+{
+    static FAwsGameKitAchievementsCache Instance;
+    return Instance;
+}
+
+bool FAwsGameKitAchievementsCache::IsEnabled()
+{
+    return CVarGameKitAchievementsCacheEnabled.GetValueOnAnyThread() != 0;
+}
+
+bool FAwsGameKitAchievementsCache::ShouldSkipEarnedUpdates()
+{
+    return IsEnabled() && CVarGameKitAchievementsCacheSkipEarnedUpdates.GetValueOnAnyThread() != 0;
+}
+
+bool FAwsGameKitAchievementsCache::GetAchievements(TArray<FAchievement>& OutAchievements, bool& bOutIsStale)
+{
+    FAwsGameKitAchievementCatalogPtr CachedCatalog;
+    TArray<FAwsGameKitAchievementProgress> CachedProgress;
+    if (!GetCatalog(CachedCatalog, CachedProgress, bOutIsStale))
+    {
+        return false;
+    }
+
+    // The views are created outside of the lock, the catalog doesn't change
+    CachedCatalog->MakeAchievements(CachedProgress, OutAchievements);
+    return true;
+}
+
+bool FAwsGameKitAchievementsCache::GetCatalog(FAwsGameKitAchievementCatalogPtr& OutCatalog, TArray<FAwsGameKitAchievementProgress>& OutProgress, bool& bOutIsStale)
+{
+    FScopeLock ScopeLock(&Mutex);
+    LoadFromDiskIfNeeded();
+
+    const bool bIsCached = Catalog.IsValid() && Catalog->Num() != 0;
+    FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::Achievements, bIsCached);
+    if (!bIsCached)
+    {
+        return false;
+    }
+    LastUsed = FPlatformTime::Seconds();
+
+    const FPlayerProgress* Player = FindPlayerProgress();
+    const FTimespan Ttl = FTimespan::FromSeconds(FMath::Max(0, CVarGameKitAchievementsCacheTtlSeconds.GetValueOnAnyThread()));
+    bOutIsStale = Player == nullptr || FDateTime::UtcNow() - FetchedAt >= Ttl;
+    OutCatalog = Catalog;
+    if (Player != nullptr)
+    {
+        OutProgress = Player->Progress;
+    }
+    else
+    {
+        OutProgress.Reset();
+    }
+    return true;
+}
+
+bool FAwsGameKitAchievementsCache::FindAchievement(const FString& AchievementId, FAchievement& OutAchievement)
+{
+    FScopeLock ScopeLock(&Mutex);
+    LoadFromDiskIfNeeded();
+
+    const FPlayerProgress* Player = FindPlayerProgress();
+    const int32 Index = Catalog.IsValid() && Player != nullptr ? Catalog->Find(AchievementId) : INDEX_NONE;
+    FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::Achievements, Index != INDEX_NONE);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+    LastUsed = FPlatformTime::Seconds();
+
+    OutAchievement = Catalog->MakeAchievement(Index, Player->Progress[Index]);
+    return true;
+}
+
+bool FAwsGameKitAchievementsCache::FindEarnedAchievement(const FString& AchievementId, FAchievement& OutAchievement, bool& bOutIsStale)
+{
+    // Not loaded from disk here, as this is called on the game thread and a list read from disk has no player progress anyway
+    FScopeLock ScopeLock(&Mutex);
+    const FPlayerProgress* Player = FindPlayerProgress();
+    const int32 Index = Catalog.IsValid() && Player != nullptr ? Catalog->Find(AchievementId) : INDEX_NONE;
+    if (Index == INDEX_NONE || !Player->Progress[Index].bIsEarned)
+    {
+        return false;
+    }
+    LastUsed = FPlatformTime::Seconds();
+
+    const FTimespan Ttl = FTimespan::FromSeconds(FMath::Max(0, CVarGameKitAchievementsCacheTtlSeconds.GetValueOnAnyThread()));
+    bOutIsStale = FDateTime::UtcNow() - Player->UpdatedAt[Index] >= Ttl;
+    OutAchievement = Catalog->MakeAchievement(Index, Player->Progress[Index]);
+    return true;
+}
+
+void FAwsGameKitAchievementsCache::StoreAchievements(const TArray<FAchievement>& NewAchievements)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+
+    // Built outside of the lock, the catalog is immutable once built
+    TArray<FAwsGameKitAchievementProgress> NewProgress;
+    FAwsGameKitAchievementCatalogRef NewCatalog = FAwsGameKitAchievementCatalog::Build(NewAchievements, &NewProgress);
+
+    FString Json;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Catalog = NewCatalog;
+        FetchedAt = FDateTime::UtcNow();
+        LastUsed = FPlatformTime::Seconds();
+        bTriedDisk = true;
+
+        // The other players' progress was at the indices of the previous catalog
+        FPlayerProgress Player;
+        Player.Progress = MoveTemp(NewProgress);
+        Player.UpdatedAt.Init(FetchedAt, Player.Progress.Num());
+        PlayerProgress.Reset();
+        PlayerProgress.Add(FAwsGameKitPlayerScope::GetCurrent(), MoveTemp(Player));
+        UpdateCachedBytes();
+        Json = SerializeDefinitions();
+    }
+
+    // Written outside of the lock so that readers on the game thread don't wait on the disk
+    const FString FilePath = GetCacheFilePath();
+    if (!FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementsCache: Failed to write %s"), *FilePath);
+    }
+}
+
+void FAwsGameKitAchievementsCache::MergeAchievements(const TArray<FAchievement>& UpdatedAchievements)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FString Json;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        LoadFromDiskIfNeeded();
+        if (!Catalog.IsValid() || Catalog->Num() == 0 || UpdatedAchievements.Num() == 0)
+        {
+            return;
+        }
+
+        // The cached achievements keep their indices, new ones are appended
+        const int32 PreviousNum = Catalog->Num();
+        Catalog = Catalog->WithUpdatedDefinitions(UpdatedAchievements);
+
+        // The other players' progress of the new achievements isn't known
+        if (Catalog->Num() != PreviousNum)
+        {
+            for (auto It = PlayerProgress.CreateIterator(); It; ++It)
+            {
+                if (It.Key() != FAwsGameKitPlayerScope::GetCurrent())
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+
+        if (FPlayerProgress* Player = FindPlayerProgress())
+        {
+            const FDateTime Now = FDateTime::UtcNow();
+            Player->Progress.SetNum(Catalog->Num());
+            Player->UpdatedAt.SetNum(Catalog->Num());
+            for (const FAchievement& Updated : UpdatedAchievements)
+            {
+                const int32 Index = Catalog->Find(Updated.AchievementId);
+                Player->Progress[Index] = FAwsGameKitAchievementProgress::FromAchievement(Updated);
+                Player->UpdatedAt[Index] = Now;
+            }
+        }
+
+        LastUsed = FPlatformTime::Seconds();
+        UpdateCachedBytes();
+        Json = SerializeDefinitions();
+    }
+
+    const FString FilePath = GetCacheFilePath();
+    if (!FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementsCache: Failed to write %s"), *FilePath);
+    }
+}
+
+FString FAwsGameKitAchievementsCache::GetLatestUpdatedAt() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FPlayerProgress* Player = FindPlayerProgress();
+    if (Player == nullptr)
+    {
+        return FString();
+    }
+
+    // Returned as the backend wrote it, so that the sub-millisecond digits are kept
+    const FString* Latest = nullptr;
+    FDateTime LatestTime = FDateTime::MinValue();
+    for (const FAwsGameKitAchievementProgress& AchievementProgress : Player->Progress)
+    {
+        FDateTime UpdatedAt;
+        if (FAwsGameKitAchievementProgress::ParseTimestamp(AchievementProgress.UpdatedAt, UpdatedAt) && (Latest == nullptr || UpdatedAt > LatestTime))
+        {
+            Latest = &AchievementProgress.UpdatedAt;
+            LatestTime = UpdatedAt;
+        }
+    }
+    return Latest != nullptr ? *Latest : FString();
+}
+
+void FAwsGameKitAchievementsCache::MergeProgress(const FAchievement& Achievement)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerProgress* Player = FindPlayerProgress();
+    const int32 Index = Catalog.IsValid() && Player != nullptr ? Catalog->Find(Achievement.AchievementId) : INDEX_NONE;
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    Player->Progress[Index] = FAwsGameKitAchievementProgress::FromAchievement(Achievement);
+    Player->UpdatedAt[Index] = FDateTime::UtcNow();
+}
+
+void FAwsGameKitAchievementsCache::ClearProgress()
+{
+    ClearProgress(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+void FAwsGameKitAchievementsCache::ClearProgress(FAwsGameKitPlayerHandle Player)
+{
+    FScopeLock ScopeLock(&Mutex);
+    PlayerProgress.Remove(Player);
+    UpdateCachedBytes();
+}
+
+void FAwsGameKitAchievementsCache::Invalidate()
+{
+    FScopeLock ScopeLock(&Mutex);
+    Catalog.Reset();
+    PlayerProgress.Reset();
+    CachedBytes = 0;
+    bTriedDisk = true;
+    IFileManager::Get().Delete(*GetCacheFilePath(), false, false, true);
+}
+
+void FAwsGameKitAchievementsCache::RegisterWithCacheBudget()
+{
+    FAwsGameKitBudgetedCache Budgeted;
+    Budgeted.GetBytes = [this]()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        return CachedBytes;
+    };
+    Budgeted.GetOldestUse = [this]()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        return Catalog.IsValid() && Catalog->Num() > 0 ? LastUsed : MAX_dbl;
+    };
+    Budgeted.EvictOldest = [this]()
+    {
+        return EvictFromMemory();
+    };
+    FAwsGameKitCacheBudget::Get().RegisterCache(TEXT("Achievements"), EAwsGameKitCachePriority::High, MoveTemp(Budgeted));
+}
+
+int64 FAwsGameKitAchievementsCache::EvictFromMemory()
+{
+    FScopeLock ScopeLock(&Mutex);
+    const int64 FreedBytes = CachedBytes;
+
+    // Callers of GetCatalog() may still hold the catalog, it's freed with their last reference
+    Catalog.Reset();
+    PlayerProgress.Empty();
+    CachedBytes = 0;
+
+    // The definitions are still on disk
+    bTriedDisk = false;
+    return FreedBytes;
+}
+
+void FAwsGameKitAchievementsCache::LoadFromDiskIfNeeded()
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    if (bTriedDisk)
+    {
+        return;
+    }
+    bTriedDisk = true;
+
+    const FString FilePath = GetCacheFilePath();
+    TArray<uint8> FileContents;
+    if (!FFileHelper::LoadFileToArray(FileContents, *FilePath, FILEREAD_Silent))
+    {
+        return;
+    }
+    FileContents.Add('\0');
+
+    TArray<FAchievement> Loaded;
+    if (!AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(Loaded, reinterpret_cast<const char*>(FileContents.GetData())))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementsCache: Ignoring malformed cache file %s"), *FilePath);
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitAchievementsCache: Loaded %d achievement definitions from disk"), Loaded.Num());
+    Catalog = FAwsGameKitAchievementCatalog::Build(Loaded);
+    FetchedAt = IFileManager::Get().GetTimeStamp(*FilePath);
+    LastUsed = FPlatformTime::Seconds();
+    PlayerProgress.Reset();
+    UpdateCachedBytes();
+}
+
+FString FAwsGameKitAchievementsCache::SerializeDefinitions() const
+{
+    // Same layout as the ListAchievements response so that it can be read back with the response decoder. Player progress isn't written.
+    FString Json;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+    Writer->WriteObjectStart();
+    Writer->WriteObjectStart(TEXT("data"));
+    Writer->WriteArrayStart(TEXT("achievements"));
+    const FAwsGameKitAchievementProgress NoProgress;
+    for (int32 i = 0; i < Catalog->Num(); ++i)
+    {
+        const FAchievement Achievement = Catalog->MakeAchievement(i, NoProgress);
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("achievement_id"), Achievement.AchievementId);
+        Writer->WriteValue(TEXT("title"), Achievement.Title);
+        Writer->WriteValue(TEXT("locked_description"), Achievement.LockedDescription);
+        Writer->WriteValue(TEXT("unlocked_description"), Achievement.UnlockedDescription);
+        Writer->WriteValue(TEXT("locked_icon_url"), Achievement.LockedIcon);
+        Writer->WriteValue(TEXT("unlocked_icon_url"), Achievement.UnlockedIcon);
+        Writer->WriteValue(TEXT("max_value"), Achievement.RequiredAmount);
+        Writer->WriteValue(TEXT("points"), Achievement.Points);
+        Writer->WriteValue(TEXT("order_number"), Achievement.OrderNumber);
+        Writer->WriteValue(TEXT("is_secret"), Achievement.IsSecret);
+        Writer->WriteValue(TEXT("is_hidden"), Achievement.IsHidden);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Json;
+}
+
+FAwsGameKitAchievementsCache::FPlayerProgress* FAwsGameKitAchievementsCache::FindPlayerProgress()
+{
+    return PlayerProgress.Find(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+const FAwsGameKitAchievementsCache::FPlayerProgress* FAwsGameKitAchievementsCache::FindPlayerProgress() const
+{
+    return PlayerProgress.Find(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+void FAwsGameKitAchievementsCache::UpdateCachedBytes()
+{
+    CachedBytes = (Catalog.IsValid() ? Catalog->GetAllocatedSize() : 0) + PlayerProgress.GetAllocatedSize();
+    for (const TPair<FAwsGameKitPlayerHandle, FPlayerProgress>& Player : PlayerProgress)
+    {
+        CachedBytes += Player.Value.Progress.GetAllocatedSize() + Player.Value.UpdatedAt.GetAllocatedSize();
+    }
+}
+
+FString FAwsGameKitAchievementsCache::GetCacheFilePath()
+{
+    return FPaths::Combine(UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::Achievements), TEXT("AchievementsCache.json"));
+}
@@ -4,6 +4,9 @@
 #include "Achievements//AwsGameKitAchievementsFunctionLibrary.h"
 
 // GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
 #include "Core/AwsGameKitErrors.h"
@@ -22,19 +25,19 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementIconsBaseUrl");
 
     TAwsGameKitInternalActionStatePtr<FString> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("Achievements.GetAchievementIconsBaseUrl"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto getUrlDispatcher = [&](const char* response)
             {
-                UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl() GetUrlDispatcher::Dispatch"));
+                UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl() GetUrlDispatcher::Dispatch"));
                 State->Results = UTF8_TO_TCHAR(response);
             };
 
@@ -47,6 +50,11 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconsBaseUrl(
     }
 }
 
+FString UAwsGameKitAchievementsFunctionLibrary::GetAchievementIconUrl(const FString& IconBaseUrl, const FString& IconPath, int32 Size)
+{
+    return AwsGameKitAchievements::GetAchievementIconUrl(IconBaseUrl, IconPath, Size);
+}
+
 void UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(
     UObject* WorldContextObject,
     struct FLatentActionInfo LatentInfo,
@@ -56,30 +64,30 @@ void UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "ListAchievementsForPlayer");
 
     TAwsGameKitInternalActionStatePtr<TArray<FAchievement>> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, ListAchievementsRequest, SuccessOrFailure, Error, Results, OnPartialResults))
     {
-        Action->LaunchThreadedWork([ListAchievementsRequest, State]
+        Action->LaunchThreadedWork(TEXT("Achievements.ListAchievementsForPlayer"), [ListAchievementsRequest, State]
         {
             TArray<FAchievement> CompletedResult;
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             FAwsGameKitOperationResult operationResult;
 
             auto listAchievementsDispatcher = [&](const char* response)
             {
-                UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
-                FString data(UTF8_TO_TCHAR(response));
+                UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(): ListAchievementsDispatcher::Dispatch"));
                 TArray<FAchievement> output;
-                AwsGamekitAchievementsResponseProcessor::GetListOfAchievementsFromResponse(output, data);
+                output.Reserve(FMath::Max(0, ListAchievementsRequest.PageSize));
+                AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(output, response);
                 if (output.Num() > 0)
                 {
                     if (State->PartialResultsQueue)
                     {
-                        State->PartialResultsQueue->Enqueue(output);
+                        State->EnqueuePartialResults(CopyTemp(output));
                     }
                     CompletedResult.Append(MoveTemp(output));
                 }                
@@ -92,6 +100,11 @@ void UAwsGameKitAchievementsFunctionLibrary::ListAchievementsForPlayer(
                 &listAchievementsDispatcher,
                 ListAchievementsDispatcher::Dispatch));
 
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitAchievementsCache::IsEnabled())
+            {
+                FAwsGameKitAchievementsCache::Get().StoreAchievements(CompletedResult);
+            }
+
             State->Results = MoveTemp(CompletedResult);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
@@ -106,21 +119,20 @@ void UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "UpdateAchievementForPlayer");
 
     TAwsGameKitInternalActionStatePtr<FAchievement> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([UpdateAchievementsRequest, State]
+        Action->LaunchThreadedWork(TEXT("Achievements.UpdateAchievementForPlayer"), [UpdateAchievementsRequest, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto updatedAchievementDispatcher = [&, UpdateAchievementsRequest](const char* response)
             {
-                FString updatedAchievementResponse(UTF8_TO_TCHAR(response));
-                UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer() GetUrlDispatcher::Dispatch"));
-                State->Results = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(updatedAchievementResponse));
+                UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer() GetUrlDispatcher::Dispatch"));
+                AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(State->Results, response);
             };
 
             typedef LambdaDispatcher<decltype(updatedAchievementDispatcher), void, const char*> UpdatedAchievementDispatcher;
@@ -129,6 +141,37 @@ void UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementForPlayer(
                 UpdateAchievementsRequest.IncrementBy,
                 &updatedAchievementDispatcher,
                 UpdatedAchievementDispatcher::Dispatch));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitAchievementsCache::IsEnabled())
+            {
+                FAwsGameKitAchievementsCache::Get().MergeProgress(State->Results);
+            }
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitAchievementsUpdateCoalescer::IsEnabled())
+            {
+                FAwsGameKitAchievementsUpdateCoalescer::Get().RecordProgress(State->Results);
+            }
+            AwsGameKitAchievements::EnqueueUpdateIfOffline(UpdateAchievementsRequest, result);
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
+}
+
+void UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementsForPlayer(
+    UObject* WorldContextObject,
+    FLatentActionInfo LatentInfo,
+    const TArray<FUpdateAchievementRequest>& UpdateAchievementsRequests,
+    TArray<FAchievement>& Results,
+    EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+    FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::UpdateAchievementsForPlayer()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "UpdateAchievementsForPlayer");
+
+    TAwsGameKitInternalActionStatePtr<TArray<FAchievement>> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
+    {
+        Action->LaunchThreadedWork(TEXT("Achievements.UpdateAchievementsForPlayer"), [UpdateAchievementsRequests, State]
+        {
+            IntResult result = AwsGameKitAchievements::UpdateAchievementsForPlayerBlocking(UpdateAchievementsRequests, State->Results);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -142,21 +185,20 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementForPlayer");
 
     TAwsGameKitInternalActionStatePtr<FAchievement> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([AchievementId, State]
+        Action->LaunchThreadedWork(TEXT("Achievements.GetAchievementForPlayer"), [AchievementId, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            AchievementsLibrary achievementsLibrary = runtimeModule->GetAchievementsLibrary();
+            const AchievementsLibrary& achievementsLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
 
             auto getAchievementDispatcher = [&](const char* response)
             {
-                FString achievementResponse(UTF8_TO_TCHAR(response));
-                UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer() GetAchievementDispatcher::Dispatch"));
-                State->Results = AwsGamekitAchievementsResponseProcessor::GetAchievementFromJsonResponse(AwsGamekitAchievementsResponseProcessor::UnpackResponseAsJson(achievementResponse));
+                UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer() GetAchievementDispatcher::Dispatch"));
+                AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(State->Results, response);
             };
 
             typedef LambdaDispatcher<decltype(getAchievementDispatcher), void, const char*> GetAchievementDispatcher;
@@ -164,6 +206,31 @@ void UAwsGameKitAchievementsFunctionLibrary::GetAchievementForPlayer(
                 TCHAR_TO_UTF8(*AchievementId),
                 &getAchievementDispatcher,
                 GetAchievementDispatcher::Dispatch));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitAchievementsCache::IsEnabled())
+            {
+                FAwsGameKitAchievementsCache::Get().MergeProgress(State->Results);
+            }
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
+}
+
+void UAwsGameKitAchievementsFunctionLibrary::GetAchievementSummary(
+    UObject* WorldContextObject,
+    FLatentActionInfo LatentInfo,
+    FAchievementSummary& Results,
+    EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+    FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitAchievementsFunctionLibrary::GetAchievementSummary()"));
+    AWSGAMEKIT_TRACE_CALL("Achievements", "GetAchievementSummary");
+
+    TAwsGameKitInternalActionStatePtr<FAchievementSummary> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
+    {
+        Action->LaunchThreadedWork(TEXT("Achievements.GetAchievementSummary"), [State]
+        {
+            IntResult result = AwsGameKitAchievements::GetAchievementSummaryBlocking(State->Results);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -0,0 +1,273 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitLifecycle.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCoalesceEnabled(
+    TEXT("GameKit.Achievements.Coalesce.Enabled"),
+    0,
+    TEXT("Merges UpdateAchievementForPlayer() increments per achievement before sending them.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCoalesceWindowMs(
+    TEXT("GameKit.Achievements.Coalesce.WindowMs"),
+    5000,
+    TEXT("Maximum time in milliseconds an achievement increment is held before it is sent.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitAchievementsCoalesceMaxCalls(
+    TEXT("GameKit.Achievements.Coalesce.MaxCalls"),
+    100,
+    TEXT("Number of UpdateAchievementForPlayer() calls merged into one update before it is sent.\n"),
+    ECVF_Default);
+
+FAwsGameKitAchievementsUpdateCoalescer& FAwsGameKitAchievementsUpdateCoalescer::Get()
+{
+    static FAwsGameKitAchievementsUpdateCoalescer Instance;
+    return Instance;
+}
+
+bool FAwsGameKitAchievementsUpdateCoalescer::IsEnabled()
+{
+    return CVarGameKitAchievementsCoalesceEnabled.GetValueOnAnyThread() != 0;
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitAchievementsUpdateCoalescer::Tick));
+
+    // Increments which failed while offline are added up per achievement and sent once the backend can be reached again
+    FAwsGameKitOfflineWriteQueue::Get().RegisterFeature(TEXT("Achievements"), EAwsGameKitOfflineWriteMerge::Add, [](const FString& AchievementId, const FString& IncrementBy)
+    {
+        const FUpdateAchievementRequest request = { AchievementId, FCString::Atoi(*IncrementBy) };
+        FAchievement ach;
+        return AwsGameKitAchievements::UpdateAchievementForPlayerBlocking(request, ach);
+    });
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    if (FAwsGameKitLifecycle::HasShutdownDeadlinePassed())
+    {
+        QueueAllOffline();
+    }
+    else
+    {
+        FlushAll(true);
+    }
+    ClearProgress();
+}
+
+bool FAwsGameKitAchievementsUpdateCoalescer::Add(const FUpdateAchievementRequest& UpdateAchievementRequest, const FResultDelegate& ResultDelegate)
+{
+    if (!IsEnabled() || !TickerHandle.IsValid() || UpdateAchievementRequest.IncrementBy <= 0)
+    {
+        return false;
+    }
+
+    const FString& AchievementId = UpdateAchievementRequest.AchievementId;
+    FPendingUpdate ReadyUpdate;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        FKnownProgress Known;
+        if (!FindKnownProgress(AchievementId, Known))
+        {
+            // Nothing to predict the unlock from, the response will tell us for the next increments
+            return false;
+        }
+
+        FPendingUpdate& Pending = PendingUpdates.FindOrAdd(AchievementId);
+        if (Pending.NumCalls == 0)
+        {
+            Pending.FlushAt = FPlatformTime::Seconds() + FMath::Max(0, CVarGameKitAchievementsCoalesceWindowMs.GetValueOnAnyThread()) / 1000.0;
+        }
+        Pending.IncrementBy += UpdateAchievementRequest.IncrementBy;
+        Pending.NumCalls++;
+        Pending.ResultDelegates.Add(ResultDelegate);
+
+        const bool bUnlocks = !Known.IsEarned && Known.CurrentValue + Pending.IncrementBy >= Known.RequiredAmount;
+        if (!bUnlocks && Pending.NumCalls < FMath::Max(1, CVarGameKitAchievementsCoalesceMaxCalls.GetValueOnAnyThread()))
+        {
+            return true;
+        }
+
+        if (bUnlocks)
+        {
+            // Don't keep flushing every increment while the unlocking update is in flight
+            KnownProgress.FindChecked(AchievementId).IsEarned = true;
+        }
+
+        ReadyUpdate = MoveTemp(Pending);
+        PendingUpdates.Remove(AchievementId);
+    }
+
+    Send(AchievementId, MoveTemp(ReadyUpdate), false);
+    return true;
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::RecordProgress(const FAchievement& Achievement)
+{
+    FScopeLock ScopeLock(&Mutex);
+    FKnownProgress& Known = KnownProgress.FindOrAdd(Achievement.AchievementId);
+    Known.CurrentValue = Achievement.CurrentValue;
+    Known.RequiredAmount = Achievement.RequiredAmount;
+    Known.IsEarned = Achievement.IsEarned;
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::FlushAll(bool bBlocking)
+{
+    TMap<FString, FPendingUpdate> ReadyUpdates;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        ReadyUpdates = MoveTemp(PendingUpdates);
+        PendingUpdates.Reset();
+    }
+
+    if (ReadyUpdates.Num() > 0)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitAchievementsUpdateCoalescer::FlushAll(): Sending %d pending achievement updates"), ReadyUpdates.Num());
+    }
+
+    for (TPair<FString, FPendingUpdate>& Ready : ReadyUpdates)
+    {
+        Send(Ready.Key, MoveTemp(Ready.Value), bBlocking);
+    }
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::QueueAllOffline()
+{
+    TMap<FString, FPendingUpdate> ReadyUpdates;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        ReadyUpdates = MoveTemp(PendingUpdates);
+        PendingUpdates.Reset();
+    }
+
+    int32 NumDropped = 0;
+    for (const TPair<FString, FPendingUpdate>& Ready : ReadyUpdates)
+    {
+        if (!FAwsGameKitOfflineWriteQueue::Get().Enqueue(TEXT("Achievements"), Ready.Key, LexToString(Ready.Value.IncrementBy)))
+        {
+            NumDropped++;
+        }
+    }
+
+    if (NumDropped > 0)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitAchievementsUpdateCoalescer: Out of time, dropping %d pending achievement updates. Enable GameKit.OfflineQueue.Enabled to keep them."), NumDropped);
+    }
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::ClearProgress()
+{
+    FScopeLock ScopeLock(&Mutex);
+    KnownProgress.Reset();
+}
+
+bool FAwsGameKitAchievementsUpdateCoalescer::Tick(float DeltaTime)
+{
+    TArray<TPair<FString, FPendingUpdate>> ReadyUpdates;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        const double Now = FPlatformTime::Seconds();
+        for (auto It = PendingUpdates.CreateIterator(); It; ++It)
+        {
+            if (It.Value().FlushAt <= Now)
+            {
+                ReadyUpdates.Emplace(It.Key(), MoveTemp(It.Value()));
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    for (TPair<FString, FPendingUpdate>& Ready : ReadyUpdates)
+    {
+        Send(Ready.Key, MoveTemp(Ready.Value), false);
+    }
+
+    // Keep ticking
+    return true;
+}
+
+bool FAwsGameKitAchievementsUpdateCoalescer::FindKnownProgress(const FString& AchievementId, FKnownProgress& OutProgress)
+{
+    if (const FKnownProgress* Known = KnownProgress.Find(AchievementId))
+    {
+        OutProgress = *Known;
+        return true;
+    }
+
+    FAchievement Cached;
+    if (!FAwsGameKitAchievementsCache::IsEnabled() || !FAwsGameKitAchievementsCache::Get().FindAchievement(AchievementId, Cached))
+    {
+        return false;
+    }
+
+    OutProgress.CurrentValue = Cached.CurrentValue;
+    OutProgress.RequiredAmount = Cached.RequiredAmount;
+    OutProgress.IsEarned = Cached.IsEarned;
+    KnownProgress.Add(AchievementId, OutProgress);
+    return true;
+}
+
+void FAwsGameKitAchievementsUpdateCoalescer::Send(const FString& AchievementId, FPendingUpdate&& Pending, bool bBlocking)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitAchievementsUpdateCoalescer: Sending %s +%d (%d calls)"), *AchievementId, Pending.IncrementBy, Pending.NumCalls);
+
+    auto Work = [AchievementId, Pending = MoveTemp(Pending)]()
+    {
+        const FUpdateAchievementRequest request = { AchievementId, Pending.IncrementBy };
+        FAchievement ach;
+        IntResult result = AwsGameKitAchievements::UpdateAchievementForPlayerBlocking(request, ach);
+        AwsGameKitAchievements::EnqueueUpdateIfOffline(request, result);
+
+        // One completion for all the merged calls
+        const FResultDelegate fanOut = FResultDelegate::CreateLambda([ResultDelegates = Pending.ResultDelegates](const IntResult& Result, const FAchievement& Achievement)
+        {
+            for (const FResultDelegate& ResultDelegate : ResultDelegates)
+            {
+                ResultDelegate.ExecuteIfBound(Result, Achievement);
+            }
+        });
+
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, fanOut, result, MoveTemp(ach));
+    };
+
+    if (bBlocking)
+    {
+        Work();
+    }
+    else
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread(MoveTemp(Work), EAwsGameKitWorkLane::Background);
+    }
+}
@@ -7,8 +7,44 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Common/AwsGameKitAdaptivePageSize.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
 
+// Unreal
+#include "HAL/PlatformTime.h"
+
+// The library isn't linked when the feature is left out of the build, see bWithAchievements in AwsGameKitCore.Build.cs
+#if !WITH_AWSGAMEKIT_ACHIEVEMENTS
+#pragma push_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma push_macro("INVOKE_FUNC_UNTRACED")
+#pragma push_macro("LOAD_PLUGIN_FUNC")
+#undef CHECK_PLUGIN_FUNC_IS_LOADED
+#undef INVOKE_FUNC_UNTRACED
+#undef LOAD_PLUGIN_FUNC
+#define CHECK_PLUGIN_FUNC_IS_LOADED AWSGAMEKIT_CHECK_FEATURE_NOT_BUILT
+#define INVOKE_FUNC_UNTRACED AWSGAMEKIT_INVOKE_FEATURE_NOT_BUILT
+#define LOAD_PLUGIN_FUNC AWSGAMEKIT_LOAD_FEATURE_NOT_BUILT
+#endif
+
+namespace
+{
+    // The GetAchievements Lambda serves at most 100 achievements per page
+    FAwsGameKitAdaptivePageSize ListAchievementsPageSize(TEXT("ListAchievements"), 100, 100);
+
+    int32 CountAchievements(const char* page)
+    {
+        static const char ACHIEVEMENT_ID_KEY[] = "\"achievement_id\"";
+        int32 count = 0;
+        for (const char* found = FCStringAnsi::Strstr(page, ACHIEVEMENT_ID_KEY); found != nullptr; found = FCStringAnsi::Strstr(found + 1, ACHIEVEMENT_ID_KEY))
+        {
+            ++count;
+        }
+        return count;
+    }
+}
+
 void AwsGameKitAchievementsWrapper::importFunctions(void* loadedDllHandle)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitAchievementsWrapper::importFunctions()"));
@@ -24,12 +60,14 @@ void AwsGameKitAchievementsWrapper::importFunctions(void* loadedDllHandle)
 GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE AwsGameKitAchievementsWrapper::GameKitAchievementsInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAchievementsInstanceCreateWithSessionManager, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitAchievementsInstanceCreateWithSessionManager, sessionManager, logCb);
 }
 
 void AwsGameKitAchievementsWrapper::GameKitAchievementsInstanceRelease(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitAchievementsInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     INVOKE_FUNC(GameKitAchievementsInstanceRelease, achievementsInstance);
 }
 
@@ -37,23 +75,61 @@ unsigned int AwsGameKitAchievementsWrapper::GameKitListAchievements(GAMEKIT_ACHI
     DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitListAchievements, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitListAchievements, achievementsInstance, pageSize, waitForAllPages, receiver, responseCallback);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Achievements, TEXT("GameKitListAchievements"));
+
+    if (!FAwsGameKitAdaptivePageSize::IsEnabled())
+    {
+        return INVOKE_FUNC(GameKitListAchievements, achievementsInstance, pageSize, waitForAllPages, receiver, responseCallback);
+    }
+
+    // Each page is timed from the request, which the library sends when the previous dispatch returns, to its dispatch.
+    // When waiting for all pages, the only dispatch holds every page and is timed from the call.
+    const unsigned int adaptivePageSize = ListAchievementsPageSize.GetPageSize(pageSize);
+    double pageStartTime = FPlatformTime::Seconds();
+    auto pageTimer = [&](const char* response)
+    {
+        if (waitForAllPages)
+        {
+            ListAchievementsPageSize.RecordCall(adaptivePageSize, CountAchievements(response), FCStringAnsi::Strlen(response), FPlatformTime::Seconds() - pageStartTime);
+        }
+        else
+        {
+            ListAchievementsPageSize.RecordPage(adaptivePageSize, CountAchievements(response), FCStringAnsi::Strlen(response), FPlatformTime::Seconds() - pageStartTime);
+        }
+        responseCallback(receiver, response);
+        pageStartTime = FPlatformTime::Seconds();
+    };
+    typedef LambdaDispatcher<decltype(pageTimer), void, const char*> PageTimer;
+
+    return INVOKE_FUNC(GameKitListAchievements, achievementsInstance, adaptivePageSize, waitForAllPages, &pageTimer, PageTimer::Dispatch);
 }
 
 unsigned int AwsGameKitAchievementsWrapper::GameKitUpdateAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, unsigned int incrementBy, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitUpdateAchievement, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Achievements, TEXT("GameKitUpdateAchievement"));
     return INVOKE_FUNC(GameKitUpdateAchievement, achievementsInstance, achievementId, incrementBy, receiver, responseCallback);
 }
 
 unsigned int AwsGameKitAchievementsWrapper::GameKitGetAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitGetAchievement, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Achievements, TEXT("GameKitGetAchievement"));
     return INVOKE_FUNC(GameKitGetAchievement, achievementsInstance, achievementId, receiver, responseCallback);
 }
 
 unsigned int AwsGameKitAchievementsWrapper::GameKitGetAchievementIconsBaseUrl(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Achievements, GameKitGetAchievementIconsBaseUrl, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
     return INVOKE_FUNC(GameKitGetAchievementIconsBaseUrl, achievementsInstance, dispatchReceiver, responseCallback);
 }
+
+#if !WITH_AWSGAMEKIT_ACHIEVEMENTS
+#pragma pop_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma pop_macro("INVOKE_FUNC_UNTRACED")
+#pragma pop_macro("LOAD_PLUGIN_FUNC")
+#endif
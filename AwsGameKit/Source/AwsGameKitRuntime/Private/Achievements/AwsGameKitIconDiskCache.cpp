@@ -0,0 +1,63 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Achievements/AwsGameKitIconDiskCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+FString FAwsGameKitIconDiskCache::GetCacheDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("IconCache"));
+}
+
+bool FAwsGameKitIconDiskCache::Load(const FString& Url, TArray<uint8>& OutImgData, FString& OutETag)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    if (!FFileHelper::LoadFileToString(OutETag, *GetETagFilePath(Url)) || OutETag.IsEmpty())
+    {
+        return false;
+    }
+
+    return FFileHelper::LoadFileToArray(OutImgData, *GetImageFilePath(Url, OutETag), FILEREAD_Silent);
+}
+
+void FAwsGameKitIconDiskCache::Save(const FString& Url, const FString& ETag, const TArray<uint8>& ImgData)
+{
+    // Without an ETag the icon can't be revalidated, so it isn't cached
+    if (ETag.IsEmpty())
+    {
+        return;
+    }
+
+    const FString ETagFilePath = GetETagFilePath(Url);
+    FString PreviousETag;
+    if (FFileHelper::LoadFileToString(PreviousETag, *ETagFilePath) && PreviousETag != ETag)
+    {
+        IFileManager::Get().Delete(*GetImageFilePath(Url, PreviousETag), false, false, true);
+    }
+
+    if (!FFileHelper::SaveArrayToFile(ImgData, *GetImageFilePath(Url, ETag)) || !FFileHelper::SaveStringToFile(ETag, *ETagFilePath))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitIconDiskCache: Failed to cache %s"), *Url);
+    }
+}
+
+FString FAwsGameKitIconDiskCache::GetETagFilePath(const FString& Url)
+{
+    const FTCHARToUTF8 Utf8Url(*Url);
+    return FPaths::Combine(GetCacheDirectory(), FSHA1::HashBuffer(Utf8Url.Get(), Utf8Url.Length()).ToString() + TEXT(".etag"));
+}
+
+FString FAwsGameKitIconDiskCache::GetImageFilePath(const FString& Url, const FString& ETag)
+{
+    const FTCHARToUTF8 Utf8Key(*(Url + TEXT("|") + ETag));
+    return FPaths::Combine(GetCacheDirectory(), FSHA1::HashBuffer(Utf8Key.Get(), Utf8Key.Length()).ToString() + TEXT(".png"));
+}
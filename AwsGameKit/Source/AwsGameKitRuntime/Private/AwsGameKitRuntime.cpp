@@ -4,14 +4,44 @@
 #include "AwsGameKitRuntime.h"
 
 // GameKit
+#include "Achievements/AwsGameKitAchievementIconAtlas.h"
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
 #include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitCacheBudget.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitLatencyHistograms.h"
+#include "Common/AwsGameKitLifecycle.h"
+#include "Common/AwsGameKitMockBackend.h"
+#include "Common/AwsGameKitNetworkPolicy.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+#include "Common/AwsGameKitTraffic.h"
+#include "Common/AwsGameKitTrafficWrappers.h"
+#include "Common/AwsGameKitWarmUp.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "Core/AwsGameKitMemory.h"
+#include "GameSaving/AwsGameKitGameSavingLoginPrefetcher.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+#include "GameSaving/AwsGameKitGameSavingTransferScheduler.h"
+#include "Identity/AwsGameKitIdentityFederatedPoller.h"
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+#include "SessionManager/AwsGameKitSessionBootstrap.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
 #if WITH_EDITOR
 #include "AwsGameKitEditor/Public/AwsGameKitEditor.h"
 #endif
 
 // Unreal
+#include "Async/Async.h"
 #include "GenericPlatform/GenericPlatformMisc.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/MessageDialog.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 // Unreal public module dependency
 #if WITH_EDITOR
@@ -24,21 +54,129 @@
 
 #define LOCTEXT_NAMESPACE "FAwsGameKitSessionManager"
 
-FCriticalSection FAwsGameKitRuntimeModule::libLoadMutex;
+static TAutoConsoleVariable<bool> CVarGameKitRuntimePreloadLibraries(
+    TEXT("GameKit.Runtime.PreloadLibraries"),
+    false,
+    TEXT("If true, the libraries of the features in awsGameKitClientConfig.yml are loaded in parallel on background threads at startup instead of on first use.\n")
+    TEXT("Has no effect in the editor, where the config file is loaded later. See FAwsGameKitRuntimeModule::PreloadFeatureLibraries().\n"),
+    ECVF_ReadOnly);
+
+FCriticalSection FAwsGameKitRuntimeModule::identityLibLoadMutex;
+FCriticalSection FAwsGameKitRuntimeModule::achievementsLibLoadMutex;
+FCriticalSection FAwsGameKitRuntimeModule::gameSavingLibLoadMutex;
+FCriticalSection FAwsGameKitRuntimeModule::userGameplayDataLibLoadMutex;
+std::atomic<FAwsGameKitRuntimeModule*> FAwsGameKitRuntimeModule::instance{ nullptr };
+
+namespace
+{
+    // The wrapper given to SetWrapperFactories(), else the recording wrapper when the game was started with -GameKitRecordTraffic or -GameKitReplayTraffic,
+    // else the wrapper which loads the GameKit library
+    template <typename WrapperType, typename TrafficWrapperType>
+    TSharedPtr<WrapperType> CreateFeatureWrapper(const TFunction<TSharedPtr<WrapperType>()>& factory)
+    {
+        if (factory)
+        {
+            return factory();
+        }
+
+        if (FAwsGameKitTraffic::Get().GetMode() != EAwsGameKitTrafficMode::Off)
+        {
+            return MakeShareable(new TrafficWrapperType());
+        }
+
+        return MakeShareable(new WrapperType());
+    }
+
+    // A feature left out of the build has no library to load, unless a factory replaces it
+    template <typename WrapperType>
+    bool InitializeFeatureWrapper(const TSharedPtr<WrapperType>& wrapper, const TFunction<TSharedPtr<WrapperType>()>& factory, FeatureType type, const TCHAR* name)
+    {
+        if (!factory && !FAwsGameKitRuntimeModule::IsFeatureBuilt(type))
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitRuntimeModule: The %s feature is left out of this build, its calls fail with GAMEKIT_ERROR_GENERAL"), name);
+            return false;
+        }
+
+        return wrapper->Initialize();
+    }
+}
 
 void FAwsGameKitRuntimeModule::StartupModule()
 {
+    AWSGAMEKIT_LLM_SCOPE(Core);
     UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::StartupModule()"));
-    const bool wrappersInitialized = initializeWrappers();
+    instance.store(this, std::memory_order_release);
+    FAwsGameKitWorkerPool::Get().Startup();
+    FAwsGameKitCompletionQueue::Get().Startup();
+    FAwsGameKitLatencyHistograms::Get().Startup();
+    FAwsGameKitTraffic::Get().Startup();
+    FAwsGameKitMockBackend::Get().Startup();
+    if (FAwsGameKitMockBackend::Get().IsEnabled())
+    {
+        SetWrapperFactories(FAwsGameKitMockBackend::MakeWrapperFactories());
+    }
+    FAwsGameKitNetworkPolicy::Get().Startup();
+    FAwsGameKitOfflineWriteQueue::Get().Startup();
+    FAwsGameKitAchievementsUpdateCoalescer::Get().Startup();
+    FAwsGameKitUserGameplayDataWriteBehind::Get().Startup();
+    FAwsGameKitGameSavingSlotIndex::Get().Startup();
+    FAwsGameKitGameSavingTransferScheduler::Get().Startup();
+    FAwsGameKitSessionTokenRefresher::Get().Startup();
+    FAwsGameKitIdentityFederatedPoller::Get().Startup();
+    FAwsGameKitRegionSelector::Get().Startup();
+    FAwsGameKitLifecycle::Get().Startup();
+    FAwsGameKitCacheBudget::Get().Startup();
+    FAwsGameKitAchievementsCache::Get().RegisterWithCacheBudget();
+    FAwsGameKitAchievementIconAtlas::Get().RegisterWithCacheBudget();
+    FAwsGameKitUserGameplayDataCache::Get().RegisterWithCacheBudget();
+    FAwsGameKitGameSavingLoginPrefetcher::Get().RegisterWithCacheBudget();
+
+    const double startupStartTime = FPlatformTime::Seconds();
+    double phaseStartTime = startupStartTime;
+    double initializeWrappersSeconds = 0.0;
+    double sessionManagerCreateSeconds = 0.0;
+    double reloadConfigSeconds = 0.0;
+
+    bool wrappersInitialized;
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_InitializeWrappers);
+        wrappersInitialized = initializeWrappers();
+        initializeWrappersSeconds = FPlatformTime::Seconds() - phaseStartTime;
+    }
 
     // Starts the SessionManager with an empty configuration file.
     // The configuration file can be reloaded by calling AwsGameKitSessionManagerWrapper::ReloadConfigFile()
-    sessionManagerLibrary.SessionManagerInstanceHandle = sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerInstanceCreate(nullptr, FGameKitLogging::LogCallBack);
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_SessionManagerInstanceCreate);
+        phaseStartTime = FPlatformTime::Seconds();
+        sessionManagerLibrary.SessionManagerInstanceHandle = sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerInstanceCreate(nullptr, FGameKitLogging::LogCallBack);
+        sessionManagerCreateSeconds = FPlatformTime::Seconds() - phaseStartTime;
+    }
 
+#if PLATFORM_ANDROID || PLATFORM_IOS || UE_BUILD_SHIPPING || !WITH_EDITOR
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_ReloadConfigFile);
+        phaseStartTime = FPlatformTime::Seconds();
 #if PLATFORM_ANDROID || PLATFORM_IOS
-    ReloadConfigFile(""); // Mobile platforms have logic to determine the path in the device file system
-#elif UE_BUILD_SHIPPING || !WITH_EDITOR
-    ReloadConfigFile(FPaths::LaunchDir());
+        ReloadConfigFile(""); // Mobile platforms have logic to determine the path in the device file system
+#else
+        ReloadConfigFile(FPaths::LaunchDir());
+#endif
+        reloadConfigSeconds = FPlatformTime::Seconds() - phaseStartTime;
+    }
+#endif
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::StartupModule(): Startup took %.2f ms (InitializeWrappers %.2f ms, SessionManagerInstanceCreate %.2f ms, ReloadConfigFile %.2f ms)"),
+        (FPlatformTime::Seconds() - startupStartTime) * 1000.0,
+        initializeWrappersSeconds * 1000.0,
+        sessionManagerCreateSeconds * 1000.0,
+        reloadConfigSeconds * 1000.0);
+
+#if !WITH_EDITOR
+    if (CVarGameKitRuntimePreloadLibraries.GetValueOnGameThread())
+    {
+        PreloadFeatureLibraries();
+    }
 #endif
 }
 
@@ -49,6 +187,49 @@ void FAwsGameKitRuntimeModule::ShutdownModule()
 
     // Calling Shutdown() on this module gives exceptions after the editor is closed.
 
+    // Let the libraries still being preloaded finish before anything uses or releases them.
+    for (TFuture<void>& preloadTask : preloadTasks)
+    {
+        preloadTask.Wait();
+    }
+    preloadTasks.Reset();
+
+    // Send the merged achievement increments, buffered bundle items and queued save uploads while the libraries are still loaded,
+    // within GameKit.Lifecycle.ShutdownDrainBudgetMs.
+    FAwsGameKitLifecycle::Get().Shutdown();
+    FAwsGameKitLifecycle::Get().Drain();
+    FAwsGameKitAchievementsUpdateCoalescer::Get().Shutdown();
+    FAwsGameKitOfflineWriteQueue::Get().Shutdown();
+    FAwsGameKitUserGameplayDataWriteBehind::Get().Shutdown();
+    FAwsGameKitUserGameplayDataCache::Get().Persist();
+    FAwsGameKitAchievementIconAtlas::Get().Shutdown();
+    FAwsGameKitGameSavingTransferScheduler::Get().Shutdown();
+    FAwsGameKitGameSavingSlotIndex::Get().Shutdown();
+    FAwsGameKitGameSavingLoginPrefetcher::Get().Clear();
+    FAwsGameKitSessionBootstrap::Get().Clear();
+    FAwsGameKitSessionTokenRefresher::Get().Shutdown();
+    FAwsGameKitIdentityFederatedPoller::Get().Shutdown();
+    FAwsGameKitRegionSelector::Get().Shutdown();
+    FAwsGameKitNetworkPolicy::Get().Shutdown();
+    FAwsGameKitCacheBudget::Get().Shutdown();
+
+    // Wait for in-flight GameKit calls before the libraries they are using are released.
+    FAwsGameKitLatencyHistograms::Get().Shutdown();
+    FAwsGameKitWorkerPool::Get().Shutdown();
+    FAwsGameKitCompletionQueue::Get().Shutdown();
+
+    // The players' instances were created with the feature libraries
+    FAwsGameKitPlayerContexts::Get().Shutdown();
+
+    identityLibraryLoaded.store(false, std::memory_order_release);
+    achievementsLibraryLoaded.store(false, std::memory_order_release);
+    gameSavingLibraryLoaded.store(false, std::memory_order_release);
+    userGameplayDataLibraryLoaded.store(false, std::memory_order_release);
+    identityLibraryLoadResult.store(EAwsGameKitLibraryLoadResult::NotLoaded);
+    achievementsLibraryLoadResult.store(EAwsGameKitLibraryLoadResult::NotLoaded);
+    gameSavingLibraryLoadResult.store(EAwsGameKitLibraryLoadResult::NotLoaded);
+    userGameplayDataLibraryLoadResult.store(EAwsGameKitLibraryLoadResult::NotLoaded);
+
     if (identityLibrary.IdentityWrapper != nullptr)
     {
         UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::ShutdownModule(): Releasing Identity Library"));
@@ -90,12 +271,23 @@ void FAwsGameKitRuntimeModule::ShutdownModule()
         sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerInstanceRelease(sessionManagerLibrary.SessionManagerInstanceHandle);
         sessionManagerLibrary.SessionManagerWrapper = nullptr;
     }
+
+    FAwsGameKitTraffic::Get().Shutdown();
+    FAwsGameKitMockBackend::Get().Shutdown();
+
+    // Get() falls back to the module manager from here on, instead of returning the module being unloaded
+    FAwsGameKitRuntimeModule* expected = this;
+    instance.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
 }
 
 bool FAwsGameKitRuntimeModule::AreFeatureSettingsLoaded(FeatureType type) const
 {
-    bool loaded = sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, type);
-    return loaded;
+    return GetLoadedFeatureSettings().IsLoaded(type);
+}
+
+FAwsGameKitLoadedFeatureSettings FAwsGameKitRuntimeModule::GetLoadedFeatureSettings() const
+{
+    return sessionManagerLibrary.SessionManagerWrapper->GetLoadedFeatureSettings(sessionManagerLibrary.SessionManagerInstanceHandle);
 }
 
 GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE FAwsGameKitRuntimeModule::GetSessionManagerInstance() const
@@ -115,47 +307,200 @@ bool FAwsGameKitRuntimeModule::ReloadConfigFile(const FString& subdirectory) con
 #else
     this->sessionManagerLibrary.SessionManagerWrapper->ReloadConfig(sessionManagerLibrary.SessionManagerInstanceHandle);
 #endif
-    return
-        AreFeatureSettingsLoaded(FeatureType::Identity) &&
-        AreFeatureSettingsLoaded(FeatureType::Achievements) &&
-        AreFeatureSettingsLoaded(FeatureType::UserGameplayData) &&
-        AreFeatureSettingsLoaded(FeatureType::GameStateCloudSaving);
+    FAwsGameKitRegionSelector::Get().OnConfigLoaded(sessionManagerLibrary.SessionManagerWrapper.Get(), sessionManagerLibrary.SessionManagerInstanceHandle);
+    return GetLoadedFeatureSettings().AreClientFeaturesLoaded();
 }
 
-CoreLibrary FAwsGameKitRuntimeModule::GetCoreLibrary()
+FAwsGameKitRuntimeModule& FAwsGameKitRuntimeModule::Get()
+{
+    FAwsGameKitRuntimeModule* runtimeModule = instance.load(std::memory_order_acquire);
+    if (runtimeModule == nullptr)
+    {
+        runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+    }
+    check(runtimeModule != nullptr);
+    return *runtimeModule;
+}
+
+const CoreLibrary& FAwsGameKitRuntimeModule::GetCoreLibrary() const
 {
     return coreLibrary;
 }
 
-SessionManagerLibrary FAwsGameKitRuntimeModule::GetSessionManagerLibrary()
+SessionManagerLibrary FAwsGameKitRuntimeModule::GetSessionManagerLibrary() const
 {
+    const FAwsGameKitPlayerHandle player = FAwsGameKitPlayerScope::GetCurrent();
+    if (player.IsValid())
+    {
+        return FAwsGameKitPlayerContexts::Get().GetSessionManagerLibrary(player);
+    }
     return sessionManagerLibrary;
 }
 
 IdentityLibrary FAwsGameKitRuntimeModule::GetIdentityLibrary()
 {
-    loadIdentityLibrary();
+    const FAwsGameKitPlayerHandle player = FAwsGameKitPlayerScope::GetCurrent();
+    if (player.IsValid())
+    {
+        return FAwsGameKitPlayerContexts::Get().GetIdentityLibrary(player);
+    }
+
+    if (!identityLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadIdentityLibrary();
+    }
     return identityLibrary;
 }
 
 AchievementsLibrary FAwsGameKitRuntimeModule::GetAchievementsLibrary()
 {
-    loadAchievementsLibrary();
+    const FAwsGameKitPlayerHandle player = FAwsGameKitPlayerScope::GetCurrent();
+    if (player.IsValid())
+    {
+        return FAwsGameKitPlayerContexts::Get().GetAchievementsLibrary(player);
+    }
+
+    if (!achievementsLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadAchievementsLibrary();
+    }
     return achievementsLibrary;
 }
 
 GameSavingLibrary FAwsGameKitRuntimeModule::GetGameSavingLibrary()
 {
-    loadGameSavingLibrary();
+    const FAwsGameKitPlayerHandle player = FAwsGameKitPlayerScope::GetCurrent();
+    if (player.IsValid())
+    {
+        return FAwsGameKitPlayerContexts::Get().GetGameSavingLibrary(player);
+    }
+
+    if (!gameSavingLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadGameSavingLibrary();
+    }
     return gameSavingLibrary;
 }
 
 UserGameplayDataLibrary FAwsGameKitRuntimeModule::GetUserGameplayDataLibrary()
 {
-    loadUserGameplayDataLibrary();
+    const FAwsGameKitPlayerHandle player = FAwsGameKitPlayerScope::GetCurrent();
+    if (player.IsValid())
+    {
+        return FAwsGameKitPlayerContexts::Get().GetUserGameplayDataLibrary(player);
+    }
+
+    if (!userGameplayDataLibraryLoaded.load(std::memory_order_acquire))
+    {
+        loadUserGameplayDataLibrary();
+    }
     return userGameplayDataLibrary;
 }
 
+void FAwsGameKitRuntimeModule::PreloadFeatureLibraries()
+{
+    check(IsInGameThread());
+
+    struct FFeatureLibrary
+    {
+        FeatureType Type;
+        const TCHAR* Name;
+        const std::atomic<bool>& Loaded;
+        void (FAwsGameKitRuntimeModule::*Load)();
+    };
+    const FFeatureLibrary featureLibraries[] =
+    {
+        { FeatureType::Identity, TEXT("Identity"), identityLibraryLoaded, &FAwsGameKitRuntimeModule::loadIdentityLibrary },
+        { FeatureType::Achievements, TEXT("Achievements"), achievementsLibraryLoaded, &FAwsGameKitRuntimeModule::loadAchievementsLibrary },
+        { FeatureType::GameStateCloudSaving, TEXT("Game Saving"), gameSavingLibraryLoaded, &FAwsGameKitRuntimeModule::loadGameSavingLibrary },
+        { FeatureType::UserGameplayData, TEXT("User Gameplay Data"), userGameplayDataLibraryLoaded, &FAwsGameKitRuntimeModule::loadUserGameplayDataLibrary },
+    };
+
+    for (const FFeatureLibrary& featureLibrary : featureLibraries)
+    {
+        if (featureLibrary.Loaded.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        if (!IsFeatureBuilt(featureLibrary.Type))
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibraries(): Not preloading the %s Library, the feature is left out of this build"), featureLibrary.Name);
+            continue;
+        }
+
+        // Features without settings aren't deployed, their libraries would never be used
+        if (!AreFeatureSettingsLoaded(featureLibrary.Type))
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibraries(): Not preloading the %s Library, the feature has no settings"), featureLibrary.Name);
+            continue;
+        }
+
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::PreloadFeatureLibraries(): Preloading the %s Library"), featureLibrary.Name);
+        preloadTasks.Add(Async(EAsyncExecution::Thread, [this, load = featureLibrary.Load]
+        {
+            (this->*load)();
+        }));
+    }
+}
+
+void FAwsGameKitRuntimeModule::WarmUp(const TArray<FeatureType>& features, const FAwsGameKitStatusDelegate& onComplete)
+{
+    AWSGAMEKIT_TRACE_CALL("Runtime", "WarmUp");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([features, onComplete]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        const IntResult result = FAwsGameKitWarmUp::Run(features);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, onComplete, result);
+    });
+}
+
+bool FAwsGameKitRuntimeModule::IsFeatureBuilt(FeatureType type)
+{
+    switch (type)
+    {
+    case FeatureType::Achievements:
+        return WITH_AWSGAMEKIT_ACHIEVEMENTS != 0;
+    case FeatureType::GameStateCloudSaving:
+        return WITH_AWSGAMEKIT_GAME_SAVING != 0;
+    case FeatureType::UserGameplayData:
+        return WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA != 0;
+    default:
+        return true;
+    }
+}
+
+EAwsGameKitLibraryLoadResult FAwsGameKitRuntimeModule::GetLibraryLoadResult(FeatureType type) const
+{
+    switch (type)
+    {
+    case FeatureType::Identity:
+        return identityLibraryLoadResult.load();
+    case FeatureType::Achievements:
+        return achievementsLibraryLoadResult.load();
+    case FeatureType::GameStateCloudSaving:
+        return gameSavingLibraryLoadResult.load();
+    case FeatureType::UserGameplayData:
+        return userGameplayDataLibraryLoadResult.load();
+    default:
+        return EAwsGameKitLibraryLoadResult::NotLoaded;
+    }
+}
+
+bool FAwsGameKitRuntimeModule::SetWrapperFactories(const FAwsGameKitWrapperFactories& factories)
+{
+    if (identityLibraryLoaded.load() || achievementsLibraryLoaded.load() || gameSavingLibraryLoaded.load() || userGameplayDataLibraryLoaded.load() || preloadTasks.Num() > 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitRuntimeModule::SetWrapperFactories(): A feature library was already loaded, the wrapper factories are ignored"));
+        return false;
+    }
+
+    wrapperFactories = factories;
+    return true;
+}
+
 void FAwsGameKitRuntimeModule::SetNetworkChangeDelegate(const FNetworkStatusChangeDelegate& networkStatusChangeDelegate)
 {
     if (networkStatusChangeDelegate.IsBound())
@@ -177,59 +522,93 @@ bool FAwsGameKitRuntimeModule::initializeWrappers()
 
 void FAwsGameKitRuntimeModule::loadIdentityLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_LoadIdentityLibrary);
+    FScopeLock scopeLock(&identityLibLoadMutex);
     if (identityLibrary.IdentityWrapper == nullptr)
     {
-        identityLibrary.IdentityWrapper = MakeShareable(new AwsGameKitIdentityWrapper());
-        identityLibrary.IdentityWrapper->Initialize();
+        const double loadStartTime = FPlatformTime::Seconds();
+        identityLibrary.IdentityWrapper = CreateFeatureWrapper<AwsGameKitIdentityWrapper, AwsGameKitTrafficIdentityWrapper>(wrapperFactories.Identity);
+        const bool initialized = identityLibrary.IdentityWrapper->Initialize();
+        identityLibraryLoadResult.store(initialized ? EAwsGameKitLibraryLoadResult::Loaded : EAwsGameKitLibraryLoadResult::Failed);
 
         identityLibrary.IdentityInstanceHandle = identityLibrary.IdentityWrapper->GameKitIdentityInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack);
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::loadIdentityLibrary(): Loaded the Identity Library and created its instance in %.2f ms"), (FPlatformTime::Seconds() - loadStartTime) * 1000.0);
     }
+
+    identityLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadAchievementsLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_LoadAchievementsLibrary);
+    FScopeLock scopeLock(&achievementsLibLoadMutex);
     if (achievementsLibrary.AchievementsWrapper == nullptr)
     {
-        achievementsLibrary.AchievementsWrapper = MakeShareable(new AwsGameKitAchievementsWrapper());
-        achievementsLibrary.AchievementsWrapper->Initialize();
+        const double loadStartTime = FPlatformTime::Seconds();
+        achievementsLibrary.AchievementsWrapper = CreateFeatureWrapper<AwsGameKitAchievementsWrapper, AwsGameKitTrafficAchievementsWrapper>(wrapperFactories.Achievements);
+        const bool initialized = InitializeFeatureWrapper(achievementsLibrary.AchievementsWrapper, wrapperFactories.Achievements, FeatureType::Achievements, TEXT("Achievements"));
+        achievementsLibraryLoadResult.store(initialized ? EAwsGameKitLibraryLoadResult::Loaded : EAwsGameKitLibraryLoadResult::Failed);
 
         achievementsLibrary.AchievementsInstanceHandle = achievementsLibrary.AchievementsWrapper->GameKitAchievementsInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack);
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::loadAchievementsLibrary(): Loaded the Achievements Library and created its instance in %.2f ms"), (FPlatformTime::Seconds() - loadStartTime) * 1000.0);
     }
+
+    achievementsLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadGameSavingLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_LoadGameSavingLibrary);
+    FScopeLock scopeLock(&gameSavingLibLoadMutex);
     if (gameSavingLibrary.GameSavingWrapper == nullptr)
     {
-        gameSavingLibrary.GameSavingWrapper = MakeShareable(new AwsGameKitGameSavingWrapper());
-        gameSavingLibrary.GameSavingWrapper->Initialize();
+        const double loadStartTime = FPlatformTime::Seconds();
+        gameSavingLibrary.GameSavingWrapper = CreateFeatureWrapper<AwsGameKitGameSavingWrapper, AwsGameKitTrafficGameSavingWrapper>(wrapperFactories.GameSaving);
+        const bool initialized = InitializeFeatureWrapper(gameSavingLibrary.GameSavingWrapper, wrapperFactories.GameSaving, FeatureType::GameStateCloudSaving, TEXT("Game Saving"));
+        gameSavingLibraryLoadResult.store(initialized ? EAwsGameKitLibraryLoadResult::Loaded : EAwsGameKitLibraryLoadResult::Failed);
 
         gameSavingLibrary.GameSavingInstanceHandle = gameSavingLibrary.GameSavingWrapper->GameKitGameSavingInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack, nullptr, 0, DefaultFileActions());
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::loadGameSavingLibrary(): Loaded the Game Saving Library and created its instance in %.2f ms"), (FPlatformTime::Seconds() - loadStartTime) * 1000.0);
     }
+
+    gameSavingLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::loadUserGameplayDataLibrary()
 {
-    FScopeLock scopeLock(&libLoadMutex);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AwsGameKit_LoadUserGameplayDataLibrary);
+    FScopeLock scopeLock(&userGameplayDataLibLoadMutex);
     if (userGameplayDataLibrary.UserGameplayDataWrapper == nullptr)
     {
-        userGameplayDataLibrary.UserGameplayDataWrapper = MakeShareable(new AwsGameKitUserGameplayDataWrapper());
-        userGameplayDataLibrary.UserGameplayDataWrapper->Initialize();
+        const double loadStartTime = FPlatformTime::Seconds();
+        userGameplayDataLibrary.UserGameplayDataWrapper = CreateFeatureWrapper<AwsGameKitUserGameplayDataWrapper, AwsGameKitTrafficUserGameplayDataWrapper>(wrapperFactories.UserGameplayData);
+        const bool initialized = InitializeFeatureWrapper(userGameplayDataLibrary.UserGameplayDataWrapper, wrapperFactories.UserGameplayData, FeatureType::UserGameplayData, TEXT("User Gameplay Data"));
+        userGameplayDataLibraryLoadResult.store(initialized ? EAwsGameKitLibraryLoadResult::Loaded : EAwsGameKitLibraryLoadResult::Failed);
 
         userGameplayDataLibrary.UserGameplayDataInstanceHandle = userGameplayDataLibrary.UserGameplayDataWrapper->GameKitUserGameplayDataInstanceCreateWithSessionManager(GetSessionManagerInstance(), FGameKitLogging::LogCallBack);
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitRuntimeModule::loadUserGameplayDataLibrary(): Loaded the User Gameplay Data Library and created its instance in %.2f ms"), (FPlatformTime::Seconds() - loadStartTime) * 1000.0);
+
+        // Always listen, the network status feeds the retry queue stats even when no FNetworkStatusChangeDelegate is set
+        userGameplayDataLibrary.UserGameplayDataWrapper->GameKitUserGameplayDataSetNetworkChangeCallback(userGameplayDataLibrary.UserGameplayDataInstanceHandle, this, &FAwsGameKitRuntimeModule::OnNetworkStatusChangeDispatcher::Dispatch);
     }
 
     if (userGameplayDataLibrary.UserGameplayDataStateHandler == nullptr)
     {
         userGameplayDataLibrary.UserGameplayDataStateHandler = MakeShareable(new AwsGameKitUserGameplayDataStateHandler());
     }
+
+    userGameplayDataLibraryLoaded.store(true, std::memory_order_release);
 }
 
 void FAwsGameKitRuntimeModule::OnNetworkStatusChange(bool isConnectionOk, const char* connectionClient)
 {
+    if (userGameplayDataLibrary.UserGameplayDataStateHandler.IsValid())
+    {
+        userGameplayDataLibrary.UserGameplayDataStateHandler->RecordNetworkStatus(isConnectionOk);
+    }
+    FAwsGameKitOfflineWriteQueue::Get().OnNetworkStatusChange(isConnectionOk);
+    FAwsGameKitRegionSelector::Get().OnNetworkStatusChange(isConnectionOk);
+
     FString client(connectionClient);
     AsyncTask(ENamedThreads::GameThread, [this, isConnectionOk, client]()
     {
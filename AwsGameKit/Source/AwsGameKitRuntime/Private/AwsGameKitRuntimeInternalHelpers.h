@@ -3,13 +3,22 @@
 
 #pragma once
 
+// GameKit
+#include "Common/AwsGameKitCancellation.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitTrace.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+
+// Unreal
 #include "Async/Async.h"
 
 
 // FAwsGameKitInternalTempStrings is a helper class meant to be used as a callable object
 // that translates string parameters (char*, TCHAR*, or FString) into an appropriate form
-// for storing in a temporary char* variable, duplicating the value into the heap for as
-// long as the helper object is in scope.
+// for storing in a temporary char* variable, copying the UTF-8 value into a buffer owned
+// by the helper object for as long as it is in scope.
 // 
 // For example, given some FString variables and a GameKit model that looks like this:
 //   struct Model { char* Value; char* Value2; };
@@ -28,6 +37,11 @@
 //   ...
 //   GameKitFunction(modelInstance);
 //
+// The strings are packed one after the other into an arena: a small inline buffer first, then
+// heap blocks which are all released together when the helper goes out of scope. When marshalling
+// many strings (bundle items, file paths, ...) add up GetConvertedSize() for each of them and call
+// Reserve() first, so that the whole request is converted into a single allocation.
+//
 class FAwsGameKitInternalTempStrings
 {
 public:
@@ -37,18 +51,34 @@ public:
 
     ~FAwsGameKitInternalTempStrings()
     {
-        for (char* Str : OwnedStrings)
+        for (char* Block : OwnedBlocks)
+        {
+            FMemory::Free(Block);
+        }
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitInternalTempStrings);
+
+    // Number of bytes operator()(const FString&) takes from the arena for Str, null terminator included.
+    static int32 GetConvertedSize(const FString& Str)
+    {
+        return FPlatformString::ConvertedLength<UTF8CHAR>(*Str, Str.Len()) + 1;
+    }
+
+    // Make sure the next NumBytes bytes of conversions are served from one contiguous block.
+    void Reserve(int32 NumBytes)
+    {
+        if (NumBytes > Remaining)
         {
-            delete[] Str;
+            AddBlock(NumBytes);
         }
     }
 
     char* Dup(const char* Str)
     {
-        size_t Len = strlen(Str);
-        char* Buffer = new char[Len + 1];
+        const int32 Len = static_cast<int32>(strlen(Str));
+        char* Buffer = Allocate(Len + 1);
         FPlatformMemory::Memcpy(Buffer, Str, Len + 1);
-        OwnedStrings.Add(Buffer);
         return Buffer;
     }
 
@@ -64,61 +94,129 @@ public:
 
     char* operator()(const FString& Str)
     {
-        return Dup(TCHAR_TO_UTF8(*Str));
+        // Convert straight into the arena instead of going through a TCHAR_TO_UTF8 temporary
+        const int32 Len = GetConvertedSize(Str) - 1;
+        char* Buffer = Allocate(Len + 1);
+        FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Buffer), Len, *Str, Str.Len());
+        Buffer[Len] = '\0';
+        return Buffer;
     }
 
 private:
-    TArray<char*,TInlineAllocator<4>> OwnedStrings;
+    static constexpr int32 InlineBlockSize = 256;
+    static constexpr int32 MinHeapBlockSize = 4096;
+
+    char* Allocate(int32 Size)
+    {
+        if (Size > Remaining)
+        {
+            AddBlock(FMath::Max(Size, MinHeapBlockSize));
+        }
+
+        char* Result = Cursor;
+        Cursor += Size;
+        Remaining -= Size;
+        return Result;
+    }
+
+    void AddBlock(int32 Size)
+    {
+        char* Block = static_cast<char*>(FMemory::Malloc(Size));
+        OwnedBlocks.Add(Block);
+        Cursor = Block;
+        Remaining = Size;
+    }
+
+    char InlineBlock[InlineBlockSize];
+    char* Cursor = InlineBlock;
+    int32 Remaining = InlineBlockSize;
+    TArray<char*, TInlineAllocator<2>> OwnedBlocks;
 };
 
 
+// Runs the work on the shared GameKit worker pool (see FAwsGameKitWorkerPool) instead of creating a thread per call.
+// The work waits first if an expired token is being refreshed, see FAwsGameKitSessionTokenRefresher.
+// Lane is the feature's default lane, the caller's FAwsGameKitWorkLaneScope takes precedence.
+// The caller's FAwsGameKitWorkerCompletionScope and FAwsGameKitCancellationScope are carried over to the work, which is skipped if its
+// cancellation token was abandoned while it was queued.
 template <typename T>
-inline void InternalAwsGameKitRunLambdaOnWorkThread(T&& Work)
+inline void InternalAwsGameKitRunLambdaOnWorkThread(T&& Work, EAwsGameKitWorkLane Lane = EAwsGameKitWorkLane::Normal)
 {
-    Async(EAsyncExecution::Thread, Forward<T>(Work));
+    FAwsGameKitWorkerPool::Get().Dispatch(TUniqueFunction<void()>([Work = Forward<T>(Work), bCompleteOnWorker = FAwsGameKitWorkerCompletionScope::IsActive(), Token = FAwsGameKitCancellationScope::GetCurrent()]() mutable
+    {
+        if (Token.IsValid() && Token->IsAbandoned())
+        {
+            return;
+        }
+
+        FAwsGameKitCancellationScope CancellationScope(Token);
+        FAwsGameKitWorkerCompletionScope CompletionScope(bCompleteOnWorker);
+        FAwsGameKitSessionTokenRefresher::Get().WaitForExpiredTokenRefresh();
+        Work();
+    }), Lane);
 }
 
 
-class FAwsGameKitInternalMainThreadOrderedTask
+// Records the status of the traced call when a result is handed to the game thread, see FAwsGameKitTrace.
+inline void InternalAwsGameKitTraceStatus(const IntResult& Result)
 {
-public:
-    FAwsGameKitInternalMainThreadOrderedTask(TUniqueFunction<void()>&& InFunction) : Function(MoveTemp(InFunction)) {}
-    void DoTask(ENamedThreads::Type, const FGraphEventRef&) { Function(); }
-    ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
-    static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
-    TStatId GetStatId() const { return GET_STATID(STAT_TaskGraph_OtherTasks); }
-private:
-    TUniqueFunction<void()> Function;
-};
+    FAwsGameKitTrace::SetStatus(Result.Result);
+}
 
+template <typename ParamType>
+inline void InternalAwsGameKitTraceStatus(const ParamType&)
+{
+}
+
+
+// Completions go through the shared GameKit completion queue (see FAwsGameKitCompletionQueue), which runs them on the game thread in the order
+// they were queued. OrderedWorkChain is kept so callers don't need to change; the queue is already first-in first-out.
+// Parameters passed as rvalues (MoveTemp) are moved into the completion, so large results are not copied on their way to the game thread.
+// Inside an FAwsGameKitWorkerCompletionScope the delegate runs right away on the calling thread instead.
+// The delegates of a call abandoned through its FAwsGameKitCancellationToken are dropped: when it's abandoned before the result is handed over,
+// or cancelled before the completion runs on the game thread.
 template <typename DelegateType, typename ParamType>
 inline void InternalAwsGameKitRunDelegateOnGameThread(FGraphEventRef& OrderedWorkChain, const DelegateType& Delegate, ParamType&& Param)
 {
-    TUniqueFunction<void()> Function([Delegate, Param = Forward<ParamType>(Param)]{ Delegate.ExecuteIfBound(Param); });
-    if (OrderedWorkChain && !OrderedWorkChain->IsComplete())
+    InternalAwsGameKitTraceStatus(Param);
+    FAwsGameKitCancellationTokenPtr Token = FAwsGameKitCancellationScope::GetCurrent();
+    if (Token.IsValid() && Token->IsAbandoned())
     {
-        FGraphEventArray Prereqs;
-        Prereqs.Add(MoveTemp(OrderedWorkChain));
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask(&Prereqs).ConstructAndDispatchWhenReady(MoveTemp(Function));
+        return;
     }
-    else
+    if (FAwsGameKitWorkerCompletionScope::IsActive())
     {
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask().ConstructAndDispatchWhenReady(MoveTemp(Function));
+        Delegate.ExecuteIfBound(Param);
+        return;
     }
+    FAwsGameKitCompletionQueue::Get().Enqueue([Delegate, Token = MoveTemp(Token), Param = Forward<ParamType>(Param)]
+    {
+        if (!Token.IsValid() || !Token->IsCancelled())
+        {
+            Delegate.ExecuteIfBound(Param);
+        }
+    });
 }
 
 template <typename DelegateType, typename Param1Type, typename Param2Type>
 inline void InternalAwsGameKitRunDelegateOnGameThread(FGraphEventRef& OrderedWorkChain, const DelegateType& Delegate, Param1Type&& Param1, Param2Type&& Param2)
 {
-    TUniqueFunction<void()> Function([Delegate, Param1 = Forward<Param1Type>(Param1), Param2 = Forward<Param2Type>(Param2)]{ Delegate.ExecuteIfBound(Param1, Param2); });
-    if (OrderedWorkChain && !OrderedWorkChain->IsComplete())
+    InternalAwsGameKitTraceStatus(Param1);
+    FAwsGameKitCancellationTokenPtr Token = FAwsGameKitCancellationScope::GetCurrent();
+    if (Token.IsValid() && Token->IsAbandoned())
     {
-        FGraphEventArray Prereqs;
-        Prereqs.Add(MoveTemp(OrderedWorkChain));
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask(&Prereqs).ConstructAndDispatchWhenReady(MoveTemp(Function));
+        return;
     }
-    else
+    if (FAwsGameKitWorkerCompletionScope::IsActive())
     {
-        OrderedWorkChain = TGraphTask<FAwsGameKitInternalMainThreadOrderedTask>::CreateTask().ConstructAndDispatchWhenReady(MoveTemp(Function));
+        Delegate.ExecuteIfBound(Param1, Param2);
+        return;
     }
+    FAwsGameKitCompletionQueue::Get().Enqueue([Delegate, Token = MoveTemp(Token), Param1 = Forward<Param1Type>(Param1), Param2 = Forward<Param2Type>(Param2)]
+    {
+        if (!Token.IsValid() || !Token->IsCancelled())
+        {
+            Delegate.ExecuteIfBound(Param1, Param2);
+        }
+    });
 }
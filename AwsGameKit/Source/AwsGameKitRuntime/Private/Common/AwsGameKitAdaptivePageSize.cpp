@@ -0,0 +1,149 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitAdaptivePageSize.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitPaginationAdaptive(
+    TEXT("GameKit.Pagination.Adaptive"),
+    0,
+    TEXT("If 1, the page size of ListAchievements, GetAllSlotSyncStatuses and GetBundle follows the measured latency of their pages, see FAwsGameKitAdaptivePageSize.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitPaginationTargetPageSeconds(
+    TEXT("GameKit.Pagination.TargetPageSeconds"),
+    0.5f,
+    TEXT("Duration in seconds adaptive page sizes aim for, which bounds the wait for the first page.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitPaginationMinPageSize(
+    TEXT("GameKit.Pagination.MinPageSize"),
+    10,
+    TEXT("Smallest adaptive page size.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitPaginationMaxPageKilobytes(
+    TEXT("GameKit.Pagination.MaxPageKilobytes"),
+    256,
+    TEXT("Largest adaptive page in kilobytes, when the size of the items is known. 0 for no limit.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Weight of the latest page in the fit, the weight of older pages decays by 1 - SAMPLE_WEIGHT with each page
+    const double SAMPLE_WEIGHT = 0.25;
+
+    // Below this variance of the page sizes, in items squared, the round trip can't be told apart from the time per item
+    const double MIN_ITEMS_VARIANCE = 1.0;
+}
+
+FAwsGameKitAdaptivePageSize::FAwsGameKitAdaptivePageSize(const TCHAR* InName, int32 InDefaultPageSize, int32 InMaxPageSize)
+    : Name(InName)
+    , DefaultPageSize(InDefaultPageSize)
+    , MaxPageSize(InMaxPageSize)
+{
+}
+
+bool FAwsGameKitAdaptivePageSize::IsEnabled()
+{
+    return CVarGameKitPaginationAdaptive.GetValueOnAnyThread() != 0;
+}
+
+int32 FAwsGameKitAdaptivePageSize::GetPageSize(int32 RequestedPageSize) const
+{
+    if (!IsEnabled())
+    {
+        return RequestedPageSize;
+    }
+
+    FScopeLock Lock(&Mutex);
+    return CurrentPageSize > 0 ? CurrentPageSize : RequestedPageSize;
+}
+
+void FAwsGameKitAdaptivePageSize::RecordPage(int32 PageSize, int32 NumItems, int64 Bytes, double Seconds)
+{
+    if (NumItems <= 0 || Seconds <= 0.0)
+    {
+        return;
+    }
+
+    AddSample(PageSize, NumItems, Bytes, Seconds);
+}
+
+void FAwsGameKitAdaptivePageSize::RecordCall(int32 PageSize, int32 NumItems, int64 Bytes, double Seconds)
+{
+    if (NumItems <= 0 || Seconds <= 0.0)
+    {
+        return;
+    }
+
+    const int32 EffectivePageSize = PageSize > 0 ? PageSize : DefaultPageSize;
+    const int32 NumPages = FMath::DivideAndRoundUp(NumItems, FMath::Max(1, EffectivePageSize));
+    AddSample(PageSize, static_cast<double>(NumItems) / NumPages, static_cast<double>(Bytes) / NumPages, Seconds / NumPages);
+}
+
+void FAwsGameKitAdaptivePageSize::AddSample(int32 PageSize, double NumItems, double Bytes, double Seconds)
+{
+    FScopeLock Lock(&Mutex);
+
+    const double Decay = 1.0 - SAMPLE_WEIGHT;
+    Weight = Weight * Decay + 1.0;
+    SumItems = SumItems * Decay + NumItems;
+    SumSeconds = SumSeconds * Decay + Seconds;
+    SumItemsSquared = SumItemsSquared * Decay + NumItems * NumItems;
+    SumItemsSeconds = SumItemsSeconds * Decay + NumItems * Seconds;
+    SumSizedItems *= Decay;
+    SumBytes *= Decay;
+    if (Bytes > 0.0)
+    {
+        SumSizedItems += NumItems;
+        SumBytes += Bytes;
+    }
+
+    const int32 PreviousPageSize = CurrentPageSize;
+    CurrentPageSize = ComputePageSize(PageSize > 0 ? PageSize : DefaultPageSize);
+    if (CurrentPageSize != PreviousPageSize)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitAdaptivePageSize: %s page size %d -> %d"), Name, PreviousPageSize, CurrentPageSize);
+    }
+}
+
+int32 FAwsGameKitAdaptivePageSize::ComputePageSize(int32 PageSize) const
+{
+    const double TargetSeconds = FMath::Max(0.01f, CVarGameKitPaginationTargetPageSeconds.GetValueOnAnyThread());
+    const int32 MinPageSize = FMath::Clamp(CVarGameKitPaginationMinPageSize.GetValueOnAnyThread(), 1, MaxPageSize);
+
+    const double MeanItems = SumItems / Weight;
+    const double ItemsVariance = SumItemsSquared / Weight - MeanItems * MeanItems;
+
+    double RoundTripSeconds = 0.0;
+    double SecondsPerItem = SumSeconds / SumItems;
+    if (ItemsVariance >= MIN_ITEMS_VARIANCE)
+    {
+        const double MeanSeconds = SumSeconds / Weight;
+        SecondsPerItem = (SumItemsSeconds / Weight - MeanItems * MeanSeconds) / ItemsVariance;
+        RoundTripSeconds = FMath::Max(0.0, MeanSeconds - SecondsPerItem * MeanItems);
+    }
+
+    double Proposed = MaxPageSize;
+    if (SecondsPerItem > 0.0)
+    {
+        Proposed = FMath::Max(TargetSeconds - RoundTripSeconds, RoundTripSeconds) / SecondsPerItem;
+    }
+
+    const int32 MaxPageKilobytes = CVarGameKitPaginationMaxPageKilobytes.GetValueOnAnyThread();
+    if (MaxPageKilobytes > 0 && SumBytes > 0.0)
+    {
+        Proposed = FMath::Min(Proposed, MaxPageKilobytes * 1024.0 / (SumBytes / SumSizedItems));
+    }
+
+    const int32 BasePageSize = CurrentPageSize > 0 ? CurrentPageSize : FMath::Clamp(PageSize, MinPageSize, MaxPageSize);
+    Proposed = FMath::Clamp(Proposed, BasePageSize / 2.0, BasePageSize * 2.0);
+    return FMath::Clamp(FMath::RoundToInt(Proposed), MinPageSize, MaxPageSize);
+}
@@ -0,0 +1,371 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Benchmarks of the plugin's own overhead: marshalling, worker pool and game thread dispatch, with the GameKit libraries replaced by stubs
+// which answer immediately, so that no backend and no network latency is involved.
+//
+// Usage: GameKit.Benchmark [Iterations=10] (or -ExecCmds="GameKit.Benchmark" for automated runs)
+//
+// Results are logged and written as JSON to Saved/Profiling/GameKitBenchmarks/ for trend tracking.
+// Run with -llm to get the allocations of each feature under the AwsGameKit LLM tags, see AwsGameKitMemory.h.
+//
+// The stubs are swapped into FAwsGameKitRuntimeModule for the duration of the run, so don't run it while the game is making GameKit calls.
+// The achievements cache is invalidated afterwards since the stub achievements would have replaced it.
+
+// GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "Core/AwsGameKitErrors.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "Models/AwsGameKitAchievementModels.h"
+#include "UserGameplayData/AwsGameKitUserGameplayData.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+// Standard library
+#include <string>
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+    const int32 ADD_BUNDLE_ITEM_COUNTS[] = { 10, 100, 1000 };
+    const int32 LIST_ACHIEVEMENTS_COUNT = 1500;
+    const int32 LIST_ACHIEVEMENTS_PAGE_SIZE = 100;
+    const int32 SAVE_SLOT_MEGABYTES[] = { 1, 10, 50 };
+    const int32 DISPATCHED_DELEGATES = 10000;
+
+    struct FBenchmarkResult
+    {
+        FString Name;
+        int32 Iterations = 0;
+        double MeanMs = 0.0;
+        double MinMs = 0.0;
+        double MaxMs = 0.0;
+        double Throughput = 0.0;
+        FString ThroughputUnit;
+    };
+
+    // Runs Work Iterations times after one warm-up run. UnitsPerIteration / mean time is the throughput.
+    FBenchmarkResult Measure(const FString& Name, int32 Iterations, double UnitsPerIteration, const TCHAR* ThroughputUnit, TFunctionRef<void()> Work)
+    {
+        Work();
+
+        FBenchmarkResult Result;
+        Result.Name = Name;
+        Result.Iterations = Iterations;
+        Result.MinMs = TNumericLimits<double>::Max();
+        Result.ThroughputUnit = ThroughputUnit;
+
+        double TotalMs = 0.0;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double Start = FPlatformTime::Seconds();
+            Work();
+            const double ElapsedMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+            TotalMs += ElapsedMs;
+            Result.MinMs = FMath::Min(Result.MinMs, ElapsedMs);
+            Result.MaxMs = FMath::Max(Result.MaxMs, ElapsedMs);
+        }
+
+        Result.MeanMs = TotalMs / Iterations;
+        Result.Throughput = Result.MeanMs > 0.0 ? UnitsPerIteration * 1000.0 / Result.MeanMs : 0.0;
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("GameKit.Benchmark: %s: mean %.3f ms, min %.3f ms, max %.3f ms, %.1f %s"),
+            *Result.Name, Result.MeanMs, Result.MinMs, Result.MaxMs, Result.Throughput, *Result.ThroughputUnit);
+        return Result;
+    }
+
+    class FStubUserGameplayDataWrapper : public AwsGameKitUserGameplayDataWrapper
+    {
+    public:
+        virtual unsigned int GameKitAddUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutUnprocessedItems, UserGameplayDataBundle userGameplayDataBundle) override
+        {
+            return GameKit::GAMEKIT_SUCCESS;
+        }
+    };
+
+    class FStubAchievementsWrapper : public AwsGameKitAchievementsWrapper
+    {
+    public:
+        FStubAchievementsWrapper(int32 NumAchievements, int32 PageSize)
+        {
+            for (int32 First = 0; First < NumAchievements; First += PageSize)
+            {
+                FString Page = TEXT("{\"data\":{\"achievements\":[");
+                for (int32 Index = First; Index < FMath::Min(First + PageSize, NumAchievements); ++Index)
+                {
+                    Page += FString::Printf(TEXT("%s{\"achievement_id\":\"achievement_%d\",\"title\":\"Achievement %d\",\"locked_description\":\"Do the thing %d times\",")
+                        TEXT("\"unlocked_description\":\"You did the thing\",\"locked_icon_url\":\"icons/locked_%d.png\",\"unlocked_icon_url\":\"icons/unlocked_%d.png\",")
+                        TEXT("\"max_value\":%d,\"points\":10,\"order_number\":%d,\"current_value\":3,\"is_secret\":false,\"is_hidden\":false,\"earned\":false,")
+                        TEXT("\"newly_earned\":false,\"updated_at\":\"2022-01-01T00:00:00Z\",\"earned_at\":\"\"}"),
+                        Index == First ? TEXT("") : TEXT(","), Index, Index, Index, Index, Index, 1 + Index % 10, Index);
+                }
+                Page += TEXT("]},\"paging\":{\"next_start_key\":null}}");
+                Pages.Emplace(TCHAR_TO_UTF8(*Page));
+            }
+        }
+
+        virtual unsigned int GameKitListAchievements(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, unsigned int pageSize, bool waitForAllPages, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback) override
+        {
+            for (const std::string& page : Pages)
+            {
+                responseCallback(receiver, page.c_str());
+            }
+            return GameKit::GAMEKIT_SUCCESS;
+        }
+
+    private:
+        TArray<std::string> Pages;
+    };
+
+    class FStubGameSavingWrapper : public AwsGameKitGameSavingWrapper
+    {
+    public:
+        FStubGameSavingWrapper(const GameSavingLibrary& InLoadedLibrary) :
+            LoadedLibrary(InLoadedLibrary)
+        {}
+
+        virtual unsigned int GameKitSaveSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, GameSavingModel& model) override
+        {
+            // Not calling back: the results would replace the cached slots with the benchmark slot
+            return GameKit::GAMEKIT_SUCCESS;
+        }
+
+        // Local slots queued by the game are still added to the loaded library
+        virtual void GameKitAddLocalSlots(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, const char** localSlotInformationFilePaths, const unsigned int arraySize) override
+        {
+            if (LoadedLibrary.GameSavingWrapper.IsValid())
+            {
+                LoadedLibrary.GameSavingWrapper->GameKitAddLocalSlots(LoadedLibrary.GameSavingInstanceHandle, localSlotInformationFilePaths, arraySize);
+            }
+        }
+
+    private:
+        GameSavingLibrary LoadedLibrary;
+    };
+}
+
+class FAwsGameKitBenchmarks
+{
+public:
+    static void Run(int32 Iterations)
+    {
+        check(IsInGameThread());
+
+        FAwsGameKitRuntimeModule& RuntimeModule = FAwsGameKitRuntimeModule::Get();
+        TArray<FBenchmarkResult> Results;
+
+        BenchmarkAddBundle(RuntimeModule, Iterations, Results);
+        BenchmarkListAchievements(RuntimeModule, Iterations, Results);
+        BenchmarkSaveSlot(RuntimeModule, Iterations, Results);
+        BenchmarkDelegateDispatch(Iterations, Results);
+
+        WriteResults(Results);
+    }
+
+private:
+    static void BenchmarkAddBundle(FAwsGameKitRuntimeModule& RuntimeModule, int32 Iterations, TArray<FBenchmarkResult>& Results)
+    {
+        const UserGameplayDataLibrary LoadedLibrary = RuntimeModule.userGameplayDataLibrary;
+        const bool bWasLoaded = RuntimeModule.userGameplayDataLibraryLoaded.load();
+        RuntimeModule.userGameplayDataLibrary.UserGameplayDataWrapper = MakeShared<FStubUserGameplayDataWrapper>();
+        RuntimeModule.userGameplayDataLibrary.UserGameplayDataInstanceHandle = nullptr;
+        RuntimeModule.userGameplayDataLibraryLoaded.store(true);
+
+        for (const int32 ItemCount : ADD_BUNDLE_ITEM_COUNTS)
+        {
+            FUserGameplayDataBundle Bundle;
+            Bundle.BundleName = TEXT("GameKitBenchmarkBundle");
+            for (int32 Index = 0; Index < ItemCount; ++Index)
+            {
+                Bundle.BundleMap.Add(FString::Printf(TEXT("item_%d"), Index), FString::Printf(TEXT("%d"), Index * 7919));
+            }
+
+            Results.Add(Measure(FString::Printf(TEXT("UserGameplayData.AddBundle.%dItems"), ItemCount), Iterations, ItemCount, TEXT("items/s"), [&]()
+            {
+                FUserGameplayDataBundle Unprocessed;
+                AwsGameKitUserGameplayData::AddBundleBlocking(Bundle, Unprocessed);
+            }));
+
+            if (FAwsGameKitUserGameplayDataCache::IsEnabled())
+            {
+                FAwsGameKitUserGameplayDataCache::Get().InvalidateBundle(Bundle.BundleName);
+            }
+        }
+
+        RuntimeModule.userGameplayDataLibrary = LoadedLibrary;
+        RuntimeModule.userGameplayDataLibraryLoaded.store(bWasLoaded);
+    }
+
+    static void BenchmarkListAchievements(FAwsGameKitRuntimeModule& RuntimeModule, int32 Iterations, TArray<FBenchmarkResult>& Results)
+    {
+        const AchievementsLibrary LoadedLibrary = RuntimeModule.achievementsLibrary;
+        const bool bWasLoaded = RuntimeModule.achievementsLibraryLoaded.load();
+        RuntimeModule.achievementsLibrary.AchievementsWrapper = MakeShared<FStubAchievementsWrapper>(LIST_ACHIEVEMENTS_COUNT, LIST_ACHIEVEMENTS_PAGE_SIZE);
+        RuntimeModule.achievementsLibrary.AchievementsInstanceHandle = nullptr;
+        RuntimeModule.achievementsLibraryLoaded.store(true);
+
+        // From the call until the last page and the status are delivered on the game thread
+        const FListAchievementsRequest Request = { LIST_ACHIEVEMENTS_PAGE_SIZE, true };
+        Results.Add(Measure(FString::Printf(TEXT("Achievements.ListAchievementsForPlayer.%dAchievements"), LIST_ACHIEVEMENTS_COUNT), Iterations, LIST_ACHIEVEMENTS_COUNT, TEXT("achievements/s"), [&]()
+        {
+            bool bComplete = false;
+            AwsGameKitAchievements::ListAchievementsForPlayer(Request,
+                TAwsGameKitDelegate<const TArray<FAchievement>&>::CreateLambda([](const TArray<FAchievement>&) {}),
+                FAwsGameKitStatusDelegate::CreateLambda([&bComplete](const IntResult&) { bComplete = true; }));
+            DrainCompletions(bComplete);
+        }));
+
+        RuntimeModule.achievementsLibrary = LoadedLibrary;
+        RuntimeModule.achievementsLibraryLoaded.store(bWasLoaded);
+
+        if (FAwsGameKitAchievementsCache::IsEnabled())
+        {
+            FAwsGameKitAchievementsCache::Get().Invalidate();
+        }
+    }
+
+    static void BenchmarkSaveSlot(FAwsGameKitRuntimeModule& RuntimeModule, int32 Iterations, TArray<FBenchmarkResult>& Results)
+    {
+        // Game Saving takes its library as a parameter, the loaded one isn't swapped
+        GameSavingLibrary StubLibrary;
+        StubLibrary.GameSavingWrapper = MakeShared<FStubGameSavingWrapper>(RuntimeModule.gameSavingLibrary);
+
+        for (const int32 Megabytes : SAVE_SLOT_MEGABYTES)
+        {
+            FGameSavingSaveSlotRequest Request;
+            Request.SlotName = TEXT("GameKitBenchmarkSlot");
+            Request.SaveInfoFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Profiling"), TEXT("GameKitBenchmarks"), TEXT("GameKitBenchmarkSlot.SaveInfo.json"));
+            Request.OverrideSync = true;
+
+            // Compressible but not trivially so, like a serialized save game
+            Request.Data.SetNumUninitialized(Megabytes * 1024 * 1024);
+            FRandomStream Random(Megabytes);
+            for (int32 Index = 0; Index < Request.Data.Num(); ++Index)
+            {
+                Request.Data[Index] = static_cast<uint8>(Index % 64 < 48 ? Index : Random.RandRange(0, 255));
+            }
+
+            Results.Add(Measure(FString::Printf(TEXT("GameSaving.SaveSlot.%dMB"), Megabytes), Iterations, Megabytes, TEXT("MB/s"), [&]()
+            {
+                FGameSavingSlotActionResults SlotResults;
+                InternalAwsGameKitSaveSlot(StubLibrary, Request, SlotResults);
+            }));
+        }
+    }
+
+    static void BenchmarkDelegateDispatch(int32 Iterations, TArray<FBenchmarkResult>& Results)
+    {
+        // Completions pushed from the worker pool, as the feature APIs do, until they have all run on the game thread
+        Results.Add(Measure(FString::Printf(TEXT("CompletionQueue.Dispatch.%dDelegates"), DISPATCHED_DELEGATES), Iterations, DISPATCHED_DELEGATES, TEXT("delegates/s"), []()
+        {
+            FThreadSafeCounter Remaining(DISPATCHED_DELEGATES);
+            const TAwsGameKitDelegate<const IntResult&> Delegate = TAwsGameKitDelegate<const IntResult&>::CreateLambda([&Remaining](const IntResult&) { Remaining.Decrement(); });
+
+            const int32 NumProducers = 4;
+            for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+            {
+                FAwsGameKitWorkerPool::Get().Dispatch([Delegate, Count = DISPATCHED_DELEGATES / NumProducers + (Producer < DISPATCHED_DELEGATES % NumProducers ? 1 : 0)]()
+                {
+                    for (int32 Index = 0; Index < Count; ++Index)
+                    {
+                        FAwsGameKitCompletionQueue::Get().Enqueue([Delegate] { Delegate.ExecuteIfBound(IntResult(GameKit::GAMEKIT_SUCCESS)); });
+                    }
+                });
+            }
+
+            bool bComplete = false;
+            while (!bComplete)
+            {
+                FAwsGameKitCompletionQueue::Get().Tick(0.0f);
+                bComplete = Remaining.GetValue() == 0;
+                if (!bComplete)
+                {
+                    FPlatformProcess::SleepNoStats(0.0f);
+                }
+            }
+        }));
+    }
+
+    // Runs the queued completions until bComplete is set by one of them
+    static void DrainCompletions(const bool& bComplete)
+    {
+        while (!bComplete)
+        {
+            FAwsGameKitCompletionQueue::Get().Tick(0.0f);
+            if (!bComplete)
+            {
+                FPlatformProcess::SleepNoStats(0.0f);
+            }
+        }
+    }
+
+    static void WriteResults(const TArray<FBenchmarkResult>& Results)
+    {
+        FString Json;
+        const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+        const FDateTime Now = FDateTime::UtcNow();
+
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("timestamp"), Now.ToIso8601());
+        Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+        Writer->WriteValue(TEXT("configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+        Writer->WriteValue(TEXT("changelist"), static_cast<int64>(FApp::GetEngineVersion().GetChangelist()));
+        Writer->WriteArrayStart(TEXT("results"));
+        for (const FBenchmarkResult& Result : Results)
+        {
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("name"), Result.Name);
+            Writer->WriteValue(TEXT("iterations"), Result.Iterations);
+            Writer->WriteValue(TEXT("meanMs"), Result.MeanMs);
+            Writer->WriteValue(TEXT("minMs"), Result.MinMs);
+            Writer->WriteValue(TEXT("maxMs"), Result.MaxMs);
+            Writer->WriteValue(TEXT("throughput"), Result.Throughput);
+            Writer->WriteValue(TEXT("throughputUnit"), Result.ThroughputUnit);
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+        Writer->Close();
+
+        const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("GameKitBenchmarks"), FString::Printf(TEXT("GameKitBenchmarks-%s.json"), *Now.ToString()));
+        if (FFileHelper::SaveStringToFile(Json, *FilePath))
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("GameKit.Benchmark: Wrote %d results to %s"), Results.Num(), *FilePath);
+        }
+        else
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("GameKit.Benchmark: Failed to write the results to %s"), *FilePath);
+        }
+    }
+};
+
+static FAutoConsoleCommand CmdGameKitBenchmark(
+    TEXT("GameKit.Benchmark"),
+    TEXT("Measures the plugin's marshalling and dispatch overhead with stubbed GameKit libraries, and writes the results to Saved/Profiling/GameKitBenchmarks.\n")
+    TEXT("Usage: GameKit.Benchmark [Iterations=10]\n"),
+    FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+    {
+        const int32 iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+        FAwsGameKitBenchmarks::Run(iterations);
+    }));
+
+#endif
@@ -0,0 +1,212 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitCacheBudget.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitStats.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitCacheBudgetMaxBytes(
+    TEXT("GameKit.CacheBudget.MaxBytes"),
+    32 * 1024 * 1024,
+    TEXT("Memory the GameKit client caches may hold together, in bytes, see FAwsGameKitCacheBudget.\n")
+    TEXT("  0: no budget\n"),
+    ECVF_Default);
+
+namespace
+{
+    const double ENFORCE_INTERVAL_SECONDS = 1.0;
+}
+
+FAwsGameKitCacheBudget& FAwsGameKitCacheBudget::Get()
+{
+    static FAwsGameKitCacheBudget Instance;
+    return Instance;
+}
+
+void FAwsGameKitCacheBudget::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitCacheBudget::Tick));
+    MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddRaw(this, &FAwsGameKitCacheBudget::OnMemoryTrim);
+}
+
+void FAwsGameKitCacheBudget::Shutdown()
+{
+    check(IsInGameThread());
+    if (!TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+    MemoryTrimHandle.Reset();
+
+    // Registered again by the next startup
+    FScopeLock ScopeLock(&Mutex);
+    Caches.Reset();
+}
+
+void FAwsGameKitCacheBudget::RegisterCache(const FString& Name, EAwsGameKitCachePriority Priority, FAwsGameKitBudgetedCache&& Cache)
+{
+    FScopeLock ScopeLock(&Mutex);
+    Caches.Add(FRegisteredCache{ Name, Priority, MoveTemp(Cache) });
+}
+
+void FAwsGameKitCacheBudget::RequestEnforce()
+{
+    bEnforceRequested.store(true, std::memory_order_release);
+}
+
+int64 FAwsGameKitCacheBudget::GetTotalBytes() const
+{
+    int64 TotalBytes = 0;
+    for (const FRegisteredCache& Registered : GetCaches())
+    {
+        TotalBytes += Registered.Cache.GetBytes();
+    }
+    return TotalBytes;
+}
+
+int64 FAwsGameKitCacheBudget::EvictTo(int64 MaxBytes)
+{
+    check(IsInGameThread());
+    const TArray<FRegisteredCache> AllCaches = GetCaches();
+
+    // The budget applies to the bytes which can be evicted. Accounted-only caches and the entries a cache can't evict don't count toward it,
+    // otherwise they would make the loop evict everything else and still miss the target.
+    TArray<int64> CacheBytes;
+    CacheBytes.SetNumZeroed(AllCaches.Num());
+    int64 TotalBytes = 0;
+    int64 EvictableBytes = 0;
+    for (int32 Index = 0; Index < AllCaches.Num(); ++Index)
+    {
+        CacheBytes[Index] = AllCaches[Index].Cache.GetBytes();
+        TotalBytes += CacheBytes[Index];
+        if (AllCaches[Index].Cache.EvictOldest)
+        {
+            EvictableBytes += CacheBytes[Index];
+        }
+    }
+
+    // Caches which had nothing left to evict this time, their remaining bytes no longer count as evictable
+    TArray<bool> Exhausted;
+    Exhausted.SetNumZeroed(AllCaches.Num());
+    auto MarkExhausted = [&](int32 Index)
+    {
+        Exhausted[Index] = true;
+        EvictableBytes -= FMath::Max<int64>(CacheBytes[Index], 0);
+    };
+
+    int64 FreedBytes = 0;
+    int32 NumEvicted = 0;
+    while (EvictableBytes > MaxBytes)
+    {
+        // Lowest priority first, then least recently used
+        int32 VictimIndex = INDEX_NONE;
+        double VictimOldestUse = MAX_dbl;
+        for (int32 Index = 0; Index < AllCaches.Num(); ++Index)
+        {
+            const FRegisteredCache& Registered = AllCaches[Index];
+            if (Exhausted[Index] || !Registered.Cache.EvictOldest)
+            {
+                continue;
+            }
+
+            const double OldestUse = Registered.Cache.GetOldestUse();
+            if (OldestUse == MAX_dbl)
+            {
+                MarkExhausted(Index);
+                continue;
+            }
+
+            if (VictimIndex == INDEX_NONE || Registered.Priority < AllCaches[VictimIndex].Priority
+                || (Registered.Priority == AllCaches[VictimIndex].Priority && OldestUse < VictimOldestUse))
+            {
+                VictimIndex = Index;
+                VictimOldestUse = OldestUse;
+            }
+        }
+
+        if (VictimIndex == INDEX_NONE)
+        {
+            break;
+        }
+
+        const int64 Freed = AllCaches[VictimIndex].Cache.EvictOldest();
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitCacheBudget: Evicted %lld bytes from %s"), Freed, *AllCaches[VictimIndex].Name);
+        if (Freed <= 0)
+        {
+            MarkExhausted(VictimIndex);
+            continue;
+        }
+
+        CacheBytes[VictimIndex] -= Freed;
+        TotalBytes -= Freed;
+        EvictableBytes -= Freed;
+        FreedBytes += Freed;
+        NumEvicted++;
+    }
+
+    FAwsGameKitStats::SetCacheBytes(TotalBytes);
+    if (NumEvicted > 0)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitCacheBudget: Evicted %d cache entries (%lld bytes), %lld bytes cached"), NumEvicted, FreedBytes, TotalBytes);
+    }
+    return FreedBytes;
+}
+
+bool FAwsGameKitCacheBudget::Tick(float DeltaTime)
+{
+    if (bTrimRequested.exchange(false, std::memory_order_acq_rel))
+    {
+        EvictTo(0);
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now < NextEnforceTime && !bEnforceRequested.exchange(false, std::memory_order_acq_rel))
+    {
+        // Keep ticking
+        return true;
+    }
+    NextEnforceTime = Now + ENFORCE_INTERVAL_SECONDS;
+
+    const int32 MaxBytes = CVarGameKitCacheBudgetMaxBytes.GetValueOnGameThread();
+    EvictTo(MaxBytes > 0 ? MaxBytes : MAX_int64);
+
+    // Keep ticking
+    return true;
+}
+
+TArray<FAwsGameKitCacheBudget::FRegisteredCache> FAwsGameKitCacheBudget::GetCaches() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return Caches;
+}
+
+void FAwsGameKitCacheBudget::OnMemoryTrim()
+{
+    if (!IsInGameThread())
+    {
+        // Trimmed on the next tick instead
+        bTrimRequested.store(true, std::memory_order_release);
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitCacheBudget: Low memory, evicting the GameKit caches"));
+    EvictTo(0);
+}
@@ -0,0 +1,75 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitCancellation.h"
+
+// Unreal
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    thread_local FAwsGameKitCancellationToken* CurrentToken = nullptr;
+}
+
+FAwsGameKitCancellationTokenPtr FAwsGameKitCancellationToken::Create(double TimeoutSeconds)
+{
+    FAwsGameKitCancellationTokenPtr Token = MakeShared<FAwsGameKitCancellationToken, ESPMode::ThreadSafe>();
+    if (TimeoutSeconds > 0.0)
+    {
+        Token->Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+    }
+    return Token;
+}
+
+void FAwsGameKitCancellationToken::Cancel()
+{
+    bCancelled = true;
+}
+
+bool FAwsGameKitCancellationToken::IsCancelled() const
+{
+    return bCancelled;
+}
+
+bool FAwsGameKitCancellationToken::IsDeadlineExceeded() const
+{
+    return Deadline > 0.0 && FPlatformTime::Seconds() >= Deadline;
+}
+
+void FAwsGameKitCancellationToken::CallOnDeadline(TFunction<void()> Callback) const
+{
+    if (Deadline <= 0.0)
+    {
+        return;
+    }
+
+    const float DelaySeconds = FMath::Max(0.0, Deadline - FPlatformTime::Seconds());
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Callback = MoveTemp(Callback)](float)
+    {
+        Callback();
+        return false;
+    }), DelaySeconds);
+}
+
+FAwsGameKitCancellationScope::FAwsGameKitCancellationScope(const FAwsGameKitCancellationTokenPtr& InToken) :
+    Token(InToken),
+    Previous(CurrentToken)
+{
+    CurrentToken = Token.Get();
+}
+
+FAwsGameKitCancellationScope::~FAwsGameKitCancellationScope()
+{
+    CurrentToken = Previous;
+}
+
+FAwsGameKitCancellationTokenPtr FAwsGameKitCancellationScope::GetCurrent()
+{
+    return CurrentToken != nullptr ? CurrentToken->AsShared() : FAwsGameKitCancellationTokenPtr();
+}
+
+bool FAwsGameKitCancellationScope::IsCurrentCallAbandoned()
+{
+    return CurrentToken != nullptr && CurrentToken->IsAbandoned();
+}
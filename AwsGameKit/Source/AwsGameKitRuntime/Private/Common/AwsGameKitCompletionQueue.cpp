@@ -0,0 +1,145 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitCompletionQueue.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitTrace.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<float> CVarGameKitCompletionQueueFrameBudgetMs(
+    TEXT("GameKit.CompletionQueue.FrameBudgetMs"),
+    2.0f,
+    TEXT("Maximum time in milliseconds spent running GameKit result delegates per frame. At least one delegate runs per frame. 0 disables the cap.\n"),
+    ECVF_Default);
+
+namespace
+{
+    thread_local bool bCompleteOnWorker = false;
+}
+
+FAwsGameKitWorkerCompletionScope::FAwsGameKitWorkerCompletionScope(bool bEnabled) :
+    bPrevious(bCompleteOnWorker)
+{
+    bCompleteOnWorker = bEnabled;
+}
+
+FAwsGameKitWorkerCompletionScope::~FAwsGameKitWorkerCompletionScope()
+{
+    bCompleteOnWorker = bPrevious;
+}
+
+bool FAwsGameKitWorkerCompletionScope::IsActive()
+{
+    return bCompleteOnWorker;
+}
+
+FAwsGameKitCompletionQueue& FAwsGameKitCompletionQueue::Get()
+{
+    static FAwsGameKitCompletionQueue Instance;
+    return Instance;
+}
+
+void FAwsGameKitCompletionQueue::Startup()
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitCompletionQueue::Tick));
+    bRunning = true;
+}
+
+void FAwsGameKitCompletionQueue::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    if (QueueDepth.GetValue() > 0)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitCompletionQueue::Shutdown(): dropping %d pending completions"), QueueDepth.GetValue());
+    }
+
+    TUniqueFunction<void()> Completion;
+    while (Completions.Dequeue(Completion))
+    {
+        QueueDepth.Decrement();
+    }
+}
+
+void FAwsGameKitCompletionQueue::Enqueue(TUniqueFunction<void()>&& Completion)
+{
+#if AWSGAMEKIT_TRACE_ENABLED
+    const uint32 CallId = FAwsGameKitTrace::GetContext().CallId;
+    if (CallId != 0)
+    {
+        Completion = [CallId, Completion = MoveTemp(Completion)]() mutable
+        {
+            FAwsGameKitTraceCurrentCallScope CallScope(CallId);
+            AWSGAMEKIT_TRACE_PHASE(GameThreadDelivery);
+            Completion();
+        };
+    }
+#endif
+
+    if (!bRunning)
+    {
+        AsyncTask(ENamedThreads::GameThread, MoveTemp(Completion));
+        return;
+    }
+
+    QueueDepth.Increment();
+    Completions.Enqueue(MoveTemp(Completion));
+}
+
+int32 FAwsGameKitCompletionQueue::GetQueueDepth() const
+{
+    return QueueDepth.GetValue();
+}
+
+bool FAwsGameKitCompletionQueue::Tick(float DeltaTime)
+{
+    const float BudgetMs = CVarGameKitCompletionQueueFrameBudgetMs.GetValueOnGameThread();
+    const double EndTime = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+
+    int32 NumDispatched = 0;
+    if (!Completions.IsEmpty())
+    {
+        SCOPE_CYCLE_COUNTER(STAT_AwsGameKit_GameThreadCallbacks);
+        CSV_SCOPED_TIMING_STAT(AwsGameKit, GameThreadCallbacks);
+
+        TUniqueFunction<void()> Completion;
+        while (Completions.Dequeue(Completion))
+        {
+            QueueDepth.Decrement();
+            Completion();
+            ++NumDispatched;
+
+            if (BudgetMs > 0.0f && FPlatformTime::Seconds() >= EndTime)
+            {
+                break;
+            }
+        }
+    }
+
+    FAwsGameKitStats::RecordDelegatesDispatched(NumDispatched);
+    FAwsGameKitStats::RecordFrame();
+
+    // Keep ticking
+    return true;
+}
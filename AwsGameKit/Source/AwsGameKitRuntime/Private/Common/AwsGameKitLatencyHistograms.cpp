@@ -0,0 +1,285 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitLatencyHistograms.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "SessionManager/AwsGameKitTransport.h"
+
+// Unreal
+#include "GenericPlatform/GenericPlatformMisc.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<FString> CVarGameKitLatencyUploadUrl(
+    TEXT("GameKit.Latency.UploadUrl"),
+    TEXT(""),
+    TEXT("Metrics endpoint the GameKit latency histograms are POSTed to as JSON. Empty disables the upload.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitLatencyUploadIntervalSeconds(
+    TEXT("GameKit.Latency.UploadIntervalSeconds"),
+    300.0f,
+    TEXT("Interval in seconds between two uploads of the GameKit latency histograms.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // How often the network connection type is refreshed
+    const float TICK_INTERVAL_SECONDS = 5.0f;
+
+    const TCHAR* GetNetworkTypeName(uint8 NetworkType)
+    {
+        switch (static_cast<ENetworkConnectionType>(NetworkType))
+        {
+        case ENetworkConnectionType::None: return TEXT("None");
+        case ENetworkConnectionType::AirplaneMode: return TEXT("AirplaneMode");
+        case ENetworkConnectionType::Cell: return TEXT("Cell");
+        case ENetworkConnectionType::WiFi: return TEXT("WiFi");
+        case ENetworkConnectionType::WiMAX: return TEXT("WiMAX");
+        case ENetworkConnectionType::Bluetooth: return TEXT("Bluetooth");
+        case ENetworkConnectionType::Ethernet: return TEXT("Ethernet");
+        default: return TEXT("Unknown");
+        }
+    }
+}
+
+FAwsGameKitLatencyHistograms& FAwsGameKitLatencyHistograms::Get()
+{
+    static FAwsGameKitLatencyHistograms Instance;
+    return Instance;
+}
+
+void FAwsGameKitLatencyHistograms::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    NetworkType.store(static_cast<uint8>(FPlatformMisc::GetNetworkConnectionType()), std::memory_order_relaxed);
+    LastUploadTime = FPlatformTime::Seconds();
+    NextUploadTime = LastUploadTime + CVarGameKitLatencyUploadIntervalSeconds.GetValueOnGameThread();
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitLatencyHistograms::Tick), TICK_INTERVAL_SECONDS);
+}
+
+void FAwsGameKitLatencyHistograms::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+void FAwsGameKitLatencyHistograms::Record(const FName& Operation, double Seconds)
+{
+    const uint64 Microseconds = static_cast<uint64>(FMath::Max(0.0, Seconds) * 1000000.0);
+    const FHistogramKey Key(Operation, NetworkType.load(std::memory_order_relaxed));
+
+    FScopeLock ScopeLock(&Mutex);
+    TUniquePtr<FHistogram>& Histogram = Histograms.FindOrAdd(Key);
+    if (!Histogram.IsValid())
+    {
+        Histogram = MakeUnique<FHistogram>();
+    }
+
+    Histogram->Buckets[GetBucketIndex(Microseconds)]++;
+    Histogram->Count++;
+    Histogram->TotalMicroseconds += Microseconds;
+    Histogram->MaxMicroseconds = FMath::Max(Histogram->MaxMicroseconds, Microseconds);
+}
+
+TArray<FAwsGameKitLatencySnapshot> FAwsGameKitLatencyHistograms::GetSnapshot(bool bReset)
+{
+    TArray<FAwsGameKitLatencySnapshot> Snapshots;
+
+    FScopeLock ScopeLock(&Mutex);
+    Snapshots.Reserve(Histograms.Num());
+    for (const TPair<FHistogramKey, TUniquePtr<FHistogram>>& Entry : Histograms)
+    {
+        const FHistogram& Histogram = *Entry.Value;
+        if (Histogram.Count == 0)
+        {
+            continue;
+        }
+
+        FAwsGameKitLatencySnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+        Snapshot.Operation = Entry.Key.Key.ToString();
+        Snapshot.NetworkType = GetNetworkTypeName(Entry.Key.Value);
+        Snapshot.Count = Histogram.Count;
+        Snapshot.MeanMs = static_cast<float>(Histogram.TotalMicroseconds / Histogram.Count / 1000.0);
+        Snapshot.P50Ms = GetPercentileMs(Histogram, 0.5);
+        Snapshot.P90Ms = GetPercentileMs(Histogram, 0.9);
+        Snapshot.P99Ms = GetPercentileMs(Histogram, 0.99);
+        Snapshot.MaxMs = Histogram.MaxMicroseconds / 1000.0f;
+    }
+
+    if (bReset)
+    {
+        Histograms.Reset();
+    }
+
+    return Snapshots;
+}
+
+void FAwsGameKitLatencyHistograms::Reset()
+{
+    FScopeLock ScopeLock(&Mutex);
+    Histograms.Reset();
+}
+
+int32 FAwsGameKitLatencyHistograms::GetBucketIndex(uint64 Microseconds)
+{
+    // Values below two sub-bucket ranges are exact, then each power of two is split in SUB_BUCKETS
+    if (Microseconds < 2 * SUB_BUCKETS)
+    {
+        return static_cast<int32>(Microseconds);
+    }
+
+    const uint64 Clamped = FMath::Min(Microseconds, (uint64(1) << MAX_MAGNITUDE) - 1);
+    const int32 Magnitude = static_cast<int32>(FMath::FloorLog2_64(Clamped));
+    const int32 Shift = Magnitude - SUB_BUCKET_BITS;
+    return (Magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + static_cast<int32>(Clamped >> Shift) - SUB_BUCKETS;
+}
+
+uint64 FAwsGameKitLatencyHistograms::GetBucketLowerBound(int32 Index)
+{
+    if (Index < 2 * SUB_BUCKETS)
+    {
+        return Index;
+    }
+
+    const int32 Magnitude = Index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    return uint64(Index % SUB_BUCKETS + SUB_BUCKETS) << (Magnitude - SUB_BUCKET_BITS);
+}
+
+uint64 FAwsGameKitLatencyHistograms::GetBucketUpperBound(int32 Index)
+{
+    return Index + 1 < NUM_BUCKETS ? GetBucketLowerBound(Index + 1) : uint64(1) << MAX_MAGNITUDE;
+}
+
+float FAwsGameKitLatencyHistograms::GetPercentileMs(const FHistogram& Histogram, double Percentile)
+{
+    const int64 Rank = FMath::Max<int64>(1, static_cast<int64>(FMath::CeilToDouble(Percentile * Histogram.Count)));
+    int64 Seen = 0;
+    for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+    {
+        Seen += Histogram.Buckets[Index];
+        if (Seen >= Rank)
+        {
+            // The middle of the bucket, but never more than the largest recorded value
+            const uint64 Middle = (GetBucketLowerBound(Index) + GetBucketUpperBound(Index)) / 2;
+            return FMath::Min(Middle, Histogram.MaxMicroseconds) / 1000.0f;
+        }
+    }
+
+    return Histogram.MaxMicroseconds / 1000.0f;
+}
+
+bool FAwsGameKitLatencyHistograms::Tick(float DeltaTime)
+{
+    NetworkType.store(static_cast<uint8>(FPlatformMisc::GetNetworkConnectionType()), std::memory_order_relaxed);
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now >= NextUploadTime)
+    {
+        NextUploadTime = Now + FMath::Max(TICK_INTERVAL_SECONDS, CVarGameKitLatencyUploadIntervalSeconds.GetValueOnGameThread());
+        Upload();
+    }
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitLatencyHistograms::Upload()
+{
+    const FString Url = CVarGameKitLatencyUploadUrl.GetValueOnGameThread();
+    if (Url.IsEmpty() || bUploading.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    FString Json;
+    const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+    const double Now = FPlatformTime::Seconds();
+    int32 NumHistograms = 0;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+        Writer->WriteValue(TEXT("intervalSeconds"), Now - LastUploadTime);
+        Writer->WriteArrayStart(TEXT("histograms"));
+        for (const TPair<FHistogramKey, TUniquePtr<FHistogram>>& Entry : Histograms)
+        {
+            const FHistogram& Histogram = *Entry.Value;
+            if (Histogram.Count == 0)
+            {
+                continue;
+            }
+
+            NumHistograms++;
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("operation"), Entry.Key.Key.ToString());
+            Writer->WriteValue(TEXT("networkType"), FString(GetNetworkTypeName(Entry.Key.Value)));
+            Writer->WriteValue(TEXT("count"), Histogram.Count);
+            Writer->WriteValue(TEXT("meanMs"), Histogram.TotalMicroseconds / Histogram.Count / 1000.0);
+            Writer->WriteValue(TEXT("p50Ms"), GetPercentileMs(Histogram, 0.5));
+            Writer->WriteValue(TEXT("p90Ms"), GetPercentileMs(Histogram, 0.9));
+            Writer->WriteValue(TEXT("p99Ms"), GetPercentileMs(Histogram, 0.99));
+            Writer->WriteValue(TEXT("maxMs"), Histogram.MaxMicroseconds / 1000.0);
+
+            // Sparse [upper bound in microseconds, count] pairs
+            Writer->WriteArrayStart(TEXT("buckets"));
+            for (int32 Index = 0; Index < NUM_BUCKETS; ++Index)
+            {
+                if (Histogram.Buckets[Index] != 0)
+                {
+                    Writer->WriteArrayStart();
+                    Writer->WriteValue(static_cast<int64>(GetBucketUpperBound(Index)));
+                    Writer->WriteValue(static_cast<int64>(Histogram.Buckets[Index]));
+                    Writer->WriteArrayEnd();
+                }
+            }
+            Writer->WriteArrayEnd();
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+        Histograms.Reset();
+    }
+    Writer->Close();
+    LastUploadTime = Now;
+
+    if (NumHistograms == 0)
+    {
+        return;
+    }
+
+    bUploading.store(true, std::memory_order_release);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FAwsGameKitTransport::Get().CreateRequest();
+    HttpRequest->SetURL(Url);
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    HttpRequest->SetContentAsString(Json);
+    HttpRequest->OnProcessRequestComplete().BindLambda([this, NumHistograms](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+    {
+        if (!bSucceeded || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitLatencyHistograms: Failed to upload %d latency histograms to %s, response code %d"),
+                NumHistograms, *Request->GetURL(), Response.IsValid() ? Response->GetResponseCode() : 0);
+        }
+        bUploading.store(false, std::memory_order_release);
+    });
+    HttpRequest->ProcessRequest();
+}
@@ -0,0 +1,195 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitLifecycle.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+#include "GameSaving/AwsGameKitGameSavingTransferScheduler.h"
+#include "UserGameplayData/AwsGameKitUserGameplayData.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
+
+// Unreal
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitLifecycleBackgroundFlushBudgetMs(
+    TEXT("GameKit.Lifecycle.BackgroundFlushBudgetMs"),
+    3000,
+    TEXT("Longest time in milliseconds the game thread waits for the pending GameKit writes to be sent when the app enters the background or is terminated.\n")
+    TEXT("  0: only sync the write journals to disk\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitLifecycleShutdownDrainBudgetMs(
+    TEXT("GameKit.Lifecycle.ShutdownDrainBudgetMs"),
+    2000,
+    TEXT("Longest time in milliseconds the runtime module waits for the pending GameKit writes to be sent when it shuts down.\n")
+    TEXT("The writes which aren't sent by then are journaled when their journal is enabled, and dropped otherwise.\n"),
+    ECVF_Default);
+
+namespace
+{
+    struct FFlushState
+    {
+        FFlushState(int32 Count) :
+            Remaining(Count),
+            Done(FPlatformProcess::GetSynchEventFromPool(true))
+        {}
+
+        ~FFlushState()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(Done);
+        }
+
+        void Complete()
+        {
+            if (Remaining.Decrement() == 0)
+            {
+                Done->Trigger();
+            }
+        }
+
+        FThreadSafeCounter Remaining;
+        FEvent* const Done;
+    };
+}
+
+FAwsGameKitLifecycle& FAwsGameKitLifecycle::Get()
+{
+    static FAwsGameKitLifecycle Instance;
+    return Instance;
+}
+
+bool FAwsGameKitLifecycle::HasShutdownDeadlinePassed()
+{
+    return Get().bShutdownDeadlinePassed.load(std::memory_order_acquire);
+}
+
+void FAwsGameKitLifecycle::Startup()
+{
+    check(IsInGameThread());
+    if (WillEnterBackgroundHandle.IsValid())
+    {
+        return;
+    }
+
+    bIsInBackground = false;
+    bShutdownDeadlinePassed.store(false, std::memory_order_release);
+    WillDeactivateHandle = FCoreDelegates::ApplicationWillDeactivateDelegate.AddRaw(this, &FAwsGameKitLifecycle::OnWillDeactivate);
+    WillEnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddRaw(this, &FAwsGameKitLifecycle::OnWillEnterBackground);
+    HasEnteredForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddRaw(this, &FAwsGameKitLifecycle::OnHasEnteredForeground);
+    WillTerminateHandle = FCoreDelegates::ApplicationWillTerminateDelegate.AddRaw(this, &FAwsGameKitLifecycle::OnWillEnterBackground);
+}
+
+void FAwsGameKitLifecycle::Shutdown()
+{
+    check(IsInGameThread());
+    if (!WillEnterBackgroundHandle.IsValid())
+    {
+        return;
+    }
+
+    FCoreDelegates::ApplicationWillDeactivateDelegate.Remove(WillDeactivateHandle);
+    FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(WillEnterBackgroundHandle);
+    FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(HasEnteredForegroundHandle);
+    FCoreDelegates::ApplicationWillTerminateDelegate.Remove(WillTerminateHandle);
+    WillDeactivateHandle.Reset();
+    WillEnterBackgroundHandle.Reset();
+    HasEnteredForegroundHandle.Reset();
+    WillTerminateHandle.Reset();
+
+    if (bIsInBackground)
+    {
+        bIsInBackground = false;
+        FAwsGameKitGameSavingTransferScheduler::Get().Resume();
+    }
+}
+
+bool FAwsGameKitLifecycle::Flush(double BudgetSeconds)
+{
+    check(IsInGameThread());
+    const double StartTime = FPlatformTime::Seconds();
+    Checkpoint();
+
+    bool bDrained = true;
+    if (BudgetSeconds > 0.0)
+    {
+        TSharedRef<FFlushState, ESPMode::ThreadSafe> State = MakeShared<FFlushState, ESPMode::ThreadSafe>(3);
+        InternalAwsGameKitRunLambdaOnWorkThread([State]
+        {
+            FAwsGameKitAchievementsUpdateCoalescer::Get().FlushAll(true);
+            State->Complete();
+        }, EAwsGameKitWorkLane::Interactive);
+        InternalAwsGameKitRunLambdaOnWorkThread([State]
+        {
+            FAwsGameKitUserGameplayDataWriteBehind::Get().FlushAll(true);
+            State->Complete();
+        }, EAwsGameKitWorkLane::Interactive);
+        InternalAwsGameKitRunLambdaOnWorkThread([State]
+        {
+            FAwsGameKitOfflineWriteQueue::Get().FlushAll();
+            State->Complete();
+        }, EAwsGameKitWorkLane::Interactive);
+
+        bDrained = State->Done->Wait(FTimespan::FromSeconds(BudgetSeconds));
+    }
+
+    // Enqueued while offline by the sends above. Written on the calling thread, the process may exit right after.
+    AwsGameKitUserGameplayData::PersistToLastCacheBlocking();
+
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    if (bDrained)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitLifecycle::Flush(): Flushed the pending writes in %.0f ms"), ElapsedMs);
+    }
+    else
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitLifecycle::Flush(): The pending writes weren't sent within %.0f ms, the rest is sent in the background"), ElapsedMs);
+    }
+    return bDrained;
+}
+
+void FAwsGameKitLifecycle::Drain()
+{
+    const double BudgetSeconds = FMath::Max(0, CVarGameKitLifecycleShutdownDrainBudgetMs.GetValueOnGameThread()) / 1000.0;
+    const bool bDrained = Flush(BudgetSeconds);
+    bShutdownDeadlinePassed.store(!bDrained, std::memory_order_release);
+}
+
+void FAwsGameKitLifecycle::OnWillDeactivate()
+{
+    Checkpoint();
+}
+
+void FAwsGameKitLifecycle::OnWillEnterBackground()
+{
+    if (!bIsInBackground)
+    {
+        bIsInBackground = true;
+        FAwsGameKitGameSavingTransferScheduler::Get().Pause();
+    }
+
+    Flush(FMath::Max(0, CVarGameKitLifecycleBackgroundFlushBudgetMs.GetValueOnGameThread()) / 1000.0);
+}
+
+void FAwsGameKitLifecycle::OnHasEnteredForeground()
+{
+    if (bIsInBackground)
+    {
+        bIsInBackground = false;
+        FAwsGameKitGameSavingTransferScheduler::Get().Resume();
+    }
+}
+
+void FAwsGameKitLifecycle::Checkpoint()
+{
+    FAwsGameKitOfflineWriteQueue::Get().Checkpoint();
+    FAwsGameKitUserGameplayDataWriteBehind::Get().Checkpoint();
+}
@@ -0,0 +1,649 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitLoadTestCommandlet.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitLatencyHistograms.h"
+#include "Common/AwsGameKitMockBackend.h"
+#include "Core/AwsGameKitErrors.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManagerGeneric.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+// Standard library
+#include <atomic>
+
+namespace
+{
+    enum class ELoadTestOp : uint8
+    {
+        Login,
+        ListAchievements,
+        UpdateItem,
+        SaveSlot,
+        Num
+    };
+
+    constexpr int32 NUM_OPS = static_cast<int32>(ELoadTestOp::Num);
+    const TCHAR* const OP_NAMES[NUM_OPS] = { TEXT("Login"), TEXT("ListAchievements"), TEXT("UpdateItem"), TEXT("SaveSlot") };
+
+    const unsigned int LIST_ACHIEVEMENTS_PAGE_SIZE = 100;
+    const TCHAR* const LOAD_TEST_BUNDLE_NAME = TEXT("LoadTest");
+
+    // Tries to find a player who isn't already running an operation before counting the operation as skipped
+    const int32 MAX_PLAYER_PICKS = 8;
+    const double PROGRESS_INTERVAL_SECONDS = 10.0;
+
+    struct FLoadTestSettings
+    {
+        int32 Players = 10;
+        FString UserPrefix = TEXT("gamekit_load_");
+        FString Password;
+        FString ClientConfig;
+        double Rate = 10.0;
+        double DurationSeconds = 60.0;
+        int32 Concurrency = 64;
+        int32 Weights[NUM_OPS] = { 1, 4, 4, 1 };
+        int32 Burst = 10;
+        int32 SaveSlotKB = 64;
+        bool bRetryQueue = false;
+    };
+
+    struct FLoadTestPlayer
+    {
+        FString UserName;
+        GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE SessionManagerInstanceHandle = nullptr;
+        GAMEKIT_IDENTITY_INSTANCE_HANDLE IdentityInstanceHandle = nullptr;
+        GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE AchievementsInstanceHandle = nullptr;
+        GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE UserGameplayDataInstanceHandle = nullptr;
+        GameSavingLibrary GameSaving;
+        FGameSavingSaveSlotRequest SaveSlotRequest;
+        bool bLoggedIn = false;
+
+        // Set while one of the driver threads runs an operation for this player
+        std::atomic<bool> bBusy{ false };
+    };
+
+    // The counters of one phase of the run: logging in every player, then the mix
+    struct FLoadTestPhase
+    {
+        FString Name;
+        double StartTime = 0.0;
+        double DurationSeconds = 0.0;
+        std::atomic<int64> Calls[NUM_OPS] = {};
+        std::atomic<int64> Errors[NUM_OPS] = {};
+        std::atomic<int64> Skipped{ 0 };
+        FCriticalSection ErrorCodesMutex;
+        TMap<uint32, int64> ErrorCodes;
+        TArray<FAwsGameKitLatencySnapshot> Latencies;
+
+        int64 TotalCalls() const
+        {
+            int64 Total = 0;
+            for (const std::atomic<int64>& OpCalls : Calls)
+            {
+                Total += OpCalls.load(std::memory_order_relaxed);
+            }
+            return Total;
+        }
+
+        int64 TotalErrors() const
+        {
+            int64 Total = 0;
+            for (const std::atomic<int64>& OpErrors : Errors)
+            {
+                Total += OpErrors.load(std::memory_order_relaxed);
+            }
+            return Total;
+        }
+    };
+
+    class FAwsGameKitLoadTest
+    {
+    public:
+        explicit FAwsGameKitLoadTest(const FLoadTestSettings& InSettings) :
+            Settings(InSettings)
+        {
+            for (int32 Op = 0; Op < NUM_OPS; ++Op)
+            {
+                LatencyNames[Op] = FName(*FString::Printf(TEXT("LoadTest.%s"), OP_NAMES[Op]));
+            }
+        }
+
+        int32 Run()
+        {
+            if (!LoadLibraries())
+            {
+                return 1;
+            }
+
+            CreatePlayers();
+
+            // Logins are paced at the target rate too, so that the identity backend sees a ramp rather than every player at once
+            FAwsGameKitLatencyHistograms::Get().Reset();
+            LoginPhase.Name = TEXT("Login");
+            Drive(LoginPhase, Players.Num(), TNumericLimits<double>::Max(), [this](int64 Ticket, double DueTime, FRandomStream& Random)
+            {
+                FLoadTestPlayer& Player = *Players[Ticket];
+                Player.bLoggedIn = RunOp(LoginPhase, ELoadTestOp::Login, Player, DueTime, Random);
+            });
+            LoginPhase.Latencies = FAwsGameKitLatencyHistograms::Get().GetSnapshot(true);
+
+            TArray<FLoadTestPlayer*> LoggedInPlayers;
+            for (const TUniquePtr<FLoadTestPlayer>& Player : Players)
+            {
+                if (Player->bLoggedIn)
+                {
+                    LoggedInPlayers.Add(Player.Get());
+                }
+            }
+
+            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %d of %d players logged in"), LoggedInPlayers.Num(), Players.Num());
+            if (LoggedInPlayers.Num() == 0)
+            {
+                ReleasePlayers();
+                WriteReport();
+                return 1;
+            }
+
+            int32 TotalWeight = 0;
+            for (const int32 Weight : Settings.Weights)
+            {
+                TotalWeight += Weight;
+            }
+
+            MixPhase.Name = TEXT("Mix");
+            Drive(MixPhase, -1, FPlatformTime::Seconds() + Settings.DurationSeconds, [this, &LoggedInPlayers, TotalWeight](int64 Ticket, double DueTime, FRandomStream& Random)
+            {
+                int32 Pick = Random.RandRange(0, TotalWeight - 1);
+                int32 Op = 0;
+                while (Pick >= Settings.Weights[Op])
+                {
+                    Pick -= Settings.Weights[Op];
+                    ++Op;
+                }
+
+                for (int32 Attempt = 0; Attempt < MAX_PLAYER_PICKS; ++Attempt)
+                {
+                    FLoadTestPlayer& Player = *LoggedInPlayers[Random.RandRange(0, LoggedInPlayers.Num() - 1)];
+                    bool bExpected = false;
+                    if (Player.bBusy.compare_exchange_strong(bExpected, true))
+                    {
+                        RunOp(MixPhase, static_cast<ELoadTestOp>(Op), Player, DueTime, Random);
+                        Player.bBusy.store(false);
+                        return;
+                    }
+                }
+
+                MixPhase.Skipped.fetch_add(1, std::memory_order_relaxed);
+            });
+            MixPhase.Latencies = FAwsGameKitLatencyHistograms::Get().GetSnapshot(true);
+
+            ReleasePlayers();
+            WriteReport();
+            return 0;
+        }
+
+    private:
+        bool LoadLibraries()
+        {
+            FAwsGameKitRuntimeModule& RuntimeModule = FAwsGameKitRuntimeModule::Get();
+            SessionManagerWrapper = RuntimeModule.GetSessionManagerLibrary().SessionManagerWrapper;
+            IdentityWrapper = RuntimeModule.GetIdentityLibrary().IdentityWrapper;
+            AchievementsWrapper = RuntimeModule.GetAchievementsLibrary().AchievementsWrapper;
+            GameSavingWrapper = RuntimeModule.GetGameSavingLibrary().GameSavingWrapper;
+            UserGameplayDataWrapper = RuntimeModule.GetUserGameplayDataLibrary().UserGameplayDataWrapper;
+
+            if (!SessionManagerWrapper.IsValid() || !IdentityWrapper.IsValid() || !AchievementsWrapper.IsValid() || !GameSavingWrapper.IsValid() || !UserGameplayDataWrapper.IsValid())
+            {
+                UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitLoadTest: The GameKit libraries couldn't be loaded, check the log above for the reason"));
+                return false;
+            }
+
+            // The mock backend doesn't read the config
+            if (FAwsGameKitMockBackend::Get().IsEnabled())
+            {
+                UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: Using the in-memory mock backend"));
+                return true;
+            }
+
+            if (Settings.ClientConfig.IsEmpty())
+            {
+                TArray<FString> Found;
+                FFileManagerGeneric FileManager;
+                FileManager.FindFilesRecursive(Found, *FPaths::ProjectDir(), TEXT("awsGameKitClientConfig.yml"), true, false, true);
+                if (Found.Num() > 0)
+                {
+                    Settings.ClientConfig = Found[0];
+                }
+            }
+
+            if (Settings.ClientConfig.IsEmpty() || !FPaths::FileExists(Settings.ClientConfig))
+            {
+                UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitLoadTest: No awsGameKitClientConfig.yml found, deploy the features or pass -ClientConfig=<path>"));
+                return false;
+            }
+
+            Settings.ClientConfig = FPaths::ConvertRelativePathToFull(Settings.ClientConfig);
+            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: Using %s"), *Settings.ClientConfig);
+            return true;
+        }
+
+        void CreatePlayers()
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            const FTCHARToUTF8 ClientConfig(*Settings.ClientConfig);
+
+            Players.SetNum(Settings.Players);
+            ParallelFor(Players.Num(), [this, &ClientConfig](int32 Index)
+            {
+                TUniquePtr<FLoadTestPlayer> Player = MakeUnique<FLoadTestPlayer>();
+                Player->UserName = FString::Printf(TEXT("%s%d"), *Settings.UserPrefix, Index);
+
+                Player->SessionManagerInstanceHandle = SessionManagerWrapper->GameKitSessionManagerInstanceCreate(ClientConfig.Get(), FGameKitLogging::LogCallBack);
+                Player->IdentityInstanceHandle = IdentityWrapper->GameKitIdentityInstanceCreateWithSessionManager(Player->SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+                Player->AchievementsInstanceHandle = AchievementsWrapper->GameKitAchievementsInstanceCreateWithSessionManager(Player->SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+                Player->UserGameplayDataInstanceHandle = UserGameplayDataWrapper->GameKitUserGameplayDataInstanceCreateWithSessionManager(Player->SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+                Player->GameSaving.GameSavingWrapper = GameSavingWrapper;
+                Player->GameSaving.GameSavingInstanceHandle = GameSavingWrapper->GameKitGameSavingInstanceCreateWithSessionManager(Player->SessionManagerInstanceHandle, FGameKitLogging::LogCallBack, nullptr, 0, DefaultFileActions());
+
+                if (Settings.bRetryQueue)
+                {
+                    UserGameplayDataWrapper->GameKitUserGameplayDataStartRetryBackgroundThread(Player->UserGameplayDataInstanceHandle);
+                }
+
+                // Compressible but not trivially so, like a serialized save game. RunOp() changes a few bytes before each upload so that it isn't skipped as unchanged.
+                FGameSavingSaveSlotRequest& Request = Player->SaveSlotRequest;
+                Request.SlotName = TEXT("LoadTest");
+                Request.SaveInfoFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GameKitLoadTest"), Player->UserName, TEXT("LoadTest.SaveInfo.json"));
+                Request.OverrideSync = true;
+                Request.Data.SetNumUninitialized(Settings.SaveSlotKB * 1024);
+                FRandomStream Random(Index);
+                for (int32 Byte = 0; Byte < Request.Data.Num(); ++Byte)
+                {
+                    Request.Data[Byte] = static_cast<uint8>(Byte % 64 < 48 ? Byte : Random.RandRange(0, 255));
+                }
+
+                Players[Index] = MoveTemp(Player);
+            });
+
+            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: Created the instances of %d players in %.2f s"), Players.Num(), FPlatformTime::Seconds() - StartTime);
+        }
+
+        void ReleasePlayers()
+        {
+            ParallelFor(Players.Num(), [this](int32 Index)
+            {
+                FLoadTestPlayer& Player = *Players[Index];
+                if (Settings.bRetryQueue)
+                {
+                    UserGameplayDataWrapper->GameKitUserGameplayDataStopRetryBackgroundThread(Player.UserGameplayDataInstanceHandle);
+                }
+
+                UserGameplayDataWrapper->GameKitUserGameplayDataInstanceRelease(Player.UserGameplayDataInstanceHandle);
+                GameSavingWrapper->GameKitGameSavingInstanceRelease(Player.GameSaving.GameSavingInstanceHandle);
+                AchievementsWrapper->GameKitAchievementsInstanceRelease(Player.AchievementsInstanceHandle);
+                IdentityWrapper->GameKitIdentityInstanceRelease(Player.IdentityInstanceHandle);
+                SessionManagerWrapper->GameKitSessionManagerInstanceRelease(Player.SessionManagerInstanceHandle);
+            });
+            Players.Empty();
+        }
+
+        // Runs Work for tickets 0, 1, ... each due Ticket / Rate seconds after the start, on Concurrency threads, until MaxTickets (if not negative) or EndTime is reached.
+        void Drive(FLoadTestPhase& Phase, int64 MaxTickets, double EndTime, TFunction<void(int64 Ticket, double DueTime, FRandomStream& Random)> Work)
+        {
+            std::atomic<int64> NextTicket{ 0 };
+            Phase.StartTime = FPlatformTime::Seconds();
+
+            TArray<TFuture<void>> Drivers;
+            for (int32 Driver = 0; Driver < Settings.Concurrency; ++Driver)
+            {
+                Drivers.Add(Async(EAsyncExecution::Thread, [this, &Phase, &NextTicket, &Work, MaxTickets, EndTime, Driver]()
+                {
+                    FRandomStream Random(Driver);
+                    for (;;)
+                    {
+                        const int64 Ticket = NextTicket.fetch_add(1);
+                        const double DueTime = Phase.StartTime + Ticket / Settings.Rate;
+                        if ((MaxTickets >= 0 && Ticket >= MaxTickets) || DueTime >= EndTime)
+                        {
+                            return;
+                        }
+
+                        const double Wait = DueTime - FPlatformTime::Seconds();
+                        if (Wait > 0.0)
+                        {
+                            FPlatformProcess::SleepNoStats(static_cast<float>(Wait));
+                        }
+                        Work(Ticket, DueTime, Random);
+                    }
+                }));
+            }
+
+            double NextProgressTime = Phase.StartTime + PROGRESS_INTERVAL_SECONDS;
+            for (const TFuture<void>& Driver : Drivers)
+            {
+                while (!Driver.WaitFor(FTimespan::FromSeconds(1.0)))
+                {
+                    const double Now = FPlatformTime::Seconds();
+                    if (Now >= NextProgressTime)
+                    {
+                        UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %s: %.0f s, %lld calls, %lld errors, %lld skipped"),
+                            *Phase.Name, Now - Phase.StartTime, Phase.TotalCalls(), Phase.TotalErrors(), Phase.Skipped.load());
+                        NextProgressTime += PROGRESS_INTERVAL_SECONDS;
+                    }
+                }
+            }
+
+            Phase.DurationSeconds = FPlatformTime::Seconds() - Phase.StartTime;
+        }
+
+        // Runs one operation for the player, which must not be running another one, and records it. Returns whether it succeeded.
+        bool RunOp(FLoadTestPhase& Phase, ELoadTestOp Op, FLoadTestPlayer& Player, double DueTime, FRandomStream& Random)
+        {
+            unsigned int Status = GameKit::GAMEKIT_SUCCESS;
+            switch (Op)
+            {
+            case ELoadTestOp::Login:
+            {
+                FAwsGameKitInternalTempStrings ConvertString;
+                UserLogin wrapperArgs
+                {
+                    ConvertString(Player.UserName),
+                    ConvertString(Settings.Password),
+                };
+                Status = IdentityWrapper->GameKitIdentityLogin(Player.IdentityInstanceHandle, wrapperArgs);
+                break;
+            }
+            case ELoadTestOp::ListAchievements:
+            {
+                // Every page is fetched, as AwsGameKitAchievements::ListAchievementsForPlayer() does, but not parsed
+                int32 Pages = 0;
+                Status = AchievementsWrapper->GameKitListAchievements(Player.AchievementsInstanceHandle, LIST_ACHIEVEMENTS_PAGE_SIZE, true, &Pages,
+                    [](DISPATCH_RECEIVER_HANDLE Receiver, const char*) { ++*static_cast<int32*>(Receiver); });
+                break;
+            }
+            case ELoadTestOp::UpdateItem:
+            {
+                for (int32 Item = 0; Item < Settings.Burst && Status == GameKit::GAMEKIT_SUCCESS; ++Item)
+                {
+                    FAwsGameKitInternalTempStrings ConvertString;
+                    UserGameplayDataBundleItemValue wrapperArgs
+                    {
+                        ConvertString(FString(LOAD_TEST_BUNDLE_NAME)),
+                        ConvertString(FString::Printf(TEXT("item_%d"), Item)),
+                        ConvertString(FString::FromInt(Random.RandRange(0, MAX_int32 - 1)))
+                    };
+                    Status = UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(Player.UserGameplayDataInstanceHandle, wrapperArgs);
+                }
+                break;
+            }
+            case ELoadTestOp::SaveSlot:
+            {
+                TArray<uint8>& Data = Player.SaveSlotRequest.Data;
+                if (Data.Num() > 0)
+                {
+                    Data[Random.RandRange(0, Data.Num() - 1)] ^= 0xFF;
+                }
+
+                FGameSavingSlotActionResults Results;
+                Status = InternalAwsGameKitSaveSlot(Player.GameSaving, Player.SaveSlotRequest, Results);
+                break;
+            }
+            default:
+                break;
+            }
+
+            const int32 OpIndex = static_cast<int32>(Op);
+            FAwsGameKitLatencyHistograms::Get().Record(LatencyNames[OpIndex], FPlatformTime::Seconds() - DueTime);
+            Phase.Calls[OpIndex].fetch_add(1, std::memory_order_relaxed);
+
+            if (Status != GameKit::GAMEKIT_SUCCESS)
+            {
+                Phase.Errors[OpIndex].fetch_add(1, std::memory_order_relaxed);
+                FScopeLock Lock(&Phase.ErrorCodesMutex);
+                Phase.ErrorCodes.FindOrAdd(Status)++;
+                return false;
+            }
+            return true;
+        }
+
+        void LogPhase(const FLoadTestPhase& Phase) const
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %s: %lld calls in %.1f s (%.1f/s), %lld errors, %lld skipped because every picked player was busy"),
+                *Phase.Name, Phase.TotalCalls(), Phase.DurationSeconds, Phase.DurationSeconds > 0.0 ? Phase.TotalCalls() / Phase.DurationSeconds : 0.0, Phase.TotalErrors(), Phase.Skipped.load());
+
+            for (int32 Op = 0; Op < NUM_OPS; ++Op)
+            {
+                const int64 Calls = Phase.Calls[Op].load();
+                if (Calls > 0)
+                {
+                    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %s: %s: %lld calls, %.2f%% errors"), *Phase.Name, OP_NAMES[Op], Calls, 100.0 * Phase.Errors[Op].load() / Calls);
+                }
+            }
+
+            for (const TPair<uint32, int64>& ErrorCode : Phase.ErrorCodes)
+            {
+                UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %s: %s x %lld"), *Phase.Name, *GameKit::StatusCodeToHexFStr(ErrorCode.Key), ErrorCode.Value);
+            }
+
+            for (const FAwsGameKitLatencySnapshot& Latency : Phase.Latencies)
+            {
+                UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %s: %s (%s): %lld samples, mean %.1f ms, p50 %.1f ms, p90 %.1f ms, p99 %.1f ms, max %.1f ms"),
+                    *Phase.Name, *Latency.Operation, *Latency.NetworkType, Latency.Count, Latency.MeanMs, Latency.P50Ms, Latency.P90Ms, Latency.P99Ms, Latency.MaxMs);
+            }
+        }
+
+        void WritePhase(TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>& Writer, const FLoadTestPhase& Phase) const
+        {
+            Writer.WriteObjectStart();
+            Writer.WriteValue(TEXT("name"), Phase.Name);
+            Writer.WriteValue(TEXT("durationSeconds"), Phase.DurationSeconds);
+            Writer.WriteValue(TEXT("skipped"), Phase.Skipped.load());
+
+            Writer.WriteArrayStart(TEXT("operations"));
+            for (int32 Op = 0; Op < NUM_OPS; ++Op)
+            {
+                const int64 Calls = Phase.Calls[Op].load();
+                const int64 Errors = Phase.Errors[Op].load();
+                Writer.WriteObjectStart();
+                Writer.WriteValue(TEXT("name"), OP_NAMES[Op]);
+                Writer.WriteValue(TEXT("calls"), Calls);
+                Writer.WriteValue(TEXT("errors"), Errors);
+                Writer.WriteValue(TEXT("errorRate"), Calls > 0 ? static_cast<double>(Errors) / Calls : 0.0);
+                Writer.WriteValue(TEXT("throughput"), Phase.DurationSeconds > 0.0 ? Calls / Phase.DurationSeconds : 0.0);
+                Writer.WriteObjectEnd();
+            }
+            Writer.WriteArrayEnd();
+
+            Writer.WriteObjectStart(TEXT("errorCodes"));
+            for (const TPair<uint32, int64>& ErrorCode : Phase.ErrorCodes)
+            {
+                Writer.WriteValue(GameKit::StatusCodeToHexFStr(ErrorCode.Key), ErrorCode.Value);
+            }
+            Writer.WriteObjectEnd();
+
+            Writer.WriteArrayStart(TEXT("latency"));
+            for (const FAwsGameKitLatencySnapshot& Latency : Phase.Latencies)
+            {
+                Writer.WriteObjectStart();
+                Writer.WriteValue(TEXT("operation"), Latency.Operation);
+                Writer.WriteValue(TEXT("networkType"), Latency.NetworkType);
+                Writer.WriteValue(TEXT("count"), Latency.Count);
+                Writer.WriteValue(TEXT("meanMs"), Latency.MeanMs);
+                Writer.WriteValue(TEXT("p50Ms"), Latency.P50Ms);
+                Writer.WriteValue(TEXT("p90Ms"), Latency.P90Ms);
+                Writer.WriteValue(TEXT("p99Ms"), Latency.P99Ms);
+                Writer.WriteValue(TEXT("maxMs"), Latency.MaxMs);
+                Writer.WriteObjectEnd();
+            }
+            Writer.WriteArrayEnd();
+            Writer.WriteObjectEnd();
+        }
+
+        void WriteReport() const
+        {
+            LogPhase(LoginPhase);
+            if (!MixPhase.Name.IsEmpty())
+            {
+                LogPhase(MixPhase);
+            }
+
+            FString Json;
+            const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+            const FDateTime Now = FDateTime::UtcNow();
+
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("timestamp"), Now.ToIso8601());
+            Writer->WriteValue(TEXT("players"), Settings.Players);
+            Writer->WriteValue(TEXT("rate"), Settings.Rate);
+            Writer->WriteValue(TEXT("durationSeconds"), Settings.DurationSeconds);
+            Writer->WriteValue(TEXT("concurrency"), Settings.Concurrency);
+            Writer->WriteValue(TEXT("burst"), Settings.Burst);
+            Writer->WriteValue(TEXT("saveSlotKB"), Settings.SaveSlotKB);
+            Writer->WriteValue(TEXT("retryQueue"), Settings.bRetryQueue);
+            Writer->WriteObjectStart(TEXT("mix"));
+            for (int32 Op = 0; Op < NUM_OPS; ++Op)
+            {
+                Writer->WriteValue(OP_NAMES[Op], Settings.Weights[Op]);
+            }
+            Writer->WriteObjectEnd();
+            Writer->WriteArrayStart(TEXT("phases"));
+            WritePhase(*Writer, LoginPhase);
+            if (!MixPhase.Name.IsEmpty())
+            {
+                WritePhase(*Writer, MixPhase);
+            }
+            Writer->WriteArrayEnd();
+            Writer->WriteObjectEnd();
+            Writer->Close();
+
+            const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("GameKitLoadTest"), FString::Printf(TEXT("GameKitLoadTest-%s.json"), *Now.ToString()));
+            if (FFileHelper::SaveStringToFile(Json, *FilePath))
+            {
+                UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: Wrote the report to %s"), *FilePath);
+            }
+            else
+            {
+                UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitLoadTest: Failed to write the report to %s"), *FilePath);
+            }
+        }
+
+        FLoadTestSettings Settings;
+        FName LatencyNames[NUM_OPS];
+
+        TSharedPtr<AwsGameKitSessionManagerWrapper> SessionManagerWrapper;
+        TSharedPtr<AwsGameKitIdentityWrapper> IdentityWrapper;
+        TSharedPtr<AwsGameKitAchievementsWrapper> AchievementsWrapper;
+        TSharedPtr<AwsGameKitGameSavingWrapper> GameSavingWrapper;
+        TSharedPtr<AwsGameKitUserGameplayDataWrapper> UserGameplayDataWrapper;
+
+        TArray<TUniquePtr<FLoadTestPlayer>> Players;
+        FLoadTestPhase LoginPhase;
+        FLoadTestPhase MixPhase;
+    };
+
+    bool ParseMix(const FString& Mix, int32 (&OutWeights)[NUM_OPS])
+    {
+        int32 Weights[NUM_OPS] = {};
+        TArray<FString> Entries;
+        Mix.ParseIntoArray(Entries, TEXT(","));
+        for (const FString& Entry : Entries)
+        {
+            FString Name;
+            FString Weight;
+            if (!Entry.Split(TEXT(":"), &Name, &Weight))
+            {
+                return false;
+            }
+
+            int32 Op = 0;
+            while (Op < NUM_OPS && !Name.TrimStartAndEnd().Equals(OP_NAMES[Op], ESearchCase::IgnoreCase))
+            {
+                ++Op;
+            }
+            if (Op == NUM_OPS)
+            {
+                return false;
+            }
+            Weights[Op] = FMath::Max(0, FCString::Atoi(*Weight));
+        }
+
+        int32 TotalWeight = 0;
+        for (int32 Op = 0; Op < NUM_OPS; ++Op)
+        {
+            TotalWeight += Weights[Op];
+        }
+        if (TotalWeight == 0)
+        {
+            return false;
+        }
+
+        FMemory::Memcpy(OutWeights, Weights, sizeof(Weights));
+        return true;
+    }
+}
+
+UAwsGameKitLoadTestCommandlet::UAwsGameKitLoadTestCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+    ShowErrorCount = true;
+    HelpDescription = TEXT("Generates load against a deployed GameKit backend from simulated players, see AwsGameKitLoadTestCommandlet.h for the options.");
+}
+
+int32 UAwsGameKitLoadTestCommandlet::Main(const FString& Params)
+{
+    FLoadTestSettings Settings;
+    FParse::Value(*Params, TEXT("Players="), Settings.Players);
+    FParse::Value(*Params, TEXT("UserPrefix="), Settings.UserPrefix);
+    FParse::Value(*Params, TEXT("Password="), Settings.Password);
+    FParse::Value(*Params, TEXT("ClientConfig="), Settings.ClientConfig);
+    FParse::Value(*Params, TEXT("Rate="), Settings.Rate);
+    FParse::Value(*Params, TEXT("Duration="), Settings.DurationSeconds);
+    FParse::Value(*Params, TEXT("Concurrency="), Settings.Concurrency);
+    FParse::Value(*Params, TEXT("Burst="), Settings.Burst);
+    FParse::Value(*Params, TEXT("SaveSlotKB="), Settings.SaveSlotKB);
+    Settings.bRetryQueue = FParse::Param(*Params, TEXT("RetryQueue"));
+
+    FString Mix;
+    if (FParse::Value(*Params, TEXT("Mix="), Mix, false) && !ParseMix(Mix, Settings.Weights))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitLoadTest: Invalid -Mix=%s, expected Op:Weight,... with Op one of Login, ListAchievements, UpdateItem and SaveSlot"), *Mix);
+        return 1;
+    }
+
+    if (Settings.Password.IsEmpty())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitLoadTest: -Password=<password> of the simulated users is required"));
+        return 1;
+    }
+
+    Settings.Players = FMath::Max(1, Settings.Players);
+    Settings.Rate = FMath::Max(0.001, Settings.Rate);
+    Settings.DurationSeconds = FMath::Max(0.0, Settings.DurationSeconds);
+    Settings.Concurrency = FMath::Clamp(Settings.Concurrency, 1, 1024);
+    Settings.Burst = FMath::Max(1, Settings.Burst);
+    Settings.SaveSlotKB = FMath::Max(0, Settings.SaveSlotKB);
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitLoadTest: %d players, %.1f operations/s for %.0f s on %d threads"), Settings.Players, Settings.Rate, Settings.DurationSeconds, Settings.Concurrency);
+    return FAwsGameKitLoadTest(Settings).Run();
+}
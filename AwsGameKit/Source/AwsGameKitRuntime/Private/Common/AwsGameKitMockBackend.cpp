@@ -0,0 +1,131 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitMockBackend.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitMockWrappers.h"
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarGameKitMockBackendLatencyMs(
+    TEXT("GameKit.MockBackend.LatencyMs"),
+    0.0f,
+    TEXT("Latency of every GameKit backend call answered by the mock backend (-GameKitMockBackend), in milliseconds.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitMockBackendLatencyJitterMs(
+    TEXT("GameKit.MockBackend.LatencyJitterMs"),
+    0.0f,
+    TEXT("The latency of each mock backend call is GameKit.MockBackend.LatencyMs plus or minus up to this many milliseconds, picked uniformly.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitMockBackendErrorRate(
+    TEXT("GameKit.MockBackend.ErrorRate"),
+    0.0f,
+    TEXT("Probability, from 0 to 1, that a mock backend call fails with GameKit.MockBackend.ErrorCode.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitMockBackendErrorCode(
+    TEXT("GameKit.MockBackend.ErrorCode"),
+    static_cast<int32>(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED),
+    TEXT("The GameKit status code of the errors injected by GameKit.MockBackend.ErrorRate. GAMEKIT_ERROR_HTTP_REQUEST_FAILED by default.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarGameKitMockBackendErrorApis(
+    TEXT("GameKit.MockBackend.ErrorApis"),
+    TEXT(""),
+    TEXT("If set, errors are only injected into the mock backend calls whose GameKit API name contains this, for example UserGameplayData or GameKitSaveSlot.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitMockBackendMaxCallsPerSecond(
+    TEXT("GameKit.MockBackend.MaxCallsPerSecond"),
+    0,
+    TEXT("Calls beyond this many per second, across all features, fail with GAMEKIT_ERROR_HTTP_REQUEST_FAILED as if throttled. 0 for no limit.\n"),
+    ECVF_Default);
+
+FAwsGameKitMockBackend& FAwsGameKitMockBackend::Get()
+{
+    static FAwsGameKitMockBackend Instance;
+    return Instance;
+}
+
+void FAwsGameKitMockBackend::Startup()
+{
+    bEnabled = FParse::Param(FCommandLine::Get(), TEXT("GameKitMockBackend"));
+    if (bEnabled)
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitMockBackend::Startup(): The GameKit features run against the in-memory mock backend, no call reaches AWS"));
+    }
+}
+
+void FAwsGameKitMockBackend::Shutdown()
+{
+    if (Calls.load() > 0)
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitMockBackend::Shutdown(): Answered %lld calls, %lld throttled, %lld failed by error injection"),
+            Calls.load(), ThrottledCalls.load(), InjectedErrors.load());
+    }
+}
+
+FAwsGameKitWrapperFactories FAwsGameKitMockBackend::MakeWrapperFactories()
+{
+    FAwsGameKitWrapperFactories Factories;
+    Factories.Identity = []() -> TSharedPtr<AwsGameKitIdentityWrapper> { return MakeShared<AwsGameKitMockIdentityWrapper>(); };
+    Factories.Achievements = []() -> TSharedPtr<AwsGameKitAchievementsWrapper> { return MakeShared<AwsGameKitMockAchievementsWrapper>(); };
+    Factories.GameSaving = []() -> TSharedPtr<AwsGameKitGameSavingWrapper> { return MakeShared<AwsGameKitMockGameSavingWrapper>(); };
+    Factories.UserGameplayData = []() -> TSharedPtr<AwsGameKitUserGameplayDataWrapper> { return MakeShared<AwsGameKitMockUserGameplayDataWrapper>(); };
+    return Factories;
+}
+
+unsigned int FAwsGameKitMockBackend::SimulateCall(const TCHAR* Api)
+{
+    thread_local FRandomStream Random(static_cast<int32>(FPlatformTime::Cycles()));
+
+    Calls.fetch_add(1, std::memory_order_relaxed);
+
+    const float LatencyMs = FMath::Max(0.0f, CVarGameKitMockBackendLatencyMs.GetValueOnAnyThread());
+    const float JitterMs = FMath::Max(0.0f, CVarGameKitMockBackendLatencyJitterMs.GetValueOnAnyThread());
+    const float SleepMs = FMath::Max(0.0f, LatencyMs + (JitterMs > 0.0f ? Random.FRandRange(-JitterMs, JitterMs) : 0.0f));
+    if (SleepMs > 0.0f)
+    {
+        FPlatformProcess::SleepNoStats(SleepMs / 1000.0f);
+    }
+
+    const int32 MaxCallsPerSecond = CVarGameKitMockBackendMaxCallsPerSecond.GetValueOnAnyThread();
+    if (MaxCallsPerSecond > 0)
+    {
+        FScopeLock Lock(&ThrottleMutex);
+        const double Now = FPlatformTime::Seconds();
+        ThrottleTokens = FMath::Min<double>(MaxCallsPerSecond, ThrottleTokens + (Now - ThrottleRefillTime) * MaxCallsPerSecond);
+        ThrottleRefillTime = Now;
+        if (ThrottleTokens < 1.0)
+        {
+            ThrottledCalls.fetch_add(1, std::memory_order_relaxed);
+            return GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED;
+        }
+        ThrottleTokens -= 1.0;
+    }
+
+    const float ErrorRate = CVarGameKitMockBackendErrorRate.GetValueOnAnyThread();
+    if (ErrorRate > 0.0f && Random.FRand() < ErrorRate)
+    {
+        const FString ErrorApis = CVarGameKitMockBackendErrorApis.GetValueOnAnyThread();
+        if (ErrorApis.IsEmpty() || FCString::Stristr(Api, *ErrorApis) != nullptr)
+        {
+            InjectedErrors.fetch_add(1, std::memory_order_relaxed);
+            return static_cast<unsigned int>(CVarGameKitMockBackendErrorCode.GetValueOnAnyThread());
+        }
+    }
+
+    return GameKit::GAMEKIT_SUCCESS;
+}
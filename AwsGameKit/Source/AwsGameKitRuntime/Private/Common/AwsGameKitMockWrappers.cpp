@@ -0,0 +1,684 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitMockWrappers.h"
+
+// GameKit
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitMockBackend.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Models/AwsGameKitGameSavingModels.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitMockBackendAchievements(
+    TEXT("GameKit.MockBackend.Achievements"),
+    100,
+    TEXT("Number of achievements of the mock backend (-GameKitMockBackend). Read when the Achievements instance is created.\n"),
+    ECVF_Default);
+
+// Counts the call like the real wrappers do, then returns early if the mock backend throttles it or injects an error. No callback is made in that case.
+#define SIMULATE_BACKEND_CALL(Feature, Api) \
+    AWSGAMEKIT_LLM_SCOPE(Feature); \
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Feature, TEXT(#Api)); \
+    if (const unsigned int simulatedStatus = FAwsGameKitMockBackend::Get().SimulateCall(TEXT(#Api))) \
+    { \
+        return RecordResult(EAwsGameKitStatsFeature::Feature, simulatedStatus); \
+    }
+
+namespace
+{
+    const TCHAR* MOCK_ACHIEVEMENT_ID_PREFIX = TEXT("achievement_");
+
+    FString ToFString(const char* Str)
+    {
+        return Str != nullptr ? FString(UTF8_TO_TCHAR(Str)) : FString();
+    }
+
+    // The User Gameplay Data circuit breaker sees the results of the mock calls like those of the real ones
+    unsigned int RecordResult(EAwsGameKitStatsFeature Feature, unsigned int Result)
+    {
+        if (Feature == EAwsGameKitStatsFeature::UserGameplayData)
+        {
+            FAwsGameKitUserGameplayDataCircuitBreaker::Get().RecordResult(Result);
+        }
+        return Result;
+    }
+
+    template <typename InstanceType>
+    InstanceType& GetInstance(void* instanceHandle)
+    {
+        check(instanceHandle != nullptr);
+        return *static_cast<InstanceType*>(instanceHandle);
+    }
+
+    struct FMockIdentityInstance
+    {
+        FCriticalSection Mutex;
+        FString UserName;
+        FString CreatedAt;
+    };
+
+    struct FMockAchievementProgress
+    {
+        int32 CurrentValue = 0;
+        FString UpdatedAt;
+        FString EarnedAt;
+    };
+
+    struct FMockAchievementsInstance
+    {
+        FCriticalSection Mutex;
+        int32 NumAchievements = 0;
+        TMap<int32, FMockAchievementProgress> Progress;
+
+        // achievement_<Index>
+        bool ParseAchievementId(const char* achievementId, int32& OutIndex) const
+        {
+            const FString Id = ToFString(achievementId);
+            const FString Number = Id.RightChop(FCString::Strlen(MOCK_ACHIEVEMENT_ID_PREFIX));
+            if (!Id.StartsWith(MOCK_ACHIEVEMENT_ID_PREFIX, ESearchCase::CaseSensitive) || Number.IsEmpty() || !Number.IsNumeric())
+            {
+                return false;
+            }
+
+            OutIndex = FCString::Atoi(*Number);
+            return OutIndex >= 0 && OutIndex < NumAchievements;
+        }
+
+        FString ToJson(int32 Index, bool bNewlyEarned) const
+        {
+            const FMockAchievementProgress* Found = Progress.Find(Index);
+            const FMockAchievementProgress& Achievement = Found != nullptr ? *Found : FMockAchievementProgress();
+            const int32 MaxValue = 1 + Index % 10;
+            return FString::Printf(TEXT("{\"achievement_id\":\"%s%d\",\"title\":\"Achievement %d\",\"locked_description\":\"Do the thing %d times\",")
+                TEXT("\"unlocked_description\":\"You did the thing\",\"locked_icon_url\":\"\",\"unlocked_icon_url\":\"\",\"max_value\":%d,\"points\":10,")
+                TEXT("\"order_number\":%d,\"current_value\":%d,\"is_secret\":false,\"is_hidden\":false,\"earned\":%s,\"newly_earned\":%s,")
+                TEXT("\"updated_at\":\"%s\",\"earned_at\":\"%s\"}"),
+                MOCK_ACHIEVEMENT_ID_PREFIX, Index, Index, MaxValue, MaxValue, Index, Achievement.CurrentValue,
+                Achievement.CurrentValue >= MaxValue ? TEXT("true") : TEXT("false"), bNewlyEarned ? TEXT("true") : TEXT("false"),
+                *Achievement.UpdatedAt, *Achievement.EarnedAt);
+        }
+    };
+
+    struct FMockUserGameplayDataInstance
+    {
+        FCriticalSection Mutex;
+        TMap<FString, TMap<FString, FString>> Bundles;
+    };
+
+    struct FMockSlot
+    {
+        FString Metadata;
+        TArray<uint8> Data;
+        int64 LastModified = 0;
+    };
+
+    struct FMockGameSavingInstance
+    {
+        FCriticalSection Mutex;
+        TMap<FString, FMockSlot> Slots;
+    };
+
+    // The plain C slots passed to the Game Saving callbacks: every slot of the instance, and the slot acted on. The strings live as long as this object.
+    class FMockSlotResponse
+    {
+    public:
+        FMockSlotResponse(const FMockGameSavingInstance& Instance, const FString& SlotName)
+        {
+            CachedSlots.Reserve(Instance.Slots.Num());
+            for (const TPair<FString, FMockSlot>& Pair : Instance.Slots)
+            {
+                CachedSlots.Add(ToSlot(Pair.Key, Pair.Value));
+            }
+
+            // A slot which doesn't exist is passed with its name only
+            const FMockSlot* ActedOn = Instance.Slots.Find(SlotName);
+            ActedOnSlot = ToSlot(SlotName, ActedOn != nullptr ? *ActedOn : FMockSlot());
+        }
+
+        const Slot* GetCachedSlots() const
+        {
+            return CachedSlots.GetData();
+        }
+
+        unsigned int GetSlotCount() const
+        {
+            return static_cast<unsigned int>(CachedSlots.Num());
+        }
+
+        const Slot* GetSlot() const
+        {
+            return &ActedOnSlot;
+        }
+
+    private:
+        Slot ToSlot(const FString& SlotName, const FMockSlot& MockSlot)
+        {
+            // The mock cloud is the local copy, so every slot is in sync
+            Slot slot{};
+            slot.slotName = ConvertString(SlotName);
+            slot.metadataLocal = ConvertString(MockSlot.Metadata);
+            slot.metadataCloud = slot.metadataLocal;
+            slot.sizeLocal = MockSlot.Data.Num();
+            slot.sizeCloud = MockSlot.Data.Num();
+            slot.lastModifiedLocal = MockSlot.LastModified;
+            slot.lastModifiedCloud = MockSlot.LastModified;
+            slot.lastSync = MockSlot.LastModified;
+            slot.slotSyncStatus = static_cast<decltype(slot.slotSyncStatus)>(SlotSyncStatus_E::SYNCED);
+            return slot;
+        }
+
+        FAwsGameKitInternalTempStrings ConvertString;
+        TArray<Slot> CachedSlots;
+        Slot ActedOnSlot{};
+    };
+
+    FString NowIso8601()
+    {
+        return FDateTime::UtcNow().ToIso8601();
+    }
+}
+
+// ------ Identity ------
+
+bool AwsGameKitMockIdentityWrapper::Initialize()
+{
+    return true;
+}
+
+GAMEKIT_IDENTITY_INSTANCE_HANDLE AwsGameKitMockIdentityWrapper::GameKitIdentityInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
+{
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    return new FMockIdentityInstance();
+}
+
+void AwsGameKitMockIdentityWrapper::GameKitIdentityInstanceRelease(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
+{
+    delete static_cast<FMockIdentityInstance*>(identityInstance);
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityRegister(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserRegistration userRegistration)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityRegister);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityConfirmRegistration(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmRegistrationRequest request)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityConfirmRegistration);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityResendConfirmationCode(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ResendConfirmationCodeRequest request)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityResendConfirmationCode);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityLogin(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserLogin userLogin)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityLogin);
+
+    const FString UserName = ToFString(userLogin.userName);
+    if (UserName.IsEmpty())
+    {
+        return GameKit::GAMEKIT_ERROR_MALFORMED_USERNAME;
+    }
+    if (ToFString(userLogin.password).IsEmpty())
+    {
+        return GameKit::GAMEKIT_ERROR_MALFORMED_PASSWORD;
+    }
+
+    FMockIdentityInstance& Instance = GetInstance<FMockIdentityInstance>(identityInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    Instance.UserName = UserName;
+    Instance.CreatedAt = NowIso8601();
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityLogout(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityLogout);
+
+    FMockIdentityInstance& Instance = GetInstance<FMockIdentityInstance>(identityInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    Instance.UserName.Reset();
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityGetUser(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, DISPATCH_RECEIVER_HANDLE dispatchReceiver, FuncIdentityGetUserResponseCallback responseCallback)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityGetUser);
+
+    FMockIdentityInstance& Instance = GetInstance<FMockIdentityInstance>(identityInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    if (Instance.UserName.IsEmpty())
+    {
+        return GameKit::GAMEKIT_ERROR_NO_ID_TOKEN;
+    }
+
+    FAwsGameKitInternalTempStrings ConvertString;
+    GetUserResponse response{};
+    response.userId = ConvertString(TEXT("mock-") + Instance.UserName);
+    response.createdAt = ConvertString(Instance.CreatedAt);
+    response.updatedAt = response.createdAt;
+    response.facebookExternalId = "";
+    response.facebookRefId = "";
+    response.userName = ConvertString(Instance.UserName);
+    response.email = ConvertString(Instance.UserName + TEXT("@example.com"));
+    responseCallback(dispatchReceiver, &response);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ForgotPasswordRequest request)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityForgotPassword);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitIdentityConfirmForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmForgotPasswordRequest request)
+{
+    SIMULATE_BACKEND_CALL(Identity, GameKitIdentityConfirmForgotPassword);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitGetFederatedLoginUrl(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, DISPATCH_RECEIVER_HANDLE dispatchReceiver, KeyValueCharPtrCallbackDispatcher responseCallback)
+{
+    return GameKit::GAMEKIT_ERROR_METHOD_NOT_IMPLEMENTED;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitPollAndRetrieveFederatedTokens(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, const char* requestId, int timeout)
+{
+    return GameKit::GAMEKIT_ERROR_METHOD_NOT_IMPLEMENTED;
+}
+
+unsigned int AwsGameKitMockIdentityWrapper::GameKitGetFederatedIdToken(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, DISPATCH_RECEIVER_HANDLE dispatchReceiver, CharPtrCallback responseCallback)
+{
+    return GameKit::GAMEKIT_ERROR_METHOD_NOT_IMPLEMENTED;
+}
+
+// ------ Achievements ------
+
+bool AwsGameKitMockAchievementsWrapper::Initialize()
+{
+    return true;
+}
+
+GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE AwsGameKitMockAchievementsWrapper::GameKitAchievementsInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
+{
+    AWSGAMEKIT_LLM_SCOPE(Achievements);
+    FMockAchievementsInstance* Instance = new FMockAchievementsInstance();
+    Instance->NumAchievements = FMath::Max(0, CVarGameKitMockBackendAchievements.GetValueOnAnyThread());
+    return Instance;
+}
+
+void AwsGameKitMockAchievementsWrapper::GameKitAchievementsInstanceRelease(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance)
+{
+    delete static_cast<FMockAchievementsInstance*>(achievementsInstance);
+}
+
+unsigned int AwsGameKitMockAchievementsWrapper::GameKitListAchievements(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, unsigned int pageSize, bool waitForAllPages, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    SIMULATE_BACKEND_CALL(Achievements, GameKitListAchievements);
+
+    FMockAchievementsInstance& Instance = GetInstance<FMockAchievementsInstance>(achievementsInstance);
+    FScopeLock Lock(&Instance.Mutex);
+
+    // Like the backend, pages hold at most 100 achievements, and waiting for all pages still answers page by page
+    const int32 PageSize = pageSize == 0 ? 100 : FMath::Min<int32>(pageSize, 100);
+    for (int32 First = 0; First < Instance.NumAchievements; First += PageSize)
+    {
+        const int32 End = FMath::Min(First + PageSize, Instance.NumAchievements);
+        FString Page = TEXT("{\"data\":{\"achievements\":[");
+        for (int32 Index = First; Index < End; ++Index)
+        {
+            if (Index > First)
+            {
+                Page += TEXT(",");
+            }
+            Page += Instance.ToJson(Index, false);
+        }
+        Page += End < Instance.NumAchievements
+            ? FString::Printf(TEXT("]},\"paging\":{\"next_start_key\":{\"achievement_id\":\"%s%d\"}}}"), MOCK_ACHIEVEMENT_ID_PREFIX, End)
+            : FString(TEXT("]},\"paging\":{\"next_start_key\":null}}"));
+
+        responseCallback(receiver, TCHAR_TO_UTF8(*Page));
+    }
+
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockAchievementsWrapper::GameKitUpdateAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, unsigned int incrementBy, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    SIMULATE_BACKEND_CALL(Achievements, GameKitUpdateAchievement);
+
+    FMockAchievementsInstance& Instance = GetInstance<FMockAchievementsInstance>(achievementsInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    int32 Index = 0;
+    if (!Instance.ParseAchievementId(achievementId, Index))
+    {
+        return GameKit::GAMEKIT_ERROR_ACHIEVEMENTS_INVALID_ID;
+    }
+
+    const int32 MaxValue = 1 + Index % 10;
+    FMockAchievementProgress& Achievement = Instance.Progress.FindOrAdd(Index);
+    const bool bWasEarned = Achievement.CurrentValue >= MaxValue;
+    Achievement.CurrentValue = static_cast<int32>(FMath::Min<int64>(MaxValue, static_cast<int64>(Achievement.CurrentValue) + incrementBy));
+    Achievement.UpdatedAt = NowIso8601();
+    const bool bNewlyEarned = !bWasEarned && Achievement.CurrentValue >= MaxValue;
+    if (bNewlyEarned)
+    {
+        Achievement.EarnedAt = Achievement.UpdatedAt;
+    }
+
+    const FString Response = FString::Printf(TEXT("{\"data\":%s}"), *Instance.ToJson(Index, bNewlyEarned));
+    responseCallback(receiver, TCHAR_TO_UTF8(*Response));
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockAchievementsWrapper::GameKitGetAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    SIMULATE_BACKEND_CALL(Achievements, GameKitGetAchievement);
+
+    FMockAchievementsInstance& Instance = GetInstance<FMockAchievementsInstance>(achievementsInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    int32 Index = 0;
+    if (!Instance.ParseAchievementId(achievementId, Index))
+    {
+        return GameKit::GAMEKIT_ERROR_ACHIEVEMENTS_INVALID_ID;
+    }
+
+    const FString Response = FString::Printf(TEXT("{\"data\":%s}"), *Instance.ToJson(Index, false));
+    responseCallback(receiver, TCHAR_TO_UTF8(*Response));
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockAchievementsWrapper::GameKitGetAchievementIconsBaseUrl(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const DISPATCH_RECEIVER_HANDLE dispatchReceiver, const CharPtrCallback responseCallback)
+{
+    responseCallback(dispatchReceiver, "");
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+// ------ User Gameplay Data ------
+
+bool AwsGameKitMockUserGameplayDataWrapper::Initialize()
+{
+    return true;
+}
+
+GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    return new FMockUserGameplayDataInstance();
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitSetUserGameplayDataClientSettings(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataClientSettings settings)
+{
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataInstanceRelease(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+    delete static_cast<FMockUserGameplayDataInstance*>(userGameplayDataInstance);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitAddUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutUnprocessedItems, UserGameplayDataBundle userGameplayDataBundle)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitAddUserGameplayData);
+
+    const FString BundleName = ToFString(userGameplayDataBundle.bundleName);
+    if (BundleName.IsEmpty())
+    {
+        return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME);
+    }
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    TMap<FString, FString>& Bundle = Instance.Bundles.FindOrAdd(BundleName);
+    for (unsigned int i = 0; i < userGameplayDataBundle.numKeys; ++i)
+    {
+        Bundle.Add(ToFString(userGameplayDataBundle.bundleItemKeys[i]), ToFString(userGameplayDataBundle.bundleItemValues[i]));
+    }
+
+    inOutUnprocessedItems.Reset();
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitListUserGameplayDataBundles);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    for (const TPair<FString, TMap<FString, FString>>& Bundle : Instance.Bundles)
+    {
+        onBundle(TCHAR_TO_UTF8(*Bundle.Key));
+    }
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitGetUserGameplayDataBundle);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    if (const TMap<FString, FString>* Bundle = Instance.Bundles.Find(ToFString(bundleName)))
+    {
+        for (const TPair<FString, FString>& Item : *Bundle)
+        {
+            onItem(TCHAR_TO_UTF8(*Item.Key), TCHAR_TO_UTF8(*Item.Value));
+        }
+    }
+
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, FString& inOutData, UserGameplayDataBundleItem userGameplayDataBundleItem)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitGetUserGameplayDataBundleItem);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    const TMap<FString, FString>* Bundle = Instance.Bundles.Find(ToFString(userGameplayDataBundleItem.bundleName));
+    const FString* Value = Bundle != nullptr ? Bundle->Find(ToFString(userGameplayDataBundleItem.bundleItemKey)) : nullptr;
+    if (Value == nullptr)
+    {
+        return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_FAILED);
+    }
+
+    inOutData = *Value;
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitUpdateUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataBundleItemValue userGameplayDataBundleItemValue)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitUpdateUserGameplayDataBundleItem);
+
+    const FString BundleName = ToFString(userGameplayDataBundleItemValue.bundleName);
+    if (BundleName.IsEmpty())
+    {
+        return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME);
+    }
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    Instance.Bundles.FindOrAdd(BundleName).Add(ToFString(userGameplayDataBundleItemValue.bundleItemKey), ToFString(userGameplayDataBundleItemValue.bundleItemValue));
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitDeleteAllUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitDeleteAllUserGameplayData);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    Instance.Bundles.Empty();
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitDeleteUserGameplayDataBundle);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    Instance.Bundles.Remove(ToFString(bundleName));
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundleItems(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataDeleteItemsRequest deleteItemsRequest)
+{
+    SIMULATE_BACKEND_CALL(UserGameplayData, GameKitDeleteUserGameplayDataBundleItems);
+
+    FMockUserGameplayDataInstance& Instance = GetInstance<FMockUserGameplayDataInstance>(userGameplayDataInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    if (TMap<FString, FString>* Bundle = Instance.Bundles.Find(ToFString(deleteItemsRequest.bundleName)))
+    {
+        for (unsigned int i = 0; i < deleteItemsRequest.numKeys; ++i)
+        {
+            Bundle->Remove(ToFString(deleteItemsRequest.bundleItemKeys[i]));
+        }
+    }
+
+    return RecordResult(EAwsGameKitStatsFeature::UserGameplayData, GameKit::GAMEKIT_SUCCESS);
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataStartRetryBackgroundThread(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataStopRetryBackgroundThread(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataSetNetworkChangeCallback(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiverHandle, NetworkStatusChangeCallback statusChangeCallback)
+{
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataSetCacheProcessedCallback(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiverHandle, CacheProcessedCallback cacheProcessedCallback)
+{
+}
+
+void AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataDropAllCachedEvents(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataPersistApiCallsToCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile)
+{
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockUserGameplayDataWrapper::GameKitUserGameplayDataLoadApiCallsFromCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile)
+{
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+// ------ Game Saving ------
+
+bool AwsGameKitMockGameSavingWrapper::Initialize()
+{
+    return true;
+}
+
+GAMEKIT_GAME_SAVING_INSTANCE_HANDLE AwsGameKitMockGameSavingWrapper::GameKitGameSavingInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb, const char** localSlotInformationFilePaths, const unsigned int arraySize, const FileActions& fileActions)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    return new FMockGameSavingInstance();
+}
+
+void AwsGameKitMockGameSavingWrapper::GameKitGameSavingInstanceRelease(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance)
+{
+    delete static_cast<FMockGameSavingInstance*>(gameSavingInstance);
+}
+
+void AwsGameKitMockGameSavingWrapper::GameKitAddLocalSlots(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, const char** localSlotInformationFilePaths, const unsigned int arraySize)
+{
+}
+
+void AwsGameKitMockGameSavingWrapper::GameKitSetFileActions(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, const FileActions& fileActions)
+{
+}
+
+unsigned int AwsGameKitMockGameSavingWrapper::GameKitGetAllSlotSyncStatuses(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize)
+{
+    SIMULATE_BACKEND_CALL(GameSaving, GameKitGetAllSlotSyncStatuses);
+
+    FMockGameSavingInstance& Instance = GetInstance<FMockGameSavingInstance>(gameSavingInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    const FMockSlotResponse Response(Instance, FString());
+    resultCb(receiver, Response.GetCachedSlots(), Response.GetSlotCount(), true, GameKit::GAMEKIT_SUCCESS);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockGameSavingWrapper::GameKitGetSlotSyncStatus(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, const char* slotName)
+{
+    SIMULATE_BACKEND_CALL(GameSaving, GameKitGetSlotSyncStatus);
+
+    FMockGameSavingInstance& Instance = GetInstance<FMockGameSavingInstance>(gameSavingInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    const FString SlotName = ToFString(slotName);
+    const unsigned int Status = Instance.Slots.Contains(SlotName) ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND;
+    const FMockSlotResponse Response(Instance, SlotName);
+    resultCb(receiver, Response.GetCachedSlots(), Response.GetSlotCount(), Response.GetSlot(), Status);
+    return Status;
+}
+
+unsigned int AwsGameKitMockGameSavingWrapper::GameKitDeleteSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, const char* slotName)
+{
+    SIMULATE_BACKEND_CALL(GameSaving, GameKitDeleteSlot);
+
+    FMockGameSavingInstance& Instance = GetInstance<FMockGameSavingInstance>(gameSavingInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    const FString SlotName = ToFString(slotName);
+    FMockSlot Deleted;
+    const unsigned int Status = Instance.Slots.RemoveAndCopyValue(SlotName, Deleted) ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND;
+    const FMockSlotResponse Response(Instance, SlotName);
+    resultCb(receiver, Response.GetCachedSlots(), Response.GetSlotCount(), Response.GetSlot(), Status);
+    return Status;
+}
+
+unsigned int AwsGameKitMockGameSavingWrapper::GameKitSaveSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, GameSavingModel& model)
+{
+    SIMULATE_BACKEND_CALL(GameSaving, GameKitSaveSlot);
+
+    const FString SlotName = ToFString(model.slotName);
+    if (SlotName.IsEmpty())
+    {
+        return GameKit::GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME;
+    }
+
+    FMockGameSavingInstance& Instance = GetInstance<FMockGameSavingInstance>(gameSavingInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    FMockSlot& MockSlot = Instance.Slots.FindOrAdd(SlotName);
+    MockSlot.Metadata = ToFString(model.metadata);
+    MockSlot.Data = TArray<uint8>(model.data, model.dataSize);
+    MockSlot.LastModified = model.epochTime > 0 ? model.epochTime : FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+
+    const FMockSlotResponse Response(Instance, SlotName);
+    resultCb(receiver, Response.GetCachedSlots(), Response.GetSlotCount(), Response.GetSlot(), GameKit::GAMEKIT_SUCCESS);
+    return GameKit::GAMEKIT_SUCCESS;
+}
+
+unsigned int AwsGameKitMockGameSavingWrapper::GameKitLoadSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingDataResponseCallback resultCb, GameSavingModel& model)
+{
+    SIMULATE_BACKEND_CALL(GameSaving, GameKitLoadSlot);
+
+    FMockGameSavingInstance& Instance = GetInstance<FMockGameSavingInstance>(gameSavingInstance);
+    FScopeLock Lock(&Instance.Mutex);
+    const FString SlotName = ToFString(model.slotName);
+    const FMockSlot* MockSlot = Instance.Slots.Find(SlotName);
+    const unsigned int Status = MockSlot != nullptr ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND;
+    const FMockSlotResponse Response(Instance, SlotName);
+    resultCb(receiver, Response.GetCachedSlots(), Response.GetSlotCount(), Response.GetSlot(),
+        MockSlot != nullptr ? MockSlot->Data.GetData() : nullptr, MockSlot != nullptr ? static_cast<unsigned int>(MockSlot->Data.Num()) : 0, Status);
+    return Status;
+}
+
+#undef SIMULATE_BACKEND_CALL
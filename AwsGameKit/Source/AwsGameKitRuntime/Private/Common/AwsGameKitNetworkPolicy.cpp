@@ -0,0 +1,170 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitNetworkPolicy.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitNetworkMeteredPolicy(
+    TEXT("GameKit.Network.MeteredPolicy"),
+    0,
+    TEXT("Which background transfers wait for an unmetered link, see FAwsGameKitNetworkPolicy.\n")
+    TEXT("  0: none, the network class is ignored\n")
+    TEXT("  1: the large ones, and all of them while roaming\n")
+    TEXT("  2: all of them\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitNetworkMeteredLargeTransferBytes(
+    TEXT("GameKit.Network.MeteredLargeTransferBytes"),
+    1024 * 1024,
+    TEXT("Size in bytes from which a background transfer is deferred on a metered link when GameKit.Network.MeteredPolicy is 1.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitNetworkClass(
+    TEXT("GameKit.Network.Class"),
+    0,
+    TEXT("Network class used instead of the platform's, for testing.\n")
+    TEXT("  0: the platform's\n")
+    TEXT("  1: unmetered\n")
+    TEXT("  2: metered\n")
+    TEXT("  3: roaming\n"),
+    ECVF_Cheat);
+
+namespace
+{
+    const float POLL_INTERVAL_SECONDS = 5.0f;
+
+    const TCHAR* LexNetworkClass(EAwsGameKitNetworkClass NetworkClass)
+    {
+        switch (NetworkClass)
+        {
+        case EAwsGameKitNetworkClass::Unmetered: return TEXT("unmetered");
+        case EAwsGameKitNetworkClass::Metered: return TEXT("metered");
+        case EAwsGameKitNetworkClass::Roaming: return TEXT("roaming");
+        default: return TEXT("unknown");
+        }
+    }
+
+    EAwsGameKitNetworkClass ReadPlatformClass()
+    {
+        switch (FPlatformMisc::GetNetworkConnectionType())
+        {
+        case ENetworkConnectionType::Cell:
+            return EAwsGameKitNetworkClass::Metered;
+        case ENetworkConnectionType::WiFi:
+        case ENetworkConnectionType::Ethernet:
+            return EAwsGameKitNetworkClass::Unmetered;
+        default:
+            return EAwsGameKitNetworkClass::Unknown;
+        }
+    }
+}
+
+FAwsGameKitNetworkPolicy& FAwsGameKitNetworkPolicy::Get()
+{
+    static FAwsGameKitNetworkPolicy Instance;
+    return Instance;
+}
+
+void FAwsGameKitNetworkPolicy::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    Refresh();
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitNetworkPolicy::Tick), POLL_INTERVAL_SECONDS);
+}
+
+void FAwsGameKitNetworkPolicy::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+EAwsGameKitNetworkClass FAwsGameKitNetworkPolicy::GetNetworkClass() const
+{
+    const int32 TestClass = CVarGameKitNetworkClass.GetValueOnAnyThread();
+    if (TestClass > 0 && TestClass <= static_cast<int32>(EAwsGameKitNetworkClass::Roaming))
+    {
+        return static_cast<EAwsGameKitNetworkClass>(TestClass);
+    }
+
+    FScopeLock ScopeLock(&Mutex);
+    return OverrideClass != EAwsGameKitNetworkClass::Unknown ? OverrideClass : PlatformClass;
+}
+
+void FAwsGameKitNetworkPolicy::SetOverride(EAwsGameKitNetworkClass NetworkClass)
+{
+    {
+        FScopeLock ScopeLock(&Mutex);
+        OverrideClass = NetworkClass;
+    }
+
+    // Report it right away rather than on the next poll
+    if (IsInGameThread() && TickerHandle.IsValid())
+    {
+        Refresh();
+    }
+}
+
+bool FAwsGameKitNetworkPolicy::IsMetered() const
+{
+    const EAwsGameKitNetworkClass NetworkClass = GetNetworkClass();
+    return CVarGameKitNetworkMeteredPolicy.GetValueOnAnyThread() != 0
+        && (NetworkClass == EAwsGameKitNetworkClass::Metered || NetworkClass == EAwsGameKitNetworkClass::Roaming);
+}
+
+bool FAwsGameKitNetworkPolicy::ShouldDeferTransfer(int64 Bytes) const
+{
+    if (!IsMetered())
+    {
+        return false;
+    }
+
+    if (CVarGameKitNetworkMeteredPolicy.GetValueOnAnyThread() >= 2 || GetNetworkClass() == EAwsGameKitNetworkClass::Roaming)
+    {
+        return true;
+    }
+
+    return Bytes < 0 || Bytes >= CVarGameKitNetworkMeteredLargeTransferBytes.GetValueOnAnyThread();
+}
+
+bool FAwsGameKitNetworkPolicy::Tick(float DeltaTime)
+{
+    Refresh();
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitNetworkPolicy::Refresh()
+{
+    const EAwsGameKitNetworkClass NewPlatformClass = ReadPlatformClass();
+    {
+        FScopeLock ScopeLock(&Mutex);
+        PlatformClass = NewPlatformClass;
+    }
+
+    const EAwsGameKitNetworkClass NetworkClass = GetNetworkClass();
+    if (NetworkClass == LastReportedClass)
+    {
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitNetworkPolicy: Network class changed from %s to %s"), LexNetworkClass(LastReportedClass), LexNetworkClass(NetworkClass));
+    LastReportedClass = NetworkClass;
+    OnNetworkClassChanged.Broadcast(NetworkClass);
+}
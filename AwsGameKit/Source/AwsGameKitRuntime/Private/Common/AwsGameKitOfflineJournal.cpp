@@ -0,0 +1,459 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitOfflineJournal.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Templates/UniquePtr.h"
+
+namespace
+{
+    // "GKUJ", followed by the format version. Files with another version are ignored and overwritten.
+    const uint32 JOURNAL_FILE_MAGIC = 0x4A554B47;
+    // Version 2 added the player id. The records of version 1 files aren't replayed, since the player they were made for isn't known.
+    const uint32 JOURNAL_FILE_VERSION = 2;
+
+    const uint8 RECORD_TYPE_PUT = 1;
+    const uint8 RECORD_TYPE_TOMBSTONE = 2;
+
+    // The journal is compacted once it holds this many records and at least twice as many records as pending writes
+    const int32 COMPACT_MIN_RECORDS = 1000;
+
+    // Record layout: type, payload size, then the sequence number, player id, group, key and, for puts, the value.
+    // A tombstone with an empty key completes the whole group of the player.
+    void WriteRecord(FArchive& Ar, uint8 Type, int64 Sequence, const FString& PlayerId, const FString& Group, const FString& Key, const FString* Value)
+    {
+        Ar << Type;
+        const int64 SizeOffset = Ar.Tell();
+        int32 PayloadSize = 0;
+        Ar << PayloadSize;
+
+        Ar << Sequence << const_cast<FString&>(PlayerId) << const_cast<FString&>(Group) << const_cast<FString&>(Key);
+        if (Value != nullptr)
+        {
+            Ar << const_cast<FString&>(*Value);
+        }
+
+        const int64 EndOffset = Ar.Tell();
+        PayloadSize = static_cast<int32>(EndOffset - SizeOffset - sizeof(int32));
+        Ar.Seek(SizeOffset);
+        Ar << PayloadSize;
+        Ar.Seek(EndOffset);
+    }
+}
+
+FAwsGameKitOfflineJournal::~FAwsGameKitOfflineJournal()
+{
+    Close();
+}
+
+void FAwsGameKitOfflineJournal::Open(const FString& InFilePath)
+{
+    AWSGAMEKIT_LLM_SCOPE(Core);
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (bIsOpen)
+        {
+            return;
+        }
+
+        bIsOpen = true;
+        FilePath = InFilePath;
+        Pending.Reset();
+        PendingCount = 0;
+        NextSequence = 1;
+
+        TArray<uint8> Contents;
+        if (FFileHelper::LoadFileToArray(Contents, *FilePath, FILEREAD_Silent))
+        {
+            FMemoryReader Reader(Contents);
+            uint32 Magic = 0;
+            uint32 Version = 0;
+            Reader << Magic << Version;
+            if (Reader.IsError() || Magic != JOURNAL_FILE_MAGIC || Version != JOURNAL_FILE_VERSION)
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineJournal: Ignoring malformed journal %s"), *FilePath);
+            }
+            else
+            {
+                while (Reader.Tell() < Reader.TotalSize())
+                {
+                    uint8 Type = 0;
+                    int32 PayloadSize = 0;
+                    Reader << Type << PayloadSize;
+                    const int64 Offset = Reader.Tell();
+                    if (Reader.IsError() || PayloadSize < 0 || Offset + PayloadSize > Reader.TotalSize())
+                    {
+                        // The game stopped while appending this record, the previous ones are complete
+                        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineJournal: Dropping the torn record at the end of %s"), *FilePath);
+                        break;
+                    }
+
+                    FMemoryReaderView Payload(MakeArrayView(Contents.GetData() + Offset, PayloadSize));
+                    int64 Sequence = 0;
+                    FGroupKey GroupKey;
+                    FString Key;
+                    FString Value;
+                    Payload << Sequence << GroupKey.PlayerId << GroupKey.Group << Key;
+                    if (Type == RECORD_TYPE_PUT)
+                    {
+                        Payload << Value;
+                    }
+
+                    if (Payload.IsError() || (Type != RECORD_TYPE_PUT && Type != RECORD_TYPE_TOMBSTONE))
+                    {
+                        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineJournal: Ignoring the end of malformed journal %s"), *FilePath);
+                        break;
+                    }
+
+                    NextSequence = FMath::Max(NextSequence, Sequence + 1);
+                    if (Type == RECORD_TYPE_PUT)
+                    {
+                        ApplyPut(GroupKey, Key, Value, Sequence);
+                    }
+                    else
+                    {
+                        ApplyTombstone(GroupKey, Key, Sequence);
+                    }
+                    Reader.Seek(Offset + PayloadSize);
+                }
+            }
+        }
+
+        if (PendingCount > 0)
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitOfflineJournal: %d writes of the previous session are pending in %s"), PendingCount, *FilePath);
+        }
+    }
+
+    // Start from a file holding only the pending writes, which also drops a torn record. This opens the journal for appending.
+    Compact();
+}
+
+void FAwsGameKitOfflineJournal::Close()
+{
+    Sync();
+
+    FScopeLock ScopeLock(&Mutex);
+    bIsOpen = false;
+    FileHandle.Reset();
+}
+
+bool FAwsGameKitOfflineJournal::IsOpen() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return FileHandle.IsValid();
+}
+
+void FAwsGameKitOfflineJournal::Checkpoint()
+{
+    Sync();
+}
+
+int64 FAwsGameKitOfflineJournal::Append(const FString& Group, const FString& Key, const FString& Value, const FString& PlayerId)
+{
+    AWSGAMEKIT_LLM_SCOPE(Core);
+    FScopeLock ScopeLock(&Mutex);
+    if (!FileHandle.IsValid())
+    {
+        return 0;
+    }
+
+    const int64 Sequence = NextSequence++;
+    TArray<uint8> Record;
+    FMemoryWriter Writer(Record);
+    WriteRecord(Writer, RECORD_TYPE_PUT, Sequence, PlayerId, Group, Key, &Value);
+
+    Write(Record);
+    ApplyPut(FGroupKey{ PlayerId, Group }, Key, Value, Sequence);
+    return Sequence;
+}
+
+void FAwsGameKitOfflineJournal::Complete(const FString& Group, const TMap<FString, int64>& Sequences, const FString& PlayerId)
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (!FileHandle.IsValid())
+    {
+        return;
+    }
+
+    const FGroupKey GroupKey{ PlayerId, Group };
+    for (const TPair<FString, int64>& Sequence : Sequences)
+    {
+        AppendTombstone(GroupKey, Sequence.Key, Sequence.Value);
+    }
+}
+
+void FAwsGameKitOfflineJournal::Discard(const FString& Group, const TArray<FString>& Keys, const FString& PlayerId)
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FGroupKey GroupKey{ PlayerId, Group };
+    if (!FileHandle.IsValid() || !Pending.Contains(GroupKey))
+    {
+        return;
+    }
+
+    // Completes every record appended so far
+    const int64 Sequence = NextSequence - 1;
+    if (Keys.Num() == 0)
+    {
+        AppendTombstone(GroupKey, FString(), Sequence);
+        return;
+    }
+
+    for (const FString& Key : Keys)
+    {
+        AppendTombstone(GroupKey, Key, Sequence);
+    }
+}
+
+int64 FAwsGameKitOfflineJournal::GetLastSequence() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return NextSequence - 1;
+}
+
+void FAwsGameKitOfflineJournal::Reset(int64 UpToSequence)
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (!FileHandle.IsValid())
+    {
+        return;
+    }
+
+    // One tombstone per group, the next compaction drops the completed records from the file
+    TArray<FGroupKey> GroupKeys;
+    Pending.GetKeys(GroupKeys);
+    for (const FGroupKey& GroupKey : GroupKeys)
+    {
+        AppendTombstone(GroupKey, FString(), UpToSequence);
+    }
+}
+
+TArray<FAwsGameKitOfflineJournal::FEntry> FAwsGameKitOfflineJournal::GetPendingEntries() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    TArray<FEntry> Entries;
+    Entries.Reserve(PendingCount);
+    for (const TPair<FGroupKey, TMap<FString, FPendingValue>>& Group : Pending)
+    {
+        for (const TPair<FString, FPendingValue>& Entry : Group.Value)
+        {
+            Entries.Add(FEntry{ Group.Key.PlayerId, Group.Key.Group, Entry.Key, Entry.Value.Value, Entry.Value.Sequence });
+        }
+    }
+
+    // In the order they were appended
+    Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Sequence < B.Sequence; });
+    return Entries;
+}
+
+void FAwsGameKitOfflineJournal::Tick(double SyncIntervalSeconds)
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (!FileHandle.IsValid() || bWorkInFlight)
+    {
+        return;
+    }
+
+    const bool bCompactDue = RecordCount >= FMath::Max(COMPACT_MIN_RECORDS, 2 * PendingCount);
+    const bool bSyncDue = bUnsynced && FPlatformTime::Seconds() - LastSyncTime >= SyncIntervalSeconds;
+    if (!bCompactDue && !bSyncDue)
+    {
+        return;
+    }
+
+    bWorkInFlight = true;
+    InternalAwsGameKitRunLambdaOnWorkThread([this, bCompactDue]
+    {
+        // Compacting syncs the new file too
+        bCompactDue ? Compact() : Sync();
+
+        FScopeLock WorkScopeLock(&Mutex);
+        bWorkInFlight = false;
+    }, EAwsGameKitWorkLane::Background);
+}
+
+void FAwsGameKitOfflineJournal::ApplyPut(const FGroupKey& GroupKey, const FString& Key, const FString& Value, int64 Sequence)
+{
+    TMap<FString, FPendingValue>& Entries = Pending.FindOrAdd(GroupKey);
+    const int32 PreviousNum = Entries.Num();
+    Entries.Add(Key, FPendingValue{ Value, Sequence });
+    PendingCount += Entries.Num() - PreviousNum;
+}
+
+void FAwsGameKitOfflineJournal::ApplyTombstone(const FGroupKey& GroupKey, const FString& Key, int64 Sequence)
+{
+    TMap<FString, FPendingValue>* Entries = Pending.Find(GroupKey);
+    if (Entries == nullptr)
+    {
+        return;
+    }
+
+    // Newer writes of the same keys stay pending
+    const int32 PreviousNum = Entries->Num();
+    if (Key.IsEmpty())
+    {
+        for (auto It = Entries->CreateIterator(); It; ++It)
+        {
+            if (It.Value().Sequence <= Sequence)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+    else if (const FPendingValue* Entry = Entries->Find(Key))
+    {
+        if (Entry->Sequence <= Sequence)
+        {
+            Entries->Remove(Key);
+        }
+    }
+    PendingCount -= PreviousNum - Entries->Num();
+
+    if (Entries->Num() == 0)
+    {
+        Pending.Remove(GroupKey);
+    }
+}
+
+void FAwsGameKitOfflineJournal::AppendTombstone(const FGroupKey& GroupKey, const FString& Key, int64 Sequence)
+{
+    TArray<uint8> Record;
+    FMemoryWriter Writer(Record);
+    WriteRecord(Writer, RECORD_TYPE_TOMBSTONE, Sequence, GroupKey.PlayerId, GroupKey.Group, Key, nullptr);
+
+    Write(Record);
+    ApplyTombstone(GroupKey, Key, Sequence);
+}
+
+void FAwsGameKitOfflineJournal::Write(const TArray<uint8>& Record)
+{
+    // One write per record, so that a crash can only tear the last one
+    if (!FileHandle->Write(Record.GetData(), Record.Num()))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineJournal: Failed to append to %s"), *FilePath);
+    }
+    ++RecordCount;
+    bUnsynced = true;
+
+    if (bCompacting)
+    {
+        CompactTail.Append(Record);
+        ++CompactTailCount;
+    }
+}
+
+void FAwsGameKitOfflineJournal::Compact()
+{
+    AWSGAMEKIT_LLM_SCOPE(Core);
+    TArray<uint8> Contents;
+    int32 CompactedCount;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (!bIsOpen || bCompacting)
+        {
+            return;
+        }
+
+        FMemoryWriter Writer(Contents);
+        uint32 Magic = JOURNAL_FILE_MAGIC;
+        uint32 Version = JOURNAL_FILE_VERSION;
+        Writer << Magic << Version;
+        for (const TPair<FGroupKey, TMap<FString, FPendingValue>>& Group : Pending)
+        {
+            for (const TPair<FString, FPendingValue>& Entry : Group.Value)
+            {
+                WriteRecord(Writer, RECORD_TYPE_PUT, Entry.Value.Sequence, Group.Key.PlayerId, Group.Key.Group, Entry.Key, &Entry.Value.Value);
+            }
+        }
+        CompactedCount = PendingCount;
+
+        bCompacting = true;
+        CompactTail.Reset();
+        CompactTailCount = 0;
+    }
+
+    // The new file is written and synced without the lock, so that appends don't wait on the disk. It's synced before it replaces the journal,
+    // so that there is always a complete journal on disk.
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString TempFilePath = FilePath + TEXT(".tmp");
+    TUniquePtr<IFileHandle> TempFileHandle(PlatformFile.OpenWrite(*TempFilePath));
+    bool bWritten = TempFileHandle.IsValid() && TempFileHandle->Write(Contents.GetData(), Contents.Num()) && TempFileHandle->Flush(true);
+    TempFileHandle.Reset();
+
+    FScopeLock ScopeLock(&Mutex);
+    bCompacting = false;
+    if (!bIsOpen)
+    {
+        // Closed meanwhile, the previous journal is complete
+        IFileManager::Get().Delete(*TempFilePath, false, false, true);
+        return;
+    }
+
+    // The records appended meanwhile are in the previous journal only, copy them over. They are synced with the next appends.
+    if (bWritten && CompactTail.Num() > 0)
+    {
+        TempFileHandle.Reset(PlatformFile.OpenWrite(*TempFilePath, true));
+        bWritten = TempFileHandle.IsValid() && TempFileHandle->Write(CompactTail.GetData(), CompactTail.Num());
+        TempFileHandle.Reset();
+    }
+
+    FileHandle.Reset();
+    bWritten = bWritten && IFileManager::Get().Move(*FilePath, *TempFilePath, true, true, false, true);
+    if (bWritten)
+    {
+        RecordCount = CompactedCount + CompactTailCount;
+        bUnsynced = CompactTail.Num() > 0;
+    }
+    else
+    {
+        // Keep appending to the previous journal
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineJournal: Failed to compact %s"), *FilePath);
+        IFileManager::Get().Delete(*TempFilePath, false, false, true);
+    }
+    CompactTail.Empty();
+    CompactTailCount = 0;
+
+    FileHandle = TSharedPtr<IFileHandle, ESPMode::ThreadSafe>(PlatformFile.OpenWrite(*FilePath, true));
+    if (!FileHandle.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitOfflineJournal: Failed to open %s, writes are not journaled"), *FilePath);
+    }
+    LastSyncTime = FPlatformTime::Seconds();
+}
+
+void FAwsGameKitOfflineJournal::Sync()
+{
+    TSharedPtr<IFileHandle, ESPMode::ThreadSafe> Handle;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (!FileHandle.IsValid() || !bUnsynced)
+        {
+            return;
+        }
+
+        // The records appended from now on are synced next time
+        Handle = FileHandle;
+        bUnsynced = false;
+    }
+
+    // Without the lock: the platform file handles only ask the OS to flush, which doesn't get in the way of the appends made meanwhile
+    Handle->Flush(true);
+
+    FScopeLock ScopeLock(&Mutex);
+    LastSyncTime = FPlatformTime::Seconds();
+}
@@ -0,0 +1,475 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitNetworkPolicy.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CString.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitOfflineQueueEnabled(
+    TEXT("GameKit.OfflineQueue.Enabled"),
+    0,
+    TEXT("Queues the writes which fail while offline, such as achievement increments, and sends them once the backend can be reached again.\n")
+    TEXT("Read when the runtime module starts.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitOfflineQueueMaxInFlight(
+    TEXT("GameKit.OfflineQueue.MaxInFlight"),
+    4,
+    TEXT("Maximum number of queued writes sent at the same time while the offline write queue is drained.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitOfflineQueueRetryIntervalSeconds(
+    TEXT("GameKit.OfflineQueue.RetryIntervalSeconds"),
+    5,
+    TEXT("Shortest time in seconds before the offline write queue is drained again after a write failed while offline.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Longest time between two drains while the writes keep failing
+    const double MAX_RETRY_INTERVAL_SECONDS = 300.0;
+
+    const double JOURNAL_SYNC_INTERVAL_SECONDS = 1.0;
+}
+
+FAwsGameKitOfflineWriteQueue& FAwsGameKitOfflineWriteQueue::Get()
+{
+    static FAwsGameKitOfflineWriteQueue Instance;
+    return Instance;
+}
+
+bool FAwsGameKitOfflineWriteQueue::IsEnabled()
+{
+    return CVarGameKitOfflineQueueEnabled.GetValueOnAnyThread() != 0;
+}
+
+bool FAwsGameKitOfflineWriteQueue::IsOfflineResult(const IntResult& Result)
+{
+    // Not GAMEKIT_ERROR_NO_ID_TOKEN: a write made while nobody is logged in would be sent for whoever logs in next
+    return Result.Result == GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED;
+}
+
+void FAwsGameKitOfflineWriteQueue::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid() || !IsEnabled())
+    {
+        return;
+    }
+
+    Journal.Open(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("OfflineWriteQueue.bin")));
+
+    {
+        FScopeLock ScopeLock(&Mutex);
+        for (const FAwsGameKitOfflineJournal::FEntry& Entry : Journal.GetPendingEntries())
+        {
+            if (Entry.PlayerId.IsEmpty())
+            {
+                // Made before the player's id was known, the next player to log in may be someone else
+                UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineWriteQueue: Dropping queued write %s %s of an unknown player"), *Entry.Group, *Entry.Key);
+                JournalOps.Add(FJournalOp{ Entry.PlayerId, Entry.Group, Entry.Key, FString(), true });
+                continue;
+            }
+
+            FQueuedWrite& Write = Queued.FindOrAdd(Entry.PlayerId).FindOrAdd(Entry.Group).FindOrAdd(Entry.Key);
+            Write.Value = Entry.Value;
+            Write.Version = 1;
+        }
+        PlayerId.Reset();
+        NextDrainTime = 0.0;
+        RetryDelaySeconds = 0.0;
+    }
+    WriteJournal();
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitOfflineWriteQueue::Tick));
+}
+
+void FAwsGameKitOfflineWriteQueue::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    WriteJournal();
+
+    FScopeLock JournalLock(&JournalMutex);
+    Journal.Close();
+
+    FScopeLock ScopeLock(&Mutex);
+    Queued.Reset();
+    JournalOps.Reset();
+    PlayerId.Reset();
+}
+
+void FAwsGameKitOfflineWriteQueue::RegisterFeature(const FString& Feature, EAwsGameKitOfflineWriteMerge Merge, FSendFunction&& Send)
+{
+    FScopeLock ScopeLock(&Mutex);
+    Features.Add(Feature, FFeature{ Merge, MoveTemp(Send) });
+}
+
+bool FAwsGameKitOfflineWriteQueue::Enqueue(const FString& Feature, const FString& Key, const FString& Value)
+{
+    const uint32 Generation = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    {
+        FScopeLock ScopeLock(&Mutex);
+        const FFeature* Registered = Features.Find(Feature);
+        if (!IsEnabled() || !TickerHandle.IsValid() || Registered == nullptr)
+        {
+            return false;
+        }
+
+        // Queued without a player id while it isn't known yet, ResolvePlayer() gives the write to the player once it is
+        CheckPlayer(Generation);
+        Merge(PlayerId, Feature, Registered->Merge, Key, Value);
+    }
+
+    WriteJournal();
+    return true;
+}
+
+void FAwsGameKitOfflineWriteQueue::OnNetworkStatusChange(bool bIsConnectionOk)
+{
+    if (!bIsConnectionOk)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Mutex);
+    NextDrainTime = 0.0;
+    RetryDelaySeconds = 0.0;
+}
+
+void FAwsGameKitOfflineWriteQueue::FlushAll()
+{
+    // Only the writes of the logged in player are sent, look it up first if it isn't known yet
+    const uint32 Generation = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    bool bResolve;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        CheckPlayer(Generation);
+        bResolve = Queued.Num() > 0 && PlayerId.IsEmpty() && !bIsResolvingPlayer;
+        bIsResolvingPlayer |= bResolve;
+    }
+    if (bResolve)
+    {
+        ResolvePlayer(Generation);
+    }
+
+    for (const FReadyWrite& Ready : TakeReady(MAX_int32))
+    {
+        OnSent(Ready, Ready.Send(Ready.Key, Ready.Value));
+    }
+}
+
+void FAwsGameKitOfflineWriteQueue::DiscardAll()
+{
+    FScopeLock JournalLock(&JournalMutex);
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Queued.Reset();
+        JournalOps.Reset();
+    }
+
+    // The appends are serialized by JournalMutex, every record so far was made for the writes dropped above
+    Journal.Reset(Journal.GetLastSequence());
+}
+
+int32 FAwsGameKitOfflineWriteQueue::Num() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    int32 Count = 0;
+    for (const TPair<FString, FPlayerWrites>& Player : Queued)
+    {
+        for (const TPair<FString, TMap<FString, FQueuedWrite>>& Feature : Player.Value)
+        {
+            Count += Feature.Value.Num();
+        }
+    }
+    return Count;
+}
+
+void FAwsGameKitOfflineWriteQueue::Checkpoint()
+{
+    WriteJournal();
+    Journal.Checkpoint();
+}
+
+bool FAwsGameKitOfflineWriteQueue::Tick(float DeltaTime)
+{
+    Journal.Tick(JOURNAL_SYNC_INTERVAL_SECONDS);
+
+    const uint32 Generation = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    bool bResolveDue = false;
+    bool bDrainDue = false;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        CheckPlayer(Generation);
+        if (Queued.Num() > 0 && FPlatformTime::Seconds() >= NextDrainTime)
+        {
+            bResolveDue = PlayerId.IsEmpty() && !bIsResolvingPlayer;
+            bDrainDue = !PlayerId.IsEmpty();
+            bIsResolvingPlayer |= bResolveDue;
+        }
+    }
+
+    if (bResolveDue)
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread([this, Generation]
+        {
+            ResolvePlayer(Generation);
+        }, EAwsGameKitWorkLane::Background);
+    }
+
+    if (bDrainDue)
+    {
+        // One at a time on a metered link
+        const int32 MaxInFlight = FAwsGameKitNetworkPolicy::Get().IsMetered() ? 1 : FMath::Max(1, CVarGameKitOfflineQueueMaxInFlight.GetValueOnGameThread());
+        for (FReadyWrite& Ready : TakeReady(MaxInFlight))
+        {
+            InternalAwsGameKitRunLambdaOnWorkThread([this, Ready = MoveTemp(Ready)]
+            {
+                OnSent(Ready, Ready.Send(Ready.Key, Ready.Value));
+            }, EAwsGameKitWorkLane::Background);
+        }
+    }
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitOfflineWriteQueue::CheckPlayer(uint32 Generation)
+{
+    if (Generation != PlayerGeneration)
+    {
+        // A player logged in or out, or a token was set: look the player up again right away
+        PlayerId.Reset();
+        PlayerGeneration = Generation;
+        NextDrainTime = 0.0;
+        RetryDelaySeconds = 0.0;
+    }
+}
+
+void FAwsGameKitOfflineWriteQueue::ResolvePlayer(uint32 Generation)
+{
+    FGetUserResponse Response;
+    const IntResult Result = FAwsGameKitIdentityUserCache::Get().GetUser(Response);
+    const uint32 CurrentGeneration = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    {
+        FScopeLock ScopeLock(&Mutex);
+        bIsResolvingPlayer = false;
+        CheckPlayer(CurrentGeneration);
+        if (Generation != CurrentGeneration)
+        {
+            // The player may have changed during the lookup, the next tick looks it up again
+            return;
+        }
+
+        if (Result.Result != GameKit::GAMEKIT_SUCCESS || Response.UserId.IsEmpty())
+        {
+            // Nobody is logged in, or the backend can't be reached yet
+            UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitOfflineWriteQueue: Couldn't get the logged in player, error 0x%x"), Result.Result);
+            ScheduleRetry();
+            return;
+        }
+
+        PlayerId = Response.UserId;
+        NextDrainTime = 0.0;
+        RetryDelaySeconds = 0.0;
+
+        // The writes queued while the player's id wasn't known were made for this player
+        FPlayerWrites Unowned;
+        if (Queued.RemoveAndCopyValue(FString(), Unowned))
+        {
+            for (const TPair<FString, TMap<FString, FQueuedWrite>>& Feature : Unowned)
+            {
+                const FFeature* Registered = Features.Find(Feature.Key);
+                const EAwsGameKitOfflineWriteMerge MergeMode = Registered != nullptr ? Registered->Merge : EAwsGameKitOfflineWriteMerge::Replace;
+                for (const TPair<FString, FQueuedWrite>& Write : Feature.Value)
+                {
+                    Merge(PlayerId, Feature.Key, MergeMode, Write.Key, Write.Value.Value);
+                    JournalOps.Add(FJournalOp{ FString(), Feature.Key, Write.Key, FString(), true });
+                }
+            }
+        }
+    }
+
+    WriteJournal();
+}
+
+TArray<FAwsGameKitOfflineWriteQueue::FReadyWrite> FAwsGameKitOfflineWriteQueue::TakeReady(int32 MaxInFlight)
+{
+    FScopeLock ScopeLock(&Mutex);
+    TArray<FReadyWrite> ReadyWrites;
+    FPlayerWrites* PlayerWrites = PlayerId.IsEmpty() ? nullptr : Queued.Find(PlayerId);
+    if (PlayerWrites == nullptr)
+    {
+        // Only the writes of the logged in player are sent
+        return ReadyWrites;
+    }
+
+    for (TPair<FString, TMap<FString, FQueuedWrite>>& Feature : *PlayerWrites)
+    {
+        const FFeature* Registered = Features.Find(Feature.Key);
+        if (Registered == nullptr)
+        {
+            continue;
+        }
+
+        for (TPair<FString, FQueuedWrite>& Write : Feature.Value)
+        {
+            if (NumInFlight >= MaxInFlight)
+            {
+                return ReadyWrites;
+            }
+            if (Write.Value.bInFlight)
+            {
+                continue;
+            }
+
+            Write.Value.bInFlight = true;
+            Write.Value.SentValue = Write.Value.Value;
+            Write.Value.SentVersion = Write.Value.Version;
+            ++NumInFlight;
+            ReadyWrites.Add(FReadyWrite{ PlayerId, Feature.Key, Write.Key, Write.Value.Value, Registered->Send });
+        }
+    }
+    return ReadyWrites;
+}
+
+void FAwsGameKitOfflineWriteQueue::OnSent(const FReadyWrite& Sent, const IntResult& Result)
+{
+    {
+        FScopeLock ScopeLock(&Mutex);
+        --NumInFlight;
+
+        FPlayerWrites* PlayerWrites = Queued.Find(Sent.PlayerId);
+        TMap<FString, FQueuedWrite>* Writes = PlayerWrites != nullptr ? PlayerWrites->Find(Sent.Feature) : nullptr;
+        FQueuedWrite* Write = Writes != nullptr ? Writes->Find(Sent.Key) : nullptr;
+        if (Write == nullptr)
+        {
+            // Discarded while in flight
+            return;
+        }
+        Write->bInFlight = false;
+
+        if (IsOfflineResult(Result))
+        {
+            ScheduleRetry();
+            return;
+        }
+
+        if (Result.Result == GameKit::GAMEKIT_ERROR_NO_ID_TOKEN)
+        {
+            // The player logged out while the write was in flight, keep it until the player logs in again
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitOfflineWriteQueue: Nobody is logged in, keeping queued write %s %s"), *Sent.Feature, *Sent.Key);
+            PlayerId.Reset();
+            ScheduleRetry();
+            return;
+        }
+
+        if (Result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            RetryDelaySeconds = 0.0;
+            NextDrainTime = 0.0;
+        }
+        else
+        {
+            // The backend rejected it, sending it again wouldn't help
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitOfflineWriteQueue: Dropping queued write %s %s, error 0x%x"), *Sent.Feature, *Sent.Key, Result.Result);
+        }
+
+        const FFeature* Registered = Features.Find(Sent.Feature);
+        if (Write->Version != Write->SentVersion && Registered != nullptr && Registered->Merge == EAwsGameKitOfflineWriteMerge::Add)
+        {
+            // Keep what was added while this write was in flight
+            Write->Value = LexToString(FCString::Atoi64(*Write->Value) - FCString::Atoi64(*Write->SentValue));
+            JournalOps.Add(FJournalOp{ Sent.PlayerId, Sent.Feature, Sent.Key, Write->Value, false });
+        }
+        else if (Write->Version == Write->SentVersion)
+        {
+            JournalOps.Add(FJournalOp{ Sent.PlayerId, Sent.Feature, Sent.Key, FString(), true });
+            Writes->Remove(Sent.Key);
+            if (Writes->Num() == 0)
+            {
+                PlayerWrites->Remove(Sent.Feature);
+                if (PlayerWrites->Num() == 0)
+                {
+                    Queued.Remove(Sent.PlayerId);
+                }
+            }
+        }
+    }
+
+    WriteJournal();
+}
+
+void FAwsGameKitOfflineWriteQueue::Merge(const FString& Owner, const FString& Feature, EAwsGameKitOfflineWriteMerge MergeMode, const FString& Key, const FString& Value)
+{
+    FQueuedWrite& Write = Queued.FindOrAdd(Owner).FindOrAdd(Feature).FindOrAdd(Key);
+    if (MergeMode == EAwsGameKitOfflineWriteMerge::Add)
+    {
+        Write.Value = LexToString(FCString::Atoi64(*Write.Value) + FCString::Atoi64(*Value));
+    }
+    else
+    {
+        Write.Value = Value;
+    }
+    ++Write.Version;
+    JournalOps.Add(FJournalOp{ Owner, Feature, Key, Write.Value, false });
+
+    UE_LOG(LogAwsGameKit, Verbose, TEXT("FAwsGameKitOfflineWriteQueue: Queued %s %s, %s pending"), *Feature, *Key, *Write.Value);
+}
+
+void FAwsGameKitOfflineWriteQueue::ScheduleRetry()
+{
+    // The writes in flight at the same time fail together, only back off once for them
+    const double Now = FPlatformTime::Seconds();
+    if (Now >= NextDrainTime)
+    {
+        RetryDelaySeconds = FAwsGameKitUserGameplayDataCircuitBreaker::GetDecorrelatedJitterDelay(
+            FMath::Max(1, CVarGameKitOfflineQueueRetryIntervalSeconds.GetValueOnAnyThread()), MAX_RETRY_INTERVAL_SECONDS, RetryDelaySeconds);
+        NextDrainTime = Now + RetryDelaySeconds;
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitOfflineWriteQueue: Draining again in %.1f seconds"), RetryDelaySeconds);
+    }
+}
+
+void FAwsGameKitOfflineWriteQueue::WriteJournal()
+{
+    // Taken first, so that the operations queued by several threads are written in the order they were queued
+    FScopeLock JournalLock(&JournalMutex);
+    TArray<FJournalOp> Ops;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Ops = MoveTemp(JournalOps);
+        JournalOps.Reset();
+    }
+
+    for (const FJournalOp& Op : Ops)
+    {
+        if (Op.bComplete)
+        {
+            Journal.Discard(Op.Feature, TArray<FString>{ Op.Key }, Op.PlayerId);
+        }
+        else
+        {
+            Journal.Append(Op.Feature, Op.Key, Op.Value, Op.PlayerId);
+        }
+    }
+}
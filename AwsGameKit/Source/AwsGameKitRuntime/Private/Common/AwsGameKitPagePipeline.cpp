@@ -0,0 +1,170 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitPagePipeline.h"
+
+// GameKit
+#include "AwsGameKitRuntimeInternalHelpers.h"
+
+// Unreal
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitRuntimePagePipelineDepth(
+    TEXT("GameKit.Runtime.PagePipelineDepth"),
+    2,
+    TEXT("Number of pages of a paginated list call (ListAchievementsForPlayer) which may wait to be decoded while the next page is requested.\n")
+    TEXT("0 decodes each page before the next one is requested.\n"),
+    ECVF_Default);
+
+namespace
+{
+    enum class EDrainer : uint8
+    {
+        // No page is pending
+        Idle,
+
+        // A worker was asked to decode the pending pages but didn't start yet
+        Queued,
+
+        // Pages are being decoded, by a worker or by the thread which submitted them
+        Running
+    };
+}
+
+struct FAwsGameKitPagePipeline::FState
+{
+    FState() :
+        Depth(FMath::Max(0, CVarGameKitRuntimePagePipelineDepth.GetValueOnAnyThread())),
+        PageDecoded(FPlatformProcess::GetSynchEventFromPool(false))
+    {}
+
+    ~FState()
+    {
+        FPlatformProcess::ReturnSynchEventToPool(PageDecoded);
+    }
+
+    // Claims the decoding for a worker which was queued. False when the submitting thread took it over in the meantime.
+    bool ClaimQueued()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (Drainer != EDrainer::Queued)
+        {
+            return false;
+        }
+        Drainer = EDrainer::Running;
+        return true;
+    }
+
+    // Decodes pages in order until none are pending. The caller must have set Drainer to Running.
+    void Drain()
+    {
+        for (;;)
+        {
+            TUniqueFunction<void()> Page;
+            {
+                FScopeLock ScopeLock(&Mutex);
+                if (Pages.Num() == 0)
+                {
+                    Drainer = EDrainer::Idle;
+                    break;
+                }
+                Page = MoveTemp(Pages[0]);
+                Pages.RemoveAt(0, 1, false);
+            }
+
+            Page();
+            PageDecoded->Trigger();
+        }
+
+        PageDecoded->Trigger();
+    }
+
+    // Waits until no more than MaxPending pages are pending, decoding them on the calling thread if no worker picked them up
+    void WaitForPending(int32 MaxPending)
+    {
+        for (;;)
+        {
+            bool bTakeOver = false;
+            {
+                FScopeLock ScopeLock(&Mutex);
+                if (Pages.Num() <= MaxPending && (MaxPending > 0 || Drainer != EDrainer::Running))
+                {
+                    return;
+                }
+                if (Drainer == EDrainer::Queued)
+                {
+                    // The pool is busy, don't wait for it
+                    Drainer = EDrainer::Running;
+                    bTakeOver = true;
+                }
+            }
+
+            if (bTakeOver)
+            {
+                Drain();
+            }
+            else
+            {
+                PageDecoded->Wait();
+            }
+        }
+    }
+
+    const int32 Depth;
+    FEvent* const PageDecoded;
+    FCriticalSection Mutex;
+    TArray<TUniqueFunction<void()>> Pages;
+    EDrainer Drainer = EDrainer::Idle;
+};
+
+FAwsGameKitPagePipeline::FAwsGameKitPagePipeline() :
+    State(MakeShared<FState, ESPMode::ThreadSafe>())
+{}
+
+FAwsGameKitPagePipeline::~FAwsGameKitPagePipeline()
+{
+    Wait();
+}
+
+void FAwsGameKitPagePipeline::Submit(TUniqueFunction<void()>&& DecodePage)
+{
+    if (State->Depth == 0)
+    {
+        DecodePage();
+        return;
+    }
+
+    bool bStartDrainer = false;
+    {
+        FScopeLock ScopeLock(&State->Mutex);
+        State->Pages.Add(MoveTemp(DecodePage));
+        if (State->Drainer == EDrainer::Idle)
+        {
+            State->Drainer = EDrainer::Queued;
+            bStartDrainer = true;
+        }
+    }
+
+    if (bStartDrainer)
+    {
+        // Holds the state, a worker which starts after the pipeline is gone finds nothing to do
+        InternalAwsGameKitRunLambdaOnWorkThread([State = State]
+        {
+            if (State->ClaimQueued())
+            {
+                State->Drain();
+            }
+        });
+    }
+
+    State->WaitForPending(State->Depth);
+}
+
+void FAwsGameKitPagePipeline::Wait()
+{
+    State->WaitForPending(0);
+}
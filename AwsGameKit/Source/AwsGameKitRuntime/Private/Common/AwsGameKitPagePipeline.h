@@ -0,0 +1,46 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Decoding of the pages of paginated list calls while the next page is in flight, see FAwsGameKitPagePipeline.
+
+#pragma once
+
+// Unreal
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * @brief Moves the decoding of the pages of a paginated list call off the thread which fetches them.
+ *
+ * @details The GameKit client library requests the next page of a list only after the dispatcher of the current page returned.
+ * Hand the decoding of each page to Submit() instead of doing it in the dispatcher: the dispatcher returns as soon as the raw page is copied,
+ * so the next page is requested while the current one is decoded. Pages are decoded one after the other, in the order they were submitted.
+ *
+ * At most GameKit.Runtime.PagePipelineDepth pages wait to be decoded; Submit() blocks while that many are pending. With a depth of 0 each
+ * page is decoded right away on the calling thread. Call Wait() before using what the pages produced, and before the pipeline goes out of scope.
+ *
+ * The caller's FAwsGameKitCancellationScope and FAwsGameKitWorkerCompletionScope are carried over to the decoding.
+ * Submit() and Wait() must be called from one thread.
+ */
+class FAwsGameKitPagePipeline
+{
+public:
+    FAwsGameKitPagePipeline();
+    ~FAwsGameKitPagePipeline();
+
+    UE_NONCOPYABLE(FAwsGameKitPagePipeline);
+
+    /**
+     * @brief Queue the decoding of one page.
+     */
+    void Submit(TUniqueFunction<void()>&& DecodePage);
+
+    /**
+     * @brief Wait until every submitted page is decoded. The remaining pages are decoded on the calling thread if no worker picked them up yet.
+     */
+    void Wait();
+
+private:
+    struct FState;
+    TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
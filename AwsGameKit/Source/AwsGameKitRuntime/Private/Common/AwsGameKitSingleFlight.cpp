@@ -0,0 +1,18 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitSingleFlight.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitRuntimeDeduplicateReads(
+    TEXT("GameKit.Runtime.DeduplicateReads"),
+    1,
+    TEXT("If 1, GetBundle, GetAchievementForPlayer and GetSlotSyncStatus calls made while an identical call is in flight share its result instead of sending their own request.\n"),
+    ECVF_Default);
+
+bool InternalAwsGameKitIsSingleFlightEnabled()
+{
+    return CVarGameKitRuntimeDeduplicateReads.GetValueOnAnyThread() != 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Deduplication of identical reads which are in flight at the same time, see TAwsGameKitSingleFlight.
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * @brief Whether reads are deduplicated, set with GameKit.Runtime.DeduplicateReads.
+ */
+bool InternalAwsGameKitIsSingleFlightEnabled();
+
+/**
+ * @brief Lets identical reads share one backend call while it's in flight.
+ *
+ * @details The first caller of Join() for a key leads: it starts the read and hands the outcome to Complete(). Callers which join the same key
+ * before Complete() is called don't start a read, their delegate is called with the leader's result instead. All the delegates of a read are
+ * called on the game thread, one after the other in the order they joined, through a single completion.
+ *
+ * Reads are shared per player: the key is qualified by the player of the current FAwsGameKitPlayerScope, so that two players reading the same
+ * key each get their own result. Complete() must be called with the same player in scope as Join(), which is the case on the worker threads
+ * the call dispatched its work to.
+ *
+ * Only use it for reads whose result doesn't depend on the caller beyond the key and the player. All methods are thread safe.
+ */
+template <typename ValueType>
+class TAwsGameKitSingleFlight
+{
+public:
+    typedef TAwsGameKitDelegate<const IntResult&, const ValueType&> FResultDelegate;
+
+    /**
+     * @brief Attach ResultDelegate to the read of Key.
+     *
+     * @param bOutTracked Set to whether other callers can join the read the caller leads, false when GameKit.Runtime.DeduplicateReads is 0
+     * or the caller is inside an FAwsGameKitCancellationScope.
+     * @return True when no read of Key was in flight, the caller must then start it and call Complete() with bOutTracked. False when ResultDelegate
+     * was attached to the read in flight.
+     */
+    bool Join(const FString& Key, const FResultDelegate& ResultDelegate, bool& bOutTracked)
+    {
+        // A call which may be abandoned through its cancellation token might never complete the read
+        bOutTracked = InternalAwsGameKitIsSingleFlightEnabled() && !FAwsGameKitCancellationScope::GetCurrent().IsValid();
+        if (!bOutTracked)
+        {
+            return true;
+        }
+
+        const FFlightKey FlightKey{ FAwsGameKitPlayerScope::GetCurrent(), Key };
+        FScopeLock Lock(&Mutex);
+        if (TArray<FResultDelegate>* Waiters = Flights.Find(FlightKey))
+        {
+            Waiters->Add(ResultDelegate);
+            return false;
+        }
+
+        Flights.Add(FlightKey).Add(ResultDelegate);
+        return true;
+    }
+
+    /**
+     * @brief End the read of Key, and call ResultDelegate and the delegates which joined it on the game thread with Result and Value.
+     */
+    void Complete(const FString& Key, bool bTracked, const FResultDelegate& ResultDelegate, const IntResult& Result, ValueType&& Value)
+    {
+        TArray<FResultDelegate> Waiters;
+        if (bTracked)
+        {
+            // The leader's own delegate was added first by Join()
+            const FFlightKey FlightKey{ FAwsGameKitPlayerScope::GetCurrent(), Key };
+            FScopeLock Lock(&Mutex);
+            Flights.RemoveAndCopyValue(FlightKey, Waiters);
+        }
+        else
+        {
+            Waiters.Add(ResultDelegate);
+        }
+
+        InternalAwsGameKitTraceStatus(Result);
+        FAwsGameKitCompletionQueue::Get().Enqueue([Waiters = MoveTemp(Waiters), Result, Value = MoveTemp(Value)]
+        {
+            for (const FResultDelegate& Waiter : Waiters)
+            {
+                Waiter.ExecuteIfBound(Result, Value);
+            }
+        });
+    }
+
+private:
+    struct FFlightKey
+    {
+        FAwsGameKitPlayerHandle Player;
+        FString Key;
+
+        bool operator==(const FFlightKey& Other) const
+        {
+            return Player == Other.Player && Key == Other.Key;
+        }
+
+        friend uint32 GetTypeHash(const FFlightKey& FlightKey)
+        {
+            return HashCombine(GetTypeHash(FlightKey.Player), GetTypeHash(FlightKey.Key));
+        }
+    };
+
+    FCriticalSection Mutex;
+    TMap<FFlightKey, TArray<FResultDelegate>> Flights;
+};
@@ -0,0 +1,180 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitStats.h"
+
+// GameKit
+#include "Common/AwsGameKitWorkerPool.h"
+
+// Standard library
+#include <atomic>
+
+DEFINE_STAT(STAT_AwsGameKit_InFlightAchievements);
+DEFINE_STAT(STAT_AwsGameKit_InFlightGameSaving);
+DEFINE_STAT(STAT_AwsGameKit_InFlightIdentity);
+DEFINE_STAT(STAT_AwsGameKit_InFlightUserGameplayData);
+DEFINE_STAT(STAT_AwsGameKit_WorkerPoolQueueDepth);
+DEFINE_STAT(STAT_AwsGameKit_WorkerPoolWaitInteractive);
+DEFINE_STAT(STAT_AwsGameKit_WorkerPoolWaitNormal);
+DEFINE_STAT(STAT_AwsGameKit_WorkerPoolWaitBackground);
+DEFINE_STAT(STAT_AwsGameKit_RetryQueueSize);
+DEFINE_STAT(STAT_AwsGameKit_DelegatesDispatched);
+DEFINE_STAT(STAT_AwsGameKit_GameThreadCallbacks);
+DEFINE_STAT(STAT_AwsGameKit_BytesUploaded);
+DEFINE_STAT(STAT_AwsGameKit_BytesDownloaded);
+DEFINE_STAT(STAT_AwsGameKit_CacheBytes);
+DEFINE_STAT(STAT_AwsGameKit_AchievementsCacheHitRate);
+DEFINE_STAT(STAT_AwsGameKit_IdentityUserCacheHitRate);
+DEFINE_STAT(STAT_AwsGameKit_UserGameplayDataCacheHitRate);
+
+CSV_DEFINE_CATEGORY_MODULE(AWSGAMEKITRUNTIME_API, AwsGameKit, true);
+
+namespace
+{
+    constexpr int32 NumFeatures = static_cast<int32>(EAwsGameKitStatsFeature::Num);
+    constexpr int32 NumCaches = static_cast<int32>(EAwsGameKitStatsCache::Num);
+    constexpr int32 NumLanes = static_cast<int32>(EAwsGameKitWorkLane::Num);
+
+    std::atomic<int32> InFlight[NumFeatures];
+    std::atomic<int32> RetryQueueSize{ 0 };
+    std::atomic<int64> CacheBytes{ 0 };
+
+    // Since the last RecordFrame()
+    std::atomic<int64> FrameBytesUploaded{ 0 };
+    std::atomic<int64> FrameBytesDownloaded{ 0 };
+    std::atomic<int32> FrameDelegatesDispatched{ 0 };
+    std::atomic<float> FrameMaxWorkerPoolWaitMs[NumLanes];
+    std::atomic<int32> FrameCacheHits[NumCaches];
+    std::atomic<int32> FrameCacheMisses[NumCaches];
+
+    // Since the game started, for the hit rates
+    std::atomic<int64> TotalCacheHits[NumCaches];
+    std::atomic<int64> TotalCacheLookups[NumCaches];
+}
+
+void FAwsGameKitStats::RequestStarted(EAwsGameKitStatsFeature Feature)
+{
+    InFlight[static_cast<int32>(Feature)].fetch_add(1, std::memory_order_relaxed);
+
+    switch (Feature)
+    {
+    case EAwsGameKitStatsFeature::Achievements: INC_DWORD_STAT(STAT_AwsGameKit_InFlightAchievements); break;
+    case EAwsGameKitStatsFeature::GameSaving: INC_DWORD_STAT(STAT_AwsGameKit_InFlightGameSaving); break;
+    case EAwsGameKitStatsFeature::Identity: INC_DWORD_STAT(STAT_AwsGameKit_InFlightIdentity); break;
+    case EAwsGameKitStatsFeature::UserGameplayData: INC_DWORD_STAT(STAT_AwsGameKit_InFlightUserGameplayData); break;
+    default: break;
+    }
+}
+
+void FAwsGameKitStats::RequestFinished(EAwsGameKitStatsFeature Feature)
+{
+    InFlight[static_cast<int32>(Feature)].fetch_sub(1, std::memory_order_relaxed);
+
+    switch (Feature)
+    {
+    case EAwsGameKitStatsFeature::Achievements: DEC_DWORD_STAT(STAT_AwsGameKit_InFlightAchievements); break;
+    case EAwsGameKitStatsFeature::GameSaving: DEC_DWORD_STAT(STAT_AwsGameKit_InFlightGameSaving); break;
+    case EAwsGameKitStatsFeature::Identity: DEC_DWORD_STAT(STAT_AwsGameKit_InFlightIdentity); break;
+    case EAwsGameKitStatsFeature::UserGameplayData: DEC_DWORD_STAT(STAT_AwsGameKit_InFlightUserGameplayData); break;
+    default: break;
+    }
+}
+
+void FAwsGameKitStats::AddBytesUploaded(int64 Bytes)
+{
+    FrameBytesUploaded.fetch_add(Bytes, std::memory_order_relaxed);
+    INC_MEMORY_STAT_BY(STAT_AwsGameKit_BytesUploaded, Bytes);
+}
+
+void FAwsGameKitStats::AddBytesDownloaded(int64 Bytes)
+{
+    FrameBytesDownloaded.fetch_add(Bytes, std::memory_order_relaxed);
+    INC_MEMORY_STAT_BY(STAT_AwsGameKit_BytesDownloaded, Bytes);
+}
+
+void FAwsGameKitStats::RecordWorkerPoolWait(EAwsGameKitWorkLane Lane, double Seconds)
+{
+    static const FName WaitHistograms[NumLanes] = { TEXT("WorkerPool.Wait.Interactive"), TEXT("WorkerPool.Wait.Normal"), TEXT("WorkerPool.Wait.Background") };
+
+    const int32 Index = static_cast<int32>(Lane);
+    const float WaitMs = static_cast<float>(Seconds * 1000.0);
+    float FrameMax = FrameMaxWorkerPoolWaitMs[Index].load(std::memory_order_relaxed);
+    while (WaitMs > FrameMax && !FrameMaxWorkerPoolWaitMs[Index].compare_exchange_weak(FrameMax, WaitMs, std::memory_order_relaxed))
+    {
+    }
+    FAwsGameKitLatencyHistograms::Get().Record(WaitHistograms[Index], Seconds);
+
+    switch (Lane)
+    {
+    case EAwsGameKitWorkLane::Interactive: SET_FLOAT_STAT(STAT_AwsGameKit_WorkerPoolWaitInteractive, WaitMs); break;
+    case EAwsGameKitWorkLane::Normal: SET_FLOAT_STAT(STAT_AwsGameKit_WorkerPoolWaitNormal, WaitMs); break;
+    case EAwsGameKitWorkLane::Background: SET_FLOAT_STAT(STAT_AwsGameKit_WorkerPoolWaitBackground, WaitMs); break;
+    default: break;
+    }
+}
+
+void FAwsGameKitStats::SetRetryQueueSize(int32 QueuedCalls)
+{
+    RetryQueueSize.store(QueuedCalls, std::memory_order_relaxed);
+    SET_DWORD_STAT(STAT_AwsGameKit_RetryQueueSize, QueuedCalls);
+}
+
+void FAwsGameKitStats::SetCacheBytes(int64 Bytes)
+{
+    CacheBytes.store(Bytes, std::memory_order_relaxed);
+    SET_MEMORY_STAT(STAT_AwsGameKit_CacheBytes, Bytes);
+}
+
+void FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache Cache, bool bHit)
+{
+    const int32 Index = static_cast<int32>(Cache);
+    (bHit ? FrameCacheHits : FrameCacheMisses)[Index].fetch_add(1, std::memory_order_relaxed);
+
+    const int64 Hits = TotalCacheHits[Index].fetch_add(bHit ? 1 : 0, std::memory_order_relaxed) + (bHit ? 1 : 0);
+    const int64 Lookups = TotalCacheLookups[Index].fetch_add(1, std::memory_order_relaxed) + 1;
+    const float HitRate = 100.0f * Hits / Lookups;
+
+    switch (Cache)
+    {
+    case EAwsGameKitStatsCache::Achievements: SET_FLOAT_STAT(STAT_AwsGameKit_AchievementsCacheHitRate, HitRate); break;
+    case EAwsGameKitStatsCache::IdentityUser: SET_FLOAT_STAT(STAT_AwsGameKit_IdentityUserCacheHitRate, HitRate); break;
+    case EAwsGameKitStatsCache::UserGameplayData: SET_FLOAT_STAT(STAT_AwsGameKit_UserGameplayDataCacheHitRate, HitRate); break;
+    default: break;
+    }
+}
+
+void FAwsGameKitStats::RecordDelegatesDispatched(int32 Count)
+{
+    FrameDelegatesDispatched.fetch_add(Count, std::memory_order_relaxed);
+    INC_DWORD_STAT_BY(STAT_AwsGameKit_DelegatesDispatched, Count);
+}
+
+void FAwsGameKitStats::RecordFrame()
+{
+#if CSV_PROFILER
+    // The per-frame values are reset even when no capture is running, so that a capture doesn't start with everything since the last one
+    CSV_CUSTOM_STAT(AwsGameKit, InFlightAchievements, InFlight[static_cast<int32>(EAwsGameKitStatsFeature::Achievements)].load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, InFlightGameSaving, InFlight[static_cast<int32>(EAwsGameKitStatsFeature::GameSaving)].load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, InFlightIdentity, InFlight[static_cast<int32>(EAwsGameKitStatsFeature::Identity)].load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, InFlightUserGameplayData, InFlight[static_cast<int32>(EAwsGameKitStatsFeature::UserGameplayData)].load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, WorkerPoolQueueDepth, FAwsGameKitWorkerPool::Get().GetQueueDepth(), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, WorkerPoolWaitInteractiveMs, FrameMaxWorkerPoolWaitMs[static_cast<int32>(EAwsGameKitWorkLane::Interactive)].exchange(0.0f, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, WorkerPoolWaitNormalMs, FrameMaxWorkerPoolWaitMs[static_cast<int32>(EAwsGameKitWorkLane::Normal)].exchange(0.0f, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, WorkerPoolWaitBackgroundMs, FrameMaxWorkerPoolWaitMs[static_cast<int32>(EAwsGameKitWorkLane::Background)].exchange(0.0f, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, RetryQueueSize, RetryQueueSize.load(std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, CacheKB, CacheBytes.load(std::memory_order_relaxed) / 1024.0f, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, DelegatesDispatched, FrameDelegatesDispatched.exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, KBUploaded, FrameBytesUploaded.exchange(0, std::memory_order_relaxed) / 1024.0f, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, KBDownloaded, FrameBytesDownloaded.exchange(0, std::memory_order_relaxed) / 1024.0f, ECsvCustomStatOp::Set);
+
+    const int32 Achievements = static_cast<int32>(EAwsGameKitStatsCache::Achievements);
+    const int32 IdentityUser = static_cast<int32>(EAwsGameKitStatsCache::IdentityUser);
+    const int32 UserGameplayData = static_cast<int32>(EAwsGameKitStatsCache::UserGameplayData);
+    CSV_CUSTOM_STAT(AwsGameKit, AchievementsCacheHits, FrameCacheHits[Achievements].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, AchievementsCacheMisses, FrameCacheMisses[Achievements].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, IdentityUserCacheHits, FrameCacheHits[IdentityUser].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, IdentityUserCacheMisses, FrameCacheMisses[IdentityUser].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, UserGameplayDataCacheHits, FrameCacheHits[UserGameplayData].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AwsGameKit, UserGameplayDataCacheMisses, FrameCacheMisses[UserGameplayData].exchange(0, std::memory_order_relaxed), ECsvCustomStatOp::Set);
+#endif
+}
@@ -0,0 +1,224 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitTraffic.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+static TAutoConsoleVariable<float> CVarGameKitTrafficReplayLatencyScale(
+    TEXT("GameKit.Traffic.ReplayLatencyScale"),
+    1.0f,
+    TEXT("Multiplier of the recorded latency of the GameKit calls replayed with -GameKitReplayTraffic. 0 answers immediately.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // "GKTR"
+    const uint32 TRAFFIC_FILE_MAGIC = 0x52544B47;
+    const uint32 TRAFFIC_FILE_VERSION = 1;
+}
+
+FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficSlot& Slot)
+{
+    Ar << Slot.SlotName;
+    Ar << Slot.MetadataLocal;
+    Ar << Slot.MetadataCloud;
+    Ar << Slot.SizeLocal;
+    Ar << Slot.SizeCloud;
+    Ar << Slot.LastModifiedLocal;
+    Ar << Slot.LastModifiedCloud;
+    Ar << Slot.LastSync;
+    Ar << Slot.SlotSyncStatus;
+    return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficCallback& Callback)
+{
+    Ar << Callback.Strings;
+    Ar << Callback.CachedSlots;
+    Ar << Callback.bHasSlot;
+    if (Callback.bHasSlot)
+    {
+        Ar << Callback.Slot;
+    }
+    Ar << Callback.Data;
+    Ar << Callback.bComplete;
+    Ar << Callback.CallStatus;
+    return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficExchange& Exchange)
+{
+    Ar << Exchange.Api;
+    Ar << Exchange.Key;
+    Ar << Exchange.Status;
+    Ar << Exchange.StartSeconds;
+    Ar << Exchange.LatencySeconds;
+    Ar << Exchange.Outputs;
+    Ar << Exchange.Callbacks;
+    return Ar;
+}
+
+FAwsGameKitTraffic& FAwsGameKitTraffic::Get()
+{
+    static FAwsGameKitTraffic Instance;
+    return Instance;
+}
+
+void FAwsGameKitTraffic::Startup()
+{
+    FScopeLock Lock(&Mutex);
+    if (Mode != EAwsGameKitTrafficMode::Off)
+    {
+        return;
+    }
+
+    if (FParse::Value(FCommandLine::Get(), TEXT("GameKitRecordTraffic="), FilePath))
+    {
+        FilePath = FPaths::ConvertRelativePathToFull(FilePath);
+        Writer.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+        if (!Writer.IsValid())
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitTraffic::Startup(): Can't create %s, the GameKit calls won't be recorded"), *FilePath);
+            return;
+        }
+
+        uint32 Magic = TRAFFIC_FILE_MAGIC;
+        uint32 Version = TRAFFIC_FILE_VERSION;
+        *Writer << Magic;
+        *Writer << Version;
+
+        Mode = EAwsGameKitTrafficMode::Record;
+        RecordingStartTime = FPlatformTime::Seconds();
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitTraffic::Startup(): Recording the GameKit calls to %s"), *FilePath);
+    }
+    else if (FParse::Value(FCommandLine::Get(), TEXT("GameKitReplayTraffic="), FilePath))
+    {
+        FilePath = FPaths::ConvertRelativePathToFull(FilePath);
+        TArray<uint8> Contents;
+        if (!FFileHelper::LoadFileToArray(Contents, *FilePath))
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitTraffic::Startup(): Can't read %s, the GameKit calls won't be replayed"), *FilePath);
+            return;
+        }
+
+        FMemoryReader Reader(Contents);
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        Reader << Magic;
+        Reader << Version;
+        if (Magic != TRAFFIC_FILE_MAGIC || Version != TRAFFIC_FILE_VERSION)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitTraffic::Startup(): %s isn't a version %u GameKit traffic recording, the GameKit calls won't be replayed"), *FilePath, TRAFFIC_FILE_VERSION);
+            return;
+        }
+
+        // A recording cut short by a crash ends with a partial call, which is dropped
+        int32 Exchanges = 0;
+        while (!Reader.AtEnd())
+        {
+            FAwsGameKitTrafficExchange Exchange;
+            Reader << Exchange;
+            if (Reader.IsError())
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitTraffic::Startup(): %s is truncated after %d calls"), *FilePath, Exchanges);
+                break;
+            }
+
+            ReplayQueues.FindOrAdd(GetQueueName(*Exchange.Api, Exchange.Key)).Add(MoveTemp(Exchange));
+            ++Exchanges;
+        }
+
+        Mode = EAwsGameKitTrafficMode::Replay;
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitTraffic::Startup(): Replaying %d GameKit calls from %s"), Exchanges, *FilePath);
+    }
+}
+
+void FAwsGameKitTraffic::Shutdown()
+{
+    FScopeLock Lock(&Mutex);
+    if (Writer.IsValid())
+    {
+        Writer->Close();
+        Writer.Reset();
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitTraffic::Shutdown(): Recorded %d GameKit calls to %s"), RecordedExchanges, *FilePath);
+    }
+
+    // The mode is kept: the wrappers created for it may still be called until the libraries are released
+    ReplayQueues.Empty();
+    ReplayPositions.Empty();
+}
+
+uint32 FAwsGameKitTraffic::Record(FAwsGameKitTrafficExchange& Exchange, double StartTime)
+{
+    if (Mode != EAwsGameKitTrafficMode::Record)
+    {
+        return Exchange.Status;
+    }
+
+    Exchange.StartSeconds = StartTime - RecordingStartTime;
+    Exchange.LatencySeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+
+    FScopeLock Lock(&Mutex);
+    if (Writer.IsValid())
+    {
+        *Writer << Exchange;
+        ++RecordedExchanges;
+    }
+
+    return Exchange.Status;
+}
+
+bool FAwsGameKitTraffic::Replay(const TCHAR* Api, const FString& Key, FAwsGameKitTrafficExchange& OutExchange)
+{
+    if (Mode != EAwsGameKitTrafficMode::Replay)
+    {
+        return false;
+    }
+
+    {
+        FScopeLock Lock(&Mutex);
+        const FString QueueName = GetQueueName(Api, Key);
+        const TArray<FAwsGameKitTrafficExchange>* Queue = ReplayQueues.Find(QueueName);
+        int32& Position = ReplayPositions.FindOrAdd(QueueName);
+        if (Queue == nullptr || Position >= Queue->Num())
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitTraffic::Replay(): %s was called %d times, more than in the recording"), *QueueName, Position + 1);
+            ++Position;
+            OutExchange = FAwsGameKitTrafficExchange();
+            OutExchange.Api = Api;
+            OutExchange.Key = Key;
+            OutExchange.Status = GameKit::GAMEKIT_ERROR_GENERAL;
+            return true;
+        }
+
+        OutExchange = (*Queue)[Position++];
+    }
+
+    const float LatencyScale = FMath::Max(0.0f, CVarGameKitTrafficReplayLatencyScale.GetValueOnAnyThread());
+    if (LatencyScale > 0.0f && OutExchange.LatencySeconds > 0.0f)
+    {
+        FPlatformProcess::SleepNoStats(OutExchange.LatencySeconds * LatencyScale);
+    }
+
+    return true;
+}
+
+FString FAwsGameKitTraffic::GetQueueName(const TCHAR* Api, const FString& Key)
+{
+    return Key.IsEmpty() ? FString(Api) : FString::Printf(TEXT("%s(%s)"), Api, *Key);
+}
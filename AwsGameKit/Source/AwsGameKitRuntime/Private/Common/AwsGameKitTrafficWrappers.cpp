@@ -0,0 +1,535 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitTrafficWrappers.h"
+
+// GameKit
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitTraffic.h"
+#include "Core/AwsGameKitDispatcher.h"
+
+// Unreal
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    FString ToFString(const char* Str)
+    {
+        return Str != nullptr ? FString(UTF8_TO_TCHAR(Str)) : FString();
+    }
+
+    // A call which only returns a status
+    template <typename CallFunc>
+    unsigned int RecordStatus(const TCHAR* Api, const FString& Key, CallFunc Call)
+    {
+        FAwsGameKitTrafficExchange Exchange;
+        if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+        {
+            return Exchange.Status;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        Exchange.Api = Api;
+        Exchange.Key = Key;
+        Exchange.Status = Call();
+        return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+    }
+
+    // A call which answers with one string per callback
+    template <typename CallFunc>
+    unsigned int RecordStringCallbacks(const TCHAR* Api, const FString& Key, DISPATCH_RECEIVER_HANDLE Receiver, void(*ResponseCallback)(DISPATCH_RECEIVER_HANDLE, const char*), CallFunc Call)
+    {
+        FAwsGameKitTrafficExchange Exchange;
+        if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+        {
+            for (const FAwsGameKitTrafficCallback& Callback : Exchange.Callbacks)
+            {
+                ResponseCallback(Receiver, Callback.Strings.Num() > 0 ? TCHAR_TO_UTF8(*Callback.Strings[0]) : "");
+            }
+            return Exchange.Status;
+        }
+
+        auto recorder = [&Exchange, Receiver, ResponseCallback](const char* response)
+        {
+            Exchange.Callbacks.AddDefaulted_GetRef().Strings.Add(ToFString(response));
+            ResponseCallback(Receiver, response);
+        };
+        typedef LambdaDispatcher<decltype(recorder), void, const char*> Recorder;
+
+        const double StartTime = FPlatformTime::Seconds();
+        Exchange.Api = Api;
+        Exchange.Key = Key;
+        Exchange.Status = Call((void*)&recorder, Recorder::Dispatch);
+        return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+    }
+
+    FAwsGameKitTrafficSlot ToTrafficSlot(const Slot& slot)
+    {
+        FAwsGameKitTrafficSlot TrafficSlot;
+        TrafficSlot.SlotName = ToFString(slot.slotName);
+        TrafficSlot.MetadataLocal = ToFString(slot.metadataLocal);
+        TrafficSlot.MetadataCloud = ToFString(slot.metadataCloud);
+        TrafficSlot.SizeLocal = slot.sizeLocal;
+        TrafficSlot.SizeCloud = slot.sizeCloud;
+        TrafficSlot.LastModifiedLocal = slot.lastModifiedLocal;
+        TrafficSlot.LastModifiedCloud = slot.lastModifiedCloud;
+        TrafficSlot.LastSync = slot.lastSync;
+        TrafficSlot.SlotSyncStatus = static_cast<uint8>(slot.slotSyncStatus);
+        return TrafficSlot;
+    }
+
+    void RecordSlots(FAwsGameKitTrafficCallback& Callback, const Slot* cachedSlots, unsigned int slotCount, const Slot* slot)
+    {
+        Callback.CachedSlots.Reserve(slotCount);
+        for (unsigned int i = 0; i < slotCount; ++i)
+        {
+            Callback.CachedSlots.Add(ToTrafficSlot(cachedSlots[i]));
+        }
+
+        Callback.bHasSlot = slot != nullptr;
+        if (slot != nullptr)
+        {
+            Callback.Slot = ToTrafficSlot(*slot);
+        }
+    }
+
+    // The plain C slots of a replayed callback. The strings live as long as this object.
+    class FReplayedSlots
+    {
+    public:
+        explicit FReplayedSlots(const FAwsGameKitTrafficCallback& Callback)
+        {
+            CachedSlots.Reserve(Callback.CachedSlots.Num());
+            for (const FAwsGameKitTrafficSlot& TrafficSlot : Callback.CachedSlots)
+            {
+                CachedSlots.Add(ToSlot(TrafficSlot));
+            }
+
+            if (Callback.bHasSlot)
+            {
+                ActedOnSlot = ToSlot(Callback.Slot);
+            }
+            bHasSlot = Callback.bHasSlot;
+        }
+
+        const Slot* GetCachedSlots() const
+        {
+            return CachedSlots.GetData();
+        }
+
+        unsigned int GetSlotCount() const
+        {
+            return static_cast<unsigned int>(CachedSlots.Num());
+        }
+
+        const Slot* GetSlot() const
+        {
+            return bHasSlot ? &ActedOnSlot : nullptr;
+        }
+
+    private:
+        Slot ToSlot(const FAwsGameKitTrafficSlot& TrafficSlot)
+        {
+            Slot slot{};
+            slot.slotName = ConvertString(TrafficSlot.SlotName);
+            slot.metadataLocal = ConvertString(TrafficSlot.MetadataLocal);
+            slot.metadataCloud = ConvertString(TrafficSlot.MetadataCloud);
+            slot.sizeLocal = TrafficSlot.SizeLocal;
+            slot.sizeCloud = TrafficSlot.SizeCloud;
+            slot.lastModifiedLocal = TrafficSlot.LastModifiedLocal;
+            slot.lastModifiedCloud = TrafficSlot.LastModifiedCloud;
+            slot.lastSync = TrafficSlot.LastSync;
+            slot.slotSyncStatus = static_cast<decltype(slot.slotSyncStatus)>(TrafficSlot.SlotSyncStatus);
+            return slot;
+        }
+
+        FAwsGameKitInternalTempStrings ConvertString;
+        TArray<Slot> CachedSlots;
+        Slot ActedOnSlot{};
+        bool bHasSlot = false;
+    };
+
+    // GetSlotSyncStatus, DeleteSlot and SaveSlot
+    template <typename CallFunc>
+    unsigned int RecordSlotAction(const TCHAR* Api, const FString& Key, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, CallFunc Call)
+    {
+        FAwsGameKitTrafficExchange Exchange;
+        if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+        {
+            for (const FAwsGameKitTrafficCallback& Callback : Exchange.Callbacks)
+            {
+                const FReplayedSlots Slots(Callback);
+                resultCb(receiver, Slots.GetCachedSlots(), Slots.GetSlotCount(), Slots.GetSlot(), Callback.CallStatus);
+            }
+            return Exchange.Status;
+        }
+
+        auto recorder = [&Exchange, receiver, resultCb](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
+        {
+            FAwsGameKitTrafficCallback& Callback = Exchange.Callbacks.AddDefaulted_GetRef();
+            RecordSlots(Callback, cachedSlots, slotCount, slot);
+            Callback.CallStatus = callStatus;
+            resultCb(receiver, cachedSlots, slotCount, slot, callStatus);
+        };
+        typedef LambdaDispatcher<decltype(recorder), void, const Slot*, unsigned int, const Slot*, unsigned int> Recorder;
+
+        const double StartTime = FPlatformTime::Seconds();
+        Exchange.Api = Api;
+        Exchange.Key = Key;
+        Exchange.Status = Call((void*)&recorder, Recorder::Dispatch);
+        return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+    }
+
+    void RecordKeyValues(FAwsGameKitTrafficExchange& Exchange, const TMap<FString, FString>& KeyValues)
+    {
+        Exchange.Outputs.Reserve(KeyValues.Num() * 2);
+        for (const TPair<FString, FString>& KeyValue : KeyValues)
+        {
+            Exchange.Outputs.Add(KeyValue.Key);
+            Exchange.Outputs.Add(KeyValue.Value);
+        }
+    }
+
+    void ReplayKeyValues(const FAwsGameKitTrafficExchange& Exchange, TMap<FString, FString>& OutKeyValues)
+    {
+        OutKeyValues.Empty(Exchange.Outputs.Num() / 2);
+        for (int32 i = 0; i + 1 < Exchange.Outputs.Num(); i += 2)
+        {
+            OutKeyValues.Add(Exchange.Outputs[i], Exchange.Outputs[i + 1]);
+        }
+    }
+}
+
+// ------ Achievements ------
+
+unsigned int AwsGameKitTrafficAchievementsWrapper::GameKitListAchievements(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, unsigned int pageSize, bool waitForAllPages, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    return RecordStringCallbacks(TEXT("GameKitListAchievements"), FString(), receiver, responseCallback, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncDispatcherResponseCallback recorderCallback)
+    {
+        return AwsGameKitAchievementsWrapper::GameKitListAchievements(achievementsInstance, pageSize, waitForAllPages, recorder, recorderCallback);
+    });
+}
+
+unsigned int AwsGameKitTrafficAchievementsWrapper::GameKitUpdateAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, unsigned int incrementBy, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    return RecordStringCallbacks(TEXT("GameKitUpdateAchievement"), ToFString(achievementId), receiver, responseCallback, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncDispatcherResponseCallback recorderCallback)
+    {
+        return AwsGameKitAchievementsWrapper::GameKitUpdateAchievement(achievementsInstance, achievementId, incrementBy, recorder, recorderCallback);
+    });
+}
+
+unsigned int AwsGameKitTrafficAchievementsWrapper::GameKitGetAchievement(GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE achievementsInstance, const char* achievementId, DISPATCH_RECEIVER_HANDLE receiver, FuncDispatcherResponseCallback responseCallback)
+{
+    return RecordStringCallbacks(TEXT("GameKitGetAchievement"), ToFString(achievementId), receiver, responseCallback, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncDispatcherResponseCallback recorderCallback)
+    {
+        return AwsGameKitAchievementsWrapper::GameKitGetAchievement(achievementsInstance, achievementId, recorder, recorderCallback);
+    });
+}
+
+// ------ Identity ------
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityRegister(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserRegistration userRegistration)
+{
+    return RecordStatus(TEXT("GameKitIdentityRegister"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityRegister(identityInstance, userRegistration); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityConfirmRegistration(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmRegistrationRequest request)
+{
+    return RecordStatus(TEXT("GameKitIdentityConfirmRegistration"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityConfirmRegistration(identityInstance, request); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityResendConfirmationCode(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ResendConfirmationCodeRequest request)
+{
+    return RecordStatus(TEXT("GameKitIdentityResendConfirmationCode"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityResendConfirmationCode(identityInstance, request); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityLogin(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserLogin userLogin)
+{
+    return RecordStatus(TEXT("GameKitIdentityLogin"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityLogin(identityInstance, userLogin); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityLogout(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
+{
+    return RecordStatus(TEXT("GameKitIdentityLogout"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityLogout(identityInstance); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityGetUser(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, DISPATCH_RECEIVER_HANDLE dispatchReceiver, FuncIdentityGetUserResponseCallback responseCallback)
+{
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(TEXT("GameKitIdentityGetUser"), FString(), Exchange))
+    {
+        for (const FAwsGameKitTrafficCallback& Callback : Exchange.Callbacks)
+        {
+            if (Callback.Strings.Num() < 7)
+            {
+                continue;
+            }
+
+            FAwsGameKitInternalTempStrings ConvertString;
+            GetUserResponse response{};
+            response.userId = ConvertString(Callback.Strings[0]);
+            response.createdAt = ConvertString(Callback.Strings[1]);
+            response.updatedAt = ConvertString(Callback.Strings[2]);
+            response.facebookExternalId = ConvertString(Callback.Strings[3]);
+            response.facebookRefId = ConvertString(Callback.Strings[4]);
+            response.userName = ConvertString(Callback.Strings[5]);
+            response.email = ConvertString(Callback.Strings[6]);
+            responseCallback(dispatchReceiver, &response);
+        }
+        return Exchange.Status;
+    }
+
+    auto recorder = [&Exchange, dispatchReceiver, responseCallback](const GetUserResponse* response)
+    {
+        if (response != nullptr)
+        {
+            Exchange.Callbacks.AddDefaulted_GetRef().Strings =
+            {
+                ToFString(response->userId),
+                ToFString(response->createdAt),
+                ToFString(response->updatedAt),
+                ToFString(response->facebookExternalId),
+                ToFString(response->facebookRefId),
+                ToFString(response->userName),
+                ToFString(response->email)
+            };
+        }
+        responseCallback(dispatchReceiver, response);
+    };
+    typedef LambdaDispatcher<decltype(recorder), void, const GetUserResponse*> Recorder;
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = TEXT("GameKitIdentityGetUser");
+    Exchange.Status = AwsGameKitIdentityWrapper::GameKitIdentityGetUser(identityInstance, (void*)&recorder, Recorder::Dispatch);
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ForgotPasswordRequest request)
+{
+    return RecordStatus(TEXT("GameKitIdentityForgotPassword"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityForgotPassword(identityInstance, request); });
+}
+
+unsigned int AwsGameKitTrafficIdentityWrapper::GameKitIdentityConfirmForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmForgotPasswordRequest request)
+{
+    return RecordStatus(TEXT("GameKitIdentityConfirmForgotPassword"), FString(), [&]() { return AwsGameKitIdentityWrapper::GameKitIdentityConfirmForgotPassword(identityInstance, request); });
+}
+
+// ------ User Gameplay Data ------
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitAddUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutUnprocessedItems, UserGameplayDataBundle userGameplayDataBundle)
+{
+    const TCHAR* Api = TEXT("GameKitAddUserGameplayData");
+    const FString Key = ToFString(userGameplayDataBundle.bundleName);
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+    {
+        ReplayKeyValues(Exchange, inOutUnprocessedItems);
+        return Exchange.Status;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Key = Key;
+    Exchange.Status = AwsGameKitUserGameplayDataWrapper::GameKitAddUserGameplayData(userGameplayDataInstance, inOutUnprocessedItems, userGameplayDataBundle);
+    RecordKeyValues(Exchange, inOutUnprocessedItems);
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle)
+{
+    const TCHAR* Api = TEXT("GameKitListUserGameplayDataBundles");
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, FString(), Exchange))
+    {
+        for (const FString& BundleName : Exchange.Outputs)
+        {
+            onBundle(TCHAR_TO_UTF8(*BundleName));
+        }
+        return Exchange.Status;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Status = AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundles(userGameplayDataInstance, [&Exchange, &onBundle](const char* bundleName)
+    {
+        Exchange.Outputs.Add(ToFString(bundleName));
+        onBundle(bundleName);
+    });
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem)
+{
+    const TCHAR* Api = TEXT("GameKitGetUserGameplayDataBundle");
+    const FString Key = ToFString(bundleName);
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+    {
+        for (int32 i = 0; i + 1 < Exchange.Outputs.Num(); i += 2)
+        {
+            onItem(TCHAR_TO_UTF8(*Exchange.Outputs[i]), TCHAR_TO_UTF8(*Exchange.Outputs[i + 1]));
+        }
+        return Exchange.Status;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Key = Key;
+    Exchange.Status = AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(userGameplayDataInstance, bundleName, [&Exchange, &onItem](const char* key, const char* value)
+    {
+        Exchange.Outputs.Add(ToFString(key));
+        Exchange.Outputs.Add(ToFString(value));
+        onItem(key, value);
+    });
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, FString& inOutData, UserGameplayDataBundleItem userGameplayDataBundleItem)
+{
+    const TCHAR* Api = TEXT("GameKitGetUserGameplayDataBundleItem");
+    const FString Key = ToFString(userGameplayDataBundleItem.bundleName) + TEXT(".") + ToFString(userGameplayDataBundleItem.bundleItemKey);
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+    {
+        inOutData = Exchange.Outputs.Num() > 0 ? Exchange.Outputs[0] : FString();
+        return Exchange.Status;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Key = Key;
+    Exchange.Status = AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleItem(userGameplayDataInstance, inOutData, userGameplayDataBundleItem);
+    Exchange.Outputs.Add(inOutData);
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitUpdateUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataBundleItemValue userGameplayDataBundleItemValue)
+{
+    const FString Key = ToFString(userGameplayDataBundleItemValue.bundleName) + TEXT(".") + ToFString(userGameplayDataBundleItemValue.bundleItemKey);
+    return RecordStatus(TEXT("GameKitUpdateUserGameplayDataBundleItem"), Key, [&]()
+    {
+        return AwsGameKitUserGameplayDataWrapper::GameKitUpdateUserGameplayDataBundleItem(userGameplayDataInstance, userGameplayDataBundleItemValue);
+    });
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitDeleteAllUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+    return RecordStatus(TEXT("GameKitDeleteAllUserGameplayData"), FString(), [&]()
+    {
+        return AwsGameKitUserGameplayDataWrapper::GameKitDeleteAllUserGameplayData(userGameplayDataInstance);
+    });
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName)
+{
+    return RecordStatus(TEXT("GameKitDeleteUserGameplayDataBundle"), ToFString(bundleName), [&]()
+    {
+        return AwsGameKitUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundle(userGameplayDataInstance, bundleName);
+    });
+}
+
+unsigned int AwsGameKitTrafficUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundleItems(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataDeleteItemsRequest deleteItemsRequest)
+{
+    return RecordStatus(TEXT("GameKitDeleteUserGameplayDataBundleItems"), ToFString(deleteItemsRequest.bundleName), [&]()
+    {
+        return AwsGameKitUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundleItems(userGameplayDataInstance, deleteItemsRequest);
+    });
+}
+
+// ------ Game Saving ------
+
+unsigned int AwsGameKitTrafficGameSavingWrapper::GameKitGetAllSlotSyncStatuses(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize)
+{
+    const TCHAR* Api = TEXT("GameKitGetAllSlotSyncStatuses");
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, FString(), Exchange))
+    {
+        for (const FAwsGameKitTrafficCallback& Callback : Exchange.Callbacks)
+        {
+            const FReplayedSlots Slots(Callback);
+            resultCb(receiver, Slots.GetCachedSlots(), Slots.GetSlotCount(), Callback.bComplete, Callback.CallStatus);
+        }
+        return Exchange.Status;
+    }
+
+    auto recorder = [&Exchange, receiver, resultCb](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
+    {
+        FAwsGameKitTrafficCallback& Callback = Exchange.Callbacks.AddDefaulted_GetRef();
+        RecordSlots(Callback, cachedSlots, slotCount, nullptr);
+        Callback.bComplete = complete;
+        Callback.CallStatus = callStatus;
+        resultCb(receiver, cachedSlots, slotCount, complete, callStatus);
+    };
+    typedef LambdaDispatcher<decltype(recorder), void, const Slot*, unsigned int, bool, unsigned int> Recorder;
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Status = AwsGameKitGameSavingWrapper::GameKitGetAllSlotSyncStatuses(gameSavingInstance, (void*)&recorder, Recorder::Dispatch, waitForAllPages, pageSize);
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
+
+unsigned int AwsGameKitTrafficGameSavingWrapper::GameKitGetSlotSyncStatus(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, const char* slotName)
+{
+    return RecordSlotAction(TEXT("GameKitGetSlotSyncStatus"), ToFString(slotName), receiver, resultCb, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncGameSavingSlotActionResponseCallback recorderCb)
+    {
+        return AwsGameKitGameSavingWrapper::GameKitGetSlotSyncStatus(gameSavingInstance, recorder, recorderCb, slotName);
+    });
+}
+
+unsigned int AwsGameKitTrafficGameSavingWrapper::GameKitDeleteSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, const char* slotName)
+{
+    return RecordSlotAction(TEXT("GameKitDeleteSlot"), ToFString(slotName), receiver, resultCb, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncGameSavingSlotActionResponseCallback recorderCb)
+    {
+        return AwsGameKitGameSavingWrapper::GameKitDeleteSlot(gameSavingInstance, recorder, recorderCb, slotName);
+    });
+}
+
+unsigned int AwsGameKitTrafficGameSavingWrapper::GameKitSaveSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingSlotActionResponseCallback resultCb, GameSavingModel& model)
+{
+    // The uploaded data isn't recorded, only its response
+    return RecordSlotAction(TEXT("GameKitSaveSlot"), ToFString(model.slotName), receiver, resultCb, [&](DISPATCH_RECEIVER_HANDLE recorder, FuncGameSavingSlotActionResponseCallback recorderCb)
+    {
+        return AwsGameKitGameSavingWrapper::GameKitSaveSlot(gameSavingInstance, recorder, recorderCb, model);
+    });
+}
+
+unsigned int AwsGameKitTrafficGameSavingWrapper::GameKitLoadSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncGameSavingDataResponseCallback resultCb, GameSavingModel& model)
+{
+    const TCHAR* Api = TEXT("GameKitLoadSlot");
+    const FString Key = ToFString(model.slotName);
+
+    FAwsGameKitTrafficExchange Exchange;
+    if (FAwsGameKitTraffic::Get().Replay(Api, Key, Exchange))
+    {
+        for (const FAwsGameKitTrafficCallback& Callback : Exchange.Callbacks)
+        {
+            const FReplayedSlots Slots(Callback);
+            resultCb(receiver, Slots.GetCachedSlots(), Slots.GetSlotCount(), Slots.GetSlot(), Callback.Data.GetData(), static_cast<unsigned int>(Callback.Data.Num()), Callback.CallStatus);
+        }
+        return Exchange.Status;
+    }
+
+    auto recorder = [&Exchange, receiver, resultCb](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
+    {
+        FAwsGameKitTrafficCallback& Callback = Exchange.Callbacks.AddDefaulted_GetRef();
+        RecordSlots(Callback, cachedSlots, slotCount, slot);
+        if (data != nullptr)
+        {
+            Callback.Data.Append(data, dataSize);
+        }
+        Callback.CallStatus = callStatus;
+        resultCb(receiver, cachedSlots, slotCount, slot, data, dataSize, callStatus);
+    };
+    typedef LambdaDispatcher<decltype(recorder), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Recorder;
+
+    const double StartTime = FPlatformTime::Seconds();
+    Exchange.Api = Api;
+    Exchange.Key = Key;
+    Exchange.Status = AwsGameKitGameSavingWrapper::GameKitLoadSlot(gameSavingInstance, (void*)&recorder, Recorder::Dispatch, model);
+    return FAwsGameKitTraffic::Get().Record(Exchange, StartTime);
+}
@@ -0,0 +1,123 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitWarmUp.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "Models/AwsGameKitEnumConverter.h"
+#include "SessionManager/AwsGameKitSessionManager.h"
+
+// Unreal
+#include "HAL/PlatformTime.h"
+#include "Templates/Function.h"
+
+namespace
+{
+    IntResult WarmUpIdentity()
+    {
+        FGetUserResponse response;
+        return FAwsGameKitIdentityUserCache::Get().GetUser(response);
+    }
+
+    IntResult WarmUpUserGameplayData()
+    {
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+        return IntResult(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, [](const char*) {}));
+    }
+
+    IntResult WarmUpGameSaving()
+    {
+        FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+}
+
+IntResult FAwsGameKitWarmUp::Run(const TArray<FeatureType>& Features)
+{
+    const double startTime = FPlatformTime::Seconds();
+    FAwsGameKitRuntimeModule& runtimeModule = FAwsGameKitRuntimeModule::Get();
+
+    bool hasAllSettings = true;
+    for (const FeatureType feature : Features)
+    {
+        hasAllSettings &= runtimeModule.GetLoadedFeatureSettings().IsLoaded(feature);
+    }
+
+    if (!hasAllSettings)
+    {
+        AwsGameKitSessionManager::ReloadConfig();
+    }
+
+    IntResult status(GameKit::GAMEKIT_SUCCESS);
+    TArray<TFunction<IntResult()>> reads;
+    for (const FeatureType feature : Features)
+    {
+        if (!runtimeModule.GetLoadedFeatureSettings().IsLoaded(feature))
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitWarmUp::Run(): The %s feature has no settings in the config file, it isn't warmed up"),
+                *AwsGameKitEnumConverter::FeatureToUIString(feature));
+            status = IntResult(GameKit::GAMEKIT_ERROR_SETTINGS_MISSING);
+            continue;
+        }
+        if (!FAwsGameKitRuntimeModule::IsFeatureBuilt(feature))
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitWarmUp::Run(): The %s feature is left out of this build, it isn't warmed up"),
+                *AwsGameKitEnumConverter::FeatureToUIString(feature));
+            continue;
+        }
+
+        switch (feature)
+        {
+        case FeatureType::Identity:
+            reads.Add(&WarmUpIdentity);
+            break;
+        case FeatureType::Achievements:
+            reads.Add([]
+            {
+                FAchievementSummary summary;
+                return AwsGameKitAchievements::GetAchievementSummaryBlocking(summary);
+            });
+            break;
+        case FeatureType::GameStateCloudSaving:
+            reads.Add(&WarmUpGameSaving);
+            break;
+        case FeatureType::UserGameplayData:
+            reads.Add(&WarmUpUserGameplayData);
+            break;
+        default:
+            // Main and Authentication have no library of their own, connecting is all there is to warm up
+            break;
+        }
+    }
+
+    TArray<IntResult> results;
+    results.SetNum(reads.Num());
+    if (reads.Num() > 0)
+    {
+        FAwsGameKitWorkerPool::Get().ParallelFor(reads.Num(), reads.Num(), [&reads, &results](int32 index)
+        {
+            results[index] = reads[index]();
+        });
+    }
+
+    for (const IntResult& result : results)
+    {
+        // Nobody logged in yet, the Lambdas are woken by the first call after login instead
+        if (result.Result == GameKit::GAMEKIT_SUCCESS || result.Result == GameKit::GAMEKIT_ERROR_NO_ID_TOKEN)
+        {
+            continue;
+        }
+        if (status.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            status = result;
+        }
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitWarmUp::Run(): Warmed up %d feature(s) in %.0f ms with status %s"),
+        Features.Num(), (FPlatformTime::Seconds() - startTime) * 1000.0, *GameKit::StatusCodeToHexFStr(status.Result));
+    return status;
+}
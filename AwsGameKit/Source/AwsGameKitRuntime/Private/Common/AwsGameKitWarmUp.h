@@ -0,0 +1,34 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Loading-screen warm-up of the feature libraries, the backend connections and the Lambdas, see FAwsGameKitRuntimeModule::WarmUp().
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/Array.h"
+
+/**
+ * @brief Does the work of FAwsGameKitRuntimeModule::WarmUp() and of the WarmUp Blueprint node.
+ */
+class FAwsGameKitWarmUp
+{
+public:
+    /**
+     * @brief Warm up the features on the calling thread and the worker pool, and wait until done. Call it from a worker thread.
+     *
+     * @details In order:
+     * - Reload the config file if a feature's settings aren't loaded.
+     * - In parallel, for each feature: load its library and, when a player is logged in, make one cheap authenticated read which opens the
+     *   library's connection to the backend, wakes its Lambda and fills the runtime's cache. Identity gets the player's profile, Achievements lists the achievements unless the cached list is
+     *   up to date, User Gameplay Data lists the bundle names. Game Saving only loads its library, its reads need SetFileActions() and AddLocalSlots().
+     *
+     * @return GAMEKIT_ERROR_SETTINGS_MISSING if a feature has no settings, else the status of the first read which failed, else GAMEKIT_SUCCESS.
+     * Reads skipped because no player is logged in aren't failures.
+     */
+    static IntResult Run(const TArray<FeatureType>& Features);
+};
@@ -0,0 +1,432 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Common/AwsGameKitWorkerPool.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitTrace.h"
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitWorkerPoolNumThreads(
+    TEXT("GameKit.WorkerPool.NumThreads"),
+    4,
+    TEXT("Number of threads in the shared GameKit worker pool. Read once at startup.\n"),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarGameKitWorkerPoolStackSizeKB(
+    TEXT("GameKit.WorkerPool.StackSizeKB"),
+    256,
+    TEXT("Stack size in kilobytes of each GameKit worker thread. Read once at startup.\n"),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarGameKitWorkerPoolThreadPriority(
+    TEXT("GameKit.WorkerPool.ThreadPriority"),
+    static_cast<int32>(TPri_Normal),
+    TEXT("EThreadPriority of the GameKit worker threads. Read once at startup.\n")
+    TEXT("  0: Normal, 1: AboveNormal, 2: BelowNormal, 3: Highest, 4: Lowest, 5: SlightlyBelowNormal, 6: TimeCritical\n"),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<FString> CVarGameKitWorkerPoolAffinityMask(
+    TEXT("GameKit.WorkerPool.AffinityMask"),
+    TEXT(""),
+    TEXT("Hexadecimal mask of the cores the GameKit worker threads may run on, such as 0x3C. Empty keeps the engine's pool thread mask. Read once at startup.\n"),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarGameKitWorkerPoolMaxBackgroundWhileInteractive(
+    TEXT("GameKit.WorkerPool.MaxBackgroundWhileInteractive"),
+    1,
+    TEXT("Maximum number of background work items running at the same time while interactive work is queued or running.\n"),
+    ECVF_Default);
+
+namespace
+{
+    thread_local EAwsGameKitWorkLane CurrentLane = EAwsGameKitWorkLane::Num;
+
+    // The pool threads are created by FQueuedThreadPool with the engine's mask, each one applies ours before its first work item
+    thread_local bool bAffinityApplied = false;
+
+    uint64 GetAffinityMask()
+    {
+        const FString Mask = CVarGameKitWorkerPoolAffinityMask.GetValueOnAnyThread().TrimStartAndEnd();
+        return Mask.IsEmpty() ? 0 : FCString::Strtoui64(*Mask, nullptr, 16);
+    }
+
+    void ApplyAffinityMask()
+    {
+        if (bAffinityApplied)
+        {
+            return;
+        }
+        bAffinityApplied = true;
+
+        const uint64 AffinityMask = GetAffinityMask();
+        if (AffinityMask != 0)
+        {
+            FPlatformProcess::SetThreadAffinityMask(AffinityMask);
+        }
+    }
+
+    EQueuedWorkPriority GetQueuedWorkPriority(EAwsGameKitWorkLane Lane)
+    {
+        switch (Lane)
+        {
+        case EAwsGameKitWorkLane::Interactive: return EQueuedWorkPriority::Highest;
+        case EAwsGameKitWorkLane::Background: return EQueuedWorkPriority::Low;
+        default: return EQueuedWorkPriority::Normal;
+        }
+    }
+
+    struct FParallelForState
+    {
+        FParallelForState(int32 InCount, TFunction<void(int32)>&& InWork) :
+            Count(InCount),
+            Work(MoveTemp(InWork)),
+            Done(FPlatformProcess::GetSynchEventFromPool(true))
+        {}
+
+        ~FParallelForState()
+        {
+            FPlatformProcess::ReturnSynchEventToPool(Done);
+        }
+
+        // Claims and runs indices until none are left. Helpers which start after the last index was claimed return straight away.
+        void RunLane()
+        {
+            for (int32 Index = Next.Increment() - 1; Index < Count; Index = Next.Increment() - 1)
+            {
+                Work(Index);
+                if (Completed.Increment() == Count)
+                {
+                    Done->Trigger();
+                }
+            }
+        }
+
+        const int32 Count;
+        const TFunction<void(int32)> Work;
+        FEvent* const Done;
+        FThreadSafeCounter Next;
+        FThreadSafeCounter Completed;
+    };
+}
+
+FAwsGameKitWorkLaneScope::FAwsGameKitWorkLaneScope(EAwsGameKitWorkLane Lane) :
+    Previous(CurrentLane)
+{
+    CurrentLane = Lane;
+}
+
+FAwsGameKitWorkLaneScope::~FAwsGameKitWorkLaneScope()
+{
+    CurrentLane = Previous;
+}
+
+EAwsGameKitWorkLane FAwsGameKitWorkLaneScope::GetCurrent()
+{
+    return CurrentLane;
+}
+
+class FAwsGameKitWorkerPool::FQueuedWork : public IQueuedWork
+{
+public:
+    FQueuedWork(FAwsGameKitWorkerPool& InOwner, EAwsGameKitWorkLane InLane, TUniqueFunction<void()>&& InWork)
+        : Owner(InOwner), Lane(InLane), QueuedTime(FPlatformTime::Seconds()), Work(MoveTemp(InWork))
+    {
+        Owner.QueueDepth.Increment();
+        INC_DWORD_STAT(STAT_AwsGameKit_WorkerPoolQueueDepth);
+    }
+
+    virtual void DoThreadedWork() override
+    {
+        if (!Owner.BeginWork(this))
+        {
+            return;
+        }
+
+        OnDequeued();
+        ApplyAffinityMask();
+        FAwsGameKitStats::RecordWorkerPoolWait(Lane, FPlatformTime::Seconds() - QueuedTime);
+        Work();
+        Owner.EndWork(Lane);
+        delete this;
+    }
+
+    virtual void Abandon() override
+    {
+        OnDequeued();
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitWorkerPool: abandoning queued work during shutdown"));
+
+        // Background work is only counted once it runs
+        if (Lane == EAwsGameKitWorkLane::Interactive)
+        {
+            Owner.EndWork(Lane);
+        }
+        delete this;
+    }
+
+    EAwsGameKitWorkLane GetLane() const
+    {
+        return Lane;
+    }
+
+private:
+    void OnDequeued()
+    {
+        Owner.QueueDepth.Decrement();
+        DEC_DWORD_STAT(STAT_AwsGameKit_WorkerPoolQueueDepth);
+    }
+
+    FAwsGameKitWorkerPool& Owner;
+    EAwsGameKitWorkLane Lane;
+    double QueuedTime;
+    TUniqueFunction<void()> Work;
+};
+
+FAwsGameKitWorkerPool& FAwsGameKitWorkerPool::Get()
+{
+    static FAwsGameKitWorkerPool Instance;
+    return Instance;
+}
+
+void FAwsGameKitWorkerPool::Startup()
+{
+    FScopeLock ScopeLock(&PoolMutex);
+    if (Pool != nullptr)
+    {
+        return;
+    }
+
+    const uint32 NumThreads = FMath::Max(1, CVarGameKitWorkerPoolNumThreads.GetValueOnAnyThread());
+    const uint32 StackSize = FMath::Max(64, CVarGameKitWorkerPoolStackSizeKB.GetValueOnAnyThread()) * 1024;
+    const EThreadPriority Priority = static_cast<EThreadPriority>(FMath::Clamp(CVarGameKitWorkerPoolThreadPriority.GetValueOnAnyThread(), 0, static_cast<int32>(TPri_Num) - 1));
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitWorkerPool::Startup(): %u threads, %u byte stacks, affinity mask 0x%llx"), NumThreads, StackSize, GetAffinityMask());
+
+    FQueuedThreadPool* NewPool = FQueuedThreadPool::Allocate();
+    if (!NewPool->Create(NumThreads, StackSize, Priority, TEXT("AwsGameKitWorkerPool")))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitWorkerPool::Startup(): Failed to create worker threads, falling back to a thread per call"));
+        delete NewPool;
+        return;
+    }
+
+    Pool = NewPool;
+}
+
+void FAwsGameKitWorkerPool::Shutdown()
+{
+    FQueuedThreadPool* OldPool = nullptr;
+    {
+        FScopeLock ScopeLock(&PoolMutex);
+        OldPool = Pool;
+        Pool = nullptr;
+    }
+
+    if (OldPool != nullptr)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitWorkerPool::Shutdown(): %d queued work items"), GetQueueDepth());
+
+        // Destroy() abandons queued work and blocks until the running work has finished.
+        OldPool->Destroy();
+        delete OldPool;
+    }
+
+    // The background work parked while interactive work was in flight was never queued on the pool
+    TArray<FQueuedWork*> Parked;
+    {
+        FScopeLock ScopeLock(&LaneMutex);
+        Parked = MoveTemp(ParkedWork);
+    }
+    for (FQueuedWork* Work : Parked)
+    {
+        Work->Abandon();
+    }
+}
+
+void FAwsGameKitWorkerPool::Dispatch(TUniqueFunction<void()>&& Work, EAwsGameKitWorkLane DefaultLane)
+{
+    // Carry the lane over to the worker thread, so that the work it dispatches in turn stays on it
+    const EAwsGameKitWorkLane Lane = FAwsGameKitWorkLaneScope::GetCurrent() != EAwsGameKitWorkLane::Num ? FAwsGameKitWorkLaneScope::GetCurrent() : DefaultLane;
+    Work = [Lane, Work = MoveTemp(Work)]() mutable
+    {
+        FAwsGameKitWorkLaneScope LaneScope(Lane);
+        Work();
+    };
+
+    // Carry the caller's player over to the worker thread, see FAwsGameKitPlayerScope
+    const FAwsGameKitPlayerHandle Player = FAwsGameKitPlayerScope::GetCurrent();
+    if (Player.IsValid())
+    {
+        Work = [Player, Work = MoveTemp(Work)]() mutable
+        {
+            FAwsGameKitPlayerScope PlayerScope(Player);
+            Work();
+        };
+    }
+
+#if AWSGAMEKIT_TRACE_ENABLED
+    // Carry the caller's traced call over to the worker thread, see FAwsGameKitTrace
+    const uint32 CallId = FAwsGameKitTrace::GetContext().CallId;
+    if (CallId != 0)
+    {
+        const bool bEndsCall = FAwsGameKitTrace::ClaimEnd();
+        Work = [CallId, bEndsCall, QueuedCycle = FPlatformTime::Cycles64(), Work = MoveTemp(Work)]() mutable
+        {
+            FAwsGameKitTraceCurrentCallScope CallScope(CallId);
+            FAwsGameKitTrace::Phase(EAwsGameKitTracePhase::QueueWait, QueuedCycle);
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(AwsGameKit_Work, AwsGameKitChannel);
+                Work();
+            }
+            if (bEndsCall)
+            {
+                FAwsGameKitTrace::EndCall();
+            }
+        };
+    }
+#endif
+
+    {
+        FScopeLock ScopeLock(&PoolMutex);
+        if (Pool != nullptr)
+        {
+            if (Lane == EAwsGameKitWorkLane::Interactive)
+            {
+                FScopeLock LaneScopeLock(&LaneMutex);
+                ++InteractiveInFlight;
+            }
+            Pool->AddQueuedWork(new FQueuedWork(*this, Lane, MoveTemp(Work)), GetQueuedWorkPriority(Lane));
+            return;
+        }
+    }
+
+    Async(EAsyncExecution::Thread, [Work = MoveTemp(Work)]() mutable
+    {
+        ApplyToCurrentThread();
+        Work();
+    });
+}
+
+void FAwsGameKitWorkerPool::ApplyToCurrentThread()
+{
+    if (FRunnableThread* Thread = FRunnableThread::GetRunnableThread())
+    {
+        Thread->SetThreadPriority(static_cast<EThreadPriority>(FMath::Clamp(CVarGameKitWorkerPoolThreadPriority.GetValueOnAnyThread(), 0, static_cast<int32>(TPri_Num) - 1)));
+    }
+    ApplyAffinityMask();
+}
+
+void FAwsGameKitWorkerPool::ParallelFor(int32 Count, int32 MaxLanes, TFunction<void(int32 Index)> Work)
+{
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    const int32 Lanes = FMath::Clamp(MaxLanes, 1, Count);
+    const TSharedRef<FParallelForState, ESPMode::ThreadSafe> State = MakeShared<FParallelForState, ESPMode::ThreadSafe>(Count, MoveTemp(Work));
+    for (int32 Lane = 1; Lane < Lanes; ++Lane)
+    {
+        Dispatch([State]
+        {
+            State->RunLane();
+        });
+    }
+
+    State->RunLane();
+    State->Done->Wait();
+}
+
+int32 FAwsGameKitWorkerPool::GetQueueDepth() const
+{
+    return QueueDepth.GetValue();
+}
+
+bool FAwsGameKitWorkerPool::BeginWork(FQueuedWork* Work)
+{
+    if (Work->GetLane() != EAwsGameKitWorkLane::Background)
+    {
+        return true;
+    }
+
+    FScopeLock ScopeLock(&LaneMutex);
+    if (InteractiveInFlight > 0 && BackgroundRunning >= FMath::Max(0, CVarGameKitWorkerPoolMaxBackgroundWhileInteractive.GetValueOnAnyThread()))
+    {
+        // Give the worker thread back, the work is queued again by ReleaseParkedWork()
+        ParkedWork.Add(Work);
+        return false;
+    }
+
+    ++BackgroundRunning;
+    return true;
+}
+
+void FAwsGameKitWorkerPool::EndWork(EAwsGameKitWorkLane Lane)
+{
+    {
+        FScopeLock ScopeLock(&LaneMutex);
+        if (Lane == EAwsGameKitWorkLane::Interactive)
+        {
+            --InteractiveInFlight;
+        }
+        else if (Lane == EAwsGameKitWorkLane::Background)
+        {
+            --BackgroundRunning;
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    ReleaseParkedWork();
+}
+
+void FAwsGameKitWorkerPool::ReleaseParkedWork()
+{
+    TArray<FQueuedWork*> Released;
+    {
+        FScopeLock ScopeLock(&LaneMutex);
+        const int32 MaxBackground = FMath::Max(0, CVarGameKitWorkerPoolMaxBackgroundWhileInteractive.GetValueOnAnyThread());
+        int32 Available = InteractiveInFlight > 0 ? MaxBackground - BackgroundRunning : ParkedWork.Num();
+        while (ParkedWork.Num() > 0 && Available > 0)
+        {
+            // In the order they were parked
+            Released.Add(ParkedWork[0]);
+            ParkedWork.RemoveAt(0, 1, false);
+            --Available;
+        }
+    }
+
+    if (Released.Num() == 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&PoolMutex);
+    if (Pool == nullptr)
+    {
+        // Shutting down, Shutdown() abandons them
+        FScopeLock LaneScopeLock(&LaneMutex);
+        ParkedWork.Append(Released);
+        return;
+    }
+
+    for (FQueuedWork* Work : Released)
+    {
+        Pool->AddQueuedWork(Work, GetQueuedWorkPriority(EAwsGameKitWorkLane::Background));
+    }
+}
@@ -8,36 +8,70 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitSingleFlight.h"
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+#include "GameSaving/AwsGameKitGameSavingTransferScheduler.h"
+
+// Unreal
+#include "GameFramework/SaveGame.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // Serialization buffers of SaveGameToSlot() kept for the next saves, so a game which autosaves doesn't reallocate its save file's size every time
+    class FSaveGameBufferPool
+    {
+    public:
+        static FSaveGameBufferPool& Get()
+        {
+            static FSaveGameBufferPool pool;
+            return pool;
+        }
+
+        TArray<uint8> Acquire()
+        {
+            FScopeLock scopeLock(&mutex);
+            return buffers.Num() > 0 ? buffers.Pop(false) : TArray<uint8>();
+        }
+
+        void Release(TArray<uint8>&& buffer)
+        {
+            buffer.Reset();
+            FScopeLock scopeLock(&mutex);
+            if (buffers.Num() < MAX_POOLED_BUFFERS)
+            {
+                buffers.Push(MoveTemp(buffer));
+            }
+        }
+
+    private:
+        // Saves of different slots may be in flight at the same time
+        static const int32 MAX_POOLED_BUFFERS = 2;
+
+        FCriticalSection mutex;
+        TArray<TArray<uint8>> buffers;
+    };
+}
 
 GameSavingLibrary AwsGameKitGameSaving::GetGameSavingLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetGameSavingLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetGameSavingLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 }
 
 void AwsGameKitGameSaving::AddLocalSlots(const FFilePaths& LocalSlotInformationFilePaths, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::AddLocalSlots()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::AddLocalSlots()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "AddLocalSlots");
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
-
-        // Transform local slot information file paths into const char**
-        const unsigned int arraySize = LocalSlotInformationFilePaths.FilePaths.Num();
-        TArray<std::string> strFilePaths;
-        TArray<const char*> rawFilePaths;
-        strFilePaths.SetNum(arraySize);
-        rawFilePaths.SetNum(arraySize);
-        for (unsigned int i = 0; i < arraySize; ++i)
-        {
-            strFilePaths[i] = TCHAR_TO_UTF8(ToCStr(LocalSlotInformationFilePaths.FilePaths[i]));
-            rawFilePaths[i] = strFilePaths[i].c_str();
-        }
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
-        gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), arraySize);
+        InternalAwsGameKitAddLocalSlots(gameSavingLibrary, LocalSlotInformationFilePaths.FilePaths);
         const IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
@@ -46,14 +80,16 @@ void AwsGameKitGameSaving::AddLocalSlots(const FFilePaths& LocalSlotInformationF
 
 void AwsGameKitGameSaving::SetFileActions(const FileActions& FileActions, TAwsGameKitDelegateParam<const IntResult&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SetFileActions()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::SetFileActions()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SetFileActions");
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
         gameSavingLibrary.GameSavingWrapper->GameKitSetFileActions(gameSavingLibrary.GameSavingInstanceHandle, FileActions);
+        InternalAwsGameKitSetUsesDefaultFileActions(FileActions.fileReadCallback == DefaultFileActions().fileReadCallback);
         const IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result);
@@ -62,20 +98,30 @@ void AwsGameKitGameSaving::SetFileActions(const FileActions& FileActions, TAwsGa
 
 void AwsGameKitGameSaving::GetAllSlotSyncStatuses( TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "GetAllSlotSyncStatuses");
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+        InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
         auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses() GetAllSlotSyncStatuses::Dispatch"));
-
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::GetAllSlotSyncStatuses() GetAllSlotSyncStatuses::Dispatch"));
+            if (FAwsGameKitCancellationScope::IsCurrentCallAbandoned())
+            {
+                return;
+            }
+
+            if (callStatus == GameKit::GAMEKIT_SUCCESS)
+            {
+                FAwsGameKitGameSavingSlotIndex::Get().Update(cachedSlots, slotCount);
+            }
             TArray<FGameSavingSlot> results = FGameSavingSlot::ToArray(cachedSlots, slotCount);
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), MoveTemp(results));
         };
         typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
 
@@ -87,49 +133,72 @@ void AwsGameKitGameSaving::GetAllSlotSyncStatuses( TAwsGameKitDelegateParam<cons
 
 void AwsGameKitGameSaving::GetSlotSyncStatus(const FGameSavingGetSlotSyncStatusRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "GetSlotSyncStatus", Request.SlotName);
+
+    // Several places polling the same slot at once share one request
+    static TAwsGameKitSingleFlight<FGameSavingSlotActionResults> getSlotSyncStatusFlights;
+    bool tracked;
+    if (!getSlotSyncStatusFlights.Join(Request.SlotName, ResultDelegate, tracked))
+    {
+        return;
+    }
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+        InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
+        bool dispatched = false;
         auto getSlotSyncStatusDispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
+            dispatched = true;
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
 
             FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+            InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, results.Slots.Slots);
             results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
             results.CallStatus = callStatus;
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            getSlotSyncStatusFlights.Complete(Request.SlotName, tracked, ResultDelegate, IntResult(callStatus), MoveTemp(results));
         };
         typedef LambdaDispatcher<decltype(getSlotSyncStatusDispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> GetSlotSyncStatusDispatcher;
 
-        gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &getSlotSyncStatusDispatcher, GetSlotSyncStatusDispatcher::Dispatch, TCHAR_TO_UTF8(*Request.SlotName));
+        const unsigned int status = gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &getSlotSyncStatusDispatcher, GetSlotSyncStatusDispatcher::Dispatch, TCHAR_TO_UTF8(*Request.SlotName));
+
+        // End the read even when the library returned without a result, so that later calls don't join it
+        if (!dispatched)
+        {
+            FGameSavingSlotActionResults results;
+            results.CallStatus = status;
+            getSlotSyncStatusFlights.Complete(Request.SlotName, tracked, ResultDelegate, IntResult(status), MoveTemp(results));
+        }
     });
 }
 
 void AwsGameKitGameSaving::DeleteSlot(const FGameSavingDeleteSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::DeleteSlot()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::DeleteSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "DeleteSlot", Request.SlotName);
 
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+        InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
         auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::DeleteSlot() DeleteSlot::Dispatch"));
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::DeleteSlot() DeleteSlot::Dispatch"));
+
+            FAwsGameKitGameSavingChangeTracker::Get().Forget(Request.SlotName);
 
             FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+            InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, results.Slots.Slots);
             results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
             results.CallStatus = callStatus;
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), MoveTemp(results));
         };
         typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
@@ -139,62 +208,186 @@ void AwsGameKitGameSaving::DeleteSlot(const FGameSavingDeleteSlotRequest& Reques
 
 void AwsGameKitGameSaving::SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot()"));
+    SaveSlot(FGameSavingSaveSlotRequest(Request), ResultDelegate);
+}
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+void AwsGameKitGameSaving::SaveSlot(FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::SaveSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveSlot", Request.SlotName, Request.Data.Num());
+
+    if (FAwsGameKitGameSavingTransferScheduler::IsEnabled())
+    {
+        FAwsGameKitGameSavingTransferScheduler::Get().EnqueueSave(MoveTemp(Request), EAwsGameKitGameSavingTransferPriority::Background, ResultDelegate);
+        return;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([Request = MoveTemp(Request), ResultDelegate]
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
 
-        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
-        {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::SaveSlot() SaveSlot::Dispatch"));
+        FGameSavingSlotActionResults results;
+        const unsigned int callStatus = InternalAwsGameKitSaveSlot(GetGameSavingLibraryFromModule(), Request, results);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), MoveTemp(results));
+    });
+}
 
-            FGameSavingSlotActionResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
-            results.CallStatus = callStatus;
+void AwsGameKitGameSaving::LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate)
+{
+    LoadSlot(FGameSavingLoadSlotRequest(Request), ResultDelegate);
+}
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
-        };
-        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+void AwsGameKitGameSaving::LoadSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::LoadSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "LoadSlot", Request.SlotName);
+
+    if (FAwsGameKitGameSavingTransferScheduler::IsEnabled())
+    {
+        FAwsGameKitGameSavingTransferScheduler::Get().EnqueueLoad(MoveTemp(Request), EAwsGameKitGameSavingTransferPriority::Foreground, ResultDelegate);
+        return;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([Request = MoveTemp(Request), ResultDelegate]
+    {
+        FGraphEventRef OrderedWorkChain;
 
-        ModelCache modelCache(Request);
-        GameSavingModel gameSavingModel = modelCache;
-        gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
+        FGameSavingDataResults results;
+        const unsigned int callStatus = InternalAwsGameKitLoadSlot(GetGameSavingLibraryFromModule(), Request, results);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), MoveTemp(results));
     });
 }
 
-void AwsGameKitGameSaving::LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate)
+void AwsGameKitGameSaving::SaveGameToSlot(USaveGame* SaveGameObject, FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlot()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::SaveGameToSlot()"));
+    check(IsInGameThread());
 
-    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    Request.SaveFilePath.Empty();
+    Request.Data = FSaveGameBufferPool::Get().Acquire();
+    if (SaveGameObject == nullptr || !UGameplayStatics::SaveGameToMemory(SaveGameObject, Request.Data))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::SaveGameToSlot() Could not serialize the save game of slot %s"), *Request.SlotName);
+        FSaveGameBufferPool::Get().Release(MoveTemp(Request.Data));
+
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(GameKit::GAMEKIT_ERROR_FILE_READ_FAILED), FGameSavingSlotActionResults());
+        return;
+    }
+
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveGameToSlot", Request.SlotName, Request.Data.Num());
+
+    // The scheduler owns its requests, their buffers aren't returned to the pool
+    if (FAwsGameKitGameSavingTransferScheduler::IsEnabled())
+    {
+        SaveSlot(MoveTemp(Request), ResultDelegate);
+        return;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([Request = MoveTemp(Request), ResultDelegate]() mutable
     {
         FGraphEventRef OrderedWorkChain;
-        GameSavingLibrary gameSavingLibrary = GetGameSavingLibraryFromModule();
 
-        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
+        FGameSavingSlotActionResults results;
+        const unsigned int callStatus = InternalAwsGameKitSaveSlot(GetGameSavingLibraryFromModule(), Request, results);
+        FSaveGameBufferPool::Get().Release(MoveTemp(Request.Data));
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), MoveTemp(results));
+    });
+}
+
+void AwsGameKitGameSaving::LoadGameFromSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&, USaveGame*> ResultDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::LoadGameFromSlot()"));
+
+    Request.SaveFilePath.Empty();
+    LoadSlot(MoveTemp(Request), TAwsGameKitDelegate<const IntResult&, const FGameSavingDataResults&>::CreateLambda(
+        [ResultDelegate](const IntResult& result, const FGameSavingDataResults& results)
         {
-            UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitGameSaving::LoadSlot() LoadSlot::Dispatch"));
+            if (result.Result != GameKit::GAMEKIT_SUCCESS)
+            {
+                ResultDelegate.ExecuteIfBound(result, results, nullptr);
+                return;
+            }
+
+            // Called on the game thread, where the object can be created
+            USaveGame* saveGameObject = UGameplayStatics::LoadGameFromMemory(results.Data);
+            if (saveGameObject == nullptr)
+            {
+                UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitGameSaving::LoadGameFromSlot() Slot %s isn't a save game"), *results.ActedOnSlot.SlotName);
+                ResultDelegate.ExecuteIfBound(IntResult(GameKit::GAMEKIT_ERROR_FILE_READ_FAILED), results, nullptr);
+                return;
+            }
+
+            ResultDelegate.ExecuteIfBound(result, results, saveGameObject);
+        }));
+}
 
-            FGameSavingDataResults results;
-            results.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-            results.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
-            results.Data.AddUninitialized(dataSize);
-            FMemory::Memcpy(results.Data.GetData(), (uint8*)data, dataSize);
-            results.CallStatus = callStatus;
+void AwsGameKitGameSaving::SaveSlots(const TArray<FGameSavingSaveSlotRequest>& Requests, TAwsGameKitDelegateParam<const FGameSavingSlotActionResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    SaveSlots(TArray<FGameSavingSaveSlotRequest>(Requests), PartialResultDelegate, OnCompleteDelegate);
+}
 
-            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, IntResult(callStatus), results);
-        };
-        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
+void AwsGameKitGameSaving::SaveSlots(TArray<FGameSavingSaveSlotRequest>&& Requests, TAwsGameKitDelegateParam<const FGameSavingSlotActionResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::SaveSlots() %d slots"), Requests.Num());
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveSlots");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([Requests = MoveTemp(Requests), PartialResultDelegate, OnCompleteDelegate]
+    {
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
 
-        ModelCache modelCache(Request);
-        GameSavingModel gameSavingModel = modelCache;
-        gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
+        TArray<FGameSavingSlotActionResults> allResults;
+        InternalAwsGameKitSaveSlots(gameSavingLibrary, Requests, allResults, [&](int32 index)
+        {
+            FGraphEventRef OrderedWorkChain;
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, PartialResultDelegate, CopyTemp(allResults[index]));
+        });
+
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, IntResult(InternalAwsGameKitGameSavingBatchStatus(allResults)));
     });
 }
 
+void AwsGameKitGameSaving::LoadSlots(const TArray<FGameSavingLoadSlotRequest>& Requests, TAwsGameKitDelegateParam<const FGameSavingDataResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    LoadSlots(TArray<FGameSavingLoadSlotRequest>(Requests), PartialResultDelegate, OnCompleteDelegate);
+}
+
+void AwsGameKitGameSaving::LoadSlots(TArray<FGameSavingLoadSlotRequest>&& Requests, TAwsGameKitDelegateParam<const FGameSavingDataResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitGameSaving::LoadSlots() %d slots"), Requests.Num());
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "LoadSlots");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([Requests = MoveTemp(Requests), PartialResultDelegate, OnCompleteDelegate]
+    {
+        const GameSavingLibrary& gameSavingLibrary = GetGameSavingLibraryFromModule();
+
+        // Only the statuses are kept, each slot's data is moved to its partial result
+        TArray<FGameSavingDataResults> statuses;
+        statuses.SetNum(Requests.Num());
+        InternalAwsGameKitGameSavingParallelFor(Requests.Num(), [&](int32 index)
+        {
+            FGraphEventRef OrderedWorkChain;
+            FGameSavingDataResults results;
+            statuses[index].CallStatus = InternalAwsGameKitLoadSlot(gameSavingLibrary, Requests[index], results);
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, PartialResultDelegate, MoveTemp(results));
+        });
+
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, IntResult(InternalAwsGameKitGameSavingBatchStatus(statuses)));
+    });
+}
+
+TArray<FGameSavingSlot> AwsGameKitGameSaving::GetCachedSlots()
+{
+    return FAwsGameKitGameSavingSlotIndex::Get().GetSlots();
+}
+
+void AwsGameKitGameSaving::SetSlotSyncStatusChangeDelegate(TAwsGameKitDelegateParam<const FGameSavingSlot&> SyncStatusChangeDelegate)
+{
+    FAwsGameKitGameSavingSlotIndex::Get().SetSyncStatusChangeDelegate(SyncStatusChangeDelegate);
+}
+
 FString AwsGameKitGameSaving::GetSaveInfoFileExtension()
 {
     return GameKit::GameSaving::Wrapper::SaveInfoFileExtension;
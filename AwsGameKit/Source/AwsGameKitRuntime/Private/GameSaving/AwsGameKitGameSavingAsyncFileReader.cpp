@@ -0,0 +1,104 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingAsyncFileReader.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "Async/AsyncFileHandle.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+
+static TAutoConsoleVariable<bool> CVarGameKitGameSavingAsyncFileIO(
+    TEXT("GameKit.GameSaving.AsyncFileIO"),
+    false,
+    TEXT("If true, SaveSlots reads the next slots' save files with async file IO while the previous slots upload, see FAwsGameKitGameSavingAsyncFileReader.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Size of each async read request, small enough for the IO scheduler to interleave them with other reads
+    const int64 ASYNC_READ_CHUNK_SIZE = 2 * 1024 * 1024;
+}
+
+bool FAwsGameKitGameSavingAsyncFileReader::IsEnabled()
+{
+    return CVarGameKitGameSavingAsyncFileIO.GetValueOnAnyThread();
+}
+
+FAwsGameKitGameSavingAsyncFileReader::FAwsGameKitGameSavingAsyncFileReader(const FString& InFilePath) :
+    FilePath(InFilePath)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    const int64 fileSize = platformFile.FileSize(*FilePath);
+    if (fileSize < 0 || fileSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingAsyncFileReader() Save file %s is missing or has an unsupported size of %lld bytes"), *FilePath, fileSize);
+        bFailed = true;
+        return;
+    }
+
+    Data.SetNumUninitialized(static_cast<int32>(fileSize));
+    if (fileSize == 0)
+    {
+        return;
+    }
+
+    FileHandle.Reset(platformFile.OpenAsyncRead(*FilePath));
+    if (!FileHandle.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingAsyncFileReader() Could not open save file %s"), *FilePath);
+        bFailed = true;
+        return;
+    }
+
+    Requests.Reserve(static_cast<int32>((fileSize + ASYNC_READ_CHUNK_SIZE - 1) / ASYNC_READ_CHUNK_SIZE));
+    for (int64 offset = 0; offset < fileSize; offset += ASYNC_READ_CHUNK_SIZE)
+    {
+        IAsyncReadRequest* request = FileHandle->ReadRequest(offset, FMath::Min(ASYNC_READ_CHUNK_SIZE, fileSize - offset), AIOP_Normal, nullptr, Data.GetData() + offset);
+        if (request == nullptr)
+        {
+            bFailed = true;
+            break;
+        }
+        Requests.Add(request);
+    }
+}
+
+FAwsGameKitGameSavingAsyncFileReader::~FAwsGameKitGameSavingAsyncFileReader()
+{
+    // The requests write into Data and must all have completed before it is freed and the handle is closed
+    WaitForRequests();
+}
+
+bool FAwsGameKitGameSavingAsyncFileReader::Wait(TArray<uint8>& OutData)
+{
+    WaitForRequests();
+    if (bFailed)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingAsyncFileReader::Wait() Could not read save file %s"), *FilePath);
+        return false;
+    }
+
+    OutData = MoveTemp(Data);
+    return true;
+}
+
+void FAwsGameKitGameSavingAsyncFileReader::WaitForRequests()
+{
+    for (IAsyncReadRequest* request : Requests)
+    {
+        request->WaitCompletion();
+
+        // The results are the user supplied memory, or null if the read failed
+        bFailed |= request->GetReadResults() == nullptr;
+        delete request;
+    }
+    Requests.Empty();
+    FileHandle.Reset();
+}
@@ -0,0 +1,42 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Templates/UniquePtr.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+// Reads a save file in the background with the engine's async file IO, so that SaveSlots() can read the next slot's save file from disk
+// while the previous slot is being uploaded. Enabled with the GameKit.GameSaving.AsyncFileIO console variable.
+//
+// The reads are issued in chunks by the constructor and Wait() blocks until all of them have completed. The reader must be waited on, or
+// destroyed, which also waits, on the thread that owns it.
+class FAwsGameKitGameSavingAsyncFileReader
+{
+public:
+    // True if SaveSlots() prefetches save files with async file IO.
+    static bool IsEnabled();
+
+    explicit FAwsGameKitGameSavingAsyncFileReader(const FString& InFilePath);
+    ~FAwsGameKitGameSavingAsyncFileReader();
+
+    FAwsGameKitGameSavingAsyncFileReader(const FAwsGameKitGameSavingAsyncFileReader&) = delete;
+    FAwsGameKitGameSavingAsyncFileReader& operator=(const FAwsGameKitGameSavingAsyncFileReader&) = delete;
+
+    // Wait for the save file and move it to OutData. Returns false if the file couldn't be opened or read.
+    bool Wait(TArray<uint8>& OutData);
+
+private:
+    void WaitForRequests();
+
+    const FString FilePath;
+    TUniquePtr<IAsyncReadFileHandle> FileHandle;
+    TArray<IAsyncReadRequest*> Requests;
+    TArray<uint8> Data;
+    bool bFailed = false;
+};
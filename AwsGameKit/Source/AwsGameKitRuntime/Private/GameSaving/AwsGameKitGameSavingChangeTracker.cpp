@@ -0,0 +1,61 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+
+// Unreal
+#include "Hash/xxhash.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingSkipUnchangedUploads(
+    TEXT("GameKit.GameSaving.SkipUnchangedUploads"),
+    0,
+    TEXT("Whether SaveSlot skips uploading a save file which hasn't changed since it was last synced, see FAwsGameKitGameSavingChangeTracker.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+FAwsGameKitGameSavingChangeTracker& FAwsGameKitGameSavingChangeTracker::Get()
+{
+    static FAwsGameKitGameSavingChangeTracker Instance;
+    return Instance;
+}
+
+bool FAwsGameKitGameSavingChangeTracker::IsEnabled()
+{
+    return CVarGameKitGameSavingSkipUnchangedUploads.GetValueOnAnyThread() > 0;
+}
+
+FString FAwsGameKitGameSavingChangeTracker::HashContent(TArrayView<const uint8> Data, TArrayView<const uint8> Metadata)
+{
+    // XXH3 processes large buffers with the platform's vector instructions
+    const FXxHash64 DataHash = FXxHash64::HashBuffer(Data.GetData(), Data.Num());
+    const FXxHash64 MetadataHash = FXxHash64::HashBuffer(Metadata.GetData(), Metadata.Num());
+    return FString::Printf(TEXT("%d-%016llx-%016llx"), Data.Num(), DataHash.Hash, MetadataHash.Hash);
+}
+
+FString FAwsGameKitGameSavingChangeTracker::HashContent(int64 DataSize, uint32 DataChecksum, TArrayView<const uint8> Metadata)
+{
+    const FXxHash64 MetadataHash = FXxHash64::HashBuffer(Metadata.GetData(), Metadata.Num());
+    return FString::Printf(TEXT("%lld-c%08x-%016llx"), DataSize, DataChecksum, MetadataHash.Hash);
+}
+
+bool FAwsGameKitGameSavingChangeTracker::IsUnchanged(const FString& SlotName, const FString& ContentHash) const
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FString* SyncedHash = SyncedHashes.Find(SlotName);
+    return SyncedHash != nullptr && *SyncedHash == ContentHash;
+}
+
+void FAwsGameKitGameSavingChangeTracker::RecordSync(const FString& SlotName, const FString& ContentHash)
+{
+    FScopeLock ScopeLock(&Mutex);
+    SyncedHashes.Add(SlotName, ContentHash);
+}
+
+void FAwsGameKitGameSavingChangeTracker::Forget(const FString& SlotName)
+{
+    FScopeLock ScopeLock(&Mutex);
+    SyncedHashes.Remove(SlotName);
+}
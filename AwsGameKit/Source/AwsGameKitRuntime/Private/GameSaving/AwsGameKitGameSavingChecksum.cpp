@@ -0,0 +1,134 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingChecksum.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/Platform.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_64BITS && PLATFORM_ALWAYS_HAS_SSE4_2
+#include <nmmintrin.h>
+#define GAMEKIT_CRC32C_SSE42 1
+#elif PLATFORM_CPU_ARM_FAMILY && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define GAMEKIT_CRC32C_ARMV8 1
+#endif
+
+static TAutoConsoleVariable<bool> CVarGameKitGameSavingChecksum(
+    TEXT("GameKit.GameSaving.Checksum"),
+    false,
+    TEXT("If true, SaveSlot appends a CRC-32C of the save file to the upload, which LoadSlot verifies. See FAwsGameKitGameSavingChecksum.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // The checksum as a little endian uint32, a format version, three reserved bytes, then "GKSAVSUM"
+    const uint8 TRAILER_MAGIC[] = { 'G', 'K', 'S', 'A', 'V', 'S', 'U', 'M' };
+    const uint8 TRAILER_VERSION = 1;
+    const int32 TRAILER_SIZE = 16;
+
+#if !defined(GAMEKIT_CRC32C_SSE42) && !defined(GAMEKIT_CRC32C_ARMV8)
+    // Reflected Castagnoli polynomial
+    const uint32 CRC32C_POLYNOMIAL = 0x82F63B78u;
+
+    struct FCrc32cTable
+    {
+        FCrc32cTable()
+        {
+            for (uint32 Index = 0; Index < 256; ++Index)
+            {
+                uint32 Crc = Index;
+                for (int32 Bit = 0; Bit < 8; ++Bit)
+                {
+                    Crc = (Crc >> 1) ^ (CRC32C_POLYNOMIAL & (0u - (Crc & 1u)));
+                }
+                Entries[Index] = Crc;
+            }
+        }
+
+        uint32 Entries[256];
+    };
+#endif
+}
+
+bool FAwsGameKitGameSavingChecksum::IsEnabled()
+{
+    return CVarGameKitGameSavingChecksum.GetValueOnAnyThread();
+}
+
+uint32 FAwsGameKitGameSavingChecksum::Crc32c(TArrayView<const uint8> Data)
+{
+    const uint8* Bytes = Data.GetData();
+    int64 Remaining = Data.Num();
+    uint32 Crc = ~0u;
+
+#if defined(GAMEKIT_CRC32C_SSE42)
+    uint64 Crc64 = Crc;
+    for (; Remaining >= 8; Bytes += 8, Remaining -= 8)
+    {
+        uint64 Word;
+        FMemory::Memcpy(&Word, Bytes, sizeof(Word));
+        Crc64 = _mm_crc32_u64(Crc64, Word);
+    }
+    Crc = static_cast<uint32>(Crc64);
+    for (; Remaining > 0; ++Bytes, --Remaining)
+    {
+        Crc = _mm_crc32_u8(Crc, *Bytes);
+    }
+#elif defined(GAMEKIT_CRC32C_ARMV8)
+    for (; Remaining >= 8; Bytes += 8, Remaining -= 8)
+    {
+        uint64 Word;
+        FMemory::Memcpy(&Word, Bytes, sizeof(Word));
+        Crc = __crc32cd(Crc, Word);
+    }
+    for (; Remaining > 0; ++Bytes, --Remaining)
+    {
+        Crc = __crc32cb(Crc, *Bytes);
+    }
+#else
+    static const FCrc32cTable Table;
+    for (; Remaining > 0; ++Bytes, --Remaining)
+    {
+        Crc = Table.Entries[(Crc ^ *Bytes) & 0xFF] ^ (Crc >> 8);
+    }
+#endif
+
+    return ~Crc;
+}
+
+void FAwsGameKitGameSavingChecksum::AppendTrailer(TArray<uint8>& Payload, uint32 Checksum)
+{
+    uint8 Trailer[TRAILER_SIZE] = {};
+    for (int32 Byte = 0; Byte < 4; ++Byte)
+    {
+        Trailer[Byte] = static_cast<uint8>(Checksum >> (8 * Byte));
+    }
+    Trailer[4] = TRAILER_VERSION;
+    FMemory::Memcpy(Trailer + TRAILER_SIZE - sizeof(TRAILER_MAGIC), TRAILER_MAGIC, sizeof(TRAILER_MAGIC));
+
+    Payload.Append(Trailer, TRAILER_SIZE);
+}
+
+bool FAwsGameKitGameSavingChecksum::StripTrailer(TArrayView<const uint8>& Payload, uint32& OutChecksum)
+{
+    if (Payload.Num() < TRAILER_SIZE)
+    {
+        return false;
+    }
+
+    const uint8* Trailer = Payload.GetData() + Payload.Num() - TRAILER_SIZE;
+    if (FMemory::Memcmp(Trailer + TRAILER_SIZE - sizeof(TRAILER_MAGIC), TRAILER_MAGIC, sizeof(TRAILER_MAGIC)) != 0 || Trailer[4] != TRAILER_VERSION)
+    {
+        return false;
+    }
+
+    OutChecksum = 0;
+    for (int32 Byte = 0; Byte < 4; ++Byte)
+    {
+        OutChecksum |= static_cast<uint32>(Trailer[Byte]) << (8 * Byte);
+    }
+    Payload = Payload.Left(Payload.Num() - TRAILER_SIZE);
+    return true;
+}
@@ -0,0 +1,174 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingCompression.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/Compression.h"
+#include "UObject/NameTypes.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingCompression(
+    TEXT("GameKit.GameSaving.Compression"),
+    0,
+    TEXT("Codec SaveSlot compresses save files with, see FAwsGameKitGameSavingCompression. LoadSlot decompresses any of them.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: Oodle\n")
+    TEXT("  2: LZ4\n")
+    TEXT("  3: Zlib\n"),
+    ECVF_Default);
+
+namespace
+{
+    // "GKSAVZ", a format version, the codec, then the original size as a little endian uint64
+    const uint8 HEADER_MAGIC[] = { 'G', 'K', 'S', 'A', 'V', 'Z' };
+    const uint8 HEADER_VERSION = 1;
+    const int32 HEADER_SIZE = 16;
+
+    const uint8 CODEC_OODLE = 1;
+    const uint8 CODEC_LZ4 = 2;
+    const uint8 CODEC_ZLIB = 3;
+
+    FName GetFormatName(uint8 Codec)
+    {
+        switch (Codec)
+        {
+        case CODEC_OODLE:
+            return NAME_Oodle;
+        case CODEC_LZ4:
+            return NAME_LZ4;
+        case CODEC_ZLIB:
+            return NAME_Zlib;
+        default:
+            return NAME_None;
+        }
+    }
+
+    bool HasHeader(TArrayView<const uint8> Payload)
+    {
+        return Payload.Num() >= HEADER_SIZE && FMemory::Memcmp(Payload.GetData(), HEADER_MAGIC, sizeof(HEADER_MAGIC)) == 0;
+    }
+
+    uint64 ReadOriginalSize(TArrayView<const uint8> Payload)
+    {
+        uint64 Size = 0;
+        for (int32 Index = HEADER_SIZE - 1; Index >= HEADER_SIZE - 8; --Index)
+        {
+            Size = (Size << 8) | Payload[Index];
+        }
+        return Size;
+    }
+}
+
+bool FAwsGameKitGameSavingCompression::IsEnabled()
+{
+    return CVarGameKitGameSavingCompression.GetValueOnAnyThread() > 0;
+}
+
+bool FAwsGameKitGameSavingCompression::Compress(TArrayView<const uint8> Data, TArray<uint8>& OutPayload)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    const uint8 Codec = static_cast<uint8>(FMath::Clamp(CVarGameKitGameSavingCompression.GetValueOnAnyThread(), 0, 255));
+    const FName FormatName = GetFormatName(Codec);
+    if (FormatName.IsNone() || Data.Num() == 0)
+    {
+        return false;
+    }
+    if (!FCompression::IsFormatValid(FormatName))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitGameSavingCompression::Compress() %s compression isn't available on this platform"), *FormatName.ToString());
+        return false;
+    }
+
+    const int32 Bound = FCompression::CompressMemoryBound(FormatName, Data.Num());
+    if (Bound <= 0 || Bound > MAX_int32 - HEADER_SIZE)
+    {
+        return false;
+    }
+
+    OutPayload.SetNumUninitialized(HEADER_SIZE + Bound);
+    int32 CompressedSize = Bound;
+    if (!FCompression::CompressMemory(FormatName, OutPayload.GetData() + HEADER_SIZE, CompressedSize, Data.GetData(), Data.Num()))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitGameSavingCompression::Compress() %s compression failed, the save file is uploaded without compression"), *FormatName.ToString());
+        OutPayload.Empty();
+        return false;
+    }
+    if (HEADER_SIZE + CompressedSize >= Data.Num())
+    {
+        OutPayload.Empty();
+        return false;
+    }
+
+    uint8* Header = OutPayload.GetData();
+    FMemory::Memcpy(Header, HEADER_MAGIC, sizeof(HEADER_MAGIC));
+    Header[6] = HEADER_VERSION;
+    Header[7] = Codec;
+    uint64 OriginalSize = static_cast<uint64>(Data.Num());
+    for (int32 Index = HEADER_SIZE - 8; Index < HEADER_SIZE; ++Index)
+    {
+        Header[Index] = static_cast<uint8>(OriginalSize & 0xff);
+        OriginalSize >>= 8;
+    }
+
+    OutPayload.SetNum(HEADER_SIZE + CompressedSize, false);
+    return true;
+}
+
+bool FAwsGameKitGameSavingCompression::IsCompressed(TArrayView<const uint8> Payload)
+{
+    return HasHeader(Payload);
+}
+
+int64 FAwsGameKitGameSavingCompression::GetDecompressedSize(TArrayView<const uint8> Payload)
+{
+    if (!HasHeader(Payload))
+    {
+        return Payload.Num();
+    }
+
+    const uint64 OriginalSize = ReadOriginalSize(Payload);
+    if (Payload[6] != HEADER_VERSION || OriginalSize > MAX_int32)
+    {
+        return -1;
+    }
+    return static_cast<int64>(OriginalSize);
+}
+
+bool FAwsGameKitGameSavingCompression::Decompress(TArrayView<const uint8> Payload, TArray<uint8>& OutData)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    if (!HasHeader(Payload))
+    {
+        OutData.SetNumUninitialized(Payload.Num(), false);
+        FMemory::Memcpy(OutData.GetData(), Payload.GetData(), Payload.Num());
+        return true;
+    }
+
+    const int64 OriginalSize = GetDecompressedSize(Payload);
+    const FName FormatName = GetFormatName(Payload[7]);
+    if (OriginalSize < 0 || FormatName.IsNone())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingCompression::Decompress() The save file's compression header is malformed"));
+        return false;
+    }
+    if (!FCompression::IsFormatValid(FormatName))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingCompression::Decompress() The save file is compressed with %s, which isn't available on this platform"), *FormatName.ToString());
+        return false;
+    }
+
+    OutData.SetNumUninitialized(static_cast<int32>(OriginalSize), false);
+    if (!FCompression::UncompressMemory(FormatName, OutData.GetData(), OutData.Num(), Payload.GetData() + HEADER_SIZE, Payload.Num() - HEADER_SIZE))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingCompression::Decompress() The save file is corrupt, %s decompression failed"), *FormatName.ToString());
+        OutData.Reset();
+        return false;
+    }
+
+    return true;
+}
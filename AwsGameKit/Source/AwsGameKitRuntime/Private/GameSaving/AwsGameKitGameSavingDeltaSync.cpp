@@ -0,0 +1,247 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingDeltaSync.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "Containers/Set.h"
+#include "Containers/StringConv.h"
+#include "Misc/CString.h"
+#include "Misc/SecureHash.h"
+
+namespace
+{
+    const int32 MIN_CHUNK_SIZE = 2 * 1024;
+    const int32 AVERAGE_CHUNK_SIZE = 8 * 1024;
+    const int32 MAX_CHUNK_SIZE = 64 * 1024;
+
+    // FastCDC normalized chunking masks for an 8 KB average: harder to match before the average size, easier after it
+    const uint64 MASK_SMALL = 0x0000d9f003530000ULL;
+    const uint64 MASK_LARGE = 0x0000d93003530000ULL;
+
+    const ANSICHAR MANIFEST_HEADER[] = "GKDELTA1\n";
+
+    struct FGearTable
+    {
+        uint64 Values[256];
+
+        FGearTable()
+        {
+            // SplitMix64, so that every platform and build derives the same boundaries
+            uint64 State = 0x6761'6d65'6b69'7400ULL;
+            for (uint64& Value : Values)
+            {
+                State += 0x9e3779b97f4a7c15ULL;
+                uint64 Mixed = State;
+                Mixed = (Mixed ^ (Mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                Mixed = (Mixed ^ (Mixed >> 27)) * 0x94d049bb133111ebULL;
+                Value = Mixed ^ (Mixed >> 31);
+            }
+        }
+    };
+
+    const FGearTable& GetGearTable()
+    {
+        static const FGearTable Table;
+        return Table;
+    }
+
+    int32 FindCutPoint(const uint8* Data, int64 Remaining)
+    {
+        if (Remaining <= MIN_CHUNK_SIZE)
+        {
+            return static_cast<int32>(Remaining);
+        }
+
+        const int32 End = static_cast<int32>(FMath::Min<int64>(Remaining, MAX_CHUNK_SIZE));
+        const int32 Normal = FMath::Min(End, AVERAGE_CHUNK_SIZE);
+        const uint64* Gear = GetGearTable().Values;
+
+        uint64 Hash = 0;
+        int32 Index = MIN_CHUNK_SIZE;
+        for (; Index < Normal; ++Index)
+        {
+            Hash = (Hash << 1) + Gear[Data[Index]];
+            if ((Hash & MASK_SMALL) == 0)
+            {
+                return Index + 1;
+            }
+        }
+        for (; Index < End; ++Index)
+        {
+            Hash = (Hash << 1) + Gear[Data[Index]];
+            if ((Hash & MASK_LARGE) == 0)
+            {
+                return Index + 1;
+            }
+        }
+        return End;
+    }
+
+    bool IsLowercaseHexHash(const FString& Hash)
+    {
+        if (Hash.Len() != 2 * FSHA1::DigestSize)
+        {
+            return false;
+        }
+        for (const TCHAR Character : Hash)
+        {
+            if (!((Character >= TEXT('0') && Character <= TEXT('9')) || (Character >= TEXT('a') && Character <= TEXT('f'))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TArray<FGameSavingChunk> FAwsGameKitGameSavingDeltaSync::ChunkSaveData(TArrayView<const uint8> Data)
+{
+    TArray<FGameSavingChunk> Chunks;
+    Chunks.Reserve(Data.Num() / AVERAGE_CHUNK_SIZE + 1);
+
+    int64 Offset = 0;
+    while (Offset < Data.Num())
+    {
+        const int32 Size = FindCutPoint(Data.GetData() + Offset, Data.Num() - Offset);
+
+        FGameSavingChunk& Chunk = Chunks.AddDefaulted_GetRef();
+        Chunk.Hash = HashChunk(Data.Slice(static_cast<int32>(Offset), Size));
+        Chunk.Offset = Offset;
+        Chunk.Size = Size;
+
+        Offset += Size;
+    }
+
+    return Chunks;
+}
+
+TArray<uint8> FAwsGameKitGameSavingDeltaSync::WriteManifest(const TArray<FGameSavingChunk>& Chunks)
+{
+    // One "<hash> <size>\n" line per chunk
+    FString Manifest(ANSI_TO_TCHAR(MANIFEST_HEADER));
+    Manifest.Reserve(Manifest.Len() + Chunks.Num() * (2 * FSHA1::DigestSize + 8));
+    for (const FGameSavingChunk& Chunk : Chunks)
+    {
+        Manifest.Appendf(TEXT("%s %d\n"), *Chunk.Hash, Chunk.Size);
+    }
+
+    const FTCHARToUTF8 Converted(*Manifest);
+    return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+bool FAwsGameKitGameSavingDeltaSync::ReadManifest(TArrayView<const uint8> Manifest, TArray<FGameSavingChunk>& OutChunks)
+{
+    OutChunks.Reset();
+
+    const int32 HeaderLength = UE_ARRAY_COUNT(MANIFEST_HEADER) - 1;
+    if (Manifest.Num() < HeaderLength || FCStringAnsi::Strncmp(reinterpret_cast<const ANSICHAR*>(Manifest.GetData()), MANIFEST_HEADER, HeaderLength) != 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingDeltaSync::ReadManifest() The save file isn't a delta mode manifest"));
+        return false;
+    }
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Manifest.GetData() + HeaderLength), Manifest.Num() - HeaderLength);
+    const FString Text(Converted.Length(), Converted.Get());
+    TArray<FString> Lines;
+    Text.ParseIntoArrayLines(Lines);
+    OutChunks.Reserve(Lines.Num());
+
+    int64 Offset = 0;
+    for (const FString& Line : Lines)
+    {
+        FString Hash;
+        FString SizeString;
+        int32 Size = 0;
+        if (!Line.Split(TEXT(" "), &Hash, &SizeString) || !IsLowercaseHexHash(Hash) || !SizeString.IsNumeric()
+            || (Size = FCString::Atoi(*SizeString)) <= 0 || Size > MAX_CHUNK_SIZE)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingDeltaSync::ReadManifest() Malformed manifest line: %s"), *Line);
+            OutChunks.Reset();
+            return false;
+        }
+
+        FGameSavingChunk& Chunk = OutChunks.AddDefaulted_GetRef();
+        Chunk.Hash = MoveTemp(Hash);
+        Chunk.Offset = Offset;
+        Chunk.Size = Size;
+        Offset += Size;
+    }
+
+    return true;
+}
+
+TArray<FString> FAwsGameKitGameSavingDeltaSync::GetMissingChunks(const TArray<FGameSavingChunk>& Manifest, const TArray<FGameSavingChunk>& LocalChunks)
+{
+    TSet<FString> Available;
+    Available.Reserve(LocalChunks.Num());
+    for (const FGameSavingChunk& Chunk : LocalChunks)
+    {
+        Available.Add(Chunk.Hash);
+    }
+
+    TArray<FString> Missing;
+    for (const FGameSavingChunk& Chunk : Manifest)
+    {
+        bool bAlreadyAvailable = false;
+        Available.Add(Chunk.Hash, &bAlreadyAvailable);
+        if (!bAlreadyAvailable)
+        {
+            Missing.Add(Chunk.Hash);
+        }
+    }
+
+    return Missing;
+}
+
+bool FAwsGameKitGameSavingDeltaSync::AssembleSaveData(const TArray<FGameSavingChunk>& Manifest, TFunctionRef<TArrayView<const uint8>(const FString& Hash)> FindChunk, TArray<uint8>& OutData)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    int64 TotalSize = 0;
+    for (const FGameSavingChunk& Chunk : Manifest)
+    {
+        TotalSize += Chunk.Size;
+    }
+    if (TotalSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingDeltaSync::AssembleSaveData() The save file is too large: %lld bytes"), TotalSize);
+        return false;
+    }
+
+    OutData.SetNumUninitialized(static_cast<int32>(TotalSize));
+
+    int64 Offset = 0;
+    for (const FGameSavingChunk& Chunk : Manifest)
+    {
+        const TArrayView<const uint8> Content = FindChunk(Chunk.Hash);
+        if (Content.Num() != Chunk.Size || HashChunk(Content) != Chunk.Hash)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingDeltaSync::AssembleSaveData() Chunk %s is missing or doesn't match the manifest"), *Chunk.Hash);
+            OutData.Reset();
+            return false;
+        }
+
+        FMemory::Memcpy(OutData.GetData() + Offset, Content.GetData(), Content.Num());
+        Offset += Content.Num();
+    }
+
+    return true;
+}
+
+FString FAwsGameKitGameSavingDeltaSync::HashChunk(TArrayView<const uint8> Data)
+{
+    uint8 Digest[FSHA1::DigestSize];
+    FSHA1::HashBuffer(Data.GetData(), Data.Num(), Digest);
+
+    FString Hash;
+    Hash.Reserve(2 * FSHA1::DigestSize);
+    for (const uint8 Byte : Digest)
+    {
+        Hash.Appendf(TEXT("%02x"), Byte);
+    }
+    return Hash;
+}
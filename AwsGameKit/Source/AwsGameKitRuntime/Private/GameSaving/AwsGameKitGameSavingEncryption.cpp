@@ -0,0 +1,208 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingEncryption.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
+#include "PlatformCrypto.h"
+
+namespace
+{
+    // "GKSAVE", a format version, the algorithm, then the nonce
+    const uint8 HEADER_MAGIC[] = { 'G', 'K', 'S', 'A', 'V', 'E' };
+    const uint8 HEADER_VERSION = 1;
+    const uint8 ALGORITHM_AES_256_GCM = 1;
+    const int32 NONCE_SIZE = 12;
+    const int32 HEADER_SIZE = sizeof(HEADER_MAGIC) + 2 + NONCE_SIZE;
+    const int32 TAG_SIZE = 16;
+    const int32 KEY_SIZE = 32;
+
+    // Large enough for the cipher to run at full speed, small enough for each chunk to stay in the cache between its read and its write
+    const int32 CHUNK_SIZE = 1024 * 1024;
+
+    FRWLock KeyProviderLock;
+    FAwsGameKitGameSavingEncryption::FKeyProvider KeyProvider;
+    bool bRequireEncryption = true;
+
+    bool GetKey(const FString& SlotName, TArray<uint8>& OutKey)
+    {
+        FAwsGameKitGameSavingEncryption::FKeyProvider provider;
+        {
+            FReadScopeLock scopeLock(KeyProviderLock);
+            provider = KeyProvider;
+        }
+
+        if (!provider || !provider(SlotName, OutKey))
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption: No key for slot %s"), *SlotName);
+            return false;
+        }
+
+        if (OutKey.Num() != KEY_SIZE)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption: The key of slot %s is %d bytes, AES-256 needs %d"), *SlotName, OutKey.Num(), KEY_SIZE);
+            FMemory::Memzero(OutKey.GetData(), OutKey.Num());
+            return false;
+        }
+
+        return true;
+    }
+
+    // Runs the cipher over Input in chunks, writing to Output. Returns the number of bytes written, or -1 if the cipher failed.
+    template <typename CipherType>
+    int32 RunCipher(CipherType& Cipher, TArrayView<const uint8> Input, TArrayView<uint8> Output)
+    {
+        int32 written = 0;
+        for (int32 offset = 0; offset < Input.Num(); offset += CHUNK_SIZE)
+        {
+            int32 chunkWritten = 0;
+            const TArrayView<const uint8> chunk = Input.Slice(offset, FMath::Min(CHUNK_SIZE, Input.Num() - offset));
+            if (Cipher.Update(chunk, Output.Slice(written, Output.Num() - written), chunkWritten) != EPlatformCryptoResult::Success)
+            {
+                return -1;
+            }
+            written += chunkWritten;
+        }
+
+        int32 finalWritten = 0;
+        if (Cipher.Finalize(Output.Slice(written, Output.Num() - written), finalWritten) != EPlatformCryptoResult::Success)
+        {
+            return -1;
+        }
+        return written + finalWritten;
+    }
+}
+
+void FAwsGameKitGameSavingEncryption::SetKeyProvider(FKeyProvider Provider)
+{
+    FWriteScopeLock scopeLock(KeyProviderLock);
+    KeyProvider = MoveTemp(Provider);
+    bRequireEncryption = true;
+}
+
+bool FAwsGameKitGameSavingEncryption::IsEnabled()
+{
+    FReadScopeLock scopeLock(KeyProviderLock);
+    return static_cast<bool>(KeyProvider);
+}
+
+void FAwsGameKitGameSavingEncryption::SetRequireEncryption(bool bRequire)
+{
+    FWriteScopeLock scopeLock(KeyProviderLock);
+    bRequireEncryption = bRequire;
+}
+
+bool FAwsGameKitGameSavingEncryption::IsEncryptionRequired()
+{
+    FReadScopeLock scopeLock(KeyProviderLock);
+    return bRequireEncryption && static_cast<bool>(KeyProvider);
+}
+
+bool FAwsGameKitGameSavingEncryption::Encrypt(TArrayView<const uint8> Data, const FString& SlotName, TArray<uint8>& OutPayload)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+
+    TArray<uint8> key;
+    ON_SCOPE_EXIT { FMemory::Memzero(key.GetData(), key.Num()); };
+    if (!GetKey(SlotName, key))
+    {
+        return false;
+    }
+
+    uint8 nonce[NONCE_SIZE];
+    TUniquePtr<FEncryptionContext> context = IPlatformCrypto::Get().CreateContext();
+    if (!context.IsValid() || context->CreateRandomBytes(TArrayView<uint8>(nonce, NONCE_SIZE)) != EPlatformCryptoResult::Success)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Encrypt() Could not generate a nonce for slot %s"), *SlotName);
+        return false;
+    }
+
+    TUniquePtr<IPlatformCryptoEncryptor> encryptor = context->CreateEncryptor_AES_256_GCM(key, TArrayView<const uint8>(nonce, NONCE_SIZE));
+    if (!encryptor.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Encrypt() AES-256-GCM isn't available on this platform"));
+        return false;
+    }
+
+    // GCM doesn't pad, the slack only satisfies the cipher's output size checks
+    const int32 slack = encryptor->GetCipherBlockSizeBytes() + encryptor->GetFinalizeBufferSizeBytes();
+    OutPayload.Reset(HEADER_SIZE + Data.Num() + slack + TAG_SIZE);
+    OutPayload.Append(HEADER_MAGIC, sizeof(HEADER_MAGIC));
+    OutPayload.Add(HEADER_VERSION);
+    OutPayload.Add(ALGORITHM_AES_256_GCM);
+    OutPayload.Append(nonce, NONCE_SIZE);
+    OutPayload.AddUninitialized(Data.Num() + slack);
+
+    const int32 encryptedSize = RunCipher(*encryptor, Data, TArrayView<uint8>(OutPayload.GetData() + HEADER_SIZE, Data.Num() + slack));
+    if (encryptedSize < 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Encrypt() Could not encrypt slot %s"), *SlotName);
+        return false;
+    }
+
+    OutPayload.SetNum(HEADER_SIZE + encryptedSize + TAG_SIZE, false);
+    int32 tagWritten = 0;
+    if (encryptor->GenerateAuthTag(TArrayView<uint8>(OutPayload.GetData() + HEADER_SIZE + encryptedSize, TAG_SIZE), tagWritten) != EPlatformCryptoResult::Success || tagWritten != TAG_SIZE)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Encrypt() Could not authenticate slot %s"), *SlotName);
+        return false;
+    }
+
+    return true;
+}
+
+bool FAwsGameKitGameSavingEncryption::IsEncrypted(TArrayView<const uint8> Payload)
+{
+    return Payload.Num() >= HEADER_SIZE + TAG_SIZE && FMemory::Memcmp(Payload.GetData(), HEADER_MAGIC, sizeof(HEADER_MAGIC)) == 0;
+}
+
+bool FAwsGameKitGameSavingEncryption::Decrypt(TArrayView<const uint8> Payload, const FString& SlotName, TArray<uint8>& OutData)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+
+    if (!IsEncrypted(Payload) || Payload[sizeof(HEADER_MAGIC)] != HEADER_VERSION || Payload[sizeof(HEADER_MAGIC) + 1] != ALGORITHM_AES_256_GCM)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Decrypt() Slot %s has an unsupported encryption header"), *SlotName);
+        return false;
+    }
+
+    TArray<uint8> key;
+    ON_SCOPE_EXIT { FMemory::Memzero(key.GetData(), key.Num()); };
+    if (!GetKey(SlotName, key))
+    {
+        return false;
+    }
+
+    const TArrayView<const uint8> nonce = Payload.Slice(HEADER_SIZE - NONCE_SIZE, NONCE_SIZE);
+    const TArrayView<const uint8> tag = Payload.Slice(Payload.Num() - TAG_SIZE, TAG_SIZE);
+    const TArrayView<const uint8> encrypted = Payload.Slice(HEADER_SIZE, Payload.Num() - HEADER_SIZE - TAG_SIZE);
+
+    TUniquePtr<FEncryptionContext> context = IPlatformCrypto::Get().CreateContext();
+    TUniquePtr<IPlatformCryptoDecryptor> decryptor = context.IsValid() ? context->CreateDecryptor_AES_256_GCM(key, nonce, tag) : nullptr;
+    if (!decryptor.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Decrypt() AES-256-GCM isn't available on this platform"));
+        return false;
+    }
+
+    const int32 slack = decryptor->GetCipherBlockSizeBytes() + decryptor->GetFinalizeBufferSizeBytes();
+    OutData.SetNumUninitialized(encrypted.Num() + slack, false);
+
+    // Finalize() fails if the authentication tag doesn't match
+    const int32 decryptedSize = RunCipher(*decryptor, encrypted, TArrayView<uint8>(OutData));
+    if (decryptedSize < 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitGameSavingEncryption::Decrypt() Slot %s failed its authentication, it was tampered with or encrypted with another key"), *SlotName);
+        OutData.Reset();
+        return false;
+    }
+
+    OutData.SetNum(decryptedSize, false);
+    return true;
+}
@@ -11,12 +11,16 @@
 #include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Core/Logging.h"
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
 
 // Standard library
 #include <vector>
 
 // Unreal
 #include "Async/Async.h"
+#include "Misc/ScopeLock.h"
 
 /**
  * Macro for dispatcher parameters
@@ -30,29 +34,17 @@ void UAwsGameKitGameSavingFunctionLibrary::AddLocalSlots(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "AddLocalSlots");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, FilePaths, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([FilePaths, State]
+        Action->LaunchThreadedWork(TEXT("GameSaving.AddLocalSlots"), [FilePaths, State]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
-
-                // Transform local slot information file paths into const char**
-                const unsigned int arraySize = FilePaths.FilePaths.Num();
-                TArray<std::string> strFilePaths;
-                TArray<const char*> rawFilePaths;
-                strFilePaths.SetNum(arraySize);
-                rawFilePaths.SetNum(arraySize);
-                for (unsigned int i = 0; i < arraySize; ++i)
-                {
-                    strFilePaths[i] = TCHAR_TO_UTF8(*FilePaths.FilePaths[i]);
-                    rawFilePaths[i] = strFilePaths[i].c_str();
-                }
-                
-                gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), arraySize);
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+
+                InternalAwsGameKitAddLocalSlots(gameSavingLibrary, FilePaths.FilePaths);
                 IntResult result = IntResult(GameKit::GAMEKIT_SUCCESS);
                 State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
             });
@@ -66,23 +58,27 @@ void UAwsGameKitGameSavingFunctionLibrary::GetAllSlotSyncStatuses(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "GetAllSlotSyncStatuses");
 
     TAwsGameKitInternalActionStatePtr<TArray<FGameSavingSlot>> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("GameSaving.GetAllSlotSyncStatuses"), [State]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+                InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
                 {
-                    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses(): GetAllSlotSyncStatuses::Dispatch"));
+                    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetAllSlotSyncStatuses(): GetAllSlotSyncStatuses::Dispatch"));
 
-                    TArray<FGameSavingSlot> gameSavingResults = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+                    if (callStatus == GameKit::GAMEKIT_SUCCESS)
+                    {
+                        FAwsGameKitGameSavingSlotIndex::Get().Update(cachedSlots, slotCount);
+                    }
 
-                    State->Results = MoveTemp(gameSavingResults);
+                    State->Results = FGameSavingSlot::ToArray(cachedSlots, slotCount);
                 };
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
 
@@ -102,25 +98,26 @@ void UAwsGameKitGameSavingFunctionLibrary::GetSlotSyncStatus(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetSlotSyncStatus()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetSlotSyncStatus()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "GetSlotSyncStatus", Request.SlotName);
 
     TAwsGameKitInternalActionStatePtr<FGameSavingSlotActionResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        Action->LaunchThreadedWork(TEXT("GameSaving.GetSlotSyncStatus"), [State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+                InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
                 {
-                    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
+                    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::GetSlotSyncStatus() GetSlotSyncStatus::Dispatch"));
 
                     FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+                    InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, gameSavingResults.Slots.Slots);
                     gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
 
-                    State->Results = gameSavingResults;
+                    State->Results = MoveTemp(gameSavingResults);
                 };
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
@@ -138,29 +135,31 @@ void UAwsGameKitGameSavingFunctionLibrary::DeleteSlot(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::DeleteSlot()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::DeleteSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "DeleteSlot", Request.SlotName);
 
     TAwsGameKitInternalActionStatePtr<FGameSavingSlotActionResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        Action->LaunchThreadedWork(TEXT("GameSaving.DeleteSlot"), [State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+                InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
 
                 auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
                 {
-                    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::DeleteSlot() DeleteSlot::Dispatch"));
+                    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::DeleteSlot() DeleteSlot::Dispatch"));
 
                     FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+                    InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, gameSavingResults.Slots.Slots);
                     gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
 
-                    State->Results = gameSavingResults;
+                    State->Results = MoveTemp(gameSavingResults);
                 };
                 typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
 
                 IntResult result = IntResult(gameSavingLibrary.GameSavingWrapper->GameKitDeleteSlot(gameSavingLibrary.GameSavingInstanceHandle, DISPATCHER, TCHAR_TO_UTF8(ToCStr(Request.SlotName))));
+                FAwsGameKitGameSavingChangeTracker::Get().Forget(Request.SlotName);
                 State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
             });
     }
@@ -174,33 +173,16 @@ void UAwsGameKitGameSavingFunctionLibrary::SaveSlot(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::SaveSlot()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::SaveSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveSlot", Request.SlotName, Request.Data.Num());
 
     TAwsGameKitInternalActionStatePtr<FGameSavingSlotActionResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        Action->LaunchThreadedWork(TEXT("GameSaving.SaveSlot"), [State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
-
-                auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, unsigned int callStatus)
-                {
-                    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::SaveSlot() SaveSlot::Dispatch"));
-
-                    FGameSavingSlotActionResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
-
-                    State->Results = gameSavingResults;
-                };
-                typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
-
-                ModelCache modelCache(Request);
-                GameSavingModel gameSavingModel = modelCache;
-
-                IntResult result = IntResult(gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, DISPATCHER, gameSavingModel));
-                State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+                const unsigned int callStatus = InternalAwsGameKitSaveSlot(FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary(), Request, State->Results);
+                State->Err = FAwsGameKitOperationResult{ static_cast<int>(callStatus), FString() };
             });
     }
 }
@@ -213,39 +195,97 @@ void UAwsGameKitGameSavingFunctionLibrary::LoadSlot(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::LoadSlot()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::LoadSlot()"));
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "LoadSlot", Request.SlotName);
 
     TAwsGameKitInternalActionStatePtr<FGameSavingDataResults> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State, Request]
+        Action->LaunchThreadedWork(TEXT("GameSaving.LoadSlot"), [State, Request]
             {
-                FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-                GameSavingLibrary gameSavingLibrary = runtimeModule->GetGameSavingLibrary();
+                const unsigned int callStatus = InternalAwsGameKitLoadSlot(FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary(), Request, State->Results);
+                State->Err = FAwsGameKitOperationResult{ static_cast<int>(callStatus), FString() };
+            });
+    }
+}
 
-                auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* slot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
-                { 
-                    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::LoadSlot() LoadSlot::Dispatch"));
+void UAwsGameKitGameSavingFunctionLibrary::SaveSlots(
+    UObject* WorldContextObject,
+    FLatentActionInfo LatentInfo,
+    const TArray<FGameSavingSaveSlotRequest>& Requests,
+    const FDelegateOnSaveSlotsResultReceived OnPartialResults,
+    TArray<FGameSavingSlotActionResults>& Results,
+    EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+    FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::SaveSlots() %d slots"), Requests.Num());
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "SaveSlots");
 
-                    FGameSavingDataResults gameSavingResults;
-                    gameSavingResults.Slots.Slots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
-                    gameSavingResults.ActedOnSlot = FGameSavingSlot::From(*slot);
-                    gameSavingResults.Data.AddUninitialized(dataSize);
-                    FMemory::Memcpy(gameSavingResults.Data.GetData(), (uint8*)data, dataSize);
+    TAwsGameKitInternalActionStatePtr<TArray<FGameSavingSlotActionResults>> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Requests, SuccessOrFailure, Error, Results, OnPartialResults))
+    {
+        Action->LaunchThreadedWork(TEXT("GameSaving.SaveSlots"), [State, Requests]
+            {
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
-                    State->Results = gameSavingResults;
-                }; 
-                typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
+                // The partial results queue has a single producer
+                FCriticalSection partialResultsMutex;
+                InternalAwsGameKitSaveSlots(gameSavingLibrary, Requests, State->Results, [&](int32 index)
+                {
+                    if (State->PartialResultsQueue)
+                    {
+                        FScopeLock scopeLock(&partialResultsMutex);
+                        State->EnqueuePartialResults(TArray<FGameSavingSlotActionResults>{ State->Results[index] });
+                    }
+                });
+
+                State->Err = FAwsGameKitOperationResult{ static_cast<int>(InternalAwsGameKitGameSavingBatchStatus(State->Results)), FString() };
+            });
+    }
+}
+
+void UAwsGameKitGameSavingFunctionLibrary::LoadSlots(
+    UObject* WorldContextObject,
+    FLatentActionInfo LatentInfo,
+    const TArray<FGameSavingLoadSlotRequest>& Requests,
+    const FDelegateOnLoadSlotsResultReceived OnPartialResults,
+    TArray<FGameSavingDataResults>& Results,
+    EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+    FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitGameSavingBlueprintFunctionLibrary::LoadSlots() %d slots"), Requests.Num());
+    AWSGAMEKIT_TRACE_CALL("GameSaving", "LoadSlots");
 
-                ModelCache modelCache(Request);
-                GameSavingModel gameSavingModel = modelCache;
+    TAwsGameKitInternalActionStatePtr<TArray<FGameSavingDataResults>> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Requests, SuccessOrFailure, Error, Results, OnPartialResults))
+    {
+        Action->LaunchThreadedWork(TEXT("GameSaving.LoadSlots"), [State, Requests]
+            {
+                const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
 
-                IntResult result = IntResult(gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, DISPATCHER, gameSavingModel));
-                State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+                // The partial results queue has a single producer
+                FCriticalSection partialResultsMutex;
+                State->Results.SetNum(Requests.Num());
+                InternalAwsGameKitGameSavingParallelFor(Requests.Num(), [&](int32 index)
+                {
+                    InternalAwsGameKitLoadSlot(gameSavingLibrary, Requests[index], State->Results[index]);
+                    if (State->PartialResultsQueue)
+                    {
+                        FScopeLock scopeLock(&partialResultsMutex);
+                        State->EnqueuePartialResults(TArray<FGameSavingDataResults>{ State->Results[index] });
+                    }
+                });
+
+                State->Err = FAwsGameKitOperationResult{ static_cast<int>(InternalAwsGameKitGameSavingBatchStatus(State->Results)), FString() };
             });
     }
 }
 
+TArray<FGameSavingSlot> UAwsGameKitGameSavingFunctionLibrary::GetCachedSlots()
+{
+    return FAwsGameKitGameSavingSlotIndex::Get().GetSlots();
+}
+
 FString UAwsGameKitGameSavingFunctionLibrary::EpochToHumanReadable(int64 epochTime)
 {
     // time for a save slot is in epoch milliseconds, FDateTime is expecting seconds
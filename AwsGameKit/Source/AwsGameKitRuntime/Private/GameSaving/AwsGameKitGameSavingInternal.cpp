@@ -0,0 +1,578 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitStats.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "Core/AwsGameKitDispatcher.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Core/AwsGameKitTrace.h"
+#include "GameSaving/AwsGameKitGameSavingAsyncFileReader.h"
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+#include "GameSaving/AwsGameKitGameSavingChecksum.h"
+#include "GameSaving/AwsGameKitGameSavingCompression.h"
+#include "GameSaving/AwsGameKitGameSavingEncryption.h"
+#include "GameSaving/AwsGameKitGameSavingLoginPrefetcher.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+
+// Unreal
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+// Standard library
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingBatchParallelism(
+    TEXT("GameKit.GameSaving.BatchParallelism"),
+    4,
+    TEXT("Largest number of slots SaveSlots and LoadSlots transfer at the same time. The batches share the GameKit worker pool, see GameKit.WorkerPool.NumThreads.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarGameKitGameSavingLazyLocalSlots(
+    TEXT("GameKit.GameSaving.LazyLocalSlots"),
+    false,
+    TEXT("If true, AddLocalSlots returns straight away and the SaveInfo.json files are parsed by the next Game Saving call which uses the cached slots.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingResultSlots(
+    TEXT("GameKit.GameSaving.ResultSlots"),
+    0,
+    TEXT("Which slots the results of GetSlotSyncStatus, SaveSlot, LoadSlot and DeleteSlot carry besides the acted-on slot.\n")
+    TEXT("  0: a copy of every cached slot\n")
+    TEXT("  1: none, read the cached slots from FAwsGameKitGameSavingSlotIndex instead\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Largest single IFileHandle::Write() call when LoadSlot writes a save file to FGameSavingLoadSlotRequest::SaveFilePath
+    const int64 SAVE_FILE_WRITE_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    struct FLocalSlotsState
+    {
+        // Held while SaveInfo.json files are added, so that a flush waits for an AddLocalSlots in progress
+        FCriticalSection AddMutex;
+        TArray<FString> PendingFilePaths;
+
+        FCriticalSection PrefetchMutex;
+        TMap<FString, TArray<uint8>> Prefetched;
+
+        std::atomic<bool> bUsesDefaultFileActions{ true };
+    };
+
+    FLocalSlotsState& GetLocalSlotsState()
+    {
+        static FLocalSlotsState State;
+        return State;
+    }
+
+    int32 GetBatchLanes(int32 Count)
+    {
+        return FMath::Clamp(CVarGameKitGameSavingBatchParallelism.GetValueOnAnyThread(), 1, Count);
+    }
+
+    // Save files of a SaveSlots batch which are being read in the background, indexed like the requests
+    class FSaveFilePrefetcher
+    {
+    public:
+        FSaveFilePrefetcher(const TArray<FGameSavingSaveSlotRequest>& InRequests) :
+            Requests(InRequests)
+        {
+            Readers.SetNum(Requests.Num());
+            Claimed.SetNumZeroed(Requests.Num());
+        }
+
+        // Start reading a slot's save file, unless it has no SaveFilePath or was already started or taken
+        void Prefetch(int32 Index)
+        {
+            FScopeLock scopeLock(&Mutex);
+            if (Index < Requests.Num() && !Claimed[Index] && !Requests[Index].SaveFilePath.IsEmpty())
+            {
+                Claimed[Index] = true;
+                Readers[Index] = MakeUnique<FAwsGameKitGameSavingAsyncFileReader>(Requests[Index].SaveFilePath);
+            }
+        }
+
+        // Take the slot's reader, starting its read now if it wasn't prefetched. Null if the slot has no SaveFilePath.
+        TUniquePtr<FAwsGameKitGameSavingAsyncFileReader> Take(int32 Index)
+        {
+            Prefetch(Index);
+            FScopeLock scopeLock(&Mutex);
+            return MoveTemp(Readers[Index]);
+        }
+
+    private:
+        const TArray<FGameSavingSaveSlotRequest>& Requests;
+        FCriticalSection Mutex;
+        TArray<TUniquePtr<FAwsGameKitGameSavingAsyncFileReader>> Readers;
+        TArray<bool> Claimed;
+    };
+
+    unsigned int SaveSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingSaveSlotRequest& Request, ModelCache& modelCache, FGameSavingSlotActionResults& OutResults)
+    {
+        if (!modelCache.IsDataLoaded())
+        {
+            OutResults.CallStatus = GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+            return OutResults.CallStatus;
+        }
+
+        const FString& contentHash = modelCache.GetContentHash();
+        if (!Request.OverrideSync && !contentHash.IsEmpty() && FAwsGameKitGameSavingChangeTracker::Get().IsUnchanged(Request.SlotName, contentHash))
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("InternalAwsGameKitSaveSlot() Slot %s hasn't changed since it was last synced, skipping the upload"), *Request.SlotName);
+            OutResults.ActedOnSlot = FGameSavingSlot{ Request.SlotName, Request.Metadata };
+            OutResults.CallStatus = GameKit::GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC;
+            return OutResults.CallStatus;
+        }
+
+        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+        {
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("InternalAwsGameKitSaveSlot() SaveSlot::Dispatch"));
+
+            if (callStatus == GameKit::GAMEKIT_SUCCESS && !contentHash.IsEmpty())
+            {
+                FAwsGameKitGameSavingChangeTracker::Get().RecordSync(Request.SlotName, contentHash);
+            }
+
+            InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, OutResults.Slots.Slots);
+            OutResults.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
+            OutResults.CallStatus = callStatus;
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+
+        GameSavingModel gameSavingModel = modelCache;
+        OutResults.CallStatus = gameSavingLibrary.GameSavingWrapper->GameKitSaveSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
+        if (OutResults.CallStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            FAwsGameKitStats::AddBytesUploaded(modelCache.GetDataSize());
+        }
+        return OutResults.CallStatus;
+    }
+}
+
+namespace
+{
+    void AddLocalSlotsNow(const GameSavingLibrary& gameSavingLibrary, const TArray<FString>& FilePaths)
+    {
+        FLocalSlotsState& state = GetLocalSlotsState();
+
+        // The Game Saving library reads and parses the files one at a time, so their disk reads are done in parallel first
+        if (state.bUsesDefaultFileActions && FilePaths.Num() > 1)
+        {
+            TArray<TArray<uint8>> contents;
+            contents.SetNum(FilePaths.Num());
+            InternalAwsGameKitGameSavingParallelFor(FilePaths.Num(), [&](int32 index)
+            {
+                AWSGAMEKIT_LLM_SCOPE(GameSaving);
+                FFileHelper::LoadFileToArray(contents[index], *FilePaths[index], FILEREAD_Silent);
+            });
+
+            FScopeLock scopeLock(&state.PrefetchMutex);
+            state.Prefetched.Reserve(FilePaths.Num());
+            for (int32 index = 0; index < FilePaths.Num(); ++index)
+            {
+                if (contents[index].Num() > 0)
+                {
+                    state.Prefetched.Add(FilePaths[index], MoveTemp(contents[index]));
+                }
+            }
+        }
+
+        // Transform local slot information file paths into const char**
+        const unsigned int arraySize = FilePaths.Num();
+        int32 convertedSize = 0;
+        for (const FString& filePath : FilePaths)
+        {
+            convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(filePath);
+        }
+        FAwsGameKitInternalTempStrings ConvertString;
+        ConvertString.Reserve(convertedSize);
+
+        TArray<const char*> rawFilePaths;
+        rawFilePaths.Reserve(arraySize);
+        for (const FString& filePath : FilePaths)
+        {
+            rawFilePaths.Add(ConvertString(filePath));
+        }
+
+        gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, rawFilePaths.GetData(), arraySize);
+
+        FScopeLock scopeLock(&state.PrefetchMutex);
+        state.Prefetched.Empty();
+    }
+}
+
+void InternalAwsGameKitAddLocalSlots(const GameSavingLibrary& gameSavingLibrary, const TArray<FString>& FilePaths)
+{
+    FLocalSlotsState& state = GetLocalSlotsState();
+    FScopeLock scopeLock(&state.AddMutex);
+
+    state.PendingFilePaths.Append(FilePaths);
+    if (CVarGameKitGameSavingLazyLocalSlots.GetValueOnAnyThread())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("InternalAwsGameKitAddLocalSlots() %d SaveInfo files will be parsed by the next Game Saving call"), state.PendingFilePaths.Num());
+        return;
+    }
+
+    const TArray<FString> filePaths = MoveTemp(state.PendingFilePaths);
+    state.PendingFilePaths.Reset();
+    AddLocalSlotsNow(gameSavingLibrary, filePaths);
+}
+
+void InternalAwsGameKitFlushLocalSlots(const GameSavingLibrary& gameSavingLibrary)
+{
+    FLocalSlotsState& state = GetLocalSlotsState();
+    FScopeLock scopeLock(&state.AddMutex);
+    if (state.PendingFilePaths.Num() == 0)
+    {
+        return;
+    }
+
+    const TArray<FString> filePaths = MoveTemp(state.PendingFilePaths);
+    state.PendingFilePaths.Reset();
+    AddLocalSlotsNow(gameSavingLibrary, filePaths);
+}
+
+void InternalAwsGameKitSetUsesDefaultFileActions(bool bUsesDefaultFileActions)
+{
+    GetLocalSlotsState().bUsesDefaultFileActions = bUsesDefaultFileActions;
+}
+
+bool InternalAwsGameKitUsesDefaultFileActions()
+{
+    return GetLocalSlotsState().bUsesDefaultFileActions;
+}
+
+void InternalAwsGameKitFillCachedSlots(const Slot* cachedSlots, unsigned int slotCount, bool bUpdateIndex, TArray<FGameSavingSlot>& OutSlots)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    if (bUpdateIndex)
+    {
+        FAwsGameKitGameSavingSlotIndex::Get().Update(cachedSlots, slotCount);
+    }
+
+    if (InternalAwsGameKitResultsIncludeCachedSlots())
+    {
+        OutSlots = FGameSavingSlot::ToArray(cachedSlots, slotCount);
+    }
+    else
+    {
+        OutSlots.Reset();
+    }
+}
+
+bool InternalAwsGameKitResultsIncludeCachedSlots()
+{
+    return CVarGameKitGameSavingResultSlots.GetValueOnAnyThread() == 0;
+}
+
+int64 InternalAwsGameKitGetPrefetchedSaveInfoSize(const FString& FilePath)
+{
+    FLocalSlotsState& state = GetLocalSlotsState();
+    FScopeLock scopeLock(&state.PrefetchMutex);
+    const TArray<uint8>* contents = state.Prefetched.Find(FilePath);
+    return contents != nullptr ? contents->Num() : -1;
+}
+
+bool InternalAwsGameKitReadPrefetchedSaveInfo(const FString& FilePath, uint8* Data, int64 Size)
+{
+    FLocalSlotsState& state = GetLocalSlotsState();
+    FScopeLock scopeLock(&state.PrefetchMutex);
+    const TArray<uint8>* contents = state.Prefetched.Find(FilePath);
+    if (contents == nullptr || contents->Num() > Size)
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(Data, contents->GetData(), contents->Num());
+    return true;
+}
+
+void InternalAwsGameKitForgetPrefetchedSaveInfo(const FString& FilePath)
+{
+    FLocalSlotsState& state = GetLocalSlotsState();
+    FScopeLock scopeLock(&state.PrefetchMutex);
+    state.Prefetched.Remove(FilePath);
+}
+
+unsigned int InternalAwsGameKitSaveSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingSaveSlotRequest& Request, FGameSavingSlotActionResults& OutResults)
+{
+    InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+    ModelCache modelCache(Request);
+    return SaveSlot(gameSavingLibrary, Request, modelCache, OutResults);
+}
+
+void InternalAwsGameKitSaveSlots(const GameSavingLibrary& gameSavingLibrary, const TArray<FGameSavingSaveSlotRequest>& Requests, TArray<FGameSavingSlotActionResults>& OutResults, TFunction<void(int32 Index)> OnSlotComplete)
+{
+    OutResults.SetNum(Requests.Num());
+    if (Requests.Num() == 0)
+    {
+        return;
+    }
+
+    InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+    if (!FAwsGameKitGameSavingAsyncFileReader::IsEnabled())
+    {
+        InternalAwsGameKitGameSavingParallelFor(Requests.Num(), [&](int32 index)
+        {
+            InternalAwsGameKitSaveSlot(gameSavingLibrary, Requests[index], OutResults[index]);
+            OnSlotComplete(index);
+        });
+        return;
+    }
+
+    // Every lane starts with its save file in flight, and starts reading the save file of the slot after the current ones before uploading its own.
+    // Slots are claimed in request order, so at most one extra save file per lane is held in memory.
+    const int32 lanes = GetBatchLanes(Requests.Num());
+    FSaveFilePrefetcher prefetcher(Requests);
+    for (int32 index = 0; index < lanes; ++index)
+    {
+        prefetcher.Prefetch(index);
+    }
+
+    InternalAwsGameKitGameSavingParallelFor(Requests.Num(), [&](int32 index)
+    {
+        TUniquePtr<FAwsGameKitGameSavingAsyncFileReader> reader = prefetcher.Take(index);
+        prefetcher.Prefetch(index + lanes);
+
+        if (!reader.IsValid())
+        {
+            InternalAwsGameKitSaveSlot(gameSavingLibrary, Requests[index], OutResults[index]);
+        }
+        else
+        {
+            TArray<uint8> saveFileData;
+            if (reader->Wait(saveFileData))
+            {
+                reader.Reset();
+                ModelCache modelCache(Requests[index], MoveTemp(saveFileData));
+                SaveSlot(gameSavingLibrary, Requests[index], modelCache, OutResults[index]);
+            }
+            else
+            {
+                OutResults[index].CallStatus = GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+            }
+        }
+        OnSlotComplete(index);
+    });
+}
+
+namespace
+{
+    // Writes a downloaded save file next to FilePath, then replaces FilePath with it, so a failed write leaves the previous save file intact
+    bool WriteSaveFile(const FString& FilePath, TArrayView<const uint8> SaveFile)
+    {
+        IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+        platformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+
+        const FString tempFilePath = FilePath + TEXT(".download");
+        TUniquePtr<IFileHandle> fileHandle(platformFile.OpenWrite(*tempFilePath));
+        bool written = fileHandle.IsValid();
+        for (int64 offset = 0; written && offset < SaveFile.Num(); offset += SAVE_FILE_WRITE_CHUNK_SIZE)
+        {
+            written = fileHandle->Write(SaveFile.GetData() + offset, FMath::Min(SAVE_FILE_WRITE_CHUNK_SIZE, SaveFile.Num() - offset));
+        }
+        written = written && fileHandle->Flush(true);
+        fileHandle.Reset();
+
+        written = written && IFileManager::Get().Move(*FilePath, *tempFilePath, true, true, false, true);
+        if (!written)
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("InternalAwsGameKitLoadSlot() Could not write the save file to %s"), *FilePath);
+            IFileManager::Get().Delete(*tempFilePath, false, false, true);
+        }
+        return written;
+    }
+
+    // Refresh the slot's SizeCloud in FAwsGameKitGameSavingSlotIndex, for a LoadSlot() request without Data
+    unsigned int RefreshSlotSize(const GameSavingLibrary& gameSavingLibrary, const FString& SlotName)
+    {
+        UE_LOG(LogAwsGameKit, Verbose, TEXT("InternalAwsGameKitLoadSlot() Getting the size of slot %s"), *SlotName);
+
+        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+        {
+            TArray<FGameSavingSlot> slots;
+            InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, slots);
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+
+        return gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, TCHAR_TO_UTF8(*SlotName));
+    }
+
+    // When OutDeferredContentHash is set, the slot index and the change tracker are left as they were and the content hash is returned instead
+    unsigned int LoadSlotOnce(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults, FString* OutDeferredContentHash = nullptr)
+    {
+        const bool toFile = !Request.SaveFilePath.IsEmpty();
+        unsigned int payloadStatus = GameKit::GAMEKIT_SUCCESS;
+        ModelCache modelCache(Request);
+        GameSavingModel gameSavingModel = modelCache;
+
+        // Set when the save file wasn't compressed and can be moved out of the download buffer once the Game Saving library is done with it
+        const uint8* loadedData = nullptr;
+        int32 loadedDataSize = 0;
+
+        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, const uint8_t* data, unsigned int dataSize, unsigned int callStatus)
+        {
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("InternalAwsGameKitLoadSlot() LoadSlot::Dispatch"));
+            FAwsGameKitTrace::AddBytes(0, dataSize);
+            if (callStatus == GameKit::GAMEKIT_SUCCESS)
+            {
+                FAwsGameKitStats::AddBytesDownloaded(dataSize);
+            }
+
+            InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS && OutDeferredContentHash == nullptr, OutResults.Slots.Slots);
+            OutResults.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
+
+            // Encryption is the outermost layer, the checksum trailer and compression header are inside it
+            TArrayView<const uint8> payload(data, dataSize);
+            TArray<uint8> decryptedData;
+            if (FAwsGameKitGameSavingEncryption::IsEncrypted(payload))
+            {
+                if (!FAwsGameKitGameSavingEncryption::Decrypt(payload, Request.SlotName, decryptedData))
+                {
+                    payloadStatus = GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+                }
+                payload = decryptedData;
+            }
+            else if (payload.Num() > 0 && FAwsGameKitGameSavingEncryption::IsEncryptionRequired())
+            {
+                // Otherwise replacing the cloud save with a plaintext one would get past the encryption
+                UE_LOG(LogAwsGameKit, Error, TEXT("InternalAwsGameKitLoadSlot() Slot %s isn't encrypted, and encryption is required"), *Request.SlotName);
+                payloadStatus = GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+                payload = TArrayView<const uint8>();
+            }
+
+            uint32 expectedChecksum = 0;
+            const bool hasChecksum = FAwsGameKitGameSavingChecksum::StripTrailer(payload, expectedChecksum);
+
+            // A save file which isn't compressed is written to SaveFilePath, or moved into the results, straight from the download buffer without a copy
+            TArray<uint8> decompressedData;
+            TArrayView<const uint8> saveFile = payload;
+            if (FAwsGameKitGameSavingCompression::IsCompressed(payload))
+            {
+                TArray<uint8>& saveFileData = toFile ? decompressedData : OutResults.Data;
+                payloadStatus = FAwsGameKitGameSavingCompression::Decompress(payload, saveFileData) ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+                saveFile = saveFileData;
+            }
+            if (payloadStatus == GameKit::GAMEKIT_SUCCESS && hasChecksum && FAwsGameKitGameSavingChecksum::Crc32c(saveFile) != expectedChecksum)
+            {
+                UE_LOG(LogAwsGameKit, Error, TEXT("InternalAwsGameKitLoadSlot() Slot %s failed its integrity check, the downloaded save file is corrupt"), *Request.SlotName);
+                payloadStatus = GameKit::GAMEKIT_ERROR_FILE_READ_FAILED;
+            }
+
+            if (payloadStatus == GameKit::GAMEKIT_SUCCESS && callStatus == GameKit::GAMEKIT_SUCCESS && toFile)
+            {
+                payloadStatus = WriteSaveFile(Request.SaveFilePath, saveFile) ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_FILE_WRITE_FAILED;
+                OutResults.SaveFilePath = payloadStatus == GameKit::GAMEKIT_SUCCESS ? Request.SaveFilePath : FString();
+            }
+            else if (payloadStatus == GameKit::GAMEKIT_SUCCESS && !toFile && saveFile.GetData() == payload.GetData())
+            {
+                if (payload.GetData() == gameSavingModel.data)
+                {
+                    loadedData = payload.GetData();
+                    loadedDataSize = payload.Num();
+                }
+                else if (payload.GetData() == decryptedData.GetData())
+                {
+                    decryptedData.SetNum(payload.Num(), false);
+                    OutResults.Data = MoveTemp(decryptedData);
+                }
+                else
+                {
+                    OutResults.Data = TArray<uint8>(payload.GetData(), payload.Num());
+                }
+            }
+
+            if (payloadStatus == GameKit::GAMEKIT_SUCCESS && callStatus == GameKit::GAMEKIT_SUCCESS && FAwsGameKitGameSavingChangeTracker::IsEnabled())
+            {
+                const TArrayView<const uint8> metadata(reinterpret_cast<const uint8*>(actedOnSlot->metadataLocal), FCStringAnsi::Strlen(actedOnSlot->metadataLocal));
+                const FString contentHash = hasChecksum && FAwsGameKitGameSavingChecksum::IsEnabled()
+                    ? FAwsGameKitGameSavingChangeTracker::HashContent(saveFile.Num(), expectedChecksum, metadata)
+                    : FAwsGameKitGameSavingChangeTracker::HashContent(saveFile, metadata);
+                if (OutDeferredContentHash != nullptr)
+                {
+                    *OutDeferredContentHash = contentHash;
+                }
+                else
+                {
+                    FAwsGameKitGameSavingChangeTracker::Get().RecordSync(Request.SlotName, contentHash);
+                }
+            }
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, const uint8_t*, unsigned int, unsigned int> Dispatcher;
+
+        const unsigned int callStatus = gameSavingLibrary.GameSavingWrapper->GameKitLoadSlot(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, gameSavingModel);
+        if (loadedData != nullptr)
+        {
+            modelCache.TakeLoadedData(loadedData, loadedDataSize, OutResults.Data);
+        }
+        OutResults.CallStatus = payloadStatus == GameKit::GAMEKIT_SUCCESS ? callStatus : payloadStatus;
+        return OutResults.CallStatus;
+    }
+}
+
+unsigned int InternalAwsGameKitLoadSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults)
+{
+    InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+    const bool toFile = !Request.SaveFilePath.IsEmpty();
+    if (FAwsGameKitGameSavingLoginPrefetcher::Get().Take(gameSavingLibrary, Request, OutResults))
+    {
+        if (toFile && OutResults.CallStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            if (!WriteSaveFile(Request.SaveFilePath, OutResults.Data))
+            {
+                OutResults.CallStatus = GameKit::GAMEKIT_ERROR_FILE_WRITE_FAILED;
+            }
+            OutResults.SaveFilePath = OutResults.CallStatus == GameKit::GAMEKIT_SUCCESS ? Request.SaveFilePath : FString();
+            OutResults.Data.Empty();
+        }
+        return OutResults.CallStatus;
+    }
+
+    // Without Data, the buffer is sized from the slot index, which GetAllSlotSyncStatuses() may not have filled yet
+    const bool autoSized = Request.Data.Num() == 0;
+    FGameSavingSlot indexedSlot;
+    if (autoSized && !FAwsGameKitGameSavingSlotIndex::Get().GetSlot(Request.SlotName, indexedSlot))
+    {
+        RefreshSlotSize(gameSavingLibrary, Request.SlotName);
+    }
+
+    unsigned int callStatus = LoadSlotOnce(gameSavingLibrary, Request, OutResults);
+
+    // The cloud save grew since the slot was indexed, another device saved it
+    if (autoSized && callStatus == GameKit::GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL
+        && RefreshSlotSize(gameSavingLibrary, Request.SlotName) == GameKit::GAMEKIT_SUCCESS)
+    {
+        OutResults = FGameSavingDataResults();
+        callStatus = LoadSlotOnce(gameSavingLibrary, Request, OutResults);
+    }
+
+    return callStatus;
+}
+
+unsigned int InternalAwsGameKitPrefetchSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults, FString& OutContentHash)
+{
+    return LoadSlotOnce(gameSavingLibrary, Request, OutResults, &OutContentHash);
+}
+
+void InternalAwsGameKitGameSavingParallelFor(int32 Count, TFunction<void(int32 Index)> Work)
+{
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    FAwsGameKitWorkerPool::Get().ParallelFor(Count, GetBatchLanes(Count), MoveTemp(Work));
+}
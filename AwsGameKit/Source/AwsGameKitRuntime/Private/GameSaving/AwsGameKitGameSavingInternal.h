@@ -0,0 +1,70 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// Unreal
+#include "Templates/Function.h"
+
+// Blocking AddLocalSlots call shared by AwsGameKitGameSaving and UAwsGameKitGameSavingFunctionLibrary. The SaveInfo.json files are first read in parallel,
+// and the Game Saving library then parses them from memory through DefaultFileActions. When GameKit.GameSaving.LazyLocalSlots is set, the files are only
+// queued here and are added by the next Game Saving call which uses the cached slots, see InternalAwsGameKitFlushLocalSlots().
+void InternalAwsGameKitAddLocalSlots(const GameSavingLibrary& gameSavingLibrary, const TArray<FString>& FilePaths);
+
+// Adds the SaveInfo.json files queued by a lazy InternalAwsGameKitAddLocalSlots(), if any. Called on the worker thread at the start of every Game Saving call
+// which uses the cached slots, so the queued slots are known before the first one is accessed.
+void InternalAwsGameKitFlushLocalSlots(const GameSavingLibrary& gameSavingLibrary);
+
+// Whether the Game Saving library uses DefaultFileActions, set by SetFileActions(). SaveInfo.json files are only read ahead when it does.
+void InternalAwsGameKitSetUsesDefaultFileActions(bool bUsesDefaultFileActions);
+bool InternalAwsGameKitUsesDefaultFileActions();
+
+// SaveInfo.json files read ahead by the InternalAwsGameKitAddLocalSlots() in progress, served to DefaultFileActions. The size is -1 and the read returns false
+// if the file wasn't read ahead, DefaultFileActions then reads it from disk. Writing a file drops its read ahead copy.
+int64 InternalAwsGameKitGetPrefetchedSaveInfoSize(const FString& FilePath);
+bool InternalAwsGameKitReadPrefetchedSaveInfo(const FString& FilePath, uint8* Data, int64 Size);
+void InternalAwsGameKitForgetPrefetchedSaveInfo(const FString& FilePath);
+
+// Fills in OutSlots with the cached slots passed to a Game Saving callback, and updates FAwsGameKitGameSavingSlotIndex from them when bUpdateIndex is set.
+// When GameKit.GameSaving.ResultSlots is 1, OutSlots is left empty and only the index is updated, so the callback converts the acted-on slot alone.
+void InternalAwsGameKitFillCachedSlots(const Slot* cachedSlots, unsigned int slotCount, bool bUpdateIndex, TArray<FGameSavingSlot>& OutSlots);
+
+// Whether the results of the Game Saving calls which act on one slot carry the full list of cached slots, see GameKit.GameSaving.ResultSlots.
+bool InternalAwsGameKitResultsIncludeCachedSlots();
+
+// Blocking SaveSlot and LoadSlot calls shared by AwsGameKitGameSaving and UAwsGameKitGameSavingFunctionLibrary, for single slots and batches.
+// They must be called on a worker thread. OutResults is filled in and the status code is returned, it is also stored in OutResults.CallStatus.
+// LoadSlot is served from FAwsGameKitGameSavingLoginPrefetcher without a download when the slot was prefetched.
+unsigned int InternalAwsGameKitSaveSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingSaveSlotRequest& Request, FGameSavingSlotActionResults& OutResults);
+unsigned int InternalAwsGameKitLoadSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults);
+
+// LoadSlot for FAwsGameKitGameSavingLoginPrefetcher, with the prefetcher's own Game Saving instance. FAwsGameKitGameSavingSlotIndex isn't updated, and the
+// slot's content hash is returned in OutContentHash instead of being recorded by FAwsGameKitGameSavingChangeTracker, until the prefetched slot is loaded.
+unsigned int InternalAwsGameKitPrefetchSlot(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults, FString& OutContentHash);
+
+// Blocking batch SaveSlot shared by AwsGameKitGameSaving::SaveSlots() and UAwsGameKitGameSavingFunctionLibrary::SaveSlots(). Each slot's results are stored
+// in OutResults in request order, and OnSlotComplete(Index) is called on the thread which saved the slot as soon as OutResults[Index] is filled in.
+// When GameKit.GameSaving.AsyncFileIO is set, the save files of the next slots are read in the background while the current slots upload.
+void InternalAwsGameKitSaveSlots(const GameSavingLibrary& gameSavingLibrary, const TArray<FGameSavingSaveSlotRequest>& Requests, TArray<FGameSavingSlotActionResults>& OutResults, TFunction<void(int32 Index)> OnSlotComplete);
+
+// Runs Work(Index) for every Index in [0, Count) on up to GameKit.GameSaving.BatchParallelism threads and returns once all of them have completed.
+// The calling worker thread takes part, so a batch always makes progress even when every other worker is busy.
+void InternalAwsGameKitGameSavingParallelFor(int32 Count, TFunction<void(int32 Index)> Work);
+
+// The status of a batch: GAMEKIT_SUCCESS if every slot succeeded, otherwise the status of the first slot in request order which didn't.
+template <typename ResultsType>
+unsigned int InternalAwsGameKitGameSavingBatchStatus(const TArray<ResultsType>& Results)
+{
+    for (const ResultsType& Result : Results)
+    {
+        if (static_cast<unsigned int>(Result.CallStatus) != GameKit::GAMEKIT_SUCCESS)
+        {
+            return static_cast<unsigned int>(Result.CallStatus);
+        }
+    }
+    return GameKit::GAMEKIT_SUCCESS;
+}
@@ -0,0 +1,327 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingLoginPrefetcher.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitCacheBudget.h"
+#include "Common/AwsGameKitNetworkPolicy.h"
+#include "Core/AwsGameKitDispatcher.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Core/Logging.h"
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+#include "GameSaving/AwsGameKitGameSavingWrapper.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingLoginPrefetchPolicy(
+    TEXT("GameKit.GameSaving.LoginPrefetch.Policy"),
+    0,
+    TEXT("Which save slots are downloaded in the background after login, see FAwsGameKitGameSavingLoginPrefetcher.\n")
+    TEXT("  0: none\n")
+    TEXT("  1: the most recently saved slots\n")
+    TEXT("  2: the most recently saved slots which should be downloaded\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingLoginPrefetchMaxSlots(
+    TEXT("GameKit.GameSaving.LoginPrefetch.MaxSlots"),
+    1,
+    TEXT("Largest number of save slots downloaded in the background after login.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingLoginPrefetchMaxBytes(
+    TEXT("GameKit.GameSaving.LoginPrefetch.MaxBytes"),
+    64 * 1024 * 1024,
+    TEXT("Largest total size of the save slots downloaded in the background after login, which are held in memory until they're loaded.\n"),
+    ECVF_Default);
+
+FAwsGameKitGameSavingLoginPrefetcher& FAwsGameKitGameSavingLoginPrefetcher::Get()
+{
+    static FAwsGameKitGameSavingLoginPrefetcher Instance;
+    return Instance;
+}
+
+EAwsGameKitGameSavingLoginPrefetchPolicy FAwsGameKitGameSavingLoginPrefetcher::GetPolicy()
+{
+    const int32 Policy = CVarGameKitGameSavingLoginPrefetchPolicy.GetValueOnAnyThread();
+    return Policy == 1 || Policy == 2 ? static_cast<EAwsGameKitGameSavingLoginPrefetchPolicy>(Policy) : EAwsGameKitGameSavingLoginPrefetchPolicy::None;
+}
+
+void FAwsGameKitGameSavingLoginPrefetcher::OnLogin()
+{
+    uint32 Generation = 0;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Prefetched.Reset();
+        Generation = ++CurrentGeneration;
+    }
+
+    if (GetPolicy() == EAwsGameKitGameSavingLoginPrefetchPolicy::None)
+    {
+        return;
+    }
+
+    if (!InternalAwsGameKitUsesDefaultFileActions())
+    {
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitGameSavingLoginPrefetcher::OnLogin(): Custom FileActions are set, not prefetching"));
+        return;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([this, Generation]
+    {
+        Prefetch(Generation);
+    }, EAwsGameKitWorkLane::Background);
+}
+
+void FAwsGameKitGameSavingLoginPrefetcher::Prefetch(uint32 Generation)
+{
+    const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+    InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+    TArray<FGameSavingSlot> cachedSlots;
+    unsigned int statusCallStatus = GameKit::GAMEKIT_SUCCESS;
+    auto dispatcher = [&](const Slot* slots, unsigned int slotCount, bool complete, unsigned int callStatus)
+    {
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingLoginPrefetcher::Prefetch() GetAllSlotSyncStatuses::Dispatch"));
+        cachedSlots = FGameSavingSlot::ToArray(slots, slotCount);
+        statusCallStatus = callStatus;
+        if (callStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            FAwsGameKitGameSavingSlotIndex::Get().Update(slots, slotCount);
+        }
+    };
+    typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
+
+    const bool shouldWaitForAllPages = true;
+    const unsigned int defaultPageSize = GameKit::GameSaving::Wrapper::GetAllSlotSyncStatusesDefaultPageSize;
+    gameSavingLibrary.GameSavingWrapper->GameKitGetAllSlotSyncStatuses(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, shouldWaitForAllPages, defaultPageSize);
+    if (statusCallStatus != GameKit::GAMEKIT_SUCCESS)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitGameSavingLoginPrefetcher::Prefetch(): GetAllSlotSyncStatuses failed with %s, not prefetching"), *GameKit::StatusCodeToHexFStr(statusCallStatus));
+        return;
+    }
+
+    // Most recently saved to the cloud first
+    const bool onlyShouldDownload = GetPolicy() == EAwsGameKitGameSavingLoginPrefetchPolicy::ShouldDownload;
+    cachedSlots.RemoveAll([onlyShouldDownload](const FGameSavingSlot& slot)
+    {
+        return slot.SizeCloud <= 0
+            || slot.SlotSyncStatus == SlotSyncStatus_E::SHOULD_UPLOAD_LOCAL
+            || slot.SlotSyncStatus == SlotSyncStatus_E::IN_CONFLICT
+            || (onlyShouldDownload && slot.SlotSyncStatus != SlotSyncStatus_E::SHOULD_DOWNLOAD_CLOUD)
+            || FAwsGameKitNetworkPolicy::Get().ShouldDeferTransfer(slot.SizeCloud);
+    });
+    cachedSlots.Sort([](const FGameSavingSlot& A, const FGameSavingSlot& B) { return A.LastModifiedCloud > B.LastModifiedCloud; });
+
+    const int32 maxSlots = FMath::Max(0, CVarGameKitGameSavingLoginPrefetchMaxSlots.GetValueOnAnyThread());
+    const int64 maxBytes = CVarGameKitGameSavingLoginPrefetchMaxBytes.GetValueOnAnyThread();
+    int64 totalBytes = 0;
+    int32 slotCount = 0;
+    while (slotCount < FMath::Min(maxSlots, cachedSlots.Num()) && totalBytes + cachedSlots[slotCount].SizeCloud <= maxBytes)
+    {
+        totalBytes += cachedSlots[slotCount].SizeCloud;
+        slotCount++;
+    }
+    if (slotCount == 0)
+    {
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitGameSavingLoginPrefetcher::Prefetch(): Prefetching %d slots (%lld bytes)"), slotCount, totalBytes);
+
+    // A LoadSlot() with the player's instance would count the slots as SYNCED right away, even if the game never loads them. The prefetcher's own
+    // instance, which knows no local slots, is released once the downloads are done.
+    GameSavingLibrary prefetchLibrary;
+    prefetchLibrary.GameSavingWrapper = gameSavingLibrary.GameSavingWrapper;
+    prefetchLibrary.GameSavingInstanceHandle = gameSavingLibrary.GameSavingWrapper->GameKitGameSavingInstanceCreateWithSessionManager(
+        FAwsGameKitRuntimeModule::Get().GetSessionManagerInstance(), FGameKitLogging::LogCallBack, nullptr, 0, DefaultFileActions());
+
+    // LoadSlot() only loads the slots the instance has cached
+    auto prefetchDispatcher = [](const Slot* slots, unsigned int slotCount, bool complete, unsigned int callStatus) {};
+    typedef LambdaDispatcher<decltype(prefetchDispatcher), void, const Slot*, unsigned int, bool, unsigned int> PrefetchDispatcher;
+    statusCallStatus = prefetchLibrary.GameSavingWrapper->GameKitGetAllSlotSyncStatuses(prefetchLibrary.GameSavingInstanceHandle, &prefetchDispatcher, PrefetchDispatcher::Dispatch, shouldWaitForAllPages, defaultPageSize);
+    if (statusCallStatus != GameKit::GAMEKIT_SUCCESS)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitGameSavingLoginPrefetcher::Prefetch(): GetAllSlotSyncStatuses failed with %s, not prefetching"), *GameKit::StatusCodeToHexFStr(statusCallStatus));
+        prefetchLibrary.GameSavingWrapper->GameKitGameSavingInstanceRelease(prefetchLibrary.GameSavingInstanceHandle);
+        return;
+    }
+
+    const FString scratchDirectory = GetScratchDirectory();
+    IFileManager::Get().MakeDirectory(*scratchDirectory, true);
+
+    InternalAwsGameKitGameSavingParallelFor(slotCount, [&](int32 index)
+    {
+        AWSGAMEKIT_LLM_SCOPE(GameSaving);
+        FGameSavingLoadSlotRequest request;
+        request.SlotName = cachedSlots[index].SlotName;
+        request.SaveInfoFilePath = FPaths::Combine(scratchDirectory, request.SlotName + FString(GameKit::GameSaving::Wrapper::SaveInfoFileExtension));
+        request.Data.SetNumUninitialized(cachedSlots[index].SizeCloud);
+
+        FPrefetchedSlot prefetched;
+        if (InternalAwsGameKitPrefetchSlot(prefetchLibrary, request, prefetched.Results, prefetched.ContentHash) != GameKit::GAMEKIT_SUCCESS)
+        {
+            IFileManager::Get().Delete(*request.SaveInfoFilePath, false, false, true);
+            return;
+        }
+        prefetched.SaveInfoFilePath = request.SaveInfoFilePath;
+        prefetched.PrefetchedAt = FPlatformTime::Seconds();
+
+        FScopeLock ScopeLock(&Mutex);
+        if (Generation != CurrentGeneration)
+        {
+            // Logged out or in again while downloading
+            IFileManager::Get().Delete(*prefetched.SaveInfoFilePath, false, false, true);
+            return;
+        }
+        Prefetched.Add(request.SlotName, MoveTemp(prefetched));
+    });
+
+    prefetchLibrary.GameSavingWrapper->GameKitGameSavingInstanceRelease(prefetchLibrary.GameSavingInstanceHandle);
+    FAwsGameKitCacheBudget::Get().RequestEnforce();
+}
+
+bool FAwsGameKitGameSavingLoginPrefetcher::Take(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults)
+{
+    // The slots were prefetched for the module's player, not for the players of FAwsGameKitPlayerContexts
+    if (gameSavingLibrary.GameSavingInstanceHandle != FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary().GameSavingInstanceHandle)
+    {
+        return false;
+    }
+
+    FPrefetchedSlot prefetched;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (!Prefetched.RemoveAndCopyValue(Request.SlotName, prefetched))
+        {
+            return false;
+        }
+    }
+
+    // Stale if the slot was saved or deleted since, from this device or another one
+    FGameSavingSlot indexedSlot;
+    const bool isCurrent = FAwsGameKitGameSavingSlotIndex::Get().GetSlot(Request.SlotName, indexedSlot)
+        && indexedSlot.LastModifiedCloud == prefetched.Results.ActedOnSlot.LastModifiedCloud;
+    const bool isCopied = isCurrent && IFileManager::Get().Copy(*Request.SaveInfoFilePath, *prefetched.SaveInfoFilePath) == COPY_OK;
+    IFileManager::Get().Delete(*prefetched.SaveInfoFilePath, false, false, true);
+    if (!isCopied)
+    {
+        return false;
+    }
+
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingLoginPrefetcher::Take(): Serving slot %s from the login prefetch"), *Request.SlotName);
+    OutResults = MoveTemp(prefetched.Results);
+
+    // The slot is SYNCED from now on, as if LoadSlot() had downloaded it: the player's instance reads the SaveInfo.json just written, and the index is
+    // refreshed from the instance's cached slots
+    {
+        const FTCHARToUTF8 saveInfoFilePath(*Request.SaveInfoFilePath);
+        const char* saveInfoFilePaths[] = { saveInfoFilePath.Get() };
+        gameSavingLibrary.GameSavingWrapper->GameKitAddLocalSlots(gameSavingLibrary.GameSavingInstanceHandle, saveInfoFilePaths, 1);
+    }
+    auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, const Slot* actedOnSlot, unsigned int callStatus)
+    {
+        InternalAwsGameKitFillCachedSlots(cachedSlots, slotCount, callStatus == GameKit::GAMEKIT_SUCCESS, OutResults.Slots.Slots);
+        if (callStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            OutResults.ActedOnSlot = FGameSavingSlot::From(*actedOnSlot);
+        }
+    };
+    typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, const Slot*, unsigned int> Dispatcher;
+    gameSavingLibrary.GameSavingWrapper->GameKitGetSlotSyncStatus(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, TCHAR_TO_UTF8(*Request.SlotName));
+
+    if (!prefetched.ContentHash.IsEmpty())
+    {
+        FAwsGameKitGameSavingChangeTracker::Get().RecordSync(Request.SlotName, prefetched.ContentHash);
+    }
+    return true;
+}
+
+void FAwsGameKitGameSavingLoginPrefetcher::Clear()
+{
+    TMap<FString, FPrefetchedSlot> dropped;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        dropped = MoveTemp(Prefetched);
+        Prefetched.Reset();
+        ++CurrentGeneration;
+    }
+
+    for (const TPair<FString, FPrefetchedSlot>& slot : dropped)
+    {
+        IFileManager::Get().Delete(*slot.Value.SaveInfoFilePath, false, false, true);
+    }
+}
+
+void FAwsGameKitGameSavingLoginPrefetcher::RegisterWithCacheBudget()
+{
+    FAwsGameKitBudgetedCache budgeted;
+    budgeted.GetBytes = [this]()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        int64 bytes = 0;
+        for (const TPair<FString, FPrefetchedSlot>& slot : Prefetched)
+        {
+            bytes += slot.Value.Results.Data.GetAllocatedSize();
+        }
+        return bytes;
+    };
+    budgeted.GetOldestUse = [this]()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        double oldest = MAX_dbl;
+        for (const TPair<FString, FPrefetchedSlot>& slot : Prefetched)
+        {
+            oldest = FMath::Min(oldest, slot.Value.PrefetchedAt);
+        }
+        return oldest;
+    };
+    budgeted.EvictOldest = [this]()
+    {
+        return EvictOldestSlot();
+    };
+    FAwsGameKitCacheBudget::Get().RegisterCache(TEXT("GameSavingPrefetch"), EAwsGameKitCachePriority::Low, MoveTemp(budgeted));
+}
+
+int64 FAwsGameKitGameSavingLoginPrefetcher::EvictOldestSlot()
+{
+    FPrefetchedSlot evicted;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        const FString* oldestName = nullptr;
+        double oldest = MAX_dbl;
+        for (const TPair<FString, FPrefetchedSlot>& slot : Prefetched)
+        {
+            if (slot.Value.PrefetchedAt < oldest)
+            {
+                oldestName = &slot.Key;
+                oldest = slot.Value.PrefetchedAt;
+            }
+        }
+        if (oldestName == nullptr)
+        {
+            return 0;
+        }
+
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingLoginPrefetcher: Dropping prefetched slot %s"), **oldestName);
+        Prefetched.RemoveAndCopyValue(FString(*oldestName), evicted);
+    }
+
+    IFileManager::Get().Delete(*evicted.SaveInfoFilePath, false, false, true);
+    return FMath::Max<int64>(1, evicted.Results.Data.GetAllocatedSize());
+}
+
+FString FAwsGameKitGameSavingLoginPrefetcher::GetScratchDirectory() const
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("GameSavingPrefetch"));
+}
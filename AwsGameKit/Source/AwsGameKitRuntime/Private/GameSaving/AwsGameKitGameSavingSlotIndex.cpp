@@ -0,0 +1,254 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Core/AwsGameKitDispatcher.h"
+#include "Core/AwsGameKitMemory.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarGameKitGameSavingSlotIndexRefreshSeconds(
+    TEXT("GameKit.GameSaving.SlotIndex.RefreshSeconds"),
+    0.0f,
+    TEXT("Interval in seconds at which the slot index refreshes the cached slots with GetAllSlotSyncStatuses in the background, see FAwsGameKitGameSavingSlotIndex.\n")
+    TEXT("  0: disabled\n"),
+    ECVF_Default);
+
+FAwsGameKitGameSavingSlotIndex& FAwsGameKitGameSavingSlotIndex::Get()
+{
+    static FAwsGameKitGameSavingSlotIndex Instance;
+    return Instance;
+}
+
+void FAwsGameKitGameSavingSlotIndex::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitGameSavingSlotIndex::Tick), 1.0f);
+}
+
+void FAwsGameKitGameSavingSlotIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    Clear();
+    SetSyncStatusChangeDelegate(FSyncStatusChangeDelegate());
+}
+
+void FAwsGameKitGameSavingSlotIndex::Update(const TArray<FGameSavingSlot>& CachedSlots)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    TArray<FGameSavingSlot> Changed;
+    FSyncStatusChangeDelegate Delegate;
+    {
+        FScopeLock ScopeLock(&Mutex);
+
+        TMap<FString, FGameSavingSlot> Updated;
+        Updated.Reserve(CachedSlots.Num());
+        for (const FGameSavingSlot& Slot : CachedSlots)
+        {
+            const FGameSavingSlot* Previous = Slots.Find(Slot.SlotName);
+            if (Previous == nullptr || Previous->SlotSyncStatus != Slot.SlotSyncStatus)
+            {
+                Changed.Add(Slot);
+            }
+            Updated.Add(Slot.SlotName, Slot);
+        }
+        for (const TPair<FString, FGameSavingSlot>& Previous : Slots)
+        {
+            if (!Updated.Contains(Previous.Key))
+            {
+                FGameSavingSlot& Removed = Changed.Add_GetRef(Previous.Value);
+                Removed.SlotSyncStatus = SlotSyncStatus_E::UNKNOWN;
+            }
+        }
+
+        Slots = MoveTemp(Updated);
+        bPopulated = true;
+
+        // A Game Saving call has just refreshed the cached slots, so the background refresh can wait
+        NextRefreshAt = FPlatformTime::Seconds() + CVarGameKitGameSavingSlotIndexRefreshSeconds.GetValueOnAnyThread();
+        Delegate = SyncStatusChangeDelegate;
+    }
+
+    if (Changed.Num() > 0 && Delegate.IsBound())
+    {
+        FAwsGameKitCompletionQueue::Get().Enqueue([Delegate = MoveTemp(Delegate), Changed = MoveTemp(Changed)]
+        {
+            for (const FGameSavingSlot& Slot : Changed)
+            {
+                Delegate.ExecuteIfBound(Slot);
+            }
+        });
+    }
+}
+
+void FAwsGameKitGameSavingSlotIndex::Update(const Slot* CachedSlots, unsigned int SlotCount)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    TArray<FGameSavingSlot> Changed;
+    FSyncStatusChangeDelegate Delegate;
+    {
+        FScopeLock ScopeLock(&Mutex);
+
+        TMap<FString, FGameSavingSlot> Updated;
+        Updated.Reserve(SlotCount);
+        for (unsigned int i = 0; i < SlotCount; ++i)
+        {
+            const Slot& CachedSlot = CachedSlots[i];
+            FString SlotName = UTF8_TO_TCHAR(CachedSlot.slotName);
+
+            // Unchanged slots are moved over instead of being converted again
+            FGameSavingSlot* Previous = Slots.Find(SlotName);
+            if (Previous != nullptr
+                && Previous->SizeLocal == CachedSlot.sizeLocal
+                && Previous->SizeCloud == CachedSlot.sizeCloud
+                && Previous->LastModifiedLocal == CachedSlot.lastModifiedLocal
+                && Previous->LastModifiedCloud == CachedSlot.lastModifiedCloud
+                && Previous->LastSync == CachedSlot.lastSync
+                && Previous->SlotSyncStatus == static_cast<SlotSyncStatus_E>(CachedSlot.slotSyncStatus)
+                && FCString::Strcmp(*Previous->MetadataLocal, UTF8_TO_TCHAR(CachedSlot.metadataLocal)) == 0
+                && FCString::Strcmp(*Previous->MetadataCloud, UTF8_TO_TCHAR(CachedSlot.metadataCloud)) == 0)
+            {
+                Updated.Add(MoveTemp(SlotName), MoveTemp(*Previous));
+                continue;
+            }
+
+            const FGameSavingSlot& Converted = Updated.Add(MoveTemp(SlotName), FGameSavingSlot::From(CachedSlot));
+            if (Previous == nullptr || Previous->SlotSyncStatus != Converted.SlotSyncStatus)
+            {
+                Changed.Add(Converted);
+            }
+        }
+        for (const TPair<FString, FGameSavingSlot>& Previous : Slots)
+        {
+            if (!Updated.Contains(Previous.Key))
+            {
+                FGameSavingSlot& Removed = Changed.Add_GetRef(Previous.Value);
+                Removed.SlotSyncStatus = SlotSyncStatus_E::UNKNOWN;
+            }
+        }
+
+        Slots = MoveTemp(Updated);
+        bPopulated = true;
+
+        // A Game Saving call has just refreshed the cached slots, so the background refresh can wait
+        NextRefreshAt = FPlatformTime::Seconds() + CVarGameKitGameSavingSlotIndexRefreshSeconds.GetValueOnAnyThread();
+        Delegate = SyncStatusChangeDelegate;
+    }
+
+    if (Changed.Num() > 0 && Delegate.IsBound())
+    {
+        FAwsGameKitCompletionQueue::Get().Enqueue([Delegate = MoveTemp(Delegate), Changed = MoveTemp(Changed)]
+        {
+            for (const FGameSavingSlot& Slot : Changed)
+            {
+                Delegate.ExecuteIfBound(Slot);
+            }
+        });
+    }
+}
+
+bool FAwsGameKitGameSavingSlotIndex::IsPopulated() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return bPopulated;
+}
+
+TArray<FGameSavingSlot> FAwsGameKitGameSavingSlotIndex::GetSlots() const
+{
+    TArray<FGameSavingSlot> Result;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Slots.GenerateValueArray(Result);
+    }
+
+    Result.Sort([](const FGameSavingSlot& A, const FGameSavingSlot& B) { return A.SlotName < B.SlotName; });
+    return Result;
+}
+
+bool FAwsGameKitGameSavingSlotIndex::GetSlot(const FString& SlotName, FGameSavingSlot& OutSlot) const
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FGameSavingSlot* Slot = Slots.Find(SlotName);
+    if (Slot == nullptr)
+    {
+        return false;
+    }
+
+    OutSlot = *Slot;
+    return true;
+}
+
+void FAwsGameKitGameSavingSlotIndex::SetSyncStatusChangeDelegate(const FSyncStatusChangeDelegate& Delegate)
+{
+    FScopeLock ScopeLock(&Mutex);
+    SyncStatusChangeDelegate = Delegate;
+}
+
+void FAwsGameKitGameSavingSlotIndex::Clear()
+{
+    FScopeLock ScopeLock(&Mutex);
+    Slots.Reset();
+    bPopulated = false;
+}
+
+bool FAwsGameKitGameSavingSlotIndex::Tick(float DeltaTime)
+{
+    const float RefreshSeconds = CVarGameKitGameSavingSlotIndexRefreshSeconds.GetValueOnGameThread();
+    const double Now = FPlatformTime::Seconds();
+    {
+        FScopeLock ScopeLock(&Mutex);
+
+        // The Game Saving library must have been initialized by the game's own first GetAllSlotSyncStatuses() call
+        if (RefreshSeconds <= 0.0f || !bPopulated || bRefreshInFlight || Now < NextRefreshAt)
+        {
+            return true;
+        }
+        bRefreshInFlight = true;
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([this, RefreshSeconds]
+    {
+        const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+        InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+        auto dispatcher = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
+        {
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingSlotIndex::Tick() GetAllSlotSyncStatuses::Dispatch"));
+            if (callStatus == GameKit::GAMEKIT_SUCCESS)
+            {
+                Update(cachedSlots, slotCount);
+            }
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
+
+        const bool shouldWaitForAllPages = true;
+        const unsigned int defaultPageSize = GameKit::GameSaving::Wrapper::GetAllSlotSyncStatusesDefaultPageSize;
+        gameSavingLibrary.GameSavingWrapper->GameKitGetAllSlotSyncStatuses(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, shouldWaitForAllPages, defaultPageSize);
+
+        FScopeLock ScopeLock(&Mutex);
+        bRefreshInFlight = false;
+        NextRefreshAt = FPlatformTime::Seconds() + RefreshSeconds;
+    }, EAwsGameKitWorkLane::Background);
+
+    return true;
+}
@@ -0,0 +1,364 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "GameSaving/AwsGameKitGameSavingTransferScheduler.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitLifecycle.h"
+#include "Common/AwsGameKitNetworkPolicy.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingSchedulerEnabled(
+    TEXT("GameKit.GameSaving.Scheduler.Enabled"),
+    0,
+    TEXT("Queues SaveSlot() and LoadSlot() transfers in FAwsGameKitGameSavingTransferScheduler.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingSchedulerMaxConcurrent(
+    TEXT("GameKit.GameSaving.Scheduler.MaxConcurrent"),
+    2,
+    TEXT("Largest number of queued Game Saving transfers running at the same time.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitGameSavingSchedulerMaxBytesPerSecond(
+    TEXT("GameKit.GameSaving.Scheduler.MaxBytesPerSecond"),
+    0,
+    TEXT("Average bandwidth queued Game Saving transfers may use, in bytes per second.\n")
+    TEXT("  0: unlimited\n"),
+    ECVF_Default);
+
+FAwsGameKitGameSavingTransferScheduler& FAwsGameKitGameSavingTransferScheduler::Get()
+{
+    static FAwsGameKitGameSavingTransferScheduler Instance;
+    return Instance;
+}
+
+bool FAwsGameKitGameSavingTransferScheduler::IsEnabled()
+{
+    return CVarGameKitGameSavingSchedulerEnabled.GetValueOnAnyThread() != 0;
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitGameSavingTransferScheduler::Tick));
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    TArray<FPendingTransfer> Uploads;
+    TArray<FPendingTransfer> Dropped;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        for (FPendingTransfer& Transfer : Pending)
+        {
+            if (!Transfer.bIsSave)
+            {
+                Dropped.Add(MoveTemp(Transfer));
+                continue;
+            }
+
+            // The downloads in between are dropped, so the uploads of a slot are merged like in EnqueueSave()
+            FPendingTransfer* Earlier = Uploads.FindByPredicate([&Transfer](const FPendingTransfer& Upload) { return Upload.GetSlotName() == Transfer.GetSlotName(); });
+            if (Earlier == nullptr)
+            {
+                Uploads.Add(MoveTemp(Transfer));
+                continue;
+            }
+
+            Earlier->SaveRequest = MoveTemp(Transfer.SaveRequest);
+            Earlier->Bytes = Transfer.Bytes;
+            Earlier->SaveResultDelegates.Append(MoveTemp(Transfer.SaveResultDelegates));
+        }
+        Pending.Reset();
+        PauseCount = 0;
+        BandwidthBudget = 0.0;
+    }
+
+    if (Uploads.Num() > 0 || Dropped.Num() > 0)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitGameSavingTransferScheduler::Shutdown(): Sending %d waiting uploads and dropping %d waiting downloads"), Uploads.Num(), Dropped.Num());
+    }
+
+    // The uploads run on the work threads, each after the transfer of its slot already running, for at most GameKit.Lifecycle.ShutdownDrainBudgetMs
+    const IConsoleVariable* DrainBudgetMs = IConsoleManager::Get().FindConsoleVariable(TEXT("GameKit.Lifecycle.ShutdownDrainBudgetMs"));
+    const double Deadline = FPlatformTime::Seconds() + (DrainBudgetMs != nullptr ? FMath::Max(0, DrainBudgetMs->GetInt()) / 1000.0 : 0.0);
+    while (!FAwsGameKitLifecycle::HasShutdownDeadlinePassed() && FPlatformTime::Seconds() < Deadline)
+    {
+        TArray<FPendingTransfer> ReadyTransfers;
+        bool bIdle = false;
+        {
+            FScopeLock ScopeLock(&Mutex);
+            for (int32 Index = 0; Index < Uploads.Num(); ++Index)
+            {
+                if (!InFlightSlots.Contains(Uploads[Index].GetSlotName()))
+                {
+                    MarkInFlight(Uploads[Index]);
+                    ReadyTransfers.Add(MoveTemp(Uploads[Index]));
+                    Uploads.RemoveAt(Index--);
+                }
+            }
+            bIdle = Uploads.Num() == 0 && NumInFlight == 0;
+        }
+
+        for (FPendingTransfer& Ready : ReadyTransfers)
+        {
+            Run(MoveTemp(Ready));
+        }
+
+        if (bIdle)
+        {
+            break;
+        }
+        FPlatformProcess::Sleep(0.01f);
+    }
+
+    if (Uploads.Num() > 0)
+    {
+        // The local save files are kept, the slots are uploaded once they report SHOULD_UPLOAD_LOCAL in the next session
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitGameSavingTransferScheduler::Shutdown(): Out of time, dropping %d waiting uploads"), Uploads.Num());
+    }
+
+    Dropped.Append(MoveTemp(Uploads));
+    for (const FPendingTransfer& Transfer : Dropped)
+    {
+        const IntResult DroppedResult(GameKit::GAMEKIT_ERROR_GENERAL);
+        if (Transfer.bIsSave)
+        {
+            for (const FSaveResultDelegate& ResultDelegate : Transfer.SaveResultDelegates)
+            {
+                ResultDelegate.ExecuteIfBound(DroppedResult, FGameSavingSlotActionResults());
+            }
+        }
+        else
+        {
+            Transfer.LoadResultDelegate.ExecuteIfBound(DroppedResult, FGameSavingDataResults());
+        }
+    }
+}
+
+void FAwsGameKitGameSavingTransferScheduler::EnqueueSave(FGameSavingSaveSlotRequest&& Request, EAwsGameKitGameSavingTransferPriority Priority, const FSaveResultDelegate& ResultDelegate)
+{
+    FPendingTransfer Transfer;
+    Transfer.Priority = Priority;
+    Transfer.bIsSave = true;
+    Transfer.Bytes = Request.SaveFilePath.IsEmpty() ? Request.Data.Num() : FMath::Max<int64>(0, IFileManager::Get().FileSize(*Request.SaveFilePath));
+    Transfer.SaveRequest = MoveTemp(Request);
+    Transfer.SaveResultDelegates.Add(ResultDelegate);
+    {
+        FScopeLock ScopeLock(&Mutex);
+
+        // Only the slot's last waiting transfer can be replaced, a download queued after an upload must not return the newer save file
+        const int32 LastIndex = Pending.FindLastByPredicate([&Transfer](const FPendingTransfer& Waiting) { return Waiting.GetSlotName() == Transfer.SaveRequest.SlotName; });
+        if (LastIndex != INDEX_NONE && Pending[LastIndex].bIsSave)
+        {
+            // Superseded, only the newest save file is uploaded
+            FPendingTransfer& Waiting = Pending[LastIndex];
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingTransferScheduler: Replacing the waiting upload of slot %s"), *Transfer.SaveRequest.SlotName);
+            Waiting.SaveRequest = MoveTemp(Transfer.SaveRequest);
+            Waiting.Bytes = Transfer.Bytes;
+            Waiting.SaveResultDelegates.Add(ResultDelegate);
+            Waiting.Priority = FMath::Min(Waiting.Priority, Priority);
+            return;
+        }
+    }
+
+    Add(MoveTemp(Transfer));
+}
+
+void FAwsGameKitGameSavingTransferScheduler::EnqueueLoad(FGameSavingLoadSlotRequest&& Request, EAwsGameKitGameSavingTransferPriority Priority, const FLoadResultDelegate& ResultDelegate)
+{
+    FPendingTransfer Transfer;
+    Transfer.Priority = Priority;
+    Transfer.bIsSave = false;
+
+    FGameSavingSlot CachedSlot;
+    Transfer.Bytes = FAwsGameKitGameSavingSlotIndex::Get().GetSlot(Request.SlotName, CachedSlot) ? CachedSlot.SizeCloud : Request.Data.Num();
+    Transfer.LoadRequest = MoveTemp(Request);
+    Transfer.LoadResultDelegate = ResultDelegate;
+
+    Add(MoveTemp(Transfer));
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Pause()
+{
+    FScopeLock ScopeLock(&Mutex);
+    PauseCount++;
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Resume()
+{
+    FScopeLock ScopeLock(&Mutex);
+    PauseCount = FMath::Max(0, PauseCount - 1);
+}
+
+bool FAwsGameKitGameSavingTransferScheduler::IsPaused() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return PauseCount > 0;
+}
+
+int32 FAwsGameKitGameSavingTransferScheduler::GetNumPending() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return Pending.Num();
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Add(FPendingTransfer&& Transfer)
+{
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (TickerHandle.IsValid())
+        {
+            Pending.Add(MoveTemp(Transfer));
+            return;
+        }
+
+        // Not started or already shut down, nothing would ever start the transfer
+        MarkInFlight(Transfer);
+    }
+
+    Run(MoveTemp(Transfer));
+}
+
+void FAwsGameKitGameSavingTransferScheduler::MarkInFlight(const FPendingTransfer& Transfer)
+{
+    NumInFlight++;
+    InFlightSlots.FindOrAdd(Transfer.GetSlotName())++;
+}
+
+bool FAwsGameKitGameSavingTransferScheduler::Tick(float DeltaTime)
+{
+    const int64 MaxBytesPerSecond = CVarGameKitGameSavingSchedulerMaxBytesPerSecond.GetValueOnGameThread();
+    const int32 MaxConcurrent = FMath::Max(1, CVarGameKitGameSavingSchedulerMaxConcurrent.GetValueOnGameThread());
+
+    TArray<FPendingTransfer> ReadyTransfers;
+    {
+        FScopeLock ScopeLock(&Mutex);
+
+        // Up to one second of bandwidth can be saved up. The budget goes negative after a large transfer, which holds back the next background ones.
+        BandwidthBudget = MaxBytesPerSecond > 0 ? FMath::Min<double>(MaxBytesPerSecond, BandwidthBudget + MaxBytesPerSecond * DeltaTime) : 0.0;
+
+        while (NumInFlight < MaxConcurrent && Pending.Num() > 0)
+        {
+            const bool bBackgroundAllowed = PauseCount == 0 && (MaxBytesPerSecond <= 0 || BandwidthBudget > 0.0);
+
+            // Pending is in queue order. A transfer waits for the slot's earlier transfers, then foreground transfers go first.
+            TSet<FString> EarlierSlots;
+            int32 ForegroundIndex = INDEX_NONE;
+            int32 BackgroundIndex = INDEX_NONE;
+            for (int32 Index = 0; Index < Pending.Num() && ForegroundIndex == INDEX_NONE; ++Index)
+            {
+                const FString& SlotName = Pending[Index].GetSlotName();
+                bool bAlreadyInSet = false;
+                EarlierSlots.Add(SlotName, &bAlreadyInSet);
+                if (bAlreadyInSet || InFlightSlots.Contains(SlotName))
+                {
+                    continue;
+                }
+
+                if (Pending[Index].Priority == EAwsGameKitGameSavingTransferPriority::Foreground)
+                {
+                    ForegroundIndex = Index;
+                }
+                else if (BackgroundIndex == INDEX_NONE && !FAwsGameKitNetworkPolicy::Get().ShouldDeferTransfer(Pending[Index].Bytes))
+                {
+                    BackgroundIndex = Index;
+                }
+            }
+
+            const int32 ReadyIndex = ForegroundIndex != INDEX_NONE ? ForegroundIndex : (bBackgroundAllowed ? BackgroundIndex : INDEX_NONE);
+            if (ReadyIndex == INDEX_NONE)
+            {
+                break;
+            }
+
+            if (MaxBytesPerSecond > 0)
+            {
+                BandwidthBudget -= Pending[ReadyIndex].Bytes;
+            }
+            MarkInFlight(Pending[ReadyIndex]);
+            ReadyTransfers.Add(MoveTemp(Pending[ReadyIndex]));
+            Pending.RemoveAt(ReadyIndex);
+        }
+    }
+
+    for (FPendingTransfer& Ready : ReadyTransfers)
+    {
+        Run(MoveTemp(Ready));
+    }
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitGameSavingTransferScheduler::Run(FPendingTransfer&& Transfer)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitGameSavingTransferScheduler: Starting the %s of slot %s (%lld bytes)"),
+        Transfer.bIsSave ? TEXT("upload") : TEXT("download"), *Transfer.GetSlotName(), Transfer.Bytes);
+
+    // Foreground transfers are calls the player waits on
+    const EAwsGameKitWorkLane Lane = Transfer.Priority == EAwsGameKitGameSavingTransferPriority::Foreground ? EAwsGameKitWorkLane::Interactive : EAwsGameKitWorkLane::Background;
+    auto Work = [this, Transfer = MoveTemp(Transfer)]()
+    {
+        const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+        FGraphEventRef OrderedWorkChain;
+
+        if (Transfer.bIsSave)
+        {
+            FGameSavingSlotActionResults results;
+            const unsigned int callStatus = InternalAwsGameKitSaveSlot(gameSavingLibrary, Transfer.SaveRequest, results);
+
+            // One completion for the upload and every upload it replaced
+            const FSaveResultDelegate fanOut = FSaveResultDelegate::CreateLambda([ResultDelegates = Transfer.SaveResultDelegates](const IntResult& Result, const FGameSavingSlotActionResults& Results)
+            {
+                for (const FSaveResultDelegate& ResultDelegate : ResultDelegates)
+                {
+                    ResultDelegate.ExecuteIfBound(Result, Results);
+                }
+            });
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, fanOut, IntResult(callStatus), MoveTemp(results));
+        }
+        else
+        {
+            FGameSavingDataResults results;
+            const unsigned int callStatus = InternalAwsGameKitLoadSlot(gameSavingLibrary, Transfer.LoadRequest, results);
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, Transfer.LoadResultDelegate, IntResult(callStatus), MoveTemp(results));
+        }
+
+        FScopeLock ScopeLock(&Mutex);
+        int32* SlotInFlight = InFlightSlots.Find(Transfer.GetSlotName());
+        if (SlotInFlight != nullptr && --(*SlotInFlight) == 0)
+        {
+            InFlightSlots.Remove(Transfer.GetSlotName());
+        }
+        NumInFlight--;
+    };
+
+    InternalAwsGameKitRunLambdaOnWorkThread(MoveTemp(Work), Lane);
+}
@@ -5,8 +5,41 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Common/AwsGameKitAdaptivePageSize.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
-#include "Misc/FileHelper.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+
+// Unreal
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Templates/UniquePtr.h"
+
+// The library isn't linked when the feature is left out of the build, see bWithGameSaving in AwsGameKitCore.Build.cs
+#if !WITH_AWSGAMEKIT_GAME_SAVING
+#pragma push_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma push_macro("INVOKE_FUNC_UNTRACED")
+#pragma push_macro("LOAD_PLUGIN_FUNC")
+#undef CHECK_PLUGIN_FUNC_IS_LOADED
+#undef INVOKE_FUNC_UNTRACED
+#undef LOAD_PLUGIN_FUNC
+#define CHECK_PLUGIN_FUNC_IS_LOADED AWSGAMEKIT_CHECK_FEATURE_NOT_BUILT
+#define INVOKE_FUNC_UNTRACED AWSGAMEKIT_INVOKE_FEATURE_NOT_BUILT
+#define LOAD_PLUGIN_FUNC AWSGAMEKIT_LOAD_FEATURE_NOT_BUILT
+#endif
+
+namespace
+{
+    // Largest single IFileHandle::Read() or Write() call, so that multi-megabyte saves are moved in bounded steps
+    const int64 FILE_IO_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    // The GetAllSlotsMetadata Lambda serves 100 slots per page by default, and the pages are also cut at 1 MB
+    FAwsGameKitAdaptivePageSize GetAllSlotSyncStatusesPageSize(TEXT("GetAllSlotSyncStatuses"), 100, 1000);
+}
 
 void AwsGameKitGameSavingWrapper::importFunctions(void* loadedDllHandle)
 {
@@ -32,6 +65,7 @@ GAMEKIT_GAME_SAVING_INSTANCE_HANDLE AwsGameKitGameSavingWrapper::GameKitGameSavi
     const FileActions& fileActions)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitGameSavingInstanceCreateWithSessionManager, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
 
     return INVOKE_FUNC(GameKitGameSavingInstanceCreateWithSessionManager, sessionManager, logCb, localSlotInformationFilePaths, arraySize, fileActions);
 }
@@ -39,6 +73,7 @@ GAMEKIT_GAME_SAVING_INSTANCE_HANDLE AwsGameKitGameSavingWrapper::GameKitGameSavi
 void AwsGameKitGameSavingWrapper::GameKitGameSavingInstanceRelease(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitGameSavingInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
 
     INVOKE_FUNC(GameKitGameSavingInstanceRelease, gameSavingInstance);
 }
@@ -73,8 +108,28 @@ unsigned int AwsGameKitGameSavingWrapper::GameKitGetAllSlotSyncStatuses(
     unsigned int pageSize)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitGetAllSlotSyncStatuses, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::GameSaving, TEXT("GameKitGetAllSlotSyncStatuses"));
 
-    return INVOKE_FUNC(GameKitGetAllSlotSyncStatuses, gameSavingInstance, receiver, resultCb, waitForAllPages, pageSize);
+    if (!FAwsGameKitAdaptivePageSize::IsEnabled())
+    {
+        return INVOKE_FUNC(GameKitGetAllSlotSyncStatuses, gameSavingInstance, receiver, resultCb, waitForAllPages, pageSize);
+    }
+
+    // The library only returns the slots once every page is listed, so the pages are timed together
+    const unsigned int adaptivePageSize = GetAllSlotSyncStatusesPageSize.GetPageSize(pageSize);
+    const double startTime = FPlatformTime::Seconds();
+    auto callTimer = [&](const Slot* cachedSlots, unsigned int slotCount, bool complete, unsigned int callStatus)
+    {
+        if (waitForAllPages && complete && callStatus == GameKit::GAMEKIT_SUCCESS)
+        {
+            GetAllSlotSyncStatusesPageSize.RecordCall(adaptivePageSize, slotCount, 0, FPlatformTime::Seconds() - startTime);
+        }
+        resultCb(receiver, cachedSlots, slotCount, complete, callStatus);
+    };
+    typedef LambdaDispatcher<decltype(callTimer), void, const Slot*, unsigned int, bool, unsigned int> CallTimer;
+
+    return INVOKE_FUNC(GameKitGetAllSlotSyncStatuses, gameSavingInstance, &callTimer, CallTimer::Dispatch, waitForAllPages, adaptivePageSize);
 }
 
 unsigned int AwsGameKitGameSavingWrapper::GameKitGetSlotSyncStatus(
@@ -84,6 +139,8 @@ unsigned int AwsGameKitGameSavingWrapper::GameKitGetSlotSyncStatus(
     const char* slotName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitGetSlotSyncStatus, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::GameSaving, TEXT("GameKitGetSlotSyncStatus"));
 
     return INVOKE_FUNC(GameKitGetSlotSyncStatus, gameSavingInstance, receiver, resultCb, slotName);
 }
@@ -95,6 +152,8 @@ unsigned int AwsGameKitGameSavingWrapper::GameKitDeleteSlot(
     const char* slotName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitDeleteSlot, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::GameSaving, TEXT("GameKitDeleteSlot"));
 
     return INVOKE_FUNC(GameKitDeleteSlot, gameSavingInstance, receiver, resultCb, slotName);
 }
@@ -106,6 +165,8 @@ unsigned int AwsGameKitGameSavingWrapper::GameKitSaveSlot(
     GameSavingModel& model)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitSaveSlot, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::GameSaving, TEXT("GameKitSaveSlot"));
 
     return INVOKE_FUNC(GameKitSaveSlot, gameSavingInstance, receiver, resultCb, model);
 }
@@ -117,6 +178,8 @@ unsigned int AwsGameKitGameSavingWrapper::GameKitLoadSlot(
     GameSavingModel& model)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(GameSaving, GameKitLoadSlot, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::GameSaving, TEXT("GameKitLoadSlot"));
 
     return INVOKE_FUNC(GameKitLoadSlot, gameSavingInstance, receiver, resultCb, model);
 }
@@ -134,7 +197,7 @@ DefaultFileActions::DefaultFileActions()
     fileSizeDispatchReceiver = nullptr;
 }
 
-bool DefaultFileActions::writeDesktopFile(const FString& filePath, const TArray<uint8>& data)
+bool DefaultFileActions::writeDesktopFile(const FString& filePath, const uint8* data, int64 size)
 {
     if (filePath.IsEmpty())
     {
@@ -142,7 +205,18 @@ bool DefaultFileActions::writeDesktopFile(const FString& filePath, const TArray<
         return false;
     }
 
-    if (!FFileHelper::SaveArrayToFile(data, *filePath))
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+    platformFile.CreateDirectoryTree(*FPaths::GetPath(filePath));
+
+    TUniquePtr<IFileHandle> fileHandle(platformFile.OpenWrite(*filePath));
+    bool written = fileHandle.IsValid();
+    for (int64 offset = 0; written && offset < size; offset += FILE_IO_CHUNK_SIZE)
+    {
+        written = fileHandle->Write(data + offset, FMath::Min(FILE_IO_CHUNK_SIZE, size - offset));
+    }
+    written = written && fileHandle->Flush();
+
+    if (!written)
     {
         FString errorMessage = "ERROR: Unable to load data to file: " + filePath;
         UE_LOG(LogAwsGameKit, Error, TEXT("DesktopWriteFile(): %s"), *errorMessage);
@@ -151,7 +225,7 @@ bool DefaultFileActions::writeDesktopFile(const FString& filePath, const TArray<
     return true;
 }
 
-bool DefaultFileActions::readDesktopFile(const FString& filePath, TArray<uint8>& data)
+bool DefaultFileActions::readDesktopFile(const FString& filePath, uint8* data, int64 size)
 {
     if (filePath.IsEmpty())
     {
@@ -159,12 +233,29 @@ bool DefaultFileActions::readDesktopFile(const FString& filePath, TArray<uint8>&
         return false;
     }
 
-    if (!FFileHelper::LoadFileToArray(data, *filePath))
+    TUniquePtr<IFileHandle> fileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*filePath));
+    if (!fileHandle.IsValid())
     {
         UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: Unable to read file: %s"), *filePath);
         return false;
     }
 
+    const int64 fileSize = fileHandle->Size();
+    if (fileSize > size)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: File %s is %lld bytes, larger than the %lld bytes buffer."), *filePath, fileSize, size);
+        return false;
+    }
+
+    for (int64 offset = 0; offset < fileSize; offset += FILE_IO_CHUNK_SIZE)
+    {
+        if (!fileHandle->Read(data + offset, FMath::Min(FILE_IO_CHUNK_SIZE, fileSize - offset)))
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("DesktopReadFile() ERROR: Unable to read file: %s"), *filePath);
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -180,26 +271,25 @@ int64 DefaultFileActions::getDesktopFileSize(const FString& filePath)
 bool DefaultFileActions::writeFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, const uint8_t* data, const unsigned int size)
 {
     FString filePathFString(UTF8_TO_TCHAR(filePath));
-    return writeDesktopFile(filePathFString, TArray<uint8>(data, size));
+    InternalAwsGameKitForgetPrefetchedSaveInfo(filePathFString);
+    return writeDesktopFile(filePathFString, data, size);
 }
 
 bool DefaultFileActions::readFileCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath, uint8_t* data, unsigned int size)
 {
-    TArray<uint8> buffer;
     FString filePathFString(UTF8_TO_TCHAR(filePath));
-    bool result = readDesktopFile(filePathFString, buffer);
-    if (!result || size < (unsigned int)buffer.Num())
-    {
-        return false;
-    }
-
-    memcpy(data, buffer.GetData(), buffer.Num());
-
-    return true;
+    return InternalAwsGameKitReadPrefetchedSaveInfo(filePathFString, data, size) || readDesktopFile(filePathFString, data, size);
 }
 
 unsigned int DefaultFileActions::getFileSizeCallback(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* filePath)
 {
     FString filePathFString(UTF8_TO_TCHAR(filePath));
-    return getDesktopFileSize(filePathFString);
+    const int64 prefetchedSize = InternalAwsGameKitGetPrefetchedSaveInfoSize(filePathFString);
+    return prefetchedSize >= 0 ? prefetchedSize : getDesktopFileSize(filePathFString);
 }
+
+#if !WITH_AWSGAMEKIT_GAME_SAVING
+#pragma pop_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma pop_macro("INVOKE_FUNC_UNTRACED")
+#pragma pop_macro("LOAD_PLUGIN_FUNC")
+#endif
@@ -4,10 +4,22 @@
 #include "Identity/AwsGameKitIdentity.h"
 
 // GameKit
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
+#include "GameSaving/AwsGameKitGameSavingLoginPrefetcher.h"
+#include "Identity/AwsGameKitIdentityFederatedPoller.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+#include "SessionManager/AwsGameKitSessionBootstrap.h"
+#include "SessionManager/AwsGameKitSessionCache.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
 
 // Unreal
 #include "Async/Async.h"
@@ -15,16 +27,16 @@
 
 IdentityLibrary AwsGameKitIdentity::GetIdentityLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitIdentity::GetIdentityLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetIdentityLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 }
 
 void AwsGameKitIdentity::Register(const FUserRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "Register");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
 
@@ -40,14 +52,16 @@ void AwsGameKitIdentity::Register(const FUserRegistrationRequest& Request, FAwsG
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityRegister(identityLibrary.IdentityInstanceHandle, wrapperArgs));
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::ConfirmRegistration(const FConfirmRegistrationRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "ConfirmRegistration");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
@@ -59,14 +73,16 @@ void AwsGameKitIdentity::ConfirmRegistration(const FConfirmRegistrationRequest&
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityConfirmRegistration(identityLibrary.IdentityInstanceHandle, wrapperArgs));
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::ResendConfirmationCode(const FResendConfirmationCodeRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "ResendConfirmationCode");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
@@ -77,14 +93,16 @@ void AwsGameKitIdentity::ResendConfirmationCode(const FResendConfirmationCodeReq
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityResendConfirmationCode(identityLibrary.IdentityInstanceHandle, wrapperArgs));
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::ForgotPassword(const FForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "ForgotPassword");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
@@ -95,14 +113,16 @@ void AwsGameKitIdentity::ForgotPassword(const FForgotPasswordRequest& Request, F
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::ConfirmForgotPassword(const FConfirmForgotPasswordRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "ConfirmForgotPassword");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
@@ -115,14 +135,16 @@ void AwsGameKitIdentity::ConfirmForgotPassword(const FConfirmForgotPasswordReque
 
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityConfirmForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::GetFederatedLoginUrl(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FLoginUrlResponse&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetFederatedLoginUrl");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         TMap<FString, FString> loginUrlInfo;
@@ -140,28 +162,37 @@ void AwsGameKitIdentity::GetFederatedLoginUrl(const FederatedIdentityProvider_E&
 
         const FString requestId = loginUrlInfo.FindRef(AwsGameKitIdentityWrapper::KEY_FEDERATED_LOGIN_URL_REQUEST_ID);
         const FString loginUrl = loginUrlInfo.FindRef(AwsGameKitIdentityWrapper::KEY_FEDERATED_LOGIN_URL);
-        const FLoginUrlResponse loginUrlResponse = FLoginUrlResponse{ *requestId, *loginUrl };
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, loginUrlResponse);
-    });
+        FLoginUrlResponse loginUrlResponse = FLoginUrlResponse{ *requestId, *loginUrl };
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(loginUrlResponse));
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::PollAndRetrieveFederatedTokens(const FPollAndRetrieveFederatedTokensRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FederatedIdentityProvider_E&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "PollAndRetrieveFederatedTokens");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
-
         FGraphEventRef OrderedWorkChain;
-        IntResult result(identityLibrary.IdentityWrapper->GameKitPollAndRetrieveFederatedTokens(identityLibrary.IdentityInstanceHandle, AwsGameKitIdentityTypeConverter::ConvertProviderEnum(Request.IdentityProvider), TCHAR_TO_UTF8(*Request.RequestId), Request.Timeout));
+        IntResult result = FAwsGameKitIdentityFederatedPoller::Get().Poll(Request);
+        if (result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            FAwsGameKitIdentityUserCache::Get().Invalidate();
+            FAwsGameKitGameSavingLoginPrefetcher::Get().OnLogin();
+            FAwsGameKitSessionBootstrap::Get().OnLogin();
+            FAwsGameKitRegionSelector::Get().OnLogin();
+        }
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, Request.IdentityProvider);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::GetFederatedIdToken(const FederatedIdentityProvider_E& IdentityProvider, TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetFederatedIdToken");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FString accessToken;
@@ -171,15 +202,17 @@ void AwsGameKitIdentity::GetFederatedIdToken(const FederatedIdentityProvider_E&
         };
         typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const char*> GetUserInfoDispatcher;
         IntResult result(identityLibrary.IdentityWrapper->GameKitGetFederatedIdToken(identityLibrary.IdentityInstanceHandle, AwsGameKitIdentityTypeConverter::ConvertProviderEnum(IdentityProvider), &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, accessToken);
-    });
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(accessToken));
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::Login(const FUserLoginRequest& Request, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "Login");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
         FAwsGameKitInternalTempStrings ConvertString;
@@ -189,48 +222,59 @@ void AwsGameKitIdentity::Login(const FUserLoginRequest& Request, FAwsGameKitStat
             ConvertString(Request.Password),
         };
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityLogin(identityLibrary.IdentityInstanceHandle, wrapperArgs));
+        if (result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            FAwsGameKitIdentityUserCache::Get().Invalidate();
+            FAwsGameKitGameSavingLoginPrefetcher::Get().OnLogin();
+            FAwsGameKitSessionBootstrap::Get().OnLogin();
+            FAwsGameKitRegionSelector::Get().OnLogin();
+        }
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::Logout(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "Logout");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
+        const IdentityLibrary& identityLibrary = GetIdentityLibraryFromModule();
 
         FGraphEventRef OrderedWorkChain;
+        // Send the merged achievement increments and buffered bundle items while the player is still logged in
+        FAwsGameKitAchievementsUpdateCoalescer::Get().FlushAll(true);
+        FAwsGameKitUserGameplayDataWriteBehind::Get().FlushAll(true);
+        FAwsGameKitOfflineWriteQueue::Get().FlushAll();
+        // What is still journaled or queued was enqueued for this player, don't replay it for the next one
+        FAwsGameKitUserGameplayDataWriteBehind::Get().DiscardAll();
+        FAwsGameKitOfflineWriteQueue::Get().DiscardAll();
         IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityLogout(identityLibrary.IdentityInstanceHandle));
+        FAwsGameKitAchievementsCache::Get().ClearProgress();
+        FAwsGameKitAchievementsUpdateCoalescer::Get().ClearProgress();
+        FAwsGameKitUserGameplayDataCache::Get().InvalidateAll();
+        FAwsGameKitGameSavingLoginPrefetcher::Get().Clear();
+        FAwsGameKitSessionBootstrap::Get().Clear();
+        FAwsGameKitSessionTokenRefresher::Get().Clear();
+        FAwsGameKitSessionCache::Get().Clear();
+        FAwsGameKitIdentityUserCache::Get().Invalidate();
+        FAwsGameKitRegionSelector::Get().OnLogout();
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    }, EAwsGameKitWorkLane::Interactive);
 }
 
 void AwsGameKitIdentity::GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetUser");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
         FGraphEventRef OrderedWorkChain;
-        IdentityLibrary identityLibrary = GetIdentityLibraryFromModule();
-
-        FString userInfo;
         FGetUserResponse response;
+        IntResult result = FAwsGameKitIdentityUserCache::Get().GetUser(response);
 
-        auto getUserInfoDispatcher = [&](const GetUserResponse* getUserResponse)
-        {
-            response.UserId = UTF8_TO_TCHAR(getUserResponse->userId);
-            response.CreatedAt = UTF8_TO_TCHAR(getUserResponse->createdAt);
-            response.UpdatedAt = UTF8_TO_TCHAR(getUserResponse->updatedAt);
-            response.FacebookExternalId = UTF8_TO_TCHAR(getUserResponse->facebookExternalId);
-            response.FacebookRefId = UTF8_TO_TCHAR(getUserResponse->facebookRefId);
-            response.UserName = UTF8_TO_TCHAR(getUserResponse->userName);
-            response.Email = UTF8_TO_TCHAR(getUserResponse->email);
-        };
-        typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const GetUserResponse*> GetUserInfoDispatcher;
-
-        IntResult result(identityLibrary.IdentityWrapper->GameKitIdentityGetUser(identityLibrary.IdentityInstanceHandle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
-
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, response);
-    });
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(response));
+    }, EAwsGameKitWorkLane::Interactive);
 }
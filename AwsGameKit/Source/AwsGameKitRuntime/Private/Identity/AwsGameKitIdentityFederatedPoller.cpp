@@ -0,0 +1,161 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Identity/AwsGameKitIdentityFederatedPoller.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Identity/AwsGameKitIdentityWrapper.h"
+
+// Unreal
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<bool> CVarGameKitIdentityFederatedPollAdaptive(
+    TEXT("GameKit.Identity.FederatedPoll.Adaptive"),
+    false,
+    TEXT("If true, PollAndRetrieveFederatedTokens polls with a growing interval which restarts when the game regains focus, see FAwsGameKitIdentityFederatedPoller.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitIdentityFederatedPollInitialIntervalSeconds(
+    TEXT("GameKit.Identity.FederatedPoll.InitialIntervalSeconds"),
+    0.5f,
+    TEXT("Delay in seconds before the first retry of an adaptive federated login poll.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitIdentityFederatedPollBackoffFactor(
+    TEXT("GameKit.Identity.FederatedPoll.BackoffFactor"),
+    2.0f,
+    TEXT("Factor the interval between adaptive federated login polls grows by after every retry.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitIdentityFederatedPollMaxIntervalSeconds(
+    TEXT("GameKit.Identity.FederatedPoll.MaxIntervalSeconds"),
+    8.0f,
+    TEXT("Longest interval in seconds between adaptive federated login polls.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Granularity of the wait between attempts, so that focus changes are noticed quickly
+    const float WAIT_SLICE_SECONDS = 0.1f;
+
+    // Shortest FPollAndRetrieveFederatedTokensRequest::Timeout the native library accepts
+    const int ATTEMPT_TIMEOUT_SECONDS = 1;
+}
+
+FAwsGameKitIdentityFederatedPoller& FAwsGameKitIdentityFederatedPoller::Get()
+{
+    static FAwsGameKitIdentityFederatedPoller Instance;
+    return Instance;
+}
+
+void FAwsGameKitIdentityFederatedPoller::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    bIsShuttingDown = false;
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitIdentityFederatedPoller::Tick), 0.25f);
+
+    // Mobile platforms report focus changes through these instead of the Slate application
+    ReactivatedHandle = FCoreDelegates::ApplicationHasReactivatedDelegate.AddRaw(this, &FAwsGameKitIdentityFederatedPoller::OnFocusRegained);
+    EnteredForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddRaw(this, &FAwsGameKitIdentityFederatedPoller::OnFocusRegained);
+}
+
+void FAwsGameKitIdentityFederatedPoller::Shutdown()
+{
+    check(IsInGameThread());
+    bIsShuttingDown = true;
+    if (!TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+    FCoreDelegates::ApplicationHasReactivatedDelegate.Remove(ReactivatedHandle);
+    FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(EnteredForegroundHandle);
+}
+
+IntResult FAwsGameKitIdentityFederatedPoller::Poll(const FPollAndRetrieveFederatedTokensRequest& Request)
+{
+    if (!CVarGameKitIdentityFederatedPollAdaptive.GetValueOnAnyThread())
+    {
+        return PollOnce(Request, Request.Timeout);
+    }
+
+    ++PollsInProgress;
+    const double deadline = FPlatformTime::Seconds() + Request.Timeout;
+    const float initialInterval = FMath::Max(WAIT_SLICE_SECONDS, CVarGameKitIdentityFederatedPollInitialIntervalSeconds.GetValueOnAnyThread());
+    const float maxInterval = FMath::Max(initialInterval, CVarGameKitIdentityFederatedPollMaxIntervalSeconds.GetValueOnAnyThread());
+    const float backoffFactor = FMath::Max(1.0f, CVarGameKitIdentityFederatedPollBackoffFactor.GetValueOnAnyThread());
+    float interval = initialInterval;
+    int32 attempts = 0;
+
+    IntResult result;
+    while (true)
+    {
+        result = PollOnce(Request, ATTEMPT_TIMEOUT_SECONDS);
+        attempts++;
+
+        // Only an incomplete login is worth waiting for
+        const double now = FPlatformTime::Seconds();
+        if (result.Result == GameKit::GAMEKIT_SUCCESS || result.Result == GameKit::GAMEKIT_ERROR_INVALID_FEDERATED_IDENTITY_PROVIDER || now >= deadline || bIsShuttingDown)
+        {
+            break;
+        }
+
+        const uint32 focusGeneration = FocusGeneration;
+        const double retryAt = FMath::Min(now + interval, deadline);
+        while (FPlatformTime::Seconds() < retryAt && FocusGeneration == focusGeneration && !bIsShuttingDown)
+        {
+            FPlatformProcess::Sleep(WAIT_SLICE_SECONDS);
+        }
+
+        interval = FocusGeneration == focusGeneration ? FMath::Min(interval * backoffFactor, maxInterval) : initialInterval;
+    }
+    --PollsInProgress;
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitIdentityFederatedPoller::Poll(): Finished with %s after %d attempts"), *GameKit::StatusCodeToHexFStr(result.Result), attempts);
+    return result;
+}
+
+void FAwsGameKitIdentityFederatedPoller::OnFocusRegained()
+{
+    if (PollsInProgress > 0)
+    {
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitIdentityFederatedPoller::OnFocusRegained(): Polling for the federated login now"));
+        ++FocusGeneration;
+    }
+}
+
+IntResult FAwsGameKitIdentityFederatedPoller::PollOnce(const FPollAndRetrieveFederatedTokensRequest& Request, int Timeout)
+{
+    const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
+    return IntResult(identityLibrary.IdentityWrapper->GameKitPollAndRetrieveFederatedTokens(
+        identityLibrary.IdentityInstanceHandle,
+        AwsGameKitIdentityTypeConverter::ConvertProviderEnum(Request.IdentityProvider),
+        TCHAR_TO_UTF8(*Request.RequestId),
+        Timeout));
+}
+
+bool FAwsGameKitIdentityFederatedPoller::Tick(float DeltaTime)
+{
+    // The player signs in to the identity provider in a browser, coming back to the game usually means they're done
+    const bool isActive = !FSlateApplication::IsInitialized() || FSlateApplication::Get().IsActive();
+    if (isActive && !bWasActive)
+    {
+        OnFocusRegained();
+    }
+    bWasActive = isActive;
+
+    // Keep ticking
+    return true;
+}
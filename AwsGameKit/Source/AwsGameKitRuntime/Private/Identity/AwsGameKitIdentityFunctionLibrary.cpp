@@ -4,11 +4,20 @@
 #include "Identity/AwsGameKitIdentityFunctionLibrary.h"
 
 // GameKit
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "Achievements/AwsGameKitAchievementsUpdateCoalescer.h"
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitOfflineWriteQueue.h"
 #include "Core/AwsGameKitDispatcher.h"
 #include "Core/AwsGameKitErrors.h"
+#include "Identity/AwsGameKitIdentityFederatedPoller.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+#include "SessionManager/AwsGameKitSessionCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
 
 // Unreal
 #include "LatentActions.h"
@@ -24,15 +33,15 @@ void UAwsGameKitIdentityFunctionLibrary::Register(
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Register()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Register()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "Register");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.Register"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             UserRegistration wrapperArgs
             {
@@ -45,7 +54,7 @@ void UAwsGameKitIdentityFunctionLibrary::Register(
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityRegister(identityLibrary.IdentityInstanceHandle, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -55,15 +64,15 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmRegistration(UObject* WorldConte
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ConfirmRegistration()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ConfirmRegistration()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "ConfirmRegistration");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.ConfirmRegistration"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ConfirmRegistrationRequest wrapperArgs
             {
@@ -73,7 +82,7 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmRegistration(UObject* WorldConte
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityConfirmRegistration(identityLibrary.IdentityInstanceHandle, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -83,15 +92,15 @@ void UAwsGameKitIdentityFunctionLibrary::ResendConfirmationCode(UObject* WorldCo
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ResendConfirmationCode()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ResendConfirmationCode()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "ResendConfirmationCode");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.ResendConfirmationCode"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ResendConfirmationCodeRequest wrapperArgs
             {
@@ -100,7 +109,7 @@ void UAwsGameKitIdentityFunctionLibrary::ResendConfirmationCode(UObject* WorldCo
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityResendConfirmationCode(identityLibrary.IdentityInstanceHandle, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -110,15 +119,15 @@ void UAwsGameKitIdentityFunctionLibrary::ForgotPassword(UObject* WorldContextObj
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ForgotPassword()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ForgotPassword()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "ForgotPassword");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.ForgotPassword"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ForgotPasswordRequest wrapperArgs
             {
@@ -127,7 +136,7 @@ void UAwsGameKitIdentityFunctionLibrary::ForgotPassword(UObject* WorldContextObj
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -137,15 +146,15 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmForgotPassword(UObject* WorldCon
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ConfirmForgotPassword()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::ConfirmForgotPassword()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "ConfirmForgotPassword");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.ConfirmForgotPassword"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             ConfirmForgotPasswordRequest wrapperArgs
             {
@@ -156,7 +165,7 @@ void UAwsGameKitIdentityFunctionLibrary::ConfirmForgotPassword(UObject* WorldCon
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityConfirmForgotPassword(identityLibrary.IdentityInstanceHandle, wrapperArgs));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -167,15 +176,15 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedLoginUrl(UObject* WorldCont
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetFederatedLoginUrl()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetFederatedLoginUrl()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetFederatedLoginUrl");
 
     TAwsGameKitInternalActionStatePtr<FLoginUrlResponse> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, IdentityProvider, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([IdentityProvider, State]
+        Action->LaunchThreadedWork(TEXT("Identity.GetFederatedLoginUrl"), [IdentityProvider, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             TMap<FString, FString> loginUrlInfo;
             auto loginUrlInfoSetter = [&loginUrlInfo](const char* key, const char* value)
@@ -196,7 +205,7 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedLoginUrl(UObject* WorldCont
 
             State->Results = FLoginUrlResponse{ *requestId, *loginUrl };
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -207,24 +216,23 @@ void UAwsGameKitIdentityFunctionLibrary::PollAndRetrieveFederatedTokens(UObject*
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::PollAndRetrieveFederatedTokens()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::PollAndRetrieveFederatedTokens()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "PollAndRetrieveFederatedTokens");
 
     TAwsGameKitInternalActionStatePtr<FederatedIdentityProvider_E> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.PollAndRetrieveFederatedTokens"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
-
-            IntResult result(identityLibrary.IdentityWrapper->GameKitPollAndRetrieveFederatedTokens(
-                identityLibrary.IdentityInstanceHandle,
-                AwsGameKitIdentityTypeConverter::ConvertProviderEnum(Request.IdentityProvider),
-                TCHAR_TO_UTF8(*Request.RequestId),
-                Request.Timeout));
+            IntResult result = FAwsGameKitIdentityFederatedPoller::Get().Poll(Request);
+            if (result.Result == GameKit::GAMEKIT_SUCCESS)
+            {
+                FAwsGameKitIdentityUserCache::Get().Invalidate();
+                FAwsGameKitRegionSelector::Get().OnLogin();
+            }
             State->Results = Request.IdentityProvider;
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -235,15 +243,15 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedIdToken(UObject* WorldConte
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetFederatedIdToken()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetFederatedIdToken()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetFederatedIdToken");
 
     TAwsGameKitInternalActionStatePtr<FString> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, IdentityProvider, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([IdentityProvider, State]
+        Action->LaunchThreadedWork(TEXT("Identity.GetFederatedIdToken"), [IdentityProvider, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
 
             FString accessToken;
             auto getUserInfoDispatcher = [&](const char* response)
@@ -259,7 +267,7 @@ void UAwsGameKitIdentityFunctionLibrary::GetFederatedIdToken(UObject* WorldConte
 
             State->Results = accessToken;
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -269,15 +277,15 @@ void UAwsGameKitIdentityFunctionLibrary::Login(UObject* WorldContextObject,
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Login()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Login()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "Login");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("Identity.Login"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
             FAwsGameKitInternalTempStrings ConvertString;
             UserLogin wrapperArgs
             {
@@ -286,8 +294,13 @@ void UAwsGameKitIdentityFunctionLibrary::Login(UObject* WorldContextObject,
             };
 
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityLogin(identityLibrary.IdentityInstanceHandle, wrapperArgs));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS)
+            {
+                FAwsGameKitIdentityUserCache::Get().Invalidate();
+                FAwsGameKitRegionSelector::Get().OnLogin();
+            }
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -296,19 +309,32 @@ void UAwsGameKitIdentityFunctionLibrary::Logout(UObject* WorldContextObject,
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Logout()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::Logout()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "Logout");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("Identity.Logout"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
-
+            const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
+
+            // Send the merged achievement increments and buffered bundle items while the player is still logged in
+            FAwsGameKitAchievementsUpdateCoalescer::Get().FlushAll(true);
+            FAwsGameKitUserGameplayDataWriteBehind::Get().FlushAll(true);
+            FAwsGameKitOfflineWriteQueue::Get().FlushAll();
+            // What is still journaled or queued was enqueued for this player, don't replay it for the next one
+            FAwsGameKitUserGameplayDataWriteBehind::Get().DiscardAll();
+            FAwsGameKitOfflineWriteQueue::Get().DiscardAll();
             IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityLogout(identityLibrary.IdentityInstanceHandle));
+            FAwsGameKitAchievementsCache::Get().ClearProgress();
+            FAwsGameKitAchievementsUpdateCoalescer::Get().ClearProgress();
+            FAwsGameKitUserGameplayDataCache::Get().InvalidateAll();
+            FAwsGameKitSessionCache::Get().Clear();
+            FAwsGameKitIdentityUserCache::Get().Invalidate();
+            FAwsGameKitRegionSelector::Get().OnLogout();
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
 
@@ -318,33 +344,16 @@ void UAwsGameKitIdentityFunctionLibrary::GetUser(UObject* WorldContextObject,
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetUser()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitIdentityBlueprintFunctionLibrary::GetUser()"));
+    AWSGAMEKIT_TRACE_CALL("Identity", "GetUser");
 
     TAwsGameKitInternalActionStatePtr<FGetUserResponse> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("Identity.GetUser"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            IdentityLibrary identityLibrary = runtimeModule->GetIdentityLibrary();
-
-            auto getUserInfoDispatcher = [&](const GetUserResponse* getUserResponse)
-            {
-                FGetUserResponse response;
-                response.UserId = UTF8_TO_TCHAR(getUserResponse->userId);
-                response.CreatedAt = UTF8_TO_TCHAR(getUserResponse->createdAt);
-                response.UpdatedAt = UTF8_TO_TCHAR(getUserResponse->updatedAt);
-                response.FacebookExternalId = UTF8_TO_TCHAR(getUserResponse->facebookExternalId);
-                response.FacebookRefId = UTF8_TO_TCHAR(getUserResponse->facebookRefId);
-                response.UserName = UTF8_TO_TCHAR(getUserResponse->userName);
-                response.Email = UTF8_TO_TCHAR(getUserResponse->email);
-
-                State->Results = response;
-            };
-            typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const GetUserResponse*> GetUserInfoDispatcher;
-
-            IntResult result = IntResult(identityLibrary.IdentityWrapper->GameKitIdentityGetUser(identityLibrary.IdentityInstanceHandle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
+            IntResult result = FAwsGameKitIdentityUserCache::Get().GetUser(State->Results);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
-        });
+        }, EAwsGameKitWorkLane::Interactive);
     }
 }
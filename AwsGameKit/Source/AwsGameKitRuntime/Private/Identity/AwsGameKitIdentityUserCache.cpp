@@ -0,0 +1,133 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Identity/AwsGameKitIdentityUserCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitDispatcher.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Identity/AwsGameKitIdentityWrapper.h"
+
+// Unreal
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<bool> CVarGameKitIdentityCacheUser(
+    TEXT("GameKit.Identity.CacheUser"),
+    true,
+    TEXT("If true, GetUser only calls the backend once per session, see FAwsGameKitIdentityUserCache.\n"),
+    ECVF_Default);
+
+FAwsGameKitIdentityUserCache::FFetch::FFetch()
+    : Done(FPlatformProcess::GetSynchEventFromPool(true))
+{}
+
+FAwsGameKitIdentityUserCache::FFetch::~FFetch()
+{
+    FPlatformProcess::ReturnSynchEventToPool(Done);
+}
+
+FAwsGameKitIdentityUserCache& FAwsGameKitIdentityUserCache::Get()
+{
+    static FAwsGameKitIdentityUserCache Instance;
+    return Instance;
+}
+
+IntResult FAwsGameKitIdentityUserCache::GetUser(FGetUserResponse& OutResponse)
+{
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    if (!CVarGameKitIdentityCacheUser.GetValueOnAnyThread())
+    {
+        return Fetch(OutResponse);
+    }
+
+    TSharedPtr<FFetch, ESPMode::ThreadSafe> fetch;
+    bool isFetching = false;
+    uint32 generation = 0;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (bIsCached)
+        {
+            FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::IdentityUser, true);
+            OutResponse = Cached;
+            return IntResult(GameKit::GAMEKIT_SUCCESS);
+        }
+
+        if (!InFlight.IsValid())
+        {
+            InFlight = MakeShared<FFetch, ESPMode::ThreadSafe>();
+            isFetching = true;
+        }
+        fetch = InFlight;
+        generation = CurrentGeneration;
+    }
+
+    // Waiting for another caller's fetch counts as a hit, only the fetching caller calls the backend
+    FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::IdentityUser, !isFetching);
+
+    if (!isFetching)
+    {
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitIdentityUserCache::GetUser(): Waiting for the GetUser call in progress"));
+        fetch->Done->Wait();
+        OutResponse = fetch->Response;
+        return fetch->Result;
+    }
+
+    fetch->Result = Fetch(fetch->Response);
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (generation == CurrentGeneration && fetch->Result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            Cached = fetch->Response;
+            bIsCached = true;
+        }
+        if (InFlight == fetch)
+        {
+            InFlight.Reset();
+        }
+    }
+    fetch->Done->Trigger();
+
+    OutResponse = fetch->Response;
+    return fetch->Result;
+}
+
+void FAwsGameKitIdentityUserCache::Invalidate()
+{
+    FScopeLock ScopeLock(&Mutex);
+    bIsCached = false;
+    Cached = FGetUserResponse();
+    // Callers already waiting still get the result of the fetch in progress, later ones start a new fetch
+    InFlight.Reset();
+    ++CurrentGeneration;
+}
+
+uint32 FAwsGameKitIdentityUserCache::GetGeneration()
+{
+    FScopeLock ScopeLock(&Mutex);
+    return CurrentGeneration;
+}
+
+IntResult FAwsGameKitIdentityUserCache::Fetch(FGetUserResponse& OutResponse)
+{
+    const IdentityLibrary& identityLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
+
+    auto getUserInfoDispatcher = [&](const GetUserResponse* getUserResponse)
+    {
+        OutResponse.UserId = UTF8_TO_TCHAR(getUserResponse->userId);
+        OutResponse.CreatedAt = UTF8_TO_TCHAR(getUserResponse->createdAt);
+        OutResponse.UpdatedAt = UTF8_TO_TCHAR(getUserResponse->updatedAt);
+        OutResponse.FacebookExternalId = UTF8_TO_TCHAR(getUserResponse->facebookExternalId);
+        OutResponse.FacebookRefId = UTF8_TO_TCHAR(getUserResponse->facebookRefId);
+        OutResponse.UserName = UTF8_TO_TCHAR(getUserResponse->userName);
+        OutResponse.Email = UTF8_TO_TCHAR(getUserResponse->email);
+    };
+    typedef LambdaDispatcher<decltype(getUserInfoDispatcher), void, const GetUserResponse*> GetUserInfoDispatcher;
+
+    return IntResult(identityLibrary.IdentityWrapper->GameKitIdentityGetUser(identityLibrary.IdentityInstanceHandle, &getUserInfoDispatcher, GetUserInfoDispatcher::Dispatch));
+}
@@ -5,6 +5,7 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "Common/AwsGameKitStats.h"
 #include "Core/AwsGameKitErrors.h"
 
 
@@ -38,6 +39,7 @@ void AwsGameKitIdentityWrapper::importFunctions(void* loadedDllHandle)
 GAMEKIT_IDENTITY_INSTANCE_HANDLE AwsGameKitIdentityWrapper::GameKitIdentityInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityInstanceCreateWithSessionManager, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
     return INVOKE_FUNC(GameKitIdentityInstanceCreateWithSessionManager, sessionManager, logCb);
 }
@@ -45,6 +47,7 @@ GAMEKIT_IDENTITY_INSTANCE_HANDLE AwsGameKitIdentityWrapper::GameKitIdentityInsta
 void AwsGameKitIdentityWrapper::GameKitIdentityInstanceRelease(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
     INVOKE_FUNC(GameKitIdentityInstanceRelease, identityInstance);
 }
@@ -52,6 +55,8 @@ void AwsGameKitIdentityWrapper::GameKitIdentityInstanceRelease(GAMEKIT_IDENTITY_
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityRegister(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserRegistration userRegistration)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityRegister, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityRegister"));
 
     return INVOKE_FUNC(GameKitIdentityRegister, identityInstance, userRegistration);
 }
@@ -59,6 +64,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityRegister(GAMEKIT_IDENTITY
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityConfirmRegistration(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmRegistrationRequest request)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityConfirmRegistration, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityConfirmRegistration"));
 
     return INVOKE_FUNC(GameKitIdentityConfirmRegistration, identityInstance, request);
 }
@@ -66,6 +73,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityConfirmRegistration(GAMEK
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityResendConfirmationCode(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ResendConfirmationCodeRequest request)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityResendConfirmationCode, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityResendConfirmationCode"));
 
     return INVOKE_FUNC(GameKitIdentityResendConfirmationCode, identityInstance, request);
 }
@@ -75,6 +84,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityLogin(GAMEKIT_IDENTITY_IN
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitIdentityWrapper::GameKitIdentityLogin()"));
     UE_LOG(LogAwsGameKit, Display, TEXT("identityInstance: %p"), identityInstance);
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityLogin, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityLogin"));
 
     return INVOKE_FUNC(GameKitIdentityLogin, identityInstance, userLogin);
 }
@@ -82,6 +93,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityLogin(GAMEKIT_IDENTITY_IN
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityLogout(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityLogout, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityLogout"));
 
     return INVOKE_FUNC(GameKitIdentityLogout, identityInstance);
 }
@@ -89,6 +102,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityLogout(GAMEKIT_IDENTITY_I
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityGetUser(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, DISPATCH_RECEIVER_HANDLE dispatchReceiver, FuncIdentityGetUserResponseCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityGetUser, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityGetUser"));
 
     return INVOKE_FUNC(GameKitIdentityGetUser, identityInstance, dispatchReceiver, responseCallback);
 }
@@ -96,6 +111,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityGetUser(GAMEKIT_IDENTITY_
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ForgotPasswordRequest request)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityForgotPassword, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityForgotPassword"));
 
     return INVOKE_FUNC(GameKitIdentityForgotPassword, identityInstance, request);
 }
@@ -103,6 +120,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityForgotPassword(GAMEKIT_ID
 unsigned int AwsGameKitIdentityWrapper::GameKitIdentityConfirmForgotPassword(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmForgotPasswordRequest request)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitIdentityConfirmForgotPassword, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitIdentityConfirmForgotPassword"));
 
     return INVOKE_FUNC(GameKitIdentityConfirmForgotPassword, identityInstance, request);
 }
@@ -110,6 +129,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitIdentityConfirmForgotPassword(GAM
 unsigned int AwsGameKitIdentityWrapper::GameKitGetFederatedLoginUrl(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, DISPATCH_RECEIVER_HANDLE dispatchReceiver, KeyValueCharPtrCallbackDispatcher responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitGetFederatedLoginUrl, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitGetFederatedLoginUrl"));
 
     return INVOKE_FUNC(GameKitGetFederatedLoginUrl, identityInstance, identityProvider, dispatchReceiver, responseCallback);
 }
@@ -117,6 +138,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitGetFederatedLoginUrl(GAMEKIT_IDEN
 unsigned int AwsGameKitIdentityWrapper::GameKitPollAndRetrieveFederatedTokens(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, const char* requestId, int timeout)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitPollAndRetrieveFederatedTokens, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitPollAndRetrieveFederatedTokens"));
 
     return INVOKE_FUNC(GameKitPollAndRetrieveFederatedTokens, identityInstance, identityProvider, requestId, timeout);
 }
@@ -124,6 +147,8 @@ unsigned int AwsGameKitIdentityWrapper::GameKitPollAndRetrieveFederatedTokens(GA
 unsigned int AwsGameKitIdentityWrapper::GameKitGetFederatedIdToken(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, FederatedIdentityProvider identityProvider, DISPATCH_RECEIVER_HANDLE dispatchReceiver, CharPtrCallback responseCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(Identity, GameKitGetFederatedIdToken, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::Identity, TEXT("GameKitGetFederatedIdToken"));
 
     return INVOKE_FUNC(GameKitGetFederatedIdToken, identityInstance, identityProvider, dispatchReceiver, responseCallback);
 }
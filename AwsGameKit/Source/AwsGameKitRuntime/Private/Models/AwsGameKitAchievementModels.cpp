@@ -0,0 +1,552 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/AwsGameKitAchievementModels.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+
+// Unreal
+#include "Containers/StringConv.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CString.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+    /**
+     * Pull parser over a UTF-8 Json buffer.
+     *
+     * Only what the achievements responses need: values are read straight into the destination fields and everything else is skipped,
+     * so no FString copy of the response and no FJsonValue tree is built.
+     */
+    class FAchievementsJsonCursor
+    {
+    public:
+        explicit FAchievementsJsonCursor(const char* response)
+            : current(response), end(response + FCStringAnsi::Strlen(response))
+        {}
+
+        // Calls onKey(key, keyLength) for each member of an object, the callback must consume the value.
+        template <typename OnKey>
+        bool ReadObject(OnKey onKey)
+        {
+            if (!Consume('{'))
+            {
+                return false;
+            }
+
+            if (Consume('}'))
+            {
+                return true;
+            }
+
+            do
+            {
+                const char* key;
+                int32 keyLength;
+                if (!ReadKey(key, keyLength) || !Consume(':') || !onKey(key, keyLength))
+                {
+                    return Fail();
+                }
+            } while (Consume(','));
+
+            return Consume('}') || Fail();
+        }
+
+        // Calls onElement() for each element of an array, the callback must consume the element.
+        template <typename OnElement>
+        bool ReadArray(OnElement onElement)
+        {
+            if (!Consume('['))
+            {
+                return false;
+            }
+
+            if (Consume(']'))
+            {
+                return true;
+            }
+
+            do
+            {
+                if (!onElement())
+                {
+                    return Fail();
+                }
+            } while (Consume(','));
+
+            return Consume(']') || Fail();
+        }
+
+        bool ReadString(FString& field)
+        {
+            if (Peek() == 'n')
+            {
+                // null leaves the field untouched, same as FJsonObject::TryGetStringField()
+                return SkipValue();
+            }
+
+            if (!Consume('"'))
+            {
+                return SkipValue();
+            }
+
+            const char* start = current;
+            while (current < end && *current != '"' && *current != '\\')
+            {
+                ++current;
+            }
+
+            if (current < end && *current == '"')
+            {
+                AssignUtf8(field, start, static_cast<int32>(current - start));
+                ++current;
+                return true;
+            }
+
+            // Escaped string, unescape into a scratch buffer first
+            scratch.Reset();
+            scratch.Append(start, static_cast<int32>(current - start));
+            if (!ReadEscapedTail(scratch))
+            {
+                return Fail();
+            }
+
+            AssignUtf8(field, scratch.GetData(), scratch.Num());
+            return true;
+        }
+
+        bool ReadNumber(int32& field)
+        {
+            const char* start = current;
+            if (!SkipNumber())
+            {
+                return SkipValue();
+            }
+
+            ANSICHAR number[64];
+            const int32 length = FMath::Min(static_cast<int32>(current - start), static_cast<int32>(UE_ARRAY_COUNT(number)) - 1);
+            FMemory::Memcpy(number, start, length);
+            number[length] = '\0';
+            field = FMath::RoundToInt(FCStringAnsi::Atod(number));
+            return true;
+        }
+
+        bool ReadBool(bool& field)
+        {
+            SkipWhitespace();
+            if (MatchLiteral("true"))
+            {
+                field = true;
+                return true;
+            }
+            if (MatchLiteral("false"))
+            {
+                field = false;
+                return true;
+            }
+
+            return SkipValue();
+        }
+
+        bool SkipValue()
+        {
+            SkipWhitespace();
+            switch (Peek())
+            {
+            case '{':
+                return ReadObject([this](const char*, int32) { return SkipValue(); });
+            case '[':
+                return ReadArray([this]() { return SkipValue(); });
+            case '"':
+            {
+                ++current;
+                while (current < end && *current != '"')
+                {
+                    current += (*current == '\\') ? 2 : 1;
+                }
+                if (current >= end)
+                {
+                    return Fail();
+                }
+                ++current;
+                return true;
+            }
+            case 't':
+                return MatchLiteral("true") || Fail();
+            case 'f':
+                return MatchLiteral("false") || Fail();
+            case 'n':
+                return MatchLiteral("null") || Fail();
+            default:
+                return SkipNumber() || Fail();
+            }
+        }
+
+        static bool KeyEquals(const char* key, int32 keyLength, const char* expected, int32 expectedLength)
+        {
+            return keyLength == expectedLength && FMemory::Memcmp(key, expected, keyLength) == 0;
+        }
+
+    private:
+        char Peek()
+        {
+            SkipWhitespace();
+            return current < end ? *current : '\0';
+        }
+
+        bool Consume(char expected)
+        {
+            if (Peek() == expected)
+            {
+                ++current;
+                return true;
+            }
+
+            return false;
+        }
+
+        static bool Fail()
+        {
+            return false;
+        }
+
+        void SkipWhitespace()
+        {
+            while (current < end && (*current == ' ' || *current == '\t' || *current == '\n' || *current == '\r'))
+            {
+                ++current;
+            }
+        }
+
+        bool MatchLiteral(const char* literal)
+        {
+            const int32 length = FCStringAnsi::Strlen(literal);
+            if (end - current >= length && FMemory::Memcmp(current, literal, length) == 0)
+            {
+                current += length;
+                return true;
+            }
+
+            return false;
+        }
+
+        bool SkipNumber()
+        {
+            SkipWhitespace();
+            const char* start = current;
+            while (current < end && (FChar::IsDigit(*current) || *current == '-' || *current == '+' || *current == '.' || *current == 'e' || *current == 'E'))
+            {
+                ++current;
+            }
+
+            return current != start;
+        }
+
+        bool ReadKey(const char*& key, int32& keyLength)
+        {
+            if (!Consume('"'))
+            {
+                return false;
+            }
+
+            key = current;
+            while (current < end && *current != '"' && *current != '\\')
+            {
+                ++current;
+            }
+
+            if (current < end && *current == '"')
+            {
+                keyLength = static_cast<int32>(current - key);
+                ++current;
+                return true;
+            }
+
+            // None of the keys we look for are escaped, but the value still has to be consumed correctly.
+            keyScratch.Reset();
+            keyScratch.Append(key, static_cast<int32>(current - key));
+            if (!ReadEscapedTail(keyScratch))
+            {
+                return false;
+            }
+
+            key = keyScratch.GetData();
+            keyLength = keyScratch.Num();
+            return true;
+        }
+
+        // Reads the rest of a string starting at the first backslash, through the closing quote, and appends it unescaped as UTF-8.
+        bool ReadEscapedTail(TArray<ANSICHAR, TInlineAllocator<256>>& out)
+        {
+            while (current < end)
+            {
+                const char c = *current++;
+                if (c == '"')
+                {
+                    return true;
+                }
+
+                if (c != '\\')
+                {
+                    out.Add(c);
+                    continue;
+                }
+
+                if (current >= end)
+                {
+                    return false;
+                }
+
+                switch (*current++)
+                {
+                case '"': out.Add('"'); break;
+                case '\\': out.Add('\\'); break;
+                case '/': out.Add('/'); break;
+                case 'b': out.Add('\b'); break;
+                case 'f': out.Add('\f'); break;
+                case 'n': out.Add('\n'); break;
+                case 'r': out.Add('\r'); break;
+                case 't': out.Add('\t'); break;
+                case 'u':
+                {
+                    uint32 codePoint;
+                    if (!ReadHex4(codePoint))
+                    {
+                        return false;
+                    }
+
+                    // Surrogate pair
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF && end - current >= 6 && current[0] == '\\' && current[1] == 'u')
+                    {
+                        current += 2;
+                        uint32 lowSurrogate;
+                        if (!ReadHex4(lowSurrogate))
+                        {
+                            return false;
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    }
+
+                    AppendUtf8(out, codePoint);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        bool ReadHex4(uint32& value)
+        {
+            if (end - current < 4)
+            {
+                return false;
+            }
+
+            value = 0;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                const char c = *current++;
+                if (!FChar::IsHexDigit(c))
+                {
+                    return false;
+                }
+                value = (value << 4) | FParse::HexDigit(c);
+            }
+
+            return true;
+        }
+
+        static void AppendUtf8(TArray<ANSICHAR, TInlineAllocator<256>>& out, uint32 codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                out.Add(static_cast<ANSICHAR>(codePoint));
+            }
+            else if (codePoint < 0x800)
+            {
+                out.Add(static_cast<ANSICHAR>(0xC0 | (codePoint >> 6)));
+                out.Add(static_cast<ANSICHAR>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                out.Add(static_cast<ANSICHAR>(0xE0 | (codePoint >> 12)));
+                out.Add(static_cast<ANSICHAR>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.Add(static_cast<ANSICHAR>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                out.Add(static_cast<ANSICHAR>(0xF0 | (codePoint >> 18)));
+                out.Add(static_cast<ANSICHAR>(0x80 | ((codePoint >> 12) & 0x3F)));
+                out.Add(static_cast<ANSICHAR>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.Add(static_cast<ANSICHAR>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        static void AssignUtf8(FString& field, const ANSICHAR* utf8, int32 length)
+        {
+            const FUTF8ToTCHAR converted(utf8, length);
+            field = FString(converted.Length(), converted.Get());
+        }
+
+        const char* current;
+        const char* end;
+        TArray<ANSICHAR, TInlineAllocator<256>> scratch;
+        TArray<ANSICHAR, TInlineAllocator<256>> keyScratch;
+    };
+
+#define AWSGAMEKIT_ACHIEVEMENT_KEY(Literal) Literal, static_cast<int32>(sizeof(Literal) - 1)
+
+    bool ReadAchievement(FAchievementsJsonCursor& cursor, FAchievement& achievement)
+    {
+        achievement.IsNewlyEarned = false;
+
+        const bool result = cursor.ReadObject([&](const char* key, int32 keyLength)
+        {
+            auto is = [key, keyLength](const char* expected, int32 expectedLength)
+            {
+                return FAchievementsJsonCursor::KeyEquals(key, keyLength, expected, expectedLength);
+            };
+
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("achievement_id"))) return cursor.ReadString(achievement.AchievementId);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("title"))) return cursor.ReadString(achievement.Title);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("locked_description"))) return cursor.ReadString(achievement.LockedDescription);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("unlocked_description"))) return cursor.ReadString(achievement.UnlockedDescription);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("locked_icon_url"))) return cursor.ReadString(achievement.LockedIcon);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("unlocked_icon_url"))) return cursor.ReadString(achievement.UnlockedIcon);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("updated_at"))) return cursor.ReadString(achievement.UpdatedAt);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("definition_updated_at"))) return cursor.ReadString(achievement.DefinitionUpdatedAt);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("earned_at"))) return cursor.ReadString(achievement.EarnedAt);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("max_value"))) return cursor.ReadNumber(achievement.RequiredAmount);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("points"))) return cursor.ReadNumber(achievement.Points);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("order_number"))) return cursor.ReadNumber(achievement.OrderNumber);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("current_value"))) return cursor.ReadNumber(achievement.CurrentValue);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("is_secret"))) return cursor.ReadBool(achievement.IsSecret);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("is_hidden"))) return cursor.ReadBool(achievement.IsHidden);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("earned"))) return cursor.ReadBool(achievement.IsEarned);
+            if (is(AWSGAMEKIT_ACHIEVEMENT_KEY("newly_earned"))) return cursor.ReadBool(achievement.IsNewlyEarned);
+            return cursor.SkipValue();
+        });
+
+        achievement.IsStateful = achievement.RequiredAmount > 1;
+        return result;
+    }
+
+    // Positions the cursor on the value of the top level "data" member and calls onData() to consume it.
+    template <typename OnData>
+    bool ReadData(FAchievementsJsonCursor& cursor, OnData onData)
+    {
+        bool foundData = false;
+        const bool result = cursor.ReadObject([&](const char* key, int32 keyLength)
+        {
+            if (FAchievementsJsonCursor::KeyEquals(key, keyLength, AWSGAMEKIT_ACHIEVEMENT_KEY("data")))
+            {
+                foundData = true;
+                return onData();
+            }
+            return cursor.SkipValue();
+        });
+
+        return result && foundData;
+    }
+}
+
+bool AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(FAchievement& output, const char* response)
+{
+    FAchievementsJsonCursor cursor(response);
+    const bool result = ReadData(cursor, [&]() { return ReadAchievement(cursor, output); });
+    if (!result)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("AwsGamekitAchievementsResponseProcessor::DecodeAchievementFromResponse(): Malformed response"));
+    }
+
+    return result;
+}
+
+bool AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(TArray<FAchievement>& output, const char* response)
+{
+    FAchievementsJsonCursor cursor(response);
+    const int32 initialNum = output.Num();
+    const bool result = ReadData(cursor, [&]()
+    {
+        return cursor.ReadObject([&](const char* key, int32 keyLength)
+        {
+            if (!FAchievementsJsonCursor::KeyEquals(key, keyLength, AWSGAMEKIT_ACHIEVEMENT_KEY("achievements")))
+            {
+                return cursor.SkipValue();
+            }
+
+            return cursor.ReadArray([&]()
+            {
+                // Decode in place, the caller reserves the page size up front
+                return ReadAchievement(cursor, output.Emplace_GetRef());
+            });
+        });
+    });
+
+    if (!result)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(): Malformed response, discarding the page"));
+        output.SetNum(initialNum);
+    }
+
+    return result;
+}
+
+#undef AWSGAMEKIT_ACHIEVEMENT_KEY
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CmdGameKitBenchmarkAchievementsDecode(
+    TEXT("GameKit.Achievements.BenchmarkDecode"),
+    TEXT("Compares the streaming achievements decoder against the FJsonObject path on a synthetic page.\n")
+    TEXT("Usage: GameKit.Achievements.BenchmarkDecode [NumAchievements=1500] [Iterations=20]\n"),
+    FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+    {
+        const int32 numAchievements = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1500;
+        const int32 iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+        FString page = TEXT("{\"data\":{\"achievements\":[");
+        for (int32 i = 0; i < numAchievements; ++i)
+        {
+            page += FString::Printf(TEXT("%s{\"achievement_id\":\"achievement_%d\",\"title\":\"Achievement \\u00e9 %d\",\"locked_description\":\"Do the thing %d times\",")
+                TEXT("\"unlocked_description\":\"You did the thing\",\"locked_icon_url\":\"icons/locked_%d.png\",\"unlocked_icon_url\":\"icons/unlocked_%d.png\",")
+                TEXT("\"max_value\":%d,\"points\":10,\"order_number\":%d,\"current_value\":3,\"is_secret\":false,\"is_hidden\":false,\"earned\":false,")
+                TEXT("\"newly_earned\":false,\"updated_at\":\"2022-01-01T00:00:00Z\",\"earned_at\":\"\"}"),
+                i == 0 ? TEXT("") : TEXT(","), i, i, i, i, i, 1 + i % 10, i);
+        }
+        page += TEXT("]},\"paging\":{\"next_start_key\":null}}");
+
+        const FTCHARToUTF8 utf8Page(*page);
+
+        double jsonObjectSeconds = 0.0;
+        double streamingSeconds = 0.0;
+        for (int32 i = 0; i < iterations; ++i)
+        {
+            double start = FPlatformTime::Seconds();
+            {
+                TArray<FAchievement> output;
+                const FString data = UTF8_TO_TCHAR(utf8Page.Get());
+                AwsGamekitAchievementsResponseProcessor::GetListOfAchievementsFromResponse(output, data);
+            }
+            jsonObjectSeconds += FPlatformTime::Seconds() - start;
+
+            start = FPlatformTime::Seconds();
+            {
+                TArray<FAchievement> output;
+                output.Reserve(numAchievements);
+                AwsGamekitAchievementsResponseProcessor::DecodeListOfAchievementsFromResponse(output, utf8Page.Get());
+            }
+            streamingSeconds += FPlatformTime::Seconds() - start;
+        }
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("GameKit.Achievements.BenchmarkDecode: %d achievements, %d bytes, %d iterations. FJsonObject: %.3f ms, streaming: %.3f ms per page (%.1fx)"),
+            numAchievements, utf8Page.Length(), iterations,
+            jsonObjectSeconds * 1000.0 / iterations, streamingSeconds * 1000.0 / iterations,
+            streamingSeconds > 0.0 ? jsonObjectSeconds / streamingSeconds : 0.0);
+    }));
+#endif
@@ -0,0 +1,252 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Core/AwsGameKitTrace.h"
+#include "GameSaving/AwsGameKitGameSavingChangeTracker.h"
+#include "GameSaving/AwsGameKitGameSavingChecksum.h"
+#include "GameSaving/AwsGameKitGameSavingCompression.h"
+#include "GameSaving/AwsGameKitGameSavingEncryption.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+
+// Unreal
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace
+{
+    // Largest single IFileHandle::Read() call when the save file can't be mapped
+    const int64 FILE_READ_CHUNK_SIZE = 4 * 1024 * 1024;
+}
+
+ModelCache::ModelCache(const FGameSavingSaveSlotRequest& request) :
+    slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+    saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+    metadata(TCHAR_TO_UTF8(ToCStr(request.Metadata))),
+    epochTime(request.EpochTime),
+    overrideSync(request.OverrideSync)
+{
+    if (request.SaveFilePath.IsEmpty())
+    {
+        dataPtr = request.Data.GetData();
+        dataSize = request.Data.Num();
+    }
+    else
+    {
+        dataLoaded = LoadSaveFile(request.SaveFilePath);
+    }
+
+    PrepareSaveData();
+}
+
+ModelCache::ModelCache(const FGameSavingSaveSlotRequest& request, TArray<uint8>&& saveFileData) :
+    slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+    saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+    metadata(TCHAR_TO_UTF8(ToCStr(request.Metadata))),
+    epochTime(request.EpochTime),
+    overrideSync(request.OverrideSync),
+    streamedData(MoveTemp(saveFileData))
+{
+    dataPtr = streamedData.GetData();
+    dataSize = streamedData.Num();
+
+    PrepareSaveData();
+}
+
+void ModelCache::PrepareSaveData()
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    AWSGAMEKIT_TRACE_PHASE(Marshalling);
+
+    if (!dataLoaded || dataSize > MAX_int32)
+    {
+        // Too large to be encrypted, and never uploaded in the clear when the game asked for encryption
+        dataLoaded = dataLoaded && !FAwsGameKitGameSavingEncryption::IsEnabled();
+        return;
+    }
+
+    const TArrayView<const uint8> saveFile(dataPtr, static_cast<int32>(dataSize));
+    const TArrayView<const uint8> metadataView(reinterpret_cast<const uint8*>(metadata.data()), static_cast<int32>(metadata.size()));
+
+    // The checksum doubles as the change tracker's hash, so the save file is only scanned once
+    const bool checksumEnabled = FAwsGameKitGameSavingChecksum::IsEnabled();
+    const uint32 checksum = checksumEnabled ? FAwsGameKitGameSavingChecksum::Crc32c(saveFile) : 0;
+    if (FAwsGameKitGameSavingChangeTracker::IsEnabled())
+    {
+        contentHash = checksumEnabled
+            ? FAwsGameKitGameSavingChangeTracker::HashContent(dataSize, checksum, metadataView)
+            : FAwsGameKitGameSavingChangeTracker::HashContent(saveFile, metadataView);
+    }
+
+    if (FAwsGameKitGameSavingCompression::IsEnabled())
+    {
+        CompressSaveData();
+    }
+
+    if (checksumEnabled)
+    {
+        AppendChecksum(checksum);
+    }
+
+    if (FAwsGameKitGameSavingEncryption::IsEnabled())
+    {
+        EncryptSaveData();
+    }
+}
+
+ModelCache::ModelCache(const FGameSavingLoadSlotRequest& request) :
+    slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
+    saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
+    overrideSync(request.OverrideSync)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+
+    // The Game Saving library overwrites the whole buffer, so only the request's size is used
+    int64 bufferSize = request.Data.Num();
+    FGameSavingSlot indexedSlot;
+    if (bufferSize == 0 && FAwsGameKitGameSavingSlotIndex::Get().GetSlot(request.SlotName, indexedSlot))
+    {
+        bufferSize = indexedSlot.SizeCloud;
+    }
+
+    data.SetNumUninitialized(static_cast<int32>(FMath::Clamp<int64>(bufferSize, 0, MAX_int32)));
+    dataPtr = data.GetData();
+    dataSize = data.Num();
+}
+
+bool ModelCache::TakeLoadedData(const uint8* payload, int32 payloadSize, TArray<uint8>& outData)
+{
+    if (payload != data.GetData() || payloadSize > data.Num())
+    {
+        return false;
+    }
+
+    // Only the checksum trailer is cut off, the slack isn't worth a reallocation
+    data.SetNum(payloadSize, false);
+    outData = MoveTemp(data);
+    dataPtr = nullptr;
+    dataSize = 0;
+    return true;
+}
+
+ModelCache::~ModelCache()
+{
+    // The region must be unmapped before its file is closed
+    mappedRegion.Reset();
+    mappedFile.Reset();
+}
+
+bool ModelCache::LoadSaveFile(const FString& filePath)
+{
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
+    IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // Map the file rather than reading it, the Game Saving library then hashes and uploads the pages straight from the mapping
+    mappedFile.Reset(platformFile.OpenMapped(*filePath));
+    const int64 mappedFileSize = mappedFile.IsValid() ? mappedFile->GetFileSize() : 0;
+    if (mappedFileSize > 0 && mappedFileSize <= MAX_uint32)
+    {
+        mappedRegion.Reset(mappedFile->MapRegion(0, mappedFileSize));
+    }
+
+    if (mappedRegion.IsValid())
+    {
+        dataPtr = mappedRegion->GetMappedPtr();
+        dataSize = mappedRegion->GetMappedSize();
+        return true;
+    }
+
+    // Platforms which can't map files, and empty files
+    mappedFile.Reset();
+    const TUniquePtr<IFileHandle> fileHandle(platformFile.OpenRead(*filePath));
+    if (!fileHandle.IsValid())
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("ModelCache::LoadSaveFile() Could not open save file %s"), *filePath);
+        return false;
+    }
+
+    const int64 fileSize = fileHandle->Size();
+    if (fileSize < 0 || fileSize > MAX_int32)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("ModelCache::LoadSaveFile() Save file %s has an unsupported size of %lld bytes"), *filePath, fileSize);
+        return false;
+    }
+
+    streamedData.SetNumUninitialized(fileSize);
+    for (int64 offset = 0; offset < fileSize; offset += FILE_READ_CHUNK_SIZE)
+    {
+        if (!fileHandle->Read(streamedData.GetData() + offset, FMath::Min(FILE_READ_CHUNK_SIZE, fileSize - offset)))
+        {
+            UE_LOG(LogAwsGameKit, Error, TEXT("ModelCache::LoadSaveFile() Could not read save file %s"), *filePath);
+            streamedData.Empty();
+            return false;
+        }
+    }
+
+    dataPtr = streamedData.GetData();
+    dataSize = streamedData.Num();
+    return true;
+}
+
+void ModelCache::CompressSaveData()
+{
+    if (!FAwsGameKitGameSavingCompression::Compress(TArrayView<const uint8>(dataPtr, static_cast<int32>(dataSize)), payloadData))
+    {
+        return;
+    }
+
+    dataPtr = payloadData.GetData();
+    dataSize = payloadData.Num();
+
+    // The original save file isn't needed anymore
+    streamedData.Empty();
+    mappedRegion.Reset();
+    mappedFile.Reset();
+}
+
+void ModelCache::EncryptSaveData()
+{
+    TArray<uint8> encryptedData;
+    if (!FAwsGameKitGameSavingEncryption::Encrypt(TArrayView<const uint8>(dataPtr, static_cast<int32>(dataSize)), UTF8_TO_TCHAR(slotName.c_str()), encryptedData))
+    {
+        // Never uploaded in the clear when the game asked for encryption
+        dataLoaded = false;
+        return;
+    }
+
+    payloadData = MoveTemp(encryptedData);
+    dataPtr = payloadData.GetData();
+    dataSize = payloadData.Num();
+
+    // The save file in the clear isn't needed anymore
+    streamedData.Empty();
+    mappedRegion.Reset();
+    mappedFile.Reset();
+}
+
+void ModelCache::AppendChecksum(uint32 checksum)
+{
+    // Owned buffers get the trailer in place, the request's Data and mapped save files have to be copied first
+    TArray<uint8>* payload = &payloadData;
+    if (dataPtr == streamedData.GetData())
+    {
+        payload = &streamedData;
+    }
+    else if (dataPtr != payloadData.GetData())
+    {
+        // With room for the trailer
+        payloadData.Reset(static_cast<int32>(dataSize) + 16);
+        payloadData.Append(dataPtr, static_cast<int32>(dataSize));
+        mappedRegion.Reset();
+        mappedFile.Reset();
+    }
+
+    FAwsGameKitGameSavingChecksum::AppendTrailer(*payload, checksum);
+    dataPtr = payload->GetData();
+    dataSize = payload->Num();
+}
@@ -0,0 +1,276 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievementsCache.h"
+#include "AwsGameKitCore.h"
+#include "Core/Logging.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+
+// Unreal
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    thread_local FAwsGameKitPlayerHandle CurrentPlayer;
+}
+
+struct FAwsGameKitPlayerContext
+{
+    // The libraries held here don't set PlayerContext, the copies returned by FAwsGameKitPlayerContexts do
+    SessionManagerLibrary SessionManager;
+    IdentityLibrary Identity;
+    AchievementsLibrary Achievements;
+    GameSavingLibrary GameSaving;
+    UserGameplayDataLibrary UserGameplayData;
+
+    // Guards the creation and release of the feature instances
+    FCriticalSection Mutex;
+
+    ~FAwsGameKitPlayerContext()
+    {
+        Release();
+    }
+
+    void Release()
+    {
+        FScopeLock Lock(&Mutex);
+        if (UserGameplayData.UserGameplayDataInstanceHandle != nullptr)
+        {
+            UserGameplayData.UserGameplayDataWrapper->GameKitUserGameplayDataInstanceRelease(UserGameplayData.UserGameplayDataInstanceHandle);
+            UserGameplayData.UserGameplayDataInstanceHandle = nullptr;
+        }
+        if (GameSaving.GameSavingInstanceHandle != nullptr)
+        {
+            GameSaving.GameSavingWrapper->GameKitGameSavingInstanceRelease(GameSaving.GameSavingInstanceHandle);
+            GameSaving.GameSavingInstanceHandle = nullptr;
+        }
+        if (Achievements.AchievementsInstanceHandle != nullptr)
+        {
+            Achievements.AchievementsWrapper->GameKitAchievementsInstanceRelease(Achievements.AchievementsInstanceHandle);
+            Achievements.AchievementsInstanceHandle = nullptr;
+        }
+        if (Identity.IdentityInstanceHandle != nullptr)
+        {
+            Identity.IdentityWrapper->GameKitIdentityInstanceRelease(Identity.IdentityInstanceHandle);
+            Identity.IdentityInstanceHandle = nullptr;
+        }
+        if (SessionManager.SessionManagerInstanceHandle != nullptr)
+        {
+            SessionManager.SessionManagerWrapper->GameKitSessionManagerInstanceRelease(SessionManager.SessionManagerInstanceHandle);
+            SessionManager.SessionManagerInstanceHandle = nullptr;
+        }
+    }
+};
+
+FAwsGameKitPlayerScope::FAwsGameKitPlayerScope(FAwsGameKitPlayerHandle Player) :
+    Previous(CurrentPlayer)
+{
+    CurrentPlayer = Player;
+}
+
+FAwsGameKitPlayerScope::~FAwsGameKitPlayerScope()
+{
+    CurrentPlayer = Previous;
+}
+
+FAwsGameKitPlayerHandle FAwsGameKitPlayerScope::GetCurrent()
+{
+    return CurrentPlayer;
+}
+
+FAwsGameKitPlayerContexts& FAwsGameKitPlayerContexts::Get()
+{
+    static FAwsGameKitPlayerContexts Instance;
+    return Instance;
+}
+
+FAwsGameKitPlayerHandle FAwsGameKitPlayerContexts::CreatePlayer()
+{
+    // The module's own libraries, whatever the caller's scope
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    const SessionManagerLibrary ModuleSessionManager = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
+
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = MakeShared<FAwsGameKitPlayerContext, ESPMode::ThreadSafe>();
+    Context->SessionManager.SessionManagerWrapper = ModuleSessionManager.SessionManagerWrapper;
+    Context->SessionManager.SessionManagerInstanceHandle = ModuleSessionManager.SessionManagerWrapper->GameKitSessionManagerInstanceCreate(nullptr, FGameKitLogging::LogCallBack);
+    if (Context->SessionManager.SessionManagerInstanceHandle == nullptr)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitPlayerContexts::CreatePlayer(): Failed to create the player's Session Manager instance"));
+        return FAwsGameKitPlayerHandle{};
+    }
+
+    // The contents rather than the path: on mobile platforms the file is inside the package and the module adds the CA certificate to it
+    const FString ConfigContents = ModuleSessionManager.SessionManagerWrapper->GetLoadedClientConfigContents();
+    if (!ConfigContents.IsEmpty())
+    {
+        ModuleSessionManager.SessionManagerWrapper->GameKitSessionManagerReloadConfigContents(Context->SessionManager.SessionManagerInstanceHandle, TCHAR_TO_UTF8(*ConfigContents));
+    }
+
+    FScopeLock Lock(&Mutex);
+    FAwsGameKitPlayerHandle Player{ NextId++ };
+    if (!Player.IsValid())
+    {
+        // Skip the default handle when the ids wrap around
+        Player.Id = NextId++;
+    }
+    Players.Add(Player, MoveTemp(Context));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitPlayerContexts::CreatePlayer(): Created player %u, %d players"), Player.Id, Players.Num());
+    return Player;
+}
+
+void FAwsGameKitPlayerContexts::ReleasePlayer(FAwsGameKitPlayerHandle Player)
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context;
+    {
+        FScopeLock Lock(&Mutex);
+        Players.RemoveAndCopyValue(Player, Context);
+    }
+
+    if (Context.IsValid())
+    {
+        // The instances are released with the last copy of the player's libraries
+        FAwsGameKitSessionTokenRefresher::Get().ClearPlayer(Player);
+        FAwsGameKitRegionSelector::Get().OnPlayerReleased(Player);
+        FAwsGameKitAchievementsCache::Get().ClearProgress(Player);
+    }
+}
+
+int32 FAwsGameKitPlayerContexts::Num() const
+{
+    FScopeLock Lock(&Mutex);
+    return Players.Num();
+}
+
+void FAwsGameKitPlayerContexts::Shutdown()
+{
+    TMap<FAwsGameKitPlayerHandle, TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe>> Released;
+    {
+        FScopeLock Lock(&Mutex);
+        Released = MoveTemp(Players);
+        Players.Reset();
+    }
+
+    // The libraries are released next, whether copies are still held or not
+    for (const TPair<FAwsGameKitPlayerHandle, TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe>>& Player : Released)
+    {
+        Player.Value->Release();
+    }
+}
+
+TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> FAwsGameKitPlayerContexts::FindPlayer(FAwsGameKitPlayerHandle Player) const
+{
+    if (!Player.IsValid())
+    {
+        return nullptr;
+    }
+
+    FScopeLock Lock(&Mutex);
+    const TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe>* Context = Players.Find(Player);
+    return Context != nullptr ? *Context : nullptr;
+}
+
+SessionManagerLibrary FAwsGameKitPlayerContexts::GetSessionManagerLibrary(FAwsGameKitPlayerHandle Player) const
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = FindPlayer(Player);
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    if (!Context.IsValid())
+    {
+        return FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
+    }
+
+    FScopeLock Lock(&Context->Mutex);
+    SessionManagerLibrary Library = Context->SessionManager;
+    Library.PlayerContext = Context;
+    return Library;
+}
+
+IdentityLibrary FAwsGameKitPlayerContexts::GetIdentityLibrary(FAwsGameKitPlayerHandle Player)
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = FindPlayer(Player);
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    const IdentityLibrary ModuleLibrary = FAwsGameKitRuntimeModule::Get().GetIdentityLibrary();
+    if (!Context.IsValid())
+    {
+        return ModuleLibrary;
+    }
+
+    FScopeLock Lock(&Context->Mutex);
+    if (Context->Identity.IdentityInstanceHandle == nullptr && Context->SessionManager.SessionManagerInstanceHandle != nullptr)
+    {
+        Context->Identity.IdentityWrapper = ModuleLibrary.IdentityWrapper;
+        Context->Identity.IdentityInstanceHandle = ModuleLibrary.IdentityWrapper->GameKitIdentityInstanceCreateWithSessionManager(Context->SessionManager.SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+    }
+    IdentityLibrary Library = Context->Identity;
+    Library.PlayerContext = Context;
+    return Library;
+}
+
+AchievementsLibrary FAwsGameKitPlayerContexts::GetAchievementsLibrary(FAwsGameKitPlayerHandle Player)
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = FindPlayer(Player);
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    const AchievementsLibrary ModuleLibrary = FAwsGameKitRuntimeModule::Get().GetAchievementsLibrary();
+    if (!Context.IsValid())
+    {
+        return ModuleLibrary;
+    }
+
+    FScopeLock Lock(&Context->Mutex);
+    if (Context->Achievements.AchievementsInstanceHandle == nullptr && Context->SessionManager.SessionManagerInstanceHandle != nullptr)
+    {
+        Context->Achievements.AchievementsWrapper = ModuleLibrary.AchievementsWrapper;
+        Context->Achievements.AchievementsInstanceHandle = ModuleLibrary.AchievementsWrapper->GameKitAchievementsInstanceCreateWithSessionManager(Context->SessionManager.SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+    }
+    AchievementsLibrary Library = Context->Achievements;
+    Library.PlayerContext = Context;
+    return Library;
+}
+
+GameSavingLibrary FAwsGameKitPlayerContexts::GetGameSavingLibrary(FAwsGameKitPlayerHandle Player)
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = FindPlayer(Player);
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    const GameSavingLibrary ModuleLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+    if (!Context.IsValid())
+    {
+        return ModuleLibrary;
+    }
+
+    FScopeLock Lock(&Context->Mutex);
+    if (Context->GameSaving.GameSavingInstanceHandle == nullptr && Context->SessionManager.SessionManagerInstanceHandle != nullptr)
+    {
+        Context->GameSaving.GameSavingWrapper = ModuleLibrary.GameSavingWrapper;
+        Context->GameSaving.GameSavingInstanceHandle = ModuleLibrary.GameSavingWrapper->GameKitGameSavingInstanceCreateWithSessionManager(Context->SessionManager.SessionManagerInstanceHandle, FGameKitLogging::LogCallBack, nullptr, 0, DefaultFileActions());
+    }
+    GameSavingLibrary Library = Context->GameSaving;
+    Library.PlayerContext = Context;
+    return Library;
+}
+
+UserGameplayDataLibrary FAwsGameKitPlayerContexts::GetUserGameplayDataLibrary(FAwsGameKitPlayerHandle Player)
+{
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> Context = FindPlayer(Player);
+    FAwsGameKitPlayerScope ProcessScope(FAwsGameKitPlayerHandle{});
+    const UserGameplayDataLibrary ModuleLibrary = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+    if (!Context.IsValid())
+    {
+        return ModuleLibrary;
+    }
+
+    FScopeLock Lock(&Context->Mutex);
+    if (Context->UserGameplayData.UserGameplayDataInstanceHandle == nullptr && Context->SessionManager.SessionManagerInstanceHandle != nullptr)
+    {
+        Context->UserGameplayData.UserGameplayDataWrapper = ModuleLibrary.UserGameplayDataWrapper;
+        Context->UserGameplayData.UserGameplayDataInstanceHandle = ModuleLibrary.UserGameplayDataWrapper->GameKitUserGameplayDataInstanceCreateWithSessionManager(Context->SessionManager.SessionManagerInstanceHandle, FGameKitLogging::LogCallBack);
+
+        // The network status and retry queue stats stay the module's
+        Context->UserGameplayData.UserGameplayDataStateHandler = ModuleLibrary.UserGameplayDataStateHandler;
+    }
+    UserGameplayDataLibrary Library = Context->UserGameplayData;
+    Library.PlayerContext = Context;
+    return Library;
+}
@@ -0,0 +1,547 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitRegionSelector.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "SessionManager/AwsGameKitTransport.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitSessionManagerRegionSelection(
+    TEXT("GameKit.SessionManager.RegionSelection"),
+    1,
+    TEXT("If 1 and awsGameKitClientConfig.yml lists several regional deployments, the Session Manager uses the one with the lowest latency, see FAwsGameKitRegionSelector.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitSessionManagerRegionProbeTimeoutSeconds(
+    TEXT("GameKit.SessionManager.RegionProbeTimeoutSeconds"),
+    3.0f,
+    TEXT("Timeout of each request probing the latency of a regional deployment. A region whose probe times out is unhealthy.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Written before the regional settings, so that the block can be found and replaced
+    const TCHAR* REGIONAL_SETTINGS_COMMENT = TEXT("# Regional deployments, written by the AWS GameKit editor. See FAwsGameKitRegionSelector.");
+
+    // The region whose settings are the file's own settings
+    FString GetConfigRegion(const TMap<FString, FString>& Settings, const TMap<FString, TMap<FString, FString>>& RegionalSettings)
+    {
+        for (const TPair<FString, TMap<FString, FString>>& region : RegionalSettings)
+        {
+            bool bMatches = true;
+            for (const TPair<FString, FString>& setting : region.Value)
+            {
+                const FString* value = Settings.Find(setting.Key);
+                if (value == nullptr || *value != setting.Value)
+                {
+                    bMatches = false;
+                    break;
+                }
+            }
+            if (bMatches)
+            {
+                return region.Key;
+            }
+        }
+        return FString();
+    }
+}
+
+const TCHAR* FAwsGameKitRegionSelector::REGION_KEY_SEPARATOR = TEXT(".");
+
+struct FAwsGameKitRegionSelector::FProbes
+{
+    FCriticalSection Mutex;
+    uint32 Generation = 0;
+    int32 Remaining = 0;
+
+    // Latency of the slowest host of each region, and the regions with a host which didn't answer
+    TMap<FString, double> LatencySeconds;
+    TSet<FString> UnhealthyRegions;
+};
+
+FAwsGameKitRegionSelector& FAwsGameKitRegionSelector::Get()
+{
+    static FAwsGameKitRegionSelector Instance;
+    return Instance;
+}
+
+bool FAwsGameKitRegionSelector::IsEnabled()
+{
+    return CVarGameKitSessionManagerRegionSelection.GetValueOnAnyThread() != 0;
+}
+
+void FAwsGameKitRegionSelector::Startup()
+{
+    if (!EnteredForegroundHandle.IsValid())
+    {
+        EnteredForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddRaw(this, &FAwsGameKitRegionSelector::OnEnteredForeground);
+    }
+}
+
+void FAwsGameKitRegionSelector::Shutdown()
+{
+    FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(EnteredForegroundHandle);
+    EnteredForegroundHandle.Reset();
+
+    FScopeLock lock(&Mutex);
+    ++CurrentGeneration;
+    Wrapper = nullptr;
+    Instance = nullptr;
+    ActiveRegion.Reset();
+    PendingRegion.Reset();
+    ProbedRegions.Reset();
+}
+
+void FAwsGameKitRegionSelector::OnConfigLoaded(AwsGameKitSessionManagerWrapper* SessionManagerWrapper, GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE SessionManagerInstance)
+{
+    if (!IsEnabled() || SessionManagerWrapper == nullptr)
+    {
+        return;
+    }
+
+    const FString contents = SessionManagerWrapper->GetLoadedClientConfigContents();
+    TMap<FString, FString> settings;
+    TMap<FString, TMap<FString, FString>> regionalSettings;
+    ParseClientConfig(contents, settings, regionalSettings);
+    const TArray<FString> regions = GetCandidateRegions(contents);
+
+    FString regionToKeep;
+    bool bProbe = false;
+    {
+        FScopeLock lock(&Mutex);
+        Wrapper = SessionManagerWrapper;
+        Instance = SessionManagerInstance;
+        if (regions.Num() < 2)
+        {
+            ++CurrentGeneration;
+            ActiveRegion.Reset();
+            PendingRegion.Reset();
+            ProbedRegions.Reset();
+            return;
+        }
+
+        // The file's settings were just loaded, in place of those of the region in use
+        const FString configRegion = GetConfigRegion(settings, regionalSettings);
+        if (!ActiveRegion.IsEmpty() && ActiveRegion != configRegion && regions.Contains(ActiveRegion))
+        {
+            regionToKeep = ActiveRegion;
+        }
+        else
+        {
+            ActiveRegion = configRegion;
+        }
+
+        bProbe = regions != ProbedRegions;
+    }
+
+    if (!regionToKeep.IsEmpty())
+    {
+        ApplyRegion(regionToKeep);
+    }
+    if (bProbe)
+    {
+        StartProbes(contents);
+    }
+}
+
+void FAwsGameKitRegionSelector::Reevaluate()
+{
+    AwsGameKitSessionManagerWrapper* wrapper;
+    {
+        FScopeLock lock(&Mutex);
+        wrapper = Wrapper;
+    }
+
+    if (IsEnabled() && wrapper != nullptr)
+    {
+        StartProbes(wrapper->GetLoadedClientConfigContents());
+    }
+}
+
+void FAwsGameKitRegionSelector::OnNetworkStatusChange(bool bIsConnectionOk)
+{
+    bool bReconnected;
+    {
+        FScopeLock lock(&Mutex);
+        bReconnected = bIsConnectionOk && !this->bIsConnectionOk;
+        this->bIsConnectionOk = bIsConnectionOk;
+    }
+
+    // The connection may have come back through another network, closer to another region
+    if (bReconnected)
+    {
+        Reevaluate();
+    }
+}
+
+void FAwsGameKitRegionSelector::OnEnteredForeground()
+{
+    Reevaluate();
+}
+
+void FAwsGameKitRegionSelector::OnLogin()
+{
+    FScopeLock lock(&Mutex);
+    LoggedInPlayers.Add(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+void FAwsGameKitRegionSelector::OnLogout()
+{
+    RemoveLoggedInPlayer(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+void FAwsGameKitRegionSelector::OnPlayerReleased(FAwsGameKitPlayerHandle Player)
+{
+    RemoveLoggedInPlayer(Player);
+}
+
+void FAwsGameKitRegionSelector::RemoveLoggedInPlayer(FAwsGameKitPlayerHandle Player)
+{
+    FString regionToApply;
+    {
+        FScopeLock lock(&Mutex);
+        LoggedInPlayers.Remove(Player);
+        if (LoggedInPlayers.Num() > 0)
+        {
+            // The other players' tokens were issued by the active region
+            return;
+        }
+        regionToApply = MoveTemp(PendingRegion);
+        PendingRegion.Reset();
+    }
+
+    if (!regionToApply.IsEmpty())
+    {
+        ApplyRegion(regionToApply);
+    }
+}
+
+FString FAwsGameKitRegionSelector::GetActiveRegion() const
+{
+    FScopeLock lock(&Mutex);
+    return ActiveRegion;
+}
+
+void FAwsGameKitRegionSelector::StartProbes(const FString& ClientConfigContents)
+{
+    const TArray<FString> regions = GetCandidateRegions(ClientConfigContents);
+    if (regions.Num() < 2)
+    {
+        return;
+    }
+
+    // Hosts of every region, so that the count is known before the first probe can complete
+    TArray<TPair<FString, FString>> regionHosts;
+    for (const FString& region : regions)
+    {
+        for (const FString& host : FAwsGameKitTransport::GetEndpointHosts(MakeRegionalClientConfig(ClientConfigContents, region)))
+        {
+            regionHosts.Emplace(region, host);
+        }
+    }
+    if (regionHosts.Num() == 0)
+    {
+        return;
+    }
+
+    TSharedRef<FProbes, ESPMode::ThreadSafe> probes = MakeShared<FProbes, ESPMode::ThreadSafe>();
+    probes->Remaining = regionHosts.Num();
+    {
+        FScopeLock lock(&Mutex);
+        probes->Generation = ++CurrentGeneration;
+        ProbedRegions = regions;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitRegionSelector: Probing %d hosts in %d regions"), regionHosts.Num(), regions.Num());
+    const float timeoutSeconds = CVarGameKitSessionManagerRegionProbeTimeoutSeconds.GetValueOnAnyThread();
+    for (const TPair<FString, FString>& regionHost : regionHosts)
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> httpRequest = FAwsGameKitTransport::Get().CreateRequest();
+        httpRequest->SetURL(regionHost.Value);
+        httpRequest->SetVerb(TEXT("HEAD"));
+        if (timeoutSeconds > 0.0f)
+        {
+            httpRequest->SetTimeout(timeoutSeconds);
+        }
+
+        const FString region = regionHost.Key;
+        const double startTime = FPlatformTime::Seconds();
+        httpRequest->OnProcessRequestComplete().BindLambda([this, probes, region, startTime](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+        {
+            const double latencySeconds = FPlatformTime::Seconds() - startTime;
+
+            // API Gateway answers a request without a route or a token with a 403, which is enough to measure the round trip
+            const bool bIsHealthy = Response.IsValid() && Response->GetResponseCode() < 500;
+            bool bIsLast;
+            {
+                FScopeLock lock(&probes->Mutex);
+                if (bIsHealthy)
+                {
+                    double& regionLatency = probes->LatencySeconds.FindOrAdd(region, 0.0);
+                    regionLatency = FMath::Max(regionLatency, latencySeconds);
+                }
+                else
+                {
+                    probes->UnhealthyRegions.Add(region);
+                }
+                bIsLast = --probes->Remaining == 0;
+            }
+
+            if (bIsLast)
+            {
+                OnProbesComplete(*probes);
+            }
+        });
+        httpRequest->ProcessRequest();
+    }
+}
+
+void FAwsGameKitRegionSelector::OnProbesComplete(const FProbes& Probes)
+{
+    FString bestRegion;
+    double bestLatencySeconds = TNumericLimits<double>::Max();
+    for (const TPair<FString, double>& region : Probes.LatencySeconds)
+    {
+        if (!Probes.UnhealthyRegions.Contains(region.Key) && region.Value < bestLatencySeconds)
+        {
+            bestRegion = region.Key;
+            bestLatencySeconds = region.Value;
+        }
+    }
+
+    bool bApply = false;
+    {
+        FScopeLock lock(&Mutex);
+        if (Probes.Generation != CurrentGeneration)
+        {
+            return;
+        }
+
+        if (bestRegion.IsEmpty())
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitRegionSelector: No region is healthy, keeping %s"), *ActiveRegion);
+            return;
+        }
+
+        UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitRegionSelector: %s has the lowest latency, %.1f ms"), *bestRegion, bestLatencySeconds * 1000.0);
+        if (bestRegion == ActiveRegion)
+        {
+            PendingRegion.Reset();
+        }
+        else if (LoggedInPlayers.Num() > 0)
+        {
+            // The players' tokens were issued by the active region
+            UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitRegionSelector: Switching from %s to %s once the players log out"), *ActiveRegion, *bestRegion);
+            PendingRegion = bestRegion;
+        }
+        else
+        {
+            bApply = true;
+        }
+    }
+
+    // Loading the settings parses the config, off the thread the HTTP module completes requests on
+    if (bApply)
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread([this, bestRegion]
+        {
+            ApplyRegion(bestRegion);
+        });
+    }
+
+    AsyncTask(ENamedThreads::GameThread, [this, bestRegion, bestLatencySeconds]
+    {
+        RegionSelectedDelegate.Broadcast(bestRegion, bestLatencySeconds * 1000.0);
+    });
+}
+
+void FAwsGameKitRegionSelector::ApplyRegion(const FString& Region)
+{
+    AwsGameKitSessionManagerWrapper* wrapper;
+    GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE instance;
+    {
+        FScopeLock lock(&Mutex);
+        wrapper = Wrapper;
+        instance = Instance;
+    }
+    if (wrapper == nullptr)
+    {
+        return;
+    }
+
+    const FString contents = MakeRegionalClientConfig(wrapper->GetLoadedClientConfigContents(), Region);
+    if (contents.IsEmpty())
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitRegionSelector: %s is no longer listed in the config"), *Region);
+        return;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitRegionSelector: Loading the settings of %s"), *Region);
+    wrapper->GameKitSessionManagerReloadConfigContents(instance, TCHAR_TO_UTF8(*contents));
+
+    FScopeLock lock(&Mutex);
+    ActiveRegion = Region;
+}
+
+void FAwsGameKitRegionSelector::ParseClientConfig(const FString& ClientConfigContents, TMap<FString, FString>& OutSettings, TMap<FString, TMap<FString, FString>>& OutRegionalSettings)
+{
+    OutSettings.Reset();
+    OutRegionalSettings.Reset();
+
+    TArray<FString> lines;
+    ClientConfigContents.ParseIntoArrayLines(lines);
+    for (const FString& line : lines)
+    {
+        FString key;
+        FString value;
+        if (line.StartsWith(TEXT("#")) || line.StartsWith(TEXT("---")) || !line.Split(TEXT(":"), &key, &value))
+        {
+            continue;
+        }
+
+        key.TrimStartAndEndInline();
+        value.TrimStartAndEndInline();
+        FString region;
+        FString regionalKey;
+        if (key.Split(REGION_KEY_SEPARATOR, &region, &regionalKey))
+        {
+            OutRegionalSettings.FindOrAdd(region).Add(regionalKey, value);
+        }
+        else if (!key.IsEmpty())
+        {
+            OutSettings.Add(key, value);
+        }
+    }
+}
+
+TArray<FString> FAwsGameKitRegionSelector::GetCandidateRegions(const FString& ClientConfigContents)
+{
+    TMap<FString, FString> settings;
+    TMap<FString, TMap<FString, FString>> regionalSettings;
+    ParseClientConfig(ClientConfigContents, settings, regionalSettings);
+
+    // A region missing a feature would mix its settings with those of another region
+    TSet<FString> keys;
+    for (const TPair<FString, TMap<FString, FString>>& region : regionalSettings)
+    {
+        for (const TPair<FString, FString>& setting : region.Value)
+        {
+            keys.Add(setting.Key);
+        }
+    }
+
+    TArray<FString> regions;
+    for (const TPair<FString, TMap<FString, FString>>& region : regionalSettings)
+    {
+        if (region.Value.Num() == keys.Num())
+        {
+            regions.Add(region.Key);
+        }
+    }
+    regions.Sort();
+    return regions;
+}
+
+FString FAwsGameKitRegionSelector::MakeRegionalClientConfig(const FString& ClientConfigContents, const FString& Region)
+{
+    TMap<FString, FString> settings;
+    TMap<FString, TMap<FString, FString>> regionalSettings;
+    ParseClientConfig(ClientConfigContents, settings, regionalSettings);
+    const TMap<FString, FString>* regionSettings = regionalSettings.Find(Region);
+    if (regionSettings == nullptr)
+    {
+        return FString();
+    }
+
+    // Replace the values line by line, so that comments and any setting injected at load time, such as ca_cert_file, are kept
+    TSet<FString> replacedKeys;
+    TArray<FString> lines;
+    ClientConfigContents.ParseIntoArrayLines(lines, false);
+    FString result;
+    result.Reserve(ClientConfigContents.Len());
+    for (const FString& line : lines)
+    {
+        FString key;
+        FString value;
+        const FString* regionalValue = nullptr;
+        if (!line.StartsWith(TEXT("#")) && line.Split(TEXT(":"), &key, &value))
+        {
+            key.TrimStartAndEndInline();
+            regionalValue = regionSettings->Find(key);
+        }
+
+        if (regionalValue != nullptr)
+        {
+            result.Append(key).Append(TEXT(": ")).Append(*regionalValue).Append(TEXT("\n"));
+            replacedKeys.Add(key);
+        }
+        else
+        {
+            result.Append(line).Append(TEXT("\n"));
+        }
+    }
+
+    for (const TPair<FString, FString>& setting : *regionSettings)
+    {
+        if (!replacedKeys.Contains(setting.Key))
+        {
+            result.Append(setting.Key).Append(TEXT(": ")).Append(setting.Value).Append(TEXT("\n"));
+        }
+    }
+    return result;
+}
+
+FString FAwsGameKitRegionSelector::SetRegionalSettings(const FString& ClientConfigContents, const TMap<FString, TMap<FString, FString>>& RegionalSettings)
+{
+    TArray<FString> lines;
+    ClientConfigContents.ParseIntoArrayLines(lines, false);
+
+    // Drop the previous block, and the empty lines it leaves at the end
+    FString result;
+    result.Reserve(ClientConfigContents.Len());
+    for (const FString& line : lines)
+    {
+        FString key;
+        if (line.StartsWith(REGIONAL_SETTINGS_COMMENT) || (!line.StartsWith(TEXT("#")) && line.Split(TEXT(":"), &key, nullptr) && key.Contains(REGION_KEY_SEPARATOR)))
+        {
+            continue;
+        }
+        result.Append(line).Append(TEXT("\n"));
+    }
+    result.TrimEndInline();
+    result.Append(TEXT("\n"));
+
+    if (RegionalSettings.Num() == 0)
+    {
+        return result;
+    }
+
+    TArray<FString> regions;
+    RegionalSettings.GetKeys(regions);
+    regions.Sort();
+
+    result.Append(TEXT("\n")).Append(REGIONAL_SETTINGS_COMMENT).Append(TEXT("\n"));
+    for (const FString& region : regions)
+    {
+        TArray<FString> keys;
+        RegionalSettings[region].GetKeys(keys);
+        keys.Sort();
+        for (const FString& key : keys)
+        {
+            result.Append(region).Append(REGION_KEY_SEPARATOR).Append(key).Append(TEXT(": ")).Append(RegionalSettings[region][key]).Append(TEXT("\n"));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,217 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitSessionBootstrap.h"
+
+// GameKit
+#include "Achievements/AwsGameKitAchievements.h"
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Core/AwsGameKitDispatcher.h"
+#include "GameSaving/AwsGameKitGameSavingInternal.h"
+#include "GameSaving/AwsGameKitGameSavingSlotIndex.h"
+#include "GameSaving/AwsGameKitGameSavingWrapper.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayData.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitSessionBootstrapGetUser(
+    TEXT("GameKit.SessionBootstrap.GetUser"),
+    0,
+    TEXT("1 fetches the player's profile after login, see FAwsGameKitSessionBootstrap.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitSessionBootstrapListAchievements(
+    TEXT("GameKit.SessionBootstrap.ListAchievements"),
+    0,
+    TEXT("1 lists the achievements after login, unless the cached list is up to date, see FAwsGameKitSessionBootstrap.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarGameKitSessionBootstrapBundles(
+    TEXT("GameKit.SessionBootstrap.Bundles"),
+    TEXT(""),
+    TEXT("Comma-separated names of the bundles read after login, see FAwsGameKitSessionBootstrap.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitSessionBootstrapSlotSyncStatuses(
+    TEXT("GameKit.SessionBootstrap.SlotSyncStatuses"),
+    0,
+    TEXT("1 calls GetAllSlotSyncStatuses() after login, see FAwsGameKitSessionBootstrap.\n"),
+    ECVF_Default);
+
+namespace
+{
+    TArray<FString> GetBootstrapBundles()
+    {
+        TArray<FString> bundleNames;
+        CVarGameKitSessionBootstrapBundles.GetValueOnAnyThread().ParseIntoArray(bundleNames, TEXT(","), true);
+        for (FString& bundleName : bundleNames)
+        {
+            bundleName.TrimStartAndEndInline();
+        }
+        bundleNames.RemoveAll([](const FString& bundleName) { return bundleName.IsEmpty(); });
+        return bundleNames;
+    }
+
+    IntResult GetAllSlotSyncStatusesBlocking()
+    {
+        const GameSavingLibrary& gameSavingLibrary = FAwsGameKitRuntimeModule::Get().GetGameSavingLibrary();
+        InternalAwsGameKitFlushLocalSlots(gameSavingLibrary);
+
+        unsigned int statusCallStatus = GameKit::GAMEKIT_SUCCESS;
+        auto dispatcher = [&](const Slot* slots, unsigned int slotCount, bool complete, unsigned int callStatus)
+        {
+            statusCallStatus = callStatus;
+            if (callStatus == GameKit::GAMEKIT_SUCCESS)
+            {
+                FAwsGameKitGameSavingSlotIndex::Get().Update(slots, slotCount);
+            }
+        };
+        typedef LambdaDispatcher<decltype(dispatcher), void, const Slot*, unsigned int, bool, unsigned int> Dispatcher;
+
+        const bool shouldWaitForAllPages = true;
+        const unsigned int defaultPageSize = GameKit::GameSaving::Wrapper::GetAllSlotSyncStatusesDefaultPageSize;
+        gameSavingLibrary.GameSavingWrapper->GameKitGetAllSlotSyncStatuses(gameSavingLibrary.GameSavingInstanceHandle, &dispatcher, Dispatcher::Dispatch, shouldWaitForAllPages, defaultPageSize);
+        return IntResult(statusCallStatus);
+    }
+}
+
+FAwsGameKitSessionBootstrap& FAwsGameKitSessionBootstrap::Get()
+{
+    static FAwsGameKitSessionBootstrap Instance;
+    return Instance;
+}
+
+bool FAwsGameKitSessionBootstrap::IsEnabled()
+{
+    return CVarGameKitSessionBootstrapGetUser.GetValueOnAnyThread() != 0
+        || CVarGameKitSessionBootstrapListAchievements.GetValueOnAnyThread() != 0
+        || CVarGameKitSessionBootstrapSlotSyncStatuses.GetValueOnAnyThread() != 0
+        || GetBootstrapBundles().Num() > 0;
+}
+
+void FAwsGameKitSessionBootstrap::OnLogin()
+{
+    uint32 Generation = 0;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Generation = ++CurrentGeneration;
+    }
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    InternalAwsGameKitRunLambdaOnWorkThread([this, Generation, StartTime]
+    {
+        Run(Generation, StartTime);
+    });
+}
+
+void FAwsGameKitSessionBootstrap::Clear()
+{
+    FScopeLock ScopeLock(&Mutex);
+    ++CurrentGeneration;
+}
+
+bool FAwsGameKitSessionBootstrap::IsCurrent(uint32 Generation)
+{
+    FScopeLock ScopeLock(&Mutex);
+    return Generation == CurrentGeneration;
+}
+
+void FAwsGameKitSessionBootstrap::Run(uint32 Generation, double StartTime)
+{
+    TArray<FString> stepNames;
+    TArray<TFunction<IntResult()>> steps;
+    if (CVarGameKitSessionBootstrapGetUser.GetValueOnAnyThread() != 0)
+    {
+        stepNames.Add(TEXT("GetUser"));
+        steps.Add([]
+        {
+            FGetUserResponse response;
+            return FAwsGameKitIdentityUserCache::Get().GetUser(response);
+        });
+    }
+    if (CVarGameKitSessionBootstrapListAchievements.GetValueOnAnyThread() != 0)
+    {
+        stepNames.Add(TEXT("ListAchievements"));
+        steps.Add([]
+        {
+            FAchievementSummary summary;
+            return AwsGameKitAchievements::GetAchievementSummaryBlocking(summary);
+        });
+    }
+    const TArray<FString> bundleNames = GetBootstrapBundles();
+    if (bundleNames.Num() > 0)
+    {
+        stepNames.Add(TEXT("GetBundles"));
+        steps.Add([bundleNames]
+        {
+            TArray<FUserGameplayDataBundle> bundles;
+            return AwsGameKitUserGameplayData::GetBundlesBlocking(bundleNames, bundles);
+        });
+    }
+    if (CVarGameKitSessionBootstrapSlotSyncStatuses.GetValueOnAnyThread() != 0)
+    {
+        stepNames.Add(TEXT("GetAllSlotSyncStatuses"));
+        steps.Add(&GetAllSlotSyncStatusesBlocking);
+    }
+    if (steps.Num() == 0)
+    {
+        return;
+    }
+
+    FAwsGameKitSessionReady sessionReady;
+    sessionReady.Status = IntResult(GameKit::GAMEKIT_SUCCESS);
+    sessionReady.Steps.SetNum(steps.Num());
+    FAwsGameKitWorkerPool::Get().ParallelFor(steps.Num(), steps.Num(), [&](int32 index)
+    {
+        // A logout in the meantime makes the remaining reads fail with GAMEKIT_ERROR_NO_ID_TOKEN, nobody waits for them
+        if (!IsCurrent(Generation))
+        {
+            return;
+        }
+
+        const double stepStartTime = FPlatformTime::Seconds();
+        FAwsGameKitSessionBootstrapStep& step = sessionReady.Steps[index];
+        step.Name = stepNames[index];
+        step.Status = steps[index]();
+        step.DurationMs = (FPlatformTime::Seconds() - stepStartTime) * 1000.0;
+    });
+
+    if (!IsCurrent(Generation))
+    {
+        return;
+    }
+
+    for (const FAwsGameKitSessionBootstrapStep& step : sessionReady.Steps)
+    {
+        if (step.Status.Result != GameKit::GAMEKIT_SUCCESS)
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionBootstrap::Run(): %s failed with %s"), *step.Name, *GameKit::StatusCodeToHexFStr(step.Status.Result));
+            if (sessionReady.Status.Result == GameKit::GAMEKIT_SUCCESS)
+            {
+                sessionReady.Status = step.Status;
+            }
+        }
+    }
+    sessionReady.DurationMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitSessionBootstrap::Run(): Session ready in %.0f ms (%d steps)"), sessionReady.DurationMs, sessionReady.Steps.Num());
+
+    FAwsGameKitCompletionQueue::Get().Enqueue([this, Generation, sessionReady = MoveTemp(sessionReady)]
+    {
+        if (IsCurrent(Generation))
+        {
+            SessionReadyDelegate.Broadcast(sessionReady);
+        }
+    });
+}
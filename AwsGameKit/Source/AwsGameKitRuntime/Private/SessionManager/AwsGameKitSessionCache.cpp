@@ -0,0 +1,337 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitSessionCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "SessionManager/AwsGameKitSessionManager.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+
+// Unreal
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformCrypto.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<float> CVarGameKitSessionCacheMaxAgeHours(
+    TEXT("GameKit.SessionCache.MaxAgeHours"),
+    720.0f,
+    TEXT("Age in hours after which the session cached by FAwsGameKitSessionCache is dropped instead of restored. 0 for no limit.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // "GKSESS", a format version, then the nonce
+    const uint8 HEADER_MAGIC[] = { 'G', 'K', 'S', 'E', 'S', 'S' };
+    const uint8 HEADER_VERSION = 1;
+    const int32 NONCE_SIZE = 12;
+    const int32 HEADER_SIZE = sizeof(HEADER_MAGIC) + 1 + NONCE_SIZE;
+    const int32 TAG_SIZE = 16;
+    const int32 KEY_SIZE = 32;
+
+    // Layout: the time the tokens were cached, then the number of tokens and each token's type and value
+    TArray<uint8> SerializeTokens(const TMap<TokenType_E, FString>& Tokens)
+    {
+        TArray<uint8> contents;
+        FMemoryWriter writer(contents);
+        int64 cachedAt = FDateTime::UtcNow().ToUnixTimestamp();
+        int32 count = Tokens.Num();
+        writer << cachedAt << count;
+        for (const TPair<TokenType_E, FString>& token : Tokens)
+        {
+            uint8 tokenType = static_cast<uint8>(token.Key);
+            writer << tokenType << const_cast<FString&>(token.Value);
+        }
+        return contents;
+    }
+
+    bool DeserializeTokens(const TArray<uint8>& Contents, int64& OutCachedAt, TMap<TokenType_E, FString>& OutTokens)
+    {
+        FMemoryReader reader(Contents);
+        int32 count = 0;
+        reader << OutCachedAt << count;
+        for (int32 i = 0; i < count && !reader.IsError(); ++i)
+        {
+            uint8 tokenType = 0;
+            FString value;
+            reader << tokenType << value;
+            if (tokenType <= static_cast<uint8>(TokenType_E::IamSessionToken))
+            {
+                OutTokens.Add(static_cast<TokenType_E>(tokenType), MoveTemp(value));
+            }
+        }
+        return !reader.IsError();
+    }
+
+    bool Encrypt(const TArray<uint8>& Key, const TArray<uint8>& Data, TArray<uint8>& OutPayload)
+    {
+        uint8 nonce[NONCE_SIZE];
+        TUniquePtr<FEncryptionContext> context = IPlatformCrypto::Get().CreateContext();
+        if (!context.IsValid() || context->CreateRandomBytes(TArrayView<uint8>(nonce, NONCE_SIZE)) != EPlatformCryptoResult::Success)
+        {
+            return false;
+        }
+
+        TUniquePtr<IPlatformCryptoEncryptor> encryptor = context->CreateEncryptor_AES_256_GCM(Key, TArrayView<const uint8>(nonce, NONCE_SIZE));
+        if (!encryptor.IsValid())
+        {
+            return false;
+        }
+
+        // GCM doesn't pad, the slack only satisfies the cipher's output size checks
+        const int32 slack = encryptor->GetCipherBlockSizeBytes() + encryptor->GetFinalizeBufferSizeBytes();
+        OutPayload.Reset(HEADER_SIZE + Data.Num() + slack + TAG_SIZE);
+        OutPayload.Append(HEADER_MAGIC, sizeof(HEADER_MAGIC));
+        OutPayload.Add(HEADER_VERSION);
+        OutPayload.Append(nonce, NONCE_SIZE);
+        OutPayload.AddUninitialized(Data.Num() + slack);
+
+        const TArrayView<uint8> output(OutPayload.GetData() + HEADER_SIZE, Data.Num() + slack);
+        int32 written = 0;
+        int32 finalWritten = 0;
+        if (encryptor->Update(Data, output, written) != EPlatformCryptoResult::Success
+            || encryptor->Finalize(output.Slice(written, output.Num() - written), finalWritten) != EPlatformCryptoResult::Success)
+        {
+            return false;
+        }
+
+        const int32 encryptedSize = written + finalWritten;
+        OutPayload.SetNum(HEADER_SIZE + encryptedSize + TAG_SIZE, false);
+        int32 tagWritten = 0;
+        return encryptor->GenerateAuthTag(TArrayView<uint8>(OutPayload.GetData() + HEADER_SIZE + encryptedSize, TAG_SIZE), tagWritten) == EPlatformCryptoResult::Success
+            && tagWritten == TAG_SIZE;
+    }
+
+    bool Decrypt(const TArray<uint8>& Key, const TArray<uint8>& Payload, TArray<uint8>& OutData)
+    {
+        if (Payload.Num() < HEADER_SIZE + TAG_SIZE || FMemory::Memcmp(Payload.GetData(), HEADER_MAGIC, sizeof(HEADER_MAGIC)) != 0 || Payload[sizeof(HEADER_MAGIC)] != HEADER_VERSION)
+        {
+            return false;
+        }
+
+        const TArrayView<const uint8> payload(Payload);
+        const TArrayView<const uint8> nonce = payload.Slice(HEADER_SIZE - NONCE_SIZE, NONCE_SIZE);
+        const TArrayView<const uint8> tag = payload.Slice(Payload.Num() - TAG_SIZE, TAG_SIZE);
+        const TArrayView<const uint8> encrypted = payload.Slice(HEADER_SIZE, Payload.Num() - HEADER_SIZE - TAG_SIZE);
+
+        TUniquePtr<FEncryptionContext> context = IPlatformCrypto::Get().CreateContext();
+        TUniquePtr<IPlatformCryptoDecryptor> decryptor = context.IsValid() ? context->CreateDecryptor_AES_256_GCM(Key, nonce, tag) : nullptr;
+        if (!decryptor.IsValid())
+        {
+            return false;
+        }
+
+        const int32 slack = decryptor->GetCipherBlockSizeBytes() + decryptor->GetFinalizeBufferSizeBytes();
+        OutData.SetNumUninitialized(encrypted.Num() + slack);
+
+        // Finalize() fails if the authentication tag doesn't match
+        int32 written = 0;
+        int32 finalWritten = 0;
+        if (decryptor->Update(encrypted, TArrayView<uint8>(OutData), written) != EPlatformCryptoResult::Success
+            || decryptor->Finalize(TArrayView<uint8>(OutData).Slice(written, OutData.Num() - written), finalWritten) != EPlatformCryptoResult::Success)
+        {
+            FMemory::Memzero(OutData.GetData(), OutData.Num());
+            OutData.Reset();
+            return false;
+        }
+
+        OutData.SetNum(written + finalWritten, false);
+        return true;
+    }
+}
+
+FAwsGameKitSessionCache& FAwsGameKitSessionCache::Get()
+{
+    static FAwsGameKitSessionCache Instance;
+    return Instance;
+}
+
+void FAwsGameKitSessionCache::SetKeyProvider(FKeyProvider Provider)
+{
+    FScopeLock ScopeLock(&Mutex);
+    KeyProvider = MoveTemp(Provider);
+}
+
+bool FAwsGameKitSessionCache::IsEnabled()
+{
+    FScopeLock ScopeLock(&Mutex);
+    return static_cast<bool>(KeyProvider);
+}
+
+FString FAwsGameKitSessionCache::GetCacheFilePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AwsGameKit"), TEXT("SessionCache.bin"));
+}
+
+bool FAwsGameKitSessionCache::GetKey(TArray<uint8>& OutKey)
+{
+    FKeyProvider provider;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        provider = KeyProvider;
+    }
+
+    if (!provider || !provider(OutKey))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionCache: No key for the session cache"));
+        return false;
+    }
+
+    if (OutKey.Num() != KEY_SIZE)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("FAwsGameKitSessionCache: The key is %d bytes, AES-256 needs %d"), OutKey.Num(), KEY_SIZE);
+        FMemory::Memzero(OutKey.GetData(), OutKey.Num());
+        return false;
+    }
+
+    return true;
+}
+
+bool FAwsGameKitSessionCache::Restore()
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    TArray<uint8> key;
+    ON_SCOPE_EXIT { FMemory::Memzero(key.GetData(), key.Num()); };
+    TArray<uint8> payload;
+    if (!FFileHelper::LoadFileToArray(payload, *GetCacheFilePath(), FILEREAD_Silent) || !GetKey(key))
+    {
+        return false;
+    }
+
+    TArray<uint8> contents;
+    ON_SCOPE_EXIT { FMemory::Memzero(contents.GetData(), contents.Num()); };
+    int64 cachedAt = 0;
+    TMap<TokenType_E, FString> cachedTokens;
+    if (!Decrypt(key, payload, contents) || !DeserializeTokens(contents, cachedAt, cachedTokens))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionCache: Ignoring a session cache which is malformed or was encrypted with another key"));
+        return false;
+    }
+
+    const int64 now = FDateTime::UtcNow().ToUnixTimestamp();
+    const float maxAgeHours = CVarGameKitSessionCacheMaxAgeHours.GetValueOnAnyThread();
+    if (maxAgeHours > 0.0f && now - cachedAt > maxAgeHours * 3600.0f)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitSessionCache: Dropping a session cached %lld hours ago"), (now - cachedAt) / 3600);
+        Clear();
+        return false;
+    }
+
+    // Tokens which expired can't be used until they are refreshed
+    FAwsGameKitSessionTokenRefresher& refresher = FAwsGameKitSessionTokenRefresher::Get();
+    const bool canRefresh = refresher.HasRefreshHandler();
+    TArray<TokenType_E> restoredTypes;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        for (const TPair<TokenType_E, FString>& token : cachedTokens)
+        {
+            const int64 expiresAt = FAwsGameKitSessionTokenRefresher::GetTokenExpiry(token.Value);
+            if (expiresAt != 0 && expiresAt <= now && !canRefresh)
+            {
+                continue;
+            }
+
+            // Recorded first, so setting the token below doesn't write the file again
+            Tokens.Add(token.Key, token.Value);
+            restoredTypes.Add(token.Key);
+        }
+    }
+
+    for (const TokenType_E tokenType : restoredTypes)
+    {
+        AwsGameKitSessionManager::SetToken(tokenType, cachedTokens[tokenType]);
+        if (canRefresh)
+        {
+            refresher.RequestRefresh(tokenType);
+        }
+    }
+
+    for (TPair<TokenType_E, FString>& token : cachedTokens)
+    {
+        FMemory::Memzero(token.Value.GetCharArray().GetData(), token.Value.GetCharArray().Num() * sizeof(TCHAR));
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitSessionCache: Restored %d tokens cached %lld seconds ago%s"),
+        restoredTypes.Num(), now - cachedAt, canRefresh ? TEXT(", validating them in the background") : TEXT(""));
+    return restoredTypes.Num() > 0;
+}
+
+void FAwsGameKitSessionCache::OnTokenSet(TokenType_E TokenType, const FString& Value)
+{
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (!KeyProvider)
+        {
+            return;
+        }
+
+        const FString* cached = Tokens.Find(TokenType);
+        if (cached != nullptr && cached->Equals(Value, ESearchCase::CaseSensitive))
+        {
+            return;
+        }
+        Tokens.Add(TokenType, Value);
+    }
+
+    InternalAwsGameKitRunLambdaOnWorkThread([this]
+    {
+        Persist();
+    });
+}
+
+void FAwsGameKitSessionCache::Clear()
+{
+    FScopeLock FileScopeLock(&FileMutex);
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Tokens.Reset();
+    }
+    IFileManager::Get().Delete(*GetCacheFilePath(), false, false, true);
+}
+
+void FAwsGameKitSessionCache::Persist()
+{
+    FScopeLock FileScopeLock(&FileMutex);
+
+    TArray<uint8> contents;
+    ON_SCOPE_EXIT { FMemory::Memzero(contents.GetData(), contents.Num()); };
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (Tokens.Num() == 0 || !KeyProvider)
+        {
+            // Cleared or disabled since the token was set
+            return;
+        }
+        contents = SerializeTokens(Tokens);
+    }
+
+    TArray<uint8> key;
+    ON_SCOPE_EXIT { FMemory::Memzero(key.GetData(), key.Num()); };
+    TArray<uint8> payload;
+    if (!GetKey(key) || !Encrypt(key, contents, payload))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionCache: Could not encrypt the session, it isn't cached"));
+        return;
+    }
+
+    // The previous file is only replaced once the new one is complete, an interrupted write leaves it intact
+    const FString FilePath = GetCacheFilePath();
+    const FString TempFilePath = FilePath + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(payload, *TempFilePath) || !IFileManager::Get().Move(*FilePath, *TempFilePath, true, true, false, true))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionCache: Failed to write %s"), *FilePath);
+        IFileManager::Get().Delete(*TempFilePath, false, false, true);
+    }
+}
@@ -6,7 +6,13 @@
 // GameKit
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
 #include "Models/AwsGameKitEnumConverter.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+#include "SessionManager/AwsGameKitSessionCache.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+#include "SessionManager/AwsGameKitTransport.h"
 
 // Unreal
 #include "Async/Async.h"
@@ -14,27 +20,67 @@
 
 SessionManagerLibrary AwsGameKitSessionManager::GetSessionManagerLibraryFromModule()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitIdentity::GetIdentityLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    return runtimeModule->GetSessionManagerLibrary();
+    return FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 }
 
 void AwsGameKitSessionManager::ReloadConfig()
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
     sessionManagerLibrary.SessionManagerWrapper->ReloadConfig(sessionManagerLibrary.SessionManagerInstanceHandle);
+    FAwsGameKitRegionSelector::Get().OnConfigLoaded(sessionManagerLibrary.SessionManagerWrapper.Get(), sessionManagerLibrary.SessionManagerInstanceHandle);
+}
+
+void AwsGameKitSessionManager::ReloadConfigAsync(TAwsGameKitDelegateParam<const FAwsGameKitLoadedFeatureSettings&> OnCompleteDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("SessionManager", "ReloadConfig");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        ReloadConfig();
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, GetLoadedFeatureSettings());
+    });
+}
+
+void AwsGameKitSessionManager::SetTransportSettings(const FAwsGameKitTransportSettings& transportSettings)
+{
+    FAwsGameKitTransport::Get().SetSettings(transportSettings);
+}
+
+FAwsGameKitTransportSettings AwsGameKitSessionManager::GetTransportSettings()
+{
+    return FAwsGameKitTransport::Get().GetSettings();
 }
 
 bool AwsGameKitSessionManager::AreSettingsLoaded(FeatureType_E featureType)
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
-    return sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
+    return GetLoadedFeatureSettings().IsLoaded(AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
+}
+
+FAwsGameKitLoadedFeatureSettings AwsGameKitSessionManager::GetLoadedFeatureSettings()
+{
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    return sessionManagerLibrary.SessionManagerWrapper->GetLoadedFeatureSettings(sessionManagerLibrary.SessionManagerInstanceHandle);
 }
 
 void AwsGameKitSessionManager::SetToken(TokenType_E tokenType, FString value)
 {
-    SessionManagerLibrary sessionManagerLibrary = GetSessionManagerLibraryFromModule();
+    const SessionManagerLibrary& sessionManagerLibrary = GetSessionManagerLibraryFromModule();
     sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerSetToken(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertTokenTypeEnum(tokenType), TCHAR_TO_UTF8(*value));
+    FAwsGameKitSessionTokenRefresher::Get().OnTokenSet(tokenType, value);
+    FAwsGameKitSessionCache::Get().OnTokenSet(tokenType, value);
+    FAwsGameKitIdentityUserCache::Get().Invalidate();
+}
+
+void AwsGameKitSessionManager::SetTokenRefreshHandler(TFunction<bool(TokenType_E tokenType, FString& outNewToken)>&& refreshHandler)
+{
+    FAwsGameKitSessionTokenRefresher::Get().SetRefreshHandler(MoveTemp(refreshHandler));
+}
+
+void AwsGameKitSessionManager::SetTokenRefreshedDelegate(TAwsGameKitDelegateParam<TokenType_E, const IntResult&> tokenRefreshedDelegate)
+{
+    FAwsGameKitSessionTokenRefresher::Get().SetTokenRefreshedDelegate(tokenRefreshedDelegate);
 }
 
 FString AwsGameKitSessionManager::FeatureTypeToApiString(FeatureType_E featureType)
@@ -6,8 +6,13 @@
 // GameKit
 #include "AwsGameKitCore.h"
 #include "AwsGameKitRuntime.h"
+#include "Common/AwsGameKitWarmUp.h"
 #include "Core/AwsGameKitErrors.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
 #include "Models/AwsGameKitEnumConverter.h"
+#include "SessionManager/AwsGameKitSessionCache.h"
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
 
 // Unreal
 #include "LatentActions.h"
@@ -21,21 +26,22 @@ void UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig(UObject* WorldContex
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig()"));
+    AWSGAMEKIT_TRACE_CALL("SessionManager", "ReloadConfig");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("SessionManager.ReloadConfig"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+            const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
 #if WITH_EDITOR
             // This call is only needed in Editor mode. Packaged builds will load the configuration when the FAwsGameKitRuntimeModule module is loaded.
             sessionManagerLibrary.SessionManagerWrapper->ReloadConfig(sessionManagerLibrary.SessionManagerInstanceHandle);
+            FAwsGameKitRegionSelector::Get().OnConfigLoaded(sessionManagerLibrary.SessionManagerWrapper.Get(), sessionManagerLibrary.SessionManagerInstanceHandle);
 #else
-            UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig(): No-op in non-Editor build."));
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig(): No-op in non-Editor build."));
 #endif
 
             State->Err = FAwsGameKitOperationResult{};
@@ -45,12 +51,37 @@ void UAwsGameKitSessionManagerFunctionLibrary::ReloadConfig(UObject* WorldContex
 
 bool UAwsGameKitSessionManagerFunctionLibrary::AreSettingsLoaded(const FeatureType_E featureType)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::AreSettingsLoaded()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::AreSettingsLoaded()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+    const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
-    return sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerAreSettingsLoaded(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
+    return sessionManagerLibrary.SessionManagerWrapper->GetLoadedFeatureSettings(sessionManagerLibrary.SessionManagerInstanceHandle).IsLoaded(AwsGameKitEnumConverter::ConvertFeatureEnum(featureType));
+}
+
+void UAwsGameKitSessionManagerFunctionLibrary::WarmUp(UObject* WorldContextObject,
+    FLatentActionInfo LatentInfo,
+    const TArray<FeatureType_E>& Features,
+    EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+    FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::WarmUp()"));
+    AWSGAMEKIT_TRACE_CALL("SessionManager", "WarmUp");
+
+    TArray<FeatureType> features;
+    for (const FeatureType_E feature : Features)
+    {
+        features.Add(AwsGameKitEnumConverter::ConvertFeatureEnum(feature));
+    }
+
+    TAwsGameKitInternalActionStatePtr<> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
+    {
+        Action->LaunchThreadedWork(TEXT("SessionManager.WarmUp"), [features, State]
+        {
+            const IntResult result = FAwsGameKitWarmUp::Run(features);
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
 }
 
 void UAwsGameKitSessionManagerFunctionLibrary::SetToken(UObject* WorldContextObject,
@@ -59,17 +90,20 @@ void UAwsGameKitSessionManagerFunctionLibrary::SetToken(UObject* WorldContextObj
     EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::SetToken()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitSessionManagerFunctionLibrary::SetToken()"));
+    AWSGAMEKIT_TRACE_CALL("SessionManager", "SetToken");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([Request, State]
+        Action->LaunchThreadedWork(TEXT("SessionManager.SetToken"), [Request, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            SessionManagerLibrary sessionManagerLibrary = runtimeModule->GetSessionManagerLibrary();
+            const SessionManagerLibrary& sessionManagerLibrary = FAwsGameKitRuntimeModule::Get().GetSessionManagerLibrary();
 
             sessionManagerLibrary.SessionManagerWrapper->GameKitSessionManagerSetToken(sessionManagerLibrary.SessionManagerInstanceHandle, AwsGameKitEnumConverter::ConvertTokenTypeEnum(Request.TokenType), TCHAR_TO_UTF8(*Request.TokenValue));
+            FAwsGameKitSessionTokenRefresher::Get().OnTokenSet(Request.TokenType, Request.TokenValue);
+            FAwsGameKitSessionCache::Get().OnTokenSet(Request.TokenType, Request.TokenValue);
+            FAwsGameKitIdentityUserCache::Get().Invalidate();
             State->Err = FAwsGameKitOperationResult{};
         });
     }
@@ -9,7 +9,11 @@
 
 // Unreal
 #include "HAL/FileManagerGeneric.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
 #if PLATFORM_IOS
 #include "IOS/IOSPlatformFile.h"
 #endif
@@ -19,10 +23,17 @@
 
 #if UE_BUILD_DEVELOPMENT && WITH_EDITOR
 DEFINE_LOG_CATEGORY(LogAwsGameKit);
+DEFINE_LOG_CATEGORY(LogAwsGameKitHotPath);
 #endif
 
 static const FString ClientConfigFile = "awsGameKitClientConfig.yml";
 
+static TAutoConsoleVariable<int32> CVarGameKitSessionManagerSkipUnchangedConfig(
+    TEXT("GameKit.SessionManager.SkipUnchangedConfig"),
+    1,
+    TEXT("If 1, ReloadConfig() doesn't parse awsGameKitClientConfig.yml again while its timestamp, size and hash are unchanged.\n"),
+    ECVF_Default);
+
 AwsGameKitSessionManagerWrapper::~AwsGameKitSessionManagerWrapper()
 {
     Shutdown();
@@ -35,6 +46,7 @@ void AwsGameKitSessionManagerWrapper::importFunctions(void* loadedDllHandle)
     LOAD_PLUGIN_FUNC(GameKitSessionManagerInstanceRelease, loadedDllHandle);
     LOAD_PLUGIN_FUNC(GameKitSessionManagerAreSettingsLoaded, loadedDllHandle);
     LOAD_PLUGIN_FUNC(GameKitSessionManagerReloadConfigFile, loadedDllHandle);
+    LOAD_PLUGIN_FUNC(GameKitSessionManagerReloadConfigContents, loadedDllHandle);
     LOAD_PLUGIN_FUNC(GameKitSessionManagerSetToken, loadedDllHandle);
 }
 
@@ -42,6 +54,7 @@ void AwsGameKitSessionManagerWrapper::importFunctions(void* loadedDllHandle)
 void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const FString& subfolder)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitSessionManagerWrapper::ReloadConfig(%s)"), *subfolder);
+    FScopeLock reloadLock(&reloadMutex);
 
     FFileManagerGeneric fileManager;
     FString src = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir().Append(ToCStr(subfolder + ClientConfigFile)));
@@ -56,7 +69,17 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
     else
     {
         UE_LOG(LogAwsGameKit, Display, TEXT("Copied config from %s to %s"), *src, *dest);
+        FConfigFingerprint fingerprint;
+        if (IsConfigUnchanged(sessionManagerInstance, dest, fingerprint))
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("Config %s is unchanged, not reloading it"), *dest);
+            return;
+        }
+
+        loadedClientConfigFile = dest;
+        loadedClientConfigContents.Reset();
         this->GameKitSessionManagerReloadConfigFile(sessionManagerInstance, TCHAR_TO_UTF8(dest.GetCharArray().GetData()));
+        SetLoadedConfigFingerprint(sessionManagerInstance, fingerprint);
     }
 }
 #endif
@@ -64,6 +87,7 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
 void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance)
 {
     UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitSessionManagerWrapper::ReloadConfig()"));
+    FScopeLock reloadLock(&reloadMutex);
     TArray<FString> results;
     FFileManagerGeneric fileManager;
 
@@ -92,9 +116,22 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
     fileManager.FindFilesRecursive(results, ToCStr(searchPath), ToCStr(clientConfigFileToSearch), true, false, true);
     if (results.Num() > 0)
     {
+        FConfigFingerprint fingerprint;
+        if (IsConfigUnchanged(sessionManagerInstance, results[0], fingerprint))
+        {
+            UE_LOG(LogAwsGameKit, Display, TEXT("Config %s is unchanged, not reloading it"), *results[0]);
+            return;
+        }
+
         UE_LOG(LogAwsGameKit, Display, TEXT("Loading config from %s"), *results[0]);
+        loadedClientConfigFile = results[0];
+        loadedClientConfigContents.Reset();
+
+        // Not set when the config couldn't be passed to the library, so that the next reload tries again
+        bool reloaded = false;
 #if PLATFORM_WINDOWS || PLATFORM_MAC
         this->GameKitSessionManagerReloadConfigFile(sessionManagerInstance, TCHAR_TO_UTF8(*results[0]));
+        reloaded = true;
 #elif PLATFORM_ANDROID
         FString configFileContents;
         if (FFileHelper::LoadFileToString(configFileContents, *results[0], FFileHelper::EHashOptions::None))
@@ -107,7 +144,9 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
             {
                 FString caCertAndroidFilePath = IAndroidPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForRead(*caCertPath);
                 configFileContents.Append("\n").Append("ca_cert_file: ").Append(saveAndroidFilePath).Append("\n");
+                loadedClientConfigContents = configFileContents;
                 this->GameKitSessionManagerReloadConfigContents(sessionManagerInstance, TCHAR_TO_UTF8(configFileContents.GetCharArray().GetData()));
+                reloaded = true;
             }
             else
             {
@@ -127,13 +166,19 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
             FIOSPlatformFile iosPlatformFile = FIOSPlatformFile();
             FString caCertIosFilePath = iosPlatformFile.ConvertToAbsolutePathForExternalAppForRead(*caCertPath);
             configFileContents.Append("\n").Append("ca_cert_file: ").Append(caCertIosFilePath).Append("\n");
+            loadedClientConfigContents = configFileContents;
             this->GameKitSessionManagerReloadConfigContents(sessionManagerInstance, TCHAR_TO_UTF8(*configFileContents));
+            reloaded = true;
         }
         else
         {
             UE_LOG(LogAwsGameKit, Error, TEXT("Could not load config from %s."), *results[0]);
         }
 #endif
+        if (reloaded)
+        {
+            SetLoadedConfigFingerprint(sessionManagerInstance, fingerprint);
+        }
     }
     else
     {
@@ -148,6 +193,7 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
         fileManager.FindFilesRecursive(results, ToCStr(searchPath), ToCStr(clientConfigFileToSearch), true, false, true);
         if (results.Num() > 0)
         {
+            loadedClientConfigFile = results[0];
             FString configFileContents;
             if (FFileHelper::LoadFileToString(configFileContents, *results[0], FFileHelper::EHashOptions::None))
             {
@@ -155,6 +201,7 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
                 FString caCertPath = FString(searchPath + "certs/cacert.pem"); // searchPath ends in foo/content/
                 FString caCertAndroidFilePath = IAndroidPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForRead(*caCertPath);
                 configFileContents.Append("\n").Append("ca_cert_file: ").Append(caCertAndroidFilePath).Append("\n");
+                loadedClientConfigContents = configFileContents;
                 this->GameKitSessionManagerReloadConfigContents(sessionManagerInstance, TCHAR_TO_UTF8(configFileContents.GetCharArray().GetData()));
             }
             else
@@ -173,20 +220,31 @@ void AwsGameKitSessionManagerWrapper::ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTA
 GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE AwsGameKitSessionManagerWrapper::GameKitSessionManagerInstanceCreate(const char* clientConfigFile, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerInstanceCreate, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
-    return INVOKE_FUNC(GameKitSessionManagerInstanceCreate, clientConfigFile, logCb);
+    GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance = INVOKE_FUNC(GameKitSessionManagerInstanceCreate, clientConfigFile, logCb);
+    if (sessionManagerInstance != nullptr)
+    {
+        RefreshLoadedFeatureSettings(sessionManagerInstance);
+    }
+    return sessionManagerInstance;
 }
 
 void AwsGameKitSessionManagerWrapper::GameKitSessionManagerInstanceRelease(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
     INVOKE_FUNC(GameKitSessionManagerInstanceRelease, sessionManagerInstance);
+
+    FScopeLock settingsLock(&instanceSettingsMutex);
+    instanceSettings.Remove(sessionManagerInstance);
 }
 
 bool AwsGameKitSessionManagerWrapper::GameKitSessionManagerAreSettingsLoaded(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, FeatureType featureType)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerAreSettingsLoaded, false);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
     return INVOKE_FUNC(GameKitSessionManagerAreSettingsLoaded, sessionManagerInstance, featureType);
 }
@@ -194,22 +252,123 @@ bool AwsGameKitSessionManagerWrapper::GameKitSessionManagerAreSettingsLoaded(GAM
 void AwsGameKitSessionManagerWrapper::GameKitSessionManagerReloadConfigFile(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const char* clientConfigFile)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerReloadConfigFile);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
+    FScopeLock reloadLock(&reloadMutex);
+    SetLoadedConfigFingerprint(sessionManagerInstance, FConfigFingerprint());
     INVOKE_FUNC(GameKitSessionManagerReloadConfigFile, sessionManagerInstance, clientConfigFile);
+    RefreshLoadedFeatureSettings(sessionManagerInstance);
 }
 
 void AwsGameKitSessionManagerWrapper::GameKitSessionManagerReloadConfigContents(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const char* clientConfigFileContents)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerReloadConfigContents);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
+    FScopeLock reloadLock(&reloadMutex);
+    SetLoadedConfigFingerprint(sessionManagerInstance, FConfigFingerprint());
     INVOKE_FUNC(GameKitSessionManagerReloadConfigContents, sessionManagerInstance, clientConfigFileContents);
+    RefreshLoadedFeatureSettings(sessionManagerInstance);
 }
 
 void AwsGameKitSessionManagerWrapper::GameKitSessionManagerSetToken(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, GameKit::TokenType tokenType, const char* value)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(SessionManager, GameKitSessionManagerSetToken);
+    AWSGAMEKIT_LLM_SCOPE(Identity);
 
     INVOKE_FUNC(GameKitSessionManagerSetToken, sessionManagerInstance, tokenType, value);
 }
 
+FString AwsGameKitSessionManagerWrapper::GetLoadedClientConfigContents() const
+{
+    if (!loadedClientConfigContents.IsEmpty())
+    {
+        return loadedClientConfigContents;
+    }
+
+    FString contents;
+    if (!loadedClientConfigFile.IsEmpty())
+    {
+        FFileHelper::LoadFileToString(contents, *loadedClientConfigFile);
+    }
+    return contents;
+}
+
+FAwsGameKitLoadedFeatureSettings AwsGameKitSessionManagerWrapper::GetLoadedFeatureSettings(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance) const
+{
+    FScopeLock settingsLock(&instanceSettingsMutex);
+    const FInstanceSettings* settings = instanceSettings.Find(sessionManagerInstance);
+    return FAwsGameKitLoadedFeatureSettings{ settings != nullptr ? settings->FeatureBits : 0 };
+}
+
+bool AwsGameKitSessionManagerWrapper::IsConfigUnchanged(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const FString& path, FConfigFingerprint& outFingerprint) const
+{
+    FInstanceSettings loaded;
+    {
+        FScopeLock settingsLock(&instanceSettingsMutex);
+        if (const FInstanceSettings* settings = instanceSettings.Find(sessionManagerInstance))
+        {
+            loaded = *settings;
+        }
+    }
+    const FConfigFingerprint& loadedConfigFingerprint = loaded.ConfigFingerprint;
+
+    IFileManager& fileManager = IFileManager::Get();
+    outFingerprint.Path = path;
+    outFingerprint.Timestamp = fileManager.GetTimeStamp(*path);
+    outFingerprint.Size = fileManager.FileSize(*path);
+
+    const bool sameFile = path == loadedConfigFingerprint.Path && outFingerprint.Size == loadedConfigFingerprint.Size;
+    if (sameFile && outFingerprint.Timestamp == loadedConfigFingerprint.Timestamp)
+    {
+        outFingerprint.Hash = loadedConfigFingerprint.Hash;
+    }
+    else
+    {
+        // Touched or copied again, such as by the editor's environment switch, so compare the contents
+        TArray<uint8> contents;
+        FFileHelper::LoadFileToArray(contents, *path, FILEREAD_Silent);
+        outFingerprint.Hash = FCrc::MemCrc32(contents.GetData(), contents.Num());
+    }
+
+    // Nothing loaded means the last reload failed, so try again
+    return CVarGameKitSessionManagerSkipUnchangedConfig.GetValueOnAnyThread() != 0
+        && sameFile
+        && outFingerprint.Hash == loadedConfigFingerprint.Hash
+        && loaded.FeatureBits != 0;
+}
+
+void AwsGameKitSessionManagerWrapper::SetLoadedConfigFingerprint(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const FConfigFingerprint& fingerprint)
+{
+    if (sessionManagerInstance == nullptr)
+    {
+        return;
+    }
+
+    FScopeLock settingsLock(&instanceSettingsMutex);
+    FInstanceSettings& settings = instanceSettings.FindOrAdd(sessionManagerInstance);
+    settings.ConfigFingerprint = settings.FeatureBits != 0 ? fingerprint : FConfigFingerprint();
+}
+
+void AwsGameKitSessionManagerWrapper::RefreshLoadedFeatureSettings(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance)
+{
+    if (sessionManagerInstance == nullptr)
+    {
+        return;
+    }
+
+    // Built aside and published at once, so readers see the flags of one reload
+    FAwsGameKitLoadedFeatureSettings loaded;
+    for (const FeatureType featureType : { FeatureType::Main, FeatureType::Identity, FeatureType::Authentication, FeatureType::Achievements, FeatureType::GameStateCloudSaving, FeatureType::UserGameplayData })
+    {
+        if (GameKitSessionManagerAreSettingsLoaded(sessionManagerInstance, featureType))
+        {
+            loaded.FeatureBits |= 1u << static_cast<uint32>(featureType);
+        }
+    }
+
+    FScopeLock settingsLock(&instanceSettingsMutex);
+    instanceSettings.FindOrAdd(sessionManagerInstance).FeatureBits = loaded.FeatureBits;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,305 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitSessionTokenRefresher.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Common/AwsGameKitWorkerPool.h"
+#include "SessionManager/AwsGameKitSessionManager.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Base64.h"
+#include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<float> CVarGameKitSessionManagerRefreshLeadSeconds(
+    TEXT("GameKit.SessionManager.RefreshLeadSeconds"),
+    300.0f,
+    TEXT("How long before a token set with SetToken expires FAwsGameKitSessionTokenRefresher refreshes it, in seconds.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitSessionManagerRefreshRetrySeconds(
+    TEXT("GameKit.SessionManager.RefreshRetrySeconds"),
+    30.0f,
+    TEXT("Delay in seconds before a failed token refresh is retried.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitSessionManagerRefreshWaitSeconds(
+    TEXT("GameKit.SessionManager.RefreshWaitSeconds"),
+    10.0f,
+    TEXT("Longest time in seconds a GameKit call waits for the refresh of an expired token before it is sent anyway.\n"),
+    ECVF_Default);
+
+FAwsGameKitSessionTokenRefresher& FAwsGameKitSessionTokenRefresher::Get()
+{
+    static FAwsGameKitSessionTokenRefresher Instance;
+    return Instance;
+}
+
+int64 FAwsGameKitSessionTokenRefresher::GetTokenExpiry(const FString& Token)
+{
+    TArray<FString> parts;
+    if (Token.ParseIntoArray(parts, TEXT("."), false) != 3)
+    {
+        return 0;
+    }
+
+    // Base64url without padding to standard Base64
+    FString payload = parts[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
+    payload.AppendChars(TEXT("=="), (4 - payload.Len() % 4) % 4);
+
+    TArray<uint8> decoded;
+    if (!FBase64::Decode(payload, decoded))
+    {
+        return 0;
+    }
+    decoded.Add(0);
+
+    TSharedPtr<FJsonObject> claims;
+    const TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(UTF8_TO_TCHAR(reinterpret_cast<const char*>(decoded.GetData())));
+    double expiry = 0.0;
+    if (!FJsonSerializer::Deserialize(reader, claims) || !claims.IsValid() || !claims->TryGetNumberField(TEXT("exp"), expiry))
+    {
+        return 0;
+    }
+
+    return static_cast<int64>(expiry);
+}
+
+FAwsGameKitSessionTokenRefresher::FAwsGameKitSessionTokenRefresher() :
+    RefreshDone(FPlatformProcess::GetSynchEventFromPool(true))
+{
+    RefreshDone->Trigger();
+}
+
+FAwsGameKitSessionTokenRefresher::~FAwsGameKitSessionTokenRefresher()
+{
+    FPlatformProcess::ReturnSynchEventToPool(RefreshDone);
+}
+
+void FAwsGameKitSessionTokenRefresher::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitSessionTokenRefresher::Tick), 1.0f);
+}
+
+void FAwsGameKitSessionTokenRefresher::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Tokens.Reset();
+    }
+    SetTokenRefreshedDelegate(FTokenRefreshedDelegate());
+}
+
+void FAwsGameKitSessionTokenRefresher::OnTokenSet(TokenType_E TokenType, const FString& Value)
+{
+    const int64 expiresAt = GetTokenExpiry(Value);
+    const FTokenKey key(FAwsGameKitPlayerScope::GetCurrent(), TokenType);
+
+    FScopeLock ScopeLock(&Mutex);
+    if (expiresAt == 0)
+    {
+        Tokens.Remove(key);
+        return;
+    }
+
+    FTrackedToken& token = Tokens.FindOrAdd(key);
+    token.ExpiresAt = expiresAt;
+    token.NextAttemptAt = 0.0;
+    token.bRefreshRequested = false;
+}
+
+void FAwsGameKitSessionTokenRefresher::RequestRefresh(TokenType_E TokenType)
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (FTrackedToken* token = Tokens.Find(FTokenKey(FAwsGameKitPlayerScope::GetCurrent(), TokenType)))
+    {
+        token->bRefreshRequested = true;
+        token->NextAttemptAt = 0.0;
+    }
+}
+
+bool FAwsGameKitSessionTokenRefresher::HasRefreshHandler()
+{
+    FScopeLock ScopeLock(&Mutex);
+    return RefreshHandler.IsValid();
+}
+
+void FAwsGameKitSessionTokenRefresher::SetRefreshHandler(FRefreshHandler&& Handler)
+{
+    FScopeLock ScopeLock(&Mutex);
+    RefreshHandler = Handler ? MakeShared<FRefreshHandler, ESPMode::ThreadSafe>(MoveTemp(Handler)) : nullptr;
+}
+
+void FAwsGameKitSessionTokenRefresher::SetTokenRefreshedDelegate(const FTokenRefreshedDelegate& Delegate)
+{
+    FScopeLock ScopeLock(&Mutex);
+    TokenRefreshedDelegate = Delegate;
+}
+
+void FAwsGameKitSessionTokenRefresher::WaitForExpiredTokenRefresh()
+{
+    // Fast path for every GameKit call: nothing is being refreshed, or the token being refreshed is still valid
+    if (!bRefreshing.load(std::memory_order_acquire) || FDateTime::UtcNow().ToUnixTimestamp() < RefreshingExpiresAt.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    // Never stall the game thread
+    if (IsInGameThread())
+    {
+        return;
+    }
+
+    const float waitSeconds = CVarGameKitSessionManagerRefreshWaitSeconds.GetValueOnAnyThread();
+    if (!RefreshDone->Wait(FTimespan::FromSeconds(waitSeconds)))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionTokenRefresher: The expired token is still being refreshed after %.1f seconds, sending the call anyway"), waitSeconds);
+    }
+}
+
+void FAwsGameKitSessionTokenRefresher::Clear()
+{
+    ClearPlayer(FAwsGameKitPlayerScope::GetCurrent());
+}
+
+void FAwsGameKitSessionTokenRefresher::ClearPlayer(FAwsGameKitPlayerHandle Player)
+{
+    FScopeLock ScopeLock(&Mutex);
+    for (auto It = Tokens.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Key == Player)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+bool FAwsGameKitSessionTokenRefresher::Tick(float DeltaTime)
+{
+    const int64 now = FDateTime::UtcNow().ToUnixTimestamp();
+    const double nowSeconds = FPlatformTime::Seconds();
+    const float leadSeconds = CVarGameKitSessionManagerRefreshLeadSeconds.GetValueOnGameThread();
+
+    FTokenKey dueKey;
+    int64 dueExpiresAt = 0;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (!RefreshHandler.IsValid() || bRefreshing.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        // The token which expires first is refreshed first
+        for (const TPair<FTokenKey, FTrackedToken>& token : Tokens)
+        {
+            if ((token.Value.bRefreshRequested || now + leadSeconds >= token.Value.ExpiresAt) && nowSeconds >= token.Value.NextAttemptAt && (dueExpiresAt == 0 || token.Value.ExpiresAt < dueExpiresAt))
+            {
+                dueKey = token.Key;
+                dueExpiresAt = token.Value.ExpiresAt;
+            }
+        }
+        if (dueExpiresAt == 0)
+        {
+            return true;
+        }
+
+        RefreshingExpiresAt.store(dueExpiresAt, std::memory_order_release);
+        RefreshDone->Reset();
+        bRefreshing.store(true, std::memory_order_release);
+    }
+
+    Refresh(dueKey, dueExpiresAt);
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitSessionTokenRefresher::Refresh(const FTokenKey& Key, int64 ExpiresAt)
+{
+    const FAwsGameKitPlayerHandle Player = Key.Key;
+    const TokenType_E TokenType = Key.Value;
+
+    TSharedPtr<FRefreshHandler, ESPMode::ThreadSafe> handler;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        handler = RefreshHandler;
+    }
+
+    UE_LOG(LogAwsGameKit, Display, TEXT("FAwsGameKitSessionTokenRefresher: Refreshing token type %d of player %u, which expires in %lld seconds"),
+        static_cast<int32>(TokenType), Player.Id, ExpiresAt - FDateTime::UtcNow().ToUnixTimestamp());
+
+    // A dedicated thread, so that GameKit calls waiting on the worker pool can't hold up the refresh
+    Async(EAsyncExecution::Thread, [this, handler, Key, Player, TokenType, ExpiresAt]
+    {
+        FAwsGameKitWorkerPool::ApplyToCurrentThread();
+        FAwsGameKitPlayerScope PlayerScope(Player);
+
+        FString newToken;
+        bool refreshed = handler.IsValid() && (*handler)(TokenType, newToken) && GetTokenExpiry(newToken) != ExpiresAt;
+        if (refreshed)
+        {
+            // A player released during the refresh would otherwise have its token set on the module's own Session Manager
+            {
+                FScopeLock ScopeLock(&Mutex);
+                refreshed = Tokens.Contains(Key);
+            }
+            if (refreshed)
+            {
+                AwsGameKitSessionManager::SetToken(TokenType, newToken);
+            }
+        }
+        else
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitSessionTokenRefresher: Refreshing token type %d failed, retrying in %.1f seconds"),
+                static_cast<int32>(TokenType), CVarGameKitSessionManagerRefreshRetrySeconds.GetValueOnAnyThread());
+        }
+
+        FTokenRefreshedDelegate delegate;
+        {
+            FScopeLock ScopeLock(&Mutex);
+            FTrackedToken* token = Tokens.Find(Key);
+            if (!refreshed && token != nullptr)
+            {
+                token->NextAttemptAt = FPlatformTime::Seconds() + CVarGameKitSessionManagerRefreshRetrySeconds.GetValueOnAnyThread();
+            }
+            delegate = TokenRefreshedDelegate;
+
+            bRefreshing.store(false, std::memory_order_release);
+            RefreshDone->Trigger();
+        }
+
+        if (delegate.IsBound())
+        {
+            const IntResult result(refreshed ? GameKit::GAMEKIT_SUCCESS : GameKit::GAMEKIT_ERROR_GENERAL);
+            FAwsGameKitCompletionQueue::Get().Enqueue([delegate = MoveTemp(delegate), Player, TokenType, result]
+            {
+                FAwsGameKitPlayerScope PlayerScope(Player);
+                delegate.ExecuteIfBound(TokenType, result);
+            });
+        }
+    });
+}
@@ -0,0 +1,93 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SessionManager/AwsGameKitTransport.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitTrace.h"
+#include "SessionManager/AwsGameKitRegionSelector.h"
+
+// Unreal
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    const TCHAR* BASE_URL_KEY_SUFFIX = TEXT("_base_url");
+
+    // Logged by gamekithelpers.handler_request.log_event()
+    const TCHAR* REQUEST_ID_HEADER = TEXT("X-GameKit-Request-Id");
+}
+
+FAwsGameKitTransport& FAwsGameKitTransport::Get()
+{
+    static FAwsGameKitTransport Instance;
+    return Instance;
+}
+
+void FAwsGameKitTransport::SetSettings(const FAwsGameKitTransportSettings& NewSettings)
+{
+    FScopeLock Lock(&Mutex);
+    Settings = NewSettings;
+}
+
+FAwsGameKitTransportSettings FAwsGameKitTransport::GetSettings() const
+{
+    FScopeLock Lock(&Mutex);
+    return Settings;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FAwsGameKitTransport::CreateRequest() const
+{
+    const FAwsGameKitTransportSettings CurrentSettings = GetSettings();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    if (CurrentSettings.RequestTimeoutSeconds > 0.0f)
+    {
+        HttpRequest->SetTimeout(CurrentSettings.RequestTimeoutSeconds);
+    }
+
+    // Correlates the request with the traced call it's sent for, see FAwsGameKitTrace::GetRequestId()
+    const FString RequestId = FAwsGameKitTrace::GetRequestId(FAwsGameKitTrace::GetContext().CallId);
+    if (!RequestId.IsEmpty())
+    {
+        HttpRequest->SetHeader(REQUEST_ID_HEADER, RequestId);
+    }
+    return HttpRequest;
+}
+
+TArray<FString> FAwsGameKitTransport::GetEndpointHosts(const FString& ClientConfigContents)
+{
+    TArray<FString> Hosts;
+    TArray<FString> Lines;
+    ClientConfigContents.ParseIntoArrayLines(Lines);
+    for (const FString& Line : Lines)
+    {
+        FString Key;
+        FString Value;
+        if (!Line.Split(TEXT(":"), &Key, &Value) || !Key.TrimStartAndEnd().EndsWith(BASE_URL_KEY_SUFFIX))
+        {
+            continue;
+        }
+
+        // Other regions' endpoints are only probed by FAwsGameKitRegionSelector
+        if (Key.Contains(FAwsGameKitRegionSelector::REGION_KEY_SEPARATOR))
+        {
+            continue;
+        }
+
+        Value = Value.TrimStartAndEnd().TrimQuotes();
+        const int32 SchemeEnd = Value.Find(TEXT("://"));
+        if (SchemeEnd == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const int32 PathStart = Value.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+        const FString Host = (PathStart == INDEX_NONE ? Value : Value.Left(PathStart)) + TEXT("/");
+        Hosts.AddUnique(Host);
+    }
+    return Hosts;
+}
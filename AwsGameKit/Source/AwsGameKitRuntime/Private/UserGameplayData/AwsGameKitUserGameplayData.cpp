@@ -8,91 +8,174 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimeInternalHelpers.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitSingleFlight.h"
 #include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitTrace.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
 
 // Unreal
 #include "Async/Async.h"
+#include "Async/Future.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
 #include "Templates/Function.h"
 
-UserGameplayDataLibrary AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()
+// Standard library
+#include <atomic>
+
+namespace
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()"));
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+    // Serializes IncrementBundleItem() on items buffered by the write-behind, which is in memory only
+    FCriticalSection BufferedIncrementMutex;
+
+    // The cache file the game last passed to PersistToCache() or LoadFromCache(), and the path the library uses for it
+    FCriticalSection LastCacheFileMutex;
+    FString LastCacheFile;
+    FString LastLibraryCacheFile;
+
+    // Enqueued calls are retried by the client until they are written, so the cache can reflect them already
+    bool IsWrittenOrEnqueued(const IntResult& result)
+    {
+        return result.Result == GameKit::GAMEKIT_SUCCESS || result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED;
+    }
 
-    return runtimeModule->GetUserGameplayDataLibrary();
+    // Stale entries are served as they are while the circuit breaker is open, until it lets a refresh through as its probe
+    bool BeginCacheRefresh(FAwsGameKitUserGameplayDataCache& cache, const FString& refreshKey)
+    {
+        if (!cache.BeginRefresh(refreshKey))
+        {
+            return false;
+        }
+
+        if (FAwsGameKitUserGameplayDataCircuitBreaker::IsEnabled() && !FAwsGameKitUserGameplayDataCircuitBreaker::Get().TryAcquire())
+        {
+            cache.EndRefresh(refreshKey);
+            return false;
+        }
+
+        return true;
+    }
+}
+
+UserGameplayDataLibrary AwsGameKitUserGameplayData::GetUserGameplayDataLibraryFromModule()
+{
+    return FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 }
 
 void AwsGameKitUserGameplayData::AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
 {
-    InternalAwsGameKitRunLambdaOnWorkThread([=] 
+    AddBundle(FUserGameplayDataBundle(userGameplayDataBundle), ResultDelegate);
+}
+
+void AwsGameKitUserGameplayData::AddBundle(FUserGameplayDataBundle&& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "AddBundle", userGameplayDataBundle.BundleName);
+
+    InternalAwsGameKitRunLambdaOnWorkThread([userGameplayDataBundle = MoveTemp(userGameplayDataBundle), ResultDelegate] 
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
-        int32 pairCount = userGameplayDataBundle.BundleMap.Num();
-        IntResult result;
-
         // Instantiate struct to contain any unprocessed items that may be passed back
         FUserGameplayDataBundle unprocessedBundleItems;
+        IntResult result = AddBundleBlocking(userGameplayDataBundle, unprocessedBundleItems);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(unprocessedBundleItems));
+    });
+}
+
+void AwsGameKitUserGameplayData::AddTrackedBundle(const FAwsGameKitUserGameplayDataTrackedBundleRef& trackedBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "AddTrackedBundle");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([trackedBundle, ResultDelegate]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        FUserGameplayDataBundle unprocessedBundleItems;
+        unprocessedBundleItems.BundleName = trackedBundle->GetBundleName();
 
-        if (pairCount == 0)
+        IntResult result(GameKit::GAMEKIT_SUCCESS);
+        FUserGameplayDataBundle delta;
+        if (trackedBundle->BeginWrite(delta))
         {
-            UE_LOG(LogAwsGameKit, Error, TEXT("UAwsGameKitUserGameplayDataCallableWrapper::AddUserGameplayData - The bundle is empty."));
-            result.Result = GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID;
-            result.ErrorMessage = "The bundle is empty";
+            UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitUserGameplayData::AddTrackedBundle(): Writing %d changed items of %s"), delta.BundleMap.Num(), *delta.BundleName);
+
+            result = AddBundleBlocking(delta, unprocessedBundleItems);
+            trackedBundle->EndWrite(delta, result, unprocessedBundleItems);
         }
-        else
-        {
-            // Preallocate with expected size to prevent pointers becoming invalid
-            // when array expands and data is copied.
-            TArray<std::string> bundleItemKeys;
-            bundleItemKeys.SetNum(pairCount);
-            TArray<const char*> bundleItemKeysChrArray;
-            bundleItemKeysChrArray.SetNum(pairCount);
 
-            TArray<std::string> bundleItemValues;
-            bundleItemValues.SetNum(pairCount);
-            TArray<const char*> bundleItemValuesChrArray;
-            bundleItemValuesChrArray.SetNum(pairCount);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(unprocessedBundleItems));
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::AddBundleBlocking(const FUserGameplayDataBundle& userGameplayDataBundle, FUserGameplayDataBundle& unprocessedBundleItems)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
-            int i = 0;
-            for (auto it = userGameplayDataBundle.BundleMap.begin(); it != userGameplayDataBundle.BundleMap.end(); ++it)
-            {
-                const FString& key = it.Key();
-                const FString& value = it.Value();
+    int32 pairCount = userGameplayDataBundle.BundleMap.Num();
+    IntResult result;
 
-                bundleItemKeys[i] = TCHAR_TO_UTF8(*key);
-                bundleItemValues[i] = TCHAR_TO_UTF8(*value);
+    if (pairCount == 0)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitUserGameplayData::AddBundleBlocking(): The bundle is empty."));
+        result.Result = GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID;
+        result.ErrorMessage = "The bundle is empty";
+        return result;
+    }
 
-                bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-                bundleItemValuesChrArray[i] = bundleItemValues[i].c_str();
+    const uint64 marshallingStartCycle = FPlatformTime::Cycles64();
 
-                i++;
-            }
+    // Size the arena from the inputs first so that every string is converted into one allocation.
+    int32 convertedSize = FAwsGameKitInternalTempStrings::GetConvertedSize(userGameplayDataBundle.BundleName);
+    for (const auto& item : userGameplayDataBundle.BundleMap)
+    {
+        convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(item.Key) + FAwsGameKitInternalTempStrings::GetConvertedSize(item.Value);
+    }
+    FAwsGameKitInternalTempStrings ConvertString;
+    ConvertString.Reserve(convertedSize);
 
-            std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundle.BundleName);
+    TArray<const char*> bundleItemKeysChrArray;
+    bundleItemKeysChrArray.Reserve(pairCount);
+    TArray<const char*> bundleItemValuesChrArray;
+    bundleItemValuesChrArray.Reserve(pairCount);
 
-            // In the case there is an unprocessed item, assign the bundle that it is a part of
-            unprocessedBundleItems.BundleName = bundleName.c_str();
+    for (const auto& item : userGameplayDataBundle.BundleMap)
+    {
+        bundleItemKeysChrArray.Add(ConvertString(item.Key));
+        bundleItemValuesChrArray.Add(ConvertString(item.Value));
+    }
 
-            UserGameplayDataBundle wrapperArgs
-            {
-                bundleName.c_str(),
-                (bundleItemKeysChrArray.GetData()),
-                (bundleItemValuesChrArray.GetData()),
-                size_t(pairCount)
-            };
+    const char* bundleName = ConvertString(userGameplayDataBundle.BundleName);
 
-            result = IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, unprocessedBundleItems.BundleMap, wrapperArgs));
-        }
+    // In the case there is an unprocessed item, assign the bundle that it is a part of
+    unprocessedBundleItems.BundleName = userGameplayDataBundle.BundleName;
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, unprocessedBundleItems);
-    });
+    UserGameplayDataBundle wrapperArgs
+    {
+        bundleName,
+        (bundleItemKeysChrArray.GetData()),
+        (bundleItemValuesChrArray.GetData()),
+        size_t(pairCount)
+    };
+    FAwsGameKitTrace::Phase(EAwsGameKitTracePhase::Marshalling, marshallingStartCycle);
+    FAwsGameKitTrace::AddBytes(convertedSize, 0);
+
+    const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
+    result = IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, unprocessedBundleItems.BundleMap, wrapperArgs));
+    if (IsWrittenOrEnqueued(result) && FAwsGameKitUserGameplayDataCache::IsEnabled())
+    {
+        FAwsGameKitUserGameplayDataCache::Get().StoreItems(cacheGeneration, userGameplayDataBundle, unprocessedBundleItems.BundleMap);
+    }
+
+    return result;
 }
 
 void AwsGameKitUserGameplayData::SetClientSettings(const FUserGameplayDataClientSettings& clientSettings)
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
 
     UserGameplayDataClientSettings settings;
     settings.ClientTimeoutSeconds = clientSettings.ClientTimeoutSeconds;
@@ -104,42 +187,318 @@ void AwsGameKitUserGameplayData::SetClientSettings(const FUserGameplayDataClient
     settings.PaginationSize = clientSettings.PaginationSize;
 
     library.UserGameplayDataWrapper->GameKitSetUserGameplayDataClientSettings(library.UserGameplayDataInstanceHandle, settings);
+    FAwsGameKitUserGameplayDataWriteBehind::Get().SetClientSettings(clientSettings);
 }
 
 void AwsGameKitUserGameplayData::ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "ListBundles");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         TArray<FString> bundles;
         IntResult result(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, bundles));
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundles);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundles));
+    });
+}
+
+void AwsGameKitUserGameplayData::ListBundlesUtf8(TAwsGameKitDelegateParam<const IntResult&, const FAwsGameKitUserGameplayDataUtf8BundleNames&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "ListBundlesUtf8");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+        FGraphEventRef OrderedWorkChain;
+
+        FAwsGameKitUserGameplayDataUtf8BundleNames bundles;
+        IntResult result(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, [&bundles](const char* bundleName)
+        {
+            bundles.Add(bundleName);
+        }));
+        if (result.Result != GameKit::GAMEKIT_SUCCESS)
+        {
+            bundles.Reset();
+        }
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundles));
     });
 }
 
 void AwsGameKitUserGameplayData::GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundle", UserGameplayDataBundleName);
+
+    // Widgets reading the same bundle at once share one request
+    static TAwsGameKitSingleFlight<FUserGameplayDataBundle> getBundleFlights;
+    bool tracked;
+    if (!getBundleFlights.Join(UserGameplayDataBundleName, ResultDelegate, tracked))
+    {
+        return;
+    }
+
     InternalAwsGameKitRunLambdaOnWorkThread([=] 
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        FUserGameplayDataBundle bundle;
+        IntResult result = GetBundleBlocking(UserGameplayDataBundleName, bundle);
+
+        getBundleFlights.Complete(UserGameplayDataBundleName, tracked, ResultDelegate, result, MoveTemp(bundle));
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::GetBundleBlocking(const FString& UserGameplayDataBundleName, FUserGameplayDataBundle& OutBundle)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+
+    OutBundle.BundleName = UserGameplayDataBundleName;
+    const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
+    IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, OutBundle.BundleMap, TCHAR_TO_UTF8(*UserGameplayDataBundleName)));
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        if (FAwsGameKitUserGameplayDataCache::IsEnabled())
+        {
+            FAwsGameKitUserGameplayDataCache::Get().StoreBundle(cacheGeneration, OutBundle);
+        }
+
+        // Updates which haven't been written yet are newer than what the backend returned
+        FAwsGameKitUserGameplayDataWriteBehind::Get().MergeInto(OutBundle);
+    }
+
+    return result;
+}
+
+void AwsGameKitUserGameplayData::GetBundleUtf8(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FAwsGameKitUserGameplayDataUtf8Bundle&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundleUtf8", UserGameplayDataBundleName);
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        FAwsGameKitUserGameplayDataUtf8Bundle bundle;
+        IntResult result = GetBundleUtf8Blocking(UserGameplayDataBundleName, bundle);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundle));
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::GetBundleUtf8Blocking(const FString& UserGameplayDataBundleName, FAwsGameKitUserGameplayDataUtf8Bundle& OutBundle)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+
+    OutBundle.BundleName = UserGameplayDataBundleName;
+    OutBundle.Reset();
+    IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*UserGameplayDataBundleName), [&OutBundle](const char* key, const char* value)
+    {
+        OutBundle.Add(key, value);
+    }));
+    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    {
+        OutBundle.Reset();
+        return result;
+    }
+
+    // Only the updates which haven't been written yet are converted
+    FUserGameplayDataBundle pending;
+    pending.BundleName = UserGameplayDataBundleName;
+    FAwsGameKitUserGameplayDataWriteBehind::Get().MergeInto(pending);
+    for (const TPair<FString, FString>& item : pending.BundleMap)
+    {
+        OutBundle.Add(TCHAR_TO_UTF8(*item.Key), TCHAR_TO_UTF8(*item.Value));
+    }
+
+    return result;
+}
+
+void AwsGameKitUserGameplayData::GetBundleStreamed(const FUserGameplayDataStreamBundleRequest& Request, TAwsGameKitDelegateParam<const FUserGameplayDataBundle&> PartialResultDelegate, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundleStreamed");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
         FGraphEventRef OrderedWorkChain;
 
         FUserGameplayDataBundle bundle;
-        bundle.BundleName = UserGameplayDataBundleName;
-        IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, bundle.BundleMap, TCHAR_TO_UTF8(*UserGameplayDataBundleName)));
+        IntResult result = GetBundleStreamedBlocking(Request, [&](FUserGameplayDataBundle&& page)
+        {
+            InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, PartialResultDelegate, MoveTemp(page));
+        }, bundle);
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundle);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundle));
     });
 }
 
+IntResult AwsGameKitUserGameplayData::GetBundleStreamedBlocking(const FUserGameplayDataStreamBundleRequest& Request, TFunctionRef<void(FUserGameplayDataBundle&&)> OnPage, FUserGameplayDataBundle& OutBundle)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+    const int32 pageSize = FMath::Max(1, Request.PageSize);
+
+    OutBundle.BundleName = Request.BundleName;
+    OutBundle.BundleMap.Reset();
+
+    FUserGameplayDataBundle page;
+    const auto SendPage = [&]()
+    {
+        if (Request.KeepAllItems)
+        {
+            OutBundle.BundleMap.Append(page.BundleMap);
+        }
+        page.BundleName = Request.BundleName;
+        OnPage(MoveTemp(page));
+        page.BundleMap.Reset();
+    };
+    const auto AddItem = [&](FString&& key, FString&& value)
+    {
+        if (page.BundleMap.Num() == 0)
+        {
+            page.BundleMap.Reserve(pageSize);
+        }
+        page.BundleMap.Add(MoveTemp(key), MoveTemp(value));
+        if (page.BundleMap.Num() >= pageSize)
+        {
+            SendPage();
+        }
+    };
+
+    const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
+    IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*Request.BundleName), [&](const char* key, const char* value)
+    {
+        AddItem(UTF8_TO_TCHAR(key), UTF8_TO_TCHAR(value));
+    }));
+
+    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    {
+        OutBundle.BundleMap.Reset();
+        return result;
+    }
+
+    if (page.BundleMap.Num() > 0)
+    {
+        SendPage();
+    }
+
+    if (Request.KeepAllItems && FAwsGameKitUserGameplayDataCache::IsEnabled())
+    {
+        FAwsGameKitUserGameplayDataCache::Get().StoreBundle(cacheGeneration, OutBundle);
+    }
+
+    // Updates which haven't been written yet are newer than what the backend returned, so they come last
+    FUserGameplayDataBundle buffered;
+    buffered.BundleName = Request.BundleName;
+    FAwsGameKitUserGameplayDataWriteBehind::Get().MergeInto(buffered);
+    for (TPair<FString, FString>& item : buffered.BundleMap)
+    {
+        AddItem(MoveTemp(item.Key), MoveTemp(item.Value));
+    }
+
+    if (page.BundleMap.Num() > 0)
+    {
+        SendPage();
+    }
+
+    return result;
+}
+
+void AwsGameKitUserGameplayData::GetBundles(const TArray<FString>& UserGameplayDataBundleNames, TAwsGameKitDelegateParam<const IntResult&, const TArray<FUserGameplayDataBundle>&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundles");
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        TArray<FUserGameplayDataBundle> bundles;
+        IntResult result = GetBundlesBlocking(UserGameplayDataBundleNames, bundles);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundles));
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::GetBundlesBlocking(const TArray<FString>& UserGameplayDataBundleNames, TArray<FUserGameplayDataBundle>& OutBundles)
+{
+    struct FState
+    {
+        TArray<FString> BundleNames;
+        TArray<FUserGameplayDataBundle> Bundles;
+        TArray<IntResult> Results;
+        std::atomic<int32> NextBundle{ 0 };
+        std::atomic<int32> CompletedBundles{ 0 };
+        TPromise<void> AllCompleted;
+    };
+
+    const TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+    for (const FString& bundleName : UserGameplayDataBundleNames)
+    {
+        State->BundleNames.AddUnique(bundleName);
+    }
+
+    const int32 numBundles = State->BundleNames.Num();
+    if (numBundles == 0)
+    {
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
+    State->Bundles.SetNum(numBundles);
+    State->Results.SetNum(numBundles);
+    TFuture<void> allCompleted = State->AllCompleted.GetFuture();
+
+    // Whoever claims a bundle reads it, so this thread only ever waits for reads which are already running.
+    // Helpers that start after every bundle was claimed exit straight away.
+    const auto ReadBundles = [](FState& state)
+    {
+        int32 bundleIndex;
+        while ((bundleIndex = state.NextBundle++) < state.BundleNames.Num())
+        {
+            state.Results[bundleIndex] = GetBundleBlocking(state.BundleNames[bundleIndex], state.Bundles[bundleIndex]);
+            if (++state.CompletedBundles == state.BundleNames.Num())
+            {
+                state.AllCompleted.SetValue();
+            }
+        }
+    };
+
+    const int32 numHelpers = FMath::Min(numBundles, GET_BUNDLES_MAX_PARALLEL_REQUESTS) - 1;
+    for (int32 helper = 0; helper < numHelpers; ++helper)
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread([State, ReadBundles]()
+        {
+            ReadBundles(*State);
+        });
+    }
+
+    ReadBundles(*State);
+    allCompleted.Wait();
+
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitUserGameplayData::GetBundlesBlocking(): Read %d bundles on up to %d threads"), numBundles, numHelpers + 1);
+
+    IntResult result(GameKit::GAMEKIT_SUCCESS);
+    OutBundles.Reset(numBundles);
+    for (int32 bundleIndex = 0; bundleIndex < numBundles; ++bundleIndex)
+    {
+        if (State->Results[bundleIndex].Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            OutBundles.Add(MoveTemp(State->Bundles[bundleIndex]));
+        }
+        else if (result.Result == GameKit::GAMEKIT_SUCCESS)
+        {
+            result = State->Results[bundleIndex];
+        }
+    }
+
+    return result;
+}
+
 void AwsGameKitUserGameplayData::GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundleItem", userGameplayDataBundleItem.BundleName);
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         FUserGameplayDataBundleItemValue bundleItem;
@@ -153,40 +512,210 @@ void AwsGameKitUserGameplayData::GetBundleItem(const FUserGameplayDataBundleItem
             ConvertString(userGameplayDataBundleItem.BundleItemKey)
         };
 
+        const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
         IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, bundleItem.BundleItemValue, wrapperArgs));
+        if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitUserGameplayDataCache::IsEnabled())
+        {
+            FAwsGameKitUserGameplayDataCache::Get().StoreItem(cacheGeneration, bundleItem.BundleName, bundleItem.BundleItemKey, bundleItem.BundleItemValue);
+        }
+        if (FAwsGameKitUserGameplayDataWriteBehind::Get().FindItem(bundleItem.BundleName, bundleItem.BundleItemKey, bundleItem.BundleItemValue))
+        {
+            // Not written yet, but the item may also not exist in the backend yet
+            result = IntResult(GameKit::GAMEKIT_SUCCESS);
+        }
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, bundleItem);
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundleItem));
     });
 }
 
+bool AwsGameKitUserGameplayData::GetCachedBundle(const FString& UserGameplayDataBundleName, FUserGameplayDataBundle& OutBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> RefreshDelegate)
+{
+    if (!FAwsGameKitUserGameplayDataCache::IsEnabled())
+    {
+        GetBundle(UserGameplayDataBundleName, RefreshDelegate);
+        return false;
+    }
+
+    FAwsGameKitUserGameplayDataCache& cache = FAwsGameKitUserGameplayDataCache::Get();
+    FUserGameplayDataBundle cached;
+    bool isStale = true;
+    const bool isCached = cache.GetBundle(UserGameplayDataBundleName, cached, isStale);
+    if (isCached)
+    {
+        FAwsGameKitUserGameplayDataWriteBehind::Get().MergeInto(cached);
+        OutBundle = MoveTemp(cached);
+    }
+
+    if (isStale && BeginCacheRefresh(cache, UserGameplayDataBundleName))
+    {
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("AwsGameKitUserGameplayData::GetCachedBundle(): Refreshing %s"), *UserGameplayDataBundleName);
+
+        // GetBundle() stores the refreshed bundle in the cache
+        GetBundle(UserGameplayDataBundleName, TAwsGameKitDelegate<const IntResult&, const FUserGameplayDataBundle&>::CreateLambda(
+            [UserGameplayDataBundleName, RefreshDelegate](const IntResult& result, const FUserGameplayDataBundle& bundle)
+            {
+                FAwsGameKitUserGameplayDataCache::Get().EndRefresh(UserGameplayDataBundleName);
+                RefreshDelegate.ExecuteIfBound(result, bundle);
+            }));
+    }
+
+    return isCached;
+}
+
+bool AwsGameKitUserGameplayData::GetCachedBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, FString& OutBundleItemValue, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> RefreshDelegate)
+{
+    if (!FAwsGameKitUserGameplayDataCache::IsEnabled())
+    {
+        GetBundleItem(userGameplayDataBundleItem, RefreshDelegate);
+        return false;
+    }
+
+    // A buffered update is the newest value and needs no refresh
+    if (FAwsGameKitUserGameplayDataWriteBehind::Get().FindItem(userGameplayDataBundleItem.BundleName, userGameplayDataBundleItem.BundleItemKey, OutBundleItemValue))
+    {
+        return true;
+    }
+
+    FAwsGameKitUserGameplayDataCache& cache = FAwsGameKitUserGameplayDataCache::Get();
+    bool isStale = true;
+    const bool isCached = cache.GetItem(userGameplayDataBundleItem.BundleName, userGameplayDataBundleItem.BundleItemKey, OutBundleItemValue, isStale);
+
+    const FString refreshKey = FAwsGameKitUserGameplayDataCache::GetRefreshKey(userGameplayDataBundleItem.BundleName, userGameplayDataBundleItem.BundleItemKey);
+    if (isStale && BeginCacheRefresh(cache, refreshKey))
+    {
+        // GetBundleItem() stores the refreshed item in the cache
+        GetBundleItem(userGameplayDataBundleItem, TAwsGameKitDelegate<const IntResult&, const FUserGameplayDataBundleItemValue&>::CreateLambda(
+            [refreshKey, RefreshDelegate](const IntResult& result, const FUserGameplayDataBundleItemValue& bundleItem)
+            {
+                FAwsGameKitUserGameplayDataCache::Get().EndRefresh(refreshKey);
+                RefreshDelegate.ExecuteIfBound(result, bundleItem);
+            }));
+    }
+
+    return isCached;
+}
+
 void AwsGameKitUserGameplayData::UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "UpdateItem", userGameplayDataBundleItemValue.BundleName, userGameplayDataBundleItemValue.BundleItemValue.Len());
+
+    if (FAwsGameKitUserGameplayDataWriteBehind::Get().Add(userGameplayDataBundleItemValue, OnCompleteDelegate))
+    {
+        return;
+    }
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
+        IntResult result = UpdateItemBlocking(userGameplayDataBundleItemValue);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::UpdateItemBlocking(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+
+    FAwsGameKitInternalTempStrings ConvertString;
+    UserGameplayDataBundleItemValue wrapperArgs
+    {
+        ConvertString(*userGameplayDataBundleItemValue.BundleName),
+        ConvertString(*userGameplayDataBundleItemValue.BundleItemKey),
+        ConvertString(*userGameplayDataBundleItemValue.BundleItemValue)
+    };
+
+    const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
+    IntResult result(library.UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, wrapperArgs));
+    if (IsWrittenOrEnqueued(result) && FAwsGameKitUserGameplayDataCache::IsEnabled())
+    {
+        FAwsGameKitUserGameplayDataCache::Get().StoreItem(cacheGeneration, userGameplayDataBundleItemValue.BundleName, userGameplayDataBundleItemValue.BundleItemKey, userGameplayDataBundleItemValue.BundleItemValue);
+    }
+
+    return result;
+}
+
+void AwsGameKitUserGameplayData::IncrementBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate)
+{
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "IncrementBundleItem", userGameplayDataBundleItem.BundleName);
+
+    InternalAwsGameKitRunLambdaOnWorkThread([=]
+    {
+        FGraphEventRef OrderedWorkChain;
+
+        FUserGameplayDataBundleItemValue bundleItem;
+        IntResult result = IncrementBundleItemBlocking(userGameplayDataBundleItem, Delta, bundleItem);
+
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, ResultDelegate, result, MoveTemp(bundleItem));
+    });
+}
+
+IntResult AwsGameKitUserGameplayData::IncrementBundleItemBlocking(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta, FUserGameplayDataBundleItemValue& OutBundleItem)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+    FAwsGameKitUserGameplayDataWriteBehind& writeBehind = FAwsGameKitUserGameplayDataWriteBehind::Get();
+
+    OutBundleItem.BundleName = userGameplayDataBundleItem.BundleName;
+    OutBundleItem.BundleItemKey = userGameplayDataBundleItem.BundleItemKey;
+
+    // A buffered update is newer than the value in the backend, and has to stay ordered with the incremented value.
+    // The lock is never held across a network call: an item which isn't buffered is read and written without it.
+    FScopeLock BufferedLock(&BufferedIncrementMutex);
+    FString currentValue;
+    const bool isBuffered = writeBehind.FindItem(OutBundleItem.BundleName, OutBundleItem.BundleItemKey, currentValue);
+    if (!isBuffered)
+    {
+        BufferedLock.Unlock();
+
         FAwsGameKitInternalTempStrings ConvertString;
-        UserGameplayDataBundleItemValue wrapperArgs
+        UserGameplayDataBundleItem wrapperArgs
         {
-            ConvertString(*userGameplayDataBundleItemValue.BundleName),
-            ConvertString(*userGameplayDataBundleItemValue.BundleItemKey),
-            ConvertString(*userGameplayDataBundleItemValue.BundleItemValue)
+            ConvertString(*userGameplayDataBundleItem.BundleName),
+            ConvertString(*userGameplayDataBundleItem.BundleItemKey)
         };
 
-        IntResult result(library.UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, wrapperArgs));
+        IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, currentValue, wrapperArgs));
+        if (result.Result != GameKit::GAMEKIT_SUCCESS)
+        {
+            return result;
+        }
+    }
 
-        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
-    });
+    // Only the canonical decimal form is accepted, so that values such as "1.5" or " 7" aren't silently truncated
+    int64 value = 0;
+    LexFromString(value, *currentValue);
+    const bool isInteger = LexToString(value) == currentValue;
+    const bool overflows = Delta > 0 ? value > MAX_int64 - Delta : value < MIN_int64 - Delta;
+    if (!isInteger || overflows)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitUserGameplayData::IncrementBundleItem(): %s in bundle %s is \"%s\", which can't be incremented by %lld"),
+            *OutBundleItem.BundleItemKey, *OutBundleItem.BundleName, *currentValue, Delta);
+        return IntResult(GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID);
+    }
+
+    OutBundleItem.BundleItemValue = LexToString(value + Delta);
+
+    if (isBuffered && writeBehind.Add(OutBundleItem, FAwsGameKitStatusDelegate()))
+    {
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
+    BufferedLock.Unlock();
+    return UpdateItemBlocking(OutBundleItem);
 }
 
 void AwsGameKitUserGameplayData::DeleteAllData(FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteAllData");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
+        FAwsGameKitUserGameplayDataWriteBehind::Get().DiscardAll();
+        FAwsGameKitUserGameplayDataCache::Get().InvalidateAll();
         IntResult result(library.UserGameplayDataWrapper->GameKitDeleteAllUserGameplayData(library.UserGameplayDataInstanceHandle));
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
@@ -195,11 +724,15 @@ void AwsGameKitUserGameplayData::DeleteAllData(FAwsGameKitStatusDelegateParam On
 
 void AwsGameKitUserGameplayData::DeleteBundle(const FString& UserGameplayDataBundleName, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteBundle", UserGameplayDataBundleName);
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
+        FAwsGameKitUserGameplayDataWriteBehind::Get().Discard(UserGameplayDataBundleName);
+        FAwsGameKitUserGameplayDataCache::Get().InvalidateBundle(UserGameplayDataBundleName);
         IntResult result(library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*UserGameplayDataBundleName)));
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
@@ -208,9 +741,11 @@ void AwsGameKitUserGameplayData::DeleteBundle(const FString& UserGameplayDataBun
 
 void AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteBundleItems");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         IntResult result;
@@ -224,31 +759,35 @@ void AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDelete
         }
         else
         {    
-            // Preallocate with expected size to prevent pointers becoming invalid
-            // when array expands and data is copied.
             int32 numKeys = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num();
-            TArray<std::string> bundleItemKeys;
-            bundleItemKeys.SetNum(numKeys);
-            TArray<const char*> bundleItemKeysChrArray;
-            bundleItemKeysChrArray.SetNum(numKeys);
 
-            for (int i = 0; i < numKeys; i++)
+            // Size the arena from the inputs first so that every string is converted into one allocation.
+            int32 convertedSize = FAwsGameKitInternalTempStrings::GetConvertedSize(userGameplayDataBundleItemsDeleteRequest.BundleName);
+            for (const FString& itemKey : userGameplayDataBundleItemsDeleteRequest.BundleItemKeys)
             {
-                auto& itemKey = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys[i];
+                convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(itemKey);
+            }
+            FAwsGameKitInternalTempStrings ConvertString;
+            ConvertString.Reserve(convertedSize);
 
-                bundleItemKeys[i] = TCHAR_TO_UTF8(*itemKey);
+            TArray<const char*> bundleItemKeysChrArray;
+            bundleItemKeysChrArray.Reserve(numKeys);
 
-                bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
+            for (const FString& itemKey : userGameplayDataBundleItemsDeleteRequest.BundleItemKeys)
+            {
+                bundleItemKeysChrArray.Add(ConvertString(itemKey));
             }
 
-            std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundleItemsDeleteRequest.BundleName);
+            const char* bundleName = ConvertString(userGameplayDataBundleItemsDeleteRequest.BundleName);
             UserGameplayDataDeleteItemsRequest wrapperArgs
             {
-                bundleName.c_str(),
+                bundleName,
                 (bundleItemKeysChrArray.GetData()),
                 size_t(numKeys)
             };
 
+            FAwsGameKitUserGameplayDataWriteBehind::Get().Discard(userGameplayDataBundleItemsDeleteRequest.BundleName, userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
+            FAwsGameKitUserGameplayDataCache::Get().InvalidateBundle(userGameplayDataBundleItemsDeleteRequest.BundleName, userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
             result = library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundleItems(library.UserGameplayDataInstanceHandle, wrapperArgs);
         }
 
@@ -256,21 +795,26 @@ void AwsGameKitUserGameplayData::DeleteBundleItems(const FUserGameplayDataDelete
     });
 }
 
+void AwsGameKitUserGameplayData::FlushBufferedUpdates()
+{
+    FAwsGameKitUserGameplayDataWriteBehind::Get().FlushAll();
+}
+
 void AwsGameKitUserGameplayData::StartRetryBackgroundThread()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStartRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void AwsGameKitUserGameplayData::StopRetryBackgroundThread()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStopRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void AwsGameKitUserGameplayData::DropAllCachedEvents()
 {
-    UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataDropAllCachedEvents(library.UserGameplayDataInstanceHandle);
 }
 
@@ -281,7 +825,7 @@ void AwsGameKitUserGameplayData::SetNetworkChangeDelegate(const FNetworkStatusCh
         FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
         runtimeModule->SetNetworkChangeDelegate(networkStatusChangeDelegate);
 
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         library.UserGameplayDataWrapper->GameKitUserGameplayDataSetNetworkChangeCallback(library.UserGameplayDataInstanceHandle, runtimeModule, &FAwsGameKitRuntimeModule::OnNetworkStatusChangeDispatcher::Dispatch);
     }
 }
@@ -290,14 +834,12 @@ void AwsGameKitUserGameplayData::SetCacheProcessedDelegate(const FCacheProcessed
 {
     if (cacheProcessedDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-        UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
         library.UserGameplayDataStateHandler->SetCacheProcessedDelegate(cacheProcessedDelegate);
 
         auto cacheProcessedDelegateExecutor = [](const bool isCacheProcessed)
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             library.UserGameplayDataStateHandler->onCacheProcessedDelegate.ExecuteIfBound(isCacheProcessed);
         };
         typedef LambdaDispatcher<decltype(cacheProcessedDelegateExecutor), void, const bool> CacheProcessedDelegateExecuter;
@@ -306,27 +848,127 @@ void AwsGameKitUserGameplayData::SetCacheProcessedDelegate(const FCacheProcessed
     }
 }
 
+void AwsGameKitUserGameplayData::SetCircuitBreakerStateChangeDelegate(const FCircuitBreakerStateChangeDelegate& circuitBreakerStateChangeDelegate)
+{
+    if (circuitBreakerStateChangeDelegate.IsBound())
+    {
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+        library.UserGameplayDataStateHandler->SetCircuitBreakerStateChangeDelegate(circuitBreakerStateChangeDelegate);
+    }
+}
+
+UserGameplayDataCircuitState_E AwsGameKitUserGameplayData::GetCircuitBreakerState()
+{
+    return FAwsGameKitUserGameplayDataCircuitBreaker::Get().GetState();
+}
+
+void AwsGameKitUserGameplayData::SetRetryQueueStatsDelegate(const FRetryQueueStatsDelegate& retryQueueStatsDelegate)
+{
+    if (retryQueueStatsDelegate.IsBound())
+    {
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+        library.UserGameplayDataStateHandler->SetRetryQueueStatsDelegate(retryQueueStatsDelegate);
+    }
+}
+
+FUserGameplayDataRetryQueueStats AwsGameKitUserGameplayData::GetRetryQueueStats()
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+    return library.UserGameplayDataStateHandler.IsValid() ? library.UserGameplayDataStateHandler->GetRetryQueueStats() : FUserGameplayDataRetryQueueStats();
+}
+
 void AwsGameKitUserGameplayData::PersistToCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "PersistToCache");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
-
-        IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataPersistApiCallsToCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*cacheFile)));
+        const IntResult result = PersistToCacheBlocking(cacheFile, cacheFile);
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
     });
 }
 
+IntResult AwsGameKitUserGameplayData::PersistToCacheBlocking(const FString& cacheFile, const FString& libraryCacheFile)
+{
+    SetLastCacheFile(cacheFile, libraryCacheFile);
+
+    // Buffered updates which can't be written now land in the retry queue and are persisted with it
+    FAwsGameKitUserGameplayDataWriteBehind::Get().FlushAll(true);
+    return WriteCacheBlocking(cacheFile, libraryCacheFile);
+}
+
+IntResult AwsGameKitUserGameplayData::WriteCacheBlocking(const FString& cacheFile, const FString& libraryCacheFile)
+{
+    const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
+    FAwsGameKitUserGameplayDataCache::Get().Persist();
+
+    // Items enqueued after this point aren't in the file written below
+    const FAwsGameKitUserGameplayDataWriteBehind::FJournalRecords enqueuedJournalRecords = FAwsGameKitUserGameplayDataWriteBehind::Get().GetEnqueuedJournalRecords();
+
+    const FString tempCacheFile = cacheFile + TEXT(".tmp");
+    IFileManager::Get().Delete(*tempCacheFile, false, false, true);
+
+    IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataPersistApiCallsToCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*(libraryCacheFile + TEXT(".tmp")))));
+    if (result.Result != GameKit::GAMEKIT_SUCCESS)
+    {
+        IFileManager::Get().Delete(*tempCacheFile, false, false, true);
+        return result;
+    }
+
+    // Nothing is written when the queue is empty, leave the previous file as it is then
+    if (IFileManager::Get().FileExists(*tempCacheFile) && !IFileManager::Get().Move(*cacheFile, *tempCacheFile, true, true, false, true))
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("AwsGameKitUserGameplayData::PersistToCache(): Failed to replace %s"), *cacheFile);
+        IFileManager::Get().Delete(*tempCacheFile, false, false, true);
+        return IntResult(GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED);
+    }
+
+    // The enqueued items which were kept in the journal are in the persisted queue now
+    FAwsGameKitUserGameplayDataWriteBehind::Get().CompleteJournal(enqueuedJournalRecords);
+    return result;
+}
+
+IntResult AwsGameKitUserGameplayData::PersistToLastCacheBlocking()
+{
+    FString cacheFile;
+    FString libraryCacheFile;
+    {
+        FScopeLock ScopeLock(&LastCacheFileMutex);
+        cacheFile = LastCacheFile;
+        libraryCacheFile = LastLibraryCacheFile;
+    }
+
+    if (cacheFile.IsEmpty())
+    {
+        // The game doesn't persist the retry queue
+        FAwsGameKitUserGameplayDataCache::Get().Persist();
+        return IntResult(GameKit::GAMEKIT_SUCCESS);
+    }
+
+    return WriteCacheBlocking(cacheFile, libraryCacheFile);
+}
+
+void AwsGameKitUserGameplayData::SetLastCacheFile(const FString& cacheFile, const FString& libraryCacheFile)
+{
+    FScopeLock ScopeLock(&LastCacheFileMutex);
+    LastCacheFile = cacheFile;
+    LastLibraryCacheFile = libraryCacheFile;
+}
+
 void AwsGameKitUserGameplayData::LoadFromCache(const FString& cacheFile, FAwsGameKitStatusDelegateParam OnCompleteDelegate)
 {
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "LoadFromCache");
+
     InternalAwsGameKitRunLambdaOnWorkThread([=]
     {
-        UserGameplayDataLibrary library = GetUserGameplayDataLibraryFromModule();
+        const UserGameplayDataLibrary& library = GetUserGameplayDataLibraryFromModule();
         FGraphEventRef OrderedWorkChain;
 
         IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataLoadApiCallsFromCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*cacheFile)));
+        SetLastCacheFile(cacheFile, cacheFile);
+        FAwsGameKitUserGameplayDataWriteBehind::Get().ReplayJournal();
 
         InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, OnCompleteDelegate, result);
     });
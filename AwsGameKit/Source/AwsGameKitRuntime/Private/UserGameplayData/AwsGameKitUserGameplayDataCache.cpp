@@ -0,0 +1,685 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitCacheBudget.h"
+#include "Common/AwsGameKitStats.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "Utils/Blueprints/UAwsGameKitFileUtils.h"
+
+// Unreal
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    // "GKUC", followed by the format version. Files with another version are ignored and overwritten on the next write.
+    const uint32 CACHE_FILE_MAGIC = 0x43554B47;
+    const uint32 CACHE_FILE_VERSION = 1;
+}
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataCacheEnabled(
+    TEXT("GameKit.UserGameplayData.Cache.Enabled"),
+    0,
+    TEXT("Caches the player's bundles on the client, see AwsGameKitUserGameplayData::GetCachedBundle().\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataCacheTtlSeconds(
+    TEXT("GameKit.UserGameplayData.Cache.TtlSeconds"),
+    300,
+    TEXT("Number of seconds after which a cached bundle or bundle item is refreshed.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataCachePersist(
+    TEXT("GameKit.UserGameplayData.Cache.Persist"),
+    0,
+    TEXT("Writes the bundle cache to disk so that it is available in the next session.\n")
+    TEXT("  0: in memory only\n")
+    TEXT("  1: persisted\n"),
+    ECVF_Default);
+
+FAwsGameKitUserGameplayDataCache& FAwsGameKitUserGameplayDataCache::Get()
+{
+    static FAwsGameKitUserGameplayDataCache Instance;
+    return Instance;
+}
+
+bool FAwsGameKitUserGameplayDataCache::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataCacheEnabled.GetValueOnAnyThread() != 0;
+}
+
+FAwsGameKitUserGameplayDataCache::~FAwsGameKitUserGameplayDataCache()
+{
+    for (TPair<FString, FPlayerCache>& Player : Players)
+    {
+        ReleaseDisk(Player.Value);
+    }
+}
+
+uint32 FAwsGameKitUserGameplayDataCache::GetGeneration()
+{
+    FScopeLock ScopeLock(&Mutex);
+    CheckPlayer();
+    return Generation;
+}
+
+bool FAwsGameKitUserGameplayDataCache::GetBundle(const FString& BundleName, FUserGameplayDataBundle& OutBundle, bool& bOutIsStale)
+{
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerCache* Player = FindPlayer();
+    if (Player != nullptr)
+    {
+        LoadFromDiskIfNeeded(*Player, BundleName);
+    }
+
+    FCachedBundle* Cached = Player != nullptr ? Player->Bundles.Find(BundleName) : nullptr;
+    FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::UserGameplayData, Cached != nullptr && Cached->bComplete);
+    if (Cached == nullptr || !Cached->bComplete)
+    {
+        return false;
+    }
+    Cached->LastUsed = FPlatformTime::Seconds();
+
+    OutBundle.BundleName = BundleName;
+    OutBundle.BundleMap.Reset();
+    OutBundle.BundleMap.Reserve(Cached->Items.Num());
+    for (const TPair<FString, FCachedItem>& Item : Cached->Items)
+    {
+        OutBundle.BundleMap.Add(Item.Key, Item.Value.Value);
+    }
+
+    bOutIsStale = IsStale(Cached->FetchedAt);
+    return true;
+}
+
+bool FAwsGameKitUserGameplayDataCache::GetItem(const FString& BundleName, const FString& BundleItemKey, FString& OutBundleItemValue, bool& bOutIsStale)
+{
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerCache* Player = FindPlayer();
+    if (Player != nullptr)
+    {
+        LoadFromDiskIfNeeded(*Player, BundleName);
+    }
+
+    FCachedBundle* Cached = Player != nullptr ? Player->Bundles.Find(BundleName) : nullptr;
+    const FCachedItem* Item = Cached != nullptr ? Cached->Items.Find(BundleItemKey) : nullptr;
+    FAwsGameKitStats::RecordCacheLookup(EAwsGameKitStatsCache::UserGameplayData, Item != nullptr);
+    if (Item == nullptr)
+    {
+        return false;
+    }
+    Cached->LastUsed = FPlatformTime::Seconds();
+
+    OutBundleItemValue = Item->Value;
+    bOutIsStale = IsStale(Item->StoredAt);
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataCache::StoreBundle(uint32 StoreGeneration, const FUserGameplayDataBundle& Bundle)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    ResolvePlayer();
+
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerCache* Player = FindPlayerForStore(StoreGeneration);
+    if (Player == nullptr)
+    {
+        return;
+    }
+    LoadFromDiskIfNeeded(*Player);
+    Player->DiskRecords.Remove(Bundle.BundleName);
+
+    const FDateTime Now = FDateTime::UtcNow();
+    FCachedBundle& Cached = Player->Bundles.FindOrAdd(Bundle.BundleName);
+    Cached.Items.Reset();
+    Cached.Items.Reserve(Bundle.BundleMap.Num());
+    for (const TPair<FString, FString>& Item : Bundle.BundleMap)
+    {
+        Cached.Items.Add(Item.Key, FCachedItem{ Item.Value, Now });
+    }
+    Cached.FetchedAt = Now;
+    Cached.bComplete = true;
+    Cached.LastUsed = FPlatformTime::Seconds();
+    Player->bDirty = true;
+    FAwsGameKitCacheBudget::Get().RequestEnforce();
+}
+
+void FAwsGameKitUserGameplayDataCache::StoreItems(uint32 StoreGeneration, const FUserGameplayDataBundle& Bundle, const TMap<FString, FString>& UnprocessedItems)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    ResolvePlayer();
+
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerCache* Player = FindPlayerForStore(StoreGeneration);
+    if (Player == nullptr)
+    {
+        return;
+    }
+    LoadFromDiskIfNeeded(*Player, Bundle.BundleName);
+
+    const FDateTime Now = FDateTime::UtcNow();
+    FCachedBundle& Cached = Player->Bundles.FindOrAdd(Bundle.BundleName);
+    for (const TPair<FString, FString>& Item : Bundle.BundleMap)
+    {
+        if (!UnprocessedItems.Contains(Item.Key))
+        {
+            Cached.Items.Add(Item.Key, FCachedItem{ Item.Value, Now });
+        }
+    }
+    Cached.LastUsed = FPlatformTime::Seconds();
+    Player->bDirty = true;
+}
+
+void FAwsGameKitUserGameplayDataCache::StoreItem(uint32 StoreGeneration, const FString& BundleName, const FString& BundleItemKey, const FString& BundleItemValue)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    ResolvePlayer();
+
+    FScopeLock ScopeLock(&Mutex);
+    FPlayerCache* Player = FindPlayerForStore(StoreGeneration);
+    if (Player == nullptr)
+    {
+        return;
+    }
+    LoadFromDiskIfNeeded(*Player, BundleName);
+
+    FCachedBundle& Cached = Player->Bundles.FindOrAdd(BundleName);
+    Cached.Items.Add(BundleItemKey, FCachedItem{ BundleItemValue, FDateTime::UtcNow() });
+    Cached.LastUsed = FPlatformTime::Seconds();
+    Player->bDirty = true;
+}
+
+void FAwsGameKitUserGameplayDataCache::InvalidateBundle(const FString& BundleName, const TArray<FString>& BundleItemKeys)
+{
+    ResolvePlayer();
+
+    FScopeLock ScopeLock(&Mutex);
+    // Whatever was stored before is now older than the backend, including the stores still in flight
+    ++Generation;
+    CheckPlayer();
+    if (PlayerId.IsEmpty())
+    {
+        // The player couldn't be looked up, their bundles can't be read either
+        return;
+    }
+
+    FPlayerCache& Player = FindOrAddPlayer();
+    Player.bDirty = true;
+    if (BundleItemKeys.Num() == 0)
+    {
+        // No need to decode a bundle which is dropped
+        LoadFromDiskIfNeeded(Player);
+        Player.DiskRecords.Remove(BundleName);
+        Player.Bundles.Remove(BundleName);
+        return;
+    }
+
+    LoadFromDiskIfNeeded(Player, BundleName);
+    if (FCachedBundle* Cached = Player.Bundles.Find(BundleName))
+    {
+        // The bundle stays complete, the deleted items are gone from the backend too
+        for (const FString& BundleItemKey : BundleItemKeys)
+        {
+            Cached->Items.Remove(BundleItemKey);
+        }
+    }
+}
+
+void FAwsGameKitUserGameplayDataCache::InvalidateAll()
+{
+    // Also waits for a write in progress, so that it can't bring a deleted file back
+    FScopeLock FileLock(&FileMutex);
+    FScopeLock ScopeLock(&Mutex);
+    ++Generation;
+    for (TPair<FString, FPlayerCache>& Player : Players)
+    {
+        ReleaseDisk(Player.Value);
+    }
+    Players.Reset();
+
+    // The files of every player, including those which weren't read in this session
+    const FString Directory = UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::UserGameplayData);
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("UserGameplayDataCache*.bin")), true, false);
+    for (const FString& FileName : FileNames)
+    {
+        IFileManager::Get().Delete(*FPaths::Combine(Directory, FileName), false, false, true);
+    }
+}
+
+void FAwsGameKitUserGameplayDataCache::RegisterWithCacheBudget()
+{
+    FAwsGameKitBudgetedCache Budgeted;
+    Budgeted.GetBytes = [this]()
+    {
+        return GetAllocatedBytes();
+    };
+    Budgeted.GetOldestUse = [this]()
+    {
+        FScopeLock ScopeLock(&Mutex);
+        double OldestUse = MAX_dbl;
+        for (const TPair<FString, FPlayerCache>& Player : Players)
+        {
+            for (const TPair<FString, FCachedBundle>& Bundle : Player.Value.Bundles)
+            {
+                OldestUse = FMath::Min(OldestUse, Bundle.Value.LastUsed);
+            }
+        }
+        return OldestUse;
+    };
+    Budgeted.EvictOldest = [this]()
+    {
+        return EvictOldestBundle();
+    };
+    FAwsGameKitCacheBudget::Get().RegisterCache(TEXT("UserGameplayData"), EAwsGameKitCachePriority::Normal, MoveTemp(Budgeted));
+}
+
+int64 FAwsGameKitUserGameplayDataCache::GetAllocatedBytes() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    int64 Bytes = Players.GetAllocatedSize();
+    for (const TPair<FString, FPlayerCache>& Player : Players)
+    {
+        Bytes += Player.Key.GetAllocatedSize() + Player.Value.Bundles.GetAllocatedSize() + Player.Value.LoadedFile.GetAllocatedSize();
+        for (const TPair<FString, FCachedBundle>& Bundle : Player.Value.Bundles)
+        {
+            Bytes += Bundle.Key.GetAllocatedSize() + Bundle.Value.Items.GetAllocatedSize();
+            for (const TPair<FString, FCachedItem>& Item : Bundle.Value.Items)
+            {
+                Bytes += Item.Key.GetAllocatedSize() + Item.Value.Value.GetAllocatedSize();
+            }
+        }
+    }
+    return Bytes;
+}
+
+int64 FAwsGameKitUserGameplayDataCache::EvictOldestBundle()
+{
+    const int64 BytesBefore = GetAllocatedBytes();
+    {
+        FScopeLock ScopeLock(&Mutex);
+        FPlayerCache* OldestPlayer = nullptr;
+        const FString* OldestName = nullptr;
+        double OldestUse = MAX_dbl;
+        for (TPair<FString, FPlayerCache>& Player : Players)
+        {
+            for (const TPair<FString, FCachedBundle>& Bundle : Player.Value.Bundles)
+            {
+                if (Bundle.Value.LastUsed < OldestUse)
+                {
+                    OldestPlayer = &Player.Value;
+                    OldestName = &Bundle.Key;
+                    OldestUse = Bundle.Value.LastUsed;
+                }
+            }
+        }
+        if (OldestName == nullptr)
+        {
+            return 0;
+        }
+
+        UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitUserGameplayDataCache: Evicting bundle %s"), **OldestName);
+        OldestPlayer->Bundles.Remove(FString(*OldestName));
+        OldestPlayer->Bundles.Compact();
+    }
+    return FMath::Max<int64>(1, BytesBefore - GetAllocatedBytes());
+}
+
+bool FAwsGameKitUserGameplayDataCache::BeginRefresh(const FString& Key)
+{
+    FScopeLock ScopeLock(&Mutex);
+    bool bAlreadyRefreshing = false;
+    Refreshing.Add(Key, &bAlreadyRefreshing);
+    return !bAlreadyRefreshing;
+}
+
+void FAwsGameKitUserGameplayDataCache::EndRefresh(const FString& Key)
+{
+    FScopeLock ScopeLock(&Mutex);
+    Refreshing.Remove(Key);
+}
+
+FString FAwsGameKitUserGameplayDataCache::GetRefreshKey(const FString& BundleName, const FString& BundleItemKey)
+{
+    // Bundle names are primary identifiers, which can't contain '/', so this never collides with a bundle's own key
+    return BundleName + TEXT("/") + BundleItemKey;
+}
+
+void FAwsGameKitUserGameplayDataCache::Persist()
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    if (CVarGameKitUserGameplayDataCachePersist.GetValueOnAnyThread() == 0)
+    {
+        return;
+    }
+
+    FScopeLock FileLock(&FileMutex);
+    TMap<FString, TArray<uint8>> Files;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        for (TPair<FString, FPlayerCache>& Player : Players)
+        {
+            if (!Player.Value.bDirty)
+            {
+                continue;
+            }
+
+            TMap<FString, FDiskRecord> NewDiskRecords;
+            TArray<uint8>& Contents = Files.Add(Player.Value.FilePath, Serialize(Player.Value, NewDiskRecords));
+
+            // The file is about to be replaced, keep the bundles which weren't decoded yet pointing at a copy of what is written
+            ReleaseDisk(Player.Value);
+            if (NewDiskRecords.Num() > 0)
+            {
+                Player.Value.LoadedFile = Contents;
+                Player.Value.DiskContents = Player.Value.LoadedFile;
+                Player.Value.DiskRecords = MoveTemp(NewDiskRecords);
+            }
+            Player.Value.bDirty = false;
+        }
+    }
+
+    // Written outside of the data lock so that readers on the game thread don't wait on the disk.
+    // The previous file is only replaced once the new one is complete, an interrupted write leaves it intact.
+    for (const TPair<FString, TArray<uint8>>& File : Files)
+    {
+        const FString& FilePath = File.Key;
+        const FString TempFilePath = FilePath + TEXT(".tmp");
+        if (!FFileHelper::SaveArrayToFile(File.Value, *TempFilePath) || !IFileManager::Get().Move(*FilePath, *TempFilePath, true, true, false, true))
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache: Failed to write %s"), *FilePath);
+            IFileManager::Get().Delete(*TempFilePath, false, false, true);
+        }
+    }
+}
+
+void FAwsGameKitUserGameplayDataCache::CheckPlayer()
+{
+    // A login, logout or account change makes the cached player id and every store in flight stale
+    const uint32 IdentityGeneration = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    if (IdentityGeneration != PlayerGeneration)
+    {
+        PlayerId.Reset();
+        PlayerGeneration = IdentityGeneration;
+        ++Generation;
+    }
+}
+
+bool FAwsGameKitUserGameplayDataCache::ResolvePlayer()
+{
+    uint32 IdentityGeneration;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        CheckPlayer();
+        if (!PlayerId.IsEmpty())
+        {
+            return true;
+        }
+        IdentityGeneration = PlayerGeneration;
+    }
+
+    // Not holding the lock, the profile may have to be fetched
+    FGetUserResponse User;
+    const IntResult Result = FAwsGameKitIdentityUserCache::Get().GetUser(User);
+
+    FScopeLock ScopeLock(&Mutex);
+    bIsResolvingPlayer = false;
+    CheckPlayer();
+    if (Result.Result != GameKit::GAMEKIT_SUCCESS || User.UserId.IsEmpty() || IdentityGeneration != PlayerGeneration)
+    {
+        // Not if the player changed while the profile was fetched
+        return false;
+    }
+
+    PlayerId = User.UserId;
+    return true;
+}
+
+FAwsGameKitUserGameplayDataCache::FPlayerCache* FAwsGameKitUserGameplayDataCache::FindPlayer()
+{
+    CheckPlayer();
+    if (PlayerId.IsEmpty())
+    {
+        // Reads come from the game thread, which mustn't wait for the profile. They miss until it's known.
+        if (!bIsResolvingPlayer)
+        {
+            bIsResolvingPlayer = true;
+            InternalAwsGameKitRunLambdaOnWorkThread([this]
+            {
+                ResolvePlayer();
+            }, EAwsGameKitWorkLane::Background);
+        }
+        return nullptr;
+    }
+
+    return &FindOrAddPlayer();
+}
+
+FAwsGameKitUserGameplayDataCache::FPlayerCache* FAwsGameKitUserGameplayDataCache::FindPlayerForStore(uint32 StoreGeneration)
+{
+    CheckPlayer();
+    if (StoreGeneration != Generation || PlayerId.IsEmpty())
+    {
+        // Requested before an invalidate or for another player
+        return nullptr;
+    }
+
+    return &FindOrAddPlayer();
+}
+
+FAwsGameKitUserGameplayDataCache::FPlayerCache& FAwsGameKitUserGameplayDataCache::FindOrAddPlayer()
+{
+    FPlayerCache& Player = Players.FindOrAdd(PlayerId);
+    if (Player.FilePath.IsEmpty())
+    {
+        Player.FilePath = GetCacheFilePath(PlayerId);
+    }
+    return Player;
+}
+
+void FAwsGameKitUserGameplayDataCache::LoadFromDiskIfNeeded(FPlayerCache& Player)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    if (Player.bTriedDisk)
+    {
+        return;
+    }
+    Player.bTriedDisk = true;
+
+    if (CVarGameKitUserGameplayDataCachePersist.GetValueOnAnyThread() == 0)
+    {
+        return;
+    }
+
+    const FString& FilePath = Player.FilePath;
+    if (!IFileManager::Get().FileExists(*FilePath))
+    {
+        return;
+    }
+
+    // Map the file rather than reading it, only the pages of the bundles which are used are read
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    Player.MappedFile.Reset(PlatformFile.OpenMapped(*FilePath));
+    const int64 FileSize = Player.MappedFile.IsValid() ? Player.MappedFile->GetFileSize() : 0;
+    if (FileSize > 0 && FileSize <= MAX_int32)
+    {
+        Player.MappedRegion.Reset(Player.MappedFile->MapRegion(0, FileSize));
+    }
+
+    if (Player.MappedRegion.IsValid())
+    {
+        Player.DiskContents = TArrayView<const uint8>(Player.MappedRegion->GetMappedPtr(), static_cast<int32>(Player.MappedRegion->GetMappedSize()));
+    }
+    else
+    {
+        // Platforms which can't map files
+        Player.MappedFile.Reset();
+        if (!FFileHelper::LoadFileToArray(Player.LoadedFile, *FilePath, FILEREAD_Silent))
+        {
+            return;
+        }
+        Player.DiskContents = Player.LoadedFile;
+    }
+
+    FMemoryReaderView Reader(Player.DiskContents);
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    Reader << Magic << Version;
+    if (Reader.IsError() || Magic != CACHE_FILE_MAGIC || Version != CACHE_FILE_VERSION)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache: Ignoring malformed cache file %s"), *FilePath);
+        ReleaseDisk(Player);
+        return;
+    }
+
+    // Only index the records here, their items are decoded when their bundle is first used
+    while (Reader.Tell() < Reader.TotalSize())
+    {
+        int32 RecordSize = 0;
+        Reader << RecordSize;
+        const int64 Offset = Reader.Tell();
+
+        FString BundleName;
+        if (!Reader.IsError() && RecordSize > 0 && Offset + RecordSize <= Reader.TotalSize())
+        {
+            Reader << BundleName;
+        }
+
+        if (Reader.IsError() || BundleName.IsEmpty() || Reader.Tell() > Offset + RecordSize)
+        {
+            // Keep the records before the malformed one
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache: Ignoring the end of malformed cache file %s"), *FilePath);
+            break;
+        }
+
+        Player.DiskRecords.Add(MoveTemp(BundleName), FDiskRecord{ Offset, RecordSize });
+        Reader.Seek(Offset + RecordSize);
+    }
+
+    UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitUserGameplayDataCache: Found %d bundles on disk"), Player.DiskRecords.Num());
+}
+
+void FAwsGameKitUserGameplayDataCache::LoadFromDiskIfNeeded(FPlayerCache& Player, const FString& BundleName)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    LoadFromDiskIfNeeded(Player);
+
+    FDiskRecord Record;
+    if (!Player.DiskRecords.RemoveAndCopyValue(BundleName, Record))
+    {
+        return;
+    }
+
+    FMemoryReaderView Reader(Player.DiskContents.Slice(static_cast<int32>(Record.Offset), static_cast<int32>(Record.Size)));
+    FString StoredBundleName;
+    uint8 bComplete = 0;
+    int64 FetchedAtTicks = 0;
+    int32 ItemCount = 0;
+    Reader << StoredBundleName << bComplete << FetchedAtTicks << ItemCount;
+
+    FCachedBundle Cached;
+    Cached.bComplete = bComplete != 0;
+    Cached.FetchedAt = FDateTime(FetchedAtTicks);
+    Cached.LastUsed = FPlatformTime::Seconds();
+    Cached.Items.Reserve(FMath::Clamp(ItemCount, 0, static_cast<int32>(Record.Size)));
+    for (int32 i = 0; i < ItemCount && !Reader.IsError(); ++i)
+    {
+        FString BundleItemKey;
+        FCachedItem Item;
+        int64 StoredAtTicks = 0;
+        Reader << BundleItemKey << Item.Value << StoredAtTicks;
+        Item.StoredAt = FDateTime(StoredAtTicks);
+        Cached.Items.Add(MoveTemp(BundleItemKey), MoveTemp(Item));
+    }
+
+    if (Reader.IsError() || ItemCount < 0)
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCache: Ignoring malformed cached bundle %s"), *BundleName);
+        return;
+    }
+
+    Player.Bundles.Add(BundleName, MoveTemp(Cached));
+}
+
+void FAwsGameKitUserGameplayDataCache::ReleaseDisk(FPlayerCache& Player)
+{
+    Player.DiskRecords.Reset();
+    Player.DiskContents = TArrayView<const uint8>();
+    Player.MappedRegion.Reset();
+    Player.MappedFile.Reset();
+    Player.LoadedFile.Empty();
+}
+
+TArray<uint8> FAwsGameKitUserGameplayDataCache::Serialize(const FPlayerCache& Player, TMap<FString, FDiskRecord>& OutDiskRecords)
+{
+    TArray<uint8> Contents;
+    FMemoryWriter Writer(Contents);
+
+    uint32 Magic = CACHE_FILE_MAGIC;
+    uint32 Version = CACHE_FILE_VERSION;
+    Writer << Magic << Version;
+
+    for (const TPair<FString, FCachedBundle>& Bundle : Player.Bundles)
+    {
+        // The record size is patched once the record is written
+        const int64 SizeOffset = Writer.Tell();
+        int32 RecordSize = 0;
+        Writer << RecordSize;
+
+        uint8 bComplete = Bundle.Value.bComplete ? 1 : 0;
+        int64 FetchedAtTicks = Bundle.Value.FetchedAt.GetTicks();
+        int32 ItemCount = Bundle.Value.Items.Num();
+        Writer << const_cast<FString&>(Bundle.Key) << bComplete << FetchedAtTicks << ItemCount;
+        for (const TPair<FString, FCachedItem>& Item : Bundle.Value.Items)
+        {
+            int64 StoredAtTicks = Item.Value.StoredAt.GetTicks();
+            Writer << const_cast<FString&>(Item.Key) << const_cast<FString&>(Item.Value.Value) << StoredAtTicks;
+        }
+
+        const int64 EndOffset = Writer.Tell();
+        RecordSize = static_cast<int32>(EndOffset - SizeOffset - sizeof(int32));
+        Writer.Seek(SizeOffset);
+        Writer << RecordSize;
+        Writer.Seek(EndOffset);
+    }
+
+    // Bundles which were never decoded are copied as they are
+    for (const TPair<FString, FDiskRecord>& Record : Player.DiskRecords)
+    {
+        int32 RecordSize = static_cast<int32>(Record.Value.Size);
+        Writer << RecordSize;
+        OutDiskRecords.Add(Record.Key, FDiskRecord{ Writer.Tell(), Record.Value.Size });
+        Writer.Serialize(const_cast<uint8*>(Player.DiskContents.GetData() + Record.Value.Offset), Record.Value.Size);
+    }
+
+    return Contents;
+}
+
+bool FAwsGameKitUserGameplayDataCache::IsStale(const FDateTime& StoredAt)
+{
+    const FTimespan Ttl = FTimespan::FromSeconds(FMath::Max(0, CVarGameKitUserGameplayDataCacheTtlSeconds.GetValueOnAnyThread()));
+    return FDateTime::UtcNow() - StoredAt >= Ttl;
+}
+
+FString FAwsGameKitUserGameplayDataCache::GetCacheFilePath(const FString& ForPlayerId)
+{
+    const FString FileName = FString::Printf(TEXT("UserGameplayDataCache_%s.bin"), *FPaths::MakeValidFileName(ForPlayerId));
+    return FPaths::Combine(UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::UserGameplayData), FileName);
+}
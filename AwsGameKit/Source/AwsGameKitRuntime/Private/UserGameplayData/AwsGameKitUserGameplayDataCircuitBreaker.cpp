@@ -0,0 +1,154 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "Core/AwsGameKitErrors.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataStateHandler.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataCircuitBreakerFailureThreshold(
+    TEXT("GameKit.UserGameplayData.CircuitBreaker.FailureThreshold"),
+    0,
+    TEXT("Number of consecutive failed User Gameplay Data calls which open the circuit breaker, see FAwsGameKitUserGameplayDataCircuitBreaker.\n")
+    TEXT("  0: disabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitUserGameplayDataCircuitBreakerOpenBaseSeconds(
+    TEXT("GameKit.UserGameplayData.CircuitBreaker.OpenBaseSeconds"),
+    5.0f,
+    TEXT("Shortest time in seconds the circuit breaker stays open before it lets a probe through.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGameKitUserGameplayDataCircuitBreakerOpenMaxSeconds(
+    TEXT("GameKit.UserGameplayData.CircuitBreaker.OpenMaxSeconds"),
+    120.0f,
+    TEXT("Longest time in seconds the circuit breaker stays open before it lets a probe through.\n"),
+    ECVF_Default);
+
+namespace
+{
+    // A probe whose result is never recorded, for example because its bundle was deleted meanwhile, doesn't keep the breaker half open
+    const double PROBE_TIMEOUT_SECONDS = 30.0;
+
+    bool IsFailure(unsigned int StatusCode)
+    {
+        return StatusCode == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED
+            || StatusCode == GameKit::GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_FAILED
+            || StatusCode == GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED;
+    }
+}
+
+FAwsGameKitUserGameplayDataCircuitBreaker& FAwsGameKitUserGameplayDataCircuitBreaker::Get()
+{
+    static FAwsGameKitUserGameplayDataCircuitBreaker Instance;
+    return Instance;
+}
+
+bool FAwsGameKitUserGameplayDataCircuitBreaker::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataCircuitBreakerFailureThreshold.GetValueOnAnyThread() > 0;
+}
+
+UserGameplayDataCircuitState_E FAwsGameKitUserGameplayDataCircuitBreaker::GetState() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return State;
+}
+
+bool FAwsGameKitUserGameplayDataCircuitBreaker::TryAcquire()
+{
+    FScopeLock ScopeLock(&Mutex);
+    const double Now = FPlatformTime::Seconds();
+    switch (State)
+    {
+    case UserGameplayDataCircuitState_E::Open:
+        if (Now < ReopenAt)
+        {
+            return false;
+        }
+        ProbeGrantedAt = Now;
+        SetState(UserGameplayDataCircuitState_E::HalfOpen);
+        return true;
+
+    case UserGameplayDataCircuitState_E::HalfOpen:
+        if (Now - ProbeGrantedAt < PROBE_TIMEOUT_SECONDS)
+        {
+            return false;
+        }
+        ProbeGrantedAt = Now;
+        return true;
+
+    default:
+        return true;
+    }
+}
+
+void FAwsGameKitUserGameplayDataCircuitBreaker::RecordResult(unsigned int StatusCode)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Mutex);
+    if (!IsFailure(StatusCode))
+    {
+        ConsecutiveFailures = 0;
+        OpenSeconds = 0.0;
+        SetState(UserGameplayDataCircuitState_E::Closed);
+        return;
+    }
+
+    ++ConsecutiveFailures;
+    const bool bProbeFailed = State == UserGameplayDataCircuitState_E::HalfOpen;
+    if (bProbeFailed || (State == UserGameplayDataCircuitState_E::Closed && ConsecutiveFailures >= CVarGameKitUserGameplayDataCircuitBreakerFailureThreshold.GetValueOnAnyThread()))
+    {
+        const double BaseSeconds = FMath::Max(0.0f, CVarGameKitUserGameplayDataCircuitBreakerOpenBaseSeconds.GetValueOnAnyThread());
+        const double MaxSeconds = FMath::Max<double>(BaseSeconds, CVarGameKitUserGameplayDataCircuitBreakerOpenMaxSeconds.GetValueOnAnyThread());
+        OpenSeconds = GetDecorrelatedJitterDelay(BaseSeconds, MaxSeconds, OpenSeconds);
+        ReopenAt = FPlatformTime::Seconds() + OpenSeconds;
+
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCircuitBreaker: %d consecutive failures, open for %.1f seconds"), ConsecutiveFailures, OpenSeconds);
+        SetState(UserGameplayDataCircuitState_E::Open);
+    }
+}
+
+double FAwsGameKitUserGameplayDataCircuitBreaker::GetDecorrelatedJitterDelay(double BaseSeconds, double MaxSeconds, double PreviousSeconds)
+{
+    return FMath::Min(MaxSeconds, FMath::FRandRange(BaseSeconds, FMath::Max(BaseSeconds, PreviousSeconds * 3.0)));
+}
+
+void FAwsGameKitUserGameplayDataCircuitBreaker::SetState(UserGameplayDataCircuitState_E NewState)
+{
+    if (State == NewState)
+    {
+        return;
+    }
+    State = NewState;
+
+    AsyncTask(ENamedThreads::GameThread, [NewState]()
+    {
+        // The module may be shutting down
+        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+        if (runtimeModule == nullptr)
+        {
+            return;
+        }
+
+        const UserGameplayDataLibrary& library = runtimeModule->GetUserGameplayDataLibrary();
+        if (library.UserGameplayDataStateHandler.IsValid())
+        {
+            library.UserGameplayDataStateHandler->onCircuitBreakerStateChangeDelegate.ExecuteIfBound(NewState);
+        }
+    });
+}
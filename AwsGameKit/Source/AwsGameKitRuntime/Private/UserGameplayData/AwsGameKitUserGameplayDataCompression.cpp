@@ -0,0 +1,112 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataCompression.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/Base64.h"
+#include "Misc/Compression.h"
+
+// Standard library
+#include <cstdlib>
+#include <cstring>
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataCompressionMinBytes(
+    TEXT("GameKit.UserGameplayData.Compression.MinBytes"),
+    0,
+    TEXT("UTF-8 size in bytes from which bundle item values are compressed before they are written, see FAwsGameKitUserGameplayDataCompression.\n")
+    TEXT("  0: disabled\n"),
+    ECVF_Default);
+
+namespace
+{
+    const char COMPRESSED_VALUE_MARKER[] = "gkz1:";
+    const size_t COMPRESSED_VALUE_MARKER_LENGTH = sizeof(COMPRESSED_VALUE_MARKER) - 1;
+
+    // Guards against a malformed size in a value read from the backend
+    const int32 MAX_UNCOMPRESSED_SIZE = 16 * 1024 * 1024;
+}
+
+bool FAwsGameKitUserGameplayDataCompression::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataCompressionMinBytes.GetValueOnAnyThread() > 0;
+}
+
+bool FAwsGameKitUserGameplayDataCompression::Compress(const char* Value, std::string& OutCompressed)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    const int32 MinBytes = CVarGameKitUserGameplayDataCompressionMinBytes.GetValueOnAnyThread();
+    if (MinBytes <= 0 || Value == nullptr)
+    {
+        return false;
+    }
+
+    const size_t ValueLength = strlen(Value);
+    if (ValueLength < static_cast<size_t>(MinBytes) || ValueLength > static_cast<size_t>(MAX_UNCOMPRESSED_SIZE))
+    {
+        return false;
+    }
+
+    const int32 UncompressedSize = static_cast<int32>(ValueLength);
+    TArray<uint8> Compressed;
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Value, UncompressedSize))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCompression::Compress(): Failed to compress a %d byte value, writing it uncompressed"), UncompressedSize);
+        return false;
+    }
+
+    const FString Encoded = FBase64::Encode(Compressed.GetData(), static_cast<uint32>(CompressedSize));
+    std::string Result(COMPRESSED_VALUE_MARKER);
+    Result += std::to_string(UncompressedSize);
+    Result += ':';
+    Result += TCHAR_TO_UTF8(*Encoded);
+
+    if (Result.size() >= ValueLength)
+    {
+        return false;
+    }
+
+    OutCompressed = MoveTemp(Result);
+    return true;
+}
+
+bool FAwsGameKitUserGameplayDataCompression::Decompress(const char* Value, std::string& OutDecompressed)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    if (Value == nullptr || strncmp(Value, COMPRESSED_VALUE_MARKER, COMPRESSED_VALUE_MARKER_LENGTH) != 0)
+    {
+        return false;
+    }
+
+    const char* SizeStart = Value + COMPRESSED_VALUE_MARKER_LENGTH;
+    char* SizeEnd = nullptr;
+    const long UncompressedSize = strtol(SizeStart, &SizeEnd, 10);
+    if (SizeEnd == SizeStart || *SizeEnd != ':' || UncompressedSize <= 0 || UncompressedSize > MAX_UNCOMPRESSED_SIZE)
+    {
+        return false;
+    }
+
+    TArray<uint8> Compressed;
+    if (!FBase64::Decode(FString(UTF8_TO_TCHAR(SizeEnd + 1)), Compressed))
+    {
+        return false;
+    }
+
+    std::string Result;
+    Result.resize(static_cast<size_t>(UncompressedSize));
+    if (!FCompression::UncompressMemory(NAME_Zlib, &Result[0], static_cast<int32>(UncompressedSize), Compressed.GetData(), Compressed.Num()))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataCompression::Decompress(): Failed to decompress a value, returning it as it is"));
+        return false;
+    }
+
+    OutDecompressed = MoveTemp(Result);
+    return true;
+}
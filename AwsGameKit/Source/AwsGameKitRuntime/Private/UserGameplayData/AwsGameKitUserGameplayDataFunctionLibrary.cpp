@@ -10,6 +10,9 @@
 #include "AwsGameKitUserGameplayData.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Core/Logging.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
 
 // Unreal
 #include "LatentActions.h"
@@ -23,10 +26,9 @@ UAwsGameKitUserGameplayDataFunctionLibrary::UAwsGameKitUserGameplayDataFunctionL
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings(const FUserGameplayDataClientSettings& clientSettings)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
     UserGameplayDataClientSettings settings;
     settings.ClientTimeoutSeconds = clientSettings.ClientTimeoutSeconds;
@@ -38,6 +40,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetClientSettings(const FUserGa
     settings.PaginationSize = clientSettings.PaginationSize;
 
     library.UserGameplayDataWrapper->GameKitSetUserGameplayDataClientSettings(library.UserGameplayDataInstanceHandle, settings);
+    FAwsGameKitUserGameplayDataWriteBehind::Get().SetClientSettings(clientSettings);
 }
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
@@ -48,15 +51,15 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
     FUserGameplayDataBundle& UnprocessedItems,
     FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "AddBundle", userGameplayDataBundle.BundleName);
 
     TAwsGameKitInternalActionStatePtr<FUserGameplayDataBundle> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundle, SuccessOrFailure, Error, UnprocessedItems))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundle, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.AddBundle"), [userGameplayDataBundle, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             int32 pairCount = userGameplayDataBundle.BundleMap.Num();
             IntResult result;
@@ -69,44 +72,42 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
             }
             else
             {
-                // Preallocate with expected size to prevent pointers becoming invalid
-                // when array expands and data is copied.
-                TArray<std::string> bundleItemKeys;
-                bundleItemKeys.SetNum(pairCount);
-                TArray<const char*> bundleItemKeysChrArray;
-                bundleItemKeysChrArray.SetNum(pairCount);
+                // Size the arena from the inputs first so that every string is converted into one allocation.
+                int32 convertedSize = FAwsGameKitInternalTempStrings::GetConvertedSize(userGameplayDataBundle.BundleName);
+                for (const auto& item : userGameplayDataBundle.BundleMap)
+                {
+                    convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(item.Key) + FAwsGameKitInternalTempStrings::GetConvertedSize(item.Value);
+                }
+                FAwsGameKitInternalTempStrings ConvertString;
+                ConvertString.Reserve(convertedSize);
 
-                TArray<std::string> bundleItemValues;
-                bundleItemValues.SetNum(pairCount);
+                TArray<const char*> bundleItemKeysChrArray;
+                bundleItemKeysChrArray.Reserve(pairCount);
                 TArray<const char*> bundleItemValuesChrArray;
-                bundleItemValuesChrArray.SetNum(pairCount);
+                bundleItemValuesChrArray.Reserve(pairCount);
 
-                int i = 0;
-                for (auto it = userGameplayDataBundle.BundleMap.begin(); it != userGameplayDataBundle.BundleMap.end(); ++it)
+                for (const auto& item : userGameplayDataBundle.BundleMap)
                 {
-                    const FString& key = it.Key();
-                    const FString& value = it.Value();
-
-                    bundleItemKeys[i] = TCHAR_TO_UTF8(*key);
-                    bundleItemValues[i] = TCHAR_TO_UTF8(*value);
-
-                    bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
-                    bundleItemValuesChrArray[i] = bundleItemValues[i].c_str();
-
-                    i++;
+                    bundleItemKeysChrArray.Add(ConvertString(item.Key));
+                    bundleItemValuesChrArray.Add(ConvertString(item.Value));
                 }
 
-                std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundle.BundleName);
-                State->Results.BundleName = bundleName.c_str();
+                const char* bundleName = ConvertString(userGameplayDataBundle.BundleName);
+                State->Results.BundleName = userGameplayDataBundle.BundleName;
                 UserGameplayDataBundle wrapperArgs
                 {
-                    bundleName.c_str(),
+                    bundleName,
                     (bundleItemKeysChrArray.GetData()),
                     (bundleItemValuesChrArray.GetData()),
                     size_t(pairCount)
                 };
 
+                const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
                 result = IntResult(library.UserGameplayDataWrapper->GameKitAddUserGameplayData(library.UserGameplayDataInstanceHandle, State->Results.BundleMap, wrapperArgs));
+                if ((result.Result == GameKit::GAMEKIT_SUCCESS || result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED) && FAwsGameKitUserGameplayDataCache::IsEnabled())
+                {
+                    FAwsGameKitUserGameplayDataCache::Get().StoreItems(cacheGeneration, userGameplayDataBundle, State->Results.BundleMap);
+                }
             }
 
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -116,15 +117,15 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::AddBundle(
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::ListBundles(UObject* WorldContextObject, FLatentActionInfo LatentInfo, TArray<FString>& Results, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::ListBundles()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::ListBundles()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "ListBundles");
 
     TAwsGameKitInternalActionStatePtr<TArray<FString>> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error, Results))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.ListBundles"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             IntResult result(library.UserGameplayDataWrapper->GameKitListUserGameplayDataBundles(library.UserGameplayDataInstanceHandle, State->Results));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
@@ -134,18 +135,61 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::ListBundles(UObject* WorldConte
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundle(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& userGameplayDataBundleName, FUserGameplayDataBundle& Result, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundle()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundle()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundle", userGameplayDataBundleName);
 
     TAwsGameKitInternalActionStatePtr<FUserGameplayDataBundle> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleName, SuccessOrFailure, Error, Result))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundleName, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.GetBundle"), [userGameplayDataBundleName, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             State->Results.BundleName = userGameplayDataBundleName;
+            const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
             IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, State->Results.BundleMap, TCHAR_TO_UTF8(*userGameplayDataBundleName)));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitUserGameplayDataCache::IsEnabled())
+            {
+                FAwsGameKitUserGameplayDataCache::Get().StoreBundle(cacheGeneration, State->Results);
+            }
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
+}
+
+void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleStreamed(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FUserGameplayDataStreamBundleRequest& Request, const FDelegateOnGetBundleResultReceived OnPartialResults, FUserGameplayDataBundle& Results, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleStreamed()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundleStreamed");
+
+    TAwsGameKitInternalActionStatePtr<FUserGameplayDataBundle> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, Request, SuccessOrFailure, Error, Results, OnPartialResults))
+    {
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.GetBundleStreamed"), [Request, State]
+        {
+            IntResult result = AwsGameKitUserGameplayData::GetBundleStreamedBlocking(Request, [&State](FUserGameplayDataBundle&& page)
+            {
+                if (State->PartialResultsQueue)
+                {
+                    State->EnqueuePartialResults(MoveTemp(page));
+                }
+            }, State->Results);
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
+}
+
+void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundles(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const TArray<FString>& userGameplayDataBundleNames, TArray<FUserGameplayDataBundle>& Results, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundles()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundles");
+
+    TAwsGameKitInternalActionStatePtr<TArray<FUserGameplayDataBundle>> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleNames, SuccessOrFailure, Error, Results))
+    {
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.GetBundles"), [userGameplayDataBundleNames, State]
+        {
+            IntResult result = AwsGameKitUserGameplayData::GetBundlesBlocking(userGameplayDataBundleNames, State->Results);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -153,15 +197,15 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundle(UObject* WorldContext
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FUserGameplayDataBundleItem& userGameplayDataBundleItem, FUserGameplayDataBundleItemValue& Result, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "GetBundleItem", userGameplayDataBundleItem.BundleName);
 
     TAwsGameKitInternalActionStatePtr<FUserGameplayDataBundleItemValue> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleItem, SuccessOrFailure, Error, Result))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundleItem, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.GetBundleItem"), [userGameplayDataBundleItem, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             FAwsGameKitInternalTempStrings ConvertString;
             UserGameplayDataBundleItem wrapperArgs
@@ -172,7 +216,12 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem(UObject* WorldCon
 
             State->Results.BundleName = userGameplayDataBundleItem.BundleName;
             State->Results.BundleItemKey = userGameplayDataBundleItem.BundleItemKey;
+            const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
             IntResult result(library.UserGameplayDataWrapper->GameKitGetUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, State->Results.BundleItemValue, wrapperArgs));
+            if (result.Result == GameKit::GAMEKIT_SUCCESS && FAwsGameKitUserGameplayDataCache::IsEnabled())
+            {
+                FAwsGameKitUserGameplayDataCache::Get().StoreItem(cacheGeneration, State->Results.BundleName, State->Results.BundleItemKey, State->Results.BundleItemValue);
+            }
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -180,15 +229,15 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::GetBundleItem(UObject* WorldCon
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "UpdateItem", userGameplayDataBundleItemValue.BundleName, userGameplayDataBundleItemValue.BundleItemValue.Len());
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleItemValue, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundleItemValue, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.UpdateItem"), [userGameplayDataBundleItemValue, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
             FAwsGameKitInternalTempStrings ConvertString;
             UserGameplayDataBundleItemValue wrapperArgs
@@ -198,7 +247,28 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem(UObject* WorldContex
                 ConvertString(*userGameplayDataBundleItemValue.BundleItemValue)
             };
 
+            const uint32 cacheGeneration = FAwsGameKitUserGameplayDataCache::Get().GetGeneration();
             IntResult result(library.UserGameplayDataWrapper->GameKitUpdateUserGameplayDataBundleItem(library.UserGameplayDataInstanceHandle, wrapperArgs));
+            if ((result.Result == GameKit::GAMEKIT_SUCCESS || result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED) && FAwsGameKitUserGameplayDataCache::IsEnabled())
+            {
+                FAwsGameKitUserGameplayDataCache::Get().StoreItem(cacheGeneration, userGameplayDataBundleItemValue.BundleName, userGameplayDataBundleItemValue.BundleItemKey, userGameplayDataBundleItemValue.BundleItemValue);
+            }
+            State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
+        });
+    }
+}
+
+void UAwsGameKitUserGameplayDataFunctionLibrary::IncrementBundleItem(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta, FUserGameplayDataBundleItemValue& Result, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::IncrementBundleItem()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "IncrementBundleItem", userGameplayDataBundleItem.BundleName);
+
+    TAwsGameKitInternalActionStatePtr<FUserGameplayDataBundleItemValue> State;
+    if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleItem, SuccessOrFailure, Error, Result))
+    {
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.IncrementBundleItem"), [userGameplayDataBundleItem, Delta, State]
+        {
+            IntResult result = AwsGameKitUserGameplayData::IncrementBundleItemBlocking(userGameplayDataBundleItem, Delta, State->Results);
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
@@ -206,16 +276,18 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::UpdateItem(UObject* WorldContex
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteAllData(UObject* WorldContextObject, FLatentActionInfo LatentInfo, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteAllData()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteAllData()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteAllData");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, nullptr, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.DeleteAllData"), [State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
+            FAwsGameKitUserGameplayDataWriteBehind::Get().DiscardAll();
+            FAwsGameKitUserGameplayDataCache::Get().InvalidateAll();
             IntResult result(library.UserGameplayDataWrapper->GameKitDeleteAllUserGameplayData(library.UserGameplayDataInstanceHandle));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
@@ -224,16 +296,18 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteAllData(UObject* WorldCon
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundle(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& userGameplayDataBundleName, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundle()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundle()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteBundle", userGameplayDataBundleName);
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleName, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundleName, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.DeleteBundle"), [userGameplayDataBundleName, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
+            FAwsGameKitUserGameplayDataWriteBehind::Get().Discard(userGameplayDataBundleName);
+            FAwsGameKitUserGameplayDataCache::Get().InvalidateBundle(userGameplayDataBundleName);
             IntResult result(library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundle(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*userGameplayDataBundleName)));
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
@@ -242,15 +316,15 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundle(UObject* WorldCont
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "DeleteBundleItems");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, userGameplayDataBundleItemsDeleteRequest, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([userGameplayDataBundleItemsDeleteRequest, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.DeleteBundleItems"), [userGameplayDataBundleItemsDeleteRequest, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             IntResult result;
 
             if (userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num() == 0 ||
@@ -262,31 +336,36 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems(UObject* Worl
             }
             else
             {
-                // Preallocate with expected size to prevent pointers becoming invalid
-                // when array expands and data is copied.
                 int32 numKeys = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys.Num();
-                TArray<std::string> bundleItemKeys;
-                bundleItemKeys.SetNum(numKeys);
-                TArray<const char*> bundleItemKeysChrArray;
-                bundleItemKeysChrArray.SetNum(numKeys);
 
-                for (int i = 0; i < numKeys; i++)
+                // Size the arena from the inputs first so that every string is converted into one allocation.
+                int32 convertedSize = FAwsGameKitInternalTempStrings::GetConvertedSize(userGameplayDataBundleItemsDeleteRequest.BundleName);
+                for (const FString& itemKey : userGameplayDataBundleItemsDeleteRequest.BundleItemKeys)
                 {
-                    auto& itemKey = userGameplayDataBundleItemsDeleteRequest.BundleItemKeys[i];
+                    convertedSize += FAwsGameKitInternalTempStrings::GetConvertedSize(itemKey);
+                }
+                FAwsGameKitInternalTempStrings ConvertString;
+                ConvertString.Reserve(convertedSize);
 
-                    bundleItemKeys[i] = TCHAR_TO_UTF8(*itemKey);
+                TArray<const char*> bundleItemKeysChrArray;
+                bundleItemKeysChrArray.Reserve(numKeys);
 
-                    bundleItemKeysChrArray[i] = bundleItemKeys[i].c_str();
+                for (const FString& itemKey : userGameplayDataBundleItemsDeleteRequest.BundleItemKeys)
+                {
+                    bundleItemKeysChrArray.Add(ConvertString(itemKey));
                 }
 
-                std::string bundleName = TCHAR_TO_UTF8(*userGameplayDataBundleItemsDeleteRequest.BundleName);
+                const char* bundleName = ConvertString(userGameplayDataBundleItemsDeleteRequest.BundleName);
                 UserGameplayDataDeleteItemsRequest wrapperArgs
                 {
-                    bundleName.c_str(),
+                    bundleName,
                     (bundleItemKeysChrArray.GetData()),
                     size_t(numKeys)
                 };
 
+                FAwsGameKitUserGameplayDataWriteBehind::Get().Discard(userGameplayDataBundleItemsDeleteRequest.BundleName, userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
+                FAwsGameKitUserGameplayDataCache::Get().InvalidateBundle(userGameplayDataBundleItemsDeleteRequest.BundleName, userGameplayDataBundleItemsDeleteRequest.BundleItemKeys);
+
                 result = library.UserGameplayDataWrapper->GameKitDeleteUserGameplayDataBundleItems(library.UserGameplayDataInstanceHandle, wrapperArgs);
             }
 
@@ -297,7 +376,7 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::DeleteBundleItems(UObject* Worl
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::SetNetworkChangeDelegate(const FNetworkStatusChangeDelegate& NetworkStatusChangeDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetNetworkChangeDelegate()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetNetworkChangeDelegate()"));
 
     if (NetworkStatusChangeDelegate.IsBound())
     {
@@ -311,18 +390,16 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetNetworkChangeDelegate(const
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::SetCacheProcessedDelegate(const FCacheProcessedDelegate& CacheProcessedDelegate)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetCacheProcessedDelegate()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetCacheProcessedDelegate()"));
 
     if (CacheProcessedDelegate.IsBound())
     {
-        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-        UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
         library.UserGameplayDataStateHandler->SetCacheProcessedDelegate(CacheProcessedDelegate);
 
         auto cacheProcessedDelegateExecutor = [](const bool isCacheProcessed)
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
             library.UserGameplayDataStateHandler->onCacheProcessedDelegate.ExecuteIfBound(isCacheProcessed);
         };
         typedef LambdaDispatcher<decltype(cacheProcessedDelegateExecutor), void, const bool> CacheProcessedDelegateExecutor;
@@ -331,51 +408,79 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::SetCacheProcessedDelegate(const
     }
 }
 
+void UAwsGameKitUserGameplayDataFunctionLibrary::SetCircuitBreakerStateChangeDelegate(const FCircuitBreakerStateChangeDelegate& CircuitBreakerStateChangeDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetCircuitBreakerStateChangeDelegate()"));
+
+    if (CircuitBreakerStateChangeDelegate.IsBound())
+    {
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+        library.UserGameplayDataStateHandler->SetCircuitBreakerStateChangeDelegate(CircuitBreakerStateChangeDelegate);
+    }
+}
+
+UserGameplayDataCircuitState_E UAwsGameKitUserGameplayDataFunctionLibrary::GetCircuitBreakerState()
+{
+    return FAwsGameKitUserGameplayDataCircuitBreaker::Get().GetState();
+}
+
+void UAwsGameKitUserGameplayDataFunctionLibrary::SetRetryQueueStatsDelegate(const FRetryQueueStatsDelegate& RetryQueueStatsDelegate)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::SetRetryQueueStatsDelegate()"));
+
+    if (RetryQueueStatsDelegate.IsBound())
+    {
+        const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+        library.UserGameplayDataStateHandler->SetRetryQueueStatsDelegate(RetryQueueStatsDelegate);
+    }
+}
+
+FUserGameplayDataRetryQueueStats UAwsGameKitUserGameplayDataFunctionLibrary::GetRetryQueueStats()
+{
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+    return library.UserGameplayDataStateHandler.IsValid() ? library.UserGameplayDataStateHandler->GetRetryQueueStats() : FUserGameplayDataRetryQueueStats();
+}
+
 void UAwsGameKitUserGameplayDataFunctionLibrary::StartRetryBackgroundThread()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StartRetryBackgroundThread()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StartRetryBackgroundThread()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStartRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::StopRetryBackgroundThread()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StopRetryBackgroundThread()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StopRetryBackgroundThread()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataStopRetryBackgroundThread(library.UserGameplayDataInstanceHandle);
 }
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::DropAllCachedEvents()
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DropAllCachedEvents()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::DropAllCachedEvents()"));
 
-    FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-    UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
     library.UserGameplayDataWrapper->GameKitUserGameplayDataDropAllCachedEvents(library.UserGameplayDataInstanceHandle);
 }
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::PersistToCache(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& CacheFile, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::PersistToCache()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::PersistToCache()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "PersistToCache");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, CacheFile, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([CacheFile, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.PersistToCache"), [CacheFile, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
-
 #if PLATFORM_ANDROID
             // Convert to platform path
             FString androidCacheFilePath = IAndroidPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForWrite(*CacheFile);
-            IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataPersistApiCallsToCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*androidCacheFilePath)));
+            IntResult result = AwsGameKitUserGameplayData::PersistToCacheBlocking(CacheFile, androidCacheFilePath);
 #else
-            IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataPersistApiCallsToCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*CacheFile)));
+            IntResult result = AwsGameKitUserGameplayData::PersistToCacheBlocking(CacheFile, CacheFile);
 #endif
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
@@ -384,24 +489,82 @@ void UAwsGameKitUserGameplayDataFunctionLibrary::PersistToCache(UObject* WorldCo
 
 void UAwsGameKitUserGameplayDataFunctionLibrary::LoadFromCache(UObject* WorldContextObject, FLatentActionInfo LatentInfo, const FString& CacheFile, EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure, FAwsGameKitOperationResult& Error)
 {
-    UE_LOG(LogAwsGameKit, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::LoadFromCache()"));
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::LoadFromCache()"));
+    AWSGAMEKIT_TRACE_CALL("UserGameplayData", "LoadFromCache");
 
     TAwsGameKitInternalActionStatePtr<> State;
     if (auto Action = InternalMakeAwsGameKitThreadedAction(State, WorldContextObject, LatentInfo, CacheFile, SuccessOrFailure, Error))
     {
-        Action->LaunchThreadedWork([CacheFile, State]
+        Action->LaunchThreadedWork(TEXT("UserGameplayData.LoadFromCache"), [CacheFile, State]
         {
-            FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
-            UserGameplayDataLibrary library = runtimeModule->GetUserGameplayDataLibrary();
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
 
 #if PLATFORM_ANDROID
             // Convert to platform path
             FString androidCacheFilePath = IAndroidPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForRead(*CacheFile);
             IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataLoadApiCallsFromCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*androidCacheFilePath)));
+            AwsGameKitUserGameplayData::SetLastCacheFile(CacheFile, IAndroidPlatformFile::GetPlatformPhysical().ConvertToAbsolutePathForExternalAppForWrite(*CacheFile));
 #else
             IntResult result(library.UserGameplayDataWrapper->GameKitUserGameplayDataLoadApiCallsFromCache(library.UserGameplayDataInstanceHandle, TCHAR_TO_UTF8(*CacheFile)));
+            AwsGameKitUserGameplayData::SetLastCacheFile(CacheFile, CacheFile);
 #endif
+            FAwsGameKitUserGameplayDataWriteBehind::Get().ReplayJournal();
             State->Err = FAwsGameKitOperationResult{ static_cast<int>(result.Result), result.ErrorMessage };
         });
     }
 }
+
+void UAwsGameKitUserGameplayDataFunctionLibrary::StructToBundle(const int32& Struct, const FString& BundleName, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& Bundle)
+{
+    // Never called, Blueprints call execStructToBundle()
+    check(0);
+}
+
+bool UAwsGameKitUserGameplayDataFunctionLibrary::BundleToStruct(const FUserGameplayDataBundle& Bundle, int32& Struct)
+{
+    // Never called, Blueprints call execBundleToStruct()
+    check(0);
+    return false;
+}
+
+DEFINE_FUNCTION(UAwsGameKitUserGameplayDataFunctionLibrary::execStructToBundle)
+{
+    Stack.StepCompiledIn<FStructProperty>(nullptr);
+    const FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+    const void* StructData = Stack.MostRecentPropertyAddress;
+    P_GET_PROPERTY(FStrProperty, BundleName);
+    P_GET_ENUM(UserGameplayDataStructFormat_E, Format);
+    P_GET_STRUCT_REF(FUserGameplayDataBundle, Bundle);
+    P_FINISH;
+
+    if (StructProperty == nullptr || StructData == nullptr)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::StructToBundle() Struct isn't connected to a struct"));
+        return;
+    }
+
+    P_NATIVE_BEGIN;
+    Bundle.BundleName = BundleName;
+    FAwsGameKitUserGameplayDataStructSerializer::ToBundle(StructProperty->Struct, StructData, Format, Bundle);
+    P_NATIVE_END;
+}
+
+DEFINE_FUNCTION(UAwsGameKitUserGameplayDataFunctionLibrary::execBundleToStruct)
+{
+    P_GET_STRUCT_REF(FUserGameplayDataBundle, Bundle);
+    Stack.StepCompiledIn<FStructProperty>(nullptr);
+    const FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+    void* StructData = Stack.MostRecentPropertyAddress;
+    P_FINISH;
+
+    if (StructProperty == nullptr || StructData == nullptr)
+    {
+        UE_LOG(LogAwsGameKit, Error, TEXT("UAwsGameKitUserGameplayDataFunctionLibrary::BundleToStruct() Struct isn't connected to a struct"));
+        *static_cast<bool*>(RESULT_PARAM) = false;
+        return;
+    }
+
+    P_NATIVE_BEGIN;
+    *static_cast<bool*>(RESULT_PARAM) = FAwsGameKitUserGameplayDataStructSerializer::FromBundle(StructProperty->Struct, StructData, Bundle);
+    P_NATIVE_END;
+}
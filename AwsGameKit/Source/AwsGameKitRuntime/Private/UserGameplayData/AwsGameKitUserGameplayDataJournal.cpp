@@ -0,0 +1,41 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataJournal.h"
+
+// GameKit
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
+#include "Utils/Blueprints/UAwsGameKitFileUtils.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBehindJournal(
+    TEXT("GameKit.UserGameplayData.WriteBehind.Journal"),
+    0,
+    TEXT("Journals the buffered item updates to disk so that they are sent again after a crash, see FAwsGameKitUserGameplayDataJournal.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled, requires GameKit.UserGameplayData.WriteBehind.Enabled\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBehindJournalSyncIntervalMs(
+    TEXT("GameKit.UserGameplayData.WriteBehind.JournalSyncIntervalMs"),
+    1000,
+    TEXT("Maximum time in milliseconds an appended journal record waits before the journal is synced to disk.\n"),
+    ECVF_Default);
+
+bool FAwsGameKitUserGameplayDataJournal::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataWriteBehindJournal.GetValueOnAnyThread() != 0 && FAwsGameKitUserGameplayDataWriteBehind::IsEnabled();
+}
+
+void FAwsGameKitUserGameplayDataJournal::Open()
+{
+    FAwsGameKitOfflineJournal::Open(FPaths::Combine(UAwsGameKitFileUtils::GetFeatureSaveDirectory(FeatureType_E::UserGameplayData), TEXT("UserGameplayDataJournal.bin")));
+}
+
+void FAwsGameKitUserGameplayDataJournal::Tick()
+{
+    FAwsGameKitOfflineJournal::Tick(FMath::Max(0, CVarGameKitUserGameplayDataWriteBehindJournalSyncIntervalMs.GetValueOnAnyThread()) / 1000.0);
+}
@@ -3,9 +3,115 @@
 
 #include "UserGameplayData/AwsGameKitUserGameplayDataStateHandler.h"
 
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Common/AwsGameKitStats.h"
+
+// Unreal
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Modules/ModuleManager.h"
+
 void AwsGameKitUserGameplayDataStateHandler::SetCacheProcessedDelegate(const FCacheProcessedDelegate& cacheProcessedDelegate)
 {
     if (!this->onCacheProcessedDelegate.IsBound() && cacheProcessedDelegate.IsBound()) {
         this->onCacheProcessedDelegate = cacheProcessedDelegate;
     }
 }
+
+void AwsGameKitUserGameplayDataStateHandler::SetCircuitBreakerStateChangeDelegate(const FCircuitBreakerStateChangeDelegate& circuitBreakerStateChangeDelegate)
+{
+    if (circuitBreakerStateChangeDelegate.IsBound()) {
+        this->onCircuitBreakerStateChangeDelegate = circuitBreakerStateChangeDelegate;
+    }
+}
+
+void AwsGameKitUserGameplayDataStateHandler::SetRetryQueueStatsDelegate(const FRetryQueueStatsDelegate& retryQueueStatsDelegate)
+{
+    if (retryQueueStatsDelegate.IsBound()) {
+        this->onRetryQueueStatsDelegate = retryQueueStatsDelegate;
+    }
+}
+
+FUserGameplayDataRetryQueueStats AwsGameKitUserGameplayDataStateHandler::GetRetryQueueStats() const
+{
+    FUserGameplayDataRetryQueueStats stats;
+    stats.QueuedCalls = queuedCalls.load(std::memory_order_relaxed);
+    stats.QueuedBytes = queuedBytes.load(std::memory_order_relaxed);
+    stats.TotalEnqueuedCalls = totalEnqueuedCalls.load(std::memory_order_relaxed);
+    stats.NetworkOutages = networkOutages.load(std::memory_order_relaxed);
+    stats.IsNetworkHealthy = isNetworkHealthy.load(std::memory_order_relaxed);
+
+    const double oldest = oldestQueuedCallTime.load(std::memory_order_relaxed);
+    if (oldest > 0.0)
+    {
+        stats.OldestQueuedCallAgeSeconds = static_cast<float>(FPlatformTime::Seconds() - oldest);
+    }
+
+    return stats;
+}
+
+void AwsGameKitUserGameplayDataStateHandler::RecordCallEnqueued(int64 requestBytes)
+{
+    FAwsGameKitStats::SetRetryQueueSize(queuedCalls.fetch_add(1, std::memory_order_relaxed) + 1);
+    queuedBytes.fetch_add(requestBytes, std::memory_order_relaxed);
+    totalEnqueuedCalls.fetch_add(1, std::memory_order_relaxed);
+
+    // Only the first queued call sets the time
+    double noneQueued = 0.0;
+    oldestQueuedCallTime.compare_exchange_strong(noneQueued, FPlatformTime::Seconds(), std::memory_order_relaxed);
+
+    NotifyRetryQueueStats();
+}
+
+void AwsGameKitUserGameplayDataStateHandler::RecordNetworkStatus(bool isConnectionOk)
+{
+    const bool wasHealthy = isNetworkHealthy.exchange(isConnectionOk, std::memory_order_relaxed);
+    if (wasHealthy && !isConnectionOk)
+    {
+        networkOutages.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (isConnectionOk)
+    {
+        ResetQueuedCalls();
+        return;
+    }
+
+    NotifyRetryQueueStats();
+}
+
+void AwsGameKitUserGameplayDataStateHandler::ResetQueuedCalls()
+{
+    queuedCalls.store(0, std::memory_order_relaxed);
+    FAwsGameKitStats::SetRetryQueueSize(0);
+    queuedBytes.store(0, std::memory_order_relaxed);
+    oldestQueuedCallTime.store(0.0, std::memory_order_relaxed);
+
+    NotifyRetryQueueStats();
+}
+
+void AwsGameKitUserGameplayDataStateHandler::NotifyRetryQueueStats()
+{
+    // Changes made before the game thread gets to the pending notification are reported with it
+    if (isNotifyPending.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    AsyncTask(ENamedThreads::GameThread, []()
+    {
+        // The module may be shutting down
+        FAwsGameKitRuntimeModule* runtimeModule = FModuleManager::GetModulePtr<FAwsGameKitRuntimeModule>("AwsGameKitRuntime");
+        if (runtimeModule == nullptr)
+        {
+            return;
+        }
+
+        const UserGameplayDataLibrary& library = runtimeModule->GetUserGameplayDataLibrary();
+        if (library.UserGameplayDataStateHandler.IsValid())
+        {
+            library.UserGameplayDataStateHandler->isNotifyPending.store(false, std::memory_order_release);
+            library.UserGameplayDataStateHandler->onRetryQueueStatsDelegate.ExecuteIfBound(library.UserGameplayDataStateHandler->GetRetryQueueStats());
+        }
+    });
+}
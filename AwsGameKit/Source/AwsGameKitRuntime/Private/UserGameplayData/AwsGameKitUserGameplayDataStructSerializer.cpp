@@ -0,0 +1,454 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataStructSerializer.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "Core/AwsGameKitMemory.h"
+#include "Core/AwsGameKitTrace.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataUtf8Bundle.h"
+
+// Unreal
+#include "Misc/Base64.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+const TCHAR* FAwsGameKitUserGameplayDataStructSerializer::BINARY_ITEM_KEY = TEXT("struct");
+
+namespace
+{
+    const TCHAR* BINARY_MARKER = TEXT("gks1:");
+    const int32 BINARY_MARKER_LEN = 5;
+
+    bool IsSerialized(const FProperty* Property)
+    {
+        return !Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated);
+    }
+
+    FString GetItemKey(const FProperty* Property, int32 ArrayIndex)
+    {
+        return ArrayIndex == 0 ? Property->GetName() : FString::Printf(TEXT("%s.%d"), *Property->GetName(), ArrayIndex);
+    }
+
+    // Calls Visitor(Property, ArrayIndex, Key) for every serialized property element of the struct
+    template <typename VisitorType>
+    void ForEachElement(const UScriptStruct* StructType, VisitorType&& Visitor)
+    {
+        for (TFieldIterator<FProperty> It(StructType); It; ++It)
+        {
+            if (!IsSerialized(*It))
+            {
+                continue;
+            }
+
+            for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ArrayIndex++)
+            {
+                Visitor(*It, ArrayIndex);
+            }
+        }
+    }
+
+    // Finds the property element of an item key, the inverse of GetItemKey()
+    const FProperty* FindElement(const UScriptStruct* StructType, const FString& Key, int32& OutArrayIndex)
+    {
+        FString PropertyName = Key;
+        OutArrayIndex = 0;
+        int32 DotIndex;
+        if (Key.FindLastChar(TEXT('.'), DotIndex))
+        {
+            PropertyName = Key.Left(DotIndex);
+            if (!LexTryParseString(OutArrayIndex, *Key.Mid(DotIndex + 1)))
+            {
+                return nullptr;
+            }
+        }
+
+        const FProperty* Property = StructType->FindPropertyByName(FName(*PropertyName, FNAME_Find));
+        if (Property == nullptr || !IsSerialized(Property) || OutArrayIndex < 0 || OutArrayIndex >= Property->ArrayDim)
+        {
+            return nullptr;
+        }
+
+        return Property;
+    }
+
+    const UEnum* GetEnum(const FProperty* Property, const FNumericProperty*& OutUnderlying)
+    {
+        if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+        {
+            OutUnderlying = EnumProperty->GetUnderlyingProperty();
+            return EnumProperty->GetEnum();
+        }
+
+        const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+        OutUnderlying = ByteProperty;
+        return ByteProperty != nullptr ? ByteProperty->Enum : nullptr;
+    }
+
+    FString FormatValue(const FProperty* Property, const void* ValuePtr)
+    {
+        const FNumericProperty* Underlying = nullptr;
+        if (const UEnum* Enum = GetEnum(Property, Underlying))
+        {
+            return Enum->GetNameStringByValue(Underlying->GetSignedIntPropertyValue(ValuePtr));
+        }
+
+        if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+        {
+            return BoolProperty->GetPropertyValue(ValuePtr) ? TEXT("true") : TEXT("false");
+        }
+
+        if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+        {
+            // Enough significant digits to read the same value back
+            if (CastField<FFloatProperty>(Property) != nullptr)
+            {
+                return FString::Printf(TEXT("%.9g"), NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+            }
+            if (NumericProperty->IsFloatingPoint())
+            {
+                return FString::Printf(TEXT("%.17g"), NumericProperty->GetFloatingPointPropertyValue(ValuePtr));
+            }
+            if (CastField<FUInt64Property>(Property) != nullptr)
+            {
+                return FString::Printf(TEXT("%llu"), NumericProperty->GetUnsignedIntPropertyValue(ValuePtr));
+            }
+            return FString::Printf(TEXT("%lld"), NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+        }
+
+        if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+        {
+            return StrProperty->GetPropertyValue(ValuePtr);
+        }
+
+        if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+        {
+            return NameProperty->GetPropertyValue(ValuePtr).ToString();
+        }
+
+        if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+        {
+            return TextProperty->GetPropertyValue(ValuePtr).ToString();
+        }
+
+        FString Exported;
+        Property->ExportTextItem(Exported, ValuePtr, nullptr, nullptr, PPF_None);
+        return Exported;
+    }
+
+    // Parses the numbers and bools, which don't need the value as an FString. Returns false if the property isn't one of those.
+    template <typename CharType>
+    bool TryParseNumber(const FProperty* Property, void* ValuePtr, const CharType* Value, bool& bOutParsed)
+    {
+        if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+        {
+            const bool bTrue = TCString<CharType>::Stricmp(Value, LITERAL(CharType, "true")) == 0 || TCString<CharType>::Strcmp(Value, LITERAL(CharType, "1")) == 0;
+            const bool bFalse = TCString<CharType>::Stricmp(Value, LITERAL(CharType, "false")) == 0 || TCString<CharType>::Strcmp(Value, LITERAL(CharType, "0")) == 0;
+            bOutParsed = bTrue || bFalse;
+            if (bOutParsed)
+            {
+                BoolProperty->SetPropertyValue(ValuePtr, bTrue);
+            }
+            return true;
+        }
+
+        const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+        if (NumericProperty == nullptr || NumericProperty->IsEnum())
+        {
+            return false;
+        }
+
+        // The whole value has to be a number
+        CharType* End = nullptr;
+        if (NumericProperty->IsFloatingPoint())
+        {
+            const double Parsed = TCString<CharType>::Strtod(Value, &End);
+            bOutParsed = End != Value && *End == 0;
+            if (bOutParsed)
+            {
+                NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Parsed);
+            }
+        }
+        else if (CastField<FUInt64Property>(Property) != nullptr)
+        {
+            const uint64 Parsed = TCString<CharType>::Strtoui64(Value, &End, 10);
+            bOutParsed = End != Value && *End == 0;
+            if (bOutParsed)
+            {
+                NumericProperty->SetIntPropertyValue(ValuePtr, Parsed);
+            }
+        }
+        else
+        {
+            const int64 Parsed = TCString<CharType>::Strtoi64(Value, &End, 10);
+            bOutParsed = End != Value && *End == 0;
+            if (bOutParsed)
+            {
+                NumericProperty->SetIntPropertyValue(ValuePtr, Parsed);
+            }
+        }
+        return true;
+    }
+
+    bool ParseValue(const FProperty* Property, void* ValuePtr, const FString& Value)
+    {
+        bool bParsed = false;
+        if (TryParseNumber(Property, ValuePtr, *Value, bParsed))
+        {
+            return bParsed;
+        }
+
+        const FNumericProperty* Underlying = nullptr;
+        if (const UEnum* Enum = GetEnum(Property, Underlying))
+        {
+            const int64 EnumValue = Enum->GetValueByNameString(Value);
+            if (EnumValue == INDEX_NONE)
+            {
+                return false;
+            }
+            Underlying->SetIntPropertyValue(ValuePtr, EnumValue);
+            return true;
+        }
+
+        if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+        {
+            StrProperty->SetPropertyValue(ValuePtr, Value);
+            return true;
+        }
+
+        if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+        {
+            NameProperty->SetPropertyValue(ValuePtr, FName(*Value));
+            return true;
+        }
+
+        if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+        {
+            TextProperty->SetPropertyValue(ValuePtr, FText::FromString(Value));
+            return true;
+        }
+
+        return Property->ImportText(*Value, ValuePtr, PPF_None, nullptr) != nullptr;
+    }
+
+    FString ToBinaryValue(const UScriptStruct* StructType, const void* StructData)
+    {
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+
+        // Written first so that a newer engine reads the tagged properties as the writer's engine wrote them
+        FPackageFileVersion Version = Writer.UEVer();
+        int32 LicenseeVersion = Writer.LicenseeUEVer();
+        Writer << Version;
+        Writer << LicenseeVersion;
+
+        FObjectAndNameAsStringProxyArchive Archive(Writer, false);
+        StructType->SerializeTaggedProperties(Archive, static_cast<uint8*>(const_cast<void*>(StructData)), const_cast<UScriptStruct*>(StructType), nullptr);
+
+        return BINARY_MARKER + FBase64::Encode(Bytes);
+    }
+
+    bool FromBinaryValue(const UScriptStruct* StructType, void* StructData, const FString& Value)
+    {
+        TArray<uint8> Bytes;
+        if (!Value.StartsWith(BINARY_MARKER, ESearchCase::CaseSensitive) || !FBase64::Decode(Value.Mid(BINARY_MARKER_LEN), Bytes))
+        {
+            return false;
+        }
+
+        FMemoryReader Reader(Bytes);
+        FPackageFileVersion Version;
+        int32 LicenseeVersion = 0;
+        Reader << Version;
+        Reader << LicenseeVersion;
+        if (Reader.IsError())
+        {
+            return false;
+        }
+        Reader.SetUEVer(Version);
+        Reader.SetLicenseeUEVer(LicenseeVersion);
+
+        FObjectAndNameAsStringProxyArchive Archive(Reader, true);
+        StructType->SerializeTaggedProperties(Archive, static_cast<uint8*>(StructData), const_cast<UScriptStruct*>(StructType), nullptr);
+        return !Archive.IsError();
+    }
+
+    bool IsDirty(const FProperty* Property, int32 ArrayIndex, const void* StructData, const void* WrittenStructData)
+    {
+        return !Property->Identical(Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex), Property->ContainerPtrToValuePtr<void>(WrittenStructData, ArrayIndex), PPF_None);
+    }
+
+    bool IsAnyDirty(const UScriptStruct* StructType, const void* StructData, const void* WrittenStructData)
+    {
+        bool bDirty = false;
+        ForEachElement(StructType, [&](const FProperty* Property, int32 ArrayIndex)
+        {
+            bDirty = bDirty || IsDirty(Property, ArrayIndex, StructData, WrittenStructData);
+        });
+        return bDirty;
+    }
+}
+
+void FAwsGameKitUserGameplayDataStructSerializer::ToBundle(const UScriptStruct* StructType, const void* StructData, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& OutBundle)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    AWSGAMEKIT_TRACE_PHASE(Marshalling);
+
+    OutBundle.BundleMap.Reset();
+    if (Format == UserGameplayDataStructFormat_E::Binary)
+    {
+        OutBundle.BundleMap.Add(BINARY_ITEM_KEY, ToBinaryValue(StructType, StructData));
+        return;
+    }
+
+    ForEachElement(StructType, [&](const FProperty* Property, int32 ArrayIndex)
+    {
+        OutBundle.BundleMap.Add(GetItemKey(Property, ArrayIndex), FormatValue(Property, Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex)));
+    });
+}
+
+bool FAwsGameKitUserGameplayDataStructSerializer::ToBundleDelta(const UScriptStruct* StructType, const void* StructData, const void* WrittenStructData, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& OutDelta)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    AWSGAMEKIT_TRACE_PHASE(Marshalling);
+
+    OutDelta.BundleMap.Reset();
+    if (Format == UserGameplayDataStructFormat_E::Binary)
+    {
+        if (!IsAnyDirty(StructType, StructData, WrittenStructData))
+        {
+            return false;
+        }
+
+        OutDelta.BundleMap.Add(BINARY_ITEM_KEY, ToBinaryValue(StructType, StructData));
+        return true;
+    }
+
+    // Only the changed properties are formatted
+    ForEachElement(StructType, [&](const FProperty* Property, int32 ArrayIndex)
+    {
+        if (IsDirty(Property, ArrayIndex, StructData, WrittenStructData))
+        {
+            OutDelta.BundleMap.Add(GetItemKey(Property, ArrayIndex), FormatValue(Property, Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex)));
+        }
+    });
+    return OutDelta.BundleMap.Num() > 0;
+}
+
+TArray<FString> FAwsGameKitUserGameplayDataStructSerializer::GetDirtyKeys(const UScriptStruct* StructType, const void* StructData, const void* WrittenStructData, UserGameplayDataStructFormat_E Format)
+{
+    TArray<FString> DirtyKeys;
+    if (Format == UserGameplayDataStructFormat_E::Binary)
+    {
+        if (IsAnyDirty(StructType, StructData, WrittenStructData))
+        {
+            DirtyKeys.Add(BINARY_ITEM_KEY);
+        }
+        return DirtyKeys;
+    }
+
+    ForEachElement(StructType, [&](const FProperty* Property, int32 ArrayIndex)
+    {
+        if (IsDirty(Property, ArrayIndex, StructData, WrittenStructData))
+        {
+            DirtyKeys.Add(GetItemKey(Property, ArrayIndex));
+        }
+    });
+    return DirtyKeys;
+}
+
+bool FAwsGameKitUserGameplayDataStructSerializer::FromBundle(const UScriptStruct* StructType, void* StructData, const FUserGameplayDataBundle& Bundle)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    AWSGAMEKIT_TRACE_PHASE(Marshalling);
+
+    if (const FString* BinaryValue = Bundle.BundleMap.Find(BINARY_ITEM_KEY))
+    {
+        if (BinaryValue->StartsWith(BINARY_MARKER, ESearchCase::CaseSensitive))
+        {
+            return FromBinaryValue(StructType, StructData, *BinaryValue);
+        }
+    }
+
+    bool bAllParsed = true;
+    for (const TPair<FString, FString>& Item : Bundle.BundleMap)
+    {
+        int32 ArrayIndex;
+        if (const FProperty* Property = FindElement(StructType, Item.Key, ArrayIndex))
+        {
+            if (!ParseValue(Property, Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex), Item.Value))
+            {
+                UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataStructSerializer::FromBundle() Could not parse item %s of bundle %s as %s"), *Item.Key, *Bundle.BundleName, *StructType->GetName());
+                bAllParsed = false;
+            }
+        }
+    }
+    return bAllParsed;
+}
+
+bool FAwsGameKitUserGameplayDataStructSerializer::FromUtf8Bundle(const UScriptStruct* StructType, void* StructData, const FAwsGameKitUserGameplayDataUtf8Bundle& Bundle)
+{
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    AWSGAMEKIT_TRACE_PHASE(Marshalling);
+
+    FString BinaryValue;
+    if (Bundle.FindValueAsString(BINARY_ITEM_KEY, BinaryValue) && BinaryValue.StartsWith(BINARY_MARKER, ESearchCase::CaseSensitive))
+    {
+        return FromBinaryValue(StructType, StructData, BinaryValue);
+    }
+
+    bool bAllParsed = true;
+    for (int32 Index = 0; Index < Bundle.Num(); Index++)
+    {
+        int32 ArrayIndex;
+        const FString Key = FAwsGameKitUserGameplayDataUtf8Bundle::ToString(Bundle.GetKey(Index));
+        const FProperty* Property = FindElement(StructType, Key, ArrayIndex);
+        if (Property == nullptr)
+        {
+            continue;
+        }
+
+        // The bundle's views are NUL terminated, and numbers are ASCII
+        void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructData, ArrayIndex);
+        const FUtf8StringView Value = Bundle.GetValue(Index);
+        bool bParsed = false;
+        if (!TryParseNumber(Property, ValuePtr, reinterpret_cast<const ANSICHAR*>(Value.GetData()), bParsed))
+        {
+            bParsed = ParseValue(Property, ValuePtr, FAwsGameKitUserGameplayDataUtf8Bundle::ToString(Value));
+        }
+
+        if (!bParsed)
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataStructSerializer::FromUtf8Bundle() Could not parse item %s of bundle %s as %s"), *Key, *Bundle.BundleName, *StructType->GetName());
+            bAllParsed = false;
+        }
+    }
+    return bAllParsed;
+}
+
+void FAwsGameKitUserGameplayDataStructSerializer::AcknowledgeWrite(const UScriptStruct* StructType, void* WrittenStructData, const void* SentStructData, const FUserGameplayDataBundle& Delta, const FUserGameplayDataBundle& UnprocessedItems)
+{
+    if (Delta.BundleMap.Contains(BINARY_ITEM_KEY))
+    {
+        if (!UnprocessedItems.BundleMap.Contains(BINARY_ITEM_KEY))
+        {
+            StructType->CopyScriptStruct(WrittenStructData, SentStructData);
+        }
+        return;
+    }
+
+    for (const TPair<FString, FString>& Item : Delta.BundleMap)
+    {
+        int32 ArrayIndex;
+        const FProperty* Property = FindElement(StructType, Item.Key, ArrayIndex);
+        if (Property != nullptr && !UnprocessedItems.BundleMap.Contains(Item.Key))
+        {
+            Property->CopySingleValue(Property->ContainerPtrToValuePtr<void>(WrittenStructData, ArrayIndex), Property->ContainerPtrToValuePtr<void>(SentStructData, ArrayIndex));
+        }
+    }
+}
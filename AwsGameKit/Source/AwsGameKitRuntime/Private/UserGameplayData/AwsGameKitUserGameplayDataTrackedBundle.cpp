@@ -0,0 +1,116 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataTrackedBundle.h"
+
+// GameKit
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Misc/ScopeLock.h"
+
+FAwsGameKitUserGameplayDataTrackedBundle::FAwsGameKitUserGameplayDataTrackedBundle(const FString& BundleName)
+{
+    Bundle.BundleName = BundleName;
+}
+
+FAwsGameKitUserGameplayDataTrackedBundle::FAwsGameKitUserGameplayDataTrackedBundle(const FUserGameplayDataBundle& WrittenBundle)
+    : Bundle(WrittenBundle)
+{
+}
+
+const FString& FAwsGameKitUserGameplayDataTrackedBundle::GetBundleName() const
+{
+    // Never changes after construction
+    return Bundle.BundleName;
+}
+
+void FAwsGameKitUserGameplayDataTrackedBundle::SetItem(const FString& BundleItemKey, const FString& BundleItemValue)
+{
+    FScopeLock ScopeLock(&Mutex);
+    FString* Existing = Bundle.BundleMap.Find(BundleItemKey);
+    if (Existing != nullptr && Existing->Equals(BundleItemValue, ESearchCase::CaseSensitive))
+    {
+        return;
+    }
+
+    Bundle.BundleMap.Add(BundleItemKey, BundleItemValue);
+    DirtyKeys.Add(BundleItemKey);
+}
+
+bool FAwsGameKitUserGameplayDataTrackedBundle::FindItem(const FString& BundleItemKey, FString& OutBundleItemValue) const
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FString* Value = Bundle.BundleMap.Find(BundleItemKey);
+    if (Value == nullptr)
+    {
+        return false;
+    }
+
+    OutBundleItemValue = *Value;
+    return true;
+}
+
+FUserGameplayDataBundle FAwsGameKitUserGameplayDataTrackedBundle::GetBundle() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return Bundle;
+}
+
+bool FAwsGameKitUserGameplayDataTrackedBundle::IsDirty() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return DirtyKeys.Num() > 0;
+}
+
+TArray<FString> FAwsGameKitUserGameplayDataTrackedBundle::GetDirtyKeys() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return DirtyKeys.Array();
+}
+
+void FAwsGameKitUserGameplayDataTrackedBundle::Reset(const FUserGameplayDataBundle& WrittenBundle)
+{
+    FScopeLock ScopeLock(&Mutex);
+    Bundle.BundleMap = WrittenBundle.BundleMap;
+    DirtyKeys.Reset();
+}
+
+bool FAwsGameKitUserGameplayDataTrackedBundle::BeginWrite(FUserGameplayDataBundle& OutDelta)
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (bWriteInFlight || DirtyKeys.Num() == 0)
+    {
+        return false;
+    }
+
+    OutDelta.BundleName = Bundle.BundleName;
+    OutDelta.BundleMap.Reset();
+    OutDelta.BundleMap.Reserve(DirtyKeys.Num());
+    for (const FString& Key : DirtyKeys)
+    {
+        OutDelta.BundleMap.Add(Key, Bundle.BundleMap.FindChecked(Key));
+    }
+
+    // Items set from now on are marked changed again and sent by the next write
+    DirtyKeys.Reset();
+    bWriteInFlight = true;
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataTrackedBundle::EndWrite(const FUserGameplayDataBundle& Delta, const IntResult& Result, const FUserGameplayDataBundle& UnprocessedItems)
+{
+    FScopeLock ScopeLock(&Mutex);
+    bWriteInFlight = false;
+
+    const bool bAcknowledged = Result.Result == GameKit::GAMEKIT_SUCCESS || Result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED;
+    const TMap<FString, FString>& NotWritten = bAcknowledged ? UnprocessedItems.BundleMap : Delta.BundleMap;
+    for (const TPair<FString, FString>& Item : NotWritten)
+    {
+        // Reset() may have dropped the item meanwhile
+        if (Bundle.BundleMap.Contains(Item.Key))
+        {
+            DirtyKeys.Add(Item.Key);
+        }
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataUtf8Bundle.h"
+
+// Unreal
+#include "Containers/StringConv.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+    // Copies Str and its NUL terminator to the end of Buffer. Returns the offset and the length without the terminator.
+    TPair<int32, int32> AppendUtf8(TArray<UTF8CHAR>& Buffer, const char* Str)
+    {
+        const int32 Len = Str != nullptr ? FCStringAnsi::Strlen(Str) : 0;
+        const int32 Offset = Buffer.Num();
+        Buffer.AddUninitialized(Len + 1);
+        if (Len > 0)
+        {
+            FMemory::Memcpy(Buffer.GetData() + Offset, Str, Len);
+        }
+        Buffer[Offset + Len] = UTF8CHAR(0);
+        return TPair<int32, int32>(Offset, Len);
+    }
+
+    uint32 HashKey(FUtf8StringView Key)
+    {
+        return FCrc::MemCrc32(Key.GetData(), Key.Len());
+    }
+}
+
+void FAwsGameKitUserGameplayDataUtf8Bundle::Reset()
+{
+    Buffer.Reset();
+    Items.Reset();
+    IndexByHash.Reset();
+}
+
+void FAwsGameKitUserGameplayDataUtf8Bundle::Reserve(int32 NumItems, int32 NumBytes)
+{
+    Buffer.Reserve(NumBytes + 2 * NumItems);
+    Items.Reserve(NumItems);
+    IndexByHash.Reserve(NumItems);
+}
+
+void FAwsGameKitUserGameplayDataUtf8Bundle::Add(const char* Key, const char* Value)
+{
+    const FSpan KeySpan = Append(Key);
+    const FSpan ValueSpan = Append(Value);
+
+    const FUtf8StringView KeyView = GetView(KeySpan);
+    const uint32 Hash = HashKey(KeyView);
+    const int32 Index = FindIndex(KeyView, Hash);
+    if (Index != INDEX_NONE)
+    {
+        // The earlier strings stay in the buffer until Reset()
+        Items[Index].Value = ValueSpan;
+        return;
+    }
+
+    IndexByHash.Add(Hash, Items.Add(FItem{ KeySpan, ValueSpan }));
+}
+
+int32 FAwsGameKitUserGameplayDataUtf8Bundle::Num() const
+{
+    return Items.Num();
+}
+
+FUtf8StringView FAwsGameKitUserGameplayDataUtf8Bundle::GetKey(int32 Index) const
+{
+    return GetView(Items[Index].Key);
+}
+
+FUtf8StringView FAwsGameKitUserGameplayDataUtf8Bundle::GetValue(int32 Index) const
+{
+    return GetView(Items[Index].Value);
+}
+
+bool FAwsGameKitUserGameplayDataUtf8Bundle::FindValue(FUtf8StringView Key, FUtf8StringView& OutValue) const
+{
+    const int32 Index = FindIndex(Key, HashKey(Key));
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutValue = GetValue(Index);
+    return true;
+}
+
+bool FAwsGameKitUserGameplayDataUtf8Bundle::FindValueAsString(const FString& Key, FString& OutValue) const
+{
+    const FTCHARToUTF8 Utf8Key(*Key);
+    FUtf8StringView Value;
+    if (!FindValue(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8Key.Get()), Utf8Key.Length()), Value))
+    {
+        return false;
+    }
+
+    OutValue = ToString(Value);
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataUtf8Bundle::ToBundle(FUserGameplayDataBundle& OutBundle) const
+{
+    OutBundle.BundleName = BundleName;
+    OutBundle.BundleMap.Empty(Items.Num());
+    for (int32 i = 0; i < Items.Num(); ++i)
+    {
+        OutBundle.BundleMap.Add(ToString(GetKey(i)), ToString(GetValue(i)));
+    }
+}
+
+FString FAwsGameKitUserGameplayDataUtf8Bundle::ToString(FUtf8StringView View)
+{
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FAwsGameKitUserGameplayDataUtf8Bundle::FSpan FAwsGameKitUserGameplayDataUtf8Bundle::Append(const char* Str)
+{
+    const TPair<int32, int32> Appended = AppendUtf8(Buffer, Str);
+    return FSpan{ Appended.Key, Appended.Value };
+}
+
+FUtf8StringView FAwsGameKitUserGameplayDataUtf8Bundle::GetView(const FSpan& Span) const
+{
+    return FUtf8StringView(Buffer.GetData() + Span.Offset, Span.Len);
+}
+
+int32 FAwsGameKitUserGameplayDataUtf8Bundle::FindIndex(FUtf8StringView Key, uint32 Hash) const
+{
+    for (TMultiMap<uint32, int32>::TConstKeyIterator It(IndexByHash, Hash); It; ++It)
+    {
+        if (GetKey(It.Value()).Equals(Key, ESearchCase::CaseSensitive))
+        {
+            return It.Value();
+        }
+    }
+    return INDEX_NONE;
+}
+
+void FAwsGameKitUserGameplayDataUtf8BundleNames::Reset()
+{
+    Buffer.Reset();
+    Names.Reset();
+}
+
+void FAwsGameKitUserGameplayDataUtf8BundleNames::Add(const char* BundleName)
+{
+    Names.Add(AppendUtf8(Buffer, BundleName));
+}
+
+int32 FAwsGameKitUserGameplayDataUtf8BundleNames::Num() const
+{
+    return Names.Num();
+}
+
+FUtf8StringView FAwsGameKitUserGameplayDataUtf8BundleNames::Get(int32 Index) const
+{
+    return FUtf8StringView(Buffer.GetData() + Names[Index].Key, Names[Index].Value);
+}
+
+void FAwsGameKitUserGameplayDataUtf8BundleNames::ToArray(TArray<FString>& OutBundleNames) const
+{
+    OutBundleNames.Reset(Names.Num());
+    for (int32 i = 0; i < Names.Num(); ++i)
+    {
+        OutBundleNames.Add(FAwsGameKitUserGameplayDataUtf8Bundle::ToString(Get(i)));
+    }
+}
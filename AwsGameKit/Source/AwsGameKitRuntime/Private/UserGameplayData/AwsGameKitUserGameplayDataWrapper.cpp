@@ -5,7 +5,81 @@
 
 // GameKit
 #include "AwsGameKitCore.h"
+#include "AwsGameKitRuntime.h"
+#include "Common/AwsGameKitAdaptivePageSize.h"
+#include "Common/AwsGameKitStats.h"
 #include "Core/AwsGameKitErrors.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCompression.h"
+
+// Unreal
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+// Standard library
+#include <cstring>
+#include <vector>
+
+// The library isn't linked when the feature is left out of the build, see bWithUserGameplayData in AwsGameKitCore.Build.cs
+#if !WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA
+#pragma push_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma push_macro("INVOKE_FUNC_UNTRACED")
+#pragma push_macro("LOAD_PLUGIN_FUNC")
+#undef CHECK_PLUGIN_FUNC_IS_LOADED
+#undef INVOKE_FUNC_UNTRACED
+#undef LOAD_PLUGIN_FUNC
+#define CHECK_PLUGIN_FUNC_IS_LOADED AWSGAMEKIT_CHECK_FEATURE_NOT_BUILT
+#define INVOKE_FUNC_UNTRACED AWSGAMEKIT_INVOKE_FEATURE_NOT_BUILT
+#define LOAD_PLUGIN_FUNC AWSGAMEKIT_LOAD_FEATURE_NOT_BUILT
+#endif
+
+namespace
+{
+    int64 GetLength(const char* str)
+    {
+        return str == nullptr ? 0 : static_cast<int64>(strlen(str));
+    }
+
+    int64 GetTotalLength(const char* const* strs, size_t count)
+    {
+        int64 total = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            total += GetLength(strs[i]);
+        }
+        return total;
+    }
+
+    // requestBytes is only used when the call was enqueued, reads are never enqueued
+    void RecordResult(unsigned int result, int64 requestBytes = 0)
+    {
+        FAwsGameKitUserGameplayDataCircuitBreaker::Get().RecordResult(result);
+
+        if (result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED)
+        {
+            const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+            if (library.UserGameplayDataStateHandler.IsValid())
+            {
+                library.UserGameplayDataStateHandler->RecordCallEnqueued(requestBytes);
+            }
+        }
+    }
+
+    // The library pages GetBundle with the PaginationSize of its client settings, so the adaptive page size is applied through them
+    struct FClientSettingsState
+    {
+        FCriticalSection Mutex;
+        GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE Instance = nullptr;
+        UserGameplayDataClientSettings Settings = {};
+        unsigned int AppliedPaginationSize = 0;
+    };
+
+    FClientSettingsState ClientSettingsState;
+
+    // The GetBundle Lambda serves at most 100 items per page
+    FAwsGameKitAdaptivePageSize GetBundlePageSize(TEXT("GetBundle"), 100, 100);
+}
 
 void AwsGameKitUserGameplayDataWrapper::importFunctions(void* loadedDllHandle)
 {
@@ -34,49 +108,109 @@ void AwsGameKitUserGameplayDataWrapper::importFunctions(void* loadedDllHandle)
 GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataInstanceCreateWithSessionManager, nullptr);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     return INVOKE_FUNC(GameKitUserGameplayDataInstanceCreateWithSessionManager, sessionManager, logCb);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitSetUserGameplayDataClientSettings(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataClientSettings settings)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitSetUserGameplayDataClientSettings);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+
+    FScopeLock lock(&ClientSettingsState.Mutex);
+    ClientSettingsState.Instance = userGameplayDataInstance;
+    ClientSettingsState.Settings = settings;
+    ClientSettingsState.AppliedPaginationSize = settings.PaginationSize;
     INVOKE_FUNC(GameKitSetUserGameplayDataClientSettings, userGameplayDataInstance, settings);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataInstanceRelease(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataInstanceRelease);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataInstanceRelease, userGameplayDataInstance);
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitAddUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutUnprocessedItems, UserGameplayDataBundle userGameplayDataBundle)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitAddUserGameplayData, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitAddUserGameplayData"));
+
+    // Values are compressed into compressedValues, which must not reallocate while bundleItemValues points into it
+    std::vector<std::string> compressedValues;
+    TArray<const char*> bundleItemValues;
+    if (FAwsGameKitUserGameplayDataCompression::IsEnabled())
+    {
+        compressedValues.reserve(userGameplayDataBundle.numKeys);
+        bundleItemValues.Reserve(userGameplayDataBundle.numKeys);
+        for (size_t i = 0; i < userGameplayDataBundle.numKeys; ++i)
+        {
+            std::string compressed;
+            if (FAwsGameKitUserGameplayDataCompression::Compress(userGameplayDataBundle.bundleItemValues[i], compressed))
+            {
+                compressedValues.push_back(MoveTemp(compressed));
+                bundleItemValues.Add(compressedValues.back().c_str());
+            }
+            else
+            {
+                bundleItemValues.Add(userGameplayDataBundle.bundleItemValues[i]);
+            }
+        }
+        userGameplayDataBundle.bundleItemValues = bundleItemValues.GetData();
+    }
 
     inOutUnprocessedItems.Empty();
     auto unprocessedItemsSetter = [&inOutUnprocessedItems](const char* key, const char* value)
     {
-        inOutUnprocessedItems.Add(key, value);
+        std::string decompressed;
+        inOutUnprocessedItems.Add(key, FAwsGameKitUserGameplayDataCompression::Decompress(value, decompressed) ? decompressed.c_str() : value);
     };
     typedef LambdaDispatcher<decltype(unprocessedItemsSetter), void, const char*, const char*> UnprocessedItemsSetter;
 
     const IntResult result = INVOKE_FUNC(GameKitAddUserGameplayData, userGameplayDataInstance, userGameplayDataBundle, (void*)&unprocessedItemsSetter, UnprocessedItemsSetter::Dispatch);
+    const int64 requestBytes = GetLength(userGameplayDataBundle.bundleName)
+        + GetTotalLength(userGameplayDataBundle.bundleItemKeys, userGameplayDataBundle.numKeys)
+        + GetTotalLength(userGameplayDataBundle.bundleItemValues, userGameplayDataBundle.numKeys);
+    RecordResult(result.Result, requestBytes);
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        FAwsGameKitStats::AddBytesUploaded(requestBytes);
+    }
 
     return result.Result;
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TArray<FString>& inOutData)
 {
-    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitListUserGameplayDataBundles, GameKit::GAMEKIT_ERROR_GENERAL);
-
     inOutData.Empty();
-    auto userDataSetter = [&inOutData](const char* bundle)
+    const unsigned int result = GameKitListUserGameplayDataBundles(userGameplayDataInstance, [&inOutData](const char* bundle)
     {
         inOutData.Add(bundle);
+    });
+
+    if (result != GameKit::GAMEKIT_SUCCESS)
+    {
+        inOutData.Reset();
+    }
+
+    return result;
+}
+
+unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle)
+{
+    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitListUserGameplayDataBundles, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitListUserGameplayDataBundles"));
+
+    auto userDataSetter = [&onBundle](const char* bundle)
+    {
+        onBundle(bundle);
     };
     typedef LambdaDispatcher<decltype(userDataSetter), void, const char*> BundleSetter;
 
     IntResult result = INVOKE_FUNC(GameKitListUserGameplayDataBundles, userGameplayDataInstance, (void*)&userDataSetter, BundleSetter::Dispatch);
+    RecordResult(result.Result);
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
@@ -84,7 +218,6 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundl
         const FString error = GameKit::StatusCodeToHexFStr(result.Result);
         const FString message = result.ErrorMessage + " : " + error;
         UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *message);
-        inOutData.Reset();
         return GameKit::GAMEKIT_ERROR_GENERAL;
     }
 
@@ -93,16 +226,69 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitListUserGameplayDataBundl
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutData, char* bundleName)
 {
-    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundle, GameKit::GAMEKIT_ERROR_GENERAL);
-
     inOutData.Empty();
-    auto bundleSetter = [&inOutData](const char* key, const char* value)
+    const unsigned int result = GameKitGetUserGameplayDataBundle(userGameplayDataInstance, bundleName, [&inOutData](const char* key, const char* value)
     {
         inOutData.Add(key, value);
+    });
+
+    if (result != GameKit::GAMEKIT_SUCCESS)
+    {
+        inOutData.Reset();
+    }
+
+    return result;
+}
+
+unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem)
+{
+    CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundle, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitGetUserGameplayDataBundle"));
+
+    // 0 when the adaptive page size isn't used, or the game hasn't set the client settings yet
+    unsigned int pageSize = 0;
+    if (FAwsGameKitAdaptivePageSize::IsEnabled())
+    {
+        FScopeLock lock(&ClientSettingsState.Mutex);
+        if (ClientSettingsState.Instance == userGameplayDataInstance)
+        {
+            pageSize = GetBundlePageSize.GetPageSize(ClientSettingsState.Settings.PaginationSize);
+            if (pageSize != ClientSettingsState.AppliedPaginationSize)
+            {
+                UserGameplayDataClientSettings settings = ClientSettingsState.Settings;
+                settings.PaginationSize = pageSize;
+                INVOKE_FUNC(GameKitSetUserGameplayDataClientSettings, userGameplayDataInstance, settings);
+                ClientSettingsState.AppliedPaginationSize = pageSize;
+            }
+        }
+    }
+
+    int32 numItems = 0;
+    int64 numBytes = 0;
+    const double startTime = FPlatformTime::Seconds();
+    auto bundleSetter = [&onItem, &numItems, &numBytes](const char* key, const char* value)
+    {
+        const int64 itemBytes = GetLength(key) + GetLength(value);
+        ++numItems;
+        numBytes += itemBytes;
+        std::string decompressed;
+        onItem(key, FAwsGameKitUserGameplayDataCompression::Decompress(value, decompressed) ? decompressed.c_str() : value);
     };
     typedef LambdaDispatcher<decltype(bundleSetter), void, const char*, const char*> BundleSetter;
 
     IntResult result = INVOKE_FUNC(GameKitGetUserGameplayDataBundle, userGameplayDataInstance, bundleName, (void*)&bundleSetter, BundleSetter::Dispatch);
+    RecordResult(result.Result);
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        FAwsGameKitStats::AddBytesDownloaded(numBytes);
+    }
+
+    if (pageSize > 0 && result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        // The library doesn't report where its pages end, so they're timed together
+        GetBundlePageSize.RecordCall(pageSize, numItems, numBytes, FPlatformTime::Seconds() - startTime);
+    }
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
@@ -110,7 +296,6 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle
         const FString error = GameKit::StatusCodeToHexFStr(result.Result);
         const FString message = result.ErrorMessage + " : " + error;
         UE_LOG(LogAwsGameKit, Error, TEXT("%s"), *message);
-        inOutData.Reset();
         return GameKit::GAMEKIT_ERROR_GENERAL;
     }
 
@@ -120,14 +305,24 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, FString& inOutData, UserGameplayDataBundleItem userGameplayDataBundleItem)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitGetUserGameplayDataBundleItem, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitGetUserGameplayDataBundleItem"));
 
-    auto bundleItemSetter = [&inOutData](const char* retrievedBundleItem)
+    int64 numBytes = 0;
+    auto bundleItemSetter = [&inOutData, &numBytes](const char* retrievedBundleItem)
     {
-        inOutData = retrievedBundleItem;
+        numBytes = GetLength(retrievedBundleItem);
+        std::string decompressed;
+        inOutData = FAwsGameKitUserGameplayDataCompression::Decompress(retrievedBundleItem, decompressed) ? decompressed.c_str() : retrievedBundleItem;
     };
     typedef LambdaDispatcher<decltype(bundleItemSetter), void, const char*> BundleItemSetter;
 
     IntResult result = INVOKE_FUNC(GameKitGetUserGameplayDataBundleItem, userGameplayDataInstance, userGameplayDataBundleItem, (void*)&bundleItemSetter, BundleItemSetter::Dispatch);
+    RecordResult(result.Result);
+    if (result.Result == GameKit::GAMEKIT_SUCCESS)
+    {
+        FAwsGameKitStats::AddBytesDownloaded(numBytes);
+    }
 
     if (result.Result != GameKit::GAMEKIT_SUCCESS)
     {
@@ -145,67 +340,121 @@ unsigned int AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitUpdateUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataBundleItemValue userGameplayDataBundleItemValue)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUpdateUserGameplayDataBundleItem, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitUpdateUserGameplayDataBundleItem, userGameplayDataInstance, userGameplayDataBundleItemValue);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitUpdateUserGameplayDataBundleItem"));
+
+    std::string compressedValue;
+    if (FAwsGameKitUserGameplayDataCompression::Compress(userGameplayDataBundleItemValue.bundleItemValue, compressedValue))
+    {
+        userGameplayDataBundleItemValue.bundleItemValue = compressedValue.c_str();
+    }
+
+    const unsigned int result = INVOKE_FUNC(GameKitUpdateUserGameplayDataBundleItem, userGameplayDataInstance, userGameplayDataBundleItemValue);
+    const int64 requestBytes = GetLength(userGameplayDataBundleItemValue.bundleName) + GetLength(userGameplayDataBundleItemValue.bundleItemKey) + GetLength(userGameplayDataBundleItemValue.bundleItemValue);
+    RecordResult(result, requestBytes);
+    if (result == GameKit::GAMEKIT_SUCCESS)
+    {
+        FAwsGameKitStats::AddBytesUploaded(requestBytes);
+    }
+    return result;
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitDeleteAllUserGameplayData(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitDeleteAllUserGameplayData, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitDeleteAllUserGameplayData, userGameplayDataInstance);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitDeleteAllUserGameplayData"));
+    const unsigned int result = INVOKE_FUNC(GameKitDeleteAllUserGameplayData, userGameplayDataInstance);
+    RecordResult(result);
+    return result;
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitDeleteUserGameplayDataBundle, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitDeleteUserGameplayDataBundle, userGameplayDataInstance, bundleName);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitDeleteUserGameplayDataBundle"));
+    const unsigned int result = INVOKE_FUNC(GameKitDeleteUserGameplayDataBundle, userGameplayDataInstance, bundleName);
+    RecordResult(result, GetLength(bundleName));
+    return result;
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitDeleteUserGameplayDataBundleItems(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, UserGameplayDataDeleteItemsRequest deleteItemsRequest)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitDeleteUserGameplayDataBundleItems, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitDeleteUserGameplayDataBundleItems, userGameplayDataInstance, deleteItemsRequest);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    FAwsGameKitStatsRequestScope requestScope(EAwsGameKitStatsFeature::UserGameplayData, TEXT("GameKitDeleteUserGameplayDataBundleItems"));
+    const unsigned int result = INVOKE_FUNC(GameKitDeleteUserGameplayDataBundleItems, userGameplayDataInstance, deleteItemsRequest);
+    RecordResult(result, GetLength(deleteItemsRequest.bundleName) + GetTotalLength(deleteItemsRequest.bundleItemKeys, deleteItemsRequest.numKeys));
+    return result;
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataStartRetryBackgroundThread(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataStartRetryBackgroundThread);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataStartRetryBackgroundThread, userGameplayDataInstance);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataStopRetryBackgroundThread(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataStopRetryBackgroundThread);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataStopRetryBackgroundThread, userGameplayDataInstance);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataSetNetworkChangeCallback(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiverHandle, NetworkStatusChangeCallback statusChangeCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataSetNetworkChangeCallback);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataSetNetworkChangeCallback, userGameplayDataInstance, receiverHandle, statusChangeCallback);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataSetCacheProcessedCallback(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiverHandle, CacheProcessedCallback cacheProcessedCallback)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataSetCacheProcessedCallback);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataSetCacheProcessedCallback, userGameplayDataInstance, receiverHandle, cacheProcessedCallback);
 }
 
 void AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataDropAllCachedEvents(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataDropAllCachedEvents);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     INVOKE_FUNC(GameKitUserGameplayDataDropAllCachedEvents, userGameplayDataInstance);
+
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+    if (library.UserGameplayDataStateHandler.IsValid())
+    {
+        library.UserGameplayDataStateHandler->ResetQueuedCalls();
+    }
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataPersistApiCallsToCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataPersistApiCallsToCache, GameKit::GAMEKIT_ERROR_GENERAL);
-    return INVOKE_FUNC(GameKitUserGameplayDataPersistApiCallsToCache, userGameplayDataInstance, offlineCacheFile);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
+    const unsigned int result = INVOKE_FUNC(GameKitUserGameplayDataPersistApiCallsToCache, userGameplayDataInstance, offlineCacheFile);
+    const UserGameplayDataLibrary& library = FAwsGameKitRuntimeModule::Get().GetUserGameplayDataLibrary();
+    if (result == GameKit::GAMEKIT_SUCCESS && library.UserGameplayDataStateHandler.IsValid())
+    {
+        library.UserGameplayDataStateHandler->ResetQueuedCalls();
+    }
+
+    return result;
 }
 
 unsigned int AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataLoadApiCallsFromCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile)
 {
     CHECK_PLUGIN_FUNC_IS_LOADED(UserGameplayData, GameKitUserGameplayDataLoadApiCallsFromCache, GameKit::GAMEKIT_ERROR_GENERAL);
+    AWSGAMEKIT_LLM_SCOPE(UserGameplayData);
     return INVOKE_FUNC(GameKitUserGameplayDataLoadApiCallsFromCache, userGameplayDataInstance, offlineCacheFile);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
+
+#if !WITH_AWSGAMEKIT_USER_GAMEPLAY_DATA
+#pragma pop_macro("CHECK_PLUGIN_FUNC_IS_LOADED")
+#pragma pop_macro("INVOKE_FUNC_UNTRACED")
+#pragma pop_macro("LOAD_PLUGIN_FUNC")
+#endif
@@ -0,0 +1,630 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "UserGameplayData/AwsGameKitUserGameplayDataWriteBehind.h"
+
+// GameKit
+#include "AwsGameKitCore.h"
+#include "AwsGameKitRuntimeInternalHelpers.h"
+#include "Common/AwsGameKitLifecycle.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Identity/AwsGameKitIdentityUserCache.h"
+#include "UserGameplayData/AwsGameKitUserGameplayData.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataCircuitBreaker.h"
+
+// Unreal
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBehindEnabled(
+    TEXT("GameKit.UserGameplayData.WriteBehind.Enabled"),
+    0,
+    TEXT("Buffers UpdateItem() calls and writes them per bundle as one AddBundle() request.\n")
+    TEXT("  0: disabled\n")
+    TEXT("  1: enabled\n"),
+    ECVF_Default);
+
+namespace
+{
+    // Longest time between two probes while the buffered bundles are held
+    const double MAX_PROBE_INTERVAL_SECONDS = 120.0;
+}
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBehindIntervalMs(
+    TEXT("GameKit.UserGameplayData.WriteBehind.IntervalMs"),
+    5000,
+    TEXT("Maximum time in milliseconds a bundle item update is buffered before it is sent.\n"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGameKitUserGameplayDataWriteBehindMaxItems(
+    TEXT("GameKit.UserGameplayData.WriteBehind.MaxItems"),
+    100,
+    TEXT("Number of distinct items buffered for one bundle before they are sent.\n"),
+    ECVF_Default);
+
+FAwsGameKitUserGameplayDataWriteBehind& FAwsGameKitUserGameplayDataWriteBehind::Get()
+{
+    static FAwsGameKitUserGameplayDataWriteBehind Instance;
+    return Instance;
+}
+
+bool FAwsGameKitUserGameplayDataWriteBehind::IsEnabled()
+{
+    return CVarGameKitUserGameplayDataWriteBehindEnabled.GetValueOnAnyThread() != 0;
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::Startup()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAwsGameKitUserGameplayDataWriteBehind::Tick));
+
+    if (FAwsGameKitUserGameplayDataJournal::IsEnabled())
+    {
+        Journal.Open();
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::Shutdown()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // The journaled items are sent in the next session
+    if (Journal.IsOpen())
+    {
+        Journal.Close();
+        return;
+    }
+
+    if (FAwsGameKitLifecycle::HasShutdownDeadlinePassed())
+    {
+        FScopeLock ScopeLock(&Mutex);
+        if (PendingBundles.Num() > 0)
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataWriteBehind::Shutdown(): Out of time, dropping the buffered items of %d bundles"), PendingBundles.Num());
+        }
+        return;
+    }
+
+    FlushAll(true);
+}
+
+bool FAwsGameKitUserGameplayDataWriteBehind::Add(const FUserGameplayDataBundleItemValue& UserGameplayDataBundleItemValue, const FAwsGameKitStatusDelegate& OnCompleteDelegate)
+{
+    if (!IsEnabled() || !TickerHandle.IsValid())
+    {
+        return false;
+    }
+
+    const FString& BundleName = UserGameplayDataBundleItemValue.BundleName;
+    const uint32 Generation = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    bool bResolve = false;
+    bool bSendNow = false;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        FPendingBundle& Pending = PendingBundles.FindOrAdd(BundleName);
+        if (Pending.Items.Num() == 0)
+        {
+            Pending.FlushAt = FPlatformTime::Seconds() + FMath::Max(0, CVarGameKitUserGameplayDataWriteBehindIntervalMs.GetValueOnAnyThread()) / 1000.0;
+        }
+        Pending.Items.Add(UserGameplayDataBundleItemValue.BundleItemKey, UserGameplayDataBundleItemValue.BundleItemValue);
+        Pending.OnCompleteDelegates.Add(OnCompleteDelegate);
+
+        // Journaled without a player id until it's known, such items aren't replayed after a crash
+        CheckPlayer(Generation);
+        const int64 JournalSequence = Journal.Append(BundleName, UserGameplayDataBundleItemValue.BundleItemKey, UserGameplayDataBundleItemValue.BundleItemValue, PlayerId);
+        if (JournalSequence > 0)
+        {
+            Pending.JournalSequences.FindOrAdd(PlayerId).Add(UserGameplayDataBundleItemValue.BundleItemKey, JournalSequence);
+            bResolve = PlayerId.IsEmpty() && !bIsResolvingPlayer;
+            bIsResolvingPlayer |= bResolve;
+        }
+
+        // Sent now unless the bundle is already being sent or the drain limit is reached, the items keep merging until then
+        bSendNow = Pending.Items.Num() >= FMath::Max(1, CVarGameKitUserGameplayDataWriteBehindMaxItems.GetValueOnAnyThread());
+        if (bSendNow)
+        {
+            Pending.FlushAt = 0.0;
+        }
+    }
+
+    if (bResolve)
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread([this, Generation]
+        {
+            ResolvePlayer(Generation);
+        }, EAwsGameKitWorkLane::Background);
+    }
+
+    if (bSendNow)
+    {
+        SendReady();
+    }
+    return true;
+}
+
+bool FAwsGameKitUserGameplayDataWriteBehind::FindItem(const FString& BundleName, const FString& BundleItemKey, FString& OutBundleItemValue) const
+{
+    FScopeLock ScopeLock(&Mutex);
+    const FPendingBundle* Pending = PendingBundles.Find(BundleName);
+    const FString* Value = Pending != nullptr ? Pending->Items.Find(BundleItemKey) : nullptr;
+    if (Value == nullptr)
+    {
+        return false;
+    }
+
+    OutBundleItemValue = *Value;
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::MergeInto(FUserGameplayDataBundle& Bundle) const
+{
+    FScopeLock ScopeLock(&Mutex);
+    if (const FPendingBundle* Pending = PendingBundles.Find(Bundle.BundleName))
+    {
+        Bundle.BundleMap.Append(Pending->Items);
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::Discard(const FString& BundleName, const TArray<FString>& BundleItemKeys)
+{
+    // Also covers the journaled items of a previous session which weren't replayed yet, and those journaled before the player's id was known
+    FString DiscardPlayerId;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        DiscardPlayerId = PlayerId;
+    }
+    Journal.Discard(BundleName, BundleItemKeys, DiscardPlayerId);
+    if (!DiscardPlayerId.IsEmpty())
+    {
+        Journal.Discard(BundleName, BundleItemKeys);
+    }
+
+    FPendingBundle Discarded;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        FPendingBundle* Pending = PendingBundles.Find(BundleName);
+        if (Pending == nullptr)
+        {
+            return;
+        }
+
+        for (const FString& BundleItemKey : BundleItemKeys)
+        {
+            Pending->Items.Remove(BundleItemKey);
+            for (TPair<FString, TMap<FString, int64>>& PlayerSequences : Pending->JournalSequences)
+            {
+                PlayerSequences.Value.Remove(BundleItemKey);
+            }
+        }
+
+        // The remaining items are still sent, their callers are called when they are
+        if (BundleItemKeys.Num() > 0 && Pending->Items.Num() > 0)
+        {
+            return;
+        }
+
+        Discarded = MoveTemp(*Pending);
+        PendingBundles.Remove(BundleName);
+    }
+
+    CompleteDiscarded(MoveTemp(Discarded));
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::DiscardAll()
+{
+    TMap<FString, FPendingBundle> Discarded;
+    int64 LastJournalSequence;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        Discarded = MoveTemp(PendingBundles);
+        PendingBundles.Reset();
+        EnqueuedJournalRecords.Reset();
+
+        // Items are journaled under the lock, the ones buffered from now on stay journaled
+        LastJournalSequence = Journal.GetLastSequence();
+    }
+    Journal.Reset(LastJournalSequence);
+
+    for (TPair<FString, FPendingBundle>& Bundle : Discarded)
+    {
+        CompleteDiscarded(MoveTemp(Bundle.Value));
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::FlushAll(bool bBlocking)
+{
+    if (!bBlocking)
+    {
+        {
+            FScopeLock ScopeLock(&Mutex);
+            for (TPair<FString, FPendingBundle>& Pending : PendingBundles)
+            {
+                Pending.Value.FlushAt = 0.0;
+            }
+
+            // An explicit flush doesn't wait for the next probe
+            bHolding = false;
+        }
+
+        SendReady();
+        return;
+    }
+
+    // Send everything, including held bundles, but still one send at a time per bundle so that a newer value can't land first
+    bool bLogged = false;
+    for (;;)
+    {
+        TArray<TPair<FString, FPendingBundle>> ReadyBundles;
+        bool bWaitingForInFlight = false;
+        {
+            FScopeLock ScopeLock(&Mutex);
+            for (auto It = PendingBundles.CreateIterator(); It; ++It)
+            {
+                if (InFlightBundles.Contains(It.Key()))
+                {
+                    bWaitingForInFlight = true;
+                    continue;
+                }
+
+                InFlightBundles.Add(It.Key());
+                ReadyBundles.Emplace(It.Key(), MoveTemp(It.Value()));
+                It.RemoveCurrent();
+            }
+        }
+
+        if (ReadyBundles.Num() == 0 && !bWaitingForInFlight)
+        {
+            return;
+        }
+
+        if (ReadyBundles.Num() > 0 && !bLogged)
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitUserGameplayDataWriteBehind::FlushAll(): Sending %d buffered bundles"), ReadyBundles.Num());
+            bLogged = true;
+        }
+
+        for (TPair<FString, FPendingBundle>& Ready : ReadyBundles)
+        {
+            Send(Ready.Key, MoveTemp(Ready.Value), true);
+        }
+
+        if (ReadyBundles.Num() == 0)
+        {
+            FPlatformProcess::Sleep(0.005f);
+        }
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::SetClientSettings(const FUserGameplayDataClientSettings& ClientSettings)
+{
+    FScopeLock ScopeLock(&Mutex);
+    MaxInFlightBundles = FMath::Max(1, ClientSettings.DrainConcurrency);
+    ProbeIntervalSeconds = FMath::Max(1, ClientSettings.RetryIntervalSeconds);
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::ReplayJournal()
+{
+    const TArray<FAwsGameKitUserGameplayDataJournal::FEntry> Entries = Journal.GetPendingEntries();
+    if (Entries.Num() == 0)
+    {
+        return;
+    }
+
+    // The items are only replayed for the player they were buffered for
+    const uint32 Generation = FAwsGameKitIdentityUserCache::Get().GetGeneration();
+    if (!ResolvePlayer(Generation))
+    {
+        UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataWriteBehind::ReplayJournal(): The player isn't known, keeping %d journaled items"), Entries.Num());
+        return;
+    }
+
+    FScopeLock ScopeLock(&Mutex);
+    CheckPlayer(Generation);
+    if (PlayerId.IsEmpty())
+    {
+        // The player logged out meanwhile
+        return;
+    }
+
+    int32 ReplayedCount = 0;
+    const double Now = FPlatformTime::Seconds();
+    for (const FAwsGameKitUserGameplayDataJournal::FEntry& Entry : Entries)
+    {
+        if (Entry.PlayerId != PlayerId)
+        {
+            // Another player's, or buffered before the player's id was known
+            continue;
+        }
+
+        FPendingBundle& Pending = PendingBundles.FindOrAdd(Entry.Group);
+        if (Pending.Items.Contains(Entry.Key))
+        {
+            // Updated again in this session
+            continue;
+        }
+
+        // Sent on the next tick, nobody waits for these
+        Pending.Items.Add(Entry.Key, Entry.Value);
+        Pending.JournalSequences.FindOrAdd(Entry.PlayerId).Add(Entry.Key, Entry.Sequence);
+        Pending.FlushAt = Now;
+        ++ReplayedCount;
+    }
+
+    if (ReplayedCount > 0)
+    {
+        UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitUserGameplayDataWriteBehind::ReplayJournal(): Sending %d journaled items"), ReplayedCount);
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::Checkpoint()
+{
+    Journal.Checkpoint();
+}
+
+FAwsGameKitUserGameplayDataWriteBehind::FJournalRecords FAwsGameKitUserGameplayDataWriteBehind::GetEnqueuedJournalRecords() const
+{
+    FScopeLock ScopeLock(&Mutex);
+    return EnqueuedJournalRecords;
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::CompleteJournal(const FJournalRecords& Records)
+{
+    for (const TPair<FString, FJournalSequences>& Bundle : Records)
+    {
+        CompleteJournalSequences(Bundle.Key, Bundle.Value);
+    }
+
+    // Keep the records of the items enqueued again since
+    FScopeLock ScopeLock(&Mutex);
+    for (const TPair<FString, FJournalSequences>& Bundle : Records)
+    {
+        FJournalSequences* Enqueued = EnqueuedJournalRecords.Find(Bundle.Key);
+        if (Enqueued == nullptr)
+        {
+            continue;
+        }
+
+        for (const TPair<FString, TMap<FString, int64>>& PlayerSequences : Bundle.Value)
+        {
+            if (TMap<FString, int64>* EnqueuedSequences = Enqueued->Find(PlayerSequences.Key))
+            {
+                for (const TPair<FString, int64>& Sequence : PlayerSequences.Value)
+                {
+                    const int64* EnqueuedSequence = EnqueuedSequences->Find(Sequence.Key);
+                    if (EnqueuedSequence != nullptr && *EnqueuedSequence <= Sequence.Value)
+                    {
+                        EnqueuedSequences->Remove(Sequence.Key);
+                    }
+                }
+                if (EnqueuedSequences->Num() == 0)
+                {
+                    Enqueued->Remove(PlayerSequences.Key);
+                }
+            }
+        }
+        if (Enqueued->Num() == 0)
+        {
+            EnqueuedJournalRecords.Remove(Bundle.Key);
+        }
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::CheckPlayer(uint32 Generation)
+{
+    if (Generation != PlayerGeneration)
+    {
+        PlayerId.Reset();
+        PlayerGeneration = Generation;
+    }
+}
+
+bool FAwsGameKitUserGameplayDataWriteBehind::ResolvePlayer(uint32 Generation)
+{
+    FGetUserResponse User;
+    const IntResult Result = FAwsGameKitIdentityUserCache::Get().GetUser(User);
+
+    FScopeLock ScopeLock(&Mutex);
+    bIsResolvingPlayer = false;
+    if (Result.Result != GameKit::GAMEKIT_SUCCESS || User.UserId.IsEmpty())
+    {
+        return false;
+    }
+
+    // Not if the player changed while the profile was fetched
+    CheckPlayer(Generation);
+    if (Generation == FAwsGameKitIdentityUserCache::Get().GetGeneration())
+    {
+        PlayerId = User.UserId;
+    }
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::CompleteJournalSequences(const FString& BundleName, const FJournalSequences& Sequences)
+{
+    for (const TPair<FString, TMap<FString, int64>>& PlayerSequences : Sequences)
+    {
+        Journal.Complete(BundleName, PlayerSequences.Value, PlayerSequences.Key);
+    }
+}
+
+bool FAwsGameKitUserGameplayDataWriteBehind::Tick(float DeltaTime)
+{
+    SendReady();
+    Journal.Tick();
+
+    // Keep ticking
+    return true;
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::SendReady()
+{
+    TArray<TPair<FString, FPendingBundle>> ReadyBundles;
+    {
+        FScopeLock ScopeLock(&Mutex);
+        const double Now = FPlatformTime::Seconds();
+
+        // While held, or while the circuit breaker isn't closed, a single bundle goes out per probe to find out whether writes go through again
+        int32 Available = MaxInFlightBundles - InFlightBundles.Num();
+        const bool bBreakerTripped = FAwsGameKitUserGameplayDataCircuitBreaker::IsEnabled()
+            && FAwsGameKitUserGameplayDataCircuitBreaker::Get().GetState() != UserGameplayDataCircuitState_E::Closed;
+        if (bHolding || bBreakerTripped)
+        {
+            if ((bHolding && Now < NextProbeAt) || InFlightBundles.Num() > 0)
+            {
+                return;
+            }
+
+            bool bAnyReady = false;
+            for (const TPair<FString, FPendingBundle>& Pending : PendingBundles)
+            {
+                bAnyReady |= Pending.Value.FlushAt <= Now;
+            }
+
+            // Only ask the breaker for its single probe when there is something to send
+            if (!bAnyReady || (bBreakerTripped && !FAwsGameKitUserGameplayDataCircuitBreaker::Get().TryAcquire()))
+            {
+                return;
+            }
+
+            Available = 1;
+            if (bHolding)
+            {
+                ProbeDelaySeconds = FAwsGameKitUserGameplayDataCircuitBreaker::GetDecorrelatedJitterDelay(ProbeIntervalSeconds, MAX_PROBE_INTERVAL_SECONDS, ProbeDelaySeconds);
+                NextProbeAt = Now + ProbeDelaySeconds;
+            }
+        }
+
+        for (auto It = PendingBundles.CreateIterator(); It && Available > 0; ++It)
+        {
+            if (It.Value().FlushAt <= Now && !InFlightBundles.Contains(It.Key()))
+            {
+                InFlightBundles.Add(It.Key());
+                ReadyBundles.Emplace(It.Key(), MoveTemp(It.Value()));
+                It.RemoveCurrent();
+                --Available;
+            }
+        }
+    }
+
+    for (TPair<FString, FPendingBundle>& Ready : ReadyBundles)
+    {
+        Send(Ready.Key, MoveTemp(Ready.Value), false);
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::OnSent(const FString& BundleName, const IntResult& Result, bool bSendNext)
+{
+    {
+        FScopeLock ScopeLock(&Mutex);
+        InFlightBundles.Remove(BundleName);
+
+        if (Result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED)
+        {
+            // The client is offline and retries one queued call at a time, keep the other bundles here where their updates keep merging
+            if (!bHolding)
+            {
+                UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitUserGameplayDataWriteBehind: Writes are enqueued, holding the buffered bundles"));
+                bHolding = true;
+                ProbeDelaySeconds = FAwsGameKitUserGameplayDataCircuitBreaker::GetDecorrelatedJitterDelay(ProbeIntervalSeconds, MAX_PROBE_INTERVAL_SECONDS, 0.0);
+                NextProbeAt = FPlatformTime::Seconds() + ProbeDelaySeconds;
+            }
+        }
+        else if (Result.Result == GameKit::GAMEKIT_SUCCESS && bHolding)
+        {
+            UE_LOG(LogAwsGameKit, Log, TEXT("FAwsGameKitUserGameplayDataWriteBehind: Writes go through again, draining %d held bundles"), PendingBundles.Num());
+            bHolding = false;
+            ProbeDelaySeconds = 0.0;
+        }
+    }
+
+    // Don't wait for the next tick to send what became ready while this bundle was in flight.
+    // A blocking flush sends the rest itself.
+    if (bSendNext)
+    {
+        SendReady();
+    }
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::CompleteDiscarded(FPendingBundle&& Discarded)
+{
+    const FAwsGameKitStatusDelegate fanOut = FAwsGameKitStatusDelegate::CreateLambda([OnCompleteDelegates = MoveTemp(Discarded.OnCompleteDelegates)](const IntResult& Result)
+    {
+        for (const FAwsGameKitStatusDelegate& OnCompleteDelegate : OnCompleteDelegates)
+        {
+            OnCompleteDelegate.ExecuteIfBound(Result);
+        }
+    });
+
+    FGraphEventRef OrderedWorkChain;
+    InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, fanOut, IntResult(GameKit::GAMEKIT_SUCCESS));
+}
+
+void FAwsGameKitUserGameplayDataWriteBehind::Send(const FString& BundleName, FPendingBundle&& Pending, bool bBlocking)
+{
+    UE_LOG(LogAwsGameKitHotPath, Display, TEXT("FAwsGameKitUserGameplayDataWriteBehind: Sending %d items of %s (%d calls)"), Pending.Items.Num(), *BundleName, Pending.OnCompleteDelegates.Num());
+
+    auto Work = [BundleName, Pending = MoveTemp(Pending), bBlocking]()
+    {
+        FUserGameplayDataBundle bundle;
+        bundle.BundleName = BundleName;
+        bundle.BundleMap = Pending.Items;
+
+        FUserGameplayDataBundle unprocessedItems;
+        const IntResult result = AwsGameKitUserGameplayData::AddBundleBlocking(bundle, unprocessedItems);
+        if (unprocessedItems.BundleMap.Num() > 0)
+        {
+            UE_LOG(LogAwsGameKit, Warning, TEXT("FAwsGameKitUserGameplayDataWriteBehind: %d items of %s were not processed"), unprocessedItems.BundleMap.Num(), *BundleName);
+        }
+
+        // Enqueued items are only on disk once the retry queue is persisted, keep them journaled until then, see CompleteJournal().
+        // The callers are told about failures, so failed items aren't replayed behind their back.
+        if (result.Result != GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED)
+        {
+            Get().CompleteJournalSequences(BundleName, Pending.JournalSequences);
+        }
+        else if (Pending.JournalSequences.Num() > 0)
+        {
+            FScopeLock ScopeLock(&Get().Mutex);
+            FJournalSequences& Enqueued = Get().EnqueuedJournalRecords.FindOrAdd(BundleName);
+            for (const TPair<FString, TMap<FString, int64>>& PlayerSequences : Pending.JournalSequences)
+            {
+                Enqueued.FindOrAdd(PlayerSequences.Key).Append(PlayerSequences.Value);
+            }
+        }
+
+        // One completion for all the buffered calls
+        const FAwsGameKitStatusDelegate fanOut = FAwsGameKitStatusDelegate::CreateLambda([OnCompleteDelegates = Pending.OnCompleteDelegates](const IntResult& Result)
+        {
+            for (const FAwsGameKitStatusDelegate& OnCompleteDelegate : OnCompleteDelegates)
+            {
+                OnCompleteDelegate.ExecuteIfBound(Result);
+            }
+        });
+
+        FGraphEventRef OrderedWorkChain;
+        InternalAwsGameKitRunDelegateOnGameThread(OrderedWorkChain, fanOut, result);
+
+        Get().OnSent(BundleName, result, !bBlocking);
+    };
+
+    if (bBlocking)
+    {
+        Work();
+    }
+    else
+    {
+        InternalAwsGameKitRunLambdaOnWorkThread(MoveTemp(Work), EAwsGameKitWorkLane::Background);
+    }
+}
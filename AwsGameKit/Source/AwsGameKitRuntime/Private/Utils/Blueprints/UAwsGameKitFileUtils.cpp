@@ -8,6 +8,7 @@
 #include "AwsGameKitRuntime.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Core/AwsGameKitMarshalling.h"
+#include "Core/AwsGameKitMemory.h"
 #include "SessionManager/AwsGameKitSessionManager.h"
 
 // Unreal
@@ -15,8 +16,25 @@
 #include "Developer/DesktopPlatform/Public/IDesktopPlatform.h"
 #include "Developer/DesktopPlatform/Public/DesktopPlatformModule.h"
 #include "HAL/FileManagerGeneric.h"
+#include "HAL/PlatformFileManager.h"
 #include "Misc/FileHelper.h"
 
+namespace
+{
+    // Visit the files directly in directoryPath whose extension is fileExtension, with or without its leading dot, or all files if it's empty
+    void IterateFilesInDirectory(const FString& directoryPath, const FString& fileExtension, TFunctionRef<void(const TCHAR* filePath, const FFileStatData& statData)> visitor)
+    {
+        const FString extension = fileExtension.StartsWith(TEXT(".")) ? fileExtension.Mid(1) : fileExtension;
+        FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryStat(*directoryPath, [&](const TCHAR* filenameOrDirectory, const FFileStatData& statData)
+        {
+            if (!statData.bIsDirectory && (extension.IsEmpty() || FPaths::GetExtension(filenameOrDirectory).Equals(extension, ESearchCase::IgnoreCase)))
+            {
+                visitor(filenameOrDirectory, statData);
+            }
+            return true;
+        });
+    }
+}
 
 bool UAwsGameKitFileUtils::GetFileLastModifiedTimestamp(const FString filePath, int64& outLastModifiedEpochMilliseconds)
 {
@@ -35,6 +53,7 @@ bool UAwsGameKitFileUtils::GetFileLastModifiedTimestamp(const FString filePath,
 
 int32 UAwsGameKitFileUtils::LoadFileIntoByteArray(const FString filePath, TArray<uint8>& fileContents)
 {
+    AWSGAMEKIT_LLM_SCOPE(GameSaving);
     if (!FFileHelper::LoadFileToArray(fileContents, *filePath))
     {
         FString errorMessage = "ERROR: Unable to read file: " + filePath;
@@ -127,12 +146,35 @@ FString UAwsGameKitFileUtils::GetFeatureSaveDirectory(const FeatureType_E featur
 
 void UAwsGameKitFileUtils::GetFilesInDirectory(FFilePaths& result, const FString& directoryPath, const FString& fileExtension)
 {
-    IFileManager::Get().FindFiles(result.FilePaths, *directoryPath, *fileExtension);
+    // The platform file already hands out the full paths, so they aren't combined with directoryPath again
+    result.FilePaths.Reset();
+    IterateFilesInDirectory(directoryPath, fileExtension, [&result](const TCHAR* filePath, const FFileStatData& statData)
+    {
+        result.FilePaths.Emplace(filePath);
+    });
+}
 
-    for (int32 i = 0; i < result.FilePaths.Num(); i++)
+void UAwsGameKitFileUtils::GetFileStatsInDirectory(FFileStats& result, const FString& directoryPath, const FString& fileExtension)
+{
+    result.Files.Reset();
+    IterateFilesInDirectory(directoryPath, fileExtension, [&result](const TCHAR* filePath, const FFileStatData& statData)
+    {
+        FFileStat& fileStat = result.Files.AddDefaulted_GetRef();
+        fileStat.FilePath = filePath;
+        fileStat.Size = statData.FileSize;
+        fileStat.LastModifiedEpochMilliseconds = statData.ModificationTime == FDateTime::MinValue() ? 0 : statData.ModificationTime.ToUnixTimestamp() * 1000; // Convert seconds to milliseconds
+    });
+}
+
+FFilePaths UAwsGameKitFileUtils::GetFilePaths(const FFileStats& fileStats)
+{
+    FFilePaths result;
+    result.FilePaths.Reserve(fileStats.Files.Num());
+    for (const FFileStat& fileStat : fileStats.Files)
     {
-        result.FilePaths[i] = FPaths::Combine(directoryPath, result.FilePaths[i]);
+        result.FilePaths.Add(fileStat.FilePath);
     }
+    return result;
 }
 
 void UAwsGameKitFileUtils::DeleteFile(const FString& path)
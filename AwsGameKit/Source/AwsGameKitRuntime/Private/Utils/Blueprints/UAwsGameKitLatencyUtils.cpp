@@ -0,0 +1,17 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Utils/Blueprints/UAwsGameKitLatencyUtils.h"
+
+// GameKit
+#include "Common/AwsGameKitLatencyHistograms.h"
+
+TArray<FAwsGameKitLatencySnapshot> UAwsGameKitLatencyUtils::GetLatencySnapshot(bool bReset)
+{
+    return FAwsGameKitLatencyHistograms::Get().GetSnapshot(bReset);
+}
+
+void UAwsGameKitLatencyUtils::ResetLatencyHistograms()
+{
+    FAwsGameKitLatencyHistograms::Get().Reset();
+}
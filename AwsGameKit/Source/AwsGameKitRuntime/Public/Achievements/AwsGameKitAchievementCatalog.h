@@ -0,0 +1,136 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Compact, immutable catalog of achievement definitions, shared by the achievements cache and the game.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitAchievementModels.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Misc/DateTime.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * @brief The player progress of one achievement, kept apart from its definition in FAwsGameKitAchievementCatalog.
+ *
+ * @details Timestamps are kept as the backend returned them, with microseconds, and written back in FAchievement unchanged. Compare them with
+ * ParseTimestamp(): FDateTime can't hold their precision, so a timestamp formatted back from an FDateTime isn't the same one.
+ */
+struct AWSGAMEKITRUNTIME_API FAwsGameKitAchievementProgress
+{
+    int32 CurrentValue = 0;
+    bool bIsEarned = false;
+
+    /** Empty when not earned or unknown. */
+    FString EarnedAt;
+
+    /** Empty when unknown. */
+    FString UpdatedAt;
+
+    /**
+     * @brief The progress fields of an achievement returned by the backend.
+     */
+    static FAwsGameKitAchievementProgress FromAchievement(const FAchievement& Achievement);
+
+    /**
+     * @brief Parse an ISO 8601 timestamp of the backend to order it. Digits past the milliseconds are ignored, FDateTime::ParseIso8601() rejects them.
+     *
+     * @return False if the timestamp is empty or malformed.
+     */
+    static bool ParseTimestamp(const FString& Timestamp, FDateTime& OutDateTime);
+};
+
+typedef TSharedRef<const class FAwsGameKitAchievementCatalog, ESPMode::ThreadSafe> FAwsGameKitAchievementCatalogRef;
+typedef TSharedPtr<const class FAwsGameKitAchievementCatalog, ESPMode::ThreadSafe> FAwsGameKitAchievementCatalogPtr;
+
+/**
+ * @brief Achievement definitions stored once, in a flat layout, for catalogs of thousands of achievements.
+ *
+ * @details Each definition is a small fixed-size record of numbers and string offsets. Its strings are interned in one character buffer,
+ * so the icon paths and descriptions which many achievements share are stored once, and the catalog is three allocations whatever its size.
+ * Achievements are found by id with a binary search over an index sorted by id.
+ *
+ * A catalog never changes once built, so it's shared by reference between threads, the achievements cache and the game without copies.
+ * Player progress lives beside it, in an array of FAwsGameKitAchievementProgress at the catalog's indices. FAchievement views, for Blueprints and
+ * the existing APIs, are only created on demand with MakeAchievement().
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitAchievementCatalog
+{
+public:
+    /**
+     * @brief Build a catalog from the definitions of a list of achievements. When an id is listed twice, the last definition is kept.
+     *
+     * @param OutProgress Receives the progress of the achievements, at the indices of the catalog. Optional.
+     */
+    static FAwsGameKitAchievementCatalogRef Build(const TArray<FAchievement>& Achievements, TArray<FAwsGameKitAchievementProgress>* OutProgress = nullptr);
+
+    /**
+     * @brief Build a new catalog with some definitions replaced and others appended, keeping the indices of this catalog's achievements.
+     */
+    FAwsGameKitAchievementCatalogRef WithUpdatedDefinitions(const TArray<FAchievement>& UpdatedAchievements) const;
+
+    int32 Num() const { return Definitions.Num(); }
+
+    /**
+     * @brief The index of an achievement, or INDEX_NONE.
+     */
+    int32 Find(FStringView AchievementId) const;
+
+    FStringView GetAchievementId(int32 Index) const { return GetString(Definitions[Index].AchievementId); }
+    int32 GetRequiredAmount(int32 Index) const { return Definitions[Index].RequiredAmount; }
+    int32 GetPoints(int32 Index) const { return Definitions[Index].Points; }
+    bool IsHidden(int32 Index) const { return Definitions[Index].bIsHidden; }
+
+    /**
+     * @brief Create the FAchievement of one achievement with the player's progress.
+     */
+    FAchievement MakeAchievement(int32 Index, const FAwsGameKitAchievementProgress& Progress) const;
+
+    /**
+     * @brief Create the FAchievement of every achievement, in the catalog's order.
+     *
+     * @param Progress The progress of every achievement, or an empty view for achievements without progress.
+     */
+    void MakeAchievements(TArrayView<const FAwsGameKitAchievementProgress> Progress, TArray<FAchievement>& OutAchievements) const;
+
+    /**
+     * @brief Add up the earned and total achievements and points, like AwsGameKitAchievements::SummarizeAchievements(), without creating FAchievement views.
+     */
+    FAchievementSummary Summarize(TArrayView<const FAwsGameKitAchievementProgress> Progress) const;
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    // Offset of a null-terminated string in Strings
+    typedef int32 FStringOffset;
+
+    struct FDefinition
+    {
+        FStringOffset AchievementId;
+        FStringOffset Title;
+        FStringOffset LockedDescription;
+        FStringOffset UnlockedDescription;
+        FStringOffset LockedIcon;
+        FStringOffset UnlockedIcon;
+        int32 RequiredAmount;
+        int32 Points;
+        int32 OrderNumber;
+        bool bIsSecret;
+        bool bIsHidden;
+    };
+
+    FStringView GetString(FStringOffset Offset) const { return FStringView(Strings.GetData() + Offset); }
+
+    TArray<FDefinition> Definitions;
+    TArray<TCHAR> Strings;
+
+    // Indices of Definitions sorted by achievement id
+    TArray<int32> SortedById;
+};
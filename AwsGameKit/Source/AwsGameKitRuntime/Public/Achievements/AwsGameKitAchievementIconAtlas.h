@@ -0,0 +1,163 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Runtime texture atlas of achievement icons.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitAchievementModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Delegates/Delegate.h"
+#include "Math/Box2D.h"
+#include "Templates/SharedPointer.h"
+
+// Standard library
+#include <atomic>
+
+// Unreal forward declarations
+class IHttpRequest;
+class IHttpResponse;
+class IImageWrapperModule;
+class UTexture2D;
+
+/**
+ * @brief Location of an icon in the atlas.
+ */
+struct FAwsGameKitAtlasIcon
+{
+    /** Atlas page the icon was packed into. */
+    UTexture2D* Texture = nullptr;
+
+    /** Normalized texture coordinates of the icon in Texture. */
+    FBox2D UV = FBox2D(FVector2D::ZeroVector, FVector2D::ZeroVector);
+};
+
+/**
+ * @brief Downloads achievement icons and packs them into a few shared textures, so that an achievements screen draws from one texture instead of one per icon.
+ *
+ * @details Icons are downloaded asynchronously, decoded and resized on a background worker, and copied into an atlas page on the game thread.
+ * Pages are GameKit.Achievements.IconAtlas.PageSize texels square, split into cells of GameKit.Achievements.IconAtlas.CellSize texels.
+ * Each icon is scaled to fit its cell, keeping its aspect ratio; FindIcon() returns the UV rect of the scaled icon only.
+ * A new page is created when the current one is full. Packed icons stay in the atlas until Reset().
+ *
+ * Downloaded icons are kept in FAwsGameKitIconDiskCache, shared with the editor. A cached icon is revalidated with If-None-Match
+ * the first time it is requested in a session and read from disk afterwards. On a metered link it is read from disk without revalidating it,
+ * see FAwsGameKitNetworkPolicy.
+ *
+ * The pages count against FAwsGameKitCacheBudget, but aren't evicted by it since the UI may be drawing them.
+ *
+ * Only call it from the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitAchievementIconAtlas
+{
+public:
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnIconReady, const FString& /* IconUrl */);
+
+    /**
+     * @brief Get the process-wide icon atlas.
+     */
+    static FAwsGameKitAchievementIconAtlas& Get();
+
+    /**
+     * @brief Drop the atlas pages. Called by FAwsGameKitRuntimeModule::ShutdownModule().
+     */
+    void Shutdown();
+
+    /**
+     * @brief Start downloading and packing an icon. Does nothing if the icon is already packed or being packed.
+     *
+     * @param IconUrl Full url of the icon, see AwsGameKitAchievements::GetAchievementIconUrl().
+     */
+    void RequestIcon(const FString& IconUrl);
+
+    /**
+     * @brief Start downloading and packing the locked and unlocked icons of an achievement.
+     *
+     * @param IconBaseUrl Url returned by AwsGameKitAchievements::GetAchievementIconBaseUrl().
+     */
+    void RequestAchievementIcons(const FString& IconBaseUrl, const FAchievement& Achievement);
+
+    /**
+     * @brief Find where an icon was packed.
+     *
+     * @return False if the icon isn't packed yet, or couldn't be downloaded.
+     */
+    bool FindIcon(const FString& IconUrl, FAwsGameKitAtlasIcon& OutIcon) const;
+
+    /**
+     * @brief Find where the locked or unlocked icon of an achievement was packed.
+     *
+     * @param IconBaseUrl Url returned by AwsGameKitAchievements::GetAchievementIconBaseUrl().
+     * @param bLocked Find FAchievement::LockedIcon instead of FAchievement::UnlockedIcon.
+     * @return False if the icon isn't packed yet, or couldn't be downloaded.
+     */
+    bool FindAchievementIcon(const FString& IconBaseUrl, const FAchievement& Achievement, bool bLocked, FAwsGameKitAtlasIcon& OutIcon) const;
+
+    /**
+     * @brief Broadcast with the url of each icon once it has been packed and FindIcon() can return it.
+     */
+    FOnIconReady& OnIconReady() { return IconReadyDelegate; }
+
+    /**
+     * @brief Forget every packed icon and release the atlas pages. Icons still downloading are dropped.
+     */
+    void Reset();
+
+    /**
+     * @brief Cancel the downloads in flight and drop the icons which aren't packed yet, for example when the player leaves the achievements menu.
+     *
+     * @details Packed icons are kept. The dropped icons are downloaded again by the next RequestIcon().
+     */
+    void CancelPendingIcons();
+
+    /**
+     * @brief Account for the atlas pages in FAwsGameKitCacheBudget. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void RegisterWithCacheBudget();
+
+private:
+    enum class EIconState : uint8
+    {
+        Pending,
+        Packed,
+        Failed
+    };
+
+    struct FIconEntry
+    {
+        EIconState State = EIconState::Pending;
+        FAwsGameKitAtlasIcon Icon;
+    };
+
+    void SendRequest(const FString& IconUrl, const FString& CachedETag);
+    void HandleResponse(TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request, TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> Response, bool bSucceeded, uint32 RequestGeneration);
+    void DecodeOnWorker(const FString& IconUrl, TArray<uint8>&& ImgData, uint32 RequestGeneration, int32 InnerSize);
+    void PackIcon(const FString& IconUrl, int32 Width, int32 Height, TArray<FColor>&& Pixels);
+    void FailIcon(const FString& IconUrl);
+    void CancelRequests();
+    UTexture2D* CreatePage() const;
+    void ReleasePages();
+
+    TMap<FString, FIconEntry> Icons;
+    TSet<FString> ValidatedUrls;
+    TMap<FString, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> InFlightRequests;
+    TArray<UTexture2D*> Pages;
+    IImageWrapperModule* ImageWrapperModule = nullptr;
+    FOnIconReady IconReadyDelegate;
+
+    // Layout of the current pages, read from the console variables by the first RequestIcon() after Reset()
+    int32 PageSize = 0;
+    int32 CellSize = 0;
+    int32 NextCell = 0;
+
+    // Incremented by Reset() so that downloads started before it are ignored
+    uint32 Generation = 0;
+
+    // Memory of the pages, read by FAwsGameKitCacheBudget from any thread
+    std::atomic<int64> PageBytes{ 0 };
+};
@@ -9,6 +9,7 @@
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
 #include "Achievements/AwsGameKitAchievementsWrapper.h"
+#include "Common/AwsGameKitFutures.h"
 #include "Core/AwsGameKitErrors.h"
 
 // Unreal
@@ -20,7 +21,30 @@
 class AWSGAMEKITRUNTIME_API AwsGameKitAchievements
 {
 private:
+    friend class FAwsGameKitAchievementsUpdateCoalescer;
+    friend class FAwsGameKitSessionBootstrap;
+    friend class FAwsGameKitWarmUp;
+    friend class UAwsGameKitAchievementsFunctionLibrary;
+
     static AchievementsLibrary GetAchievementsLibraryFromModule();
+
+    // Sends the update on the calling thread and records the returned progress.
+    static IntResult UpdateAchievementForPlayerBlocking(const FUpdateAchievementRequest& UpdateAchievementRequest, FAchievement& OutAchievement);
+
+    // Queues an update which failed while offline in FAwsGameKitOfflineWriteQueue, and replaces InOutResult with the enqueued status if it was queued.
+    static void EnqueueUpdateIfOffline(const FUpdateAchievementRequest& UpdateAchievementRequest, IntResult& InOutResult);
+
+    // Sends the updates of a batch in parallel on the calling thread and the worker pool, see UpdateAchievementsForPlayer().
+    static IntResult UpdateAchievementsForPlayerBlocking(const TArray<FUpdateAchievementRequest>& UpdateAchievementRequests, TArray<FAchievement>& OutAchievements);
+
+    // Returns true with the cached achievement if the update can be skipped because it's already earned, and revalidates stale progress in the background.
+    static bool FindEarnedAchievementToSkipUpdate(const FUpdateAchievementRequest& UpdateAchievementRequest, FAchievement& OutAchievement);
+
+    // Summarizes the cached achievements when they are up to date, otherwise lists all pages on the calling thread.
+    static IntResult GetAchievementSummaryBlocking(FAchievementSummary& OutSummary);
+
+    // Parses the stats published by the AggregateAchievementStats Lambda.
+    static bool ParseAchievementStats(const FString& Json, FAchievementStats& OutStats);
 public:
     /**
      * @brief Lists non-hidden achievements, and will call delegates after every page.
@@ -60,9 +84,26 @@ public:
         ListAchievementsForPlayer(request, Gather.OnResult(), Gather.OnStatus());
     }
 
+    /**
+     * @brief Lists achievements from the client-side cache, and refreshes them from the backend when the cache is stale.
+     *
+     * @details Lets menus open right away: if achievements are cached, ResultDelegate is called with GAMEKIT_SUCCESS and the cached list.
+     * If the cache is empty or stale (see FAwsGameKitAchievementsCache), all pages are listed again in the background, stored in the cache,
+     * and ResultDelegate is called a second time with the outcome of the refresh. Without an up-to-date cache ResultDelegate is called twice at most.
+     *
+     * When the cache is disabled (GameKit.Achievements.Cache.Enabled is 0) this behaves like ListAchievementsForPlayer(CombinedResultDelegate).
+     *
+     * @param ResultDelegate Delegate to process both the status code, and the returned array of achievements.
+     * The ::IntResult parameter is a GameKit status code and indicates the result of the API call.
+     * Status codes are defined in errors.h. This method's possible status codes are the same as ListAchievementsForPlayer().
+    */
+    static void ListAchievementsForPlayerRefreshIfStale(TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> ResultDelegate);
+
     /**
      * @brief Gets the specified achievement for currently logged in user, and passes it to ResultDelegate
      *
+     * @details Calls made while a GetAchievementForPlayer() of the same achievement is in flight share its result, unless GameKit.Runtime.DeduplicateReads is 0.
+     *
      * @param GetAchievementRequest USTRUCT specifying the achievment ID.
      * @param ResultDelegate Delegate that processes the status code and returned achievement.
      * The ::IntResult parameter is a GameKit status code and indicates the result of the API call.
@@ -79,6 +120,17 @@ public:
     /**
      * @brief Increments the currently logged in user's progress on a specific achievement.
      *
+     * @details When GameKit.Achievements.Coalesce.Enabled is set, increments may be merged with other calls for the same achievement
+     * and sent as one update, see FAwsGameKitAchievementsUpdateCoalescer. ResultDelegate then receives the response of the merged update.
+     *
+     * When GameKit.OfflineQueue.Enabled is set, an increment which fails because the backend can't be reached is queued in FAwsGameKitOfflineWriteQueue
+     * and sent once it can be reached again. ResultDelegate then receives GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED and the achievement
+     * as it was before the update; the progress is only known once the queued increment was sent.
+     *
+     * When GameKit.Achievements.Cache.SkipEarnedUpdates is set and the client-side cache shows the achievement as earned, the update isn't sent:
+     * ResultDelegate receives GAMEKIT_WARNING_ACHIEVEMENTS_ALREADY_EARNED and the cached achievement. If the cached progress is older than the
+     * cache TTL, the achievement is fetched again in the background, so that the next update is sent if it's no longer earned.
+     *
      * @param UpdateAchievementRequest USTRUCT containing the achievement ID, and how much to increment the player's progress by.
      * @param ResultDelegate Delegate that processes the status code and updated achievement which
      * contains info about whether it was just earned.
@@ -88,10 +140,72 @@ public:
      * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
+     * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The backend couldn't be reached and the increment was queued in the offline write queue.
+     * - GAMEKIT_WARNING_ACHIEVEMENTS_ALREADY_EARNED: The achievement is already earned and the update was skipped.
     */
     static void UpdateAchievementForPlayer(const FUpdateAchievementRequest& UpdateAchievementRequest,
         TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> ResultDelegate);
 
+    /**
+     * @brief Increments the currently logged in user's progress on several achievements, and passes all of the updated achievements to ResultDelegate at once.
+     *
+     * @details Use this when one gameplay event advances several achievements. The increments of a repeated achievement ID are added up and sent as one update.
+     *
+     * The backend's batch UpdateAchievements endpoint (POST /achievements/unlock) applies up to 25 updates in one call. The prebuilt client library
+     * doesn't call it yet, so the updates are sent at the same time instead, at most GameKit.Achievements.BatchParallelism at once (default 4).
+     * Each update is handled like UpdateAchievementForPlayer(), including GameKit.Achievements.Cache.SkipEarnedUpdates and the offline write queue,
+     * but isn't merged with the updates of other calls.
+     *
+     * @param UpdateAchievementRequests The achievement IDs, and how much to increment the player's progress on each of them by.
+     * @param ResultDelegate Delegate that processes the status code and the updated achievements, in the order of their first request.
+     * The ::IntResult parameter is GAMEKIT_SUCCESS when every update succeeded or was skipped because the achievement is already earned,
+     * otherwise the status of the first update which didn't; only the achievements whose update succeeded or was skipped are passed.
+     * This method's possible status codes are the same as UpdateAchievementForPlayer().
+    */
+    static void UpdateAchievementsForPlayer(const TArray<FUpdateAchievementRequest>& UpdateAchievementRequests,
+        TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> ResultDelegate);
+
+    /**
+     * @brief Gets how many achievements the currently logged in user has earned and their points, along with the totals of all non-hidden achievements.
+     *
+     * @details Use this for profile cards and completion percentages instead of listing and adding up the achievements yourself.
+     * When the client-side cache is enabled and up to date (see FAwsGameKitAchievementsCache), the summary is computed from it without a backend call.
+     *
+     * The backend's GetAchievementSummary endpoint (GET /achievements/summary) returns these totals from a record which is kept up to date
+     * when achievements are earned, without reading the achievements. The prebuilt client library doesn't call it yet, so otherwise this
+     * method lists all pages of achievements, and stores them in the cache when it is enabled.
+     *
+     * @param ResultDelegate Delegate that processes the status code and the summary.
+     * The ::IntResult parameter is a GameKit status code and indicates the result of the API call.
+     * Status codes are defined in errors.h. This method's possible status codes are the same as ListAchievementsForPlayer().
+    */
+    static void GetAchievementSummary(TAwsGameKitDelegateParam<const IntResult&, const FAchievementSummary&> ResultDelegate);
+
+    /**
+     * @brief Adds up the earned and total achievements and points of a list of achievements, as returned by ListAchievementsForPlayer().
+    */
+    static FAchievementSummary SummarizeAchievements(const TArray<FAchievement>& Achievements);
+
+    /**
+     * @brief Gets how many players have earned each non-hidden achievement, for rarity badges such as "earned by 3% of players".
+     *
+     * @details Requires AchievementStatsEnabled in the achievements feature's parameters.yml. The backend counts the unlocks and publishes their totals
+     * every AchievementStatsIntervalMinutes as stats/achievement_stats.json under the achievement icons url (see GetAchievementIconBaseUrl()), so the stats
+     * are read from CloudFront rather than from the backend's API and don't need a logged in player. They lag behind the unlocks by up to the interval
+     * plus the cache duration.
+     *
+     * The stats are kept in memory for as long as the Cache-Control header of the response allows; calls made meanwhile are answered without a request.
+     * Once they are stale they are requested again with If-None-Match, and kept if they didn't change.
+     *
+     * @param ResultDelegate Delegate that processes the status code and the stats.
+     * The ::IntResult parameter is a GameKit status code and indicates the result of the API call.
+     * Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The HTTP request failed, or the stats aren't published because AchievementStatsEnabled is false. Check the logs to see what the HTTP response code was.
+     * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The published stats are malformed.
+    */
+    static void GetAchievementStats(TAwsGameKitDelegateParam<const IntResult&, const FAchievementStats&> ResultDelegate);
+
     /**
      * @brief Gets the AWS CloudFront url which all achievement icons for this game/environment can be accessed from.
      *
@@ -101,4 +215,55 @@ public:
      * - GAMEKIT_SUCCESS: The API call was successful.
     */
     static void GetAchievementIconBaseUrl(TAwsGameKitDelegateParam<const IntResult&, const FString&> ResultDelegate);
+
+    /**
+     * @brief Builds the url of an achievement icon, or of one of its fixed size variants.
+     *
+     * @details The backend writes square variants of every uploaded icon, 64, 128 and 256 pixels by default, next to the icon itself.
+     * Download the smallest variant which fits instead of the full icon for list thumbnails. Icons uploaded before the variants
+     * were introduced only have the default icon.
+     *
+     * @param IconBaseUrl Url returned by GetAchievementIconBaseUrl().
+     * @param IconPath LockedIcon or UnlockedIcon of an FAchievement.
+     * @param Size Width and height of the variant in pixels, or 0 for the default icon.
+     * @return IconBaseUrl + IconPath, with "_<Size>" inserted before the file extension when Size isn't 0.
+    */
+    static FString GetAchievementIconUrl(const FString& IconBaseUrl, const FString& IconPath, int32 Size = 0);
+
+    /**
+     * @brief Awaitable versions of the methods above, with the same status codes.
+     *
+     * @details The futures are fulfilled on the GameKit worker thread which finished the call, so calls can be chained with TFuture::Next()
+     * without a hop through the game thread, and combined with AwsGameKitWhenAll(). Reads shared with other callers and coalesced updates
+     * are fulfilled on the game thread. See MakeAwsGameKitStatusFuture().
+    */
+    static TFuture<TAwsGameKitResult<TArray<FAchievement>>> ListAchievementsForPlayerAsync()
+    {
+        return MakeAwsGameKitResultFuture<TArray<FAchievement>>([](TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> Delegate) { ListAchievementsForPlayer(Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FAchievement>> GetAchievementForPlayerAsync(const FGetAchievementRequest& GetAchievementRequest)
+    {
+        return MakeAwsGameKitResultFuture<FAchievement>([&GetAchievementRequest](TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> Delegate) { GetAchievementForPlayer(GetAchievementRequest, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FAchievement>> UpdateAchievementForPlayerAsync(const FUpdateAchievementRequest& UpdateAchievementRequest)
+    {
+        return MakeAwsGameKitResultFuture<FAchievement>([&UpdateAchievementRequest](TAwsGameKitDelegateParam<const IntResult&, const FAchievement&> Delegate) { UpdateAchievementForPlayer(UpdateAchievementRequest, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<TArray<FAchievement>>> UpdateAchievementsForPlayerAsync(const TArray<FUpdateAchievementRequest>& UpdateAchievementRequests)
+    {
+        return MakeAwsGameKitResultFuture<TArray<FAchievement>>([&UpdateAchievementRequests](TAwsGameKitDelegateParam<const IntResult&, const TArray<FAchievement>&> Delegate) { UpdateAchievementsForPlayer(UpdateAchievementRequests, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FAchievementSummary>> GetAchievementSummaryAsync()
+    {
+        return MakeAwsGameKitResultFuture<FAchievementSummary>([](TAwsGameKitDelegateParam<const IntResult&, const FAchievementSummary&> Delegate) { GetAchievementSummary(Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FAchievementStats>> GetAchievementStatsAsync()
+    {
+        return MakeAwsGameKitResultFuture<FAchievementStats>([](TAwsGameKitDelegateParam<const IntResult&, const FAchievementStats&> Delegate) { GetAchievementStats(Delegate); });
+    }
 };
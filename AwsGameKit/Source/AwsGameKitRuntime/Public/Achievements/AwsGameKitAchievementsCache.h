@@ -0,0 +1,170 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in client-side cache of the achievements list.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Achievements/AwsGameKitAchievementCatalog.h"
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitAchievementModels.h"
+#include "AwsGameKitRuntime/Public/SessionManager/AwsGameKitPlayerContexts.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+
+/**
+ * @brief Client-side cache of the achievements returned by AwsGameKitAchievements::ListAchievementsForPlayer().
+ *
+ * @details The cache is disabled by default. Set the GameKit.Achievements.Cache.Enabled console variable to 1 to enable it.
+ *
+ * Achievement definitions (title, descriptions, icons, RequiredAmount, Points, ...) are kept in memory and on disk, in
+ * AchievementsCache.json in the achievements save directory (see UAwsGameKitFileUtils::GetFeatureSaveDirectory()), and expire after GameKit.Achievements.Cache.TtlSeconds.
+ * Player progress is only kept in memory, for each player (see FAwsGameKitPlayerScope). The methods read and write the progress of the player of
+ * the current scope. It is merged from the latest GetAchievementForPlayer() and UpdateAchievementForPlayer() responses, and cleared when the
+ * player logs out or is released.
+ *
+ * A list loaded from disk has no player progress, so it is always reported as stale.
+ * Use AwsGameKitAchievements::ListAchievementsForPlayerRefreshIfStale() to show the cached list right away and refresh it in the background.
+ *
+ * When GameKit.Achievements.Cache.SkipEarnedUpdates is also set, AwsGameKitAchievements::UpdateAchievementForPlayer() doesn't send updates of
+ * achievements the cached player progress shows as earned, see FindEarnedAchievement().
+ *
+ * The definitions are kept in an immutable FAwsGameKitAchievementCatalog and the player progress in a small array beside it. GetCatalog() shares them
+ * without copying the definitions; GetAchievements() and FindAchievement() create FAchievement views on demand.
+ *
+ * The in-memory list counts against FAwsGameKitCacheBudget. When it's evicted, it's read back from disk on next use, without player progress.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitAchievementsCache
+{
+public:
+    /**
+     * @brief Get the process-wide achievements cache.
+     */
+    static FAwsGameKitAchievementsCache& Get();
+
+    /**
+     * @brief Whether the cache is enabled (GameKit.Achievements.Cache.Enabled).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Whether updates of earned achievements are skipped (GameKit.Achievements.Cache.Enabled and GameKit.Achievements.Cache.SkipEarnedUpdates).
+     */
+    static bool ShouldSkipEarnedUpdates();
+
+    /**
+     * @brief Copy the cached achievements, loading them from disk on first use.
+     *
+     * @param OutAchievements Receives the cached achievements.
+     * @param bOutIsStale Set to true when the definitions are older than the TTL or the player progress isn't known.
+     * @return False if nothing is cached.
+     */
+    bool GetAchievements(TArray<FAchievement>& OutAchievements, bool& bOutIsStale);
+
+    /**
+     * @brief Share the cached catalog and copy the player progress, loading them from disk on first use. Cheaper than GetAchievements() for large catalogs.
+     *
+     * @param OutCatalog Receives the cached catalog, which stays valid and unchanged after the cache is updated.
+     * @param OutProgress Receives the player progress, at the indices of the catalog. Empty when the player progress isn't known.
+     * @param bOutIsStale Set to true when the definitions are older than the TTL or the player progress isn't known.
+     * @return False if nothing is cached.
+     */
+    bool GetCatalog(FAwsGameKitAchievementCatalogPtr& OutCatalog, TArray<FAwsGameKitAchievementProgress>& OutProgress, bool& bOutIsStale);
+
+    /**
+     * @brief Copy one cached achievement, including its player progress.
+     *
+     * @return False if the achievement isn't cached or the player progress isn't known.
+     */
+    bool FindAchievement(const FString& AchievementId, FAchievement& OutAchievement);
+
+    /**
+     * @brief Copy one cached achievement if the cached player progress shows it as earned, so that updating it would change nothing.
+     *
+     * @details Only looks at the in-memory list: a list read from disk has no player progress.
+     * @param OutAchievement Receives the cached achievement.
+     * @param bOutIsStale Set to true when the player progress of the achievement is older than the TTL.
+     * @return False if the achievement isn't cached, its player progress isn't known, or it isn't earned.
+     */
+    bool FindEarnedAchievement(const FString& AchievementId, FAchievement& OutAchievement, bool& bOutIsStale);
+
+    /**
+     * @brief Replace the cached achievements with a complete list returned by the backend and write the definitions to disk.
+     */
+    void StoreAchievements(const TArray<FAchievement>& NewAchievements);
+
+    /**
+     * @brief Merge the achievements returned by an incremental ListAchievementsForPlayer() call (see FListAchievementsRequest::UpdatedSince).
+     *
+     * @details Cached achievements are replaced, new ones are appended. The achievements which weren't returned are kept as they are.
+     * Nothing is merged while nothing is cached, since the returned achievements aren't the complete list.
+     */
+    void MergeAchievements(const TArray<FAchievement>& UpdatedAchievements);
+
+    /**
+     * @brief The latest UpdatedAt of the cached achievements, to pass as FListAchievementsRequest::UpdatedSince.
+     *
+     * @return An empty string if nothing is cached or the player progress isn't known.
+     */
+    FString GetLatestUpdatedAt() const;
+
+    /**
+     * @brief Merge the player progress of one achievement returned by GetAchievementForPlayer() or UpdateAchievementForPlayer().
+     *
+     * @details Achievements which aren't cached are ignored.
+     */
+    void MergeProgress(const FAchievement& Achievement);
+
+    /**
+     * @brief Forget the player progress, for example when the player logs out. The definitions are kept.
+     */
+    void ClearProgress();
+
+    /**
+     * @brief Forget the progress of a player, for example when it's released. The definitions are kept.
+     */
+    void ClearProgress(FAwsGameKitPlayerHandle Player);
+
+    /**
+     * @brief Drop everything which is cached, in memory and on disk.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Put the in-memory list under FAwsGameKitCacheBudget. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void RegisterWithCacheBudget();
+
+private:
+    struct FPlayerProgress
+    {
+        TArray<FAwsGameKitAchievementProgress> Progress;
+        TArray<FDateTime> UpdatedAt;
+    };
+
+    FPlayerProgress* FindPlayerProgress();
+    const FPlayerProgress* FindPlayerProgress() const;
+    void LoadFromDiskIfNeeded();
+    FString SerializeDefinitions() const;
+    void UpdateCachedBytes();
+    int64 EvictFromMemory();
+    static FString GetCacheFilePath();
+
+    mutable FCriticalSection Mutex;
+    FAwsGameKitAchievementCatalogPtr Catalog;
+    // At the indices of the catalog, only for the players whose progress is known
+    TMap<FAwsGameKitPlayerHandle, FPlayerProgress> PlayerProgress;
+    FDateTime FetchedAt;
+    bool bTriedDisk = false;
+
+    // For FAwsGameKitCacheBudget
+    int64 CachedBytes = 0;
+    double LastUsed = 0.0;
+};
@@ -31,6 +31,16 @@ public:
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
 
+    /**
+     * Builds the url of an achievement icon, or of one of its square size variants (64, 128 and 256 pixels by default).
+     *
+     * @param IconBaseUrl Url returned by Get Achievement Icons Base Url.
+     * @param IconPath Locked Icon or Unlocked Icon of an achievement.
+     * @param Size Width and height of the variant in pixels, or 0 for the default icon.
+    */
+    UFUNCTION(BlueprintPure, Category = "AWS GameKit | Achievements")
+    static FString GetAchievementIconUrl(const FString& IconBaseUrl, const FString& IconPath, int32 Size = 0);
+
     /**
      * Lists non-hidden achievements configured for this game.
      *
@@ -76,6 +86,25 @@ public:
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
 
+    /**
+     * Increments the currently logged in user's progress on several achievements, and returns all of the updated achievements at once.
+     *
+     * The increments of a repeated achievement ID are added up. See AwsGameKitAchievements::UpdateAchievementsForPlayer().
+     *
+     * @param UpdateAchievementsRequests The IDs of the achievements you are updating, and how much to increment each of them by.
+     * @param Results UStructs containing all metadata and the updated player progress of the achievements whose update succeeded.
+     * @param Error Ustruct containing a GameKit status code and optional error message: GAMEKIT_SUCCESS when every update succeeded,
+     * otherwise the status of the first update which didn't. The possible status codes are the same as Update Achievement For Player.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Achievements", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
+    static void UpdateAchievementsForPlayer(
+        UObject* WorldContextObject,
+        struct FLatentActionInfo LatentInfo,
+        const TArray<FUpdateAchievementRequest>& UpdateAchievementsRequests,
+        TArray<FAchievement>& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
     /**
      * Gets the specified achievement for currently logged in user, and passes it to ResultDelegate
      *
@@ -96,4 +125,21 @@ public:
         FAchievement& Results,
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
+
+    /**
+     * Gets how many achievements the currently logged in user has earned and their points, along with the totals of all non-hidden achievements.
+     *
+     * Use this for profile cards and completion percentages instead of listing and adding up the achievements.
+     *
+     * @param Results UStruct containing the earned and total achievement counts and points.
+     * @param Error Ustruct containing a GameKit status code and optional error message.
+     * Status codes are defined in errors.h. This method's possible status codes are the same as List Achievements For Player.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Achievements", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
+    static void GetAchievementSummary(
+        UObject* WorldContextObject,
+        struct FLatentActionInfo LatentInfo,
+        FAchievementSummary& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
 };
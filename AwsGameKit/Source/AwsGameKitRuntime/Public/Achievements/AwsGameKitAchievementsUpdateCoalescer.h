@@ -0,0 +1,115 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in merging of UpdateAchievementForPlayer() increments.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitAchievementModels.h"
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Merges the increments passed to AwsGameKitAchievements::UpdateAchievementForPlayer() per achievement and sends them as one update.
+ *
+ * @details Disabled by default. Set the GameKit.Achievements.Coalesce.Enabled console variable to 1 to enable it.
+ *
+ * Increments to the same achievement are held for up to GameKit.Achievements.Coalesce.WindowMs, or until
+ * GameKit.Achievements.Coalesce.MaxCalls calls have been merged, and are then sent as a single update.
+ * They are sent immediately when the predicted CurrentValue reaches RequiredAmount, so unlocking isn't delayed.
+ * The prediction uses the last update response for that achievement, or FAwsGameKitAchievementsCache. Until one of them knows the
+ * achievement, its updates are sent right away.
+ *
+ * Every merged call's ResultDelegate is called with the response of the combined update.
+ * Pending increments are sent when the runtime module shuts down, including through UAwsGameKitLifecycleUtils::ShutdownGameKit(). When
+ * FAwsGameKitLifecycle::HasShutdownDeadlinePassed(), they are moved to FAwsGameKitOfflineWriteQueue instead, which sends them in the next session.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitAchievementsUpdateCoalescer
+{
+public:
+    typedef TAwsGameKitDelegate<const IntResult&, const FAchievement&> FResultDelegate;
+
+    /**
+     * @brief Get the process-wide update coalescer.
+     */
+    static FAwsGameKitAchievementsUpdateCoalescer& Get();
+
+    /**
+     * @brief Whether coalescing is enabled (GameKit.Achievements.Coalesce.Enabled).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Register the flush timer with the core ticker, and the achievements feature with FAwsGameKitOfflineWriteQueue.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Send every pending increment on the calling thread and unregister the flush timer.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Try to merge an update with the pending ones.
+     *
+     * @return False if the update wasn't merged and must be sent by the caller.
+     */
+    bool Add(const FUpdateAchievementRequest& UpdateAchievementRequest, const FResultDelegate& ResultDelegate);
+
+    /**
+     * @brief Remember the progress returned for an achievement so that the following increments can be merged.
+     */
+    void RecordProgress(const FAchievement& Achievement);
+
+    /**
+     * @brief Send the pending increments of every achievement now.
+     *
+     * @param bBlocking Send them on the calling thread and return once the backend has answered, instead of on the worker pool.
+     */
+    void FlushAll(bool bBlocking = false);
+
+    /**
+     * @brief Forget the known player progress, for example when the player logs out. Call FlushAll() first to send the pending increments.
+     */
+    void ClearProgress();
+
+private:
+    // Hand the pending increments over to FAwsGameKitOfflineWriteQueue instead of sending them. Their ResultDelegates aren't called.
+    void QueueAllOffline();
+
+    struct FKnownProgress
+    {
+        int32 CurrentValue = 0;
+        int32 RequiredAmount = 0;
+        bool IsEarned = false;
+    };
+
+    struct FPendingUpdate
+    {
+        int32 IncrementBy = 0;
+        int32 NumCalls = 0;
+        double FlushAt = 0.0;
+        TArray<FResultDelegate> ResultDelegates;
+    };
+
+    bool Tick(float DeltaTime);
+    bool FindKnownProgress(const FString& AchievementId, FKnownProgress& OutProgress);
+    static void Send(const FString& AchievementId, FPendingUpdate&& Pending, bool bBlocking);
+
+    FCriticalSection Mutex;
+    TMap<FString, FKnownProgress> KnownProgress;
+    TMap<FString, FPendingUpdate> PendingUpdates;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
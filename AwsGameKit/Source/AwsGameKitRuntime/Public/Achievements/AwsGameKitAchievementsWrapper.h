@@ -14,7 +14,7 @@
 #include <AwsGameKitCore/Public/Core/Logging.h>
 
 // GameKit
-#if PLATFORM_IOS || PLATFORM_ANDROID
+#if PLATFORM_IOS || PLATFORM_ANDROID || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/achievements/exports.h>
 #endif
 
@@ -75,7 +75,7 @@ public:
      * @param logCb Callback function for logging information and errors.
      * @return Pointer to the new Achievements instance.
     */
-    GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE GameKitAchievementsInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb);
+    virtual GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE GameKitAchievementsInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb);
 
     /**
      * @brief Destroys the passed in achievements instance.
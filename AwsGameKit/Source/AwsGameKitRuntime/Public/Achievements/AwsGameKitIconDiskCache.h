@@ -0,0 +1,51 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief On-disk cache of downloaded achievement icons, shared by the editor and the runtime.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+
+/**
+ * @brief Stores downloaded achievement icons under Saved/AwsGameKit/IconCache, content-addressed by url and ETag.
+ *
+ * @details For each url, <SHA1(url)>.etag holds the ETag of the cached icon and <SHA1(url|ETag)>.png holds its bytes.
+ * Callers revalidate a cached icon by sending its ETag in If-None-Match and calling Save() with the new ETag and content on a 200 response.
+ * Icons served without an ETag can't be revalidated and aren't cached.
+ *
+ * The methods only touch the disk and can be called from any thread. Concurrent writes for the same url are last-write-wins.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitIconDiskCache
+{
+public:
+    /**
+     * @brief Directory the icons are cached in.
+     */
+    static FString GetCacheDirectory();
+
+    /**
+     * @brief Read a cached icon.
+     *
+     * @param Url Url the icon was downloaded from.
+     * @param OutImgData Receives the icon bytes, as they were downloaded.
+     * @param OutETag Receives the ETag the icon was served with.
+     * @return False if the icon isn't cached.
+     */
+    static bool Load(const FString& Url, TArray<uint8>& OutImgData, FString& OutETag);
+
+    /**
+     * @brief Cache a downloaded icon, replacing the previous version of the same url.
+     *
+     * @details Does nothing when ETag is empty.
+     */
+    static void Save(const FString& Url, const FString& ETag, const TArray<uint8>& ImgData);
+
+private:
+    static FString GetETagFilePath(const FString& Url);
+    static FString GetImageFilePath(const FString& Url, const FString& ETag);
+};
@@ -5,6 +5,7 @@
 
 // GameKit
 #include "Achievements/AwsGameKitAchievementsWrapper.h"
+#include "AwsGameKitRuntimePublicHelpers.h"
 #include "Core/AwsGameKitCoreWrapper.h"
 #include "Core/AwsGameKitMarshalling.h"
 #include "GameSaving/AwsGameKitGameSavingWrapper.h"
@@ -12,15 +13,25 @@
 #include "SessionManager/AwsGameKitSessionManagerWrapper.h"
 #include "UserGameplayData/AwsGameKitUserGameplayDataWrapper.h"
 
+// Standard library
+#include <atomic>
+
 // Unreal
+#include "Async/Future.h"
 #include "AwsGameKitUserGameplayDataStateHandler.h"
+#include "Containers/Array.h"
 #include "Delegates/Delegate.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
+#include "Templates/Function.h"
 #include "Templates/SharedPointer.h"
 
 #include "AwsGameKitRuntime.generated.h"
 
+// The instances of a player created with FAwsGameKitPlayerContexts. The feature libraries returned for a player hold a reference to them,
+// so that they are released only once the player is released and no copy of its libraries is in use.
+struct FAwsGameKitPlayerContext;
+
 struct CoreLibrary
 {
     TSharedPtr<AwsGameKitCoreWrapper> CoreWrapper;
@@ -30,24 +41,28 @@ struct IdentityLibrary
 {
     TSharedPtr<AwsGameKitIdentityWrapper> IdentityWrapper;
     GAMEKIT_IDENTITY_INSTANCE_HANDLE IdentityInstanceHandle = nullptr;
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> PlayerContext;
 };
 
 struct SessionManagerLibrary
 {
     TSharedPtr<AwsGameKitSessionManagerWrapper> SessionManagerWrapper;
     GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE SessionManagerInstanceHandle = nullptr;
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> PlayerContext;
 };
 
 struct AchievementsLibrary
 {
     TSharedPtr<AwsGameKitAchievementsWrapper> AchievementsWrapper;
     GAMEKIT_ACHIEVEMENTS_INSTANCE_HANDLE AchievementsInstanceHandle = nullptr;
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> PlayerContext;
 };
 
 struct GameSavingLibrary
 {
     TSharedPtr<AwsGameKitGameSavingWrapper> GameSavingWrapper;
     GAMEKIT_GAME_SAVING_INSTANCE_HANDLE GameSavingInstanceHandle = nullptr;
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> PlayerContext;
 };
 
 struct UserGameplayDataLibrary
@@ -55,6 +70,36 @@ struct UserGameplayDataLibrary
     TSharedPtr<AwsGameKitUserGameplayDataWrapper> UserGameplayDataWrapper;
     GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE UserGameplayDataInstanceHandle = nullptr;
     TSharedPtr<AwsGameKitUserGameplayDataStateHandler> UserGameplayDataStateHandler;
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> PlayerContext;
+};
+
+/**
+ * @brief Whether a feature library was loaded, see FAwsGameKitRuntimeModule::GetLibraryLoadResult().
+ */
+enum class EAwsGameKitLibraryLoadResult : uint8
+{
+    // Not loaded yet. The library is loaded on first use, or by PreloadFeatureLibraries().
+    NotLoaded = 0,
+
+    // The library and its instance were created.
+    Loaded = 1,
+
+    // The library couldn't be loaded. Check the output logs for the reason.
+    Failed = 2
+};
+
+/**
+ * @brief Creates the feature wrappers in place of the ones which load the GameKit libraries, see FAwsGameKitRuntimeModule::SetWrapperFactories().
+ *
+ * @details A factory which isn't bound leaves its feature to the GameKit library. The created wrapper's Initialize() and instance create method are
+ * called as usual, they don't need to load anything. FAwsGameKitMockBackend::MakeWrapperFactories() gives in-memory implementations of all four features.
+ */
+struct FAwsGameKitWrapperFactories
+{
+    TFunction<TSharedPtr<AwsGameKitIdentityWrapper>()> Identity;
+    TFunction<TSharedPtr<AwsGameKitAchievementsWrapper>()> Achievements;
+    TFunction<TSharedPtr<AwsGameKitGameSavingWrapper>()> GameSaving;
+    TFunction<TSharedPtr<AwsGameKitUserGameplayDataWrapper>()> UserGameplayData;
 };
 
 /**
@@ -65,6 +110,9 @@ DECLARE_DYNAMIC_DELEGATE_TwoParams(FNetworkStatusChangeDelegate, bool, isConnect
 class AWSGAMEKITRUNTIME_API FAwsGameKitRuntimeModule : public IModuleInterface
 {
 private:
+    // Swaps in stub wrappers, see GameKit.Benchmark
+    friend class FAwsGameKitBenchmarks;
+
     CoreLibrary coreLibrary;
     SessionManagerLibrary sessionManagerLibrary;
     IdentityLibrary identityLibrary;
@@ -72,7 +120,31 @@ private:
     GameSavingLibrary gameSavingLibrary;
     UserGameplayDataLibrary userGameplayDataLibrary;
 
-    static FCriticalSection libLoadMutex;
+    // One per library, so that PreloadFeatureLibraries() can load them in parallel
+    static FCriticalSection identityLibLoadMutex;
+    static FCriticalSection achievementsLibLoadMutex;
+    static FCriticalSection gameSavingLibLoadMutex;
+    static FCriticalSection userGameplayDataLibLoadMutex;
+
+    // Set once a feature library has been created so that the getters can skip its load mutex. Cleared by ShutdownModule().
+    std::atomic<bool> identityLibraryLoaded{ false };
+    std::atomic<bool> achievementsLibraryLoaded{ false };
+    std::atomic<bool> gameSavingLibraryLoaded{ false };
+    std::atomic<bool> userGameplayDataLibraryLoaded{ false };
+
+    std::atomic<EAwsGameKitLibraryLoadResult> identityLibraryLoadResult{ EAwsGameKitLibraryLoadResult::NotLoaded };
+    std::atomic<EAwsGameKitLibraryLoadResult> achievementsLibraryLoadResult{ EAwsGameKitLibraryLoadResult::NotLoaded };
+    std::atomic<EAwsGameKitLibraryLoadResult> gameSavingLibraryLoadResult{ EAwsGameKitLibraryLoadResult::NotLoaded };
+    std::atomic<EAwsGameKitLibraryLoadResult> userGameplayDataLibraryLoadResult{ EAwsGameKitLibraryLoadResult::NotLoaded };
+
+    // Set by SetWrapperFactories() before any feature library is loaded
+    FAwsGameKitWrapperFactories wrapperFactories;
+
+    // Started by PreloadFeatureLibraries(), waited for by ShutdownModule() before the libraries are released
+    TArray<TFuture<void>> preloadTasks;
+
+    // Published by StartupModule() so that callers don't need to look the module up by name on every call, cleared by ShutdownModule().
+    static std::atomic<FAwsGameKitRuntimeModule*> instance;
 
     bool initializeWrappers();
     void loadIdentityLibrary();
@@ -112,6 +184,11 @@ public:
      */
     bool AreFeatureSettingsLoaded(FeatureType type) const;
 
+    /**
+     * @brief See AwsGameKitSessionManagerWrapper::GetLoadedFeatureSettings(). The flags of all features in one call, without calling into the library.
+     */
+    FAwsGameKitLoadedFeatureSettings GetLoadedFeatureSettings() const;
+
     /**
      * @brief See AwsGameKitSessionManagerWrapper::ReloadConfig().
      *
@@ -119,14 +196,68 @@ public:
      */
     bool ReloadConfigFile(const FString& subdirectory) const;
 
+    /**
+     * @brief Get the loaded AwsGameKitRuntime module without a by-name lookup in the module manager.
+     */
+    static FAwsGameKitRuntimeModule& Get();
+
     // ------ Library Getters ------
-    CoreLibrary GetCoreLibrary();
-    SessionManagerLibrary GetSessionManagerLibrary();
+    // The feature libraries are created on first use. The module's own instances stay valid until ShutdownModule().
+    // Inside an FAwsGameKitPlayerScope they return the libraries of the scope's player, see FAwsGameKitPlayerContexts. The libraries are
+    // returned by copy, a player's instances stay valid as long as a copy is in use.
+    const CoreLibrary& GetCoreLibrary() const;
+    SessionManagerLibrary GetSessionManagerLibrary() const;
     IdentityLibrary GetIdentityLibrary();
     AchievementsLibrary GetAchievementsLibrary();
     GameSavingLibrary GetGameSavingLibrary();
     UserGameplayDataLibrary GetUserGameplayDataLibrary();
 
+    /**
+     * @brief Load the libraries of the features whose settings are in "awsGameKitClientConfig.yml", each on its own background thread.
+     *
+     * @details Called by StartupModule() outside the editor when the GameKit.Runtime.PreloadLibraries console variable is set, so that the first
+     * call to a feature doesn't wait for its library to load. Call it from the game thread, for example during a loading screen, after reloading
+     * the config file. Libraries which are already loaded and features without settings are skipped. A getter called during the preload waits for it.
+     */
+    void PreloadFeatureLibraries();
+
+    /**
+     * @brief Warm up the features during a loading screen, so that their first calls don't wait for the libraries to load, the connections to be made and the Lambdas to start.
+     *
+     * @details On the worker pool: reloads the config file if a feature has no settings, then in parallel loads each feature's library and, when a
+     * player is logged in, makes one cheap read which connects the library to the backend, wakes the feature's Lambda and fills the runtime's cache
+     * (the player's profile, the achievements, the bundle names). Call it again after login to warm up the Lambdas. Safe to call from any thread.
+     *
+     * @param features The features to warm up.
+     * @param onComplete Called on the game thread with GAMEKIT_ERROR_SETTINGS_MISSING if a feature has no settings, else the status of the first read
+     * which failed, else GAMEKIT_SUCCESS. Reads skipped because no player is logged in aren't failures.
+     */
+    void WarmUp(const TArray<FeatureType>& features, const FAwsGameKitStatusDelegate& onComplete);
+
+    /**
+     * @brief Whether the feature's library is part of this build, see bWithAchievements, bWithGameSaving and bWithUserGameplayData in AwsGameKitCore.Build.cs.
+     *
+     * @details The calls of a feature left out of the build fail with GAMEKIT_ERROR_GENERAL, unless SetWrapperFactories() provides its wrapper.
+     * Identity, Authentication and the editor always have every library.
+     */
+    static bool IsFeatureBuilt(FeatureType type);
+
+    /**
+     * @brief Whether the library of a feature was loaded, either on first use or by PreloadFeatureLibraries().
+     */
+    EAwsGameKitLibraryLoadResult GetLibraryLoadResult(FeatureType type) const;
+
+    /**
+     * @brief Create the feature wrappers with factories instead of loading the GameKit libraries, for example to run against an in-memory backend.
+     *
+     * @details Call it before the first use of any feature, and before PreloadFeatureLibraries(): from the StartupModule() of a module loaded in the
+     * PostConfigInit phase, or with GameKit.Runtime.PreloadLibraries off. Starting the game with -GameKitMockBackend installs the factories of
+     * FAwsGameKitMockBackend from StartupModule(). The Core and Session Manager libraries are always loaded.
+     *
+     * @return False, and the factories are ignored, if a feature library was already loaded.
+     */
+    bool SetWrapperFactories(const FAwsGameKitWrapperFactories& factories);
+
     // Runtime delegates
     void SetNetworkChangeDelegate(const FNetworkStatusChangeDelegate& networkStatusChangeDelegate);
 
@@ -0,0 +1,98 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Page size of the paginated GameKit calls, adapted to the measured latency of their pages.
+ */
+
+#pragma once
+
+// Unreal
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Picks the page size of one paginated API from the time and size of the pages it returned.
+ *
+ * @details Disabled by default, the page size requested by the caller is then used as is. Set the GameKit.Pagination.Adaptive console variable to enable it.
+ *
+ * Each page costs a fixed round trip plus a time per item. The controller fits both from the recorded pages, giving recent pages more weight, and sizes
+ * the next pages so that one takes GameKit.Pagination.TargetPageSeconds (default 0.5). Larger pages pay the round trip fewer times, so the total time
+ * drops as pages grow, but the first page, which the game usually waits on, takes longer: the target bounds it. When the round trip alone is longer
+ * than the target, pages are sized so that transferring their items takes as long as the round trip, which keeps the total time within twice the best.
+ * Pages are also kept under GameKit.Pagination.MaxPageKilobytes, and within GameKit.Pagination.MinPageSize and the largest page the backend serves.
+ * The size at most doubles or halves with each recorded page, so one slow page doesn't swing it, and older pages fade out
+ * quickly enough to follow a change of network.
+ *
+ * The page size requested by the caller is only used until the first page is recorded. All methods are thread safe.
+ *
+ * Used by:
+ * - AwsGameKitAchievementsWrapper::GameKitListAchievements(), timed per page.
+ * - AwsGameKitGameSavingWrapper::GameKitGetAllSlotSyncStatuses(), timed per call: the library returns the slots once all pages are listed.
+ * - AwsGameKitUserGameplayDataWrapper::GameKitGetUserGameplayDataBundle(), timed per call, through the PaginationSize of the client settings.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitAdaptivePageSize
+{
+public:
+    /**
+     * @param Name Name of the API, for logs.
+     * @param DefaultPageSize Page size of the library or backend when the caller passes 0.
+     * @param MaxPageSize Largest page the backend serves.
+     */
+    FAwsGameKitAdaptivePageSize(const TCHAR* Name, int32 DefaultPageSize, int32 MaxPageSize);
+
+    /**
+     * @brief Whether GameKit.Pagination.Adaptive is set.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Page size of the next call.
+     *
+     * @param RequestedPageSize Page size passed by the caller, returned when adaptive page sizes are disabled or no page was recorded yet.
+     */
+    int32 GetPageSize(int32 RequestedPageSize) const;
+
+    /**
+     * @brief Record a page returned by the backend.
+     *
+     * @param PageSize Page size the call was made with, 0 for the default.
+     * @param NumItems Items in the page. Empty pages are ignored.
+     * @param Bytes Size of the page, or 0 when it isn't known.
+     * @param Seconds Time from the request of the page to its response.
+     */
+    void RecordPage(int32 PageSize, int32 NumItems, int64 Bytes, double Seconds);
+
+    /**
+     * @brief Record a call which listed every page before returning, as pages of equal size and duration.
+     *
+     * @param PageSize Page size the call was made with, 0 for the default.
+     * @param NumItems Items returned by the call.
+     * @param Bytes Size of the items, or 0 when it isn't known.
+     * @param Seconds Duration of the call.
+     */
+    void RecordCall(int32 PageSize, int32 NumItems, int64 Bytes, double Seconds);
+
+private:
+    void AddSample(int32 PageSize, double NumItems, double Bytes, double Seconds);
+    int32 ComputePageSize(int32 PageSize) const;
+
+    const TCHAR* Name;
+    const int32 DefaultPageSize;
+    const int32 MaxPageSize;
+
+    mutable FCriticalSection Mutex;
+
+    // Exponentially weighted sums for the least squares fit of Seconds = RoundTrip + SecondsPerItem * NumItems
+    double Weight = 0.0;
+    double SumItems = 0.0;
+    double SumSeconds = 0.0;
+    double SumItemsSquared = 0.0;
+    double SumItemsSeconds = 0.0;
+
+    // Items and bytes of the pages whose size is known
+    double SumSizedItems = 0.0;
+    double SumBytes = 0.0;
+
+    // 0 until a page is recorded
+    int32 CurrentPageSize = 0;
+};
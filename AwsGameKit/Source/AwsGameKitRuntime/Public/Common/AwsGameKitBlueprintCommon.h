@@ -6,17 +6,25 @@
 #include "Models/AwsGameKitCommonModels.h"
 
 // GameKit
+#include "Common/AwsGameKitLatencyHistograms.h"
+#include "Common/AwsGameKitStats.h"
+#include "Common/AwsGameKitWorkerPool.h"
 #include "Core/AwsGameKitErrors.h"
+#include "Core/AwsGameKitTrace.h"
 
 // Unreal
 #include "Async/Async.h"
 #include "Containers/Queue.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Engine/LatentActionManager.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/World.h"
 #include "LatentActions.h"
 #include "Misc/Optional.h"
 
+// Standard library
+#include <atomic>
+
 UENUM()
 enum class EAwsGameKitSuccessOrFailureExecutionPin : uint8
 {
@@ -29,6 +37,22 @@ struct TAwsGameKitInternalActionState
     FAwsGameKitOperationResult Err;
     ResultType Results;
     TOptional<TQueue<ResultType>> PartialResultsQueue;
+
+    // Set on the game thread when the owning latent action is aborted or its object is destroyed.
+    // Queued work is skipped entirely; long running work may poll this between backend calls.
+    FThreadSafeBool bCancelled;
+
+    // Set by the worker once Err and Results are final, and whenever partial results are queued,
+    // so that a latent action only loads these flags on the ticks where nothing happened.
+    std::atomic<bool> bCompleted{ false };
+    std::atomic<bool> bPartialResultsPending{ false };
+
+    // Queue partial results for the latent action's partial-results delegate. Only call it when PartialResultsQueue is valid.
+    void EnqueuePartialResults(ResultType&& PartialResults)
+    {
+        PartialResultsQueue->Enqueue(MoveTemp(PartialResults));
+        bPartialResultsPending.store(true, std::memory_order_release);
+    }
 };
 
 template <typename ResultType = FNoopStruct>
@@ -101,29 +125,78 @@ public:
     TAwsGameKitInternalActionStatePtr<ResultType> ThreadedState;
 
     // LaunchThreadedWork MUST be called immediately; the lambda should capture + fill ThreadedState,
-    // and should stream partial result sets into ThreadedState->PartialResultsQueue if it is valid.
+    // and should stream partial result sets with ThreadedState->EnqueuePartialResults() if ThreadedState->PartialResultsQueue is valid.
     // (If ThreadedState->PartialResultsQueue is not a valid object, it means that no partial-results
     // delegate was provided and there is no need to stream partial results via threadsafe queueing.)
+    // OperationName ("Feature.Operation") is the name the latency until the outputs are set is recorded under.
+    // Lane is the feature's default FAwsGameKitWorkerPool lane, the caller's FAwsGameKitWorkLaneScope takes precedence.
     template <typename LambdaType>
-    void LaunchThreadedWork(LambdaType&& Lambda)
+    void LaunchThreadedWork(const TCHAR* OperationName, LambdaType&& Lambda, EAwsGameKitWorkLane Lane = EAwsGameKitWorkLane::Normal)
     {
-        ThreadedResult = Async(EAsyncExecution::Thread, MoveTemp(Lambda));
+        bLaunched = true;
+        LatencyOperation = FName(OperationName);
+        LaunchTime = FPlatformTime::Seconds();
+#if AWSGAMEKIT_TRACE_ENABLED
+        TraceCallId = FAwsGameKitTrace::GetContext().CallId;
+#endif
+        FAwsGameKitWorkerPool::Get().Dispatch([State = ThreadedState, Work = MoveTemp(Lambda)]() mutable
+        {
+            if (!State->bCancelled)
+            {
+                Work();
+                FAwsGameKitTrace::SetStatus(static_cast<uint32>(State->Err.Status));
+            }
+            State->bCompleted.store(true, std::memory_order_release);
+        }, Lane);
+    }
+
+    virtual ~TAwsGameKitInternalThreadedAction()
+    {
+        Cancel();
+    }
+
+    virtual void NotifyObjectDestroyed() override
+    {
+        Cancel();
+    }
+
+    virtual void NotifyActionAborted() override
+    {
+        Cancel();
     }
 
 private:
-    // This override function is regularly called by the latent action manager
+    // Nothing is waiting for the results any more, so don't spend a worker thread on a call which hasn't started yet.
+    void Cancel()
+    {
+        if (bLaunched && !ThreadedState->bCompleted.load(std::memory_order_acquire))
+        {
+            ThreadedState->bCancelled = true;
+        }
+    }
+
+    // This override function is called every tick by the latent action manager. Until the worker sets one of the
+    // state's flags, it only loads them.
     virtual void UpdateOperation(FLatentResponse& Response) override
     {
-        check(ThreadedResult.IsValid()); // If this check fires, it means Launch was not called
-        if (ThreadedResult.IsReady())
+        check(bLaunched); // If this check fires, it means Launch was not called
+        if (ThreadedState->bCompleted.load(std::memory_order_acquire))
         {
+            SCOPE_CYCLE_COUNTER(STAT_AwsGameKit_GameThreadCallbacks);
+            CSV_SCOPED_TIMING_STAT(AwsGameKit, GameThreadCallbacks);
+            FAwsGameKitStats::RecordDelegatesDispatched(1);
+#if AWSGAMEKIT_TRACE_ENABLED
+            FAwsGameKitTraceCurrentCallScope TraceCallScope(TraceCallId);
+            AWSGAMEKIT_TRACE_PHASE(GameThreadDelivery);
+#endif
             DispatchPartialResults(PartialResultsDelegate, true);
             OutResults = MoveTemp(ThreadedState->Results);
             OutStatus = ThreadedState->Err;
             OutSuccessOrFailure = ThreadedState->Err.Status == GameKit::GAMEKIT_SUCCESS ? EAwsGameKitSuccessOrFailureExecutionPin::OnSuccess : EAwsGameKitSuccessOrFailureExecutionPin::OnFailure;
+            FAwsGameKitLatencyHistograms::Get().Record(LatencyOperation, FPlatformTime::Seconds() - LaunchTime);
             Response.FinishAndTriggerIf(true, LatentInfo.ExecutionFunction, LatentInfo.Linkage, LatentInfo.CallbackTarget);
         }
-        else
+        else if (ThreadedState->bPartialResultsPending.load(std::memory_order_acquire))
         {
             DispatchPartialResults(PartialResultsDelegate, false);
         }
@@ -156,8 +229,12 @@ private:
 
         check(ThreadedState->PartialResultsQueue);
 
+        // Cleared before draining, so that results queued while draining set it again for the next tick
+        ThreadedState->bPartialResultsPending.store(false, std::memory_order_relaxed);
+
         bool bInvokedWithFinal = false;
 
+        // Dequeue() moves each result set out of the queue
         ResultType TempResults;
         while (ThreadedState->PartialResultsQueue->Dequeue(TempResults))
         {
@@ -181,7 +258,12 @@ private:
     ResultType& OutResults;
     FAwsGameKitOperationResult& OutStatus;
     PartialResultsDelegateType PartialResultsDelegate;
-    TFuture<void> ThreadedResult;
+    bool bLaunched = false;
+    FName LatencyOperation;
+    double LaunchTime = 0.0;
+#if AWSGAMEKIT_TRACE_ENABLED
+    uint32 TraceCallId = 0;
+#endif
 };
 
 template <typename RequestType, typename ResultType, typename StreamingDelegateType = FNoopStruct>
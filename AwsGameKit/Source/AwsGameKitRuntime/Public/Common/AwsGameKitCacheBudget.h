@@ -0,0 +1,129 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Shared memory budget of the GameKit client caches.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/Ticker.h"
+#include "Delegates/IDelegateInstance.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+// Standard library
+#include <atomic>
+
+/**
+ * @brief Order in which FAwsGameKitCacheBudget evicts the caches. Entries of a lower priority are evicted first, whatever their age.
+ */
+enum class EAwsGameKitCachePriority : uint8
+{
+    // Large and cheap to fetch again, such as prefetched save slots
+    Low,
+
+    // Bundle read cache
+    Normal,
+
+    // Small entries other features rely on, such as the achievements catalog
+    High
+};
+
+/**
+ * @brief How FAwsGameKitCacheBudget sees a cache. All functions must be thread safe.
+ */
+struct FAwsGameKitBudgetedCache
+{
+    // Memory held by the cache, in bytes
+    TFunction<int64()> GetBytes;
+
+    // FPlatformTime::Seconds() at which the least recently used evictable entry was last used, or MAX_dbl when nothing can be evicted
+    TFunction<double()> GetOldestUse;
+
+    // Evict the least recently used entry and return the bytes freed, 0 if nothing could be evicted. Not bound for caches which are only accounted.
+    TFunction<int64()> EvictOldest;
+};
+
+/**
+ * @brief Keeps the GameKit client caches within one memory budget, evicting their least recently used entries across all of them.
+ *
+ * @details The caches register with RegisterCache(). Every second, and when a cache calls RequestEnforce() after it grew, the budget adds up
+ * their sizes and, while the evictable total is over GameKit.CacheBudget.MaxBytes (default 32 MB, 0 for no budget), evicts the least recently used
+ * entry of the lowest priority cache which has something to evict. The accounted-only caches, and the caches once they have nothing left to evict,
+ * don't count toward the budget.
+ *
+ * When the platform reports low memory through FCoreDelegates::GetMemoryTrimDelegate(), every evictable entry is evicted.
+ *
+ * Registered caches:
+ * - Prefetched save slots (FAwsGameKitGameSavingLoginPrefetcher), low priority, evicted per slot.
+ * - User Gameplay Data bundles (FAwsGameKitUserGameplayDataCache), normal priority, evicted per bundle. An evicted bundle is read again from the backend.
+ * - Achievements catalog (FAwsGameKitAchievementsCache), high priority, evicted as a whole. It is read back from disk without player progress.
+ * - Achievement icon atlas (FAwsGameKitAchievementIconAtlas), only accounted: the pages may be drawn by the UI, call Reset() to release them.
+ *
+ * The total is published as the "Cache Bytes" counter of the AwsGameKit stat group. Eviction runs on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitCacheBudget
+{
+public:
+    /**
+     * @brief Get the process-wide cache budget.
+     */
+    static FAwsGameKitCacheBudget& Get();
+
+    /**
+     * @brief Register the enforcement timer with the core ticker and bind the memory trim delegate. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the timer, the memory trim delegate and the caches. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Put a cache under the budget until Shutdown(). The cache must outlive the budget, which is the case of the process-wide caches.
+     */
+    void RegisterCache(const FString& Name, EAwsGameKitCachePriority Priority, FAwsGameKitBudgetedCache&& Cache);
+
+    /**
+     * @brief Enforce the budget on the next tick instead of within a second, for example after a large entry was stored. Thread safe.
+     */
+    void RequestEnforce();
+
+    /**
+     * @brief Total memory held by the registered caches, in bytes.
+     */
+    int64 GetTotalBytes() const;
+
+    /**
+     * @brief Evict until the evictable bytes of the caches fit in MaxBytes. Called on the game thread.
+     *
+     * @return Bytes freed.
+     */
+    int64 EvictTo(int64 MaxBytes);
+
+private:
+    struct FRegisteredCache
+    {
+        FString Name;
+        EAwsGameKitCachePriority Priority;
+        FAwsGameKitBudgetedCache Cache;
+    };
+
+    bool Tick(float DeltaTime);
+    void OnMemoryTrim();
+
+    // Copy of the registered caches, so that their functions are called without holding Mutex
+    TArray<FRegisteredCache> GetCaches() const;
+
+    mutable FCriticalSection Mutex;
+    TArray<FRegisteredCache> Caches;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle MemoryTrimHandle;
+    double NextEnforceTime = 0.0;
+    std::atomic<bool> bEnforceRequested{ false };
+    std::atomic<bool> bTrimRequested{ false };
+};
@@ -0,0 +1,113 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Deadlines and cooperative cancellation of GameKit calls.
+ */
+
+#pragma once
+
+// Unreal
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+class FAwsGameKitCancellationToken;
+typedef TSharedPtr<FAwsGameKitCancellationToken, ESPMode::ThreadSafe> FAwsGameKitCancellationTokenPtr;
+
+/**
+ * @brief Lets the caller abandon GameKit calls, explicitly with Cancel() or when a deadline passes.
+ *
+ * @details Pass the token to the calls with an FAwsGameKitCancellationScope. An abandoned call:
+ * - doesn't start if it was abandoned while queued on the GameKit worker pool,
+ * - stops forwarding pages once abandoned, in paginated calls such as AwsGameKitAchievements::ListAchievementsForPlayer() and
+ *   AwsGameKitGameSaving::GetAllSlotSyncStatuses(),
+ * - doesn't call its delegates. The futures of the awaitable APIs (see AwsGameKitFutures.h) are fulfilled with
+ *   GAMEKIT_ERROR_REQUEST_TIMED_OUT after a deadline, and GAMEKIT_ERROR_GENERAL after Cancel().
+ *
+ * A backend request which is already in flight completes in the GameKit client library; its result is dropped.
+ * One token can be shared by all the calls of a menu, and cancelled when the player leaves it. All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitCancellationToken : public TSharedFromThis<FAwsGameKitCancellationToken, ESPMode::ThreadSafe>
+{
+public:
+    /**
+     * @brief Create a token.
+     *
+     * @param TimeoutSeconds Time after which the calls are abandoned, or 0 for no deadline.
+     */
+    static FAwsGameKitCancellationTokenPtr Create(double TimeoutSeconds = 0.0);
+
+    /**
+     * @brief Abandon the calls of this token.
+     */
+    void Cancel();
+
+    /**
+     * @brief Whether Cancel() was called.
+     */
+    bool IsCancelled() const;
+
+    /**
+     * @brief Whether the deadline passed.
+     */
+    bool IsDeadlineExceeded() const;
+
+    /**
+     * @brief Whether the calls of this token are abandoned, because Cancel() was called or the deadline passed.
+     */
+    bool IsAbandoned() const
+    {
+        return IsCancelled() || IsDeadlineExceeded();
+    }
+
+    /**
+     * @brief Run Callback on the game thread once the deadline passes, even if the call is still waiting for the GameKit client library.
+     * Does nothing if the token has no deadline.
+     *
+     * @details Used by the awaitable APIs to fulfil their futures at the deadline. The callback runs even if Cancel() was called first, check IsCancelled().
+     */
+    void CallOnDeadline(TFunction<void()> Callback) const;
+
+private:
+    FThreadSafeBool bCancelled;
+
+    // FPlatformTime::Seconds() after which the calls are abandoned, 0 for none
+    double Deadline = 0.0;
+};
+
+/**
+ * @brief Attaches a cancellation token to the GameKit calls started on this thread in its lifetime.
+ *
+ * @details The token is carried over to the work the calls run on the GameKit worker pool, and to their result delegates.
+ *
+ *     FAwsGameKitCancellationTokenPtr Token = FAwsGameKitCancellationToken::Create(10.0);
+ *     {
+ *         FAwsGameKitCancellationScope CancellationScope(Token);
+ *         AwsGameKitAchievements::ListAchievementsForPlayer(Request, OnPage, OnComplete);
+ *     }
+ *     ...
+ *     Token->Cancel();
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitCancellationScope
+{
+public:
+    explicit FAwsGameKitCancellationScope(const FAwsGameKitCancellationTokenPtr& Token);
+    ~FAwsGameKitCancellationScope();
+
+    UE_NONCOPYABLE(FAwsGameKitCancellationScope);
+
+    /**
+     * @brief The token of the innermost scope on this thread, null outside any scope.
+     */
+    static FAwsGameKitCancellationTokenPtr GetCurrent();
+
+    /**
+     * @brief Whether the call running on this thread was abandoned. Checked by long running work, between pages for example.
+     */
+    static bool IsCurrentCallAbandoned();
+
+private:
+    FAwsGameKitCancellationTokenPtr Token;
+    FAwsGameKitCancellationToken* Previous;
+};
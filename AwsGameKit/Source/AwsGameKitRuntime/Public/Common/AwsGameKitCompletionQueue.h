@@ -0,0 +1,94 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Queue used to hand GameKit results back to the game thread.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief Multi-producer, single-consumer queue of completions which are run on the game thread.
+ *
+ * @details Worker threads push completions (usually a bound delegate and its result) and a single core ticker callback drains
+ * the queue once per frame, so a burst of results costs one tick instead of one task graph task per result.
+ * Completions run in the order they were pushed. A worker pushes the completions of one call in order, so the order within a call is kept.
+ *
+ * The time spent draining per frame is capped by the GameKit.CompletionQueue.FrameBudgetMs console variable (default 2 ms, 0 means no cap).
+ * At least one completion runs per frame, and whatever is left over stays queued, in order, for the next frame.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitCompletionQueue
+{
+public:
+    /**
+     * @brief Get the process-wide completion queue.
+     */
+    static FAwsGameKitCompletionQueue& Get();
+
+    /**
+     * @brief Register the per-frame drain with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the per-frame drain and drop the completions which haven't run yet.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Queue a completion to run on the game thread. Safe to call from any thread.
+     *
+     * @details If the queue is not running (before startup or after shutdown), the completion is sent to the game thread through the task graph instead so that it is never dropped.
+     */
+    void Enqueue(TUniqueFunction<void()>&& Completion);
+
+    /**
+     * @brief Number of completions waiting to run on the game thread.
+     */
+    int32 GetQueueDepth() const;
+
+private:
+    // Drains the queue directly, see GameKit.Benchmark
+    friend class FAwsGameKitBenchmarks;
+
+    bool Tick(float DeltaTime);
+
+    TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Completions;
+    FThreadSafeCounter QueueDepth;
+    FThreadSafeBool bRunning;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
+
+/**
+ * @brief Makes the result delegates of the GameKit calls started in its lifetime run on the worker thread which finished the call,
+ * instead of going through the completion queue to the game thread.
+ *
+ * @details Used by the awaitable APIs (see AwsGameKitFutures.h), so that a future is fulfilled, and its continuations run, without waiting for
+ * the next game thread tick. The scope is carried over to the work the call runs on the GameKit worker pool. Completions shared with other
+ * callers, such as deduplicated reads, still run on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitWorkerCompletionScope
+{
+public:
+    explicit FAwsGameKitWorkerCompletionScope(bool bEnabled = true);
+    ~FAwsGameKitWorkerCompletionScope();
+
+    UE_NONCOPYABLE(FAwsGameKitWorkerCompletionScope);
+
+    /**
+     * @brief Whether result delegates run on the calling thread, inside a scope which is enabled.
+     */
+    static bool IsActive();
+
+private:
+    bool bPrevious;
+};
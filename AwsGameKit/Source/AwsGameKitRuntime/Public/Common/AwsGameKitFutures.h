@@ -0,0 +1,209 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Adapters which turn the delegate-based GameKit APIs into TFutures.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitCancellation.h"
+#include "Common/AwsGameKitCompletionQueue.h"
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Async/Future.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * @brief Status code and value returned by an awaitable GameKit API.
+ */
+template <typename ValueType>
+struct TAwsGameKitResult
+{
+    IntResult Status;
+    ValueType Value;
+};
+
+/**
+ * @brief Semi-internal promise which is fulfilled with GAMEKIT_ERROR_GENERAL if the GameKit call never called its delegate,
+ * for example because the module was shut down first or the call was cancelled, so that nobody waits on its future forever.
+ * When the call's FAwsGameKitCancellationToken has a deadline, it's fulfilled with GAMEKIT_ERROR_REQUEST_TIMED_OUT on the game thread once the deadline
+ * passes, see ArmDeadline(), even if the GameKit client library is still waiting for the backend. It's fulfilled once, whichever comes first.
+ */
+template <typename ResultType>
+class TAwsGameKitPromise
+{
+public:
+    TAwsGameKitPromise(ResultType&& InBrokenResult)
+        : BrokenResult(MoveTemp(InBrokenResult)), Token(FAwsGameKitCancellationScope::GetCurrent())
+    {}
+
+    ~TAwsGameKitPromise()
+    {
+        if (!bSet)
+        {
+            if (Token.IsValid() && !Token->IsCancelled() && Token->IsDeadlineExceeded())
+            {
+                GetStatus(BrokenResult) = IntResult(GameKit::GAMEKIT_ERROR_REQUEST_TIMED_OUT);
+            }
+            FAwsGameKitWorkerCompletionScope CompletionScope(false);
+            Promise.SetValue(MoveTemp(BrokenResult));
+        }
+    }
+
+    UE_NONCOPYABLE(TAwsGameKitPromise);
+
+    TFuture<ResultType> GetFuture()
+    {
+        return Promise.GetFuture();
+    }
+
+    /**
+     * @brief Fulfil the promise with GAMEKIT_ERROR_REQUEST_TIMED_OUT once the deadline of its token passes, unless it's fulfilled first.
+     */
+    static void ArmDeadline(const TSharedRef<TAwsGameKitPromise, ESPMode::ThreadSafe>& Self)
+    {
+        if (!Self->Token.IsValid())
+        {
+            return;
+        }
+
+        // The timer doesn't keep the promise alive, the call's delegate does
+        TWeakPtr<TAwsGameKitPromise, ESPMode::ThreadSafe> WeakSelf = Self;
+        Self->Token->CallOnDeadline([WeakSelf]
+        {
+            TSharedPtr<TAwsGameKitPromise, ESPMode::ThreadSafe> Pinned = WeakSelf.Pin();
+            if (Pinned.IsValid() && !Pinned->Token->IsCancelled())
+            {
+                ResultType TimedOut = Pinned->BrokenResult;
+                GetStatus(TimedOut) = IntResult(GameKit::GAMEKIT_ERROR_REQUEST_TIMED_OUT);
+                Pinned->SetValue(MoveTemp(TimedOut));
+            }
+        });
+    }
+
+    void SetValue(ResultType&& Result)
+    {
+        if (!bSet.AtomicSet(true))
+        {
+
+            // The continuations run inside SetValue(), on the worker which finished the call. Close the call's scope, so that the delegates of
+            // the GameKit calls they start still run on the game thread; those started through another future open their own scope.
+            FAwsGameKitWorkerCompletionScope CompletionScope(false);
+            Promise.SetValue(MoveTemp(Result));
+        }
+    }
+
+private:
+    static IntResult& GetStatus(IntResult& Result)
+    {
+        return Result;
+    }
+
+    template <typename ValueType>
+    static IntResult& GetStatus(TAwsGameKitResult<ValueType>& Result)
+    {
+        return Result.Status;
+    }
+
+    TPromise<ResultType> Promise;
+    ResultType BrokenResult;
+    FAwsGameKitCancellationTokenPtr Token;
+
+    // Set by the first of the call's delegate and the deadline timer
+    FThreadSafeBool bSet;
+};
+
+/**
+ * @brief Start a GameKit call which reports only a status code, and get a future of that status code.
+ *
+ * @details Call is invoked right away with the delegate to pass to the GameKit API, for example:
+ *
+ *     TFuture<IntResult> Login = MakeAwsGameKitStatusFuture([&](FAwsGameKitStatusDelegateParam Delegate) { AwsGameKitIdentity::Login(Request, Delegate); });
+ *
+ * The future is fulfilled on the GameKit worker thread which finished the call, see FAwsGameKitWorkerCompletionScope, so continuations attached
+ * with TFuture::Next() or TFuture::Then() run there too: they may start the next GameKit call through another future without a hop through the
+ * game thread, but must not touch UObjects. The delegates of GameKit calls started from a continuation with a plain delegate run on the game
+ * thread as usual. Calls which share their result with other callers, such as deduplicated reads, fulfil it on the game thread instead.
+ */
+template <typename CallType>
+TFuture<IntResult> MakeAwsGameKitStatusFuture(CallType&& Call)
+{
+    TSharedRef<TAwsGameKitPromise<IntResult>, ESPMode::ThreadSafe> Promise = MakeShared<TAwsGameKitPromise<IntResult>, ESPMode::ThreadSafe>(IntResult(GameKit::GAMEKIT_ERROR_GENERAL));
+    TFuture<IntResult> Future = Promise->GetFuture();
+    TAwsGameKitPromise<IntResult>::ArmDeadline(Promise);
+
+    FAwsGameKitWorkerCompletionScope CompletionScope;
+    Call(FAwsGameKitStatusDelegate::CreateLambda([Promise](const IntResult& Status)
+    {
+        Promise->SetValue(IntResult(Status));
+    }));
+    return Future;
+}
+
+/**
+ * @brief Start a GameKit call which reports a status code and a value, and get a future of both.
+ *
+ * @details Same as MakeAwsGameKitStatusFuture(), for APIs which take a TAwsGameKitDelegateParam<const IntResult&, const ValueType&>:
+ *
+ *     TFuture<TAwsGameKitResult<FGetUserResponse>> User = MakeAwsGameKitResultFuture<FGetUserResponse>([](const auto& Delegate) { AwsGameKitIdentity::GetUser(Delegate); });
+ */
+template <typename ValueType, typename CallType>
+TFuture<TAwsGameKitResult<ValueType>> MakeAwsGameKitResultFuture(CallType&& Call)
+{
+    typedef TAwsGameKitResult<ValueType> ResultType;
+    TSharedRef<TAwsGameKitPromise<ResultType>, ESPMode::ThreadSafe> Promise = MakeShared<TAwsGameKitPromise<ResultType>, ESPMode::ThreadSafe>(ResultType{ IntResult(GameKit::GAMEKIT_ERROR_GENERAL), ValueType() });
+    TFuture<ResultType> Future = Promise->GetFuture();
+    TAwsGameKitPromise<ResultType>::ArmDeadline(Promise);
+
+    FAwsGameKitWorkerCompletionScope CompletionScope;
+    Call(TAwsGameKitDelegate<const IntResult&, const ValueType&>::CreateLambda([Promise](const IntResult& Status, const ValueType& Value)
+    {
+        Promise->SetValue(ResultType{ Status, Value });
+    }));
+    return Future;
+}
+
+/**
+ * @brief Wait for several futures at once, for example independent GameKit calls started together.
+ *
+ * @return A future of the results, in the order of Futures. It is fulfilled on the thread which fulfilled the last of Futures.
+ */
+template <typename ResultType>
+TFuture<TArray<ResultType>> AwsGameKitWhenAll(TArray<TFuture<ResultType>>&& Futures)
+{
+    struct FState
+    {
+        TPromise<TArray<ResultType>> Promise;
+        TArray<ResultType> Results;
+        FThreadSafeCounter Remaining;
+    };
+
+    TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+    TFuture<TArray<ResultType>> Future = State->Promise.GetFuture();
+    if (Futures.Num() == 0)
+    {
+        State->Promise.SetValue(TArray<ResultType>());
+        return Future;
+    }
+
+    State->Results.SetNum(Futures.Num());
+    State->Remaining.Set(Futures.Num());
+    for (int32 Index = 0; Index < Futures.Num(); ++Index)
+    {
+        Futures[Index].Then([State, Index](TFuture<ResultType> Done)
+        {
+            State->Results[Index] = Done.Get();
+            if (State->Remaining.Decrement() == 0)
+            {
+                State->Promise.SetValue(MoveTemp(State->Results));
+            }
+        });
+    }
+    return Future;
+}
@@ -0,0 +1,109 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Per-operation latency histograms of the GameKit calls.
+ */
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitCommonModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/NameTypes.h"
+
+// Standard library
+#include <atomic>
+
+/**
+ * @brief Records the client-observed latency of every GameKit operation into a histogram per operation and network type.
+ *
+ * @details Two kinds of operation are recorded:
+ * - GameKit C API calls which reach the backend, named after the C function (for example GameKitSaveSlot), timed around the call in the feature wrappers.
+ * - Blueprint latent actions, named Feature.Operation (for example GameSaving.SaveSlot), timed from the node being called until its outputs are set on the game thread.
+ *
+ * The histograms are HDR style: 16 linear sub-buckets per power of two of microseconds, so every recorded value is kept within about 6%
+ * from 1 microsecond up to about 2 minutes, in a fixed 1.5 KB per histogram. Longer calls are counted in the last bucket.
+ * Samples are split by the network connection type (see FPlatformMisc::GetNetworkConnectionType()) when they were recorded.
+ *
+ * GetSnapshot() reports the count, mean, p50, p90, p99 and max of every histogram, and can reset them. UAwsGameKitLatencyUtils exposes it to Blueprints.
+ *
+ * When GameKit.Latency.UploadUrl is set, a snapshot is taken and reset every GameKit.Latency.UploadIntervalSeconds (default 300) and POSTed to it as JSON,
+ * with the non-empty buckets so that the backend can merge the histograms of many clients. A failed upload is logged and its samples are dropped.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitLatencyHistograms
+{
+public:
+    /**
+     * @brief Get the process-wide latency histograms.
+     */
+    static FAwsGameKitLatencyHistograms& Get();
+
+    /**
+     * @brief Register the network type refresh and the periodic upload with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the ticker. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Record one call of Operation which took Seconds.
+     */
+    void Record(const FName& Operation, double Seconds);
+
+    /**
+     * @brief Summarize every histogram which has samples.
+     *
+     * @param bReset Also clear the histograms, so that the next snapshot only covers the calls made after this one.
+     */
+    TArray<FAwsGameKitLatencySnapshot> GetSnapshot(bool bReset);
+
+    /**
+     * @brief Clear every histogram.
+     */
+    void Reset();
+
+private:
+    static constexpr int32 SUB_BUCKET_BITS = 4;
+    static constexpr int32 SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int32 MAX_MAGNITUDE = 27;
+    static constexpr int32 NUM_BUCKETS = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    struct FHistogram
+    {
+        uint32 Buckets[NUM_BUCKETS] = {};
+        int64 Count = 0;
+        double TotalMicroseconds = 0.0;
+        uint64 MaxMicroseconds = 0;
+    };
+
+    typedef TPair<FName, uint8> FHistogramKey;
+
+    static int32 GetBucketIndex(uint64 Microseconds);
+    static uint64 GetBucketLowerBound(int32 Index);
+    static uint64 GetBucketUpperBound(int32 Index);
+    static float GetPercentileMs(const FHistogram& Histogram, double Percentile);
+
+    bool Tick(float DeltaTime);
+    void Upload();
+
+    FCriticalSection Mutex;
+    TMap<FHistogramKey, TUniquePtr<FHistogram>> Histograms;
+    FTSTicker::FDelegateHandle TickerHandle;
+    double NextUploadTime = 0.0;
+    double LastUploadTime = 0.0;
+    std::atomic<bool> bUploading{ false };
+
+    // ENetworkConnectionType, refreshed by Tick() since querying it can be slow on mobile
+    std::atomic<uint8> NetworkType{ 0 };
+};
@@ -0,0 +1,91 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Flushes the queued GameKit writes when the app is suspended or exits.
+ */
+
+#pragma once
+
+// Unreal
+#include "Delegates/IDelegateInstance.h"
+
+// Standard library
+#include <atomic>
+
+/**
+ * @brief Flushes the buffered and queued writes within the time the platform allows when the app is suspended, and bounds the time the
+ * runtime module spends sending them when it shuts down.
+ *
+ * @details Listens to the application lifecycle delegates of FCoreDelegates, which mobile platforms call when the app changes state:
+ * - ApplicationWillDeactivateDelegate: the journals of FAwsGameKitOfflineWriteQueue and FAwsGameKitUserGameplayDataWriteBehind are synced to disk,
+ *   so that a process killed while inactive doesn't lose the writes appended since their last periodic sync.
+ * - ApplicationWillEnterBackgroundDelegate: the background transfers of FAwsGameKitGameSavingTransferScheduler are paused, and the pending writes
+ *   are flushed, see Flush(), for at most GameKit.Lifecycle.BackgroundFlushBudgetMs (default 3000). Keep it under the time the OS lets a suspending
+ *   app run, about five seconds on iOS.
+ * - ApplicationHasEnteredForegroundDelegate: the transfers are resumed.
+ * - ApplicationWillTerminateDelegate: same as entering the background.
+ *
+ * When the runtime module shuts down, FAwsGameKitRuntimeModule::ShutdownModule() calls Drain() first, which flushes the pending writes for at most
+ * GameKit.Lifecycle.ShutdownDrainBudgetMs (default 2000). If they aren't sent by then, HasShutdownDeadlinePassed() is true and the components
+ * don't send what's left on the game thread: the merged achievement increments are moved to the offline write queue, which journals them when
+ * it's enabled; the waiting save slot uploads are dropped, the slots keep their local files and report SHOULD_UPLOAD_LOCAL in the next session;
+ * the buffered bundle items which aren't journaled are dropped.
+ *
+ * The GameKit calls which are already in flight can't be interrupted, so the worker pool still waits for them before the libraries are released.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitLifecycle
+{
+public:
+    /**
+     * @brief Get the process-wide lifecycle handler.
+     */
+    static FAwsGameKitLifecycle& Get();
+
+    /**
+     * @brief Bind the application lifecycle delegates. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unbind the application lifecycle delegates. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Sync the write journals to disk, then send the merged achievement increments, the buffered bundle items and the queued offline
+     * writes in parallel on the interactive lane of the worker pool, and wait for them for at most BudgetSeconds.
+     *
+     * @details The User Gameplay Data retry queue is persisted on the game thread once the sends completed or the budget is spent, to the cache
+     * file the game last passed to AwsGameKitUserGameplayData::PersistToCache() or LoadFromCache(), so that the writes enqueued while offline
+     * survive the process being killed. Called on the game thread.
+     *
+     * @return True if everything was sent or enqueued within the budget.
+     */
+    bool Flush(double BudgetSeconds);
+
+    /**
+     * @brief Flush() for at most GameKit.Lifecycle.ShutdownDrainBudgetMs. Called first by FAwsGameKitRuntimeModule::ShutdownModule().
+     */
+    void Drain();
+
+    /**
+     * @brief Whether Drain() ran out of time, in which case the components shut down without sending the writes still pending.
+     */
+    static bool HasShutdownDeadlinePassed();
+
+private:
+    void OnWillDeactivate();
+    void OnWillEnterBackground();
+    void OnHasEnteredForeground();
+
+    // Sync the journals to disk on the calling thread
+    void Checkpoint();
+
+    FDelegateHandle WillDeactivateHandle;
+    FDelegateHandle WillEnterBackgroundHandle;
+    FDelegateHandle HasEnteredForegroundHandle;
+    FDelegateHandle WillTerminateHandle;
+    bool bIsInBackground = false;
+    std::atomic<bool> bShutdownDeadlinePassed{ false };
+};
@@ -0,0 +1,54 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Unreal
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "AwsGameKitLoadTestCommandlet.generated.h" // Last include (Unreal requirement)
+
+/**
+ * @brief Generates load against a deployed GameKit backend from simulated players, and reports the throughput, error rates and latency percentiles.
+ *
+ * @details Every simulated player has its own session manager, Identity, Achievements, Game Saving and User Gameplay Data instances, created from the
+ * libraries loaded by FAwsGameKitRuntimeModule, so that token handling, pagination and save slot compression behave as they do in a game client.
+ * The players log in first, then a scripted mix of operations is run against random players at a fixed target rate until the duration is over.
+ * A player only runs one operation at a time.
+ *
+ * Add -GameKitMockBackend to run against the in-memory backend of FAwsGameKitMockBackend instead, with no deployed stack or config file,
+ * to measure the plugin and the harness themselves. Any user name and non-empty password log in.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe MyGame.uproject -run=AwsGameKitLoadTest -Players=100 -Password=... [options]
+ *
+ * Options:
+ *   -Players=N          Number of simulated players (default 10).
+ *   -UserPrefix=Name    The players log in as <UserPrefix><Index>, for Index from 0 to Players - 1 (default gamekit_load_). The users must already be registered and confirmed.
+ *   -Password=Password  Password of every simulated user.
+ *   -ClientConfig=Path  The awsGameKitClientConfig.yml of the stack under test (default the first one found under the project directory).
+ *   -Rate=N             Target operations per second across all players (default 10).
+ *   -Duration=Seconds   How long to run the mix for, after every player has logged in (default 60).
+ *   -Concurrency=N      Threads making calls, which bounds the operations in flight (default 64).
+ *   -Mix=Op:Weight,...  Relative weights of Login, ListAchievements, UpdateItem and SaveSlot (default Login:1,ListAchievements:4,UpdateItem:4,SaveSlot:1).
+ *   -Burst=N            UpdateBundleItem calls made back to back by each UpdateItem operation (default 10).
+ *   -SaveSlotKB=N       Size of the save slot uploaded by each SaveSlot operation (default 64).
+ *   -RetryQueue         Start the User Gameplay Data retry thread of every player, as a game does. This costs one thread per player.
+ *
+ * Operation latencies are measured from when the operation was due, so a harness which can't keep up with -Rate shows as latency rather than as fewer calls.
+ * They are recorded in FAwsGameKitLatencyHistograms as LoadTest.<Op>, next to the latencies of the GameKit C API calls made by the wrappers,
+ * and the report is logged and written as JSON to Saved/Profiling/GameKitLoadTest/.
+ *
+ * @return 0 when the mix was run, 1 when no player could log in.
+ */
+UCLASS()
+class AWSGAMEKITRUNTIME_API UAwsGameKitLoadTestCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAwsGameKitLoadTestCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,91 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief An in-process backend for the GameKit features, for performance and stress testing without an AWS account.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+
+// Standard library
+#include <atomic>
+
+// Unreal
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Simulates the GameKit backend in memory: latency, injected errors and a throughput limit, shared by the mock feature wrappers.
+ *
+ * @details Start the game with -GameKitMockBackend to run the Identity, Achievements, User Gameplay Data and Game Saving features against
+ * in-memory wrappers (see AwsGameKitMockWrappers.h) instead of the GameKit libraries, or install MakeWrapperFactories() yourself with
+ * FAwsGameKitRuntimeModule::SetWrapperFactories(). No config file, deployed stack or network is needed, so the plugin's threading, caching and
+ * dispatch layers and the game's integration can be driven at thousands of calls per second, for example by the GameKit load test commandlet.
+ *
+ * Each feature instance keeps its own state, so each simulated player of a load test has its own achievements, bundles and slots:
+ * - Identity: any non-empty user name and password log in. GetUser answers for the logged in user.
+ * - Achievements: GameKit.MockBackend.Achievements achievements named achievement_0, achievement_1, ..., with a max value of 1 to 10.
+ * - User Gameplay Data: bundles and items are kept as given.
+ * - Game Saving: slots keep their data and metadata, and are always in sync. Local slot files are ignored.
+ *
+ * Every call which would reach the backend first sleeps GameKit.MockBackend.LatencyMs, plus or minus up to GameKit.MockBackend.LatencyJitterMs.
+ * It then fails with GameKit.MockBackend.ErrorCode with probability GameKit.MockBackend.ErrorRate (only the APIs whose name contains
+ * GameKit.MockBackend.ErrorApis, when set). Beyond GameKit.MockBackend.MaxCallsPerSecond, calls fail with GAMEKIT_ERROR_HTTP_REQUEST_FAILED as if throttled.
+ * The console variables can be changed while the game runs.
+ *
+ * The mock wrappers count their calls in FAwsGameKitStats and FAwsGameKitLatencyHistograms like the real wrappers. Session tokens aren't set.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitMockBackend
+{
+public:
+    /**
+     * @brief Get the process-wide mock backend.
+     */
+    static FAwsGameKitMockBackend& Get();
+
+    /**
+     * @brief Read -GameKitMockBackend from the command line. Called by FAwsGameKitRuntimeModule::StartupModule() before any library is loaded.
+     */
+    void Startup();
+
+    /**
+     * @brief Log the call counts. Called by FAwsGameKitRuntimeModule::ShutdownModule().
+     */
+    void Shutdown();
+
+    /**
+     * @brief Whether the game was started with -GameKitMockBackend.
+     */
+    bool IsEnabled() const
+    {
+        return bEnabled;
+    }
+
+    /**
+     * @brief The factories of the mock wrappers of all four features, for FAwsGameKitRuntimeModule::SetWrapperFactories().
+     */
+    static FAwsGameKitWrapperFactories MakeWrapperFactories();
+
+    /**
+     * @brief Simulate a backend call of Api: apply the latency, the throughput limit and the error injection. Called by the mock wrappers.
+     *
+     * @return GAMEKIT_SUCCESS if the mock wrapper should go on with the call, else the status it should fail with.
+     */
+    unsigned int SimulateCall(const TCHAR* Api);
+
+private:
+    bool bEnabled = false;
+
+    // Token bucket of GameKit.MockBackend.MaxCallsPerSecond, holding up to a second of calls
+    FCriticalSection ThrottleMutex;
+    double ThrottleTokens = 0.0;
+    double ThrottleRefillTime = 0.0;
+
+    std::atomic<int64> Calls{ 0 };
+    std::atomic<int64> ThrottledCalls{ 0 };
+    std::atomic<int64> InjectedErrors{ 0 };
+};
@@ -0,0 +1,112 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Network class of the device, and the transfer policies applied on metered links.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Ticker.h"
+#include "Delegates/Delegate.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Kind of link the device is connected through.
+ */
+enum class EAwsGameKitNetworkClass : uint8
+{
+    // Not reported by the platform, treated as unmetered
+    Unknown,
+
+    // Wi-Fi, Ethernet
+    Unmetered,
+
+    // Cellular
+    Metered,
+
+    // Cellular while roaming. Only known when the game reports it with SetOverride().
+    Roaming
+};
+
+/**
+ * @brief Tracks the network class and defers the large transfers nobody waits on while the device is on a metered link.
+ *
+ * @details Disabled by default. Set the GameKit.Network.MeteredPolicy console variable to enable it:
+ * - 0: the network class is ignored.
+ * - 1: on a metered link, background transfers of at least GameKit.Network.MeteredLargeTransferBytes (default 1 MB) are deferred until the
+ *   device is back on an unmetered link. While roaming, every background transfer is deferred.
+ * - 2: every background transfer is deferred on a metered link.
+ *
+ * While deferred:
+ * - FAwsGameKitGameSavingTransferScheduler holds the Background transfers; Foreground ones still start.
+ * - FAwsGameKitGameSavingLoginPrefetcher doesn't download slots after login.
+ * - FAwsGameKitAchievementIconAtlas serves cached icons without revalidating them; icons which aren't cached are still downloaded.
+ * - FAwsGameKitOfflineWriteQueue sends one queued write at a time.
+ *
+ * Small interactive calls, such as Login or UpdateAchievementForPlayer(), are never deferred.
+ *
+ * The network class is read from FPlatformMisc::GetNetworkConnectionType() every few seconds. Platforms don't report roaming to the engine,
+ * so call SetOverride() from the game's platform code when it knows more, or set GameKit.Network.Class to test a class on desktop.
+ * This is independent of the online/offline status the User Gameplay Data client reports, see AwsGameKitUserGameplayData::SetNetworkChangeDelegate().
+ *
+ * All methods are thread safe, except Startup() and Shutdown() which are called on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitNetworkPolicy
+{
+public:
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnNetworkClassChanged, EAwsGameKitNetworkClass /* NetworkClass */);
+
+    /**
+     * @brief Get the process-wide network policy.
+     */
+    static FAwsGameKitNetworkPolicy& Get();
+
+    /**
+     * @brief Read the network class and register the polling timer with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the polling timer. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Current network class.
+     */
+    EAwsGameKitNetworkClass GetNetworkClass() const;
+
+    /**
+     * @brief Report the network class instead of reading it from the platform, for example roaming. Unknown goes back to the platform's class.
+     */
+    void SetOverride(EAwsGameKitNetworkClass NetworkClass);
+
+    /**
+     * @brief Whether the device is on a metered link and GameKit.Network.MeteredPolicy isn't 0.
+     */
+    bool IsMetered() const;
+
+    /**
+     * @brief Whether a background transfer of this size should wait for an unmetered link.
+     *
+     * @param Bytes Size of the transfer, or a negative value when it isn't known, which is treated as large.
+     */
+    bool ShouldDeferTransfer(int64 Bytes) const;
+
+    /**
+     * @brief Called on the game thread when the network class changes.
+     */
+    FOnNetworkClassChanged OnNetworkClassChanged;
+
+private:
+    bool Tick(float DeltaTime);
+    void Refresh();
+
+    mutable FCriticalSection Mutex;
+    EAwsGameKitNetworkClass PlatformClass = EAwsGameKitNetworkClass::Unknown;
+    EAwsGameKitNetworkClass OverrideClass = EAwsGameKitNetworkClass::Unknown;
+    EAwsGameKitNetworkClass LastReportedClass = EAwsGameKitNetworkClass::Unknown;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
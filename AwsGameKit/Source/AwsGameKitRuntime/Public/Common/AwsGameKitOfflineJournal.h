@@ -0,0 +1,159 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Append-only journal of the writes which are waiting to be sent to the backend.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+class IFileHandle;
+
+/**
+ * @brief Write-ahead journal which makes buffered or queued writes survive a crash.
+ *
+ * @details Every write is appended to the journal file as one small (player, group, key, value) record. A record is completed by a tombstone once
+ * its write succeeded, failed, or was superseded; a later write of the same player, group and key replaces the pending one. The player id is the
+ * one of the player the write was made for, so that a write is never replayed for another player; it is empty when the player isn't known.
+ * The file is rewritten with only the records which aren't completed once tombstones make up most of it. Syncing and compacting happen on the
+ * worker pool from Tick(), and neither holds the journal's lock while it waits on the disk: records appended during a compaction are copied
+ * to the new file before it replaces the journal.
+ *
+ * Used by FAwsGameKitUserGameplayDataJournal, with bundle names as groups and bundle item keys as keys, and by FAwsGameKitOfflineWriteQueue,
+ * with feature names as groups. Both use the same file format.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitOfflineJournal
+{
+public:
+    struct FEntry
+    {
+        FString PlayerId;
+        FString Group;
+        FString Key;
+        FString Value;
+        int64 Sequence = 0;
+    };
+
+    virtual ~FAwsGameKitOfflineJournal();
+
+    /**
+     * @brief Read the records left by the previous session and open the journal for appending.
+     *
+     * @details The file is rewritten with only the records which aren't completed, which also drops a record torn by a crash.
+     *
+     * @param InFilePath Path of the journal file, created if it doesn't exist.
+     */
+    void Open(const FString& InFilePath);
+
+    /**
+     * @brief Sync and close the journal. The records which aren't completed are kept for the next session.
+     */
+    void Close();
+
+    bool IsOpen() const;
+
+    /**
+     * @brief Sync the appended records to disk on the calling thread, for example before the app is suspended.
+     */
+    void Checkpoint();
+
+    /**
+     * @brief Append a write made for a player.
+     *
+     * @return The sequence number of the record, to pass to Complete(), or 0 if the journal isn't open.
+     */
+    int64 Append(const FString& Group, const FString& Key, const FString& Value, const FString& PlayerId = FString());
+
+    /**
+     * @brief Append tombstones for the given writes of a player.
+     *
+     * @param Sequences Key to the sequence number returned by Append(). Older records of the same keys are completed too.
+     */
+    void Complete(const FString& Group, const TMap<FString, int64>& Sequences, const FString& PlayerId = FString());
+
+    /**
+     * @brief Complete every record of a player's group, or only of the given keys when Keys isn't empty.
+     */
+    void Discard(const FString& Group, const TArray<FString>& Keys, const FString& PlayerId = FString());
+
+    /**
+     * @brief The sequence number of the latest record appended, 0 if none. Pass it to Reset().
+     */
+    int64 GetLastSequence() const;
+
+    /**
+     * @brief Complete every record up to a sequence number, for example the one returned by GetLastSequence() when the owner dropped its writes.
+     * The records appended after it stay pending.
+     */
+    void Reset(int64 UpToSequence);
+
+    /**
+     * @brief Get the latest write of every key which isn't completed, in the order they were appended.
+     */
+    TArray<FEntry> GetPendingEntries() const;
+
+    /**
+     * @brief Sync or compact the journal on the worker pool when due. Call it periodically from the owner's timer.
+     *
+     * @param SyncIntervalSeconds Maximum time an appended record waits before the journal is synced to disk.
+     */
+    void Tick(double SyncIntervalSeconds);
+
+private:
+    struct FPendingValue
+    {
+        FString Value;
+        int64 Sequence;
+    };
+
+    struct FGroupKey
+    {
+        FString PlayerId;
+        FString Group;
+
+        bool operator==(const FGroupKey& Other) const
+        {
+            return PlayerId == Other.PlayerId && Group == Other.Group;
+        }
+
+        friend uint32 GetTypeHash(const FGroupKey& GroupKey)
+        {
+            return HashCombine(GetTypeHash(GroupKey.PlayerId), GetTypeHash(GroupKey.Group));
+        }
+    };
+
+    void ApplyPut(const FGroupKey& GroupKey, const FString& Key, const FString& Value, int64 Sequence);
+    void ApplyTombstone(const FGroupKey& GroupKey, const FString& Key, int64 Sequence);
+    void AppendTombstone(const FGroupKey& GroupKey, const FString& Key, int64 Sequence);
+    void Write(const TArray<uint8>& Record);
+    void Compact();
+    void Sync();
+
+    mutable FCriticalSection Mutex;
+
+    // Shared with Sync(), which flushes it outside the lock while records are appended
+    TSharedPtr<IFileHandle, ESPMode::ThreadSafe> FileHandle;
+    FString FilePath;
+    bool bIsOpen = false;
+
+    // Set while Compact() writes the new file; the records appended meanwhile are kept in CompactTail and copied to it
+    bool bCompacting = false;
+    TArray<uint8> CompactTail;
+    int32 CompactTailCount = 0;
+
+    // Player and group to key to the latest write which isn't completed
+    TMap<FGroupKey, TMap<FString, FPendingValue>> Pending;
+    int32 PendingCount = 0;
+    int32 RecordCount = 0;
+    int64 NextSequence = 1;
+    bool bUnsynced = false;
+    double LastSyncTime = 0.0;
+    bool bWorkInFlight = false;
+};
@@ -0,0 +1,211 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in durable queue of the writes which failed while the game was offline.
+ */
+
+#pragma once
+
+// GameKit
+#include "Common/AwsGameKitOfflineJournal.h"
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief How a queued write is combined with a later write of the same key.
+ */
+enum class EAwsGameKitOfflineWriteMerge : uint8
+{
+    // The later value replaces the queued one
+    Replace,
+
+    // The values are integers, the later one is added to the queued one
+    Add
+};
+
+/**
+ * @brief Keeps the writes which failed because the backend couldn't be reached, and sends them once it can be reached again.
+ *
+ * @details Disabled by default. Set the GameKit.OfflineQueue.Enabled console variable to 1 to enable it.
+ *
+ * User Gameplay Data has its own retry queue in the GameKit client library. This queue covers the other write features: a feature registers
+ * how its writes are merged and sent with RegisterFeature(), and calls Enqueue() when a write fails with an offline status (see IsOfflineResult()).
+ * Achievements registers its increments, see AwsGameKitAchievements::UpdateAchievementForPlayer().
+ *
+ * Queued writes are merged per player, feature and key, so that a player who stays offline for a long time still only sends one write per key.
+ * Every queued write is appended to OfflineWriteQueue.bin in the GameKit save directory, an FAwsGameKitOfflineJournal in the same format as
+ * FAwsGameKitUserGameplayDataJournal, so that the queue survives a crash or a restart.
+ *
+ * Each write belongs to the player it was made for, identified by the user id of AwsGameKitIdentity::GetUser(), and is only sent while that
+ * player is logged in. The id of the logged in player is looked up through FAwsGameKitIdentityUserCache on the worker pool whenever writes are
+ * queued and the player may have changed; writes made before it is known, for example offline after the session was restored from
+ * FAwsGameKitSessionCache, are given to the player once it is. Writes of a previous session whose player wasn't known are dropped. A write which
+ * fails with GAMEKIT_ERROR_NO_ID_TOKEN stays queued, and draining waits until a player is logged in again. A write is sent at least once: it is sent again after
+ * a crash which happened while it was in flight. The backend's UpdateAchievements, AddBundle, UpdateBundleItem and IncrementBundleItem functions apply a write once
+ * per Idempotency-Key header, replaying the first response to its retries, but the prebuilt client library doesn't send the header yet:
+ * until it does, an increment resent after a crash is applied twice.
+ *
+ * The queue is drained by the core ticker, with at most GameKit.OfflineQueue.MaxInFlight writes in flight, or one on a metered link (see FAwsGameKitNetworkPolicy). While writes keep failing with
+ * an offline status, draining is retried after a jittered delay which grows from GameKit.OfflineQueue.RetryIntervalSeconds up to
+ * five minutes. It is drained right away when the GameKit client reports that the network is back, see OnNetworkStatusChange().
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitOfflineWriteQueue
+{
+public:
+    /**
+     * @brief Sends one queued write on the calling thread and returns the GameKit status code.
+     */
+    typedef TFunction<IntResult(const FString& Key, const FString& Value)> FSendFunction;
+
+    /**
+     * @brief Get the process-wide offline write queue.
+     */
+    static FAwsGameKitOfflineWriteQueue& Get();
+
+    /**
+     * @brief Whether the queue is enabled (GameKit.OfflineQueue.Enabled).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Whether a write failed because the backend couldn't be reached, and can be queued.
+     *
+     * @details Writes made while nobody is logged in fail with GAMEKIT_ERROR_NO_ID_TOKEN and aren't queued, since they would be credited to the next player to log in.
+     */
+    static bool IsOfflineResult(const IntResult& Result);
+
+    /**
+     * @brief Load the writes queued by a previous session and register the drain timer with the core ticker.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::StartupModule() when the queue is enabled.
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the drain timer and close the journal. The queued writes are kept for the next session.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Register how the writes of a feature are merged and sent. Queued writes of a feature which isn't registered aren't sent.
+     */
+    void RegisterFeature(const FString& Feature, EAwsGameKitOfflineWriteMerge Merge, FSendFunction&& Send);
+
+    /**
+     * @brief Queue a write, merged with the queued write of the same key.
+     *
+     * @return False if the queue isn't enabled and started, or if the feature isn't registered. The write must be failed by the caller then.
+     */
+    bool Enqueue(const FString& Feature, const FString& Key, const FString& Value);
+
+    /**
+     * @brief Drain the queue right away when the connection is back. Called by FAwsGameKitRuntimeModule::OnNetworkStatusChange().
+     */
+    void OnNetworkStatusChange(bool bIsConnectionOk);
+
+    /**
+     * @brief Try to send every queued write once, on the calling thread. Writes which fail with an offline status stay queued.
+     */
+    void FlushAll();
+
+    /**
+     * @brief Drop every queued write, of every player, for example when the player logs out. Call FlushAll() first to send them while the player is logged in.
+     */
+    void DiscardAll();
+
+    /**
+     * @brief Number of queued writes, including the ones in flight.
+     */
+    int32 Num() const;
+
+    /**
+     * @brief Sync the journal of the queued writes to disk on the calling thread. See FAwsGameKitLifecycle.
+     */
+    void Checkpoint();
+
+private:
+    struct FFeature
+    {
+        EAwsGameKitOfflineWriteMerge Merge = EAwsGameKitOfflineWriteMerge::Replace;
+        FSendFunction Send;
+    };
+
+    struct FQueuedWrite
+    {
+        FString Value;
+
+        // Incremented by every merged write, to tell whether the write changed while it was in flight
+        int64 Version = 0;
+        bool bInFlight = false;
+        FString SentValue;
+        int64 SentVersion = 0;
+    };
+
+    struct FReadyWrite
+    {
+        FString PlayerId;
+        FString Feature;
+        FString Key;
+        FString Value;
+        FSendFunction Send;
+    };
+
+    // A journal record to append, or to complete when bComplete is set. See WriteJournal().
+    struct FJournalOp
+    {
+        FString PlayerId;
+        FString Feature;
+        FString Key;
+        FString Value;
+        bool bComplete = false;
+    };
+
+    typedef TMap<FString, TMap<FString, FQueuedWrite>> FPlayerWrites;
+
+    bool Tick(float DeltaTime);
+
+    // Forgets the logged in player's id when FAwsGameKitIdentityUserCache says the player may have changed since it was looked up
+    void CheckPlayer(uint32 Generation);
+
+    // Looks up the logged in player's id on the calling thread, and gives it the writes queued while it wasn't known
+    void ResolvePlayer(uint32 Generation);
+    TArray<FReadyWrite> TakeReady(int32 MaxInFlight);
+    void OnSent(const FReadyWrite& Sent, const IntResult& Result);
+    void Merge(const FString& Owner, const FString& Feature, EAwsGameKitOfflineWriteMerge MergeMode, const FString& Key, const FString& Value);
+    void ScheduleRetry();
+
+    // Applies the queued journal operations in the order they were queued, outside Mutex so that no write waits for the disk
+    void WriteJournal();
+
+    mutable FCriticalSection Mutex;
+    TMap<FString, FFeature> Features;
+
+    // Player id to feature to key to the queued write. Writes made before the logged in player's id is known have an empty player id.
+    TMap<FString, FPlayerWrites> Queued;
+
+    // Id of the logged in player, empty until it's known, and the FAwsGameKitIdentityUserCache generation it was looked up with
+    FString PlayerId;
+    uint32 PlayerGeneration = 0;
+    bool bIsResolvingPlayer = false;
+
+    TArray<FJournalOp> JournalOps;
+
+    // Held while the journal is written, taken before Mutex
+    FCriticalSection JournalMutex;
+    FAwsGameKitOfflineJournal Journal;
+
+    int32 NumInFlight = 0;
+    double NextDrainTime = 0.0;
+    double RetryDelaySeconds = 0.0;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
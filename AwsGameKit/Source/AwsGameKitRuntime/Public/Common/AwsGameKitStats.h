@@ -0,0 +1,165 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief AwsGameKit stat group and CSV profiler category.
+ */
+
+#pragma once
+
+// GameKit
+#include "Common/AwsGameKitLatencyHistograms.h"
+#include "Common/AwsGameKitWorkerPool.h"
+
+// Unreal
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AwsGameKit"), STATGROUP_AwsGameKit, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In-Flight Achievements Requests"), STAT_AwsGameKit_InFlightAchievements, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In-Flight Game Saving Requests"), STAT_AwsGameKit_InFlightGameSaving, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In-Flight Identity Requests"), STAT_AwsGameKit_InFlightIdentity, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("In-Flight User Gameplay Data Requests"), STAT_AwsGameKit_InFlightUserGameplayData, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Worker Pool Queue Depth"), STAT_AwsGameKit_WorkerPoolQueueDepth, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Worker Pool Wait ms (Interactive)"), STAT_AwsGameKit_WorkerPoolWaitInteractive, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Worker Pool Wait ms (Normal)"), STAT_AwsGameKit_WorkerPoolWaitNormal, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Worker Pool Wait ms (Background)"), STAT_AwsGameKit_WorkerPoolWaitBackground, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("User Gameplay Data Retry Queue Size"), STAT_AwsGameKit_RetryQueueSize, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Delegates Dispatched"), STAT_AwsGameKit_DelegatesDispatched, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Game Thread Callbacks"), STAT_AwsGameKit_GameThreadCallbacks, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Bytes Uploaded"), STAT_AwsGameKit_BytesUploaded, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Bytes Downloaded"), STAT_AwsGameKit_BytesDownloaded, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Cache Bytes"), STAT_AwsGameKit_CacheBytes, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Achievements Cache Hit Rate %"), STAT_AwsGameKit_AchievementsCacheHitRate, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Identity User Cache Hit Rate %"), STAT_AwsGameKit_IdentityUserCacheHitRate, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("User Gameplay Data Cache Hit Rate %"), STAT_AwsGameKit_UserGameplayDataCacheHitRate, STATGROUP_AwsGameKit, AWSGAMEKITRUNTIME_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(AWSGAMEKITRUNTIME_API, AwsGameKit);
+
+/**
+ * @brief The features whose backend requests are counted.
+ */
+enum class EAwsGameKitStatsFeature : uint8
+{
+    Achievements,
+    GameSaving,
+    Identity,
+    UserGameplayData,
+    Num
+};
+
+/**
+ * @brief The caches whose hit rates are counted.
+ */
+enum class EAwsGameKitStatsCache : uint8
+{
+    // FAwsGameKitAchievementsCache
+    Achievements,
+
+    // FAwsGameKitIdentityUserCache
+    IdentityUser,
+
+    // FAwsGameKitUserGameplayDataCache
+    UserGameplayData,
+    Num
+};
+
+/**
+ * @brief Publishes the GameKit costs to the AwsGameKit stat group and the AwsGameKit CSV profiler category.
+ *
+ * @details Use "stat AwsGameKit" to show the counters in game, and "csvprofile start" (or -csvCaptureFrames) to capture them per frame.
+ * The stat group has:
+ * - In-flight requests per feature: GameKit C API calls which are waiting on the backend.
+ * - Worker pool queue depth: work queued on FAwsGameKitWorkerPool which no worker has picked up yet.
+ * - Worker pool wait per lane: how long the last work of each EAwsGameKitWorkLane waited before a worker picked it up.
+ * - Delegates dispatched: result delegates and latent action outputs run on the game thread this frame.
+ * - Game thread callbacks: time spent running them.
+ * - Bytes uploaded and downloaded: save slot payloads and User Gameplay Data bundles, after compression.
+ * - Retry queue size: User Gameplay Data calls waiting in the offline retry queue, see FUserGameplayDataRetryQueueStats.
+ * - Cache hit rates: lookups answered from the achievements, player profile and User Gameplay Data caches, since the game started.
+ * - Cache bytes: memory held by the caches under FAwsGameKitCacheBudget.
+ *
+ * The CSV category has the same values, sampled once per frame on the game thread. Bytes, hits and misses are per frame there,
+ * and the worker pool waits are the longest of the frame.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitStats
+{
+public:
+    /**
+     * @brief A backend request of the feature has started. Prefer FAwsGameKitStatsRequestScope.
+     */
+    static void RequestStarted(EAwsGameKitStatsFeature Feature);
+
+    /**
+     * @brief A backend request of the feature has finished.
+     */
+    static void RequestFinished(EAwsGameKitStatsFeature Feature);
+
+    /**
+     * @brief Count bytes sent to the backend.
+     */
+    static void AddBytesUploaded(int64 Bytes);
+
+    /**
+     * @brief Count bytes received from the backend.
+     */
+    static void AddBytesDownloaded(int64 Bytes);
+
+    /**
+     * @brief Count the time work of a lane waited on FAwsGameKitWorkerPool before it started.
+     */
+    static void RecordWorkerPoolWait(EAwsGameKitWorkLane Lane, double Seconds);
+
+    /**
+     * @brief Set the number of calls in the User Gameplay Data offline retry queue.
+     */
+    static void SetRetryQueueSize(int32 QueuedCalls);
+
+    /**
+     * @brief Set the memory held by the caches under FAwsGameKitCacheBudget.
+     */
+    static void SetCacheBytes(int64 Bytes);
+
+    /**
+     * @brief Count a cache lookup, and whether it was answered from the cache.
+     */
+    static void RecordCacheLookup(EAwsGameKitStatsCache Cache, bool bHit);
+
+    /**
+     * @brief Count delegates run on the game thread.
+     */
+    static void RecordDelegatesDispatched(int32 Count);
+
+    /**
+     * @brief Write this frame's values to the CSV profiler. Called once per frame on the game thread by FAwsGameKitCompletionQueue.
+     */
+    static void RecordFrame();
+};
+
+/**
+ * @brief Counts a backend request of the feature as in flight for the enclosing scope, and records its latency under Operation in FAwsGameKitLatencyHistograms.
+ */
+class FAwsGameKitStatsRequestScope
+{
+public:
+    FAwsGameKitStatsRequestScope(EAwsGameKitStatsFeature InFeature, const TCHAR* InOperation)
+        : Feature(InFeature), Operation(InOperation), StartTime(FPlatformTime::Seconds())
+    {
+        FAwsGameKitStats::RequestStarted(Feature);
+    }
+
+    ~FAwsGameKitStatsRequestScope()
+    {
+        FAwsGameKitStats::RequestFinished(Feature);
+        FAwsGameKitLatencyHistograms::Get().Record(FName(Operation), FPlatformTime::Seconds() - StartTime);
+    }
+
+    UE_NONCOPYABLE(FAwsGameKitStatsRequestScope);
+
+private:
+    EAwsGameKitStatsFeature Feature;
+    const TCHAR* Operation;
+    double StartTime;
+};
@@ -0,0 +1,166 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Recording and replay of the GameKit backend calls, for offline performance regression testing.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Serialization/Archive.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * @brief Whether the feature wrappers record or replay the GameKit backend calls.
+ */
+enum class EAwsGameKitTrafficMode : uint8
+{
+    // The wrappers call the backend, nothing is recorded.
+    Off,
+
+    // The wrappers call the backend and append every call and its responses to the traffic file.
+    Record,
+
+    // The wrappers don't call the backend, they answer from the traffic file.
+    Replay
+};
+
+/**
+ * @brief A Game Saving Slot, as passed to a recorded callback.
+ */
+struct FAwsGameKitTrafficSlot
+{
+    FString SlotName;
+    FString MetadataLocal;
+    FString MetadataCloud;
+    int64 SizeLocal = 0;
+    int64 SizeCloud = 0;
+    int64 LastModifiedLocal = 0;
+    int64 LastModifiedCloud = 0;
+    int64 LastSync = 0;
+    uint8 SlotSyncStatus = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficSlot& Slot);
+};
+
+/**
+ * @brief One call of a response callback made during a recorded call, with its arguments.
+ */
+struct FAwsGameKitTrafficCallback
+{
+    // The string arguments, in order
+    TArray<FString> Strings;
+
+    // Game Saving: the cached slots, the slot acted on, the loaded data, whether this was the last page and the status passed to the callback
+    TArray<FAwsGameKitTrafficSlot> CachedSlots;
+    FAwsGameKitTrafficSlot Slot;
+    bool bHasSlot = false;
+    TArray<uint8> Data;
+    bool bComplete = false;
+    uint32 CallStatus = 0;
+
+    friend FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficCallback& Callback);
+};
+
+/**
+ * @brief A recorded GameKit backend call: which API was called, what it returned and how long it took.
+ */
+struct FAwsGameKitTrafficExchange
+{
+    // The GameKit C API, for example GameKitListAchievements
+    FString Api;
+
+    // What the call was about (achievement ID, bundle and item names, slot name), so that replay matches calls on different objects independently of their order
+    FString Key;
+
+    uint32 Status = 0;
+
+    // Since the recording started
+    double StartSeconds = 0.0;
+    float LatencySeconds = 0.0f;
+
+    // The out parameters: bundle names, key/value pairs flattened, or a bundle item value
+    TArray<FString> Outputs;
+
+    TArray<FAwsGameKitTrafficCallback> Callbacks;
+
+    friend FArchive& operator<<(FArchive& Ar, FAwsGameKitTrafficExchange& Exchange);
+};
+
+/**
+ * @brief Records the GameKit backend calls to a file, or replays them from one, so that a client-side change can be measured without network variance.
+ *
+ * @details Start the game with -GameKitRecordTraffic=<file> to record a session, and with -GameKitReplayTraffic=<file> to replay it.
+ * In both modes FAwsGameKitRuntimeModule loads the feature libraries behind recording wrappers (see AwsGameKitTrafficWrappers.h), which cover the
+ * Achievements, Identity, User Gameplay Data and Game Saving calls which reach the backend. Calls which don't reach the backend, and federated login, always run for real.
+ *
+ * When recording, every call is appended to the file as it completes: the API, its key, the status, the out parameters and every response callback with its
+ * arguments, and the time it took. The file is a compact binary stream, strings are stored as ANSI when they can be.
+ *
+ * When replaying, a call is answered with the next recorded call of the same API and key: its callbacks are made, its out parameters set and its status returned,
+ * after sleeping the recorded latency times GameKit.Traffic.ReplayLatencyScale (1 by default, 0 to answer immediately). A call which wasn't recorded, or was made
+ * more times than recorded, fails with GAMEKIT_ERROR_GENERAL and a warning. Replaying the same inputs therefore gives the same responses in the same order,
+ * so that CPU time, allocations (-llm) and frame time can be compared between builds.
+ *
+ * Replay still needs the client config of the recorded stack, since the libraries and their instances are created as usual. Tokens aren't replayed:
+ * the session manager doesn't get any, which doesn't matter since no call reaches the backend.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitTraffic
+{
+public:
+    /**
+     * @brief Get the process-wide traffic recorder.
+     */
+    static FAwsGameKitTraffic& Get();
+
+    /**
+     * @brief Open the file given on the command line. Called by FAwsGameKitRuntimeModule::StartupModule() before any library is loaded.
+     */
+    void Startup();
+
+    /**
+     * @brief Flush and close the recording. Called by FAwsGameKitRuntimeModule::ShutdownModule() once the libraries are released. Safe to call more than once.
+     */
+    void Shutdown();
+
+    EAwsGameKitTrafficMode GetMode() const
+    {
+        return Mode;
+    }
+
+    /**
+     * @brief Append a completed call to the recording. Does nothing unless recording.
+     *
+     * @param StartTime FPlatformTime::Seconds() when the call was made.
+     * @return Exchange.Status, so that a wrapper can return the result of Record().
+     */
+    uint32 Record(FAwsGameKitTrafficExchange& Exchange, double StartTime);
+
+    /**
+     * @brief Take the next recorded call of Api with Key, after waiting its scaled latency. Does nothing unless replaying.
+     *
+     * @return True when replaying, with OutExchange set to the recorded call, or to a GAMEKIT_ERROR_GENERAL result if there is no more recorded call of Api with Key.
+     */
+    bool Replay(const TCHAR* Api, const FString& Key, FAwsGameKitTrafficExchange& OutExchange);
+
+private:
+    static FString GetQueueName(const TCHAR* Api, const FString& Key);
+
+    EAwsGameKitTrafficMode Mode = EAwsGameKitTrafficMode::Off;
+    FString FilePath;
+    double RecordingStartTime = 0.0;
+
+    FCriticalSection Mutex;
+    TUniquePtr<FArchive> Writer;
+    int32 RecordedExchanges = 0;
+
+    // Replay: the recorded calls of each API and key, in call order, and how many have been replayed
+    TMap<FString, TArray<FAwsGameKitTrafficExchange>> ReplayQueues;
+    TMap<FString, int32> ReplayPositions;
+};
@@ -0,0 +1,159 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Shared, fixed-size executor used to run blocking GameKit calls off the game thread.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Function.h"
+
+class FQueuedThreadPool;
+
+/**
+ * @brief Priority lanes of the work queued on FAwsGameKitWorkerPool.
+ */
+enum class EAwsGameKitWorkLane : uint8
+{
+    // Calls the player is waiting on, such as Login. Picked up before any other queued work.
+    Interactive,
+
+    // Default lane of the feature APIs
+    Normal,
+
+    // Work nobody waits on, such as save slot backups and prefetches. Throttled while interactive work is in flight.
+    Background,
+
+    Num
+};
+
+/**
+ * @brief Makes the GameKit calls started on this thread queue their work on a lane while it's in scope.
+ *
+ * @details Each feature API queues its work on the lane of its feature by default: Identity calls are interactive, the calls made by the
+ * runtime's own background helpers are background, and the other calls are normal. Wrap a call in a scope to pick its lane instead:
+ *
+ *     {
+ *         FAwsGameKitWorkLaneScope LaneScope(EAwsGameKitWorkLane::Background);
+ *         AwsGameKitGameSaving::SaveSlot(Request, ResultDelegate);
+ *     }
+ *
+ * The lane is carried over to the work the call dispatches, including nested dispatches. Scopes nest.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitWorkLaneScope
+{
+public:
+    explicit FAwsGameKitWorkLaneScope(EAwsGameKitWorkLane Lane);
+    ~FAwsGameKitWorkLaneScope();
+
+    UE_NONCOPYABLE(FAwsGameKitWorkLaneScope);
+
+    /**
+     * @brief The lane of the innermost scope on this thread, EAwsGameKitWorkLane::Num outside any scope.
+     */
+    static EAwsGameKitWorkLane GetCurrent();
+
+private:
+    EAwsGameKitWorkLane Previous;
+};
+
+/**
+ * @brief Fixed-size pool of worker threads shared by every GameKit feature.
+ *
+ * @details Every GameKit C API call blocks until the backend responds, so each runtime API hops onto a worker thread before calling
+ * into the low level library. Instead of creating a new OS thread per call, the work is queued on this pool and picked up by one of a
+ * small number of long-lived threads.
+ *
+ * The pool is sized from the following console variables, which are read once when the AwsGameKitRuntime module starts up.
+ * Set them from the [SystemSettings] section of your project's DefaultEngine.ini, or per platform from Config/<Platform>/<Platform>Engine.ini
+ * so that the workers stay off the cores a console or mobile platform reserves for rendering or audio:
+ * - GameKit.WorkerPool.NumThreads: number of worker threads (default 4).
+ * - GameKit.WorkerPool.StackSizeKB: stack size of each worker thread in kilobytes (default 256).
+ * - GameKit.WorkerPool.ThreadPriority: EThreadPriority value used for the worker threads (default TPri_Normal).
+ * - GameKit.WorkerPool.AffinityMask: hexadecimal mask of the cores the worker threads may run on, such as 0x3C (default empty,
+ *   the engine's pool thread mask of the platform).
+ *
+ * The priority and the affinity mask also apply to the threads the runtime creates outside the pool, see ApplyToCurrentThread().
+ * The threads the GameKit client library creates itself, such as the User Gameplay Data retry thread, keep their defaults: the library
+ * has no hook to configure them.
+ *
+ * Work is queued on a lane, see EAwsGameKitWorkLane and FAwsGameKitWorkLaneScope. Interactive work jumps ahead of the queued normal and
+ * background work. While interactive work is queued or running, at most GameKit.WorkerPool.MaxBackgroundWhileInteractive background items
+ * run at the same time (default 1); the others wait until the interactive work is done.
+ *
+ * The number of queued (not yet started) work items is published as the "Worker Pool Queue Depth" counter of the AwsGameKit stat group,
+ * and the time work waited before it started as the "Worker Pool Wait" counters of each lane. The waits are recorded in
+ * FAwsGameKitLatencyHistograms too, as WorkerPool.Wait.Interactive, WorkerPool.Wait.Normal and WorkerPool.Wait.Background.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitWorkerPool
+{
+public:
+    /**
+     * @brief Get the process-wide worker pool.
+     */
+    static FAwsGameKitWorkerPool& Get();
+
+    /**
+     * @brief Create the worker threads. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Wait for the in-flight work to finish and destroy the worker threads. Work which hasn't started yet is abandoned.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Queue a unit of work on the pool.
+     *
+     * @details If the pool is not running (before startup or after shutdown), the work runs on a dedicated thread instead so that it is never dropped.
+     *
+     * @param Work The work to run.
+     * @param DefaultLane Lane of the work when the caller isn't in an FAwsGameKitWorkLaneScope.
+     */
+    void Dispatch(TUniqueFunction<void()>&& Work, EAwsGameKitWorkLane DefaultLane = EAwsGameKitWorkLane::Normal);
+
+    /**
+     * @brief Run Work for each index from 0 to Count - 1, on the calling thread and on up to MaxLanes - 1 work items of the pool, and wait until all are done.
+     *
+     * @details The calling thread takes part, so the call finishes even when the pool is busy. Used by the batch APIs, such as
+     * AwsGameKitGameSaving::SaveSlots() and AwsGameKitAchievements::UpdateAchievementsForPlayer().
+     */
+    void ParallelFor(int32 Count, int32 MaxLanes, TFunction<void(int32 Index)> Work);
+
+    /**
+     * @brief Number of work items which are waiting for a free worker thread.
+     */
+    int32 GetQueueDepth() const;
+
+    /**
+     * @brief Apply GameKit.WorkerPool.ThreadPriority and GameKit.WorkerPool.AffinityMask to the calling thread.
+     *
+     * @details Called first by the threads GameKit creates outside the pool, such as the fallback thread of Dispatch() and the token refresh thread.
+     */
+    static void ApplyToCurrentThread();
+
+private:
+    class FQueuedWork;
+
+    // Returns false if the background work was parked until the interactive work is done
+    bool BeginWork(FQueuedWork* Work);
+    void EndWork(EAwsGameKitWorkLane Lane);
+    void ReleaseParkedWork();
+
+    FQueuedThreadPool* Pool = nullptr;
+    FCriticalSection PoolMutex;
+    FThreadSafeCounter QueueDepth;
+
+    FCriticalSection LaneMutex;
+    int32 InteractiveInFlight = 0;
+    int32 BackgroundRunning = 0;
+    TArray<FQueuedWork*> ParkedWork;
+};
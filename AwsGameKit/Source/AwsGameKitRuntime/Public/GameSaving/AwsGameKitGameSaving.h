@@ -6,6 +6,7 @@
 // GameKit
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitFutures.h"
 #include "Core/AwsGameKitErrors.h"
 #include "GameSaving/AwsGameKitGameSavingWrapper.h"
 #include "Models/AwsGameKitGameSavingModels.h"
@@ -14,6 +15,9 @@
 // Unreal
 #include "CoreMinimal.h"
 
+// Unreal forward declarations
+class USaveGame;
+
 /**
  * @brief This class provides APIs for storing game save files in the cloud and synchronizing them with local devices.
  *
@@ -45,6 +49,10 @@
  * This library maintains a cache of slot information for all slots it interacts with (both locally and in the cloud).
  * The cached slots are updated on every API call, and are also returned in the delegate of most API calls.
  *
+ * Copying every cached slot into the results of the calls which act on one slot costs a string allocation per slot and field. Games with many slots
+ * can set the GameKit.GameSaving.ResultSlots console variable to 1: GetSlotSyncStatus(), SaveSlot(), LoadSlot() and DeleteSlot() then return an empty
+ * Slots array alongside the acted-on slot, and the cached slots are read from FAwsGameKitGameSavingSlotIndex when needed.
+ *
  * ## SaveInfo.json Files
  * This library creates "SaveInfo.json" files on the device every time save files are uploaded/downloaded through the SaveSlot() and LoadSlot() APIs.
  *
@@ -70,6 +78,9 @@ public:
      * @details This method loads the SaveInfo.json files that were created on the device during previous game sessions when calling SaveSlot() and LoadSlot().
      * This overwrites any cached slots in memory which have the same slot name as the slots loaded from the SaveInfo.json files.
      *
+     * @details The SaveInfo.json files are read from disk in parallel when the default file actions are used. Set the GameKit.GameSaving.LazyLocalSlots
+     * console variable to return straight away instead: the files are then parsed by the next Game Saving call which uses the cached slots, such as GetAllSlotSyncStatuses().
+     *
      * @param LocalSlotInformationFilePaths File paths for all of the player's SaveInfo.json files on the device. These paths are chosen by you when calling SaveSlot() and LoadSlot().
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -120,6 +131,7 @@ public:
      * @brief Asynchronously get an updated view and recommended syncing action for the player's specific save slot.
      *
      * @details This method updates the specific save slot's cloud attributes and marks the FGameSavingSlot::SlotSyncStatus member with the recommended syncing action you should take.
+     * Calls made while a GetSlotSyncStatus() of the same slot is in flight share its result, unless GameKit.Runtime.DeduplicateReads is 0.
      *
      * @param Request A struct containing all parameters required to call this method.
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
@@ -168,6 +180,8 @@ public:
      * @details If your game is being played without internet, you must still call this method as normal to avoid the risk of having the offline progress be
      * overwritten when internet connectivity is restored. See the "Offline Mode" section in the file level documentation for more details.
      *
+     * @details When GameKit.GameSaving.Scheduler.Enabled is set, the upload is queued with Background priority in FAwsGameKitGameSavingTransferScheduler.
+     *
      * @param Request A struct containing all parameters required to call this method.
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -177,6 +191,9 @@ public:
      * - GAMEKIT_ERROR_FILE_WRITE_FAILED: The SaveInfo.json file was unable to be written to the device. If using the default file I/O callbacks,
      *                                    check the logs to see the root cause. If the platform is not supported by the default file I/O callbacks,
      *                                    use SetFileActions() to provide your own callbacks. See SetFileActions() for more details.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The Request's SaveFilePath could not be read, or encryption is enabled and the save file could not be encrypted. Check the logs to see the root cause.
+     * - GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC: GameKit.GameSaving.SkipUnchangedUploads is enabled and the save file and metadata haven't changed since the slot was last
+     *                                                          synced. Nothing was uploaded and the cloud save file is untouched. Slots is empty. See FAwsGameKitGameSavingChangeTracker.
      * - GAMEKIT_ERROR_GAME_SAVING_MAX_CLOUD_SLOTS_EXCEEDED: The upload was cancelled because it would have caused the player to exceed their "maximum cloud save slots limit". This limit
      *                                                       was configured when you deployed the Game Saving feature and can be changed by doing another deployment through the Plugin UI.
      * - GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE: The Metadata member of your Request object is too large. Please see the documentation on FGameSavingSaveSlotRequest::Metadata for details.
@@ -191,12 +208,23 @@ public:
      */
     static void SaveSlot(const FGameSavingSaveSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
 
+    /**
+     * @brief Same as SaveSlot() above, but takes ownership of the Request so its Data buffer is moved to the worker thread instead of copied.
+     */
+    static void SaveSlot(FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
     /**
      * @brief Asynchronously download the player's cloud slot into a local data buffer.
      *
      * @details Also write the slot's information to a SaveInfo.json file on the device.
      * This SaveInfo.json file should be passed into AddLocalSlots() when you initialize the Game Saving library in the future.
      *
+     * @details When GameKit.GameSaving.Scheduler.Enabled is set, the download is queued with Foreground priority in FAwsGameKitGameSavingTransferScheduler.
+     * A slot downloaded in the background after login by FAwsGameKitGameSavingLoginPrefetcher is returned without downloading it again.
+     *
+     * @details Request.Data can be left empty, the download buffer is then sized from the cached slot's SizeCloud. Set Request.SaveFilePath to have the save
+     * file written to the device instead of returned in the results' Data.
+     *
      * @param Request A struct containing all parameters required to call this method.
      * @param ResultDelegate The delegate to invoke and return data to when the method has finished. The ::IntResult parameter is a GameKit status code and
      * indicates the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -205,7 +233,7 @@ public:
      * - GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME: The provided slot name is malformed. Check the logs to see what the required format is.
      * - GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND: The provided slot name was not found in the cached slots. This either means you have a typo in the slot name,
      *                                             or the slot only exists in the cloud and you need to call GetAllSlotSyncStatuses() first before calling this method.
-     * - GAMEKIT_ERROR_FILE_WRITE_FAILED: The SaveInfo.json file was unable to be written to the device. If using the default file I/O callbacks,
+     * - GAMEKIT_ERROR_FILE_WRITE_FAILED: The SaveInfo.json file, or the save file at Request.SaveFilePath, was unable to be written to the device. If using the default file I/O callbacks,
      *                                    check the logs to see the root cause. If the platform is not supported by the default file I/O callbacks,
      *                                    use SetFileActions() to provide your own callbacks. See SetFileActions() for more details.
      * - GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT: The download was cancelled to prevent overwriting the player's progress. This most likely indicates the player has played on multiple
@@ -222,15 +250,131 @@ public:
      * - GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL: The data buffer you provided in the Request object is not large enough to hold the downloaded S3 file. This likely means a newer version of the
      *                                               cloud file was uploaded from another device since the last time you called GetAllSlotSyncStatuses() or GetSlotSyncStatus() on this device. To resolve,
      *                                               call GetSlotSyncStatus() to get the up-to-date size of the cloud file.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The downloaded file is compressed with a codec which isn't available on this platform, could not be decompressed, failed its integrity check,
+     *                                   or is encrypted and could not be decrypted with the slot's key.
+     *                                   See FAwsGameKitGameSavingCompression, FAwsGameKitGameSavingChecksum and FAwsGameKitGameSavingEncryption.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
      */
     static void LoadSlot(const FGameSavingLoadSlotRequest& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate);
 
+    /**
+     * @brief Same as LoadSlot() above, but takes ownership of the Request so its Data buffer is moved to the worker thread instead of copied.
+     */
+    static void LoadSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> ResultDelegate);
+
+    /**
+     * @brief Upload a USaveGame object with SaveSlot(), serializing it straight into the upload buffer instead of saving it to disk and reading the file back.
+     *
+     * @details The object is serialized on the calling thread with UGameplayStatics::SaveGameToMemory(), in the same format as UGameplayStatics::SaveGameToSlot(),
+     * into a buffer reused from earlier calls. Compression and checksums are applied as for any other SaveSlot() call. Call it from the game thread.
+     *
+     * @param SaveGameObject The object to save.
+     * @param Request Same as SaveSlot(). Its Data and SaveFilePath are ignored.
+     * @param ResultDelegate Same as SaveSlot(). GAMEKIT_ERROR_FILE_READ_FAILED is also returned if the object could not be serialized.
+     */
+    static void SaveGameToSlot(USaveGame* SaveGameObject, FGameSavingSaveSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> ResultDelegate);
+
+    /**
+     * @brief Download a slot with LoadSlot() and deserialize it into a USaveGame object straight from the download buffer, without writing it to disk.
+     *
+     * @details The object is created on the game thread with UGameplayStatics::LoadGameFromMemory() before the delegate is called, so slots saved with
+     * SaveGameToSlot() and save files written by UGameplayStatics::SaveGameToSlot() can both be loaded.
+     *
+     * @param Request Same as LoadSlot(). Its SaveFilePath is ignored.
+     * @param ResultDelegate Same as LoadSlot(), with the loaded object, which is null unless the status is GAMEKIT_SUCCESS.
+     * GAMEKIT_ERROR_FILE_READ_FAILED is also returned if the slot isn't a save game.
+     */
+    static void LoadGameFromSlot(FGameSavingLoadSlotRequest&& Request, TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&, USaveGame*> ResultDelegate);
+
+    /**
+     * @brief Asynchronously upload several save slots, transferring up to GameKit.GameSaving.BatchParallelism of them at the same time.
+     *
+     * @details Each slot is saved exactly like SaveSlot() would, with its own pre-signed URL and metadata update, since these are requested by the Game Saving library.
+     * Requests should be for different slots.
+     *
+     * @details Set the GameKit.GameSaving.AsyncFileIO console variable to read the save files of requests with a SaveFilePath with the engine's async file IO:
+     * the next slots' save files are then read from disk while the current slots upload, which helps on slow storage.
+     *
+     * @param Requests The slots to upload.
+     * @param PartialResultDelegate Delegate that processes the result of each slot as soon as it completes, in completion order. The slot's status code is in CallStatus,
+     * its possible values are the ones listed for SaveSlot().
+     * @param OnCompleteDelegate Delegate that processes the status code once every slot has completed: GAMEKIT_SUCCESS if every slot was saved,
+     * otherwise the status code of the first slot in request order which wasn't.
+     */
+    static void SaveSlots(const TArray<FGameSavingSaveSlotRequest>& Requests, TAwsGameKitDelegateParam<const FGameSavingSlotActionResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Same as SaveSlots() above, but takes ownership of the Requests so their Data buffers are moved to the worker thread instead of copied.
+     */
+    static void SaveSlots(TArray<FGameSavingSaveSlotRequest>&& Requests, TAwsGameKitDelegateParam<const FGameSavingSlotActionResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Asynchronously download several save slots, transferring up to GameKit.GameSaving.BatchParallelism of them at the same time.
+     *
+     * @details Each slot is loaded exactly like LoadSlot() would. Requests should be for different slots.
+     *
+     * @param Requests The slots to download.
+     * @param PartialResultDelegate Delegate that processes the result and data of each slot as soon as it completes, in completion order. The slot's status code is in CallStatus,
+     * its possible values are the ones listed for LoadSlot().
+     * @param OnCompleteDelegate Delegate that processes the status code once every slot has completed: GAMEKIT_SUCCESS if every slot was loaded,
+     * otherwise the status code of the first slot in request order which wasn't.
+     */
+    static void LoadSlots(const TArray<FGameSavingLoadSlotRequest>& Requests, TAwsGameKitDelegateParam<const FGameSavingDataResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Same as LoadSlots() above, but takes ownership of the Requests so their Data buffers are moved to the worker thread instead of copied.
+     */
+    static void LoadSlots(TArray<FGameSavingLoadSlotRequest>&& Requests, TAwsGameKitDelegateParam<const FGameSavingDataResults&> PartialResultDelegate, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
+
+    /**
+     * @brief Synchronously get the cached slots as last returned by any Game Saving call, without calling the backend. See FAwsGameKitGameSavingSlotIndex.
+     *
+     * @return The slots sorted by slot name, empty until GetAllSlotSyncStatuses() has completed once.
+     */
+    static TArray<FGameSavingSlot> GetCachedSlots();
+
+    /**
+     * @brief Set the delegate called on the game thread whenever a cached slot's SlotSyncStatus changes. See FAwsGameKitGameSavingSlotIndex.
+     */
+    static void SetSlotSyncStatusChangeDelegate(TAwsGameKitDelegateParam<const FGameSavingSlot&> SyncStatusChangeDelegate);
+
     /**
      * @brief Get the recommended file extension for SaveInfo JSON files.
      *
      * @details This extension can be appended to any filename and retain a clear meaning.
      */
     static FString GetSaveInfoFileExtension();
+
+    /**
+     * @brief Awaitable versions of the methods above, with the same status codes.
+     *
+     * @details The futures are fulfilled on the GameKit worker thread which finished the call, so calls can be chained with TFuture::Next()
+     * without a hop through the game thread, and independent slots can be saved or loaded together with AwsGameKitWhenAll().
+     * Reads shared with other callers are fulfilled on the game thread. See MakeAwsGameKitStatusFuture().
+     */
+    static TFuture<TAwsGameKitResult<TArray<FGameSavingSlot>>> GetAllSlotSyncStatusesAsync()
+    {
+        return MakeAwsGameKitResultFuture<TArray<FGameSavingSlot>>([](TAwsGameKitDelegateParam<const IntResult&, const TArray<FGameSavingSlot>&> Delegate) { GetAllSlotSyncStatuses(Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FGameSavingSlotActionResults>> GetSlotSyncStatusAsync(const FGameSavingGetSlotSyncStatusRequest& Request)
+    {
+        return MakeAwsGameKitResultFuture<FGameSavingSlotActionResults>([&Request](TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> Delegate) { GetSlotSyncStatus(Request, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FGameSavingSlotActionResults>> DeleteSlotAsync(const FGameSavingDeleteSlotRequest& Request)
+    {
+        return MakeAwsGameKitResultFuture<FGameSavingSlotActionResults>([&Request](TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> Delegate) { DeleteSlot(Request, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FGameSavingSlotActionResults>> SaveSlotAsync(FGameSavingSaveSlotRequest&& Request)
+    {
+        return MakeAwsGameKitResultFuture<FGameSavingSlotActionResults>([&Request](TAwsGameKitDelegateParam<const IntResult&, const FGameSavingSlotActionResults&> Delegate) { SaveSlot(MoveTemp(Request), Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FGameSavingDataResults>> LoadSlotAsync(FGameSavingLoadSlotRequest&& Request)
+    {
+        return MakeAwsGameKitResultFuture<FGameSavingDataResults>([&Request](TAwsGameKitDelegateParam<const IntResult&, const FGameSavingDataResults&> Delegate) { LoadSlot(MoveTemp(Request), Delegate); });
+    }
 };
@@ -0,0 +1,70 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in detection of SaveSlot() calls whose save file hasn't changed since it was last synced.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Remembers the content hash of every slot's last synced save file, so that SaveSlot() can skip uploading a save file which hasn't changed.
+ *
+ * @details Disabled by default. Set the GameKit.GameSaving.SkipUnchangedUploads console variable to 1 to enable it.
+ *
+ * While enabled, AwsGameKitGameSaving::SaveSlot() hashes the save file and its metadata with xxHash3 before the upload. If they match the ones last
+ * uploaded or downloaded for the slot during this session, the call returns GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC without calling the
+ * backend: the cloud save file, its timestamp and the cached slots stay untouched. SaveSlot() calls with OverrideSync set always upload.
+ *
+ * The hashes are kept in memory: the first SaveSlot() of a slot in each session uploads, and DeleteSlot() forgets the slot's hash.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingChangeTracker
+{
+public:
+    /**
+     * @brief Get the process-wide change tracker.
+     */
+    static FAwsGameKitGameSavingChangeTracker& Get();
+
+    /**
+     * @brief Whether SaveSlot() skips unchanged uploads (GameKit.GameSaving.SkipUnchangedUploads > 0).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Hash a save file and its metadata. The metadata is the slot's UTF-8 encoded metadata string.
+     */
+    static FString HashContent(TArrayView<const uint8> Data, TArrayView<const uint8> Metadata);
+
+    /**
+     * @brief Same as HashContent() above, but reuses the save file's FAwsGameKitGameSavingChecksum instead of hashing it again.
+     */
+    static FString HashContent(int64 DataSize, uint32 DataChecksum, TArrayView<const uint8> Metadata);
+
+    /**
+     * @brief Whether ContentHash is the hash of the slot's last synced save file.
+     */
+    bool IsUnchanged(const FString& SlotName, const FString& ContentHash) const;
+
+    /**
+     * @brief Record the hash of a save file which was uploaded or downloaded.
+     */
+    void RecordSync(const FString& SlotName, const FString& ContentHash);
+
+    /**
+     * @brief Forget the hash of a deleted slot.
+     */
+    void Forget(const FString& SlotName);
+
+private:
+    mutable FCriticalSection Mutex;
+    TMap<FString, FString> SyncedHashes;
+};
@@ -0,0 +1,54 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Optional end-to-end integrity checksums of the save files uploaded and downloaded by Game Saving.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * @brief Checksums save files when AwsGameKitGameSaving::SaveSlot() uploads them, and verifies them when LoadSlot() downloads them.
+ *
+ * @details Enabled with the GameKit.GameSaving.Checksum console variable, off by default.
+ *
+ * The checksum is the CRC-32C of the save file before compression (see FAwsGameKitGameSavingCompression), computed with the SSE 4.2 or ARMv8 CRC
+ * instructions when the platform is built with them, otherwise in portable code. It is appended to the uploaded payload in a 16 byte trailer,
+ * so it covers the transfer, the cloud storage and the decompression. Save files which were uploaded without a checksum still load unchanged.
+ *
+ * When GameKit.GameSaving.SkipUnchangedUploads is also set, FAwsGameKitGameSavingChangeTracker uses the checksum as the save file's hash, so the save
+ * file is only scanned once.
+ *
+ * All methods are stateless and thread safe. SaveSlot() and LoadSlot() call them on their worker thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingChecksum
+{
+public:
+    /**
+     * @brief True if SaveSlot() checksums save files.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Compute the CRC-32C (Castagnoli) of a buffer.
+     */
+    static uint32 Crc32c(TArrayView<const uint8> Data);
+
+    /**
+     * @brief Append the checksum trailer to a payload.
+     */
+    static void AppendTrailer(TArray<uint8>& Payload, uint32 Checksum);
+
+    /**
+     * @brief Remove the checksum trailer from a downloaded payload.
+     *
+     * @param Payload Shrunk to exclude the trailer if it has one.
+     * @param OutChecksum Receives the checksum of the save file.
+     * @return False if the payload has no checksum trailer. Payload is then left unchanged.
+     */
+    static bool StripTrailer(TArrayView<const uint8>& Payload, uint32& OutChecksum);
+};
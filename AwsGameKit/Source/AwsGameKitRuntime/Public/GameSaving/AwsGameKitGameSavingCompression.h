@@ -0,0 +1,64 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Optional compression of the save files uploaded and downloaded by Game Saving.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+/**
+ * @brief Compresses save files before AwsGameKitGameSaving::SaveSlot() uploads them, and decompresses them after LoadSlot() downloads them.
+ *
+ * @details The codec is chosen with the GameKit.GameSaving.Compression console variable: Oodle, LZ4 or Zlib, as supported by FCompression on the platform.
+ * It is off by default.
+ *
+ * A compressed save file starts with a 16 byte header holding the codec and the size of the original data, so a slot can always be loaded whatever
+ * the codec it was saved with, and save files which were uploaded without compression still load unchanged. A save file which doesn't get smaller
+ * is uploaded without compression.
+ *
+ * The slot's size and SHA-256 hash are those of the uploaded payload, and the payload's size counts against the slot's size limit. LoadSlot()'s
+ * download buffer only needs to be the size of the payload, which is the size the slot index caches.
+ *
+ * All methods are stateless and thread safe. SaveSlot() and LoadSlot() call them on their worker thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingCompression
+{
+public:
+    /**
+     * @brief True if SaveSlot() compresses save files.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Compress a save file with the codec selected by GameKit.GameSaving.Compression.
+     *
+     * @param OutPayload Receives the header and the compressed data.
+     * @return False if compression is disabled, the codec isn't available, or the save file doesn't get smaller. The save file should then be uploaded as is.
+     */
+    static bool Compress(TArrayView<const uint8> Data, TArray<uint8>& OutPayload);
+
+    /**
+     * @brief Whether a downloaded save file starts with a compression header. Payloads without one are the save file as is.
+     */
+    static bool IsCompressed(TArrayView<const uint8> Payload);
+
+    /**
+     * @brief Get the size of a downloaded save file once decompressed, or the payload's size if it isn't compressed.
+     *
+     * @return -1 if the payload's header is malformed.
+     */
+    static int64 GetDecompressedSize(TArrayView<const uint8> Payload);
+
+    /**
+     * @brief Decompress a downloaded save file. A payload without a compression header is copied as is.
+     *
+     * @param OutData Receives the save file. It is sized once to the original size, reusing its allocation when large enough, and decompressed into in place.
+     * @return False if the codec isn't available on this platform or the payload is corrupt.
+     */
+    static bool Decompress(TArrayView<const uint8> Payload, TArray<uint8>& OutData);
+};
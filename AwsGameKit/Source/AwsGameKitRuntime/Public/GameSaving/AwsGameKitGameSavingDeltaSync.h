@@ -0,0 +1,83 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Content-defined chunking of save files, for a future Game Saving delta mode.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief A chunk of a save file, named by the lowercase hex SHA-1 of its content.
+ */
+struct FGameSavingChunk
+{
+    FString Hash;
+    int64 Offset = 0;
+    int32 Size = 0;
+};
+
+/**
+ * @brief Splits save files into content-defined chunks, so that only the chunks which changed between two saves need to be transferred.
+ *
+ * @details Chunk boundaries are found with a gear rolling hash (FastCDC), between 2 KB and 64 KB and 8 KB on average. A boundary only depends on the bytes
+ * before it, so an edit in the middle of a save file changes the chunks around it and leaves the other chunks and their hashes unchanged.
+ *
+ * These are only the client half of the building blocks: AwsGameKitGameSaving::SaveSlot() and LoadSlot() have no delta option and always
+ * transfer the whole save file, and nothing in the plugin calls these methods or the SyncSlotChunks backend endpoint (POST
+ * /game_saving/{slot_name}/chunks). The prebuilt client library doesn't call that endpoint, and the plugin can't sign its own requests to
+ * the GameKit API. Once a client can call it, the intended flow is, with the manifest written by WriteManifest() uploaded as the slot's
+ * save file so that the slot's hash, timestamps and sync status work as for any other save:
+ * - Saving: ChunkSaveData(), ask the endpoint for the upload URLs of every chunk with its size (it only returns the ones it doesn't store yet,
+ *   and each URL only accepts its chunk's size), upload them,
+ *   SaveSlot() the manifest, then prune the chunks the manifest no longer references.
+ * - Loading: LoadSlot() the manifest, ReadManifest(), GetMissingChunks() against the chunks of the local save file, download only those,
+ *   then AssembleSaveData().
+ *
+ * All methods are stateless and thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingDeltaSync
+{
+public:
+    /**
+     * @brief Split a save file into content-defined chunks.
+     */
+    static TArray<FGameSavingChunk> ChunkSaveData(TArrayView<const uint8> Data);
+
+    /**
+     * @brief Write the manifest of a save file, a small text file listing the hash and size of every chunk in order.
+     */
+    static TArray<uint8> WriteManifest(const TArray<FGameSavingChunk>& Chunks);
+
+    /**
+     * @brief Read a manifest written by WriteManifest(). The chunk offsets are computed from the sizes.
+     *
+     * @return False if the manifest is malformed.
+     */
+    static bool ReadManifest(TArrayView<const uint8> Manifest, TArray<FGameSavingChunk>& OutChunks);
+
+    /**
+     * @brief Get the unique hashes of the chunks of a manifest which aren't among the local chunks, in manifest order.
+     */
+    static TArray<FString> GetMissingChunks(const TArray<FGameSavingChunk>& Manifest, const TArray<FGameSavingChunk>& LocalChunks);
+
+    /**
+     * @brief Rebuild a save file from its manifest.
+     *
+     * @param FindChunk Returns the content of a chunk, from the local save file or a download, or an empty view if it isn't available.
+     * @param OutData Receives the save file. It is sized once, to the total size of the manifest.
+     * @return False if a chunk isn't available, or its size or hash doesn't match the manifest.
+     */
+    static bool AssembleSaveData(const TArray<FGameSavingChunk>& Manifest, TFunctionRef<TArrayView<const uint8>(const FString& Hash)> FindChunk, TArray<uint8>& OutData);
+
+    /**
+     * @brief Get the lowercase hex SHA-1 of a chunk's content.
+     */
+    static FString HashChunk(TArrayView<const uint8> Data);
+};
@@ -0,0 +1,87 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Optional client-side encryption of the save files uploaded and downloaded by Game Saving.
+ */
+
+#pragma once
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief Encrypts save files before AwsGameKitGameSaving::SaveSlot() uploads them, and decrypts them after LoadSlot() downloads them.
+ *
+ * @details Enabled by giving it the game's keys with SetKeyProvider(), off by default. Save files are encrypted with AES-256-GCM through the engine's
+ * PlatformCrypto plugin, whose OpenSSL implementation uses the AES-NI and PCLMULQDQ instructions on x64 and the ARMv8 cryptography extensions on ARM64.
+ * The data is encrypted and decrypted in 1 MB chunks by a single streaming cipher, straight into the buffer uploaded or the one decompressed from.
+ *
+ * Encryption is the last stage of SaveSlot(): the save file is checksummed (see FAwsGameKitGameSavingChecksum), compressed (see FAwsGameKitGameSavingCompression),
+ * then encrypted with its checksum trailer, so neither the checksum nor the compression header is stored in the clear. An encrypted save file starts with a
+ * 20 byte header holding the algorithm and a random 96-bit nonce, and ends with the 16 byte GCM authentication tag. A download which was tampered with or
+ * decrypted with the wrong key fails its authentication. While encryption is required, which it is by default once a key provider is set, save files
+ * without an encryption header fail to load, so a cloud save replaced with a plaintext one can't get past the encryption. Call SetRequireEncryption(false)
+ * to load the save files uploaded before encryption was enabled.
+ *
+ * The slot's size and SHA-256 hash are those of the encrypted payload.
+ *
+ * All methods are thread safe. SaveSlot() and LoadSlot() call them, and the key provider, on their worker thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingEncryption
+{
+public:
+    /**
+     * @brief Supplies the 32 byte AES-256 key of a slot. Return false if there is no key, the save or load then fails.
+     */
+    typedef TFunction<bool(const FString& SlotName, TArray<uint8>& OutKey)> FKeyProvider;
+
+    /**
+     * @brief Set the callback which supplies the keys, and enable encryption. Pass nullptr to disable it.
+     *
+     * @details The key is requested for every SaveSlot() and LoadSlot() call, on the worker thread, and wiped from memory once the slot is encrypted
+     * or decrypted. Keep the keys in the platform's secure storage rather than in the game's files.
+     */
+    static void SetKeyProvider(FKeyProvider KeyProvider);
+
+    /**
+     * @brief True if SaveSlot() encrypts save files, which is when a key provider is set.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Whether LoadSlot() fails save files which aren't encrypted, with GAMEKIT_ERROR_FILE_READ_FAILED.
+     *
+     * @details Only applies while a key provider is set. SetKeyProvider() turns it back on.
+     */
+    static void SetRequireEncryption(bool bRequire);
+
+    /**
+     * @brief True if LoadSlot() only accepts encrypted save files, see SetRequireEncryption().
+     */
+    static bool IsEncryptionRequired();
+
+    /**
+     * @brief Encrypt a payload with the slot's key.
+     *
+     * @param OutPayload Receives the header, the encrypted payload and the authentication tag.
+     * @return False if encryption is disabled, there is no key for the slot or encryption failed. The payload must then not be uploaded.
+     */
+    static bool Encrypt(TArrayView<const uint8> Data, const FString& SlotName, TArray<uint8>& OutPayload);
+
+    /**
+     * @brief Whether a downloaded save file starts with an encryption header. Payloads without one aren't encrypted.
+     */
+    static bool IsEncrypted(TArrayView<const uint8> Payload);
+
+    /**
+     * @brief Decrypt and authenticate a downloaded save file with the slot's key.
+     *
+     * @param OutData Receives the decrypted payload, reusing its allocation when large enough.
+     * @return False if there is no key for the slot, the payload is malformed, or it failed its authentication.
+     */
+    static bool Decrypt(TArrayView<const uint8> Payload, const FString& SlotName, TArray<uint8>& OutData);
+};
@@ -16,6 +16,9 @@
 
 #include "AwsGameKitGameSavingFunctionLibrary.generated.h" // Last include (Unreal requirement)
 
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FDelegateOnSaveSlotsResultReceived, const TArray<FGameSavingSaveSlotRequest>&, Requests, const TArray<FGameSavingSlotActionResults>&, PartialResults, bool, bIsLastResult);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FDelegateOnLoadSlotsResultReceived, const TArray<FGameSavingLoadSlotRequest>&, Requests, const TArray<FGameSavingDataResults>&, PartialResults, bool, bIsLastResult);
+
 /**
  * @brief This class provides Blueprint APIs for storing game save files in the cloud and synchronizing them with local devices.
  *
@@ -139,6 +142,9 @@ public:
      * - GAMEKIT_ERROR_FILE_WRITE_FAILED: The SaveInfo.json file was unable to be written to the device. If using the default file I/O callbacks,
      *                                    check the logs to see the root cause. If the platform is not supported by the default file I/O callbacks,
      *                                    use SetFileActions() to provide your own callbacks. See SetFileActions() for more details.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The Request's SaveFilePath could not be read. Check the logs to see the root cause.
+     * - GAMEKIT_ERROR_GAME_SAVING_UPLOAD_SLOT_ALREADY_IN_SYNC: GameKit.GameSaving.SkipUnchangedUploads is enabled and the save file and metadata haven't changed since the slot was last
+     *                                                          synced. Nothing was uploaded and the cloud save file is untouched. Slots is empty. See FAwsGameKitGameSavingChangeTracker.
      * - GAMEKIT_ERROR_GAME_SAVING_MAX_CLOUD_SLOTS_EXCEEDED: The upload was cancelled because it would have caused the player to exceed their "maximum cloud save slots limit". This limit
      *                                                       was configured when you deployed the Game Saving feature and can be changed by doing another deployment through the Plugin UI.
      * - GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE: The Metadata member of your Request object is too large. Please see the documentation on FGameSavingSaveSlotRequest::Metadata for details.
@@ -190,6 +196,8 @@ public:
      * - GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL: The data buffer you provided in the Request object is not large enough to hold the downloaded S3 file. This likely means a newer version of the
      *                                               cloud file was uploaded from another device since the last time you called GetAllSlotSyncStatuses() or GetSlotSyncStatus() on this device. To resolve,
      *                                               call GetSlotSyncStatus() to get the up-to-date size of the cloud file.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The downloaded file is compressed with a codec which isn't available on this platform, could not be decompressed, or failed its integrity check.
+     *                                   See FAwsGameKitGameSavingCompression and FAwsGameKitGameSavingChecksum.
      * - GAMEKIT_ERROR_HTTP_REQUEST_FAILED: The backend HTTP request failed. Check the logs to see what the HTTP response code was.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
      */
@@ -202,6 +210,54 @@ public:
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
     
+    /**
+     * Asynchronously upload several save slots, transferring up to GameKit.GameSaving.BatchParallelism of them at the same time.
+     *
+     * Each slot is saved exactly like SaveSlot() would. Requests should be for different slots.
+     *
+     * @param Requests The slots to upload.
+     * @param OnPartialResults Delegate to execute with the results of the slots which completed since it was last executed, in completion order.
+     * @param Results The result of every slot, in request order. Each slot's status code is in CallStatus, its possible values are the ones listed for SaveSlot().
+     * @param Error GAMEKIT_SUCCESS if every slot was saved, otherwise the status code of the first slot in request order which wasn't.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Game Saving", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure", AutoCreateRefTerm = "OnPartialResults"))
+    static void SaveSlots(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const TArray<FGameSavingSaveSlotRequest>& Requests,
+        const FDelegateOnSaveSlotsResultReceived OnPartialResults,
+        TArray<FGameSavingSlotActionResults>& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
+    /**
+     * Asynchronously download several save slots, transferring up to GameKit.GameSaving.BatchParallelism of them at the same time.
+     *
+     * Each slot is loaded exactly like LoadSlot() would. Requests should be for different slots.
+     *
+     * @param Requests The slots to download.
+     * @param OnPartialResults Delegate to execute with the results of the slots which completed since it was last executed, in completion order.
+     * @param Results The result and data of every slot, in request order. Each slot's status code is in CallStatus, its possible values are the ones listed for LoadSlot().
+     * @param Error GAMEKIT_SUCCESS if every slot was loaded, otherwise the status code of the first slot in request order which wasn't.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Game Saving", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure", AutoCreateRefTerm = "OnPartialResults"))
+    static void LoadSlots(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const TArray<FGameSavingLoadSlotRequest>& Requests,
+        const FDelegateOnLoadSlotsResultReceived OnPartialResults,
+        TArray<FGameSavingDataResults>& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
+    /**
+     * Get the cached slots as last returned by any Game Saving call, without calling the backend.
+     *
+     * Returns immediately, so menus can call it every time they open. The slots are sorted by slot name, and empty until GetAllSlotSyncStatuses() has completed once.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Game Saving")
+    static TArray<FGameSavingSlot> GetCachedSlots();
+
     /**
      * Convert a millisecond epoch timestamp to a human readable date time.
      */
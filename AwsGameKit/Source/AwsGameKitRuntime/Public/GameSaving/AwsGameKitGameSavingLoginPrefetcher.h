@@ -0,0 +1,111 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in background download of the save slots a player is likely to load first, started when they log in.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Which slots FAwsGameKitGameSavingLoginPrefetcher downloads after login. Set with the GameKit.GameSaving.LoginPrefetch.Policy console variable.
+ */
+enum class EAwsGameKitGameSavingLoginPrefetchPolicy : uint8
+{
+    // Nothing is prefetched.
+    None = 0,
+
+    // The GameKit.GameSaving.LoginPrefetch.MaxSlots slots most recently saved to the cloud, whether or not the local copy is up to date.
+    MostRecent = 1,
+
+    // Only slots whose SlotSyncStatus is SHOULD_DOWNLOAD_CLOUD, most recently saved first, up to GameKit.GameSaving.LoginPrefetch.MaxSlots.
+    ShouldDownload = 2
+};
+
+/**
+ * @brief Downloads the slots a player is likely to load first in the background after login, so the first LoadSlot() of one of them returns without a round trip.
+ *
+ * @details Disabled by default, see EAwsGameKitGameSavingLoginPrefetchPolicy. Once AwsGameKitIdentity::Login() or PollAndRetrieveFederatedTokens() succeeds,
+ * the prefetcher calls GetAllSlotSyncStatuses() on the worker pool, picks slots according to the policy and downloads them with LoadSlot().
+ * Slots which are SHOULD_UPLOAD_LOCAL or IN_CONFLICT are never prefetched, and prefetching stops before the slots' total SizeCloud exceeds
+ * GameKit.GameSaving.LoginPrefetch.MaxBytes. Call AddLocalSlots() before logging in so the sync statuses are known.
+ *
+ * The next LoadSlot() of a prefetched slot, including through LoadSlots() and the transfer scheduler, is served from memory. The slot's SaveInfo.json is
+ * downloaded to a scratch file and copied to the request's SaveInfoFilePath then, as LoadSlot() would have written it. A prefetched slot is only served
+ * once, and only while the cached slots still show the cloud save file that was prefetched. Otherwise LoadSlot() downloads the slot as usual.
+ *
+ * Prefetching requires the default FileActions, see AwsGameKitGameSaving::SetFileActions(). The slots are downloaded with a separate Game Saving instance,
+ * so the player's instance, FAwsGameKitGameSavingSlotIndex and FAwsGameKitGameSavingChangeTracker only count a prefetched slot as SYNCED once LoadSlot()
+ * serves it. A prefetched slot which is dropped before it's loaded keeps its sync status, for example SHOULD_DOWNLOAD_CLOUD.
+ *
+ * Slots which FAwsGameKitNetworkPolicy defers on the current link aren't prefetched. The prefetched slots count against FAwsGameKitCacheBudget,
+ * which drops the oldest ones first when the caches are over budget or memory is low; a dropped slot is downloaded by LoadSlot().
+ * Prefetched slots are dropped when the player logs out. All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingLoginPrefetcher
+{
+public:
+    /**
+     * @brief Get the process-wide prefetcher.
+     */
+    static FAwsGameKitGameSavingLoginPrefetcher& Get();
+
+    /**
+     * @brief The policy set with the GameKit.GameSaving.LoginPrefetch.Policy console variable.
+     */
+    static EAwsGameKitGameSavingLoginPrefetchPolicy GetPolicy();
+
+    /**
+     * @brief Start prefetching on the worker pool. Called by AwsGameKitIdentity when a login succeeds. Does nothing if the policy is None.
+     */
+    void OnLogin();
+
+    /**
+     * @brief Serve a LoadSlot() from a prefetched slot and mark the slot SYNCED in gameSavingLibrary. Called by every LoadSlot() on its worker thread before it
+     * downloads the slot.
+     *
+     * @return False if the slot isn't prefetched, the prefetched copy is out of date, or gameSavingLibrary isn't the module's. The slot must then be downloaded.
+     */
+    bool Take(const GameSavingLibrary& gameSavingLibrary, const FGameSavingLoadSlotRequest& Request, FGameSavingDataResults& OutResults);
+
+    /**
+     * @brief Drop the prefetched slots and cancel the prefetch in progress, for example when the player logs out. Called by FAwsGameKitRuntimeModule::ShutdownModule().
+     */
+    void Clear();
+
+    /**
+     * @brief Put the prefetched slots under FAwsGameKitCacheBudget. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void RegisterWithCacheBudget();
+
+private:
+    struct FPrefetchedSlot
+    {
+        FGameSavingDataResults Results;
+        FString SaveInfoFilePath;
+
+        // Recorded by FAwsGameKitGameSavingChangeTracker when the slot is loaded, empty when it's disabled
+        FString ContentHash;
+
+        // FPlatformTime::Seconds() at which the download finished, for FAwsGameKitCacheBudget
+        double PrefetchedAt = 0.0;
+    };
+
+    void Prefetch(uint32 Generation);
+    int64 EvictOldestSlot();
+    FString GetScratchDirectory() const;
+
+    FCriticalSection Mutex;
+    TMap<FString, FPrefetchedSlot> Prefetched;
+
+    // Incremented by every OnLogin() and Clear(), a prefetch only keeps its downloads if it's still the latest
+    uint32 CurrentGeneration = 0;
+};
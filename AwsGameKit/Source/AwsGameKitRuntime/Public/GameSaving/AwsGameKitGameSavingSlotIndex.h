@@ -0,0 +1,104 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Runtime index of the cached Game Saving slots and their sync statuses.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Keeps the latest view of the cached slots, so that menus can read them synchronously instead of calling GetAllSlotSyncStatuses() every time they open.
+ *
+ * @details Every AwsGameKitGameSaving and UAwsGameKitGameSavingFunctionLibrary call which returns the cached slots updates the index: GetAllSlotSyncStatuses(),
+ * GetSlotSyncStatus(), SaveSlot(), LoadSlot(), DeleteSlot() and their batch variants.
+ *
+ * Set the GameKit.GameSaving.SlotIndex.RefreshSeconds console variable to refresh the index in the background. Once the index has been populated
+ * by a first GetAllSlotSyncStatuses() call, it then calls GetAllSlotSyncStatuses() on the worker pool at that interval, which updates every slot's
+ * cloud attributes. Disabled by default.
+ *
+ * The delegate set with SetSyncStatusChangeDelegate() is called on the game thread only when a slot's SlotSyncStatus changes, a slot is added, or
+ * a slot leaves the cached slots. A slot which left is reported once with SlotSyncStatus UNKNOWN.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingSlotIndex
+{
+public:
+    typedef TAwsGameKitDelegate<const FGameSavingSlot&> FSyncStatusChangeDelegate;
+
+    /**
+     * @brief Get the process-wide slot index.
+     */
+    static FAwsGameKitGameSavingSlotIndex& Get();
+
+    /**
+     * @brief Register the background refresh timer with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the background refresh timer and clear the index. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Replace the index with the cached slots returned by a Game Saving call.
+     */
+    void Update(const TArray<FGameSavingSlot>& CachedSlots);
+
+    /**
+     * @brief Replace the index with the plain C++ cached slots passed to a Game Saving callback.
+     *
+     * @details Only the slots whose attributes changed are converted, the others keep their indexed copy, so a callback which acted on
+     * one slot doesn't convert every cached slot's strings again.
+     */
+    void Update(const Slot* CachedSlots, unsigned int SlotCount);
+
+    /**
+     * @brief Whether the index has been updated since it was last cleared.
+     */
+    bool IsPopulated() const;
+
+    /**
+     * @brief Get every indexed slot, sorted by slot name.
+     */
+    TArray<FGameSavingSlot> GetSlots() const;
+
+    /**
+     * @brief Get one indexed slot.
+     *
+     * @return False if the slot isn't indexed.
+     */
+    bool GetSlot(const FString& SlotName, FGameSavingSlot& OutSlot) const;
+
+    /**
+     * @brief Set the delegate called on the game thread when a slot's sync status changes. Pass an unbound delegate to clear it.
+     */
+    void SetSyncStatusChangeDelegate(const FSyncStatusChangeDelegate& Delegate);
+
+    /**
+     * @brief Forget the indexed slots, for example when the player logs out.
+     */
+    void Clear();
+
+private:
+    bool Tick(float DeltaTime);
+
+    mutable FCriticalSection Mutex;
+    TMap<FString, FGameSavingSlot> Slots;
+    bool bPopulated = false;
+    bool bRefreshInFlight = false;
+    double NextRefreshAt = 0.0;
+    FSyncStatusChangeDelegate SyncStatusChangeDelegate;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,149 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in scheduling of Game Saving uploads and downloads, with priorities and a bandwidth cap.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "Models/AwsGameKitGameSavingModels.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Priority of a transfer queued with FAwsGameKitGameSavingTransferScheduler.
+ */
+enum class EAwsGameKitGameSavingTransferPriority : uint8
+{
+    // The player is waiting on it, for example a load from the main menu. Started before background transfers, even while paused.
+    Foreground,
+
+    // Backups which may wait, for example autosaves.
+    Background
+};
+
+/**
+ * @brief Queues SaveSlot() and LoadSlot() transfers so they don't compete with gameplay traffic.
+ *
+ * @details Disabled by default. Set the GameKit.GameSaving.Scheduler.Enabled console variable to 1 to enable it. AwsGameKitGameSaving::SaveSlot()
+ * then queues uploads with Background priority, and LoadSlot() queues downloads with Foreground priority. EnqueueSave() and EnqueueLoad() choose the priority.
+ *
+ * At most GameKit.GameSaving.Scheduler.MaxConcurrent transfers run at the same time, foreground ones first, and in queue order for the same priority.
+ * Transfers of the same slot always run one after the other, in queue order.
+ *
+ * GameKit.GameSaving.Scheduler.MaxBytesPerSecond caps the average bandwidth. Each transfer is still sent at full speed by the Game Saving library,
+ * the scheduler holds back the next background transfer until the bytes already sent fit within the cap. Foreground transfers aren't held back
+ * but count against the cap.
+ *
+ * Call Pause() during latency sensitive phases such as matches: background transfers are then held until every Pause() has been matched by a Resume().
+ * Background transfers which FAwsGameKitNetworkPolicy defers on a metered link are held until the device is on an unmetered one; later background
+ * transfers of other slots may start before them.
+ *
+ * An upload queued for a slot whose last waiting transfer is an upload replaces it, so only the newest save file is sent. The ResultDelegate of
+ * every replaced upload is called with the result of the upload which was sent. An upload queued after a download of the same slot waits for it.
+ *
+ * When the runtime module shuts down, the waiting uploads are sent on the work threads for at most GameKit.Lifecycle.ShutdownDrainBudgetMs,
+ * unless FAwsGameKitLifecycle::HasShutdownDeadlinePassed(). Waiting downloads, and uploads which couldn't be sent in time, are dropped and their
+ * delegates are called with GAMEKIT_ERROR_GENERAL. Background transfers are paused while the app is in the background, see FAwsGameKitLifecycle.
+ * All methods are thread safe, and the delegates are called on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitGameSavingTransferScheduler
+{
+public:
+    typedef TAwsGameKitDelegate<const IntResult&, const FGameSavingSlotActionResults&> FSaveResultDelegate;
+    typedef TAwsGameKitDelegate<const IntResult&, const FGameSavingDataResults&> FLoadResultDelegate;
+
+    /**
+     * @brief Get the process-wide transfer scheduler.
+     */
+    static FAwsGameKitGameSavingTransferScheduler& Get();
+
+    /**
+     * @brief Whether SaveSlot() and LoadSlot() go through the scheduler (GameKit.GameSaving.Scheduler.Enabled).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Register the scheduling timer with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Send the waiting uploads, drop the waiting downloads and unregister the scheduling timer.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     * Waits at most GameKit.Lifecycle.ShutdownDrainBudgetMs for the uploads and the transfers already running.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Queue an upload. See AwsGameKitGameSaving::SaveSlot() for the request and the status codes.
+     */
+    void EnqueueSave(FGameSavingSaveSlotRequest&& Request, EAwsGameKitGameSavingTransferPriority Priority, const FSaveResultDelegate& ResultDelegate);
+
+    /**
+     * @brief Queue a download. See AwsGameKitGameSaving::LoadSlot() for the request and the status codes.
+     */
+    void EnqueueLoad(FGameSavingLoadSlotRequest&& Request, EAwsGameKitGameSavingTransferPriority Priority, const FLoadResultDelegate& ResultDelegate);
+
+    /**
+     * @brief Hold background transfers until Resume() is called as many times. Transfers already running aren't interrupted.
+     */
+    void Pause();
+
+    /**
+     * @brief Undo one Pause().
+     */
+    void Resume();
+
+    /**
+     * @brief Whether background transfers are held by Pause().
+     */
+    bool IsPaused() const;
+
+    /**
+     * @brief Number of transfers which are queued and haven't started yet.
+     */
+    int32 GetNumPending() const;
+
+private:
+    struct FPendingTransfer
+    {
+        EAwsGameKitGameSavingTransferPriority Priority = EAwsGameKitGameSavingTransferPriority::Background;
+        int64 Bytes = 0;
+        bool bIsSave = false;
+        FGameSavingSaveSlotRequest SaveRequest;
+        FGameSavingLoadSlotRequest LoadRequest;
+        TArray<FSaveResultDelegate> SaveResultDelegates;
+        FLoadResultDelegate LoadResultDelegate;
+
+        const FString& GetSlotName() const
+        {
+            return bIsSave ? SaveRequest.SlotName : LoadRequest.SlotName;
+        }
+    };
+
+    bool Tick(float DeltaTime);
+    void Add(FPendingTransfer&& Transfer);
+
+    // Called with Mutex held, before Run()
+    void MarkInFlight(const FPendingTransfer& Transfer);
+    void Run(FPendingTransfer&& Transfer);
+
+    mutable FCriticalSection Mutex;
+
+    // In queue order
+    TArray<FPendingTransfer> Pending;
+    // Number of running transfers of each slot
+    TMap<FString, int32> InFlightSlots;
+    int32 NumInFlight = 0;
+    int32 PauseCount = 0;
+    double BandwidthBudget = 0.0;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
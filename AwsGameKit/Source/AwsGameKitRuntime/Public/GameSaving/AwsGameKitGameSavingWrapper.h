@@ -16,7 +16,7 @@
 #include <AwsGameKitCore/Public/Core/AwsGameKitDispatcher.h>
 
 // GameKit
-#if !PLATFORM_WINDOWS
+#if !PLATFORM_WINDOWS || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/game-saving/exports.h>
 #endif
 #include <aws/gamekit/game-saving/gamekit_game_saving_models.h>
@@ -97,7 +97,7 @@ typedef unsigned int(*FileGetSizeCallback)(DISPATCH_RECEIVER_HANDLE dispatchRece
  * @brief This class provides the default file I/O methods used by the Game Saving library.
  *
  * @details It uses Unreal-provided file I/O methods and may not work on all platforms.
- * Specifically, it uses the Unreal FFileHelper and IFileManager classes.
+ * Specifically, it uses the Unreal IPlatformFile and IFileManager classes.
  * You can call AwsGameKitGameSaving::SetFileActions() to provide your own file I/O methods which support the necessary platform(s).
  */
 class DefaultFileActions : public FileActions
@@ -109,24 +109,26 @@ private:
     /**
      * @brief Save a byte array to a file, overwriting the file if it already exists.
      *
-     * @details Uses the Unreal FFileHelper::SaveArrayToFile() method.
+     * @details Writes straight from `data` through an Unreal IFileHandle, in chunks of at most 4 MB, without copying the data first.
      *
      * @param filePath The absolute or relative path of the file to write to.
      * @param data The data to write to the file.
+     * @param size The length of the `data` array.
      * @return True if the data was successfully written to the file, false otherwise.
      */
-    static bool writeDesktopFile(const FString& filePath, const TArray<uint8>& data);
+    static bool writeDesktopFile(const FString& filePath, const uint8* data, int64 size);
 
     /**
-     * @brief Load a file into a byte array, resizing the array as needed, with two uninitialized bytes at the end as padding.
+     * @brief Load a file into a pre-allocated byte array.
      *
-     * @details Uses the Unreal FFileHelper::LoadFileToArray() method.
+     * @details Reads straight into `data` through an Unreal IFileHandle, in chunks of at most 4 MB, without an intermediate buffer.
      *
      * @param filePath The absolute or relative path of the file to read from.
-     * @param data The array to store the data in. The array will be re-sized to hold the contents of the file, plus will have two uninitialized bytes at the end as padding.
+     * @param data The array to store the data in.
+     * @param size The length of the `data` array. The read fails if the file is larger.
      * @return True if the data was successfully read from the file, false otherwise.
      */
-    static bool readDesktopFile(const FString& filePath, TArray<uint8>& data);
+    static bool readDesktopFile(const FString& filePath, uint8* data, int64 size);
 
     /**
      * @brief Return the size of the file in bytes, or 0 if the file does not exist.
@@ -192,51 +194,51 @@ private:
     virtual void importFunctions(void* loadedDllHandle) override;
 
 public:
-    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE GameKitGameSavingInstanceCreateWithSessionManager(
+    virtual GAMEKIT_GAME_SAVING_INSTANCE_HANDLE GameKitGameSavingInstanceCreateWithSessionManager(
         void* sessionManager,
         FuncLogCallback logCb,
         const char** localSlotInformationFilePaths,
         const unsigned int arraySize,
         const FileActions& fileActions);
 
-    void GameKitGameSavingInstanceRelease(
+    virtual void GameKitGameSavingInstanceRelease(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance);
 
-    void GameKitAddLocalSlots(
+    virtual void GameKitAddLocalSlots(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         const char** localSlotInformationFilePaths,
         const unsigned int arraySize);
 
-    void GameKitSetFileActions(
+    virtual void GameKitSetFileActions(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         const FileActions& fileActions);
 
-    unsigned int GameKitGetAllSlotSyncStatuses(
+    virtual unsigned int GameKitGetAllSlotSyncStatuses(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         DISPATCH_RECEIVER_HANDLE receiver,
         FuncGameSavingResponseCallback resultCb,
         bool waitForAllPages,
         unsigned int pageSize);
 
-    unsigned int GameKitGetSlotSyncStatus(
+    virtual unsigned int GameKitGetSlotSyncStatus(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         DISPATCH_RECEIVER_HANDLE receiver,
         FuncGameSavingSlotActionResponseCallback resultCb,
         const char* slotName);
 
-    unsigned int GameKitDeleteSlot(
+    virtual unsigned int GameKitDeleteSlot(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         DISPATCH_RECEIVER_HANDLE receiver,
         FuncGameSavingSlotActionResponseCallback resultCb,
         const char* slotName);
 
-    unsigned int GameKitSaveSlot(
+    virtual unsigned int GameKitSaveSlot(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         DISPATCH_RECEIVER_HANDLE receiver,
         FuncGameSavingSlotActionResponseCallback resultCb,
         GameSavingModel& model);
 
-    unsigned int GameKitLoadSlot(
+    virtual unsigned int GameKitLoadSlot(
         GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
         DISPATCH_RECEIVER_HANDLE receiver,
         FuncGameSavingDataResponseCallback resultCb,
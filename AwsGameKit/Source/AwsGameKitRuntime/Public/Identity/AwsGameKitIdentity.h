@@ -6,6 +6,7 @@
 // GameKit
 #include "AwsGameKitRuntime.h"
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitFutures.h"
 #include "Core/AwsGameKitErrors.h"
 #include "Identity/AwsGameKitIdentityWrapper.h"
 #include "Models/AwsGameKitIdentityModels.h"
@@ -153,6 +154,8 @@ public:
      * @details This method will timeout after the specified limit (FPollAndRetrieveFederatedTokensRequest::Timeout), in which case the player is not logged in.
      * You can call GetFederatedIdToken() to check if the login was successful.
      *
+     * @details Set GameKit.Identity.FederatedPoll.Adaptive to poll with a growing interval which restarts when the game regains focus, see FAwsGameKitIdentityFederatedPoller.
+     *
      * @param Request A struct containing all parameters required to call this method.
      * @param ResultDelegate The delegate to invoke when this method has completed. The delegate's **FederatedIdentityProvider_E parameter** specifies which
      * federated identity provider was polled. This is the same provider as given in the Request object's FPollAndRetrieveFederatedTokensRequest::IdentityProvider field.
@@ -208,6 +211,9 @@ public:
      * - The date time of the last time the player's identity information was modified.
      * - The player's GameKit ID.
      *
+     * The profile is cached until the player logs in or out or a token is set, and calls made while it's being fetched share that fetch.
+     * See FAwsGameKitIdentityUserCache.
+     *
      * @param ResultDelegate The delegate to invoke when this method has completed. The delegate's **FString parameter** is the player's user information represented as
      * a JSON string, or an empty string if the call failed. See above for details. The delegate's ::IntResult parameter is a GameKit status code and indicates
      * the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -217,4 +223,40 @@ public:
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The backend returned a malformed JSON payload. This should not happen. If it does, it indicates there is a bug in the backend code.
      */
     static void GetUser(TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> ResultDelegate);
+
+    /**
+     * @brief Awaitable versions of the methods above, with the same status codes.
+     *
+     * @details The futures are fulfilled on the GameKit worker thread which finished the call, so calls can be chained with TFuture::Next()
+     * without a hop through the game thread, and combined with AwsGameKitWhenAll(). See MakeAwsGameKitStatusFuture().
+     */
+    static TFuture<IntResult> RegisterAsync(const FUserRegistrationRequest& Request)
+    {
+        return MakeAwsGameKitStatusFuture([&Request](FAwsGameKitStatusDelegateParam Delegate) { Register(Request, Delegate); });
+    }
+
+    static TFuture<IntResult> ConfirmRegistrationAsync(const FConfirmRegistrationRequest& Request)
+    {
+        return MakeAwsGameKitStatusFuture([&Request](FAwsGameKitStatusDelegateParam Delegate) { ConfirmRegistration(Request, Delegate); });
+    }
+
+    static TFuture<IntResult> LoginAsync(const FUserLoginRequest& Request)
+    {
+        return MakeAwsGameKitStatusFuture([&Request](FAwsGameKitStatusDelegateParam Delegate) { Login(Request, Delegate); });
+    }
+
+    static TFuture<IntResult> LogoutAsync()
+    {
+        return MakeAwsGameKitStatusFuture([](FAwsGameKitStatusDelegateParam Delegate) { Logout(Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FString>> GetFederatedIdTokenAsync(FederatedIdentityProvider_E IdentityProvider)
+    {
+        return MakeAwsGameKitResultFuture<FString>([IdentityProvider](TAwsGameKitDelegateParam<const IntResult&, const FString&> Delegate) { GetFederatedIdToken(IdentityProvider, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FGetUserResponse>> GetUserAsync()
+    {
+        return MakeAwsGameKitResultFuture<FGetUserResponse>([](TAwsGameKitDelegateParam<const IntResult&, const FGetUserResponse&> Delegate) { GetUser(Delegate); });
+    }
 };
@@ -0,0 +1,77 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Adaptive polling for the completion of a federated login.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Models/AwsGameKitIdentityModels.h"
+
+// Unreal
+#include "Containers/Ticker.h"
+#include "Delegates/IDelegateInstance.h"
+
+// Standard library
+#include <atomic>
+
+/**
+ * @brief Polls for the completion of the federated login started with AwsGameKitIdentity::GetFederatedLoginUrl() on behalf of PollAndRetrieveFederatedTokens().
+ *
+ * @details Disabled by default: PollAndRetrieveFederatedTokens() then polls on the native library's fixed schedule for the whole FPollAndRetrieveFederatedTokensRequest::Timeout.
+ *
+ * When GameKit.Identity.FederatedPoll.Adaptive is set, the backend is polled in short one second attempts instead. The first retry comes after
+ * GameKit.Identity.FederatedPoll.InitialIntervalSeconds, and the interval grows by GameKit.Identity.FederatedPoll.BackoffFactor up to
+ * GameKit.Identity.FederatedPoll.MaxIntervalSeconds while the player is in the browser. When the game regains focus, which is usually when the player
+ * has just finished signing in, the pending retry happens straight away and the interval starts over. Polling still stops after the request's Timeout.
+ *
+ * All methods are thread safe, except Startup() and Shutdown() which are called on the game thread.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitIdentityFederatedPoller
+{
+public:
+    /**
+     * @brief Get the process-wide poller.
+     */
+    static FAwsGameKitIdentityFederatedPoller& Get();
+
+    /**
+     * @brief Register the focus checks. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the focus checks and wake up the polls in progress. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Poll until the federated login completes, fails or times out. Blocks, called by PollAndRetrieveFederatedTokens() on its worker thread.
+     *
+     * @return The result of the last poll.
+     */
+    IntResult Poll(const FPollAndRetrieveFederatedTokensRequest& Request);
+
+    /**
+     * @brief Retry the polls in progress now and restart their backoff. Called when the game regains focus.
+     */
+    void OnFocusRegained();
+
+private:
+    static IntResult PollOnce(const FPollAndRetrieveFederatedTokensRequest& Request, int Timeout);
+    bool Tick(float DeltaTime);
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle ReactivatedHandle;
+    FDelegateHandle EnteredForegroundHandle;
+    bool bWasActive = true;
+
+    // Incremented by every OnFocusRegained(), a poll waiting for its next attempt retries as soon as it changes
+    std::atomic<uint32> FocusGeneration{ 0 };
+    std::atomic<int32> PollsInProgress{ 0 };
+    std::atomic<bool> bIsShuttingDown{ false };
+};
@@ -152,6 +152,8 @@ public:
      * This method will timeout after the specified limit (FPollAndRetrieveFederatedTokensRequest::Timeout), in which case the player is not logged in.
      * You can call GetFederatedIdToken() to check if the login was successful.
      *
+     * Set GameKit.Identity.FederatedPoll.Adaptive to poll with a growing interval which restarts when the game regains focus.
+     *
      * @param Request A struct containing all parameters required to call this method.
      * @param Results The federated identity provider that was polled. This is the same provider that was given as an input parameter.
      * @param Error A GameKit status code indicating the reason the API call failed. Status codes are defined in errors.h. This method's possible status codes are listed below:
@@ -227,6 +229,8 @@ public:
      * - The date time of the last time the player's identity information was modified.
      * - The player's GameKit ID.
      *
+     * The profile is cached until the player logs in or out or a token is set, and calls made while it's being fetched share that fetch.
+     *
      * @param Results The player's user information represented as a JSON string, or an empty string if the call failed. See this function's tooltip for details on the JSON string.
      * @param Error A GameKit status code indicating the reason the API call failed. Status codes are defined in errors.h. This method's possible status codes are listed below:
      * - GAMEKIT_SUCCESS: The API call was successful.
@@ -0,0 +1,79 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Per-session cache of the player profile returned by AwsGameKitIdentity::GetUser().
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+#include "Core/AwsGameKitErrors.h"
+#include "Models/AwsGameKitIdentityModels.h"
+
+// Unreal
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+class FEvent;
+
+/**
+ * @brief Caches the logged in player's profile, so that only the first AwsGameKitIdentity::GetUser() of a session calls the backend.
+ *
+ * @details Enabled by default, turn it off with the GameKit.Identity.CacheUser console variable.
+ *
+ * GetUser() calls made while the profile is being fetched wait for that fetch instead of starting their own, and all get its result.
+ * Failed fetches aren't cached, the next GetUser() tries again.
+ *
+ * The profile is dropped when a player logs in or out, and whenever a token is set with AwsGameKitSessionManager::SetToken(), which includes the
+ * refreshes made by FAwsGameKitSessionTokenRefresher. A fetch still in progress then isn't cached.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitIdentityUserCache
+{
+public:
+    /**
+     * @brief Get the process-wide profile cache.
+     */
+    static FAwsGameKitIdentityUserCache& Get();
+
+    /**
+     * @brief Get the player's profile, from the cache or from the backend. Blocks, called by GetUser() on its worker thread.
+     *
+     * @return The status code of the backend call, GAMEKIT_SUCCESS if the profile was cached.
+     */
+    IntResult GetUser(FGetUserResponse& OutResponse);
+
+    /**
+     * @brief Drop the cached profile, for example when the player logs in or out.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Incremented by every Invalidate(): the logged in player may have changed since a GetUser() made with another generation.
+     */
+    uint32 GetGeneration();
+
+private:
+    struct FFetch
+    {
+        FFetch();
+        ~FFetch();
+
+        FEvent* Done;
+        IntResult Result;
+        FGetUserResponse Response;
+    };
+
+    static IntResult Fetch(FGetUserResponse& OutResponse);
+
+    FCriticalSection Mutex;
+    bool bIsCached = false;
+    FGetUserResponse Cached;
+    TSharedPtr<FFetch, ESPMode::ThreadSafe> InFlight;
+
+    // Incremented by every Invalidate(), a fetch is only cached if it's still the latest
+    uint32 CurrentGeneration = 0;
+};
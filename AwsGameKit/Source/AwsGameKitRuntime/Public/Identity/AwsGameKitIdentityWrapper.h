@@ -15,7 +15,7 @@
 #include <AwsGameKitCore/Public/Core/AwsGameKitDispatcher.h>
 
 // GameKit
-#if PLATFORM_IOS || PLATFORM_ANDROID
+#if PLATFORM_IOS || PLATFORM_ANDROID || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/identity/exports.h>
 #endif
 #include <aws/gamekit/core/enums.h>
@@ -81,7 +81,7 @@ public:
     AwsGameKitIdentityWrapper() {};
     virtual ~AwsGameKitIdentityWrapper();
 
-    GAMEKIT_IDENTITY_INSTANCE_HANDLE GameKitIdentityInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb);
+    virtual GAMEKIT_IDENTITY_INSTANCE_HANDLE GameKitIdentityInstanceCreateWithSessionManager(void* sessionManager, FuncLogCallback logCb);
     virtual void GameKitIdentityInstanceRelease(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance);
     virtual unsigned int GameKitIdentityRegister(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, UserRegistration userRegistration);
     virtual unsigned int GameKitIdentityConfirmRegistration(GAMEKIT_IDENTITY_INSTANCE_HANDLE identityInstance, ConfirmRegistrationRequest request);
@@ -115,6 +115,13 @@ struct FAchievement
     */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Achievement")
     FString UpdatedAt;
+
+    /**
+     * Timestamp of when the achievement's definition (title, descriptions, icons, points, ...) was last changed by an admin.
+     * Only returned by ListAchievementsForPlayer(), empty for the achievements read from the client-side cache.
+    */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Achievement")
+    FString DefinitionUpdatedAt;
 };
 
 USTRUCT(BlueprintType)
@@ -124,6 +131,7 @@ struct FListAchievementsRequest
 public:
     /**
      * The number achievements each page should contain when listing.
+     * With GameKit.Pagination.Adaptive, only the first call uses it, see FAwsGameKitAdaptivePageSize.
     */
     UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievements")
     int32 PageSize;
@@ -133,6 +141,13 @@ public:
     */
     UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievements")
     bool WaitForAllPages;
+
+    /**
+     * Optional ISO 8601 timestamp. When set, only the achievements updated after it are returned, and they are merged into the cached achievements instead of replacing them.
+     * Leave empty to list every achievement.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievements")
+    FString UpdatedSince;
 };
 
 USTRUCT(BlueprintType)
@@ -165,6 +180,81 @@ struct FGetAchievementRequest
     FString AchievementId;
 };
 
+USTRUCT(BlueprintType)
+struct FAchievementSummary
+{
+    GENERATED_BODY()
+
+    /**
+     * How many achievements the current user has earned.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 EarnedCount = 0;
+
+    /**
+     * The sum of the points of the achievements the current user has earned.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 EarnedPoints = 0;
+
+    /**
+     * How many non-hidden achievements there are, secret achievements included.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 TotalCount = 0;
+
+    /**
+     * The sum of the points of all the non-hidden achievements, secret achievements included.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 TotalPoints = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FAchievementStat
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    FString AchievementId;
+
+    /**
+     * How many players have earned the achievement.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 EarnedCount = 0;
+
+    /**
+     * The percentage of the players with at least one earned achievement who have earned this one, from 0 to 100.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    float EarnedPercent = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FAchievementStats
+{
+    GENERATED_BODY()
+
+    /**
+     * When the backend added up the stats, as an ISO 8601 timestamp.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    FString UpdatedAt;
+
+    /**
+     * How many players have earned at least one achievement.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    int32 PlayerCount = 0;
+
+    /**
+     * The stats of every non-hidden achievement, sorted by achievement ID.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | Achievement")
+    TArray<FAchievementStat> Achievements;
+};
+
 class AWSGAMEKITRUNTIME_API AwsGamekitAchievementsResponseProcessor
 {
 public:
@@ -205,6 +295,7 @@ public:
         SetStringField(achievementData, achievement.LockedIcon, "locked_icon_url");
         SetStringField(achievementData, achievement.UnlockedIcon, "unlocked_icon_url");
         SetStringField(achievementData, achievement.UpdatedAt, "updated_at");
+        SetStringField(achievementData, achievement.DefinitionUpdatedAt, "definition_updated_at");
         SetStringField(achievementData, achievement.EarnedAt, "earned_at");
 
         SetNumberField(achievementData, achievement.RequiredAmount, "max_value");
@@ -238,6 +329,30 @@ public:
         }
     }
 
+    /**
+     * @brief Decode one achievement straight from the UTF-8 response of the GetAchievement() and UpdateAchievement() APIs.
+     *
+     * @details Same result as GetAchievementFromJsonResponse(UnpackResponseAsJson(response)) without converting the response to
+     * an FString or building an FJsonObject.
+     *
+     * @param output Achievement to populate.
+     * @param response UTF-8 Json response as received by the dispatcher.
+     * @return False if the response is malformed.
+    */
+    static bool DecodeAchievementFromResponse(FAchievement& output, const char* response);
+
+    /**
+     * @brief Streaming version of GetListOfAchievementsFromResponse() which decodes a UTF-8 page directly into output.
+     *
+     * @details Achievements are appended in place; Reserve() the expected page size on output beforehand to avoid reallocations.
+     * Use the GameKit.Achievements.BenchmarkDecode console command to compare both paths.
+     *
+     * @param output Where the FAchievement objects will be appended. Left unchanged if the page is malformed.
+     * @param response UTF-8 Json response as received by the ListAchievementsForPlayer() dispatcher.
+     * @return False if the response is malformed.
+    */
+    static bool DecodeListOfAchievementsFromResponse(TArray<FAchievement>& output, const char* response);
+
     static void SetStringField(const TSharedPtr<FJsonObject>& data, FString& field, const FString& key)
     {
         data->TryGetStringField(key, field);
@@ -46,3 +46,42 @@ enum class TokenType_E : uint8
     IdToken = 2 UMETA(DisplayName = "IdToken"),
     IamSessionToken = 3 UMETA(DisplayName = "IamSessionToken")
 };
+
+/**
+ * @brief Client-observed latency distribution of one GameKit operation on one network type, see FAwsGameKitLatencyHistograms.
+ */
+USTRUCT(BlueprintType)
+struct AWSGAMEKITRUNTIME_API FAwsGameKitLatencySnapshot
+{
+    GENERATED_USTRUCT_BODY()
+public:
+    /**
+     * The GameKit C API function (for example GameKitSaveSlot), or the Blueprint latent action as Feature.Operation (for example GameSaving.SaveSlot).
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    FString Operation;
+
+    /**
+     * The network connection type when the calls were made: Unknown, None, AirplaneMode, Cell, WiFi, WiMAX, Bluetooth or Ethernet.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    FString NetworkType;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    int64 Count = 0;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    float MeanMs = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    float P50Ms = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    float P90Ms = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    float P99Ms = 0.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AWS GameKit | Core | Latency")
+    float MaxMs = 0.0f;
+};
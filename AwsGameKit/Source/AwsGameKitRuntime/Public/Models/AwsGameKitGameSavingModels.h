@@ -6,6 +6,9 @@
 //#include "AwsGameKitCommonModels.h"
 #include "GameSaving/AwsGameKitGameSavingWrapper.h"
 
+// Unreal
+#include "Templates/UniquePtr.h"
+
 #include "AwsGameKitGameSavingModels.generated.h"  // Last include (Unreal requirement)
 
 /**
@@ -154,6 +157,7 @@ struct FGameSavingSlot
     static TArray<FGameSavingSlot> ToArray(const Slot* cachedSlots, unsigned int slotCount)
     {
         TArray<FGameSavingSlot> slots;
+        slots.Reserve(slotCount);
         for (unsigned int i = 0; i < slotCount; ++i)
         {
             slots.Add(FGameSavingSlot::From(cachedSlots[i]));
@@ -199,7 +203,7 @@ struct FGameSavingSlotActionResults
     GENERATED_BODY()
 
     /**
-     * A copy of the current set of cached slots.
+     * A copy of the current set of cached slots. Empty when the GameKit.GameSaving.ResultSlots console variable is 1.
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving")
     FGameSavingSlots Slots;
@@ -232,7 +236,7 @@ struct FGameSavingDataResults
     GENERATED_BODY()
 
     /**
-     * A copy of the current set of cached slots.
+     * A copy of the current set of cached slots. Empty when the GameKit.GameSaving.ResultSlots console variable is 1.
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
     FGameSavingSlots Slots;
@@ -246,10 +250,18 @@ struct FGameSavingDataResults
 
     /**
      * If the API call was successful, then this contains an array of unsigned bytes containing the downloaded save file. Otherwise it is empty.
+     *
+     * Always empty when the request had a SaveFilePath, the save file was then written to SaveFilePath instead.
      */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
     TArray<uint8> Data;
 
+    /**
+     * If the API call was successful and the request had a FGameSavingLoadSlotRequest::SaveFilePath, the path the downloaded save file was written to. Otherwise it is empty.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
+    FString SaveFilePath;
+
     /**
      * A GameKit status code which indicates the result of the Game Saving API call.
      *
@@ -345,6 +357,15 @@ struct FGameSavingSaveSlotRequest
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving  | SaveSlot")
     TArray<uint8> Data;
 
+    /**
+     * (Optional) The absolute path and filename of a save file on the device to upload instead of Data. Data is ignored when this is set.
+     *
+     * The file is memory-mapped where the platform supports it, so it is hashed and uploaded straight from the mapping without being loaded into memory first.
+     * Otherwise it is read in chunks into a single buffer. Use this for large save files which are already on the device.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | SaveSlot")
+    FString SaveFilePath;
+
     /**
      * (Optional) An arbitrary string you want to associate with the save file.
      *
@@ -378,9 +399,9 @@ struct FGameSavingSaveSlotRequest
      */
     operator FString() const
     {
-        const FString formatString = FString(TEXT("FGameSavingSaveSlotRequest(SlotName={0}, SaveInfoFilePath={1}, Data=<bytes>, Metadata={2}, EpochTime={3}, OverrideSync={4})"));
+        const FString formatString = FString(TEXT("FGameSavingSaveSlotRequest(SlotName={0}, SaveInfoFilePath={1}, Data=<bytes>, SaveFilePath={2}, Metadata={3}, EpochTime={4}, OverrideSync={5})"));
         const FString overrideSyncString = OverrideSync ? "true" : "false";
-        return FString::Format(*formatString, { SlotName, SaveInfoFilePath, Metadata, EpochTime, overrideSyncString });
+        return FString::Format(*formatString, { SlotName, SaveInfoFilePath, SaveFilePath, Metadata, EpochTime, overrideSyncString });
     }
 };
 
@@ -409,7 +430,12 @@ struct FGameSavingLoadSlotRequest
     FString SaveInfoFilePath;
 
     /**
-     * An array of unsigned bytes large enough to contain the save file after downloading from the cloud.
+     * (Optional) An array of unsigned bytes large enough to contain the save file after downloading from the cloud.
+     *
+     * Leave it empty to have LoadSlot() size the download from the slot's FGameSavingSlot::SizeCloud in the cached slots (see FAwsGameKitGameSavingSlotIndex).
+     * LoadSlot() then gets the slot's size with GetSlotSyncStatus() itself when the slot isn't cached yet, or when the cloud save grew since it was cached,
+     * and the downloaded save file is moved into FGameSavingDataResults::Data without a copy unless it was compressed.
+     * Only the size of a non-empty Data is used, LoadSlot() doesn't copy its contents, and it fails with GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL as before.
      *
      * We recommend determining how many bytes are needed by caching the FGameSavingSlots object
      * from the most recent Game Saving API call before calling LoadSlot(). From this cached object, you
@@ -427,6 +453,16 @@ struct FGameSavingLoadSlotRequest
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
     TArray<uint8> Data;
 
+    /**
+     * (Optional) The absolute path and filename to write the downloaded save file to, instead of returning it in FGameSavingDataResults::Data.
+     *
+     * The save file is written in chunks to a temporary file next to it, which then replaces SaveFilePath, so a failed download or write leaves the previous
+     * save file intact. Save files which were uploaded without compression are written straight from the download buffer, after their checksum is verified
+     * (see FAwsGameKitGameSavingCompression and FAwsGameKitGameSavingChecksum), so the save file is held in memory once instead of twice.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Game Saving | LoadSlot")
+    FString SaveFilePath;
+
     /**
      * (Optional) If set to true, this method will ignore the SlotSyncStatus and override the cloud/local data.
      *
@@ -440,9 +476,9 @@ struct FGameSavingLoadSlotRequest
      */
     operator FString() const
     {
-        const FString formatString = FString(TEXT("FGameSavingLoadSlotRequest(SlotName={0}, SaveInfoFilePath={1}, Data=<bytes>, OverrideSync={3})"));
+        const FString formatString = FString(TEXT("FGameSavingLoadSlotRequest(SlotName={0}, SaveInfoFilePath={1}, Data=<bytes>, SaveFilePath={2}, OverrideSync={3})"));
         const FString overrideSyncString = OverrideSync ? "true" : "false";
-        return FString::Format(*formatString, { SlotName, SaveInfoFilePath, overrideSyncString });
+        return FString::Format(*formatString, { SlotName, SaveInfoFilePath, SaveFilePath, overrideSyncString });
     }
 };
 #pragma endregion
@@ -461,10 +497,16 @@ struct FGameSavingFileIOCallback
     FileSizeDispatcher FileSize;
 };
 
+class IMappedFileHandle;
+class IMappedFileRegion;
+
 /**
  * @brief Used for storing strings while they are being used by the Game Saving low level C API, preventing them from going out scope or being un/re-assigned.
+ *
+ * @details For SaveSlot, the data isn't copied: the model points at the request's Data, which must outlive the cache, or at the mapping of
+ * FGameSavingSaveSlotRequest::SaveFilePath. Check IsDataLoaded() before passing the model to the Game Saving library.
  */
-class ModelCache
+class AWSGAMEKITRUNTIME_API ModelCache
 {
 private:
     const std::string slotName;
@@ -473,22 +515,75 @@ private:
 
     const int64 epochTime = 0;
     const bool overrideSync = false;
-    const TArray<uint8> data;
+
+    // LoadSlot's destination buffer, which the Game Saving library writes to. Sized from the request's Data, or from the slot's SizeCloud in FAwsGameKitGameSavingSlotIndex.
+    TArray<uint8> data;
+
+    // SaveSlot's save file, when read from SaveFilePath on platforms which can't map files
+    TArray<uint8> streamedData;
+    TUniquePtr<IMappedFileHandle> mappedFile;
+    TUniquePtr<IMappedFileRegion> mappedRegion;
+
+    // SaveSlot's payload when it isn't the save file as is: compressed (see FAwsGameKitGameSavingCompression), copied to append the checksum (see FAwsGameKitGameSavingChecksum),
+    // or encrypted (see FAwsGameKitGameSavingEncryption)
+    TArray<uint8> payloadData;
+
+    // SaveSlot's content hash before compression, see FAwsGameKitGameSavingChangeTracker
+    FString contentHash;
+
+    const uint8* dataPtr = nullptr;
+    int64 dataSize = 0;
+    bool dataLoaded = true;
+
+    bool LoadSaveFile(const FString& filePath);
+    void PrepareSaveData();
+    void CompressSaveData();
+    void AppendChecksum(uint32 checksum);
+    void EncryptSaveData();
 
 public:
-    ModelCache(const FGameSavingSaveSlotRequest& request) :
-        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
-        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
-        metadata(TCHAR_TO_UTF8(ToCStr(request.Metadata))),
-        epochTime(request.EpochTime),
-        overrideSync(request.OverrideSync),
-        data(request.Data) {}
-
-    ModelCache(const FGameSavingLoadSlotRequest& request) :
-        slotName(TCHAR_TO_UTF8(ToCStr(request.SlotName))),
-        saveInfoFilePath(TCHAR_TO_UTF8(ToCStr(request.SaveInfoFilePath))),
-        overrideSync(request.OverrideSync),
-        data(request.Data) {}
+    ModelCache(const FGameSavingSaveSlotRequest& request);
+
+    /**
+     * @brief For SaveSlot, when FGameSavingSaveSlotRequest::SaveFilePath has already been read in the background by SaveSlots(). The data is moved into the cache.
+     */
+    ModelCache(const FGameSavingSaveSlotRequest& request, TArray<uint8>&& saveFileData);
+    ModelCache(const FGameSavingLoadSlotRequest& request);
+    ~ModelCache();
+
+    ModelCache(const ModelCache&) = delete;
+    ModelCache& operator=(const ModelCache&) = delete;
+
+    /**
+     * @brief False if FGameSavingSaveSlotRequest::SaveFilePath couldn't be read, or the save file couldn't be encrypted. The Game Saving call should then fail with GAMEKIT_ERROR_FILE_READ_FAILED.
+     */
+    bool IsDataLoaded() const
+    {
+        return dataLoaded;
+    }
+
+    /**
+     * @brief The save file's FAwsGameKitGameSavingChangeTracker::HashContent(), or empty if the change tracker is disabled.
+     */
+    const FString& GetContentHash() const
+    {
+        return contentHash;
+    }
+
+    /**
+     * @brief For LoadSlot, move the first payloadSize bytes of the destination buffer into outData, when the Game Saving library returned the payload in it.
+     *
+     * @return False if the payload isn't in the destination buffer, outData is left unchanged.
+     */
+    bool TakeLoadedData(const uint8* payload, int32 payloadSize, TArray<uint8>& outData);
+
+    /**
+     * @brief Size in bytes of the payload handed to the Game Saving library, after compression, the checksum trailer and encryption.
+     */
+    int64 GetDataSize() const
+    {
+        return dataSize;
+    }
 
     operator GameSavingModel() const
     {
@@ -498,8 +593,8 @@ public:
             metadata.c_str(),
             epochTime,
             overrideSync,
-            (uint8_t*)data.GetData(),
-            (unsigned int)data.Num(),
+            (uint8_t*)dataPtr,
+            (unsigned int)dataSize,
             saveInfoFilePath.c_str(),
         };
     }
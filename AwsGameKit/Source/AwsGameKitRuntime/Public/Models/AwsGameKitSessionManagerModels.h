@@ -23,3 +23,20 @@ struct FSetTokenRequest
     UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | SessionManager | Token")
     FString TokenValue;
 };
+
+/**
+ *@struct FAwsGameKitTransportSettings
+ *@brief Struct that stores the HTTP transport settings shared by all features, see AwsGameKitSessionManager::SetTransportSettings()
+ *
+ * The prebuilt GameKit libraries keep their own HTTP client, whose connection pool, keep-alive and protocol can't be configured from the plugin.
+ * These settings apply to the requests the plugin sends itself through the Unreal HTTP module.
+ */
+USTRUCT(BlueprintType)
+struct FAwsGameKitTransportSettings
+{
+    GENERATED_BODY()
+
+    // Timeout of the requests the plugin sends itself, such as achievement icon downloads. 0 uses the HTTP module's timeout
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | SessionManager | Transport")
+    float RequestTimeoutSeconds = 0.0f;
+};
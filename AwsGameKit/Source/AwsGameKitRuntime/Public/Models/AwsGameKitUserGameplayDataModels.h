@@ -11,6 +11,47 @@
 
 #include "AwsGameKitUserGameplayDataModels.generated.h"
 
+/**
+ * State of FAwsGameKitUserGameplayDataCircuitBreaker.
+ */
+UENUM(BlueprintType)
+enum class UserGameplayDataCircuitState_E : uint8
+{
+    /**
+     * Calls are sent.
+     */
+    Closed = 0 UMETA(DisplayName = "Closed"),
+
+    /**
+     * The backend kept failing, deferrable calls are held.
+     */
+    Open = 1 UMETA(DisplayName = "Open"),
+
+    /**
+     * A single probe call is in flight to find out whether the backend recovered.
+     */
+    HalfOpen = 2 UMETA(DisplayName = "Half Open")
+};
+
+/**
+ * How FAwsGameKitUserGameplayDataStructSerializer stores a struct in a bundle.
+ */
+UENUM(BlueprintType)
+enum class UserGameplayDataStructFormat_E : uint8
+{
+    /**
+     * One item per property, keyed by the property's name. Single properties can then be read and updated with the other bundle APIs,
+     * and only the properties which changed are written.
+     */
+    ItemPerProperty = 0 UMETA(DisplayName = "Item Per Property"),
+
+    /**
+     * A single item holding every property in Unreal's tagged property serialization, base64 encoded. Smallest for large structs,
+     * but the whole struct is written whenever one of its properties changes.
+     */
+    Binary = 1 UMETA(DisplayName = "Binary")
+};
+
 /**
  *@struct FUserGameplayDataBundleItem
  *@brief Struct that stores information needed to reference a single item contained in a bundle
@@ -78,6 +119,31 @@ struct FUserGameplayDataBundle
     TMap<FString, FString> BundleMap;
 };
 
+/**
+ *@struct FUserGameplayDataStreamBundleRequest
+ *@brief Struct that describes how a bundle is streamed by GetBundleStreamed()
+ */
+USTRUCT(BlueprintType)
+struct FUserGameplayDataStreamBundleRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | StreamBundleRequest")
+    FString BundleName;
+
+    /**
+     * The number of items passed to each partial result, the last one may have fewer.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | StreamBundleRequest")
+    int32 PageSize = 100;
+
+    /**
+     * Whether the final result should also contain every item of the bundle. Turn it off to only hold one page of items at a time.
+    */
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | StreamBundleRequest")
+    bool KeepAllItems = true;
+};
+
 /**
  *@struct FUserGameplayDataClientSettings
  *@brief Struct that stores the User Gameplay Data API Client settings
@@ -105,6 +171,46 @@ struct FUserGameplayDataClientSettings
     UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | Settings")
     int32 MaxExponentialRetryThreshold = 32;
 
+    // Items per GetBundle page. With GameKit.Pagination.Adaptive, only used until the first bundle is read, see FAwsGameKitAdaptivePageSize
     UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | Settings")
     int32 PaginationSize = 100;
+
+    // Maximum number of bundles FAwsGameKitUserGameplayDataWriteBehind writes at the same time, for example when draining after the network returns
+    UPROPERTY(BlueprintReadWrite, Category = "AWS GameKit | User Gameplay Data | Settings")
+    int32 DrainConcurrency = 4;
+};
+
+/**
+ *@struct FUserGameplayDataRetryQueueStats
+ *@brief Struct that stores a snapshot of the offline retry queue counters, see AwsGameKitUserGameplayDataStateHandler::GetRetryQueueStats()
+ *
+ * The retry queue lives in the GameKit library, so the queue depth is counted from the calls which were enqueued since the network was last reported healthy.
+ */
+USTRUCT(BlueprintType)
+struct FUserGameplayDataRetryQueueStats
+{
+    GENERATED_BODY()
+
+    // Number of calls enqueued since the network was last reported healthy
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    int32 QueuedCalls = 0;
+
+    // Size in bytes of the bundle names, keys and values of the queued calls
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    int64 QueuedBytes = 0;
+
+    // Time in seconds since the oldest queued call was enqueued, 0 when no call is queued
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    float OldestQueuedCallAgeSeconds = 0.0f;
+
+    // Number of calls enqueued since the game started
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    int32 TotalEnqueuedCalls = 0;
+
+    // Number of times the network was reported unhealthy since the game started, each of which starts the retries of the queued calls
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    int32 NetworkOutages = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AWS GameKit | User Gameplay Data | RetryQueueStats")
+    bool IsNetworkHealthy = true;
 };
\ No newline at end of file
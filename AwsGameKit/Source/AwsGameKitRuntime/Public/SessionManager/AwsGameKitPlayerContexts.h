@@ -0,0 +1,141 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Several authenticated players in one process, for dedicated servers and split-screen.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntime.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * @brief Identifies a player created with FAwsGameKitPlayerContexts::CreatePlayer(). The default handle is the process's own player.
+ */
+struct AWSGAMEKITRUNTIME_API FAwsGameKitPlayerHandle
+{
+    uint32 Id = 0;
+
+    bool IsValid() const
+    {
+        return Id != 0;
+    }
+
+    bool operator==(const FAwsGameKitPlayerHandle& Other) const
+    {
+        return Id == Other.Id;
+    }
+
+    bool operator!=(const FAwsGameKitPlayerHandle& Other) const
+    {
+        return Id != Other.Id;
+    }
+
+    friend uint32 GetTypeHash(const FAwsGameKitPlayerHandle& Handle)
+    {
+        return Handle.Id;
+    }
+};
+
+/**
+ * @brief Makes the GameKit calls started on this thread use a player's context while it's in scope.
+ *
+ * @details The feature APIs (AwsGameKitIdentity, AwsGameKitAchievements, AwsGameKitGameSaving, AwsGameKitUserGameplayData and AwsGameKitSessionManager)
+ * are the same for every player: wrap the calls made for a player in a scope and they use the player's own Session Manager and feature instances.
+ * The player is carried over to the work the calls dispatch on FAwsGameKitWorkerPool, so the scope only needs to cover the call itself:
+ *
+ *     {
+ *         FAwsGameKitPlayerScope PlayerScope(PlayerHandle);
+ *         AwsGameKitAchievements::GetAchievementForPlayer(Request, ResultDelegate);
+ *     }
+ *
+ * Scopes nest. A scope with the default handle goes back to the process's own player.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitPlayerScope
+{
+public:
+    explicit FAwsGameKitPlayerScope(FAwsGameKitPlayerHandle Player);
+    ~FAwsGameKitPlayerScope();
+
+    UE_NONCOPYABLE(FAwsGameKitPlayerScope);
+
+    /**
+     * @brief The player of the innermost scope on this thread, the default handle outside any scope.
+     */
+    static FAwsGameKitPlayerHandle GetCurrent();
+
+private:
+    FAwsGameKitPlayerHandle Previous;
+};
+
+/**
+ * @brief Creates and releases the contexts of the players served by this process, next to the process's own player.
+ *
+ * @details Each player gets its own Session Manager instance, loaded with the awsGameKitClientConfig.yml contents loaded by the module, with the
+ * settings the module adds on mobile platforms, so that players log in and hold their tokens independently. Tokens a player sets with
+ * AwsGameKitSessionManager::SetToken() are refreshed in the player's scope, see FAwsGameKitSessionTokenRefresher. The feature instances of a player
+ * are created on their first use, with the feature libraries loaded by the module. All players share the module's GameKit libraries, the worker pool, the completion queue and the transport settings of FAwsGameKitTransport.
+ *
+ * FAwsGameKitRuntimeModule's library getters return the libraries of the player of the current FAwsGameKitPlayerScope, which is how the feature APIs
+ * reach them. They return copies which hold a reference to the player's instances, so a call in flight keeps using them when the player is released.
+ *
+ * The client-side helpers which keep state between calls (the player profile and User Gameplay Data caches, the achievements coalescer,
+ * the User Gameplay Data write-behind and the save slot index) are process-wide and assume a single player.
+ * Turn them off with their console variables when several players share the process. The achievements cache shares the definitions and
+ * keeps the progress of each player.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitPlayerContexts
+{
+public:
+    /**
+     * @brief Get the process-wide player contexts.
+     */
+    static FAwsGameKitPlayerContexts& Get();
+
+    /**
+     * @brief Create the context of a new player.
+     *
+     * @return The player's handle, or the default handle if the Session Manager instance couldn't be created.
+     */
+    FAwsGameKitPlayerHandle CreatePlayer();
+
+    /**
+     * @brief Release the player's context. Its Session Manager and feature instances are released once no copy of its libraries is in use.
+     */
+    void ReleasePlayer(FAwsGameKitPlayerHandle Player);
+
+    /**
+     * @brief Number of players created and not released yet, the process's own player excluded.
+     */
+    int32 Num() const;
+
+    /**
+     * @brief Release all the players. Called by FAwsGameKitRuntimeModule::ShutdownModule() before the libraries are released.
+     */
+    void Shutdown();
+
+    // Copies of the libraries of a player, its feature instances are created on first use. Each copy keeps the player's instances alive.
+    // Return the module's own libraries for the default handle or a released player.
+    SessionManagerLibrary GetSessionManagerLibrary(FAwsGameKitPlayerHandle Player) const;
+    IdentityLibrary GetIdentityLibrary(FAwsGameKitPlayerHandle Player);
+    AchievementsLibrary GetAchievementsLibrary(FAwsGameKitPlayerHandle Player);
+    GameSavingLibrary GetGameSavingLibrary(FAwsGameKitPlayerHandle Player);
+    UserGameplayDataLibrary GetUserGameplayDataLibrary(FAwsGameKitPlayerHandle Player);
+
+private:
+    FAwsGameKitPlayerContexts() = default;
+
+    TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe> FindPlayer(FAwsGameKitPlayerHandle Player) const;
+
+    mutable FCriticalSection Mutex;
+    TMap<FAwsGameKitPlayerHandle, TSharedPtr<FAwsGameKitPlayerContext, ESPMode::ThreadSafe>> Players;
+    uint32 NextId = 1;
+};
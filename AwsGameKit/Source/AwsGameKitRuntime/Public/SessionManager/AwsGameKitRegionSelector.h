@@ -0,0 +1,174 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Selection of the lowest-latency regional deployment listed in awsGameKitClientConfig.yml.
+ */
+
+#pragma once
+
+// GameKit
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+#include "SessionManager/AwsGameKitSessionManagerWrapper.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "Delegates/Delegate.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Points the Session Manager at the regional deployment of the game with the lowest latency, when it's deployed to several AWS regions.
+ *
+ * @details Each time a feature is deployed, the AWS GameKit editor records its settings under the deployment's region and, once the features are deployed
+ * to more than one region, lists the settings of every region in awsGameKitClientConfig.yml as keys prefixed with the region, for example
+ * `eu-west-1.identity_api_gateway_base_url`. The other keys are those of the region deployed last, as before.
+ *
+ * When the config is loaded, the hosts of every region which has all the features' settings are probed in parallel with a HEAD request. A region is
+ * healthy if all its hosts answered with a status below 500, and its latency is that of its slowest host. The settings of the healthy region with the
+ * lowest latency are then loaded in place of the file's, through GameKitSessionManagerReloadConfigContents(), because the GameKit libraries take one
+ * endpoint per feature. The probes run again when the network comes back (see FAwsGameKitRuntimeModule::SetNetworkChangeDelegate()) and when the game
+ * returns to the foreground, where mobile devices change networks.
+ *
+ * Each regional deployment has its own player pool, and tokens are only accepted by the region which issued them. So the region is only switched while
+ * no player is logged in: a better region found during a session is used once every player of the process (see FAwsGameKitPlayerContexts) logged out
+ * or was released. Reloading the config keeps the region in use.
+ *
+ * Disabled with GameKit.SessionManager.RegionSelection=0. The probe timeout is GameKit.SessionManager.RegionProbeTimeoutSeconds. All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitRegionSelector
+{
+public:
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FOnRegionSelected, const FString& /* Region */, double /* LatencyMs */);
+
+    /**
+     * @brief Separates the region from the key in the regional settings of awsGameKitClientConfig.yml.
+     */
+    static const TCHAR* REGION_KEY_SEPARATOR;
+
+    /**
+     * @brief Get the process-wide region selector.
+     */
+    static FAwsGameKitRegionSelector& Get();
+
+    /**
+     * @brief Whether GameKit.SessionManager.RegionSelection is set.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Drop the probes in flight. Called by FAwsGameKitRuntimeModule::ShutdownModule().
+     */
+    void Shutdown();
+
+    /**
+     * @brief Load the settings of the region in use again, and probe the regions if they weren't probed for this config. Called after every ReloadConfig().
+     *
+     * @param SessionManagerWrapper The wrapper which loaded the config, kept to load the selected region's settings.
+     * @param SessionManagerInstance The instance the config was loaded into.
+     */
+    void OnConfigLoaded(AwsGameKitSessionManagerWrapper* SessionManagerWrapper, GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE SessionManagerInstance);
+
+    /**
+     * @brief Probe the regions of the loaded config again, without waiting for the probes. Does nothing if it lists fewer than two regions.
+     */
+    void Reevaluate();
+
+    /**
+     * @brief Probe the regions again when the connection comes back. Called by FAwsGameKitRuntimeModule::OnNetworkStatusChange().
+     */
+    void OnNetworkStatusChange(bool bIsConnectionOk);
+
+    /**
+     * @brief Keep the region in use until the player of the current FAwsGameKitPlayerScope logs out. Called by AwsGameKitIdentity and
+     * UAwsGameKitIdentityFunctionLibrary when a login succeeds.
+     */
+    void OnLogin();
+
+    /**
+     * @brief Mark the player of the current FAwsGameKitPlayerScope as logged out, and switch to the best region found during the session, if any, once
+     * no player is logged in. Called by the Logout() of AwsGameKitIdentity and UAwsGameKitIdentityFunctionLibrary.
+     */
+    void OnLogout();
+
+    /**
+     * @brief Like OnLogout(), for a player released without logging out. Called by FAwsGameKitPlayerContexts::ReleasePlayer().
+     */
+    void OnPlayerReleased(FAwsGameKitPlayerHandle Player);
+
+    /**
+     * @brief The region whose settings are loaded, empty if the config lists no regional deployments.
+     */
+    FString GetActiveRegion() const;
+
+    /**
+     * @brief Broadcast on the game thread after every evaluation which found a healthy region, with the region and its latency. The region may only be
+     * switched to once the player logs out, see GetActiveRegion().
+     */
+    FOnRegionSelected& OnRegionSelected() { return RegionSelectedDelegate; }
+
+    /**
+     * @brief Parse the flat `key: value` lines of awsGameKitClientConfig.yml. Values are kept as written, quotes included.
+     *
+     * @param OutSettings Receives the keys without a region.
+     * @param OutRegionalSettings Receives the settings of each region, by region and key without the region.
+     */
+    static void ParseClientConfig(const FString& ClientConfigContents, TMap<FString, FString>& OutSettings, TMap<FString, TMap<FString, FString>>& OutRegionalSettings);
+
+    /**
+     * @brief The regions which have a setting for every key any region has, sorted. Only these can be switched to.
+     */
+    static TArray<FString> GetCandidateRegions(const FString& ClientConfigContents);
+
+    /**
+     * @brief Replace the settings of awsGameKitClientConfig.yml with those of a region, keeping the regional settings. Empty if the region isn't listed.
+     */
+    static FString MakeRegionalClientConfig(const FString& ClientConfigContents, const FString& Region);
+
+    /**
+     * @brief Replace the regional settings of awsGameKitClientConfig.yml. Used by the AWS GameKit editor after each deployment.
+     *
+     * @param RegionalSettings The settings of each region, by region and key. Pass an empty map to remove the regional settings.
+     */
+    static FString SetRegionalSettings(const FString& ClientConfigContents, const TMap<FString, TMap<FString, FString>>& RegionalSettings);
+
+private:
+    FAwsGameKitRegionSelector() = default;
+
+    struct FProbes;
+
+    void StartProbes(const FString& ClientConfigContents);
+    void OnProbesComplete(const FProbes& Probes);
+    void ApplyRegion(const FString& Region);
+    void OnEnteredForeground();
+    void RemoveLoggedInPlayer(FAwsGameKitPlayerHandle Player);
+
+    mutable FCriticalSection Mutex;
+
+    AwsGameKitSessionManagerWrapper* Wrapper = nullptr;
+    GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE Instance = nullptr;
+
+    // The region whose settings are loaded, and the better one found during a session
+    FString ActiveRegion;
+    FString PendingRegion;
+
+    // Regions of the config last probed, the probes run again when they change
+    TArray<FString> ProbedRegions;
+
+    // Incremented by every evaluation and by Shutdown(), only the latest evaluation's probes are used
+    uint32 CurrentGeneration = 0;
+
+    // Players logged in through any of the above, the region is switched once none is left
+    TSet<FAwsGameKitPlayerHandle> LoggedInPlayers;
+    bool bIsConnectionOk = true;
+
+    FDelegateHandle EnteredForegroundHandle;
+    FOnRegionSelected RegionSelectedDelegate;
+};
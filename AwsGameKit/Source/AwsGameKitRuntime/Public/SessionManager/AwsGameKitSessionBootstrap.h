@@ -0,0 +1,101 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in reads run in parallel once a player logs in, followed by one "session ready" notification.
+ */
+
+#pragma once
+
+// GameKit
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Delegates/Delegate.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief One read of the session bootstrap and how long it took.
+ */
+struct FAwsGameKitSessionBootstrapStep
+{
+    // GetUser, ListAchievements, GetBundles or GetAllSlotSyncStatuses
+    FString Name;
+
+    IntResult Status;
+
+    double DurationMs = 0.0;
+};
+
+/**
+ * @brief What FAwsGameKitSessionBootstrap::OnSessionReady() is broadcast with.
+ */
+struct FAwsGameKitSessionReady
+{
+    // GAMEKIT_SUCCESS, or the status of the first configured step which failed
+    IntResult Status;
+
+    // From the successful login to the end of the slowest step
+    double DurationMs = 0.0;
+
+    // In the order GetUser, ListAchievements, GetBundles, GetAllSlotSyncStatuses, leaving out the steps which aren't configured
+    TArray<FAwsGameKitSessionBootstrapStep> Steps;
+};
+
+/**
+ * @brief Runs the reads every game makes right after login in parallel, so the first screens are served from the client caches.
+ *
+ * @details The bootstrap set is declared with console variables, which a project sets in the [ConsoleVariables] section of its DefaultEngine.ini:
+ * - GameKit.SessionBootstrap.GetUser: fetch the player's profile into the AwsGameKitIdentity::GetUser() cache.
+ * - GameKit.SessionBootstrap.ListAchievements: list the achievements into FAwsGameKitAchievementsCache, unless the cached list is up to date.
+ * - GameKit.SessionBootstrap.Bundles: comma-separated bundle names read with GetBundles(), into FAwsGameKitUserGameplayDataCache when it's enabled.
+ * - GameKit.SessionBootstrap.SlotSyncStatuses: call GetAllSlotSyncStatuses(), which refreshes the Game Saving library's cached slots.
+ *   Call SetFileActions() and AddLocalSlots() before logging in so the sync statuses are known.
+ *
+ * Nothing runs when none is set. Once AwsGameKitIdentity::Login() or PollAndRetrieveFederatedTokens() succeeds, the configured steps run in parallel
+ * on the worker pool, and OnSessionReady() is broadcast on the game thread when the last one is done, with the time each step took. A failed step
+ * doesn't stop the others. Logging out drops the bootstrap in progress without broadcasting. All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSessionBootstrap
+{
+public:
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnSessionReady, const FAwsGameKitSessionReady& /* SessionReady */);
+
+    /**
+     * @brief Get the process-wide session bootstrap.
+     */
+    static FAwsGameKitSessionBootstrap& Get();
+
+    /**
+     * @brief Whether at least one step is configured.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Start the configured steps on the worker pool. Called by AwsGameKitIdentity when a login succeeds. Does nothing if no step is configured.
+     */
+    void OnLogin();
+
+    /**
+     * @brief Drop the bootstrap in progress, its OnSessionReady() isn't broadcast. Called by AwsGameKitIdentity::Logout().
+     */
+    void Clear();
+
+    /**
+     * @brief Broadcast on the game thread once the steps started by a login are done. Bind it before logging in.
+     */
+    FOnSessionReady& OnSessionReady() { return SessionReadyDelegate; }
+
+private:
+    void Run(uint32 Generation, double StartTime);
+    bool IsCurrent(uint32 Generation);
+
+    FCriticalSection Mutex;
+
+    // Incremented by every OnLogin() and Clear(), a bootstrap only broadcasts if it's still the latest
+    uint32 CurrentGeneration = 0;
+
+    FOnSessionReady SessionReadyDelegate;
+};
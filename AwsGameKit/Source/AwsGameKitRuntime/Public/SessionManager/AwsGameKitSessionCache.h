@@ -0,0 +1,97 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in encrypted cache of the player's tokens, restored at launch before the network login.
+ */
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitCommonModels.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief Keeps the tokens set with AwsGameKitSessionManager::SetToken() in an encrypted file, and sets them again at the next launch.
+ *
+ * @details Enabled by giving it the game's key with SetKeyProvider(), off by default. Every token set afterwards is written to
+ * Saved/AwsGameKit/SessionCache.bin on the worker pool, encrypted with AES-256-GCM through the engine's PlatformCrypto plugin.
+ * The file is replaced atomically, and a file which was tampered with or encrypted with another key fails its authentication and is ignored.
+ *
+ * At launch, call Restore() once the client config is loaded: the cached tokens are set with AwsGameKitSessionManager::SetToken(), so the
+ * features, their caches and FAwsGameKitOfflineWriteQueue work before any network call. The restored session is then validated in the
+ * background: when a refresh handler is set (see AwsGameKitSessionManager::SetTokenRefreshHandler()), FAwsGameKitSessionTokenRefresher
+ * refreshes each restored token with an expiry on its next tick, and the delegate set with SetTokenRefreshedDelegate() reports whether the
+ * session is still valid. Expired tokens are only restored when they can be refreshed, and GameKit calls wait for their refresh.
+ * Sessions older than GameKit.SessionCache.MaxAgeHours are dropped.
+ *
+ * AwsGameKitIdentity::Logout() and UAwsGameKitIdentityFunctionLibrary::Logout() delete the file. Tokens of a login made with
+ * AwsGameKitIdentity::Login() stay inside the GameKit library and aren't cached; this covers sessions whose tokens the game sets itself, such as
+ * those of a third party identity provider. Such a game signs its players out without calling GameKit's Logout(), so it must call Clear() when
+ * the player signs out, or the next launch restores the signed out player's session.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSessionCache
+{
+public:
+    /**
+     * @brief Supplies the 32 byte AES-256 key of the session cache. Return false if there is no key, nothing is then written or restored.
+     */
+    typedef TFunction<bool(TArray<uint8>& OutKey)> FKeyProvider;
+
+    /**
+     * @brief Get the process-wide session cache.
+     */
+    static FAwsGameKitSessionCache& Get();
+
+    /**
+     * @brief Set the callback which supplies the key, and enable the cache. Pass nullptr to disable it, the file is then left as is.
+     *
+     * @details The key is requested for every write and for Restore(), and wiped from memory once used. Keep it in the platform's secure storage
+     * rather than in the game's files.
+     */
+    void SetKeyProvider(FKeyProvider KeyProvider);
+
+    /**
+     * @brief True if a key provider is set.
+     */
+    bool IsEnabled();
+
+    /**
+     * @brief Set the cached tokens with AwsGameKitSessionManager::SetToken() and start validating them in the background.
+     *
+     * @details Reads and decrypts a small file on the calling thread.
+     * @return True if at least one token was restored.
+     */
+    bool Restore();
+
+    /**
+     * @brief Cache a token which was just set. Called by AwsGameKitSessionManager::SetToken() and UAwsGameKitSessionManagerFunctionLibrary::SetToken().
+     */
+    void OnTokenSet(TokenType_E TokenType, const FString& Value);
+
+    /**
+     * @brief Forget the cached tokens and delete the file. Called by the Logout() of AwsGameKitIdentity and UAwsGameKitIdentityFunctionLibrary,
+     * call it when the player signs out of a third party identity provider.
+     */
+    void Clear();
+
+private:
+    void Persist();
+    bool GetKey(TArray<uint8>& OutKey);
+    static FString GetCacheFilePath();
+
+    FCriticalSection Mutex;
+    FKeyProvider KeyProvider;
+    TMap<TokenType_E, FString> Tokens;
+
+    // Taken while writing or deleting the file, and while taking the snapshot which is written, so the last write holds the latest tokens
+    FCriticalSection FileMutex;
+};
@@ -5,12 +5,15 @@
 
 // GameKit
 #include "AwsGameKitRuntime.h"
+#include "AwsGameKitRuntimePublicHelpers.h"
 #include "Identity/AwsGameKitIdentityWrapper.h"
 #include "Models/AwsGameKitIdentityModels.h"
+#include "Models/AwsGameKitSessionManagerModels.h"
 #include "AwsGameKitCore/Public/Core/AwsGameKitErrors.h"
 
 // Unreal
 #include "CoreMinimal.h"
+#include "Templates/Function.h"
 
 /**
  * @brief This class provides APIs for loading and querying the `awsGameKitClientConfig.yml` file.
@@ -32,9 +35,37 @@ public:
      *
      * @details The `awsGameKitClientConfig.yml` file is generated by GameKit each time a feature is deployed or re-deployed,
      * and has settings for each GameKit feature you've deployed. The file is loaded by calling ReloadConfig().
+     *
+     * When the file lists several regional deployments, the settings of the region in use are loaded in place of the file's, see FAwsGameKitRegionSelector.
+     * A file unchanged since the last reload isn't parsed again (see GameKit.SessionManager.SkipUnchangedConfig).
      */
     static void ReloadConfig();
 
+    /**
+     * @brief Same as ReloadConfig(), but the file is searched for and parsed on a GameKit worker thread instead of the calling thread.
+     *
+     * @details The settings of the features are replaced all at once when the parse is done, calls made in the meantime use the previous settings.
+     * @param OnCompleteDelegate Called on the game thread with the features whose settings are loaded.
+     */
+    static void ReloadConfigAsync(TAwsGameKitDelegateParam<const FAwsGameKitLoadedFeatureSettings&> OnCompleteDelegate);
+
+    /**
+     * @brief Get which features have their settings loaded, all in one call. See AreSettingsLoaded().
+     *
+     * @details The flags are refreshed on each reload, this call doesn't go into the GameKit library.
+     */
+    static FAwsGameKitLoadedFeatureSettings GetLoadedFeatureSettings();
+
+    /**
+     * @brief Replace the HTTP transport settings of the requests the plugin sends itself. See FAwsGameKitTransportSettings and FAwsGameKitTransport.
+     */
+    static void SetTransportSettings(const FAwsGameKitTransportSettings& transportSettings);
+
+    /**
+     * @brief Get the HTTP transport settings set with SetTransportSettings().
+     */
+    static FAwsGameKitTransportSettings GetTransportSettings();
+
     /**
      * @brief Return true if settings are loaded for the feature, false if they are not loaded.
      *
@@ -48,11 +79,27 @@ public:
 
     /**
      * @brief Sets a token's value
+     * @details When FAwsGameKitSessionCache is enabled, the token is also cached for the next launch, see FAwsGameKitSessionCache::Restore().
      * @param tokenType The type of token to set.
      * @param value The value of the token.
     */
     static void SetToken(TokenType_E tokenType, FString value);
 
+    /**
+     * @brief Set the function which gets a new token shortly before a token set with SetToken() expires. See FAwsGameKitSessionTokenRefresher.
+     *
+     * @details Only needed for tokens from a third party identity provider. The tokens of AwsGameKitIdentity::Login() are refreshed by the Session Manager.
+     * @param refreshHandler Called on a dedicated thread, it may block. Return false if no new token could be obtained. Pass an empty function to stop refreshing.
+     */
+    static void SetTokenRefreshHandler(TFunction<bool(TokenType_E tokenType, FString& outNewToken)>&& refreshHandler);
+
+    /**
+     * @brief Set the delegate called on the game thread after every refresh attempt made with the SetTokenRefreshHandler() function.
+     *
+     * @param tokenRefreshedDelegate Receives the refreshed token type and GAMEKIT_SUCCESS, or GAMEKIT_ERROR_GENERAL if the refresh failed. Pass an unbound delegate to clear it.
+     */
+    static void SetTokenRefreshedDelegate(TAwsGameKitDelegateParam<TokenType_E, const IntResult&> tokenRefreshedDelegate);
+
     /**
      * @brief Convert the feature type into a string that is friendly for calling various APIs: it has no whitespace, is all lowercase, and is shortened.
      */
@@ -58,6 +58,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AWS GameKit | SessionManager")
     static bool AreSettingsLoaded(const FeatureType_E featureType);
 
+    /**
+     * Warm up the features during a loading screen, so that their first calls don't wait for the libraries to load, the connections to be made and the Lambdas to start.
+     *
+     * Reloads the config file if a feature has no settings, then loads each feature's library and, when a player is logged in,
+     * makes one cheap read per feature which connects to the backend and wakes its Lambda. Call it again after login to warm up the Lambdas. See FAwsGameKitRuntimeModule::WarmUp().
+     *
+     * @param Features The features to warm up.
+     * @param Error GAMEKIT_ERROR_SETTINGS_MISSING if a feature has no settings, else the status of the first read which failed.
+     * Reads skipped because no player is logged in aren't failures.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | SessionManager", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
+    static void WarmUp(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const TArray<FeatureType_E>& Features,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
     UFUNCTION(BlueprintCallable, Category = "AWS GameKit | SessionManager", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
     static void SetToken(
         UObject* WorldContextObject,
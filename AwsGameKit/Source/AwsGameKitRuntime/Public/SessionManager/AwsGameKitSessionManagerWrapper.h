@@ -14,10 +14,15 @@
 #include <AwsGameKitCore/Public/Core/AwsGameKitDispatcher.h>
 
 // GameKit
-#if PLATFORM_IOS || PLATFORM_ANDROID
+#if PLATFORM_IOS || PLATFORM_ANDROID || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/authentication/exports.h>
 #endif
 
+// Unreal
+#include "Containers/Map.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+
 // Standard library
 #include <string>
 
@@ -30,6 +35,28 @@
  */
 typedef void* GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE;
 
+/**
+ * @brief Which features have their settings loaded from "awsGameKitClientConfig.yml", see AwsGameKitSessionManagerWrapper::GetLoadedFeatureSettings().
+ */
+struct FAwsGameKitLoadedFeatureSettings
+{
+    // One bit per FeatureType, set when the feature's settings are loaded
+    uint32 FeatureBits = 0;
+
+    bool IsLoaded(FeatureType featureType) const
+    {
+        return (FeatureBits & (1u << static_cast<uint32>(featureType))) != 0;
+    }
+
+    /**
+     * @brief Whether the Identity, Achievements, User Gameplay Data and Game State Cloud Saving settings are all loaded.
+     */
+    bool AreClientFeaturesLoaded() const
+    {
+        return IsLoaded(FeatureType::Identity) && IsLoaded(FeatureType::Achievements) && IsLoaded(FeatureType::UserGameplayData) && IsLoaded(FeatureType::GameStateCloudSaving);
+    }
+};
+
 /**
  * This class exposes the GameKit Session Manager APIs and loads the underlying DLL into memory.
  *
@@ -48,6 +75,40 @@ private:
     DEFINE_FUNC_HANDLE(void, GameKitSessionManagerSetToken, (GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, GameKit::TokenType tokenType, const char* value));
     DEFINE_FUNC_HANDLE(void, GameKitSessionManagerInstanceRelease, (GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance));
 
+    // Path of the config file found by the last ReloadConfig(), read by the per-player session managers of FAwsGameKitPlayerContexts
+    FString loadedClientConfigFile;
+
+    // Contents passed to the library by the last ReloadConfig() on the platforms which add settings to the file's, empty when the file was loaded as is
+    FString loadedClientConfigContents;
+
+    // Identifies the config file loaded by the last ReloadConfig(), so that reloading an unchanged file is skipped
+    struct FConfigFingerprint
+    {
+        FString Path;
+        FDateTime Timestamp;
+        int64 Size = -1;
+        uint32 Hash = 0;
+    };
+
+    // What each Session Manager instance loaded, the module's own and those of the players and the load test commandlet
+    struct FInstanceSettings
+    {
+        // FAwsGameKitLoadedFeatureSettings::FeatureBits of the last reload, so the flags are read without calling into the library
+        uint32 FeatureBits = 0;
+        FConfigFingerprint ConfigFingerprint;
+    };
+    TMap<GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE, FInstanceSettings> instanceSettings;
+    mutable FCriticalSection instanceSettingsMutex;
+
+    // Held by the reloads, which may run on the game thread and on workers at the same time
+    FCriticalSection reloadMutex;
+
+    // Fill outFingerprint for the file at path, and return true when it is the file the instance already loaded
+    bool IsConfigUnchanged(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const FString& path, FConfigFingerprint& outFingerprint) const;
+    // Remember the file the instance loaded, unless the load left it without settings
+    void SetLoadedConfigFingerprint(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, const FConfigFingerprint& fingerprint);
+    void RefreshLoadedFeatureSettings(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance);
+
 protected:
     virtual std::string getLibraryFilename() override
     {
@@ -122,6 +183,9 @@ public:
      * In editor mode - one level above FPaths::GameSourceDir().
      * In non-editor mode - FPaths::LaunchDir().
      *
+     * The file isn't parsed again while its timestamp, size and hash are those of the file already loaded, unless GameKit.SessionManager.SkipUnchangedConfig is 0.
+     * Thread safe, reloads are serialized.
+     *
      * @param sessionManagerInstance Pointer to GameKitSessionManager instance created with GameKitSessionManagerInstanceCreate().
     */
     virtual void ReloadConfig(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance);
@@ -144,4 +208,28 @@ public:
      * @param value The value of the token.
     */
     virtual void GameKitSessionManagerSetToken(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance, GameKit::TokenType tokenType, const char* value);
+
+    /**
+     * @brief Which features have their settings loaded in the instance, as of its last reload. Doesn't call into the library, thread safe.
+     *
+     * @details Same as calling GameKitSessionManagerAreSettingsLoaded() for each feature after the last reload.
+     *
+     * @param sessionManagerInstance Pointer to GameKitSessionManager instance created with GameKitSessionManagerInstanceCreate().
+     */
+    virtual FAwsGameKitLoadedFeatureSettings GetLoadedFeatureSettings(GAMEKIT_SESSION_MANAGER_INSTANCE_HANDLE sessionManagerInstance) const;
+
+    /**
+     * @brief Path of the "awsGameKitClientConfig.yml" file loaded by the last ReloadConfig() call, empty if none was found.
+    */
+    virtual FString GetLoadedClientConfigFile() const
+    {
+        return loadedClientConfigFile;
+    }
+
+    /**
+     * @brief Contents of the config loaded by the last ReloadConfig() call, with the settings added on mobile platforms. Empty if none was found.
+     *
+     * @details Reads the file unless its contents were passed to the library, so call it off the game thread.
+    */
+    virtual FString GetLoadedClientConfigContents() const;
 };
@@ -0,0 +1,148 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Proactive refresh of the tokens passed to AwsGameKitSessionManager::SetToken() before they expire.
+ */
+
+#pragma once
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "Models/AwsGameKitCommonModels.h"
+#include "SessionManager/AwsGameKitPlayerContexts.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+// Standard library
+#include <atomic>
+
+class FEvent;
+
+/**
+ * @brief Refreshes the tokens the game sets with AwsGameKitSessionManager::SetToken() shortly before they expire, instead of letting the next feature call fail.
+ *
+ * @details Tokens obtained with AwsGameKitIdentity::Login() are already refreshed by the native Session Manager. This class covers tokens from a third
+ * party identity provider, which the game sets itself. It reads the expiry from the token's JWT "exp" claim when it's set; tokens which aren't JWTs
+ * are ignored.
+ *
+ * Once a token is within GameKit.SessionManager.RefreshLeadSeconds of its expiry, the handler set with SetRefreshHandler() is called on a dedicated
+ * thread to get a new one, which is then set like SetToken() does. Only one refresh runs at a time. A failed refresh is retried every
+ * GameKit.SessionManager.RefreshRetrySeconds until the token is replaced.
+ *
+ * GameKit calls which start on the worker pool while a token they may need has already expired and is being refreshed wait for the
+ * refresh, at most GameKit.SessionManager.RefreshWaitSeconds, instead of each failing with the expired token.
+ *
+ * The delegate set with SetTokenRefreshedDelegate() is called on the game thread after every refresh attempt, with GAMEKIT_SUCCESS or GAMEKIT_ERROR_GENERAL.
+ *
+ * Tokens are tracked for each player of FAwsGameKitPlayerContexts, the player being the one of the FAwsGameKitPlayerScope the token is set in.
+ * The refresh handler and the delegate are called, and the new token is set, in that player's scope: FAwsGameKitPlayerScope::GetCurrent() tells
+ * them which player the token is for.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitSessionTokenRefresher
+{
+public:
+    /**
+     * @brief Called on a dedicated thread to get a new token of TokenType. It may block. Return false if no new token could be obtained.
+     */
+    typedef TFunction<bool(TokenType_E TokenType, FString& OutNewToken)> FRefreshHandler;
+    typedef TAwsGameKitDelegate<TokenType_E, const IntResult&> FTokenRefreshedDelegate;
+
+    /**
+     * @brief Get the process-wide token refresher.
+     */
+    static FAwsGameKitSessionTokenRefresher& Get();
+
+    /**
+     * @brief Register the expiry check with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Unregister the expiry check and forget the tokens. Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Record the expiry of a token which was just set. Called by AwsGameKitSessionManager::SetToken() and UAwsGameKitSessionManagerFunctionLibrary::SetToken().
+     */
+    void OnTokenSet(TokenType_E TokenType, const FString& Value);
+
+    /**
+     * @brief Refresh a token of the current player on the next tick, whatever its expiry, when a refresh handler is set. Used by FAwsGameKitSessionCache to validate restored tokens.
+     *
+     * @details Does nothing if the token isn't tracked. A failed refresh is retried like one made before expiry, until the token is replaced.
+     */
+    void RequestRefresh(TokenType_E TokenType);
+
+    /**
+     * @brief Whether a refresh handler is set.
+     */
+    bool HasRefreshHandler();
+
+    /**
+     * @brief The "exp" claim of a JWT, in seconds since epoch. Zero if the token isn't a JWT or has no expiry.
+     */
+    static int64 GetTokenExpiry(const FString& Token);
+
+    /**
+     * @brief Set the function which refreshes tokens. Pass an empty function to stop refreshing.
+     */
+    void SetRefreshHandler(FRefreshHandler&& Handler);
+
+    /**
+     * @brief Set the delegate called on the game thread after every refresh. Pass an unbound delegate to clear it.
+     */
+    void SetTokenRefreshedDelegate(const FTokenRefreshedDelegate& Delegate);
+
+    /**
+     * @brief Block while an expired token is being refreshed. Called on the worker pool before every GameKit call. Returns straight away otherwise.
+     */
+    void WaitForExpiredTokenRefresh();
+
+    /**
+     * @brief Forget the expiry of the current player's tokens, for example when the player logs out.
+     */
+    void Clear();
+
+    /**
+     * @brief Forget the expiry of a player's tokens. Called by FAwsGameKitPlayerContexts::ReleasePlayer().
+     */
+    void ClearPlayer(FAwsGameKitPlayerHandle Player);
+
+private:
+    struct FTrackedToken
+    {
+        int64 ExpiresAt = 0;
+        double NextAttemptAt = 0.0;
+
+        // Set by RequestRefresh(), until the token is replaced
+        bool bRefreshRequested = false;
+    };
+
+    FAwsGameKitSessionTokenRefresher();
+    ~FAwsGameKitSessionTokenRefresher();
+
+    // A token type of a player
+    typedef TPair<FAwsGameKitPlayerHandle, TokenType_E> FTokenKey;
+
+    bool Tick(float DeltaTime);
+    void Refresh(const FTokenKey& Key, int64 ExpiresAt);
+
+    FCriticalSection Mutex;
+    TMap<FTokenKey, FTrackedToken> Tokens;
+    TSharedPtr<FRefreshHandler, ESPMode::ThreadSafe> RefreshHandler;
+    FTokenRefreshedDelegate TokenRefreshedDelegate;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    // Set while a refresh runs. RefreshingExpiresAt is the expiry of the token being refreshed, callers only wait once it's passed.
+    std::atomic<bool> bRefreshing{ false };
+    std::atomic<int64> RefreshingExpiresAt{ 0 };
+    FEvent* RefreshDone = nullptr;
+};
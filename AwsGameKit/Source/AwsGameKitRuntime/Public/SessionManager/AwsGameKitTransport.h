@@ -0,0 +1,64 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief HTTP transport settings of the requests the plugin sends itself.
+ */
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitSessionManagerModels.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+class IHttpRequest;
+
+/**
+ * @brief Holds the FAwsGameKitTransportSettings set with AwsGameKitSessionManager::SetTransportSettings() and applies them to the plugin's HTTP requests.
+ *
+ * @details The calls of the features go through the HTTP client of the prebuilt GameKit libraries, which the plugin can't configure. The requests the
+ * plugin sends itself, such as achievement icon downloads and latency uploads, are created with CreateRequest() so that they share the Unreal HTTP
+ * module's connections with the settings applied.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitTransport
+{
+public:
+    /**
+     * @brief Get the process-wide transport.
+     */
+    static FAwsGameKitTransport& Get();
+
+    /**
+     * @brief Replace the transport settings. Applies to the requests created afterwards.
+     */
+    void SetSettings(const FAwsGameKitTransportSettings& Settings);
+
+    /**
+     * @brief Get a copy of the current transport settings.
+     */
+    FAwsGameKitTransportSettings GetSettings() const;
+
+    /**
+     * @brief Create an Unreal HTTP request with the transport settings applied.
+     *
+     * @details During a traced call, the request carries the call's X-GameKit-Request-Id header, see FAwsGameKitTrace::GetRequestId().
+     */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest() const;
+
+    /**
+     * @brief The distinct scheme and host, such as https://abc.execute-api.us-west-2.amazonaws.com/, of every *_base_url in the contents of awsGameKitClientConfig.yml.
+     */
+    static TArray<FString> GetEndpointHosts(const FString& ClientConfigContents);
+
+private:
+    FAwsGameKitTransport() = default;
+
+    mutable FCriticalSection Mutex;
+    FAwsGameKitTransportSettings Settings;
+};
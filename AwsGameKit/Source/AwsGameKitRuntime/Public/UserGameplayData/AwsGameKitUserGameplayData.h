@@ -5,8 +5,11 @@
 
 // GameKit
 #include "AwsGameKitRuntimePublicHelpers.h"
+#include "Common/AwsGameKitFutures.h"
 #include <AwsGameKitCore/Public/Core/AwsGameKitDispatcher.h>
 #include "UserGameplayData/AwsGameKitUserGameplayDataWrapper.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataTrackedBundle.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataUtf8Bundle.h"
 #include "Models/AwsGameKitUserGameplayDataModels.h"
 
 // Unreal
@@ -18,6 +21,8 @@
 struct UserGameplayDataLibrary;
 class FNetworkStatusChangeDelegate;
 class FCacheProcessedDelegate;
+class FCircuitBreakerStateChangeDelegate;
+class FRetryQueueStatsDelegate;
 
 /**
  * @brief This class provides APIs for maintaining player game data in the cloud, available when and where the player signs into the game.
@@ -25,9 +30,51 @@ class FCacheProcessedDelegate;
 class AWSGAMEKITRUNTIME_API AwsGameKitUserGameplayData
 {
 private:
+    friend class FAwsGameKitBenchmarks;
+    friend class FAwsGameKitLifecycle;
+    friend class FAwsGameKitSessionBootstrap;
+    friend class FAwsGameKitUserGameplayDataWriteBehind;
+    friend class UAwsGameKitUserGameplayDataFunctionLibrary;
+
     static UserGameplayDataLibrary GetUserGameplayDataLibraryFromModule();
 
+    // Sends the bundle on the calling thread.
+    static IntResult AddBundleBlocking(const FUserGameplayDataBundle& userGameplayDataBundle, FUserGameplayDataBundle& unprocessedBundleItems);
+
+    // Reads the bundle on the calling thread.
+    static IntResult GetBundleBlocking(const FString& UserGameplayDataBundleName, FUserGameplayDataBundle& OutBundle);
+
+    // Reads the bundle on the calling thread into UTF-8 storage, without the client-side cache.
+    static IntResult GetBundleUtf8Blocking(const FString& UserGameplayDataBundleName, FAwsGameKitUserGameplayDataUtf8Bundle& OutBundle);
+
+    // Reads the bundle on the calling thread, passing every Request.PageSize items to OnPage.
+    static IntResult GetBundleStreamedBlocking(const FUserGameplayDataStreamBundleRequest& Request, TFunctionRef<void(FUserGameplayDataBundle&&)> OnPage, FUserGameplayDataBundle& OutBundle);
+
+    // Reads the bundles on the calling thread and up to GET_BUNDLES_MAX_PARALLEL_REQUESTS - 1 other worker threads.
+    static IntResult GetBundlesBlocking(const TArray<FString>& UserGameplayDataBundleNames, TArray<FUserGameplayDataBundle>& OutBundles);
+
+    // Writes the item on the calling thread, without going through the write-behind buffer.
+    static IntResult UpdateItemBlocking(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue);
+
+    // Reads, increments and writes the item on the calling thread, one increment at a time.
+    static IntResult IncrementBundleItemBlocking(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta, FUserGameplayDataBundleItemValue& OutBundleItem);
+
+    // Flushes the buffered updates and writes the retry queue on the calling thread. The library writes libraryCacheFile + ".tmp",
+    // which then replaces cacheFile, so an interrupted write never leaves a truncated queue behind.
+    static IntResult PersistToCacheBlocking(const FString& cacheFile, const FString& libraryCacheFile);
+
+    // Writes the retry queue and the bundle cache on the calling thread, without flushing the buffered updates first.
+    static IntResult WriteCacheBlocking(const FString& cacheFile, const FString& libraryCacheFile);
+
+    // WriteCacheBlocking() to the cache file the game last passed to PersistToCache() or LoadFromCache(). Only writes the bundle cache if there is none.
+    static IntResult PersistToLastCacheBlocking();
+
+    // Remembers the cache file the game uses, for PersistToLastCacheBlocking().
+    static void SetLastCacheFile(const FString& cacheFile, const FString& libraryCacheFile);
+
 public:
+    static const int32 GET_BUNDLES_MAX_PARALLEL_REQUESTS = 4;
+
     /**
      * @brief Creates a new bundle or updates BundleItems within a specific bundle for the calling user.
      *
@@ -50,6 +97,23 @@ public:
     */
     static void AddBundle(const FUserGameplayDataBundle& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
 
+    /**
+     * @brief Same as AddBundle() above, but takes ownership of the bundle so its BundleMap is moved to the worker thread instead of copied.
+     */
+    static void AddBundle(FUserGameplayDataBundle&& userGameplayDataBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+
+    /**
+     * @brief Same as AddBundle(), but sends only the items of the tracked bundle which changed since its last acknowledged write.
+     *
+     * @details Unprocessed items, and every sent item when the write fails, stay changed in the tracked bundle and are sent by the next call.
+     * If nothing changed, or a write of the tracked bundle is already in flight, nothing is sent and ResultDelegate is called with GAMEKIT_SUCCESS;
+     * FAwsGameKitUserGameplayDataTrackedBundle::IsDirty() then tells whether another call is needed. See FAwsGameKitUserGameplayDataTrackedBundle.
+     *
+     * @param trackedBundle The bundle to write.
+     * @param ResultDelegate Same as AddBundle().
+    */
+    static void AddTrackedBundle(const FAwsGameKitUserGameplayDataTrackedBundleRef& trackedBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+
     /**
      * @brief Applies the settings to the User Gameplay Data Client. Should be called immediately after the instance has been created and before any other API calls.
      *
@@ -74,9 +138,19 @@ public:
     */
     static void ListBundles(TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> ResultDelegate);
 
+    /**
+     * @brief Same as ListBundles(), but keeps the bundle names as the UTF-8 strings the client library returned, see FAwsGameKitUserGameplayDataUtf8BundleNames.
+     *
+     * @details For C++ code which only reads the names. Status codes are the same as ListBundles().
+    */
+    static void ListBundlesUtf8(TAwsGameKitDelegateParam<const IntResult&, const FAwsGameKitUserGameplayDataUtf8BundleNames&> ResultDelegate);
+
     /**
      * @brief Gets all items that are associated with a certain bundle for the calling user.
      *
+     * @details Calls made while a GetBundle() of the same bundle is in flight don't send a request of their own, they get its result.
+     * Set GameKit.Runtime.DeduplicateReads to 0 to turn this off.
+     *
      * @param UserGameplayDataBundleName The name of the bundle that is being retrieved.
      * @param ResultDelegate Delegate that processes the status code and returned bundle.
      * The ::IntResult (part of the `ResultDelegate` parameter) is a GameKit status code and indicates the result of the API call.
@@ -93,6 +167,15 @@ public:
     */
     static void GetBundle(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
 
+    /**
+     * @brief Same as GetBundle(), but keeps the items as the UTF-8 strings the client library returned, see FAwsGameKitUserGameplayDataUtf8Bundle.
+     *
+     * @details For C++ code which only reads or parses some of the values of large bundles. Items are converted to FStrings only when asked for.
+     * Updates buffered by FAwsGameKitUserGameplayDataWriteBehind are merged in, like GetBundle(). The bundle isn't stored in the client-side
+     * cache and the call isn't shared with a GetBundle() in flight. Status codes are the same as GetBundle().
+    */
+    static void GetBundleUtf8(const FString& UserGameplayDataBundleName, TAwsGameKitDelegateParam<const IntResult&, const FAwsGameKitUserGameplayDataUtf8Bundle&> ResultDelegate);
+
     /**
      * @brief Gets a single item that is associated with a certain bundle for a user.
      *
@@ -112,9 +195,72 @@ public:
     */
     static void GetBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate);
 
+    /**
+     * @brief Same as GetBundle(), but passes the bundle's items to PartialResultDelegate in pages as they are received, instead of only once all of them are.
+     *
+     * @details Use this for large bundles, to start processing the first items while the rest are still being read,
+     * and with Request.KeepAllItems set to false to only hold one page of items in memory at a time.
+     * Updates buffered by FAwsGameKitUserGameplayDataWriteBehind are passed in the last page, after the items read from the backend.
+     * The bundle is only stored in the client-side cache when Request.KeepAllItems is true.
+     *
+     * @param Request Struct holding the bundle name, the number of items in each page, and whether the final result keeps every item.
+     * @param PartialResultDelegate Delegate that processes each page of items, called on the game thread in the order the items were received.
+     * If the call fails, the pages passed before the failure may not contain every item of the bundle.
+     * @param ResultDelegate Delegate that processes the status code after the last page, and every item of the bundle if Request.KeepAllItems is true.
+     * Status codes are the same as GetBundle().
+    */
+    static void GetBundleStreamed(const FUserGameplayDataStreamBundleRequest& Request, TAwsGameKitDelegateParam<const FUserGameplayDataBundle&> PartialResultDelegate, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> ResultDelegate);
+
+    /**
+     * @brief Gets several bundles for the calling user, with a single completion.
+     *
+     * @details Use this instead of calling GetBundle() once per bundle, for example to read the inventory, settings and progress bundles at login.
+     * Up to GET_BUNDLES_MAX_PARALLEL_REQUESTS bundles are read at the same time. Bundle names which are requested more than once are read once.
+     * Every bundle goes through the same client-side cache and write-behind buffer as GetBundle().
+     *
+     * @param UserGameplayDataBundleNames The names of the bundles that are being retrieved.
+     * @param ResultDelegate Delegate that processes the status code and returned bundles.
+     * The returned bundles are in the order of UserGameplayDataBundleNames, and only include the bundles that were read successfully.
+     * The ::IntResult (part of the `ResultDelegate` parameter) is GAMEKIT_SUCCESS when every bundle was read, otherwise it is the status code of the first bundle that failed,
+     * see GetBundle() for the possible status codes.
+    */
+    static void GetBundles(const TArray<FString>& UserGameplayDataBundleNames, TAwsGameKitDelegateParam<const IntResult&, const TArray<FUserGameplayDataBundle>&> ResultDelegate);
+
+    /**
+     * @brief Reads a bundle from the client-side cache on the calling thread, and refreshes it in the background when it is missing or stale.
+     *
+     * @details Lets HUDs and menus read bundle values in the same frame. Returns the bundle last read with GetBundle(), with the items written since,
+     * including updates buffered by FAwsGameKitUserGameplayDataWriteBehind. If the bundle isn't cached or is older than GameKit.UserGameplayData.Cache.TtlSeconds,
+     * GetBundle() is called in the background, stores the result in the cache and calls RefreshDelegate. A bundle is only refreshed once at a time,
+     * so calling this every frame doesn't send a request every frame. While the FAwsGameKitUserGameplayDataCircuitBreaker is open, stale bundles aren't refreshed.
+     *
+     * When the cache is disabled (GameKit.UserGameplayData.Cache.Enabled is 0) this returns false and always calls GetBundle().
+     *
+     * @param UserGameplayDataBundleName The name of the bundle that is being retrieved.
+     * @param OutBundle Receives the cached bundle.
+     * @param RefreshDelegate Optional delegate called with the result of the background refresh, same as GetBundle()'s ResultDelegate.
+     * @return False if the bundle isn't cached, OutBundle is then left unchanged.
+    */
+    static bool GetCachedBundle(const FString& UserGameplayDataBundleName, FUserGameplayDataBundle& OutBundle, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> RefreshDelegate = TAwsGameKitDelegate<const IntResult&, const FUserGameplayDataBundle&>());
+
+    /**
+     * @brief Reads a single item from the client-side cache on the calling thread, and refreshes it in the background when it is missing or stale.
+     *
+     * @details Same as GetCachedBundle() for one item. The refresh calls GetBundleItem().
+     *
+     * @param userGameplayDataBundleItem Struct holding the bundle name and bundle item that should be retrieved.
+     * @param OutBundleItemValue Receives the cached value.
+     * @param RefreshDelegate Optional delegate called with the result of the background refresh, same as GetBundleItem()'s ResultDelegate.
+     * @return False if the item isn't cached, OutBundleItemValue is then left unchanged.
+    */
+    static bool GetCachedBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, FString& OutBundleItemValue, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> RefreshDelegate = TAwsGameKitDelegate<const IntResult&, const FUserGameplayDataBundleItemValue&>());
+
     /**
      * @brief Updates the value of an existing item inside a bundle with new item data.
      *
+     * @details When GameKit.UserGameplayData.WriteBehind.Enabled is 1 the update is buffered and written later together with the other
+     * updates to the same bundle, see FAwsGameKitUserGameplayDataWriteBehind. OnCompleteDelegate is then called once the batched write completes.
+     *
      * @param userGameplayDataBundleItemValue Struct holding the bundle name, bundle item, and new item data.
      * @param OnCompleteDelegate Delegate that processes the status code after the UpdateItem operation has completed.
      * The `OnCompleteDelegate` parameter takes an ::IntResult which contains a GameKit status code and indicates the result of the API call.
@@ -131,6 +277,28 @@ public:
     */
     static void UpdateItem(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
+    /**
+     * @brief Adds Delta to the integer value of an existing item inside a bundle, and returns the new value.
+     *
+     * @details Use this instead of GetBundleItem() followed by UpdateItem() for currencies and stats. The value is stored as its decimal string,
+     * so it can still be read with GetBundle() and GetBundleItem().
+     * When the item has an update buffered by FAwsGameKitUserGameplayDataWriteBehind, the new value is buffered too and the result is GAMEKIT_SUCCESS once it is.
+     *
+     * The backend's IncrementItem endpoint applies the increment atomically on the server with a conditional write, across devices, in a single round trip.
+     * The prebuilt client library doesn't call it yet, so this method reads the item and then updates it, without holding a lock across the two calls.
+     * Until then, concurrent increments of the same item that isn't buffered are last-writer-wins.
+     *
+     * @param userGameplayDataBundleItem Struct holding the bundle name and bundle item that should be incremented.
+     * @param Delta The amount to add, which may be negative.
+     * @param ResultDelegate Delegate that processes the status code and the incremented bundle item.
+     * The ::IntResult (part of the `ResultDelegate` parameter) is a GameKit status code and indicates the result of the API call.
+     * Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID: The item's value isn't a 64-bit integer, or adding Delta to it overflows.
+     * - The status codes of GetBundleItem() and UpdateItem().
+    */
+    static void IncrementBundleItem(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta, TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> ResultDelegate);
+
     /**
      * @brief Permanently deletes all bundles associated with a user.
      *
@@ -185,6 +353,60 @@ public:
     */
     static void DeleteBundleItems(const FUserGameplayDataDeleteItemsRequest& userGameplayDataBundleItemsDeleteRequest, FAwsGameKitStatusDelegateParam OnCompleteDelegate);
 
+    /**
+     * @brief Awaitable versions of the methods above, with the same status codes.
+     *
+     * @details The futures are fulfilled on the GameKit worker thread which finished the call, so calls can be chained with TFuture::Next()
+     * without a hop through the game thread, and combined with AwsGameKitWhenAll(). Reads shared with other callers and updates buffered by
+     * FAwsGameKitUserGameplayDataWriteBehind are fulfilled on the game thread. See MakeAwsGameKitStatusFuture().
+    */
+    static TFuture<TAwsGameKitResult<FUserGameplayDataBundle>> AddBundleAsync(const FUserGameplayDataBundle& userGameplayDataBundle)
+    {
+        return MakeAwsGameKitResultFuture<FUserGameplayDataBundle>([&userGameplayDataBundle](TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> Delegate) { AddBundle(userGameplayDataBundle, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<TArray<FString>>> ListBundlesAsync()
+    {
+        return MakeAwsGameKitResultFuture<TArray<FString>>([](TAwsGameKitDelegateParam<const IntResult&, const TArray<FString>&> Delegate) { ListBundles(Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FUserGameplayDataBundle>> GetBundleAsync(const FString& UserGameplayDataBundleName)
+    {
+        return MakeAwsGameKitResultFuture<FUserGameplayDataBundle>([&UserGameplayDataBundleName](TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundle&> Delegate) { GetBundle(UserGameplayDataBundleName, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<TArray<FUserGameplayDataBundle>>> GetBundlesAsync(const TArray<FString>& UserGameplayDataBundleNames)
+    {
+        return MakeAwsGameKitResultFuture<TArray<FUserGameplayDataBundle>>([&UserGameplayDataBundleNames](TAwsGameKitDelegateParam<const IntResult&, const TArray<FUserGameplayDataBundle>&> Delegate) { GetBundles(UserGameplayDataBundleNames, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FUserGameplayDataBundleItemValue>> GetBundleItemAsync(const FUserGameplayDataBundleItem& userGameplayDataBundleItem)
+    {
+        return MakeAwsGameKitResultFuture<FUserGameplayDataBundleItemValue>([&userGameplayDataBundleItem](TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> Delegate) { GetBundleItem(userGameplayDataBundleItem, Delegate); });
+    }
+
+    static TFuture<IntResult> UpdateItemAsync(const FUserGameplayDataBundleItemValue& userGameplayDataBundleItemValue)
+    {
+        return MakeAwsGameKitStatusFuture([&userGameplayDataBundleItemValue](FAwsGameKitStatusDelegateParam Delegate) { UpdateItem(userGameplayDataBundleItemValue, Delegate); });
+    }
+
+    static TFuture<TAwsGameKitResult<FUserGameplayDataBundleItemValue>> IncrementBundleItemAsync(const FUserGameplayDataBundleItem& userGameplayDataBundleItem, int64 Delta)
+    {
+        return MakeAwsGameKitResultFuture<FUserGameplayDataBundleItemValue>([&userGameplayDataBundleItem, Delta](TAwsGameKitDelegateParam<const IntResult&, const FUserGameplayDataBundleItemValue&> Delegate) { IncrementBundleItem(userGameplayDataBundleItem, Delta, Delegate); });
+    }
+
+    static TFuture<IntResult> DeleteBundleAsync(const FString& UserGameplayDataBundleName)
+    {
+        return MakeAwsGameKitStatusFuture([&UserGameplayDataBundleName](FAwsGameKitStatusDelegateParam Delegate) { DeleteBundle(UserGameplayDataBundleName, Delegate); });
+    }
+
+    /**
+     * @brief Send the item updates buffered by FAwsGameKitUserGameplayDataWriteBehind now instead of waiting for GameKit.UserGameplayData.WriteBehind.IntervalMs.
+     *
+     * @details Each buffered call's OnCompleteDelegate is called when its bundle has been written. Does nothing when nothing is buffered.
+    */
+    static void FlushBufferedUpdates();
+
     /**
      * @brief Start the Retry background thread.
     */
@@ -214,10 +436,41 @@ public:
     */
     static void SetCacheProcessedDelegate(const FCacheProcessedDelegate& cacheProcessedDelegate);
 
+    /**
+     * @brief Set the callback to invoke on the game thread when the client-side circuit breaker opens, half opens or closes.
+     * See FAwsGameKitUserGameplayDataCircuitBreaker, which is disabled unless GameKit.UserGameplayData.CircuitBreaker.FailureThreshold is set.
+     *
+     * @param circuitBreakerStateChangeDelegate Reference to receiver that will be notified when the circuit breaker state changes
+    */
+    static void SetCircuitBreakerStateChangeDelegate(const FCircuitBreakerStateChangeDelegate& circuitBreakerStateChangeDelegate);
+
+    /**
+     * @brief Get the current state of the client-side circuit breaker, see FAwsGameKitUserGameplayDataCircuitBreaker.
+    */
+    static UserGameplayDataCircuitState_E GetCircuitBreakerState();
+
+    /**
+     * @brief Set the callback to invoke on the game thread when the offline retry queue counters change, see GetRetryQueueStats().
+     *
+     * @param retryQueueStatsDelegate Reference to receiver that will be notified when the retry queue counters change
+    */
+    static void SetRetryQueueStatsDelegate(const FRetryQueueStatsDelegate& retryQueueStatsDelegate);
+
+    /**
+     * @brief Get a snapshot of the offline retry queue counters: queue depth and bytes, age of the oldest queued call, and network outages.
+     *
+     * @details Cheap enough to call every frame. The retry queue lives in the GameKit library, so the counters are derived from the results of
+     * the calls made through this class and from the network status changes it reports.
+    */
+    static FUserGameplayDataRetryQueueStats GetRetryQueueStats();
+
     /**
      * @brief Write the pending API calls to cache.
      * Pending API calls are requests that could not be sent due to network being offline or other failures.
      * The internal queue of pending calls is cleared. It is recommended to stop the background thread before calling this method.
+     * Item updates buffered by FAwsGameKitUserGameplayDataWriteBehind are sent first, so that they are persisted too if they can't be written.
+     * The bundle cache is also written to disk when GameKit.UserGameplayData.Cache.Persist is 1, see FAwsGameKitUserGameplayDataCache.
+     * The queue is written to a temporary file next to cacheFile which replaces cacheFile once complete, so a previous cache file is kept if the game is killed while writing.
      *
      * @param cacheFile path to the offline cache file.
      * @param OnCompleteDelegate Delegate that processes the status code after the PersistToCache operation has completed.
@@ -232,6 +485,7 @@ public:
      * @brief Read the pending API calls from cache.
      * The calls will be enqueued and retried as soon as the Retry background thread is started and network connectivity is up.
      * The contents of the cache are deleted.
+     * Item updates journaled by FAwsGameKitUserGameplayDataWriteBehind which weren't written in a previous session are sent again too.
      *
      * @param cacheFile path to the offline cache file.
      * @param OnCompleteDelegate Delegate that processes the status code after the LoadFromCache operation has completed.
@@ -0,0 +1,223 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in client-side cache of the player's bundles.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// Unreal
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * @brief Client-side cache of the calling player's bundles, filled by the reads and writes of AwsGameKitUserGameplayData.
+ *
+ * @details The cache is disabled by default. Set the GameKit.UserGameplayData.Cache.Enabled console variable to 1 to enable it.
+ *
+ * The bundles are kept per player id, which is looked up with FAwsGameKitIdentityUserCache. The stores, which run on worker threads, wait for the
+ * lookup; the reads don't, they miss until the id is known. Each store passes the GetGeneration() taken before its request was sent, and is
+ * dropped if the cache was invalidated or the player changed meanwhile, so a refresh still in flight can't bring back what was dropped.
+ *
+ * GetBundle() stores the complete bundle. GetBundleItem(), UpdateItem() and AddBundle() store the items they read or wrote
+ * successfully. DeleteBundle(), DeleteBundleItems() and DeleteAllData() drop what they delete.
+ * Entries become stale GameKit.UserGameplayData.Cache.TtlSeconds after they were stored; stale entries are still returned, flagged as stale,
+ * so that AwsGameKitUserGameplayData::GetCachedBundle() and GetCachedBundleItem() can answer in the same frame and refresh them in the background.
+ *
+ * When GameKit.UserGameplayData.Cache.Persist is 1, each player's bundles are written to UserGameplayDataCache_<player id>.bin in the user
+ * gameplay data save directory (see UAwsGameKitFileUtils::GetFeatureSaveDirectory()) by AwsGameKitUserGameplayData::PersistToCache() and when
+ * the runtime module shuts down, and read back on the player's first use. Everything cached is dropped, in memory and on disk, when the player
+ * logs out.
+ *
+ * The file is a versioned header followed by one length-prefixed record per bundle. On first use the file is memory-mapped and only
+ * the bundle names are read; a bundle's items are decoded the first time the bundle is accessed, so a large cache doesn't stall startup.
+ * The file is written to a temporary file which then replaces the previous one, so an interrupted write never loses the previous cache.
+ *
+ * The decoded bundles count against FAwsGameKitCacheBudget, which evicts the least recently used ones from memory. An evicted bundle is read
+ * from the backend again; it's no longer in the file once the cache is persisted again.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataCache
+{
+public:
+    /**
+     * @brief Get the process-wide bundle cache.
+     */
+    static FAwsGameKitUserGameplayDataCache& Get();
+
+    /**
+     * @brief Whether the cache is enabled (GameKit.UserGameplayData.Cache.Enabled).
+     */
+    static bool IsEnabled();
+
+    ~FAwsGameKitUserGameplayDataCache();
+
+    /**
+     * @brief Changes whenever the cache is invalidated or the logged in player changes. Pass it to the Store methods.
+     *
+     * @details Take it before sending the request whose response is stored.
+     */
+    uint32 GetGeneration();
+
+    /**
+     * @brief Copy a cached bundle.
+     *
+     * @param OutBundle Receives the cached items.
+     * @param bOutIsStale Set to true when the bundle was read from the backend longer than the TTL ago.
+     * @return False if the complete bundle hasn't been read with GetBundle() since it was last invalidated.
+     */
+    bool GetBundle(const FString& BundleName, FUserGameplayDataBundle& OutBundle, bool& bOutIsStale);
+
+    /**
+     * @brief Copy one cached item.
+     *
+     * @param OutBundleItemValue Receives the cached value.
+     * @param bOutIsStale Set to true when the value was stored longer than the TTL ago.
+     * @return False if the item isn't cached.
+     */
+    bool GetItem(const FString& BundleName, const FString& BundleItemKey, FString& OutBundleItemValue, bool& bOutIsStale);
+
+    /**
+     * @brief Replace a cached bundle with the complete bundle returned by the backend.
+     *
+     * @param StoreGeneration GetGeneration() before the bundle was requested.
+     */
+    void StoreBundle(uint32 StoreGeneration, const FUserGameplayDataBundle& Bundle);
+
+    /**
+     * @brief Store items read from or written to the backend, keeping the other cached items of the bundle.
+     *
+     * @param StoreGeneration GetGeneration() before the items were requested or written.
+     * @param UnprocessedItems Items which were not written and are skipped.
+     */
+    void StoreItems(uint32 StoreGeneration, const FUserGameplayDataBundle& Bundle, const TMap<FString, FString>& UnprocessedItems = TMap<FString, FString>());
+
+    /**
+     * @brief Store one item read from or written to the backend.
+     *
+     * @param StoreGeneration GetGeneration() before the item was requested or written.
+     */
+    void StoreItem(uint32 StoreGeneration, const FString& BundleName, const FString& BundleItemKey, const FString& BundleItemValue);
+
+    /**
+     * @brief Drop a cached bundle, or only the given items when BundleItemKeys isn't empty.
+     */
+    void InvalidateBundle(const FString& BundleName, const TArray<FString>& BundleItemKeys = TArray<FString>());
+
+    /**
+     * @brief Drop everything which is cached, in memory and on disk, and the stores still in flight.
+     */
+    void InvalidateAll();
+
+    /**
+     * @brief Mark a bundle or bundle item as being refreshed, so that reading it every frame doesn't start a request every frame.
+     *
+     * @param Key Bundle name, or bundle name and item key joined by GetRefreshKey().
+     * @return False if it is already being refreshed.
+     */
+    bool BeginRefresh(const FString& Key);
+
+    /**
+     * @brief Let the next stale read of a bundle or bundle item refresh it again.
+     */
+    void EndRefresh(const FString& Key);
+
+    /**
+     * @brief Key identifying a bundle item in BeginRefresh() and EndRefresh().
+     */
+    static FString GetRefreshKey(const FString& BundleName, const FString& BundleItemKey);
+
+    /**
+     * @brief Write the cache to disk if GameKit.UserGameplayData.Cache.Persist is 1 and something changed since it was last written.
+     */
+    void Persist();
+
+    /**
+     * @brief Put the decoded bundles under FAwsGameKitCacheBudget. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void RegisterWithCacheBudget();
+
+private:
+    struct FCachedItem
+    {
+        FString Value;
+        FDateTime StoredAt;
+    };
+
+    struct FCachedBundle
+    {
+        TMap<FString, FCachedItem> Items;
+        FDateTime FetchedAt;
+
+        // Set when every item of the bundle was read, rather than only some items being read or written
+        bool bComplete = false;
+
+        // FPlatformTime::Seconds() of the last read or write, for FAwsGameKitCacheBudget
+        double LastUsed = 0.0;
+    };
+
+    // Location of a bundle record which is still only on disk
+    struct FDiskRecord
+    {
+        int64 Offset;
+        int64 Size;
+    };
+
+    // The bundles of one player
+    struct FPlayerCache
+    {
+        FString FilePath;
+        TMap<FString, FCachedBundle> Bundles;
+
+        // Bundles read from disk which haven't been decoded yet, and the file contents they point into
+        TMap<FString, FDiskRecord> DiskRecords;
+        TArrayView<const uint8> DiskContents;
+        TUniquePtr<IMappedFileHandle> MappedFile;
+        TUniquePtr<IMappedFileRegion> MappedRegion;
+        TArray<uint8> LoadedFile;
+
+        bool bTriedDisk = false;
+        bool bDirty = false;
+    };
+
+    void CheckPlayer();
+    bool ResolvePlayer();
+    FPlayerCache* FindPlayer();
+    FPlayerCache* FindPlayerForStore(uint32 StoreGeneration);
+    FPlayerCache& FindOrAddPlayer();
+    static void LoadFromDiskIfNeeded(FPlayerCache& Player);
+    static void LoadFromDiskIfNeeded(FPlayerCache& Player, const FString& BundleName);
+    static void ReleaseDisk(FPlayerCache& Player);
+    static TArray<uint8> Serialize(const FPlayerCache& Player, TMap<FString, FDiskRecord>& OutDiskRecords);
+    int64 GetAllocatedBytes() const;
+    int64 EvictOldestBundle();
+    static bool IsStale(const FDateTime& StoredAt);
+    static FString GetCacheFilePath(const FString& ForPlayerId);
+
+    mutable FCriticalSection Mutex;
+
+    // Serializes writing and deleting the cache files, always taken before Mutex
+    FCriticalSection FileMutex;
+
+    // Keyed by player id
+    TMap<FString, FPlayerCache> Players;
+
+    // The logged in player, empty until it's looked up. PlayerGeneration is the FAwsGameKitIdentityUserCache generation it was looked up in.
+    FString PlayerId;
+    uint32 PlayerGeneration = 0;
+    bool bIsResolvingPlayer = false;
+    uint32 Generation = 0;
+
+    TSet<FString> Refreshing;
+};
@@ -0,0 +1,77 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in client-side circuit breaker for the User Gameplay Data calls.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// Unreal
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Client-side circuit breaker which stops the calls this plugin can defer while the backend is failing, so that recovering clients don't all retry at once.
+ *
+ * @details Disabled by default. Set the GameKit.UserGameplayData.CircuitBreaker.FailureThreshold console variable to the number of consecutive
+ * failures which open the breaker to enable it.
+ *
+ * The result of every User Gameplay Data call is recorded by AwsGameKitUserGameplayDataWrapper. Calls which were enqueued in the offline retry queue,
+ * failed calls and failed HTTP requests count as failures; any other result shows that the backend answered and closes the breaker.
+ * Calls over the rate limits of AddBundle and UpdateBundleItem (see cloudformation/usergamedata/parameters.yml) are answered with 429 Too Many Requests
+ * and fail with GAMEKIT_ERROR_HTTP_REQUEST_FAILED, so a client which keeps exceeding them backs off like one facing a failing backend.
+ * While open, FAwsGameKitUserGameplayDataWriteBehind keeps the buffered items and AwsGameKitUserGameplayData::GetCachedBundle() and GetCachedBundleItem()
+ * don't refresh stale entries. Once the open period has elapsed, the next call which asks TryAcquire() is let through alone as a probe.
+ * Open periods grow with decorrelated jitter, between GameKit.UserGameplayData.CircuitBreaker.OpenBaseSeconds and OpenMaxSeconds, so that
+ * clients which failed together don't probe together.
+ *
+ * State changes are reported on the game thread through AwsGameKitUserGameplayData::SetCircuitBreakerStateChangeDelegate().
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataCircuitBreaker
+{
+public:
+    /**
+     * @brief Get the process-wide circuit breaker.
+     */
+    static FAwsGameKitUserGameplayDataCircuitBreaker& Get();
+
+    /**
+     * @brief Whether the breaker is enabled (GameKit.UserGameplayData.CircuitBreaker.FailureThreshold > 0).
+     */
+    static bool IsEnabled();
+
+    UserGameplayDataCircuitState_E GetState() const;
+
+    /**
+     * @brief Ask whether a deferrable call may be sent now.
+     *
+     * @return True while the breaker is closed or disabled. Once the open period has elapsed, true for a single probe until its result is recorded.
+     */
+    bool TryAcquire();
+
+    /**
+     * @brief Record the status code of a User Gameplay Data call.
+     */
+    void RecordResult(unsigned int StatusCode);
+
+    /**
+     * @brief Next delay of a decorrelated jitter backoff: a random delay between BaseSeconds and three times PreviousSeconds, capped at MaxSeconds.
+     *
+     * @param PreviousSeconds The previous delay, or 0 for the first one.
+     */
+    static double GetDecorrelatedJitterDelay(double BaseSeconds, double MaxSeconds, double PreviousSeconds);
+
+private:
+    void SetState(UserGameplayDataCircuitState_E NewState);
+
+    mutable FCriticalSection Mutex;
+    UserGameplayDataCircuitState_E State = UserGameplayDataCircuitState_E::Closed;
+    int32 ConsecutiveFailures = 0;
+    double OpenSeconds = 0.0;
+    double ReopenAt = 0.0;
+    double ProbeGrantedAt = 0.0;
+};
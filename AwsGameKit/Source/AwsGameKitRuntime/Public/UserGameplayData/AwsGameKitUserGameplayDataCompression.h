@@ -0,0 +1,48 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in compression of large User Gameplay Data item values.
+ */
+
+#pragma once
+
+// Standard library
+#include <string>
+
+/**
+ * @brief Compresses large bundle item values before they are written and decompresses them when they are read.
+ *
+ * @details Disabled by default. Set the GameKit.UserGameplayData.Compression.MinBytes console variable to the UTF-8 size from which values are compressed
+ * to enable it. Values are compressed with zlib and stored as the marker "gkz1:", the uncompressed size, ":" and the base64 of the compressed bytes,
+ * so that the backend stores them as any other string. A value is only compressed when that is shorter than the value itself.
+ *
+ * Compressed values are decompressed by AwsGameKitUserGameplayDataWrapper whether compression is enabled or not, so that every client can read them.
+ * A value which starts with the marker but isn't a valid compressed value is returned as it is.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataCompression
+{
+public:
+    /**
+     * @brief Whether values are compressed (GameKit.UserGameplayData.Compression.MinBytes > 0).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Compress a value when compression is enabled, the value is large enough and compressing makes it shorter.
+     *
+     * @param Value UTF-8 value.
+     * @param OutCompressed Receives the compressed value.
+     * @return False if the value isn't compressed, OutCompressed is then left unchanged.
+     */
+    static bool Compress(const char* Value, std::string& OutCompressed);
+
+    /**
+     * @brief Decompress a value written by Compress().
+     *
+     * @param Value UTF-8 value as read from the backend.
+     * @param OutDecompressed Receives the decompressed value.
+     * @return False if the value isn't compressed, OutDecompressed is then left unchanged.
+     */
+    static bool Decompress(const char* Value, std::string& OutDecompressed);
+};
@@ -8,6 +8,7 @@
 #include "Common/AwsGameKitBlueprintCommon.h"
 #include "UserGameplayData/AwsGameKitUserGameplayDataWrapper.h"
 #include "Models/AwsGameKitUserGameplayDataModels.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataStructSerializer.h"
 
 // Unreal
 #include "Containers/UnrealString.h"
@@ -19,6 +20,10 @@
 
 class FNetworkStatusChangeDelegate;
 class FCacheProcessedDelegate;
+class FCircuitBreakerStateChangeDelegate;
+class FRetryQueueStatsDelegate;
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FDelegateOnGetBundleResultReceived, const FUserGameplayDataStreamBundleRequest&, Request, const FUserGameplayDataBundle&, PartialResults, bool, bIsLastResult);
 
 /**
  * @brief This class provides Blueprint APIs for maintaining player game data in the cloud, available when and where the player signs into the game.
@@ -114,6 +119,47 @@ public:
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
 
+    /**
+     * Same as Get Bundle, but passes the bundle's items to OnPartialResults in pages as they are received, instead of only once all of them are.
+     *
+     * Set Keep All Items to false in the request to only hold one page of items in memory at a time; Results then only contains the bundle name.
+     *
+     * @param Request Struct holding the bundle name, the number of items in each page, and whether Results keeps every item.
+     * @param OnPartialResults Delegate to execute after each page of items.
+     * @param Results UStruct containing the bundle name and, if Keep All Items is set, a map with all key value pairs in the bundle.
+     * @param Error Ustruct containing a GameKit status code and optional error message, see Get Bundle for the possible status codes.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure", AutoCreateRefTerm = "OnPartialResults"))
+    static void GetBundleStreamed(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const FUserGameplayDataStreamBundleRequest& Request,
+        const FDelegateOnGetBundleResultReceived OnPartialResults,
+        FUserGameplayDataBundle& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
+    /**
+     * Gets several bundles for the calling user, with a single completion.
+     *
+     * Use this instead of one Get Bundle node per bundle, for example to read the inventory, settings and progress bundles at login.
+     * Up to AwsGameKitUserGameplayData::GET_BUNDLES_MAX_PARALLEL_REQUESTS bundles are read at the same time.
+     *
+     * @param UserGameplayDataBundleNames The names of the bundles that are being retrieved.
+     * @param Results The bundles that were read successfully, in the order of UserGameplayDataBundleNames.
+     * @param Error Ustruct containing a GameKit status code and optional error message.
+     * The status code is GAMEKIT_SUCCESS when every bundle was read, otherwise it is the status code of the first bundle that failed,
+     * see Get Bundle for the possible status codes.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
+    static void GetBundles(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const TArray<FString>& UserGameplayDataBundleNames,
+        TArray<FUserGameplayDataBundle>& Results,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
     /**
      * Gets a single item that is associated with a certain bundle for a user.
      *
@@ -163,6 +209,31 @@ public:
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
 
+    /**
+     * Adds Delta to the integer value of an existing item inside a bundle, and returns the new value.
+     *
+     * Use this instead of Get Bundle Item followed by Update Item for currencies and stats.
+     * Increments made through this node are applied one at a time, so concurrent increments from this client are never lost.
+     *
+     * @param UserGameplayDataBundleItem Struct holding the bundle name and bundle item that should be incremented.
+     * @param Delta The amount to add, which may be negative.
+     * @param Result The incremented bundle item.
+     * @param Error Ustruct containing a GameKit status code and optional error message.
+     * Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_INVALID: The item's value isn't a 64-bit integer, or adding Delta to it overflows.
+     * - The status codes of Get Bundle Item and Update Item.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data", meta = (WorldContext = "WorldContextObject", Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "SuccessOrFailure"))
+    static void IncrementBundleItem(
+        UObject* WorldContextObject,
+        FLatentActionInfo LatentInfo,
+        const FUserGameplayDataBundleItem& UserGameplayDataBundleItem,
+        int64 Delta,
+        FUserGameplayDataBundleItemValue& Result,
+        EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
+        FAwsGameKitOperationResult& Error);
+
     /**
      * Permanently deletes all bundles associated with a user.
      *
@@ -268,6 +339,38 @@ public:
         static void SetCacheProcessedDelegate(
             const FCacheProcessedDelegate& CacheProcessedDelegate);
 
+    /**
+     * Set the callback to invoke when the client-side circuit breaker opens, half opens or closes.
+     * The circuit breaker is disabled unless the GameKit.UserGameplayData.CircuitBreaker.FailureThreshold console variable is set.
+     *
+     * @param CircuitBreakerStateChangeDelegate Reference to receiver that will be notified when the circuit breaker state changes
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data")
+        static void SetCircuitBreakerStateChangeDelegate(
+            const FCircuitBreakerStateChangeDelegate& CircuitBreakerStateChangeDelegate);
+
+    /**
+     * Get the current state of the client-side circuit breaker.
+    */
+    UFUNCTION(BlueprintPure, Category = "AWS GameKit | User Gameplay Data")
+        static UserGameplayDataCircuitState_E GetCircuitBreakerState();
+
+    /**
+     * Set the callback to invoke when the offline retry queue counters change, see GetRetryQueueStats().
+     *
+     * @param RetryQueueStatsDelegate Reference to receiver that will be notified when the retry queue counters change
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data")
+        static void SetRetryQueueStatsDelegate(
+            const FRetryQueueStatsDelegate& RetryQueueStatsDelegate);
+
+    /**
+     * Get a snapshot of the offline retry queue counters: queue depth and bytes, age of the oldest queued call, and network outages.
+     * Cheap enough to call every frame.
+    */
+    UFUNCTION(BlueprintPure, Category = "AWS GameKit | User Gameplay Data")
+        static FUserGameplayDataRetryQueueStats GetRetryQueueStats();
+
     /**
      * Write the pending API calls to cache.
      * Pending API calls are requests that could not be sent due to network being offline or other failures.
@@ -291,6 +394,7 @@ public:
      * Read the pending API calls from cache.
      * The calls will be enqueued and retried as soon as the Retry background thread is started and network connectivity is up.
      * The contents of the cache are deleted.
+     * Item updates journaled by FAwsGameKitUserGameplayDataWriteBehind which weren't written in a previous session are sent again too.
      *
      * @param CacheFile path to the offline cache file.
      * @param Error Ustruct containing a GameKit status code and optional error message.
@@ -305,4 +409,36 @@ public:
         const FString& CacheFile,
         EAwsGameKitSuccessOrFailureExecutionPin& SuccessOrFailure,
         FAwsGameKitOperationResult& Error);
+
+    /**
+     * Write the properties of any struct to a bundle, to pass to AddBundle(), instead of formatting each of them into the bundle's map.
+     * See FAwsGameKitUserGameplayDataStructSerializer for how each property is stored.
+     *
+     * @param Struct The struct to write.
+     * @param BundleName Name of the bundle.
+     * @param Format Whether each property is an item, or the whole struct is a single item.
+     * @param Bundle Receives the bundle.
+    */
+    UFUNCTION(BlueprintCallable, CustomThunk, Category = "AWS GameKit | User Gameplay Data", meta = (CustomStructureParam = "Struct"))
+    static void StructToBundle(
+        const int32& Struct,
+        const FString& BundleName,
+        UserGameplayDataStructFormat_E Format,
+        FUserGameplayDataBundle& Bundle);
+
+    /**
+     * Read the properties of any struct from a bundle returned by GetBundle(), written by StructToBundle().
+     * Properties the bundle has no item for are left unchanged.
+     *
+     * @param Bundle The bundle to read.
+     * @param Struct The struct to read into.
+     * @return False if an item couldn't be parsed as its property. The other properties are read regardless.
+    */
+    UFUNCTION(BlueprintCallable, CustomThunk, Category = "AWS GameKit | User Gameplay Data", meta = (CustomStructureParam = "Struct"))
+    static bool BundleToStruct(
+        const FUserGameplayDataBundle& Bundle,
+        UPARAM(ref) int32& Struct);
+
+    DECLARE_FUNCTION(execStructToBundle);
+    DECLARE_FUNCTION(execBundleToStruct);
 };
\ No newline at end of file
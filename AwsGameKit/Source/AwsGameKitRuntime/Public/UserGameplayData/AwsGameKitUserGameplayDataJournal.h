@@ -0,0 +1,46 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Append-only journal of the item updates buffered by FAwsGameKitUserGameplayDataWriteBehind.
+ */
+
+#pragma once
+
+// GameKit
+#include "Common/AwsGameKitOfflineJournal.h"
+
+/**
+ * @brief Write-ahead journal which makes the items buffered by FAwsGameKitUserGameplayDataWriteBehind survive a crash.
+ *
+ * @details Disabled by default. Set the GameKit.UserGameplayData.WriteBehind.Journal console variable to 1, together with
+ * GameKit.UserGameplayData.WriteBehind.Enabled, to enable it.
+ *
+ * Every buffered item update is appended to UserGameplayDataJournal.bin in the user gameplay data save directory
+ * (see UAwsGameKitFileUtils::GetFeatureSaveDirectory()) as one record of an FAwsGameKitOfflineJournal, grouped by bundle name and keyed by
+ * bundle item key. Writes which were enqueued in the offline retry queue stay in the journal, since the retry queue is only
+ * on disk once AwsGameKitUserGameplayData::PersistToCache() is called.
+ * The file is synced to disk every GameKit.UserGameplayData.WriteBehind.JournalSyncIntervalMs.
+ *
+ * The records which weren't completed in a previous session are sent again by FAwsGameKitUserGameplayDataWriteBehind::ReplayJournal().
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataJournal : public FAwsGameKitOfflineJournal
+{
+public:
+    /**
+     * @brief Whether the journal is enabled (GameKit.UserGameplayData.WriteBehind.Journal).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Open UserGameplayDataJournal.bin, see FAwsGameKitOfflineJournal::Open().
+     */
+    void Open();
+
+    /**
+     * @brief Sync or compact the journal when due. Called by FAwsGameKitUserGameplayDataWriteBehind's timer.
+     */
+    void Tick();
+};
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
 // Unreal
 #include "Delegates/Delegate.h"
 #include "UObject/NoExportTypes.h"
 
+// Standard library
+#include <atomic>
+
 #include "AwsGameKitUserGameplayDataStateHandler.generated.h"
 
 /**
@@ -14,6 +19,10 @@
  */
 UDELEGATE(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data | Cache Processed Delegate")
 DECLARE_DYNAMIC_DELEGATE_OneParam(FCacheProcessedDelegate, bool, isCacheProcessed);
+UDELEGATE(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data | Circuit Breaker State Change Delegate")
+DECLARE_DYNAMIC_DELEGATE_OneParam(FCircuitBreakerStateChangeDelegate, UserGameplayDataCircuitState_E, circuitState);
+UDELEGATE(BlueprintCallable, Category = "AWS GameKit | User Gameplay Data | Retry Queue Stats Delegate")
+DECLARE_DYNAMIC_DELEGATE_OneParam(FRetryQueueStatsDelegate, const FUserGameplayDataRetryQueueStats&, retryQueueStats);
 class AWSGAMEKITRUNTIME_API AwsGameKitUserGameplayDataStateHandler
 {
 public:
@@ -26,4 +35,62 @@ public:
      * @param cacheProcessedDelegate Reference to receiver that will be notified on when the offline cache is finished processing
     */
     void SetCacheProcessedDelegate(const FCacheProcessedDelegate& cacheProcessedDelegate);
+
+    // Delegate that gets triggered on the game thread when FAwsGameKitUserGameplayDataCircuitBreaker opens, half opens or closes
+    FCircuitBreakerStateChangeDelegate onCircuitBreakerStateChangeDelegate;
+
+    /**
+     * @brief Set the callback to invoke when the circuit breaker state changes.
+     *
+     * @param circuitBreakerStateChangeDelegate Reference to receiver that will be notified when the circuit breaker state changes
+    */
+    void SetCircuitBreakerStateChangeDelegate(const FCircuitBreakerStateChangeDelegate& circuitBreakerStateChangeDelegate);
+
+    // Delegate that gets triggered on the game thread when the retry queue counters change, at most once per frame
+    FRetryQueueStatsDelegate onRetryQueueStatsDelegate;
+
+    /**
+     * @brief Set the callback to invoke when the retry queue counters change.
+     *
+     * @param retryQueueStatsDelegate Reference to receiver that will be notified when the retry queue counters change
+    */
+    void SetRetryQueueStatsDelegate(const FRetryQueueStatsDelegate& retryQueueStatsDelegate);
+
+    /**
+     * @brief Get a snapshot of the retry queue counters. Reads a few atomics, so it can be called every frame from any thread.
+    */
+    FUserGameplayDataRetryQueueStats GetRetryQueueStats() const;
+
+    /**
+     * @brief Count a call which was enqueued in the retry queue. Called by AwsGameKitUserGameplayDataWrapper.
+     *
+     * @param requestBytes Size in bytes of the bundle names, keys and values of the call.
+    */
+    void RecordCallEnqueued(int64 requestBytes);
+
+    /**
+     * @brief Record a network status change reported by the GameKit library. Called by FAwsGameKitRuntimeModule.
+     *
+     * @details Once the network is healthy the queued calls are retried, so they are no longer counted as queued.
+    */
+    void RecordNetworkStatus(bool isConnectionOk);
+
+    /**
+     * @brief Stop counting the queued calls, which were dropped or persisted to the offline cache.
+     *
+     * @details Called by AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataDropAllCachedEvents() and after a
+     * successful AwsGameKitUserGameplayDataWrapper::GameKitUserGameplayDataPersistApiCallsToCache(), which both empty the retry queue.
+    */
+    void ResetQueuedCalls();
+
+private:
+    void NotifyRetryQueueStats();
+
+    std::atomic<int32> queuedCalls{ 0 };
+    std::atomic<int64> queuedBytes{ 0 };
+    std::atomic<double> oldestQueuedCallTime{ 0.0 };
+    std::atomic<int32> totalEnqueuedCalls{ 0 };
+    std::atomic<int32> networkOutages{ 0 };
+    std::atomic<bool> isNetworkHealthy{ true };
+    std::atomic<bool> isNotifyPending{ false };
 };
@@ -0,0 +1,223 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Serialization of UStructs to and from User Gameplay Data bundles, using the struct's reflection data.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// GameKit
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/UnrealString.h"
+#include "UObject/Class.h"
+
+class FAwsGameKitUserGameplayDataUtf8Bundle;
+
+/**
+ * @brief Writes the properties of a UStruct to a bundle and reads them back, so gameplay structs don't have to be flattened to a TMap<FString, FString> by hand.
+ *
+ * @details With UserGameplayDataStructFormat_E::ItemPerProperty, each property is an item keyed by the property's name. Numbers, bools, enums and strings are
+ * formatted and parsed directly; numbers are written with enough digits to be read back exactly, enums by name and bools as "true" or "false". Other
+ * properties, such as nested structs and containers, use Unreal's text export format. Elements of static arrays are keyed "Name.Index" after the first one.
+ * Transient and deprecated properties are skipped.
+ *
+ * With UserGameplayDataStructFormat_E::Binary, the struct is a single item, BINARY_ITEM_KEY, holding the marker "gks1:" and the base64 of the struct's
+ * tagged property serialization. Properties added to or removed from the struct since it was written are handled as they are for save games.
+ *
+ * Reading a bundle sets the properties it has items for and leaves the others unchanged, and detects the format by itself. Items which aren't properties
+ * of the struct are ignored.
+ *
+ * Object references are written as paths and are only read back if the object is loaded. Not thread safe for the same struct instance.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataStructSerializer
+{
+public:
+    /**
+     * @brief Key of the item holding the struct in UserGameplayDataStructFormat_E::Binary.
+     */
+    static const TCHAR* BINARY_ITEM_KEY;
+
+    /**
+     * @brief Write every property of a struct to a bundle.
+     *
+     * @param StructType Reflection data of the struct, for example FMyStruct::StaticStruct().
+     * @param StructData The struct.
+     * @param Format How the struct is stored.
+     * @param OutBundle Receives the items. Its BundleName is left unchanged.
+     */
+    static void ToBundle(const UScriptStruct* StructType, const void* StructData, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& OutBundle);
+
+    /**
+     * @brief Write the properties of a struct which differ from an earlier copy of it, for example the copy last written.
+     *
+     * @details With UserGameplayDataStructFormat_E::Binary the whole struct is written if any property differs.
+     *
+     * @return False if no property differs, OutDelta is then left empty.
+     */
+    static bool ToBundleDelta(const UScriptStruct* StructType, const void* StructData, const void* WrittenStructData, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& OutDelta);
+
+    /**
+     * @brief Get the keys of the items for the properties of a struct which differ from an earlier copy of it, without formatting their values.
+     */
+    static TArray<FString> GetDirtyKeys(const UScriptStruct* StructType, const void* StructData, const void* WrittenStructData, UserGameplayDataStructFormat_E Format);
+
+    /**
+     * @brief Read the properties of a struct from a bundle.
+     *
+     * @return False if an item couldn't be parsed as its property. The other properties are read regardless.
+     */
+    static bool FromBundle(const UScriptStruct* StructType, void* StructData, const FUserGameplayDataBundle& Bundle);
+
+    /**
+     * @brief Same as FromBundle(), reading the bundle returned by AwsGameKitUserGameplayData::GetBundleUtf8().
+     *
+     * @details Numbers, bools and enums are parsed straight from the UTF-8 values, only string properties are converted to FStrings.
+     */
+    static bool FromUtf8Bundle(const UScriptStruct* StructType, void* StructData, const FAwsGameKitUserGameplayDataUtf8Bundle& Bundle);
+
+    /**
+     * @brief Copy the properties of the items a write sent from the struct as it was written to the copy last written, except the unprocessed items.
+     *
+     * @param StructType Reflection data of the struct.
+     * @param WrittenStructData The copy last written, updated.
+     * @param SentStructData The struct as it was when the write started.
+     * @param Delta The items the write sent.
+     * @param UnprocessedItems The unprocessed items the write returned.
+     */
+    static void AcknowledgeWrite(const UScriptStruct* StructType, void* WrittenStructData, const void* SentStructData, const FUserGameplayDataBundle& Delta, const FUserGameplayDataBundle& UnprocessedItems);
+
+    template <typename StructType>
+    static void ToBundle(const StructType& Struct, UserGameplayDataStructFormat_E Format, FUserGameplayDataBundle& OutBundle)
+    {
+        ToBundle(StructType::StaticStruct(), &Struct, Format, OutBundle);
+    }
+
+    template <typename StructType>
+    static bool FromBundle(StructType& Struct, const FUserGameplayDataBundle& Bundle)
+    {
+        return FromBundle(StructType::StaticStruct(), &Struct, Bundle);
+    }
+
+    template <typename StructType>
+    static bool FromUtf8Bundle(StructType& Struct, const FAwsGameKitUserGameplayDataUtf8Bundle& Bundle)
+    {
+        return FromUtf8Bundle(StructType::StaticStruct(), &Struct, Bundle);
+    }
+};
+
+/**
+ * @brief A UStruct stored in a bundle, which writes only the properties changed since its last acknowledged write.
+ *
+ * @details Change Data directly; the changed properties are found by comparing it with the copy last written, so no setter has to mark them.
+ * Read the bundle with AwsGameKitUserGameplayData::GetBundle() or GetBundleUtf8() and pass it to Read(). To write, call BeginWrite(), pass the delta to
+ * AwsGameKitUserGameplayData::AddBundle(), and call EndWrite() with its result:
+ *
+ *     FUserGameplayDataBundle Delta;
+ *     if (PlayerStats.BeginWrite(Delta))
+ *     {
+ *         AwsGameKitUserGameplayData::AddBundle(Delta, [this, Delta](const IntResult& Result, const FUserGameplayDataBundle& Unprocessed) { PlayerStats.EndWrite(Delta, Result, Unprocessed); });
+ *     }
+ *
+ * Before the first Read(), properties which still have their default value aren't written.
+ *
+ * Writes are acknowledged as they are by FAwsGameKitUserGameplayDataTrackedBundle: a failed write acknowledges nothing, an enqueued write acknowledges its
+ * items, unprocessed items stay changed, and only one write is in flight at a time. Not thread safe; use it from the game thread, where AddBundle()
+ * delivers its results.
+ */
+template <typename StructType>
+class TAwsGameKitUserGameplayDataStructBundle
+{
+public:
+    StructType Data;
+
+    explicit TAwsGameKitUserGameplayDataStructBundle(const FString& InBundleName, UserGameplayDataStructFormat_E InFormat = UserGameplayDataStructFormat_E::ItemPerProperty)
+        : BundleName(InBundleName), Format(InFormat)
+    {
+    }
+
+    const FString& GetBundleName() const
+    {
+        return BundleName;
+    }
+
+    /**
+     * @brief Read the struct from the bundle as it is written, for example after AwsGameKitUserGameplayData::GetBundle(). Changed properties are overwritten.
+     *
+     * @return Same as FAwsGameKitUserGameplayDataStructSerializer::FromBundle().
+     */
+    bool Read(const FUserGameplayDataBundle& WrittenBundle)
+    {
+        const bool bParsed = FAwsGameKitUserGameplayDataStructSerializer::FromBundle(Data, WrittenBundle);
+        Written = Data;
+        return bParsed;
+    }
+
+    bool Read(const FAwsGameKitUserGameplayDataUtf8Bundle& WrittenBundle)
+    {
+        const bool bParsed = FAwsGameKitUserGameplayDataStructSerializer::FromUtf8Bundle(Data, WrittenBundle);
+        Written = Data;
+        return bParsed;
+    }
+
+    /**
+     * @brief Whether any property changed since the last acknowledged write.
+     */
+    bool IsDirty() const
+    {
+        return GetDirtyKeys().Num() > 0;
+    }
+
+    TArray<FString> GetDirtyKeys() const
+    {
+        return FAwsGameKitUserGameplayDataStructSerializer::GetDirtyKeys(StructType::StaticStruct(), &Data, &Written, Format);
+    }
+
+    /**
+     * @brief Start a write of the changed properties.
+     *
+     * @param OutDelta Receives the changed properties' items.
+     * @return False if nothing changed or a write is already in flight, OutDelta is then left empty.
+     */
+    bool BeginWrite(FUserGameplayDataBundle& OutDelta)
+    {
+        OutDelta.BundleName = BundleName;
+        OutDelta.BundleMap.Reset();
+        if (bWriteInFlight || !FAwsGameKitUserGameplayDataStructSerializer::ToBundleDelta(StructType::StaticStruct(), &Data, &Written, Format, OutDelta))
+        {
+            return false;
+        }
+
+        // Properties changed from now on are compared with what this write sent once it's acknowledged
+        Sent = Data;
+        bWriteInFlight = true;
+        return true;
+    }
+
+    /**
+     * @brief Complete the write started by BeginWrite().
+     *
+     * @param Delta The items passed to the write.
+     * @param Result The result of the write.
+     * @param UnprocessedItems The unprocessed items the write returned, their properties stay changed.
+     */
+    void EndWrite(const FUserGameplayDataBundle& Delta, const IntResult& Result, const FUserGameplayDataBundle& UnprocessedItems)
+    {
+        bWriteInFlight = false;
+        if (Result.Result == GameKit::GAMEKIT_SUCCESS || Result.Result == GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED)
+        {
+            FAwsGameKitUserGameplayDataStructSerializer::AcknowledgeWrite(StructType::StaticStruct(), &Written, &Sent, Delta, UnprocessedItems);
+        }
+    }
+
+private:
+    FString BundleName;
+    UserGameplayDataStructFormat_E Format;
+    StructType Written;
+    StructType Sent;
+    bool bWriteInFlight = false;
+};
@@ -0,0 +1,102 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief A bundle which tracks the items changed since its last acknowledged write.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// GameKit
+#include "Core/AwsGameKitErrors.h"
+
+// Unreal
+#include "Containers/Set.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * @brief A bundle which records the keys changed since its last acknowledged write, so that AwsGameKitUserGameplayData::AddTrackedBundle() sends only those.
+ *
+ * @details Create it from the bundle read with AwsGameKitUserGameplayData::GetBundle(), which is taken as written, and change it with SetItem().
+ * Setting an item to the value it already has doesn't mark it changed.
+ *
+ * A write acknowledges the items it sent, except the unprocessed items it returned; those stay changed and are sent by the next write.
+ * A write which failed acknowledges nothing. A write which was enqueued in the offline retry queue acknowledges its items, since the
+ * client retries it until it is written.
+ * Only one write of the bundle is in flight at a time so that a newer value can't land first. Items changed while a write is in flight
+ * are sent by the next one; IsDirty() tells whether one is needed.
+ *
+ * All methods are thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataTrackedBundle
+{
+public:
+    /**
+     * @brief Create an empty bundle, every item set is then sent by the first write.
+     */
+    explicit FAwsGameKitUserGameplayDataTrackedBundle(const FString& BundleName);
+
+    /**
+     * @brief Create a bundle from items which are already written, for example the bundle read with AwsGameKitUserGameplayData::GetBundle().
+     */
+    explicit FAwsGameKitUserGameplayDataTrackedBundle(const FUserGameplayDataBundle& WrittenBundle);
+
+    const FString& GetBundleName() const;
+
+    /**
+     * @brief Set an item's value, and mark it changed if the value is new.
+     */
+    void SetItem(const FString& BundleItemKey, const FString& BundleItemValue);
+
+    /**
+     * @brief Find an item's value.
+     *
+     * @return False if the bundle doesn't have the item.
+     */
+    bool FindItem(const FString& BundleItemKey, FString& OutBundleItemValue) const;
+
+    /**
+     * @brief Get every item of the bundle, changed or not.
+     */
+    FUserGameplayDataBundle GetBundle() const;
+
+    /**
+     * @brief Whether any item changed since the last acknowledged write.
+     */
+    bool IsDirty() const;
+
+    TArray<FString> GetDirtyKeys() const;
+
+    /**
+     * @brief Take the bundle as written, for example after it was read again with AwsGameKitUserGameplayData::GetBundle(). Changed items are forgotten.
+     */
+    void Reset(const FUserGameplayDataBundle& WrittenBundle);
+
+    /**
+     * @brief Start a write of the changed items.
+     *
+     * @param OutDelta Receives the changed items.
+     * @return False if nothing changed or a write is already in flight, OutDelta is then left empty.
+     */
+    bool BeginWrite(FUserGameplayDataBundle& OutDelta);
+
+    /**
+     * @brief Complete the write started by BeginWrite().
+     *
+     * @param Delta The items passed to the write.
+     * @param Result The result of the write.
+     * @param UnprocessedItems The unprocessed items the write returned, they stay changed.
+     */
+    void EndWrite(const FUserGameplayDataBundle& Delta, const IntResult& Result, const FUserGameplayDataBundle& UnprocessedItems);
+
+private:
+    mutable FCriticalSection Mutex;
+    FUserGameplayDataBundle Bundle;
+    TSet<FString> DirtyKeys;
+    bool bWriteInFlight = false;
+};
+
+typedef TSharedRef<FAwsGameKitUserGameplayDataTrackedBundle, ESPMode::ThreadSafe> FAwsGameKitUserGameplayDataTrackedBundleRef;
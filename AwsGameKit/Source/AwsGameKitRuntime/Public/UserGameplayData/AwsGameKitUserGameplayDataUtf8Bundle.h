@@ -0,0 +1,123 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Read-only bundle and bundle name list which keep the UTF-8 strings returned by the GameKit client library.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// Unreal
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+
+/**
+ * @brief The items of a bundle as the UTF-8 strings the client library returned, see AwsGameKitUserGameplayData::GetBundleUtf8().
+ *
+ * @details FUserGameplayDataBundle converts every key and value to an FString, one allocation each. This bundle copies them into one
+ * contiguous buffer instead and hands out views into it, so code which only reads or parses a few values doesn't pay for the others.
+ * Each view is followed by a NUL character in the buffer, so GetData() of a view can be passed to C string parsers.
+ *
+ * Items are looked up with a hash index. Use ToBundle() or FindValueAsString() to convert to FStrings when needed, for example for Blueprints.
+ *
+ * Views stay valid until the bundle is changed or destroyed. Not thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataUtf8Bundle
+{
+public:
+    FString BundleName;
+
+    /**
+     * @brief Remove every item, keeping the allocations.
+     */
+    void Reset();
+
+    /**
+     * @brief Make room for NumItems items of NumBytes bytes in total.
+     */
+    void Reserve(int32 NumItems, int32 NumBytes);
+
+    /**
+     * @brief Add an item, or replace the value of the item with the same key.
+     */
+    void Add(const char* Key, const char* Value);
+
+    int32 Num() const;
+
+    FUtf8StringView GetKey(int32 Index) const;
+
+    FUtf8StringView GetValue(int32 Index) const;
+
+    /**
+     * @brief Find the value of an item.
+     *
+     * @return False if the bundle doesn't have the item.
+     */
+    bool FindValue(FUtf8StringView Key, FUtf8StringView& OutValue) const;
+
+    /**
+     * @brief Same as FindValue(), converting the key and the value.
+     */
+    bool FindValueAsString(const FString& Key, FString& OutValue) const;
+
+    /**
+     * @brief Convert every item, for example to pass the bundle to Blueprints.
+     */
+    void ToBundle(FUserGameplayDataBundle& OutBundle) const;
+
+    /**
+     * @brief Convert a view of this bundle to an FString.
+     */
+    static FString ToString(FUtf8StringView View);
+
+private:
+    struct FSpan
+    {
+        int32 Offset;
+        int32 Len;
+    };
+
+    struct FItem
+    {
+        FSpan Key;
+        FSpan Value;
+    };
+
+    FSpan Append(const char* Str);
+    FUtf8StringView GetView(const FSpan& Span) const;
+    int32 FindIndex(FUtf8StringView Key, uint32 Hash) const;
+
+    TArray<UTF8CHAR> Buffer;
+    TArray<FItem> Items;
+    TMultiMap<uint32, int32> IndexByHash;
+};
+
+/**
+ * @brief The bundle names returned by the client library as UTF-8 strings, see AwsGameKitUserGameplayData::ListBundlesUtf8().
+ *
+ * @details Same storage as FAwsGameKitUserGameplayDataUtf8Bundle, without the index. Not thread safe.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataUtf8BundleNames
+{
+public:
+    void Reset();
+
+    void Add(const char* BundleName);
+
+    int32 Num() const;
+
+    FUtf8StringView Get(int32 Index) const;
+
+    /**
+     * @brief Convert every name, for example to pass the list to Blueprints.
+     */
+    void ToArray(TArray<FString>& OutBundleNames) const;
+
+private:
+    TArray<UTF8CHAR> Buffer;
+    TArray<TPair<int32, int32>> Names;
+};
@@ -13,11 +13,14 @@
 #include <AwsGameKitCore/Public/Core/AwsGameKitDispatcher.h>
 
 // GameKit
-#if PLATFORM_IOS || PLATFORM_ANDROID
+#if PLATFORM_IOS || PLATFORM_ANDROID || WITH_AWSGAMEKIT_DIRECT_LINK
 #include <aws/gamekit/user-gameplay-data/exports.h>
 #endif
 #include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data_models.h>
 
+// Unreal
+#include "Templates/Function.h"
+
 // Standard library
 #include <string>
 
@@ -135,6 +138,15 @@ public:
      */
     virtual unsigned int GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TArray<FString>& inOutData);
 
+    /**
+     * @brief Same as above, but passes each bundle name to onBundle as the library returns it instead of collecting them in an array.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitUserGameplayData instance created with GameKitUserGameplayDataInstanceCreateWithSessionManager()
+     * @param onBundle Called on the calling thread for every bundle name. Names already passed to it are not taken back if the call fails.
+     * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+     */
+    virtual unsigned int GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TFunctionRef<void(const char* bundleName)> onBundle);
+
     /**
      * @brief Gets user gameplay data stored for the calling user from a specific bundle.
      *
@@ -145,6 +157,16 @@ public:
      */
     virtual unsigned int GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, TMap<FString, FString>& inOutData, char* bundleName);
 
+    /**
+     * @brief Same as above, but passes each key value pair to onItem as the library returns it instead of collecting them in a map.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitUserGameplayData instance created with GameKitUserGameplayDataInstanceCreateWithSessionManager().
+     * @param bundleName The name of the bundle that should be referenced in DyanmoDB.
+     * @param onItem Called on the calling thread for every item of the bundle. Items already passed to it are not taken back if the call fails.
+     * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+     */
+    virtual unsigned int GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, TFunctionRef<void(const char* key, const char* value)> onItem);
+
     /**
      * @brief Gets a single stored item from a specific bundle for the calling user.
      *
@@ -0,0 +1,190 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/** @file
+ * @brief Opt-in write-behind buffering of UpdateItem() calls.
+ */
+
+#pragma once
+
+#include "AwsGameKitRuntime/Public/Models/AwsGameKitUserGameplayDataModels.h"
+
+// GameKit
+#include "AwsGameKitRuntimePublicHelpers.h"
+#include "UserGameplayData/AwsGameKitUserGameplayDataJournal.h"
+
+// Unreal
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * @brief Buffers the items passed to AwsGameKitUserGameplayData::UpdateItem() and writes them per bundle as one AddBundle() request.
+ *
+ * @details Disabled by default. Set the GameKit.UserGameplayData.WriteBehind.Enabled console variable to 1 to enable it.
+ *
+ * Items are keyed by (BundleName, BundleItemKey) and the last value written wins. A bundle's buffered items are sent
+ * GameKit.UserGameplayData.WriteBehind.IntervalMs after the first of them was buffered, when GameKit.UserGameplayData.WriteBehind.MaxItems
+ * items are buffered, or when FlushAll() is called.
+ * The batched write goes through the same client as AddBundle(), so it is enqueued in the offline retry queue while the network is unhealthy
+ * and is included by AwsGameKitUserGameplayData::PersistToCache(), which flushes the buffer first.
+ *
+ * At most FUserGameplayDataClientSettings::DrainConcurrency bundles are sent at the same time and a bundle is never sent again before its previous
+ * write completed, so the writes of one bundle stay in order while independent bundles are written in parallel.
+ * Once a write is enqueued in the offline retry queue, which the client retries one call at a time, the buffered bundles are held and keep merging
+ * their updates. One bundle is sent to probe the backend after a decorrelated jitter delay, starting from FUserGameplayDataClientSettings::RetryIntervalSeconds,
+ * so that clients which went offline together don't probe together; once it is written, the held bundles are drained in parallel, each as one AddBundle() request.
+ * Bundles are held the same way while the FAwsGameKitUserGameplayDataCircuitBreaker is open, and a single one is sent when it lets a probe through.
+ *
+ * Every buffered call's OnCompleteDelegate is called with the result of the batched write.
+ * AwsGameKitUserGameplayData::GetBundle() and GetBundleItem() return the buffered values over the ones read from the backend.
+ * Buffered items of a deleted bundle or bundle item are dropped; their OnCompleteDelegate reports success since the delete supersedes them.
+ * Buffered items are sent when the player logs out and when the runtime module shuts down.
+ *
+ * When GameKit.UserGameplayData.WriteBehind.Journal is 1, every buffered item is also appended to an FAwsGameKitUserGameplayDataJournal, so
+ * that it isn't lost if the game crashes before it is written. The runtime module then shuts down without sending the buffered items; the ones
+ * which weren't written are sent again by ReplayJournal() in the next session. Each record carries the id of the logged in player, looked up
+ * with FAwsGameKitIdentityUserCache, and is only replayed for that player. Items buffered before the id is known aren't replayed.
+ */
+class AWSGAMEKITRUNTIME_API FAwsGameKitUserGameplayDataWriteBehind
+{
+public:
+    // Player id to bundle item key to the sequence number of its journal record
+    typedef TMap<FString, TMap<FString, int64>> FJournalSequences;
+
+    // Bundle name to the journal records of its items
+    typedef TMap<FString, FJournalSequences> FJournalRecords;
+
+    /**
+     * @brief Get the process-wide write-behind buffer.
+     */
+    static FAwsGameKitUserGameplayDataWriteBehind& Get();
+
+    /**
+     * @brief Whether write-behind buffering is enabled (GameKit.UserGameplayData.WriteBehind.Enabled).
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Register the flush timer with the core ticker. Called by FAwsGameKitRuntimeModule::StartupModule().
+     */
+    void Startup();
+
+    /**
+     * @brief Send every buffered item on the calling thread and unregister the flush timer.
+     *
+     * @details Called by FAwsGameKitRuntimeModule::ShutdownModule(). Safe to call more than once.
+     * When the journal is enabled the buffered items are left in the journal instead, so that shutting down doesn't wait on the network.
+     * They are dropped when FAwsGameKitLifecycle::HasShutdownDeadlinePassed() and the journal isn't enabled.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Try to buffer an item update.
+     *
+     * @return False if the update wasn't buffered and must be sent by the caller.
+     */
+    bool Add(const FUserGameplayDataBundleItemValue& UserGameplayDataBundleItemValue, const FAwsGameKitStatusDelegate& OnCompleteDelegate);
+
+    /**
+     * @brief Find the buffered value of an item.
+     *
+     * @return False if no value is buffered for the item.
+     */
+    bool FindItem(const FString& BundleName, const FString& BundleItemKey, FString& OutBundleItemValue) const;
+
+    /**
+     * @brief Overlay the buffered values of a bundle on the items read from the backend.
+     */
+    void MergeInto(FUserGameplayDataBundle& Bundle) const;
+
+    /**
+     * @brief Drop the buffered items of a bundle, or only the given items when BundleItemKeys isn't empty.
+     */
+    void Discard(const FString& BundleName, const TArray<FString>& BundleItemKeys = TArray<FString>());
+
+    /**
+     * @brief Drop every buffered item, and every journaled item which isn't written yet.
+     */
+    void DiscardAll();
+
+    /**
+     * @brief Buffer again the items journaled for the logged in player which weren't written in a previous session, so that they are sent.
+     *
+     * @details Called by AwsGameKitUserGameplayData::LoadFromCache(), which is called once the player is logged in. Blocks while the player's id is
+     * looked up. Does nothing if the journal isn't enabled. Items which were updated since are not replayed.
+     */
+    void ReplayJournal();
+
+    /**
+     * @brief The journal records of the items which were enqueued in the offline retry queue so far. Taken before the retry queue is persisted.
+     */
+    FJournalRecords GetEnqueuedJournalRecords() const;
+
+    /**
+     * @brief Complete the journal records returned by GetEnqueuedJournalRecords(), once the retry queue which holds their items is persisted.
+     * The items buffered or enqueued since stay journaled.
+     */
+    void CompleteJournal(const FJournalRecords& Records);
+
+    /**
+     * @brief Sync the journal to disk on the calling thread. Does nothing if the journal isn't enabled. See FAwsGameKitLifecycle.
+     */
+    void Checkpoint();
+
+    /**
+     * @brief Send the buffered items of every bundle now, including the held ones.
+     *
+     * @param bBlocking Send them on the calling thread and return once they are written or enqueued, instead of on the worker pool.
+     * A bundle whose previous write is still in flight is sent once that write completes.
+     */
+    void FlushAll(bool bBlocking = false);
+
+    /**
+     * @brief Apply DrainConcurrency and RetryIntervalSeconds. Called by AwsGameKitUserGameplayData::SetClientSettings().
+     */
+    void SetClientSettings(const FUserGameplayDataClientSettings& ClientSettings);
+
+private:
+    struct FPendingBundle
+    {
+        TMap<FString, FString> Items;
+        TArray<FAwsGameKitStatusDelegate> OnCompleteDelegates;
+        double FlushAt = 0.0;
+
+        FJournalSequences JournalSequences;
+    };
+
+    bool Tick(float DeltaTime);
+    void SendReady();
+    void OnSent(const FString& BundleName, const IntResult& Result, bool bSendNext);
+    void CheckPlayer(uint32 Generation);
+    bool ResolvePlayer(uint32 Generation);
+    void CompleteJournalSequences(const FString& BundleName, const FJournalSequences& Sequences);
+    static void CompleteDiscarded(FPendingBundle&& Discarded);
+    static void Send(const FString& BundleName, FPendingBundle&& Pending, bool bBlocking);
+
+    mutable FCriticalSection Mutex;
+    TMap<FString, FPendingBundle> PendingBundles;
+    TSet<FString> InFlightBundles;
+    int32 MaxInFlightBundles = 4;
+    int32 ProbeIntervalSeconds = 5;
+
+    // Set while writes are enqueued rather than written
+    bool bHolding = false;
+    double NextProbeAt = 0.0;
+    double ProbeDelaySeconds = 0.0;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    FAwsGameKitUserGameplayDataJournal Journal;
+
+    // Id of the logged in player the items are journaled for, empty until ResolvePlayer() looked it up. Dropped when the
+    // FAwsGameKitIdentityUserCache generation changes, since the player may have changed.
+    FString PlayerId;
+    uint32 PlayerGeneration = 0;
+    bool bIsResolvingPlayer = false;
+
+    // Journal records of the items enqueued in the offline retry queue, completed once the queue is persisted
+    FJournalRecords EnqueuedJournalRecords;
+};
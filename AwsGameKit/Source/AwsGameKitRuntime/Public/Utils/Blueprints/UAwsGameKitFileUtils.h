@@ -23,6 +23,33 @@ struct FFilePaths
     TArray<FString> FilePaths;
 };
 
+USTRUCT(BlueprintType)
+struct FFileStat
+{
+    GENERATED_BODY()
+
+    // Absolute path of the file
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Utilities | Files")
+    FString FilePath;
+
+    // Size of the file in bytes
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Utilities | Files")
+    int64 Size = 0;
+
+    // Number of milliseconds since epoch of the file's last modified UTC timestamp, same as GetFileLastModifiedTimestamp()
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Utilities | Files")
+    int64 LastModifiedEpochMilliseconds = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FFileStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AWS GameKit | Utilities | Files")
+    TArray<FFileStat> Files;
+};
+
 /**
  * @brief A library with useful utility functions for interacting with files that can be called from both Blueprint and C++.
  */
@@ -98,6 +125,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Utilities | Files")
     static void GetFilesInDirectory(UPARAM(ref) FFilePaths& result, UPARAM(ref) const FString& directoryPath, UPARAM(ref) const FString& fileExtension);
 
+    /**
+    * Gets the absolute paths, sizes and last modified timestamps of all files in specified directory, in a single pass over the directory.
+    *
+    * Use this instead of calling GetFileLastModifiedTimestamp() on each result of GetFilesInDirectory(), which stats every file again.
+    * Pass the result through GetFilePaths() to call AddLocalSlots() with the SaveInfo.json files found.
+    *
+    * @param result USTRUCT containing a single TArray member, which the files will be copied to.
+    * @param directoryPath The absolute path of the directory you wish to return the contents of.
+    * @param fileExtension The file extension of the files to search for. If NULL or an empty string "" then all files are found.
+    * Otherwise fileExtension can be of the form .EXT or just EXT and only files with that extension will be returned.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Utilities | Files")
+    static void GetFileStatsInDirectory(UPARAM(ref) FFileStats& result, UPARAM(ref) const FString& directoryPath, UPARAM(ref) const FString& fileExtension);
+
+    /**
+    * Gets the absolute paths of the files returned by GetFileStatsInDirectory(), for example to pass them to AddLocalSlots().
+    */
+    UFUNCTION(BlueprintPure, Category = "AWS GameKit | Utilities | Files")
+    static FFilePaths GetFilePaths(const FFileStats& fileStats);
+
     /**
     * Deletes the specified file
     *
@@ -0,0 +1,37 @@
+// Copyright 2022 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "Models/AwsGameKitCommonModels.h"
+
+// Unreal
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "UAwsGameKitLatencyUtils.generated.h" // Last include (Unreal requirement)
+
+/**
+ * @brief A library to read the latency histograms of the GameKit calls, see FAwsGameKitLatencyHistograms
+ */
+UCLASS()
+class AWSGAMEKITRUNTIME_API UAwsGameKitLatencyUtils : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /**
+    * Get the count, mean, p50, p90, p99 and max latency of every GameKit operation, per network type.
+    *
+    * @param bReset Also clear the histograms, so that the next snapshot only covers the calls made after this one.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Utilities | Latency")
+    static TArray<FAwsGameKitLatencySnapshot> GetLatencySnapshot(bool bReset);
+
+    /**
+    * Clear the latency histograms of every GameKit operation.
+    */
+    UFUNCTION(BlueprintCallable, Category = "AWS GameKit | Utilities | Latency")
+    static void ResetLatencyHistograms();
+};